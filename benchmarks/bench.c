@@ -0,0 +1,311 @@
+/*
+  Benchmark driver for sqlite-url, linked statically against the SQLite
+  amalgamation and sqlite-url.c like the demo CLI (see `make bench`).
+
+  Runs every SQL function over corpora of URLs from url_generate() (see
+  url_generate.c), and reports per function and corpus:
+    - ns/row: wall time per corpus row, best of all runs
+    - allocs/row: SQLite and libcurl allocations per corpus row
+    - heap KB: peak SQLite heap usage during the runs
+    - RSS KB: peak resident set size of the process so far
+
+  Usage: bench [rows] [filter]
+    rows    number of URLs per corpus, defaults to 100000
+    filter  only run benchmarks whose "corpus/function" name contains it
+*/
+#include "sqlite3.h"
+// sqlite-url.h expects sqlite3.h to be included first
+#include "sqlite-url.h"
+#include <curl/curl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_ROWS 100000
+#define BENCH_RUNS 3
+
+#pragma region allocation counters
+
+static sqlite3_int64 nAlloc = 0;
+static sqlite3_mem_methods defaultMemMethods;
+
+static void *benchSqliteMalloc(int n) {
+  nAlloc++;
+  return defaultMemMethods.xMalloc(n);
+}
+
+static void *benchSqliteRealloc(void *p, int n) {
+  nAlloc++;
+  return defaultMemMethods.xRealloc(p, n);
+}
+
+static void *benchCurlMalloc(size_t n) {
+  nAlloc++;
+  return malloc(n);
+}
+
+static void benchCurlFree(void *p) { free(p); }
+
+static void *benchCurlRealloc(void *p, size_t n) {
+  nAlloc++;
+  return realloc(p, n);
+}
+
+static char *benchCurlStrdup(const char *z) {
+  nAlloc++;
+  return strdup(z);
+}
+
+static void *benchCurlCalloc(size_t nmemb, size_t size) {
+  nAlloc++;
+  return calloc(nmemb, size);
+}
+
+// Counts every allocation made through SQLite's and libcurl's allocators.
+// Must run before SQLite or libcurl are used.
+static int benchInstallAllocators(void) {
+  sqlite3_mem_methods methods;
+  if (sqlite3_config(SQLITE_CONFIG_GETMALLOC, &defaultMemMethods) !=
+      SQLITE_OK)
+    return 1;
+  methods = defaultMemMethods;
+  methods.xMalloc = benchSqliteMalloc;
+  methods.xRealloc = benchSqliteRealloc;
+  if (sqlite3_config(SQLITE_CONFIG_MALLOC, &methods) != SQLITE_OK)
+    return 1;
+  return curl_global_init_mem(CURL_GLOBAL_DEFAULT, benchCurlMalloc,
+                              benchCurlFree, benchCurlRealloc,
+                              benchCurlStrdup, benchCurlCalloc) != CURLE_OK;
+}
+
+#pragma endregion
+
+#pragma region corpora
+
+int sqlite3_urlgenerate_init(sqlite3 *db, char **pzErrMsg,
+                             const sqlite3_api_routines *pApi);
+
+// url_generate() profiles that each get their own corpus
+static const char *azCorpus[] = {"short", "long", "query",     "idn",  "ipv6",
+                                 "ipv4",  "auth", "malformed", "mixed"};
+
+// Fills the corpus table with nRow URLs of the given url_generate() profile,
+// the blocklist table with the hosts of every tenth of them, and the
+// prefixes table with the /24 or /64 of every tenth IP address host.
+static int benchFillCorpus(sqlite3 *db, const char *zProfile, int nRow) {
+  sqlite3_stmt *pStmt;
+  int rc = sqlite3_exec(db,
+                        "drop table if exists corpus;"
+                        "create table corpus(url text);",
+                        0, 0, 0);
+  if (rc != SQLITE_OK)
+    return rc;
+  rc = sqlite3_prepare_v2(
+      db, "insert into corpus select url from url_generate(?, 1, ?)", -1,
+      &pStmt, 0);
+  if (rc != SQLITE_OK)
+    return rc;
+  sqlite3_bind_int(pStmt, 1, nRow);
+  sqlite3_bind_text(pStmt, 2, zProfile, -1, SQLITE_STATIC);
+  sqlite3_step(pStmt);
+  rc = sqlite3_finalize(pStmt);
+  if (rc != SQLITE_OK)
+    return rc;
+  return sqlite3_exec(db,
+                      "drop table if exists blocklist;"
+                      "create table blocklist as select url_host(url) as host "
+                      "from corpus where rowid % 10 = 0;"
+                      "drop table if exists prefixes;"
+                      "create table prefixes as select url_host(url) || "
+                      "iif(url_host(url) like '[%', '/64', '/24') as prefix "
+                      "from corpus where rowid % 10 = 0 and "
+                      "url_host_ip(url) is not null;",
+                      0, 0, 0);
+}
+
+#pragma endregion
+
+#pragma region benchmarks
+
+typedef struct bench_case bench_case;
+struct bench_case {
+  const char *zName;
+  const char *zSql;
+};
+
+// Every query reads each corpus row once, so results are per corpus row.
+static const bench_case aCase[] = {
+    {"baseline", "select count(url) from corpus"},
+    {"url_valid", "select sum(url_valid(url)) from corpus"},
+    {"url_scheme", "select count(url_scheme(url)) from corpus"},
+    {"url_host", "select count(url_host(url)) from corpus"},
+    {"url_port", "select count(url_port(url)) from corpus"},
+    {"url_path", "select count(url_path(url)) from corpus"},
+    {"url_query", "select count(url_query(url)) from corpus"},
+    {"url_fragment", "select count(url_fragment(url)) from corpus"},
+    {"url_user", "select count(url_user(url)) from corpus"},
+    {"url_password", "select count(url_password(url)) from corpus"},
+    {"url_options", "select count(url_options(url)) from corpus"},
+    {"url_zoneid", "select count(url_zoneid(url)) from corpus"},
+    {"url_public_suffix", "select count(url_public_suffix(url)) from corpus"},
+    {"url_domain", "select count(url_domain(url)) from corpus"},
+    {"url_host_reversed", "select count(url_host_reversed(url)) from corpus"},
+    {"url_surt", "select count(url_surt(url)) from corpus"},
+    {"url_normalize", "select count(url_normalize(url)) from corpus"},
+    {"url_normalize tracking",
+     "select count(url_normalize(url, 'strip_tracking')) from corpus"},
+    {"url_fingerprint", "select count(url_fingerprint(url)) from corpus"},
+    {"url_resolve", "select count(url_resolve(url, '../x?y')) from corpus"},
+    {"url_host_matches",
+     "select sum(url_host_matches(url, 'blocklist')) from corpus"},
+    {"url_host in blocklist", "select count(*) from corpus where url_host(url) "
+                              "in (select host from blocklist)"},
+    {"url_host_ip", "select count(url_host_ip(url)) from corpus"},
+    {"url_host_in_cidr",
+     "select sum(url_host_in_cidr(url, 'prefixes')) from corpus"},
+    {"url_host_cidr",
+     "select count(url_host_cidr(url, 'prefixes')) from corpus"},
+    {"url_host_ascii", "select count(url_host_ascii(url)) from corpus"},
+    {"url_host_unicode", "select count(url_host_unicode(url)) from corpus"},
+    {"url_pattern_match",
+     "select sum(url_pattern_match('/:a/*', url)) from corpus"},
+    {"url_pattern_each", "select count(value) from corpus, "
+                         "url_pattern_each('/:a/*', corpus.url)"},
+    {"url_host+url_path",
+     "select count(url_host(url)), count(url_path(url)) from corpus"},
+    // url() raises an error on invalid URLs, which the malformed corpora
+    // have plenty of
+    {"url", "select count(url(url, 'fragment', 'top')) from corpus "
+            "where url_valid(url)"},
+    {"url (all parts)",
+     "select count(url(url, 'scheme', 'https', 'user', 'u', 'password', 'p', "
+     "'options', 'o', 'host', 'example.com', 'path', '/x', 'query', 'a=1', "
+     "'fragment', 'f', 'zoneid', 'eth0')) from corpus where url_valid(url)"},
+    {"url_escape", "select count(url_escape(url)) from corpus"},
+    {"url_unescape", "select count(url_unescape(url)) from corpus"},
+    {"url_querystring",
+     "select count(url_querystring('u', url, 'n', 1)) from corpus"},
+    {"url_querystring_agg",
+     "select length(url_querystring_agg('u', url)) from corpus"},
+    {"url_query_get",
+     "select count(url_query_get(url, 'utm_source')) from corpus"},
+    {"url_query_set",
+     "select count(url_query_set(url, 'utm_source', 'x')) from corpus"},
+    {"url_query_remove",
+     "select count(url_query_remove(url, 'utm_source', 'utm_medium')) "
+     "from corpus"},
+    {"url_query_keep", "select count(url_query_keep(url, 'q')) from corpus"},
+    {"url_query_each",
+     "select count(value) from corpus, url_query_each(url_query(url))"},
+    {"url_query_each name=",
+     "select count(value) from corpus, url_query_each(url_query(url)) "
+     "where name = 'utm_source'"},
+    {"url_parse", "select count(host), count(path) from corpus, "
+                  "url_parse(corpus.url)"},
+    {"url_path_each",
+     "select count(prefix) from corpus, url_path_each(corpus.url)"},
+    {"url_path_each depth<=1", "select count(segment) from corpus, "
+                               "url_path_each(corpus.url) where depth <= 1"},
+    {"url_host_labels", "select count(label) from corpus, "
+                        "url_host_labels(url_host(corpus.url))"},
+};
+
+static double benchNow(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static long benchPeakRssKb(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+// Runs a benchmark query, printing its stats. Returns an SQLite error code.
+static int benchRun(sqlite3 *db, const char *zCorpus, const bench_case *pCase,
+                    int nRow) {
+  sqlite3_stmt *pStmt;
+  double best = 0;
+  int rc = sqlite3_prepare_v2(db, pCase->zSql, -1, &pStmt, 0);
+  if (rc != SQLITE_OK)
+    return rc;
+  sqlite3_memory_highwater(1);
+  sqlite3_int64 nAllocStart = nAlloc;
+  for (int run = 0; run < BENCH_RUNS; run++) {
+    double start = benchNow();
+    while ((rc = sqlite3_step(pStmt)) == SQLITE_ROW)
+      ;
+    double elapsed = benchNow() - start;
+    if (rc != SQLITE_DONE)
+      break;
+    rc = sqlite3_reset(pStmt);
+    if (run == 0 || elapsed < best)
+      best = elapsed;
+  }
+  sqlite3_finalize(pStmt);
+  if (rc != SQLITE_OK)
+    return rc;
+  printf("%-10s %-22s %10.1f %12.2f %10lld %10ld\n", zCorpus, pCase->zName,
+         best / nRow, (double)(nAlloc - nAllocStart) / (BENCH_RUNS * nRow),
+         sqlite3_memory_highwater(0) / 1024, benchPeakRssKb());
+  fflush(stdout);
+  return SQLITE_OK;
+}
+
+#pragma endregion
+
+int main(int argc, char **argv) {
+  int nRow = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_ROWS;
+  const char *zFilter = argc > 2 ? argv[2] : 0;
+  sqlite3 *db;
+  int rc;
+  if (nRow <= 0) {
+    fprintf(stderr, "usage: %s [rows] [filter]\n", argv[0]);
+    return 1;
+  }
+  if (benchInstallAllocators()) {
+    fprintf(stderr, "could not install allocation counters\n");
+    return 1;
+  }
+  sqlite3_auto_extension((void (*)(void))sqlite3_url_init);
+  sqlite3_auto_extension((void (*)(void))sqlite3_urlgenerate_init);
+  rc = sqlite3_open(":memory:", &db);
+  if (rc != SQLITE_OK) {
+    fprintf(stderr, "could not open database\n");
+    return 1;
+  }
+
+  printf("%-10s %-22s %10s %12s %10s %10s\n", "corpus", "function", "ns/row",
+         "allocs/row", "heap KB", "RSS KB");
+  for (size_t i = 0; i < sizeof(azCorpus) / sizeof(azCorpus[0]); i++) {
+    int isFilled = 0;
+    for (size_t j = 0; j < sizeof(aCase) / sizeof(aCase[0]); j++) {
+      char *zName = sqlite3_mprintf("%s/%s", azCorpus[i], aCase[j].zName);
+      int skip = zFilter && zName && !strstr(zName, zFilter);
+      sqlite3_free(zName);
+      if (skip)
+        continue;
+      if (!isFilled) {
+        rc = benchFillCorpus(db, azCorpus[i], nRow);
+        isFilled = 1;
+      }
+      if (rc == SQLITE_OK)
+        rc = benchRun(db, azCorpus[i], &aCase[j], nRow);
+      if (rc != SQLITE_OK) {
+        fprintf(stderr, "%s/%s: %s\n", azCorpus[i], aCase[j].zName,
+                sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return 1;
+      }
+    }
+  }
+  sqlite3_close(db);
+  return 0;
+}
@@ -0,0 +1,634 @@
+/*
+  url_generate(n [, seed [, profile]]): a table function that generates n
+  synthetic URLs that look like production traffic, for benchmarking
+  sqlite-url. Rows only depend on the seed, the profile and their rowid, so
+  a corpus is the same on every machine.
+
+  Profiles:
+    - "short": popular hosts with shallow paths
+    - "long": deep paths with dot segments, long query strings, fragments
+    - "query": landing pages with long UTM/tracking query strings
+    - "idn": Unicode, punycode and percent-encoded hosts and paths
+    - "ipv6": IPv6 literals, with zone IDs and ports
+    - "ipv4": dotted, numeric and hex IPv4 hosts
+    - "auth": user, password, options and ports
+    - "malformed": invalid or borderline URLs
+    - "mixed" (default): a weighted mix of every other profile
+
+  Hosts follow a Zipfian popularity, so a few hosts make up most rows like
+  in real logs.
+
+  Built into dist/bench, or as its own loadable extension with
+  `make generate`.
+*/
+#include "sqlite3ext.h"
+
+SQLITE_EXTENSION_INIT1
+
+#include <stdint.h>
+#include <string.h>
+
+#pragma region generators
+
+// number of distinct hosts that Zipfian host ranks are drawn from
+#define URL_GENERATE_HOSTS 100000
+
+// splitmix64, which is good enough and the same on every platform
+static uint64_t genNext(uint64_t *pState) {
+  uint64_t z = (*pState += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+// Uniform integer in [0, n).
+static int genRange(uint64_t *pRng, int n) {
+  return (int)(genNext(pRng) % (uint64_t)n);
+}
+
+// 1 with a probability of percent/100.
+static int genChance(uint64_t *pRng, int percent) {
+  return genRange(pRng, 100) < percent;
+}
+
+// Rank in [0, n) with a discrete log-uniform distribution, close to a Zipf
+// distribution with s = 1, using integers only.
+static int genZipf(uint64_t *pRng, int n) {
+  int nBits = 0;
+  while ((1 << nBits) < n)
+    nBits++;
+  int k = genRange(pRng, nBits + 1);
+  int lo = (1 << k) - 1;
+  int rank = lo + genRange(pRng, 1 << k);
+  return rank < n ? rank : genRange(pRng, n);
+}
+
+static const char *aWord[] = {
+    "news",    "shop",   "blog",    "api",     "docs",     "media",
+    "cdn",     "app",    "mail",    "search",  "video",    "users",
+    "img",     "login",  "static",  "account", "products", "category",
+    "item",    "cart",   "checkout", "help",   "about",    "article",
+    "sports",  "world",  "tech",    "travel",  "weather",  "photos",
+    "assets",  "v1",     "v2",      "feed",    "events",   "support"};
+#define GEN_NWORD (int)(sizeof(aWord) / sizeof(aWord[0]))
+
+static const char *aTld[] = {"com", "com", "com", "org",   "net",
+                             "io",  "de",  "co.uk", "fr",  "com.au",
+                             "jp",  "ru",  "info", "edu",  "gov"};
+#define GEN_NTLD (int)(sizeof(aTld) / sizeof(aTld[0]))
+
+static const char *aSyllable[] = {"ka", "lo", "mi", "ne", "ra", "to", "zu",
+                                  "bi", "de", "fa", "go", "hu", "je", "pe",
+                                  "sa", "vo", "wi", "xe", "yo", "qua"};
+#define GEN_NSYLLABLE (int)(sizeof(aSyllable) / sizeof(aSyllable[0]))
+
+// Percent-encoded and raw UTF-8 text, used in paths and query values.
+static const char *aUtf8Encoded[] = {"caf%C3%A9", "%E6%97%A5%E6%9C%AC",
+                                     "stra%C3%9Fe", "%D0%BC%D0%B8%D1%80",
+                                     "%F0%9F%98%80"};
+static const char *aUtf8Raw[] = {"café", "日本", "straße", "мир", "😀"};
+#define GEN_NUTF8 (int)(sizeof(aUtf8Raw) / sizeof(aUtf8Raw[0]))
+
+#define genWord(pRng) aWord[genRange(pRng, GEN_NWORD)]
+
+// Appends the host of the given popularity rank. Hosts only depend on
+// their rank, so popular ranks repeat the same host.
+static void genHost(sqlite3_str *s, int rank) {
+  uint64_t rng = (uint64_t)rank * 0x2545f4914f6cdd1dull;
+  int nSyllable = 2 + genRange(&rng, 3);
+  if (genChance(&rng, 60))
+    sqlite3_str_appendall(s, "www.");
+  else if (genChance(&rng, 30))
+    sqlite3_str_appendf(s, "%s.", genWord(&rng));
+  for (int i = 0; i < nSyllable; i++)
+    sqlite3_str_appendall(s, aSyllable[genRange(&rng, GEN_NSYLLABLE)]);
+  if (rank >= GEN_NSYLLABLE * GEN_NSYLLABLE)
+    sqlite3_str_appendf(s, "%d", rank % 1000);
+  sqlite3_str_appendf(s, ".%s", aTld[genRange(&rng, GEN_NTLD)]);
+}
+
+#define genPopularHost(s, pRng) genHost(s, genZipf(pRng, URL_GENERATE_HOSTS))
+
+// Appends a path of up to maxDepth segments, starting with '/'.
+static void genPath(sqlite3_str *s, uint64_t *pRng, int maxDepth,
+                    int withDots) {
+  int depth = 0;
+  // geometric depth, most paths are shallow
+  while (depth < maxDepth && genChance(pRng, 65))
+    depth++;
+  if (depth == 0) {
+    sqlite3_str_appendchar(s, 1, '/');
+    return;
+  }
+  for (int i = 0; i < depth; i++) {
+    int kind = genRange(pRng, 100);
+    sqlite3_str_appendchar(s, 1, '/');
+    if (withDots && kind < 4)
+      sqlite3_str_appendall(s, "..");
+    else if (withDots && kind < 8)
+      sqlite3_str_appendall(s, ".");
+    else if (kind < 25)
+      sqlite3_str_appendf(s, "%d", genRange(pRng, 1000000));
+    else if (kind < 32)
+      sqlite3_str_appendall(s, aUtf8Encoded[genRange(pRng, GEN_NUTF8)]);
+    else if (kind < 40)
+      sqlite3_str_appendf(s, "%s-%s-%d", genWord(pRng), genWord(pRng),
+                          genRange(pRng, 10000));
+    else
+      sqlite3_str_appendall(s, genWord(pRng));
+  }
+  if (genChance(pRng, 20))
+    sqlite3_str_appendall(s, genChance(pRng, 50) ? ".html" : "/");
+}
+
+// Appends a query value, with spaces, escapes and UTF-8 mixed in.
+static void genQueryValue(sqlite3_str *s, uint64_t *pRng) {
+  int kind = genRange(pRng, 100);
+  if (kind < 8)
+    return;
+  if (kind < 30)
+    sqlite3_str_appendf(s, "%d", genRange(pRng, 1000000));
+  else if (kind < 45)
+    sqlite3_str_appendf(s, "%s+%s", genWord(pRng), genWord(pRng));
+  else if (kind < 55)
+    sqlite3_str_appendf(s, "%s%%20%s%%26%s", genWord(pRng), genWord(pRng),
+                        genWord(pRng));
+  else if (kind < 62)
+    sqlite3_str_appendall(s, aUtf8Encoded[genRange(pRng, GEN_NUTF8)]);
+  else if (kind < 70)
+    sqlite3_str_appendf(s, "%016llx%08llx",
+                        (unsigned long long)genNext(pRng),
+                        (unsigned long long)(genNext(pRng) & 0xffffffff));
+  else if (kind < 75)
+    sqlite3_str_appendf(s, "https%%3A%%2F%%2F%s.com%%2F%s%%3Fx%%3D1",
+                        genWord(pRng), genWord(pRng));
+  else
+    sqlite3_str_appendall(s, genWord(pRng));
+}
+
+// Appends "?" and a query string of tracking and regular parameters.
+static void genQuery(sqlite3_str *s, uint64_t *pRng, int minParams,
+                     int maxParams) {
+  static const char *aUtm[] = {"utm_source", "utm_medium", "utm_campaign",
+                               "utm_term", "utm_content"};
+  static const char *aClickId[] = {"gclid", "fbclid", "msclkid", "dclid",
+                                   "yclid"};
+  int nParam = minParams + genRange(pRng, maxParams - minParams + 1);
+  int nUtm = genChance(pRng, 50) ? 3 + genRange(pRng, 3) : 0;
+  sqlite3_str_appendchar(s, 1, '?');
+  for (int i = 0; i < nParam + nUtm; i++) {
+    if (i > 0)
+      sqlite3_str_appendall(s, genChance(pRng, 2) ? "&&" : "&");
+    if (i < nUtm) {
+      sqlite3_str_appendf(s, "%s=", aUtm[i]);
+      genQueryValue(s, pRng);
+      continue;
+    }
+    int kind = genRange(pRng, 100);
+    if (kind < 10) {
+      // long click identifiers, base64-like
+      sqlite3_str_appendf(s, "%s=", aClickId[genRange(pRng, 5)]);
+      for (int j = 0; j < 3; j++)
+        sqlite3_str_appendf(s, "%016llx", (unsigned long long)genNext(pRng));
+      sqlite3_str_appendall(s, "_BwE");
+    } else if (kind < 15) {
+      // flags without a value
+      sqlite3_str_appendall(s, genWord(pRng));
+    } else if (kind < 20) {
+      // encoded names and array-style names
+      sqlite3_str_appendf(s, "%s%%5B%d%%5D=", genWord(pRng), i);
+      genQueryValue(s, pRng);
+    } else if (kind < 25) {
+      // repeated names
+      sqlite3_str_appendall(s, "tag=");
+      genQueryValue(s, pRng);
+    } else {
+      sqlite3_str_appendf(s, "%s=", genWord(pRng));
+      genQueryValue(s, pRng);
+    }
+  }
+}
+
+static void genShort(sqlite3_str *s, uint64_t *pRng) {
+  sqlite3_str_appendall(s, genChance(pRng, 85) ? "https://" : "http://");
+  genPopularHost(s, pRng);
+  genPath(s, pRng, 3, 0);
+  if (genChance(pRng, 15))
+    genQuery(s, pRng, 1, 2);
+}
+
+static void genLong(sqlite3_str *s, uint64_t *pRng) {
+  sqlite3_str_appendall(s, "https://");
+  genPopularHost(s, pRng);
+  genPath(s, pRng, 16, 1);
+  genQuery(s, pRng, 5, 25);
+  if (genChance(pRng, 40))
+    sqlite3_str_appendf(s, "#%s-%d", genWord(pRng), genRange(pRng, 100));
+}
+
+static void genQueryHeavy(sqlite3_str *s, uint64_t *pRng) {
+  sqlite3_str_appendall(s, "https://");
+  genPopularHost(s, pRng);
+  genPath(s, pRng, 2, 0);
+  genQuery(s, pRng, 10, 40);
+}
+
+static void genIdn(sqlite3_str *s, uint64_t *pRng) {
+  static const char *aIdnHost[] = {
+      "münchen.de",        "xn--mnchen-3ya.de",  "bücher.example",
+      "xn--bcher-kva.example", "例え.jp",            "xn--r8jz45g.jp",
+      "пример.рф",         "xn--e1afmkfd.xn--p1ai", "%E4%BE%8B%E3%81%88.jp",
+      "FAß.de",            "faß.DE",             "ﬁnance.example",
+      "straße.example",    "xn--strae-oqa.example"};
+  sqlite3_str_appendall(s, genChance(pRng, 70) ? "https://" : "http://");
+  sqlite3_str_appendall(s, aIdnHost[genRange(pRng, sizeof(aIdnHost) /
+                                                       sizeof(aIdnHost[0]))]);
+  if (genChance(pRng, 50))
+    sqlite3_str_appendf(s, "/%s/%s", aUtf8Raw[genRange(pRng, GEN_NUTF8)],
+                        aUtf8Encoded[genRange(pRng, GEN_NUTF8)]);
+  else
+    genPath(s, pRng, 4, 0);
+  if (genChance(pRng, 50))
+    sqlite3_str_appendf(s, "?q=%s", aUtf8Encoded[genRange(pRng, GEN_NUTF8)]);
+}
+
+static void genIpv6(sqlite3_str *s, uint64_t *pRng) {
+  int kind = genRange(pRng, 100);
+  sqlite3_str_appendall(s, genChance(pRng, 50) ? "https://[" : "http://[");
+  if (kind < 30) {
+    sqlite3_str_appendf(s, "2001:db8::%x", genRange(pRng, 0x10000));
+  } else if (kind < 50) {
+    // uncompressed and uppercase, normalized by the parser
+    sqlite3_str_appendf(s, "2001:0DB8:0000:0000:%04X:0000:0000:%04X",
+                        genRange(pRng, 0x10000), genRange(pRng, 0x10000));
+  } else if (kind < 75) {
+    // link-local with a zone ID
+    sqlite3_str_appendf(s, "fe80::%x:%x%%25%s%d", genRange(pRng, 0x10000),
+                        genRange(pRng, 0x10000),
+                        genChance(pRng, 50) ? "eth" : "en",
+                        genRange(pRng, 4));
+  } else if (kind < 90) {
+    sqlite3_str_appendf(s, "::ffff:%d.%d.%d.%d", genRange(pRng, 256),
+                        genRange(pRng, 256), genRange(pRng, 256),
+                        genRange(pRng, 256));
+  } else {
+    sqlite3_str_appendall(s, "::1");
+  }
+  sqlite3_str_appendchar(s, 1, ']');
+  if (genChance(pRng, 40))
+    sqlite3_str_appendf(s, ":%d", 1 + genRange(pRng, 65535));
+  genPath(s, pRng, 4, 0);
+  if (genChance(pRng, 30))
+    genQuery(s, pRng, 1, 4);
+}
+
+static void genIpv4(sqlite3_str *s, uint64_t *pRng) {
+  int kind = genRange(pRng, 100);
+  sqlite3_str_appendall(s, "http://");
+  if (kind < 60)
+    sqlite3_str_appendf(s, "%d.%d.%d.%d", genRange(pRng, 256),
+                        genRange(pRng, 256), genRange(pRng, 256),
+                        genRange(pRng, 256));
+  else if (kind < 75)
+    sqlite3_str_appendf(s, "%u", (unsigned)(genNext(pRng) & 0xffffffff));
+  else if (kind < 90)
+    sqlite3_str_appendf(s, "0x%x.%d", genRange(pRng, 256),
+                        genRange(pRng, 0x1000000));
+  else
+    sqlite3_str_appendf(s, "0%o.0%o.%d.%d", genRange(pRng, 256),
+                        genRange(pRng, 256), genRange(pRng, 256),
+                        genRange(pRng, 256));
+  if (genChance(pRng, 50))
+    sqlite3_str_appendf(s, ":%d", 1 + genRange(pRng, 65535));
+  genPath(s, pRng, 3, 0);
+}
+
+static void genAuth(sqlite3_str *s, uint64_t *pRng) {
+  static const char *aScheme[] = {"ftp", "imap", "pop3", "smtp", "https",
+                                   "sftp", "ldap"};
+  const char *zScheme = aScheme[genRange(pRng, 7)];
+  sqlite3_str_appendf(s, "%s://%s", zScheme, genWord(pRng));
+  if (genChance(pRng, 70))
+    sqlite3_str_appendf(s, ":%s%%40%d", genWord(pRng), genRange(pRng, 1000));
+  if (genChance(pRng, 30))
+    sqlite3_str_appendf(s, ";AUTH=%s", genChance(pRng, 50) ? "*" : "PLAIN");
+  sqlite3_str_appendchar(s, 1, '@');
+  genPopularHost(s, pRng);
+  if (genChance(pRng, 60))
+    sqlite3_str_appendf(s, ":%s%d", genChance(pRng, 10) ? "00" : "",
+                        1 + genRange(pRng, 65535));
+  genPath(s, pRng, 3, 0);
+}
+
+static void genMalformed(sqlite3_str *s, uint64_t *pRng) {
+  static const char *aMalformed[] = {
+      "http//missing-colon.example.com/",
+      "https://exa mple.com/",
+      "http://example.com:99999/",
+      "http://example.com:8o/",
+      "http://[::1/",
+      "http://[fe80::1%25]/",
+      "://no-scheme.example/",
+      "",
+      "   ",
+      "http://",
+      "javascript:alert(1)",
+      "mailto:someone@example.com",
+      "http://%zz.example/",
+      "ht!tp://bad-scheme.example/",
+      "http://exa<mple>.com/",
+      "http://a.com/\x01\x02",
+      "file:///etc/passwd",
+      "file://c:/windows/",
+      "//protocol-relative.example/path",
+      "/relative/path?x=1",
+      "?only=query",
+      "#only-fragment",
+      "http://user@:80/",
+      "http://1.2.3.4.5/",
+      "HTTP://UPPER.EXAMPLE/PATH",
+      "http://example.com/a/b/../../../..",
+      "http://example.com/%",
+      "http://example.com?%%%",
+  };
+  int n = sizeof(aMalformed) / sizeof(aMalformed[0]);
+  if (genChance(pRng, 10)) {
+    // random bytes, including controls and broken UTF-8
+    int nByte = 1 + genRange(pRng, 64);
+    for (int i = 0; i < nByte; i++)
+      sqlite3_str_appendchar(s, 1, (char)(1 + genRange(pRng, 255)));
+    return;
+  }
+  sqlite3_str_appendall(s, aMalformed[genRange(pRng, n)]);
+}
+
+typedef struct url_generate_profile url_generate_profile;
+struct url_generate_profile {
+  const char *zName;
+  void (*xGenerate)(sqlite3_str *, uint64_t *);
+  // share of "mixed" rows, in percent
+  int mixedWeight;
+};
+
+static const url_generate_profile aProfile[] = {
+    {"short", genShort, 40},   {"long", genLong, 10},
+    {"query", genQueryHeavy, 25}, {"idn", genIdn, 7},
+    {"ipv6", genIpv6, 4},      {"ipv4", genIpv4, 4},
+    {"auth", genAuth, 3},      {"malformed", genMalformed, 7},
+};
+#define GEN_NPROFILE (int)(sizeof(aProfile) / sizeof(aProfile[0]))
+
+// index of the "mixed" profile, which isn't in aProfile
+#define GEN_PROFILE_MIXED -1
+
+#pragma endregion
+
+#pragma region url_generate
+
+#define URL_GENERATE_COLUMN_URL 0
+#define URL_GENERATE_COLUMN_PROFILE 1
+#define URL_GENERATE_COLUMN_N 2
+#define URL_GENERATE_COLUMN_SEED 3
+#define URL_GENERATE_COLUMN_ARGPROFILE 4
+
+typedef struct url_generate_cursor url_generate_cursor;
+struct url_generate_cursor {
+  sqlite3_vtab_cursor base;
+  sqlite3_int64 iRowid;
+  sqlite3_int64 n;
+  sqlite3_int64 seed;
+  // index in aProfile, or GEN_PROFILE_MIXED
+  int iProfile;
+  // profile that generated the current row
+  int iRowProfile;
+  // the current row's URL, reset for every row
+  sqlite3_str *pUrl;
+};
+
+static int urlGenerateConnect(sqlite3 *db, void *pUnused, int argcUnused,
+                              const char *const *argvUnused,
+                              sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  sqlite3_vtab *pNew;
+  int rc;
+  (void)pUnused;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(url text, profile text, "
+                                "n hidden, seed hidden, "
+                                "argprofile hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = *ppVtab = sqlite3_malloc(sizeof(*pNew));
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlGenerateDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlGenerateOpen(sqlite3_vtab *pUnused,
+                           sqlite3_vtab_cursor **ppCursor) {
+  url_generate_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  pCur->pUrl = sqlite3_str_new(0);
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlGenerateClose(sqlite3_vtab_cursor *cur) {
+  url_generate_cursor *pCur = (url_generate_cursor *)cur;
+  sqlite3_free(sqlite3_str_finish(pCur->pUrl));
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+// Generates the URL of the current row.
+static int urlGenerateRow(url_generate_cursor *pCur) {
+  // every row has its own stream, so rows don't depend on each other
+  uint64_t rng = (uint64_t)pCur->seed * 0x9e3779b97f4a7c15ull ^
+                 (uint64_t)pCur->iRowid * 0xd1b54a32d192ed03ull;
+  genNext(&rng);
+  int iProfile = pCur->iProfile;
+  if (iProfile == GEN_PROFILE_MIXED) {
+    int weight = genRange(&rng, 100);
+    for (iProfile = 0; iProfile < GEN_NPROFILE - 1; iProfile++) {
+      weight -= aProfile[iProfile].mixedWeight;
+      if (weight < 0)
+        break;
+    }
+  }
+  pCur->iRowProfile = iProfile;
+  sqlite3_str_reset(pCur->pUrl);
+  aProfile[iProfile].xGenerate(pCur->pUrl, &rng);
+  return sqlite3_str_errcode(pCur->pUrl);
+}
+
+static int urlGenerateNext(sqlite3_vtab_cursor *cur) {
+  url_generate_cursor *pCur = (url_generate_cursor *)cur;
+  pCur->iRowid++;
+  if (pCur->iRowid >= pCur->n)
+    return SQLITE_OK;
+  return urlGenerateRow(pCur);
+}
+
+static int urlGenerateEof(sqlite3_vtab_cursor *cur) {
+  url_generate_cursor *pCur = (url_generate_cursor *)cur;
+  return pCur->iRowid >= pCur->n;
+}
+
+static int urlGenerateColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                             int i) {
+  url_generate_cursor *pCur = (url_generate_cursor *)cur;
+  switch (i) {
+  case URL_GENERATE_COLUMN_URL:
+    sqlite3_result_text(ctx, sqlite3_str_value(pCur->pUrl),
+                        sqlite3_str_length(pCur->pUrl), SQLITE_TRANSIENT);
+    break;
+  case URL_GENERATE_COLUMN_PROFILE:
+    sqlite3_result_text(ctx, aProfile[pCur->iRowProfile].zName, -1,
+                        SQLITE_STATIC);
+    break;
+  case URL_GENERATE_COLUMN_N:
+    sqlite3_result_int64(ctx, pCur->n);
+    break;
+  case URL_GENERATE_COLUMN_SEED:
+    sqlite3_result_int64(ctx, pCur->seed);
+    break;
+  case URL_GENERATE_COLUMN_ARGPROFILE:
+    sqlite3_result_text(ctx,
+                        pCur->iProfile == GEN_PROFILE_MIXED
+                            ? "mixed"
+                            : aProfile[pCur->iProfile].zName,
+                        -1, SQLITE_STATIC);
+    break;
+  }
+  return SQLITE_OK;
+}
+
+static int urlGenerateRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  url_generate_cursor *pCur = (url_generate_cursor *)cur;
+  *pRowid = pCur->iRowid;
+  return SQLITE_OK;
+}
+
+// idxNum is a bitmask of the hidden columns given as arguments, which are
+// passed to urlGenerateFilter() in column order.
+static int urlGenerateBestIndex(sqlite3_vtab *pVTab,
+                                sqlite3_index_info *pIdxInfo) {
+  int aIdx[3] = {-1, -1, -1};
+  int unusableMask = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    int iArg = pCons->iColumn - URL_GENERATE_COLUMN_N;
+    if (iArg < 0 || pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+      continue;
+    if (!pCons->usable)
+      unusableMask |= 1 << iArg;
+    else if (aIdx[iArg] < 0)
+      aIdx[iArg] = i;
+  }
+  if (aIdx[0] < 0) {
+    if (unusableMask & 1)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("n argument is required");
+    return SQLITE_ERROR;
+  }
+  int nArg = 0;
+  pIdxInfo->idxNum = 0;
+  for (int iArg = 0; iArg < 3; iArg++) {
+    if (aIdx[iArg] < 0) {
+      if (unusableMask & (1 << iArg))
+        return SQLITE_CONSTRAINT;
+      continue;
+    }
+    pIdxInfo->aConstraintUsage[aIdx[iArg]].argvIndex = ++nArg;
+    pIdxInfo->aConstraintUsage[aIdx[iArg]].omit = 1;
+    pIdxInfo->idxNum |= 1 << iArg;
+  }
+  pIdxInfo->estimatedCost = 100000.0;
+  pIdxInfo->estimatedRows = 100000;
+  return SQLITE_OK;
+}
+
+static int urlGenerateFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                             const char *idxStr, int argc,
+                             sqlite3_value **argv) {
+  url_generate_cursor *pCur = (url_generate_cursor *)pVtabCursor;
+  int iArg = 0;
+  if (!pCur->pUrl)
+    return SQLITE_NOMEM;
+  pCur->n = sqlite3_value_int64(argv[iArg++]);
+  pCur->seed = (idxNum & 2) ? sqlite3_value_int64(argv[iArg++]) : 0;
+  pCur->iProfile = GEN_PROFILE_MIXED;
+  if (idxNum & 4) {
+    const char *zProfile = (const char *)sqlite3_value_text(argv[iArg++]);
+    if (zProfile && sqlite3_stricmp(zProfile, "mixed") != 0) {
+      for (pCur->iProfile = 0; pCur->iProfile < GEN_NPROFILE;
+           pCur->iProfile++) {
+        if (sqlite3_stricmp(zProfile, aProfile[pCur->iProfile].zName) == 0)
+          break;
+      }
+      if (pCur->iProfile == GEN_NPROFILE) {
+        sqlite3_free(pVtabCursor->pVtab->zErrMsg);
+        pVtabCursor->pVtab->zErrMsg =
+            sqlite3_mprintf("unknown url_generate profile '%s'", zProfile);
+        return SQLITE_ERROR;
+      }
+    }
+  }
+  pCur->iRowid = 0;
+  if (pCur->n <= 0)
+    return SQLITE_OK;
+  return urlGenerateRow(pCur);
+}
+
+static sqlite3_module urlGenerateModule = {
+    0,                     /* iVersion */
+    0,                     /* xCreate */
+    urlGenerateConnect,    /* xConnect */
+    urlGenerateBestIndex,  /* xBestIndex */
+    urlGenerateDisconnect, /* xDisconnect */
+    0,                     /* xDestroy */
+    urlGenerateOpen,       /* xOpen - open a cursor */
+    urlGenerateClose,      /* xClose - close a cursor */
+    urlGenerateFilter,     /* xFilter - configure scan constraints */
+    urlGenerateNext,       /* xNext - advance a cursor */
+    urlGenerateEof,        /* xEof - check for end of scan */
+    urlGenerateColumn,     /* xColumn - read data */
+    urlGenerateRowid,      /* xRowid - read data */
+    0,                     /* xUpdate */
+    0,                     /* xBegin */
+    0,                     /* xSync */
+    0,                     /* xCommit */
+    0,                     /* xRollback */
+    0,                     /* xFindMethod */
+    0,                     /* xRename */
+    0,                     /* xSavepoint */
+    0,                     /* xRelease */
+    0,                     /* xRollbackTo */
+    0                      /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region entrypoints
+#ifdef _WIN32
+__declspec(dllexport)
+#endif
+    int sqlite3_urlgenerate_init(sqlite3 *db, char **pzErrMsg,
+                                 const sqlite3_api_routines *pApi) {
+  SQLITE_EXTENSION_INIT2(pApi);
+  (void)pzErrMsg; /* Unused parameter */
+  return sqlite3_create_module(db, "url_generate", &urlGenerateModule, 0);
+}
+#pragma endregion
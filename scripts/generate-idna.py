@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+Compiles the Unicode IDNA Mapping Table (UTS #46) into sqlite-url-idna.h, the
+tables that url_host_ascii() and url_host_unicode() are built on.
+
+Usage: python3 scripts/generate-idna.py [IdnaMappingTable.txt] > sqlite-url-idna.h
+
+The mapping table is a sorted array of code point ranges that share a status,
+binary searched by sqlite-url.c, with the mappings in a pool of code points.
+Statuses are resolved the way URLs use UTS #46: nontransitional, so
+deviations are valid, and without STD3 rules, so disallowed_STD3_* entries
+are valid or mapped.
+
+Mapping is followed by NFC normalization, whose data (canonical combining
+classes, full canonical decompositions and primary compositions) comes from
+Python's unicodedata. Run this with a Python whose unicodedata is the same
+Unicode version as the mapping table, the header records both.
+"""
+import sys
+import unicodedata
+
+DEFAULT_PATH = "dist/IdnaMappingTable.txt"
+
+# keep in sync with the URL_IDNA_* defines written below
+VALID = 0
+MAPPED = 1
+IGNORED = 2
+DISALLOWED = 3
+MARK = 4
+
+STATUSES = {
+  "valid": VALID,
+  "deviation": VALID,
+  "disallowed_STD3_valid": VALID,
+  "mapped": MAPPED,
+  "disallowed_STD3_mapped": MAPPED,
+  "ignored": IGNORED,
+  "disallowed": DISALLOWED,
+}
+
+MAX_CODE_POINT = 0x10FFFF
+LEN_BITS = 6
+
+# Hangul syllables are decomposed and composed algorithmically
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def read_table(path):
+  version = None
+  # the first lines of the file name it, and date the official tables or
+  # say where a copy came from
+  source = []
+  status = [DISALLOWED] * (MAX_CODE_POINT + 1)
+  mapping = [None] * (MAX_CODE_POINT + 1)
+  with open(path, encoding="utf-8") as f:
+    for line in f:
+      if version is None and line.startswith("# IdnaMappingTable-"):
+        version = line.split("-", 1)[1].rsplit(".txt", 1)[0]
+      if len(source) < 2 and line.startswith("# "):
+        source.append(line[2:].strip())
+      fields = [x.strip() for x in line.split("#", 1)[0].split(";")]
+      if len(fields) < 2:
+        continue
+      first, _, last = fields[0].partition("..")
+      first = int(first, 16)
+      last = int(last, 16) if last else first
+      s = STATUSES[fields[1]]
+      m = None
+      if s == MAPPED:
+        m = tuple(int(x, 16) for x in fields[2].split())
+      for cp in range(first, last + 1):
+        status[cp] = s
+        mapping[cp] = m
+  return version, source, status, mapping
+
+
+class Pool:
+  def __init__(self):
+    self.data = []
+    self.offsets = {}
+
+  def add(self, cps):
+    assert 0 < len(cps) < (1 << LEN_BITS)
+    if cps not in self.offsets:
+      self.offsets[cps] = len(self.data)
+      self.data.extend(cps)
+    return (self.offsets[cps] << LEN_BITS) | len(cps)
+
+
+def build_ranges(status, mapping, pool):
+  ranges = []
+  prev = None
+  for cp in range(MAX_CODE_POINT + 1):
+    flags = status[cp]
+    if unicodedata.category(chr(cp)).startswith("M"):
+      flags |= MARK
+    key = (flags, mapping[cp])
+    if key != prev:
+      ranges.append((cp, flags, pool.add(mapping[cp]) if mapping[cp] else 0))
+      prev = key
+  return ranges
+
+
+def build_classes():
+  classes = []
+  prev = None
+  for cp in range(MAX_CODE_POINT + 1):
+    ccc = unicodedata.combining(chr(cp))
+    if ccc != prev:
+      classes.append((cp, ccc))
+      prev = ccc
+  return classes
+
+
+def build_normalization(pool):
+  decompositions = []
+  compositions = []
+  for cp in range(MAX_CODE_POINT + 1):
+    if HANGUL_FIRST <= cp <= HANGUL_LAST:
+      continue
+    c = chr(cp)
+    nfd = unicodedata.normalize("NFD", c)
+    if nfd != c:
+      decompositions.append((cp, pool.add(tuple(ord(x) for x in nfd))))
+    d = unicodedata.decomposition(c)
+    if d and not d.startswith("<"):
+      parts = [int(x, 16) for x in d.split()]
+      # primary composites are the pairs NFC composes back
+      if len(parts) == 2 and unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) == c:
+        compositions.append((parts[0], parts[1], cp))
+  compositions.sort()
+  return decompositions, compositions
+
+
+def write_array(out, decl, rows, per_line):
+  out.write(f"{decl} = {{\n")
+  for i in range(0, len(rows), per_line):
+    out.write("    " + ",".join(rows[i:i + per_line]) + ",\n")
+  out.write("};\n\n")
+
+
+def main():
+  path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_PATH
+  version, source, status, mapping = read_table(path)
+  pool = Pool()
+  ranges = build_ranges(status, mapping, pool)
+  classes = build_classes()
+  decompositions, compositions = build_normalization(pool)
+
+  out = sys.stdout
+  out.write("// Generated by scripts/generate-idna.py, do not edit. Mapping table from\n")
+  for line in source:
+    out.write(f"//   {line}\n")
+  out.write(f"// IDNA {version}, normalization data from Unicode {unicodedata.unidata_version}.\n\n")
+  out.write("#define URL_IDNA_VALID 0\n")
+  out.write("#define URL_IDNA_MAPPED 1\n")
+  out.write("#define URL_IDNA_IGNORED 2\n")
+  out.write("#define URL_IDNA_DISALLOWED 3\n")
+  out.write("#define URL_IDNA_MARK 4\n")
+  out.write(f"#define URL_IDNA_LEN_BITS {LEN_BITS}\n\n")
+
+  out.write("// first code point << 3 | URL_IDNA_MARK | status of each range\n")
+  write_array(out, f"static const unsigned int urlIdnaRanges[{len(ranges)}]",
+              [str(cp << 3 | flags) for cp, flags, _ in ranges], 8)
+  out.write("// the mapping of each mapped range in urlIdnaPool, as\n")
+  out.write("// offset << URL_IDNA_LEN_BITS | length\n")
+  write_array(out, f"static const unsigned int urlIdnaMappings[{len(ranges)}]",
+              [str(m) for _, _, m in ranges], 8)
+  out.write("// first code point << 8 | canonical combining class of each range\n")
+  write_array(out, f"static const unsigned int urlIdnaClasses[{len(classes)}]",
+              [str(cp << 8 | ccc) for cp, ccc in classes], 8)
+  out.write("// code points with a canonical decomposition and their full\n")
+  out.write("// decomposition in urlIdnaPool, as offset << URL_IDNA_LEN_BITS | length\n")
+  write_array(out, f"static const unsigned int urlIdnaDecompositions[{len(decompositions)}][2]",
+              [f"{{{cp},{d}}}" for cp, d in decompositions], 6)
+  out.write("// first, second and composite code points of the primary composites\n")
+  write_array(out, f"static const unsigned int urlIdnaCompositions[{len(compositions)}][3]",
+              [f"{{{a},{b},{c}}}" for a, b, c in compositions], 4)
+  write_array(out, f"static const unsigned int urlIdnaPool[{len(pool.data)}]",
+              [str(cp) for cp in pool.data], 10)
+
+
+if __name__ == "__main__":
+  main()
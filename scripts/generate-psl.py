@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Compiles the Public Suffix List into sqlite-url-psl.h, the lookup table that
+url_domain(), url_public_suffix() and url_host_labels() are built on.
+
+Usage: python3 scripts/generate-psl.py [public_suffix_list.dat] > sqlite-url-psl.h
+
+The table is an open addressing hash table of every rule, and of every
+suffix of a rule so lookups can stop at the first unknown suffix. Suffixes
+are hashed from their last byte to their first, so sqlite-url.c can extend
+the hash one label at a time while it walks a host from the right. Each
+slot packs the rule's flags, length and offset into a pool of
+NUL-terminated strings, where suffixes share the bytes of the longer
+strings they end.
+
+Rules with non-ASCII labels are also added in their punycode form, since
+hosts can be in either.
+"""
+import sys
+
+DEFAULT_PATH = "/usr/share/publicsuffix/public_suffix_list.dat"
+
+# keep in sync with the URL_PSL_* defines written below
+FLAG_PRESENT = 1
+FLAG_RULE = 2
+FLAG_WILDCARD = 4
+FLAG_EXCEPTION = 8
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+LEN_BITS = 8
+OFFSET_BITS = 20
+
+
+def psl_hash(s):
+  h = FNV_OFFSET
+  for c in reversed(s.encode("utf-8")):
+    h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+  return h
+
+
+def to_ascii(rule):
+  labels = []
+  for label in rule.split("."):
+    if label.isascii():
+      labels.append(label)
+    else:
+      labels.append("xn--" + label.encode("punycode").decode("ascii"))
+  return ".".join(labels)
+
+
+def read_rules(path):
+  rules = []
+  with open(path, encoding="utf-8") as f:
+    for line in f:
+      # a rule is the first word of its line
+      words = line.split()
+      if not words or words[0].startswith("//"):
+        continue
+      rules.append(words[0].lower())
+  return rules
+
+
+def build_entries(rules):
+  entries = {}
+
+  def add(s, flag):
+    labels = s.split(".")
+    for i in range(len(labels)):
+      suffix = ".".join(labels[i:])
+      entries[suffix] = entries.get(suffix, 0) | FLAG_PRESENT
+    entries[s] |= flag
+
+  for rule in rules:
+    for s in {rule, to_ascii(rule)}:
+      if s.startswith("!"):
+        add(s[1:], FLAG_EXCEPTION)
+      elif s.startswith("*."):
+        add(s[2:], FLAG_WILDCARD)
+      else:
+        add(s, FLAG_RULE)
+  return entries
+
+
+def build_pool(entries):
+  # strings that no other entry ends with are written out, every other
+  # entry points into the tail of one of them
+  parents = set()
+  for s in entries:
+    if "." in s:
+      parents.add(s.split(".", 1)[1])
+  pool = bytearray()
+  offsets = {}
+  for s in sorted(entries):
+    if s in parents:
+      continue
+    start = len(pool)
+    data = s.encode("utf-8")
+    pool += data + b"\0"
+    i = 0
+    while True:
+      suffix = data[i:].decode("utf-8")
+      offsets.setdefault(suffix, start + i)
+      j = data.find(b".", i)
+      if j < 0:
+        break
+      i = j + 1
+  return pool, offsets
+
+
+def build_table(entries, offsets):
+  bits = 1
+  while (1 << bits) < len(entries) * 3:
+    bits += 1
+  mask = (1 << bits) - 1
+  slots = [0] * (1 << bits)
+  for s, flags in sorted(entries.items()):
+    n = len(s.encode("utf-8"))
+    offset = offsets[s]
+    assert n < (1 << LEN_BITS) and offset < (1 << OFFSET_BITS)
+    i = psl_hash(s) & mask
+    while slots[i]:
+      i = (i + 1) & mask
+    slots[i] = (offset << (4 + LEN_BITS)) | (n << 4) | flags
+  return bits, slots
+
+
+def main():
+  path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_PATH
+  rules = read_rules(path)
+  entries = build_entries(rules)
+  pool, offsets = build_pool(entries)
+  bits, slots = build_table(entries, offsets)
+
+  out = sys.stdout
+  out.write("// Generated by scripts/generate-psl.py from the Public Suffix List,\n")
+  out.write("// https://publicsuffix.org/list/public_suffix_list.dat. Do not edit.\n")
+  out.write(f"// {len(rules)} rules, {len(entries)} suffixes.\n\n")
+  out.write("#define URL_PSL_PRESENT 1\n")
+  out.write("#define URL_PSL_RULE 2\n")
+  out.write("#define URL_PSL_WILDCARD 4\n")
+  out.write("#define URL_PSL_EXCEPTION 8\n")
+  out.write(f"#define URL_PSL_LEN_BITS {LEN_BITS}\n")
+  out.write(f"#define URL_PSL_HASH_BITS {bits}\n")
+  out.write(f"#define URL_PSL_FNV_OFFSET {FNV_OFFSET}u\n")
+  out.write(f"#define URL_PSL_FNV_PRIME {FNV_PRIME}u\n\n")
+
+  # a byte array rather than a string literal, which MSVC caps at 64KB
+  out.write(f"static const unsigned char urlPslPool[{len(pool)}] = {{\n")
+  for i in range(0, len(pool), 16):
+    out.write("    " + ",".join(str(b) for b in pool[i:i + 16]) + ",\n")
+  out.write("};\n\n")
+
+  out.write(f"static const unsigned int urlPslSlots[{len(slots)}] = {{\n")
+  for i in range(0, len(slots), 8):
+    out.write("    " + ",".join(str(s) for s in slots[i:i + 8]) + ",\n")
+  out.write("};\n")
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,3536 @@
+// Generated by scripts/generate-idna.py, do not edit. Mapping table from
+//   IdnaMappingTable-15.1.0.txt
+//   Reconstructed from idna.uts46data for offline use
+// IDNA 15.1.0, normalization data from Unicode 15.1.0.
+
+#define URL_IDNA_VALID 0
+#define URL_IDNA_MAPPED 1
+#define URL_IDNA_IGNORED 2
+#define URL_IDNA_DISALLOWED 3
+#define URL_IDNA_MARK 4
+#define URL_IDNA_LEN_BITS 6
+
+// first code point << 3 | URL_IDNA_MARK | status of each range
+static const unsigned int urlIdnaRanges[8351] = {
+    0,521,529,537,545,553,561,569,
+    577,585,593,601,609,617,625,633,
+    641,649,657,665,673,681,689,697,
+    705,713,721,728,1027,1281,1288,1345,
+    1352,1361,1368,1386,1392,1401,1408,1425,
+    1433,1441,1449,1456,1473,1481,1489,1496,
+    1505,1513,1521,1528,1537,1545,1553,1561,
+    1569,1577,1585,1593,1601,1609,1617,1625,
+    1633,1641,1649,1657,1665,1673,1681,1689,
+    1697,1705,1713,1720,1729,1737,1745,1753,
+    1761,1769,1777,1784,2049,2056,2065,2072,
+    2081,2088,2097,2104,2113,2120,2129,2136,
+    2145,2152,2161,2168,2177,2184,2193,2200,
+    2209,2216,2225,2232,2241,2248,2257,2264,
+    2273,2280,2289,2296,2305,2312,2321,2328,
+    2337,2344,2353,2360,2369,2376,2385,2392,
+    2401,2408,2417,2424,2433,2440,2449,2465,
+    2472,2481,2488,2505,2512,2521,2528,2537,
+    2544,2553,2569,2576,2585,2592,2601,2608,
+    2617,2624,2633,2641,2648,2657,2664,2673,
+    2680,2689,2696,2705,2712,2721,2728,2737,
+    2744,2753,2760,2769,2776,2785,2792,2801,
+    2808,2817,2824,2833,2840,2849,2856,2865,
+    2872,2881,2888,2897,2904,2913,2920,2929,
+    2936,2945,2952,2961,2968,2977,2984,2993,
+    3000,3009,3017,3024,3033,3040,3049,3056,
+    3065,3072,3081,3089,3096,3105,3112,3121,
+    3129,3136,3145,3153,3161,3168,3185,3193,
+    3201,3209,3216,3225,3233,3240,3249,3257,
+    3265,3272,3297,3305,3312,3321,3329,3336,
+    3345,3352,3361,3368,3377,3385,3392,3401,
+    3408,3425,3432,3441,3449,3456,3465,3473,
+    3481,3488,3497,3504,3513,3521,3528,3553,
+    3560,3617,3641,3665,3689,3696,3705,3712,
+    3721,3728,3737,3744,3753,3760,3769,3776,
+    3785,3792,3801,3808,3825,3832,3841,3848,
+    3857,3864,3873,3880,3889,3896,3905,3912,
+    3921,3928,3937,3944,3953,3960,3977,4001,
+    4008,4017,4025,4033,4040,4049,4056,4065,
+    4072,4081,4088,4097,4104,4113,4120,4129,
+    4136,4145,4152,4161,4168,4177,4184,4193,
+    4200,4209,4216,4225,4232,4241,4248,4257,
+    4264,4273,4280,4289,4296,4305,4312,4321,
+    4328,4337,4344,4353,4360,4369,4376,4385,
+    4392,4401,4408,4417,4424,4433,4440,4449,
+    4456,4465,4472,4481,4488,4497,4504,4561,
+    4569,4576,4585,4593,4600,4617,4624,4633,
+    4641,4649,4657,4664,4673,4680,4689,4696,
+    4705,4712,4721,4728,5505,5513,5521,5529,
+    5537,5545,5553,5561,5569,5576,5825,5833,
+    5841,5849,5857,5865,5872,5889,5897,5905,
+    5913,5921,5928,6148,6661,6669,6676,6685,
+    6693,6701,6708,6782,6788,7041,7048,7057,
+    7064,7073,7080,7089,7096,7107,7121,7128,
+    7153,7161,7171,7201,7209,7217,7225,7233,
+    7241,7249,7259,7265,7275,7281,7289,7296,
+    7305,7313,7321,7329,7337,7345,7353,7361,
+    7369,7377,7385,7393,7401,7409,7417,7425,
+    7433,7443,7449,7457,7465,7473,7481,7489,
+    7497,7505,7513,7520,7801,7809,7817,7825,
+    7833,7841,7849,7857,7864,7873,7880,7889,
+    7896,7905,7912,7921,7928,7937,7944,7953,
+    7960,7969,7976,7985,7992,8001,8008,8017,
+    8024,8033,8040,8049,8056,8065,8073,8081,
+    8088,8097,8105,8112,8121,8128,8137,8145,
+    8152,8169,8177,8185,8193,8201,8209,8217,
+    8225,8233,8241,8249,8257,8265,8273,8281,
+    8289,8297,8305,8313,8321,8329,8337,8345,
+    8353,8361,8369,8377,8385,8393,8401,8409,
+    8417,8425,8433,8441,8449,8457,8465,8473,
+    8481,8489,8497,8505,8513,8521,8529,8537,
+    8545,8553,8561,8569,8576,8961,8968,8977,
+    8984,8993,9000,9009,9016,9025,9032,9041,
+    9048,9057,9064,9073,9080,9089,9096,9105,
+    9112,9121,9128,9137,9144,9153,9160,9169,
+    9176,9185,9192,9201,9208,9217,9224,9244,
+    9297,9304,9313,9320,9329,9336,9345,9352,
+    9361,9368,9377,9384,9393,9400,9409,9416,
+    9425,9432,9441,9448,9457,9464,9473,9480,
+    9489,9496,9505,9512,9521,9528,9537,9544,
+    9553,9560,9569,9576,9585,9592,9601,9608,
+    9617,9624,9633,9640,9649,9656,9665,9672,
+    9681,9688,9697,9704,9713,9720,9731,9737,
+    9744,9753,9760,9769,9776,9785,9792,9801,
+    9808,9817,9824,9833,9840,9857,9864,9873,
+    9880,9889,9896,9905,9912,9921,9928,9937,
+    9944,9953,9960,9969,9976,9985,9992,10001,
+    10008,10017,10024,10033,10040,10049,10056,10065,
+    10072,10081,10088,10097,10104,10113,10120,10129,
+    10136,10145,10152,10161,10168,10177,10184,10193,
+    10200,10209,10216,10225,10232,10241,10248,10257,
+    10264,10273,10280,10289,10296,10305,10312,10321,
+    10328,10337,10344,10353,10360,10369,10376,10385,
+    10392,10401,10408,10417,10424,10433,10440,10449,
+    10456,10465,10472,10481,10488,10497,10504,10513,
+    10520,10529,10536,10545,10552,10561,10568,10577,
+    10584,10593,10600,10609,10616,10627,10633,10641,
+    10649,10657,10665,10673,10681,10689,10697,10705,
+    10713,10721,10729,10737,10745,10753,10761,10769,
+    10777,10785,10793,10801,10809,10817,10825,10833,
+    10841,10849,10857,10865,10873,10881,10889,10897,
+    10905,10913,10921,10929,10939,10952,11321,11328,
+    11355,11368,11395,11404,11760,11772,11776,11788,
+    11800,11812,11824,11836,11843,11904,12123,12152,
+    12203,12336,12420,12504,12515,12520,12892,13056,
+    13188,13192,13225,13233,13241,13249,13256,14004,
+    14059,14064,14076,14120,14140,14152,14164,14192,
+    14451,14464,14476,14480,14724,14939,14952,15668,
+    15752,15763,15872,16220,16288,16347,16364,16368,
+    16564,16592,16604,16672,16684,16704,16716,16755,
+    16768,16891,16896,17100,17123,17136,17147,17152,
+    17243,17280,17531,17604,17664,18004,18195,18204,
+    18464,18900,18920,18932,19072,19084,19137,19145,
+    19153,19161,19169,19177,19185,19193,19200,19220,
+    19232,19468,19491,19496,19563,19576,19595,19608,
+    19787,19792,19851,19856,19867,19888,19923,19940,
+    19944,19956,20011,20028,20043,20060,20080,20091,
+    20156,20163,20193,20201,20211,20217,20224,20244,
+    20259,20272,20468,20475,20492,20515,20520,20571,
+    20600,20619,20632,20811,20816,20875,20880,20889,
+    20899,20904,20913,20923,20928,20947,20964,20971,
+    20980,21019,21052,21067,21084,21107,21132,21139,
+    21193,21201,21209,21216,21227,21233,21243,21296,
+    21380,21392,21420,21424,21435,21516,21539,21544,
+    21619,21624,21651,21656,21835,21840,21899,21904,
+    21923,21928,21971,21988,21992,22004,22067,22076,
+    22099,22108,22131,22144,22155,22272,22292,22307,
+    22320,22419,22472,22484,22531,22540,22563,22568,
+    22635,22648,22667,22680,22859,22864,22923,22928,
+    22947,22952,22995,23012,23016,23028,23083,23100,
+    23115,23132,23155,23212,23235,23265,23273,23283,
+    23288,23316,23331,23344,23491,23572,23576,23587,
+    23592,23643,23664,23691,23696,23731,23752,23771,
+    23776,23787,23792,23811,23832,23851,23872,23899,
+    23920,24019,24052,24091,24116,24139,24148,24179,
+    24192,24203,24252,24259,24368,24539,24580,24616,
+    24683,24688,24715,24720,24907,24912,25043,25060,
+    25064,25076,25131,25140,25163,25172,25203,25260,
+    25275,25280,25307,25320,25331,25344,25364,25379,
+    25392,25475,25528,25612,25632,25707,25712,25739,
+    25744,25931,25936,26019,26024,26067,26084,26088,
+    26100,26155,26164,26187,26196,26227,26284,26299,
+    26344,26363,26368,26388,26403,26416,26499,26504,
+    26524,26531,26628,26656,26731,26736,26763,26768,
+    27100,27112,27124,27179,27188,27211,27220,27248,
+    27267,27296,27324,27328,27412,27427,27440,27651,
+    27660,27683,27688,27835,27856,28051,28056,28131,
+    28136,28147,28160,28219,28244,28251,28284,28331,
+    28340,28347,28356,28419,28464,28547,28564,28576,
+    28587,28680,29068,29072,29081,29092,29147,29176,
+    29244,29304,29411,29704,29723,29728,29739,29744,
+    29787,29792,29987,29992,30003,30008,30092,30096,
+    30105,30116,30184,30195,30208,30251,30256,30267,
+    30276,30331,30336,30419,30433,30441,30448,30467,
+    30720,30817,30824,30916,30928,31148,31152,31164,
+    31168,31180,31184,31220,31232,31257,31264,31299,
+    31304,31337,31344,31377,31384,31417,31424,31457,
+    31464,31561,31568,31595,31628,31645,31652,31661,
+    31669,31677,31685,31693,31700,31757,31764,31784,
+    31796,31808,31852,31901,31908,31939,31948,31981,
+    31988,32021,32028,32061,32068,32101,32108,32205,
+    32212,32235,32240,32308,32312,32363,32368,32475,
+    32768,33116,33272,33460,33488,33524,33544,33556,
+    33576,33596,33648,33676,33704,33812,33904,33916,
+    33920,34004,34032,34051,34361,34371,34409,34419,
+    34432,34785,34792,35579,35592,37451,37456,37491,
+    37504,37563,37568,37579,37584,37619,37632,37963,
+    37968,38003,38016,38283,38288,38323,38336,38395,
+    38400,38411,38416,38451,38464,38587,38592,39051,
+    39056,39091,39104,39643,39660,39680,39915,39936,
+    40147,40192,40883,40897,40905,40913,40921,40929,
+    40937,40947,40960,46083,46088,46315,46336,47051,
+    47104,47252,47283,47352,47508,47528,47547,47616,
+    47764,47779,47872,47979,47984,48011,48020,48035,
+    48128,48551,48564,48800,48876,48883,48896,48979,
+    49024,49107,49152,49203,49208,49246,49267,49278,
+    49280,49363,49408,50123,50176,50220,50232,50508,
+    50512,50523,50560,51123,51200,51451,51460,51555,
+    51588,51683,51712,51723,51744,52083,52096,52139,
+    52224,52579,52608,52819,52864,52955,52976,53436,
+    53475,53488,53932,54011,54020,54251,54268,54272,
+    54355,54400,54483,54528,54643,54660,54907,55300,
+    55336,55716,55848,55915,55936,56156,56224,56315,
+    56324,56344,56588,56688,57140,57251,57312,57636,
+    57795,57816,57939,57960,58369,58377,58385,58393,
+    58401,58417,58425,58433,58443,58497,58505,58513,
+    58521,58529,58537,58545,58553,58561,58569,58577,
+    58585,58593,58601,58609,58617,58625,58633,58641,
+    58649,58657,58665,58673,58681,58689,58697,58705,
+    58713,58721,58729,58737,58745,58753,58761,58769,
+    58777,58785,58793,58801,58809,58817,58825,58833,
+    58843,58857,58865,58873,58880,58947,59012,59032,
+    59044,59208,59244,59248,59300,59304,59324,59344,
+    59355,59392,59745,59753,59761,59768,59777,59785,
+    59793,59801,59809,59817,59825,59833,59841,59849,
+    59857,59864,59873,59881,59889,59897,59905,59913,
+    59921,59929,59937,59945,59953,59961,59969,59977,
+    59985,59993,60001,60009,60016,60025,60033,60041,
+    60049,60057,60065,60073,60081,60089,60097,60105,
+    60113,60121,60129,60137,60145,60153,60161,60169,
+    60177,60185,60193,60201,60209,60217,60225,60233,
+    60241,60248,60353,60360,60633,60641,60649,60657,
+    60665,60673,60681,60689,60697,60705,60713,60721,
+    60729,60737,60745,60753,60761,60769,60777,60785,
+    60793,60801,60809,60817,60825,60833,60841,60849,
+    60857,60865,60873,60881,60889,60897,60905,60913,
+    60921,60932,61441,61448,61457,61464,61473,61480,
+    61489,61496,61505,61512,61521,61528,61537,61544,
+    61553,61560,61569,61576,61585,61592,61601,61608,
+    61617,61624,61633,61640,61649,61656,61665,61672,
+    61681,61688,61697,61704,61713,61720,61729,61736,
+    61745,61752,61761,61768,61777,61784,61793,61800,
+    61809,61816,61825,61832,61841,61848,61857,61864,
+    61873,61880,61889,61896,61905,61912,61921,61928,
+    61937,61944,61953,61960,61969,61976,61985,61992,
+    62001,62008,62017,62024,62033,62040,62049,62056,
+    62065,62072,62081,62088,62097,62104,62113,62120,
+    62129,62136,62145,62152,62161,62168,62177,62184,
+    62193,62200,62209,62216,62225,62232,62241,62248,
+    62257,62264,62273,62280,62289,62296,62305,62312,
+    62321,62328,62337,62344,62353,62360,62369,62376,
+    62385,62392,62401,62408,62417,62424,62433,62440,
+    62449,62456,62465,62472,62481,62488,62497,62504,
+    62513,62520,62529,62536,62545,62552,62561,62568,
+    62577,62584,62593,62600,62609,62616,62625,62632,
+    62673,62681,62688,62705,62712,62721,62728,62737,
+    62744,62753,62760,62769,62776,62785,62792,62801,
+    62808,62817,62824,62833,62840,62849,62856,62865,
+    62872,62881,62888,62897,62904,62913,62920,62929,
+    62936,62945,62952,62961,62968,62977,62984,62993,
+    63000,63009,63016,63025,63032,63041,63048,63057,
+    63064,63073,63080,63089,63096,63105,63112,63121,
+    63128,63137,63144,63153,63160,63169,63176,63185,
+    63192,63201,63208,63217,63224,63233,63240,63249,
+    63256,63265,63272,63281,63288,63297,63304,63313,
+    63320,63329,63336,63345,63352,63361,63368,63377,
+    63384,63393,63400,63409,63416,63425,63432,63441,
+    63448,63457,63464,63473,63480,63553,63561,63569,
+    63577,63585,63593,63601,63609,63616,63667,63681,
+    63689,63697,63705,63713,63721,63731,63744,63809,
+    63817,63825,63833,63841,63849,63857,63865,63872,
+    63937,63945,63953,63961,63969,63977,63985,63993,
+    64000,64051,64065,64073,64081,64089,64097,64105,
+    64115,64128,64195,64201,64211,64217,64227,64233,
+    64243,64249,64256,64321,64329,64337,64345,64353,
+    64361,64369,64377,64384,64393,64400,64409,64416,
+    64425,64432,64441,64448,64457,64464,64473,64480,
+    64489,64499,64513,64521,64529,64537,64545,64553,
+    64561,64569,64577,64585,64593,64601,64609,64617,
+    64625,64633,64641,64649,64657,64665,64673,64681,
+    64689,64697,64705,64713,64721,64729,64737,64745,
+    64753,64761,64769,64777,64785,64793,64801,64809,
+    64817,64825,64833,64841,64849,64857,64865,64873,
+    64881,64889,64896,64913,64921,64929,64939,64944,
+    64953,64961,64969,64977,64985,64993,65001,65009,
+    65017,65025,65033,65041,65049,65057,65067,65072,
+    65081,65089,65097,65105,65113,65121,65129,65137,
+    65145,65152,65177,65187,65200,65217,65225,65233,
+    65241,65251,65257,65265,65273,65280,65305,65312,
+    65345,65353,65361,65369,65377,65385,65393,65401,
+    65411,65425,65433,65441,65451,65456,65465,65473,
+    65481,65489,65497,65505,65513,65521,65531,65537,
+    65626,65632,65651,65664,65673,65680,65721,65728,
+    65827,65848,65859,65913,65920,65945,65953,65960,
+    65969,65977,65984,66017,66024,66033,66040,66105,
+    66113,66121,66128,66233,66240,66297,66306,66315,
+    66338,66347,66433,66441,66451,66465,66473,66481,
+    66489,66497,66505,66513,66521,66529,66537,66545,
+    66553,66561,66569,66577,66585,66593,66601,66609,
+    66617,66625,66633,66641,66649,66657,66665,66673,
+    66683,66689,66697,66705,66713,66721,66729,66737,
+    66745,66753,66761,66769,66777,66785,66795,66816,
+    66881,66888,67083,67204,67467,67585,67593,67601,
+    67609,67616,67625,67633,67641,67648,67657,67665,
+    67673,67705,67713,67729,67744,67753,67761,67768,
+    67785,67793,67801,67824,67841,67849,67857,67864,
+    67873,67880,67889,67896,67905,67912,67921,67929,
+    67937,67945,67952,67961,67977,67987,67993,68001,
+    68009,68017,68025,68033,68041,68048,68057,68065,
+    68073,68089,68097,68104,68137,68153,68161,68169,
+    68176,68225,68233,68241,68249,68257,68265,68273,
+    68281,68289,68297,68305,68313,68321,68329,68337,
+    68345,68353,68361,68369,68377,68385,68393,68401,
+    68409,68417,68425,68433,68441,68449,68457,68465,
+    68473,68481,68489,68497,68505,68513,68521,68529,
+    68537,68545,68553,68561,68569,68577,68585,68593,
+    68601,68608,68635,68640,68681,68688,68707,68736,
+    69985,69993,70000,70009,70017,70024,72009,72017,
+    72024,74043,74240,74331,74497,74505,74513,74521,
+    74529,74537,74545,74553,74561,74569,74577,74585,
+    74593,74601,74609,74617,74625,74633,74641,74649,
+    74657,74665,74673,74681,74689,74697,74705,74713,
+    74721,74729,74737,74745,74753,74761,74769,74777,
+    74785,74793,74801,74809,74819,74977,74985,74993,
+    75001,75009,75017,75025,75033,75041,75049,75057,
+    75065,75073,75081,75089,75097,75105,75113,75121,
+    75129,75137,75145,75153,75161,75169,75177,75185,
+    75193,75201,75209,75217,75225,75233,75241,75249,
+    75257,75265,75273,75281,75289,75297,75305,75313,
+    75321,75329,75337,75345,75353,75361,75369,75377,
+    75385,75393,75401,75409,75417,75425,75433,75441,
+    75449,75457,75465,75473,75481,75489,75497,75505,
+    75513,75521,75529,75537,75545,75553,75561,75569,
+    75577,75585,75593,75601,75608,86113,86120,86945,
+    86953,86961,86968,87777,87784,88995,89008,89267,
+    89272,90113,90121,90129,90137,90145,90153,90161,
+    90169,90177,90185,90193,90201,90209,90217,90225,
+    90233,90241,90249,90257,90265,90273,90281,90289,
+    90297,90305,90313,90321,90329,90337,90345,90353,
+    90361,90369,90377,90385,90393,90401,90409,90417,
+    90425,90433,90441,90449,90457,90465,90473,90481,
+    90489,90496,90881,90888,90897,90905,90913,90920,
+    90937,90944,90953,90960,90969,90976,90985,90993,
+    91001,91009,91016,91025,91032,91049,91056,91105,
+    91113,91121,91129,91137,91144,91153,91160,91169,
+    91176,91185,91192,91201,91208,91217,91224,91233,
+    91240,91249,91256,91265,91272,91281,91288,91297,
+    91304,91313,91320,91329,91336,91345,91352,91361,
+    91368,91377,91384,91393,91400,91409,91416,91425,
+    91432,91441,91448,91457,91464,91473,91480,91489,
+    91496,91505,91512,91521,91528,91537,91544,91553,
+    91560,91569,91576,91585,91592,91601,91608,91617,
+    91624,91633,91640,91649,91656,91665,91672,91681,
+    91688,91697,91704,91713,91720,91729,91736,91745,
+    91752,91761,91768,91777,91784,91793,91800,91809,
+    91816,91825,91832,91841,91848,91857,91864,91873,
+    91880,91889,91896,91905,91912,91921,91928,91993,
+    92000,92009,92016,92028,92049,92056,92067,92104,
+    92467,92472,92483,92520,92531,92544,92995,93049,
+    93056,93067,93180,93184,93371,93440,93499,93504,
+    93563,93568,93627,93632,93691,93696,93755,93760,
+    93819,93824,93883,93888,93947,93956,94208,94963,
+    95232,95443,95448,95481,95488,96153,96163,96257,
+    96265,96273,96281,96289,96297,96305,96313,96321,
+    96329,96337,96345,96353,96361,96369,96377,96385,
+    96393,96401,96409,96417,96425,96433,96441,96449,
+    96457,96465,96473,96481,96489,96497,96505,96513,
+    96521,96529,96537,96545,96553,96561,96569,96577,
+    96585,96593,96601,96609,96617,96625,96633,96641,
+    96649,96657,96665,96673,96681,96689,96697,96705,
+    96713,96721,96729,96737,96745,96753,96761,96769,
+    96777,96785,96793,96801,96809,96817,96825,96833,
+    96841,96849,96857,96865,96873,96881,96889,96897,
+    96905,96913,96921,96929,96937,96945,96953,96961,
+    96969,96977,96985,96993,97001,97009,97017,97025,
+    97033,97041,97049,97057,97065,97073,97081,97089,
+    97097,97105,97113,97121,97129,97137,97145,97153,
+    97161,97169,97177,97185,97193,97201,97209,97217,
+    97225,97233,97241,97249,97257,97265,97273,97281,
+    97289,97297,97305,97313,97321,97329,97337,97345,
+    97353,97361,97369,97377,97385,97393,97401,97409,
+    97417,97425,97433,97441,97449,97457,97465,97473,
+    97481,97489,97497,97505,97513,97521,97529,97537,
+    97545,97553,97561,97569,97577,97585,97593,97601,
+    97609,97617,97625,97633,97641,97649,97657,97665,
+    97673,97681,97689,97697,97705,97713,97721,97729,
+    97737,97745,97753,97761,97769,97777,97785,97793,
+    97801,97809,97817,97825,97833,97841,97849,97857,
+    97865,97873,97881,97889,97897,97905,97913,97921,
+    97929,97937,97945,97953,97961,97971,98305,98312,
+    98321,98328,98644,98688,98737,98744,98753,98761,
+    98769,98776,98819,98824,99515,99532,99545,99553,
+    99560,99577,99584,100345,100355,100392,100739,100745,
+    100753,100761,100769,100777,100785,100793,100801,100809,
+    100817,100825,100833,100841,100849,100857,100865,100873,
+    100881,100889,100897,100905,100913,100921,100929,100937,
+    100945,100953,100961,100969,100977,100985,100993,101001,
+    101009,101017,101025,101033,101041,101049,101057,101065,
+    101073,101081,101089,101097,101105,101113,101121,101129,
+    101137,101145,101155,101161,101169,101177,101185,101193,
+    101201,101209,101217,101225,101233,101241,101249,101257,
+    101265,101273,101281,101289,101297,101305,101313,101321,
+    101329,101337,101345,101353,101361,101369,101377,101385,
+    101393,101401,101409,101417,101425,101433,101441,101449,
+    101457,101465,101473,101481,101489,101499,101504,101521,
+    101529,101537,101545,101553,101561,101569,101577,101585,
+    101593,101601,101609,101617,101625,101632,102179,102272,
+    102401,102409,102417,102425,102433,102441,102449,102457,
+    102465,102473,102481,102489,102497,102505,102513,102521,
+    102529,102537,102545,102553,102561,102569,102577,102585,
+    102593,102601,102609,102617,102625,102633,102641,102651,
+    102657,102665,102673,102681,102689,102697,102705,102713,
+    102721,102729,102737,102745,102753,102761,102769,102777,
+    102785,102793,102801,102809,102817,102825,102833,102841,
+    102849,102857,102865,102873,102881,102889,102897,102905,
+    102913,102921,102929,102937,102945,102953,102961,102969,
+    102976,103041,103049,103057,103065,103073,103081,103089,
+    103097,103105,103113,103121,103129,103137,103145,103153,
+    103161,103169,103177,103185,103193,103201,103209,103217,
+    103225,103233,103241,103249,103257,103265,103273,103281,
+    103289,103297,103305,103313,103321,103329,103337,103345,
+    103353,103361,103369,103377,103385,103393,103401,103409,
+    103416,103425,103433,103441,103449,103457,103465,103473,
+    103481,103489,103497,103505,103513,103521,103529,103537,
+    103545,103553,103561,103569,103577,103585,103593,103601,
+    103609,103617,103625,103633,103641,103649,103657,103665,
+    103673,103681,103689,103697,103705,103713,103721,103729,
+    103737,103745,103753,103761,103769,103777,103785,103793,
+    103801,103809,103817,103825,103833,103841,103849,103857,
+    103865,103873,103881,103889,103897,103905,103913,103921,
+    103929,103937,103945,103953,103961,103969,103977,103985,
+    103993,104001,104009,104017,104025,104033,104041,104049,
+    104057,104065,104073,104081,104089,104097,104105,104113,
+    104121,104129,104137,104145,104153,104161,104169,104177,
+    104185,104193,104201,104209,104217,104225,104233,104241,
+    104249,104257,104265,104273,104281,104289,104297,104305,
+    104313,104321,104329,104337,104345,104353,104361,104369,
+    104377,104385,104393,104401,104409,104417,104425,104433,
+    104441,104449,104457,104465,104473,104481,104489,104497,
+    104505,104513,104521,104529,104537,104545,104553,104561,
+    104569,104577,104585,104593,104601,104609,104617,104625,
+    104633,104641,104649,104657,104665,104673,104681,104689,
+    104697,104705,104713,104721,104729,104737,104745,104753,
+    104761,104769,104777,104785,104793,104801,104809,104817,
+    104825,104833,104841,104849,104857,104865,104873,104881,
+    104889,104897,104905,104913,104921,104929,104937,104945,
+    104953,104961,104969,104977,104985,104993,105001,105009,
+    105017,105025,105033,105041,105049,105057,105065,105073,
+    105081,105089,105097,105105,105113,105121,105129,105137,
+    105145,105153,105161,105169,105177,105185,105193,105201,
+    105209,105217,105225,105233,105241,105249,105257,105265,
+    105273,105281,105289,105297,105305,105313,105321,105329,
+    105337,105345,105353,105361,105369,105377,105385,105393,
+    105401,105409,105417,105425,105433,105441,105449,105457,
+    105465,105473,105481,105489,105497,105505,105513,105521,
+    105529,105537,105545,105553,105561,105569,105577,105585,
+    105593,105601,105609,105617,105625,105633,105641,105649,
+    105657,105665,105673,105681,105689,105697,105705,105713,
+    105721,105729,105737,105745,105753,105761,105769,105777,
+    105785,105793,105801,105809,105817,105825,105833,105841,
+    105849,105857,105865,105873,105881,105889,105897,105905,
+    105913,105921,105929,105937,105945,105953,105961,105969,
+    105977,105985,105993,106003,106009,106017,106025,106033,
+    106043,106049,106057,106065,106073,106081,106089,106097,
+    106105,106113,106121,106129,106137,106145,106153,106161,
+    106169,106179,106185,106193,106201,106209,106217,106225,
+    106233,106241,106249,106257,106265,106273,106281,106289,
+    106297,106305,106313,106321,106329,106337,106345,106353,
+    106361,106369,106377,106385,106393,106401,106409,106417,
+    106425,106433,106441,106449,106457,106465,106473,106481,
+    106489,106496,337003,337024,337467,337536,340323,340481,
+    340488,340497,340504,340513,340520,340529,340536,340545,
+    340552,340561,340568,340577,340584,340593,340600,340609,
+    340616,340625,340632,340641,340648,340657,340664,340673,
+    340680,340689,340696,340705,340712,340721,340728,340737,
+    340744,340753,340760,340769,340776,340785,340792,340801,
+    340808,340817,340824,340833,340840,340860,340888,340900,
+    340976,340993,341000,341009,341016,341025,341032,341041,
+    341048,341057,341064,341073,341080,341089,341096,341105,
+    341112,341121,341128,341137,341144,341153,341160,341169,
+    341176,341185,341192,341201,341208,341217,341225,341236,
+    341248,341892,341904,341955,342016,342289,342296,342305,
+    342312,342321,342328,342337,342344,342353,342360,342369,
+    342376,342385,342392,342417,342424,342433,342440,342449,
+    342456,342465,342472,342481,342488,342497,342504,342513,
+    342520,342529,342536,342545,342552,342561,342568,342577,
+    342584,342593,342600,342609,342616,342625,342632,342641,
+    342648,342657,342664,342673,342680,342689,342696,342705,
+    342712,342721,342728,342737,342744,342753,342760,342769,
+    342776,342785,342792,342801,342808,342817,342824,342833,
+    342840,342849,342856,342865,342872,342881,342888,342897,
+    342904,342913,342920,342985,342992,343001,343008,343017,
+    343025,343032,343041,343048,343057,343064,343073,343080,
+    343089,343096,343129,343136,343145,343152,343169,343176,
+    343185,343192,343217,343224,343233,343240,343249,343256,
+    343265,343272,343281,343288,343297,343304,343313,343320,
+    343329,343336,343345,343352,343361,343368,343377,343385,
+    343393,343401,343409,343416,343425,343433,343441,343449,
+    343457,343464,343473,343480,343489,343496,343505,343512,
+    343521,343528,343537,343544,343553,343560,343569,343576,
+    343585,343593,343601,343609,343616,343625,343632,343643,
+    343681,343688,343699,343704,343715,343720,343729,343736,
+    343745,343752,343763,343953,343961,343969,343977,343984,
+    344001,344009,344016,344084,344088,344116,344120,344156,
+    344160,344348,344384,344420,344427,344448,344531,344576,
+    345027,345092,345104,345508,345651,345712,345811,345860,
+    346000,346108,346112,346420,346480,346684,346787,346872,
+    347115,347140,347168,347548,347656,347763,347768,347859,
+    347888,347948,347952,348155,348160,348492,348603,348672,
+    348700,348704,348772,348787,348800,348883,348896,349148,
+    349168,349572,349576,349588,349608,349628,349640,349684,
+    349696,349708,349712,349723,349912,350044,350080,350124,
+    350139,350216,350267,350280,350331,350344,350395,350464,
+    350523,350528,350587,350592,350945,350953,350961,350969,
+    350976,351049,351056,351075,351105,351113,351121,351129,
+    351137,351145,351153,351161,351169,351177,351185,351193,
+    351201,351209,351217,351225,351233,351241,351249,351257,
+    351265,351273,351281,351289,351297,351305,351313,351321,
+    351329,351337,351345,351353,351361,351369,351377,351385,
+    351393,351401,351409,351417,351425,351433,351441,351449,
+    351457,351465,351473,351481,351489,351497,351505,351513,
+    351521,351529,351537,351545,351553,351561,351569,351577,
+    351585,351593,351601,351609,351617,351625,351633,351641,
+    351649,351657,351665,351673,351681,351689,351697,351705,
+    351713,351721,351729,351737,351744,352028,352088,352100,
+    352115,352128,352211,352256,441635,441728,441915,441944,
+    442339,509953,509961,509969,509977,509985,509993,510001,
+    510009,510025,510033,510041,510049,510057,510065,510073,
+    510081,510089,510097,510105,510113,510121,510129,510137,
+    510145,510153,510161,510169,510177,510185,510193,510201,
+    510209,510217,510225,510233,510241,510249,510257,510265,
+    510273,510281,510289,510297,510305,510313,510321,510329,
+    510337,510345,510353,510361,510369,510377,510385,510393,
+    510401,510409,510417,510425,510433,510441,510449,510457,
+    510465,510473,510481,510489,510497,510505,510513,510521,
+    510529,510537,510545,510553,510561,510569,510577,510585,
+    510593,510601,510609,510617,510625,510633,510641,510649,
+    510657,510665,510673,510681,510689,510697,510705,510713,
+    510721,510729,510737,510745,510753,510761,510769,510777,
+    510785,510793,510801,510809,510817,510825,510833,510841,
+    510849,510857,510865,510873,510881,510889,510897,510905,
+    510913,510921,510929,510937,510945,510953,510961,510969,
+    510977,510985,510993,511001,511009,511017,511025,511033,
+    511041,511049,511057,511065,511073,511081,511089,511097,
+    511105,511113,511121,511129,511137,511145,511153,511161,
+    511169,511177,511185,511193,511201,511209,511217,511225,
+    511233,511241,511249,511257,511265,511273,511281,511289,
+    511297,511305,511313,511321,511329,511337,511345,511353,
+    511361,511369,511377,511385,511393,511401,511409,511417,
+    511425,511433,511441,511449,511457,511465,511473,511481,
+    511489,511497,511505,511513,511521,511529,511537,511545,
+    511553,511561,511569,511577,511585,511593,511601,511609,
+    511617,511625,511633,511641,511649,511657,511665,511673,
+    511681,511689,511697,511705,511713,511721,511729,511737,
+    511745,511753,511761,511769,511777,511785,511793,511801,
+    511809,511817,511825,511833,511841,511849,511857,511865,
+    511873,511881,511889,511897,511905,511913,511921,511929,
+    511937,511945,511953,511961,511969,511977,511985,511993,
+    512001,512009,512017,512025,512033,512041,512049,512057,
+    512065,512073,512081,512089,512097,512105,512112,512129,
+    512136,512145,512152,512169,512177,512185,512193,512201,
+    512209,512217,512225,512233,512241,512248,512257,512264,
+    512273,512280,512297,512305,512312,512337,512345,512353,
+    512361,512369,512377,512385,512393,512401,512409,512417,
+    512425,512433,512441,512449,512457,512465,512473,512481,
+    512489,512497,512505,512513,512521,512529,512537,512545,
+    512553,512561,512569,512577,512585,512593,512601,512609,
+    512617,512625,512633,512641,512649,512657,512665,512673,
+    512681,512689,512697,512705,512713,512721,512729,512737,
+    512745,512761,512769,512777,512785,512793,512801,512809,
+    512817,512825,512833,512841,512849,512857,512865,512873,
+    512883,512897,512905,512913,512921,512929,512937,512945,
+    512953,512961,512969,512977,512985,512993,513001,513009,
+    513017,513025,513033,513041,513049,513057,513065,513073,
+    513081,513089,513097,513105,513113,513121,513129,513137,
+    513145,513153,513161,513169,513177,513185,513193,513201,
+    513209,513217,513225,513233,513241,513249,513257,513265,
+    513273,513281,513289,513297,513305,513313,513321,513329,
+    513337,513345,513353,513361,513369,513377,513385,513393,
+    513401,513409,513417,513425,513433,513441,513449,513457,
+    513465,513473,513481,513489,513497,513505,513513,513521,
+    513529,513537,513545,513553,513561,513569,513577,513585,
+    513593,513601,513609,513617,513625,513633,513641,513649,
+    513657,513665,513673,513681,513689,513697,513705,513713,
+    513721,513729,513737,513747,514049,514057,514065,514073,
+    514081,514089,514107,514201,514209,514217,514225,514233,
+    514243,514281,514292,514297,514305,514313,514321,514329,
+    514337,514345,514353,514361,514369,514377,514385,514393,
+    514401,514409,514417,514425,514433,514441,514449,514457,
+    514465,514473,514481,514491,514497,514505,514513,514521,
+    514529,514539,514545,514555,514561,514569,514579,514585,
+    514593,514603,514609,514617,514625,514633,514641,514649,
+    514657,514665,514673,514681,514689,514705,514737,514769,
+    514801,514833,514865,514897,514929,514961,514993,515025,
+    515057,515089,515105,515121,515137,515153,515169,515185,
+    515217,515249,515281,515313,515329,515361,515377,515409,
+    515441,515457,515472,515611,515737,515769,515785,515801,
+    515817,515825,515841,515857,515873,515905,515921,515937,
+    515953,515969,515985,516001,516017,516041,516065,516097,
+    516105,516113,516121,516129,516137,516145,516153,516161,
+    516169,516177,516185,516193,516201,516209,516217,516225,
+    516233,516241,516249,516257,516265,516273,516281,516289,
+    516297,516305,516313,516321,516329,516337,516345,516353,
+    516361,516369,516377,516385,516393,516401,516409,516417,
+    516425,516433,516441,516449,516457,516465,516473,516481,
+    516489,516497,516505,516513,516521,516529,516537,516545,
+    516553,516561,516569,516577,516585,516593,516601,516609,
+    516617,516625,516633,516641,516649,516657,516665,516673,
+    516681,516689,516697,516705,516713,516721,516729,516737,
+    516745,516753,516761,516769,516777,516785,516793,516801,
+    516809,516817,516825,516833,516841,516849,516857,516865,
+    516873,516881,516889,516897,516905,516913,516921,516929,
+    516937,516945,516953,516961,516969,516977,516985,516993,
+    517001,517009,517017,517025,517033,517041,517049,517057,
+    517065,517073,517081,517089,517097,517105,517113,517121,
+    517129,517137,517145,517153,517161,517169,517177,517185,
+    517193,517201,517209,517217,517225,517233,517241,517249,
+    517257,517265,517273,517281,517289,517297,517305,517313,
+    517321,517329,517337,517345,517353,517361,517369,517377,
+    517385,517393,517401,517409,517417,517425,517433,517441,
+    517449,517457,517465,517473,517481,517489,517497,517505,
+    517513,517521,517529,517537,517545,517553,517561,517569,
+    517577,517585,517593,517601,517609,517617,517625,517633,
+    517641,517649,517657,517665,517673,517681,517689,517697,
+    517705,517713,517721,517729,517737,517745,517753,517761,
+    517769,517777,517785,517793,517801,517809,517817,517825,
+    517833,517841,517849,517857,517865,517873,517881,517889,
+    517897,517905,517913,517921,517929,517937,517945,517953,
+    517961,517969,517977,517985,517993,518001,518009,518017,
+    518025,518033,518041,518049,518057,518065,518073,518081,
+    518089,518097,518105,518113,518121,518129,518137,518145,
+    518153,518161,518169,518177,518185,518193,518201,518209,
+    518217,518225,518233,518241,518249,518257,518265,518273,
+    518281,518289,518297,518305,518313,518321,518329,518337,
+    518345,518353,518361,518369,518377,518385,518393,518401,
+    518409,518417,518425,518433,518441,518449,518457,518465,
+    518473,518481,518489,518497,518505,518513,518521,518529,
+    518537,518545,518553,518561,518569,518577,518585,518593,
+    518601,518609,518617,518625,518640,518785,518793,518809,
+    518817,518825,518833,518841,518849,518865,518873,518881,
+    518889,518897,518905,518921,518929,518945,518961,518969,
+    518985,518993,519009,519025,519033,519049,519065,519073,
+    519081,519089,519105,519113,519121,519129,519137,519153,
+    519161,519169,519177,519185,519193,519209,519225,519241,
+    519249,519257,519265,519273,519281,519289,519299,519313,
+    519321,519329,519337,519345,519353,519369,519377,519385,
+    519393,519409,519417,519425,519433,519441,519449,519457,
+    519465,519473,519481,519489,519497,519505,519513,519521,
+    519529,519537,519545,519553,519561,519569,519577,519585,
+    519593,519601,519609,519617,519625,519633,519641,519649,
+    519657,519665,519673,519681,519689,519697,519705,519713,
+    519721,519729,519737,519747,519800,519811,520065,520073,
+    520081,520089,520097,520105,520113,520121,520129,520137,
+    520145,520153,520161,520168,520198,520321,520329,520339,
+    520345,520353,520361,520369,520377,520385,520395,520452,
+    520579,520585,520593,520601,520617,520625,520633,520641,
+    520649,520657,520665,520673,520681,520689,520697,520705,
+    520713,520721,520729,520737,520744,520761,520769,520777,
+    520809,520833,520841,520851,520865,520873,520881,520889,
+    520897,520905,520913,520921,520929,520937,520945,520953,
+    520961,520969,520977,520985,520993,521001,521009,521019,
+    521025,521033,521041,521049,521059,521089,521097,521105,
+    521112,521121,521131,521137,521145,521153,521161,521169,
+    521177,521185,521193,521201,521209,521217,521225,521241,
+    521257,521273,521289,521321,521337,521369,521385,521417,
+    521449,521481,521513,521545,521561,521577,521593,521609,
+    521641,521673,521705,521737,521769,521801,521833,521865,
+    521897,521929,521961,521993,522025,522057,522089,522105,
+    522121,522153,522169,522185,522201,522219,522234,522243,
+    522249,522257,522265,522273,522281,522289,522297,522305,
+    522313,522321,522329,522337,522345,522353,522361,522369,
+    522377,522385,522393,522401,522409,522417,522425,522433,
+    522441,522449,522457,522465,522473,522481,522489,522497,
+    522505,522513,522521,522529,522537,522545,522553,522561,
+    522569,522577,522585,522593,522601,522609,522617,522625,
+    522633,522641,522649,522657,522665,522673,522681,522689,
+    522697,522705,522713,522721,522729,522737,522745,522753,
+    522761,522769,522777,522785,522793,522801,522809,522817,
+    522825,522833,522841,522849,522857,522865,522873,522881,
+    522889,522897,522905,522913,522921,522929,522937,522945,
+    522953,522961,522969,522977,522985,522993,523001,523009,
+    523017,523025,523033,523041,523049,523057,523065,523073,
+    523081,523089,523097,523105,523113,523121,523129,523137,
+    523145,523153,523161,523169,523177,523185,523193,523201,
+    523209,523217,523225,523233,523241,523249,523257,523265,
+    523273,523281,523289,523297,523305,523313,523321,523329,
+    523337,523345,523353,523361,523369,523377,523385,523393,
+    523401,523409,523417,523425,523433,523441,523449,523457,
+    523465,523473,523481,523489,523497,523505,523513,523523,
+    523529,523537,523545,523553,523561,523569,523577,523585,
+    523593,523601,523609,523617,523625,523633,523641,523649,
+    523657,523665,523673,523681,523689,523697,523705,523713,
+    523721,523729,523737,523745,523753,523761,523771,523793,
+    523801,523809,523817,523825,523833,523843,523857,523865,
+    523873,523881,523889,523897,523907,523921,523929,523937,
+    523945,523953,523961,523971,523985,523993,524001,524011,
+    524033,524041,524049,524057,524065,524073,524081,524091,
+    524097,524105,524113,524121,524129,524137,524145,524155,
+    524288,524387,524392,524603,524608,524763,524768,524787,
+    524792,524915,524928,525043,525312,526299,526336,526363,
+    526392,526755,526776,527483,527488,527595,527616,527627,
+    528000,528364,528371,529408,529643,529664,530059,530180,
+    530184,530403,530432,530723,530792,531035,531072,531380,
+    531419,531456,531699,531704,532003,532032,532147,532481,
+    532489,532497,532505,532513,532521,532529,532537,532545,
+    532553,532561,532569,532577,532585,532593,532601,532609,
+    532617,532625,532633,532641,532649,532657,532665,532673,
+    532681,532689,532697,532705,532713,532721,532729,532737,
+    532745,532753,532761,532769,532777,532785,532793,532800,
+    533747,533760,533843,533889,533897,533905,533913,533921,
+    533929,533937,533945,533953,533961,533969,533977,533985,
+    533993,534001,534009,534017,534025,534033,534041,534049,
+    534057,534065,534073,534081,534089,534097,534105,534113,
+    534121,534129,534137,534145,534153,534161,534169,534179,
+    534208,534499,534528,534851,534912,535331,535416,535425,
+    535433,535441,535449,535457,535465,535473,535481,535489,
+    535497,535505,535515,535521,535529,535537,535545,535553,
+    535561,535569,535577,535585,535593,535601,535609,535617,
+    535625,535633,535643,535649,535657,535665,535673,535681,
+    535689,535697,535707,535713,535721,535731,535736,535827,
+    535832,535955,535960,536019,536024,536043,536576,539067,
+    539136,539315,539392,539459,539648,539657,539665,539673,
+    539681,539689,539699,539705,539713,539721,539729,539737,
+    539745,539753,539761,539769,539777,539785,539793,539801,
+    539809,539817,539825,539833,539841,539849,539857,539865,
+    539873,539881,539889,539897,539905,539913,539921,539929,
+    539937,539945,539953,539961,539969,539977,539985,539993,
+    540001,540009,540017,540025,540033,540043,540049,540057,
+    540065,540073,540081,540089,540097,540105,540113,540123,
+    540672,540723,540736,540747,540752,541107,541112,541131,
+    541152,541163,541176,541363,541368,541947,542008,542083,
+    542464,542619,542624,542643,542680,542947,542968,543187,
+    543224,543235,543744,544195,544224,544387,544400,544780,
+    544803,544812,544827,544868,544896,544931,544936,544963,
+    544968,545203,545220,545243,545276,545280,545355,545408,
+    545483,545536,546051,546304,546604,546619,546648,546747,
+    546816,547251,547272,547507,547520,547739,547776,547987,
+    548040,548075,548168,548227,548864,549451,549889,549897,
+    549905,549913,549921,549929,549937,549945,549953,549961,
+    549969,549977,549985,549993,550001,550009,550017,550025,
+    550033,550041,550049,550057,550065,550073,550081,550089,
+    550097,550105,550113,550121,550129,550137,550145,550153,
+    550161,550169,550177,550185,550193,550201,550209,550217,
+    550225,550233,550241,550249,550257,550265,550273,550281,
+    550289,550299,550400,550811,550864,551204,551235,551296,
+    551379,553728,553979,553984,554323,554332,554344,554355,
+    554368,554387,554988,555008,555331,555392,555572,555656,
+    555731,555904,556052,556080,556115,556416,556643,556800,
+    556987,557060,557080,557508,557624,557683,557712,557956,
+    557960,557980,557992,558003,558076,558104,558468,558552,
+    558571,558576,558612,558619,558720,558923,558976,559059,
+    559108,559128,559420,559531,559536,559660,559672,559683,
+    559744,560028,560032,560059,560132,560152,560540,560648,
+    560716,560744,560756,560768,560899,560904,561067,561152,
+    561299,561304,561508,561600,561652,561656,561676,561683,
+    562176,562235,562240,562251,562256,562291,562296,562419,
+    562424,562515,562560,562940,563035,563072,563155,563204,
+    563235,563240,563307,563320,563339,563352,563531,563536,
+    563595,563600,563619,563624,563667,563676,563688,563700,
+    563755,563772,563787,563804,563827,563840,563851,563900,
+    563907,563944,563988,564003,564020,564075,564100,564139,
+    565248,565676,565816,565987,565992,566004,566008,566035,
+    566272,566660,566816,566851,566912,566995,568320,568700,
+    568755,568772,568840,569060,569075,569344,569732,569864,
+    569899,569984,570067,570112,570219,570368,570716,570816,
+    570835,570880,570963,571392,571611,571628,571747,571776,
+    571963,573440,573796,573912,573923,574721,574729,574737,
+    574745,574753,574761,574769,574777,574785,574793,574801,
+    574809,574817,574825,574833,574841,574849,574857,574865,
+    574873,574881,574889,574897,574905,574913,574921,574929,
+    574937,574945,574953,574961,574969,574976,575387,575480,
+    575547,575560,575571,575584,575651,575656,575675,575680,
+    575876,575923,575932,575947,575964,575992,576004,576008,
+    576020,576032,576059,576128,576211,576768,576835,576848,
+    577164,577219,577236,577288,577316,577323,577536,577548,
+    577624,577948,578000,578012,578040,578108,578115,578176,
+    578188,578272,578644,578768,578843,578944,579531,579584,
+    579667,581632,581707,581712,582012,582075,582084,582144,
+    582195,582272,582507,582528,582787,582804,582979,582988,
+    583099,583680,583739,583744,583763,583768,584076,584123,
+    584148,584155,584164,584179,584188,584240,584252,584259,
+    584320,584403,584448,584499,584504,584523,584528,584788,
+    584827,584836,584851,584860,584896,584907,584960,585043,
+    587520,587676,587704,587723,587780,587792,587804,587808,
+    587915,587920,588196,588251,588276,588312,588499,589184,
+    589195,589312,589715,589816,597203,598016,598907,598912,
+    598955,599040,600611,621696,622491,622592,631171,631300,
+    631304,631356,631475,663552,668219,737280,741835,741888,
+    742139,742144,742227,742256,742907,742912,742995,743040,
+    743283,743300,743336,743347,743424,743812,743864,743987,
+    744064,744147,744152,744211,744216,744387,744424,744579,
+    750081,750089,750097,750105,750113,750121,750129,750137,
+    750145,750153,750161,750169,750177,750185,750193,750201,
+    750209,750217,750225,750233,750241,750249,750257,750265,
+    750273,750281,750289,750297,750305,750313,750321,750329,
+    750336,750811,751616,752219,752252,752256,752268,752707,
+    752764,752792,752899,753408,753444,753451,753540,753555,
+    753664,802755,802816,812723,813056,813131,884608,884643,
+    884648,884707,884712,884731,884736,887067,887184,887195,
+    887424,887451,887464,887475,887584,887619,887680,890851,
+    909312,910171,910208,910315,910336,910411,910464,910547,
+    910560,910572,910584,910594,910627,948228,948595,948612,
+    948795,948864,949795,950272,952243,952320,952635,952648,
+    953073,953081,953089,953097,953105,953113,953121,953132,
+    953168,953196,953243,953308,953368,953388,953440,953684,
+    953712,953817,953825,953833,953841,953849,953857,953864,
+    954203,954368,954900,954920,954931,955904,956067,956160,
+    956323,956416,957115,957184,957387,958465,958473,958481,
+    958489,958497,958505,958513,958521,958529,958537,958545,
+    958553,958561,958569,958577,958585,958593,958601,958609,
+    958617,958625,958633,958641,958649,958657,958665,958673,
+    958681,958689,958697,958705,958713,958721,958729,958737,
+    958745,958753,958761,958769,958777,958785,958793,958801,
+    958809,958817,958825,958833,958841,958849,958857,958865,
+    958873,958881,958889,958897,958905,958913,958921,958929,
+    958937,958945,958953,958961,958969,958977,958985,958993,
+    959001,959009,959017,959025,959033,959041,959049,959057,
+    959065,959073,959081,959089,959097,959105,959113,959121,
+    959129,959137,959147,959153,959161,959169,959177,959185,
+    959193,959201,959209,959217,959225,959233,959241,959249,
+    959257,959265,959273,959281,959289,959297,959305,959313,
+    959321,959329,959337,959345,959353,959361,959369,959377,
+    959385,959393,959401,959409,959417,959425,959433,959441,
+    959449,959457,959465,959473,959481,959489,959497,959505,
+    959513,959521,959529,959537,959545,959553,959561,959569,
+    959577,959585,959593,959601,959609,959617,959625,959633,
+    959641,959649,959657,959665,959673,959681,959689,959697,
+    959705,959713,959723,959729,959737,959747,959761,959771,
+    959785,959793,959803,959817,959825,959833,959841,959851,
+    959857,959865,959873,959881,959889,959897,959905,959913,
+    959921,959929,959937,959945,959955,959961,959971,959977,
+    959985,959993,960001,960009,960017,960025,960035,960041,
+    960049,960057,960065,960073,960081,960089,960097,960105,
+    960113,960121,960129,960137,960145,960153,960161,960169,
+    960177,960185,960193,960201,960209,960217,960225,960233,
+    960241,960249,960257,960265,960273,960281,960289,960297,
+    960305,960313,960321,960329,960337,960345,960353,960361,
+    960369,960377,960385,960393,960401,960409,960417,960425,
+    960433,960441,960449,960457,960465,960473,960481,960489,
+    960497,960505,960513,960521,960529,960537,960545,960553,
+    960563,960569,960577,960585,960593,960603,960617,960625,
+    960633,960641,960649,960657,960665,960673,960683,960689,
+    960697,960705,960713,960721,960729,960737,960747,960753,
+    960761,960769,960777,960785,960793,960801,960809,960817,
+    960825,960833,960841,960849,960857,960865,960873,960881,
+    960889,960897,960905,960913,960921,960929,960937,960945,
+    960953,960961,960969,960979,960985,960993,961001,961009,
+    961019,961025,961033,961041,961049,961057,961067,961073,
+    961083,961105,961113,961121,961129,961137,961145,961153,
+    961163,961169,961177,961185,961193,961201,961209,961217,
+    961225,961233,961241,961249,961257,961265,961273,961281,
+    961289,961297,961305,961313,961321,961329,961337,961345,
+    961353,961361,961369,961377,961385,961393,961401,961409,
+    961417,961425,961433,961441,961449,961457,961465,961473,
+    961481,961489,961497,961505,961513,961521,961529,961537,
+    961545,961553,961561,961569,961577,961585,961593,961601,
+    961609,961617,961625,961633,961641,961649,961657,961665,
+    961673,961681,961689,961697,961705,961713,961721,961729,
+    961737,961745,961753,961761,961769,961777,961785,961793,
+    961801,961809,961817,961825,961833,961841,961849,961857,
+    961865,961873,961881,961889,961897,961905,961913,961921,
+    961929,961937,961945,961953,961961,961969,961977,961985,
+    961993,962001,962009,962017,962025,962033,962041,962049,
+    962057,962065,962073,962081,962089,962097,962105,962113,
+    962121,962129,962137,962145,962153,962161,962169,962177,
+    962185,962193,962201,962209,962217,962225,962233,962241,
+    962249,962257,962265,962273,962281,962289,962297,962305,
+    962313,962321,962329,962337,962345,962353,962361,962369,
+    962377,962385,962393,962401,962409,962417,962425,962433,
+    962441,962449,962457,962465,962473,962481,962489,962497,
+    962505,962513,962521,962529,962537,962545,962553,962561,
+    962569,962577,962585,962593,962601,962609,962617,962625,
+    962633,962641,962649,962657,962665,962673,962681,962689,
+    962697,962705,962713,962721,962729,962737,962745,962753,
+    962761,962769,962777,962785,962793,962801,962809,962817,
+    962825,962833,962841,962849,962857,962865,962873,962881,
+    962889,962897,962905,962913,962921,962929,962937,962945,
+    962953,962961,962969,962977,962985,962993,963001,963009,
+    963017,963025,963033,963041,963049,963057,963065,963073,
+    963081,963089,963097,963105,963113,963121,963129,963137,
+    963145,963153,963161,963169,963177,963185,963193,963201,
+    963209,963217,963225,963233,963241,963249,963257,963265,
+    963273,963281,963289,963297,963305,963313,963321,963329,
+    963337,963345,963353,963361,963369,963377,963385,963393,
+    963401,963409,963417,963425,963433,963441,963449,963457,
+    963465,963473,963481,963489,963497,963505,963513,963521,
+    963529,963537,963545,963553,963561,963569,963577,963585,
+    963593,963601,963609,963617,963625,963633,963641,963649,
+    963657,963665,963673,963681,963689,963697,963705,963713,
+    963721,963729,963737,963745,963753,963761,963769,963777,
+    963785,963793,963801,963809,963817,963825,963833,963841,
+    963849,963857,963865,963873,963881,963891,963905,963913,
+    963921,963929,963937,963945,963953,963961,963969,963977,
+    963985,963993,964001,964009,964017,964025,964033,964041,
+    964049,964057,964065,964073,964081,964089,964097,964105,
+    964113,964121,964129,964137,964145,964153,964161,964169,
+    964177,964185,964193,964201,964209,964217,964225,964233,
+    964241,964249,964265,964273,964281,964289,964297,964305,
+    964313,964321,964329,964337,964345,964353,964361,964369,
+    964377,964385,964393,964401,964409,964417,964425,964433,
+    964441,964449,964457,964465,964473,964481,964489,964497,
+    964505,964513,964521,964529,964537,964545,964553,964561,
+    964569,964577,964585,964593,964601,964609,964617,964625,
+    964633,964641,964649,964657,964665,964673,964681,964689,
+    964697,964705,964713,964729,964737,964745,964753,964761,
+    964769,964777,964785,964793,964801,964809,964817,964825,
+    964833,964841,964849,964857,964865,964873,964881,964889,
+    964897,964905,964913,964921,964929,964937,964945,964953,
+    964961,964969,964977,964985,964993,965001,965009,965017,
+    965025,965033,965041,965049,965057,965065,965073,965081,
+    965089,965097,965105,965113,965121,965129,965137,965145,
+    965153,965161,965169,965177,965193,965201,965209,965217,
+    965225,965233,965241,965249,965257,965265,965273,965281,
+    965289,965297,965305,965313,965321,965329,965337,965345,
+    965353,965361,965369,965377,965385,965393,965401,965409,
+    965417,965425,965433,965441,965449,965457,965465,965473,
+    965481,965489,965497,965505,965513,965521,965529,965537,
+    965545,965553,965561,965569,965577,965585,965593,965601,
+    965609,965617,965625,965633,965641,965657,965665,965673,
+    965681,965689,965697,965705,965713,965721,965729,965737,
+    965745,965753,965761,965769,965777,965785,965793,965801,
+    965809,965817,965825,965833,965841,965849,965857,965865,
+    965873,965881,965889,965897,965905,965913,965921,965929,
+    965937,965945,965953,965961,965969,965977,965985,965993,
+    966001,966009,966017,966025,966033,966041,966049,966057,
+    966065,966073,966081,966089,966097,966105,966121,966129,
+    966137,966145,966153,966161,966169,966177,966185,966193,
+    966201,966209,966217,966225,966243,966257,966265,966273,
+    966281,966289,966297,966305,966313,966321,966329,966337,
+    966345,966353,966361,966369,966377,966385,966393,966401,
+    966409,966417,966425,966433,966441,966449,966457,966465,
+    966473,966481,966489,966497,966505,966513,966521,966529,
+    966537,966545,966553,966561,966569,966577,966585,966593,
+    966601,966609,966617,966625,966633,966641,966649,966656,
+    970756,971192,971228,971624,971692,971696,971812,971816,
+    971875,971996,972035,972044,972163,980992,981243,981288,
+    981339,983044,983099,983108,983243,983260,983315,983324,
+    983339,983348,983387,983425,983433,983441,983449,983457,
+    983465,983473,983481,983489,983497,983505,983513,983521,
+    983529,983537,983545,983553,983561,983569,983577,983585,
+    983593,983601,983609,983617,983625,983633,983641,983649,
+    983657,983665,983673,983681,983689,983697,983705,983713,
+    983721,983729,983737,983745,983753,983761,983769,983777,
+    983785,983793,983801,983809,983817,983825,983833,983841,
+    983849,983857,983865,983873,983881,983889,983897,983905,
+    983913,983923,984188,984195,985088,985451,985476,985528,
+    985587,985600,985683,985712,985731,988288,988532,988539,
+    988672,989028,989056,989139,989176,989187,992896,993124,
+    993152,993235,999168,999227,999232,999267,999272,999291,
+    999296,999419,999424,1001003,1001016,1001092,1001147,1001473,
+    1001481,1001489,1001497,1001505,1001513,1001521,1001529,1001537,
+    1001545,1001553,1001561,1001569,1001577,1001585,1001593,1001601,
+    1001609,1001617,1001625,1001633,1001641,1001649,1001657,1001665,
+    1001673,1001681,1001689,1001697,1001705,1001713,1001721,1001729,
+    1001737,1001744,1002020,1002072,1002083,1002112,1002195,1002224,
+    1002243,1008520,1009067,1009672,1010163,1011713,1011721,1011729,
+    1011737,1011747,1011753,1011761,1011769,1011777,1011785,1011793,
+    1011801,1011809,1011817,1011825,1011833,1011841,1011849,1011857,
+    1011865,1011873,1011881,1011889,1011897,1011905,1011913,1011921,
+    1011929,1011937,1011945,1011953,1011961,1011971,1011977,1011985,
+    1011995,1012001,1012011,1012025,1012035,1012041,1012049,1012057,
+    1012065,1012073,1012081,1012089,1012097,1012105,1012113,1012123,
+    1012129,1012137,1012145,1012153,1012163,1012169,1012179,1012185,
+    1012195,1012241,1012251,1012281,1012291,1012297,1012307,1012313,
+    1012323,1012329,1012337,1012345,1012355,1012361,1012369,1012379,
+    1012385,1012395,1012409,1012419,1012425,1012435,1012441,1012451,
+    1012457,1012467,1012473,1012483,1012489,1012497,1012507,1012513,
+    1012523,1012537,1012545,1012553,1012561,1012571,1012577,1012585,
+    1012593,1012601,1012609,1012617,1012625,1012635,1012641,1012649,
+    1012657,1012665,1012675,1012681,1012689,1012697,1012705,1012715,
+    1012721,1012731,1012737,1012745,1012753,1012761,1012769,1012777,
+    1012785,1012793,1012801,1012809,1012819,1012825,1012833,1012841,
+    1012849,1012857,1012865,1012873,1012881,1012889,1012897,1012905,
+    1012913,1012921,1012929,1012937,1012945,1012953,1012963,1013001,
+    1013009,1013017,1013027,1013033,1013041,1013049,1013057,1013065,
+    1013075,1013081,1013089,1013097,1013105,1013113,1013121,1013129,
+    1013137,1013145,1013153,1013161,1013169,1013177,1013185,1013193,
+    1013201,1013209,1013219,1013632,1013651,1015808,1016163,1016192,
+    1016995,1017088,1017211,1017224,1017347,1017352,1017475,1017480,
+    1017779,1017865,1017873,1017881,1017889,1017897,1017905,1017913,
+    1017921,1017929,1017937,1017944,1017985,1017993,1018001,1018009,
+    1018017,1018025,1018033,1018041,1018049,1018057,1018065,1018073,
+    1018081,1018089,1018097,1018105,1018113,1018121,1018129,1018137,
+    1018145,1018153,1018161,1018169,1018177,1018185,1018193,1018201,
+    1018209,1018217,1018225,1018232,1018241,1018249,1018257,1018265,
+    1018273,1018281,1018289,1018297,1018305,1018313,1018321,1018329,
+    1018337,1018345,1018353,1018361,1018369,1018377,1018385,1018393,
+    1018401,1018409,1018417,1018425,1018433,1018441,1018449,1018457,
+    1018465,1018473,1018481,1018489,1018496,1018705,1018713,1018721,
+    1018728,1019009,1019016,1019251,1019696,1019905,1019913,1019921,
+    1019931,1020033,1020041,1020049,1020057,1020065,1020073,1020081,
+    1020089,1020097,1020105,1020113,1020121,1020129,1020137,1020145,
+    1020153,1020161,1020169,1020177,1020185,1020193,1020201,1020209,
+    1020217,1020225,1020233,1020241,1020249,1020257,1020265,1020273,
+    1020281,1020289,1020297,1020305,1020313,1020321,1020329,1020337,
+    1020345,1020353,1020361,1020369,1020377,1020387,1020417,1020425,
+    1020433,1020441,1020449,1020457,1020465,1020473,1020481,1020491,
+    1020545,1020553,1020563,1020672,1020723,1021952,1029827,1029856,
+    1029995,1030016,1030123,1030144,1031099,1031128,1031891,1031936,
+    1032035,1032064,1032075,1032192,1032291,1032320,1032771,1032832,
+    1032915,1032960,1033283,1033344,1033587,1033600,1033619,1034240,
+    1036963,1037056,1037171,1037184,1037291,1037312,1037387,1037440,
+    1037811,1037816,1037875,1037936,1038051,1038080,1038155,1038208,
+    1038283,1038336,1039515,1039520,1039963,1040257,1040265,1040273,
+    1040281,1040289,1040297,1040305,1040313,1040321,1040329,1040339,
+    1048576,1390339,1390592,1423827,1423872,1425651,1425664,1471763,
+    1471872,1531659,1531776,1536755,1556481,1556489,1556497,1556505,
+    1556513,1556521,1556529,1556537,1556545,1556553,1556561,1556569,
+    1556577,1556585,1556593,1556601,1556609,1556617,1556625,1556633,
+    1556641,1556649,1556657,1556665,1556673,1556681,1556689,1556697,
+    1556705,1556713,1556721,1556729,1556737,1556745,1556753,1556761,
+    1556769,1556777,1556785,1556793,1556801,1556809,1556817,1556825,
+    1556833,1556841,1556849,1556857,1556865,1556873,1556897,1556905,
+    1556913,1556921,1556929,1556937,1556945,1556953,1556961,1556969,
+    1556977,1556985,1556993,1557001,1557009,1557017,1557025,1557033,
+    1557049,1557057,1557065,1557073,1557081,1557089,1557097,1557105,
+    1557113,1557121,1557129,1557137,1557145,1557153,1557161,1557169,
+    1557177,1557185,1557193,1557201,1557209,1557217,1557225,1557233,
+    1557241,1557249,1557257,1557265,1557273,1557281,1557289,1557297,
+    1557305,1557315,1557321,1557329,1557345,1557353,1557361,1557369,
+    1557377,1557385,1557393,1557401,1557411,1557417,1557425,1557433,
+    1557441,1557449,1557457,1557465,1557473,1557481,1557489,1557497,
+    1557505,1557513,1557521,1557529,1557537,1557545,1557553,1557561,
+    1557569,1557577,1557585,1557593,1557601,1557609,1557617,1557625,
+    1557633,1557641,1557657,1557665,1557681,1557689,1557697,1557705,
+    1557713,1557721,1557729,1557737,1557745,1557753,1557761,1557769,
+    1557777,1557785,1557793,1557801,1557809,1557817,1557825,1557833,
+    1557841,1557849,1557857,1557865,1557873,1557881,1557889,1557897,
+    1557905,1557913,1557921,1557929,1557937,1557945,1557953,1557961,
+    1557969,1557977,1557985,1557993,1558001,1558009,1558017,1558025,
+    1558033,1558041,1558049,1558057,1558065,1558073,1558081,1558089,
+    1558097,1558105,1558113,1558121,1558129,1558137,1558145,1558153,
+    1558161,1558169,1558177,1558185,1558193,1558201,1558209,1558217,
+    1558225,1558233,1558241,1558249,1558257,1558265,1558273,1558281,
+    1558289,1558297,1558305,1558313,1558321,1558329,1558337,1558345,
+    1558353,1558361,1558369,1558377,1558385,1558393,1558401,1558409,
+    1558417,1558425,1558433,1558441,1558449,1558457,1558465,1558473,
+    1558481,1558489,1558497,1558505,1558513,1558521,1558529,1558537,
+    1558545,1558553,1558561,1558569,1558577,1558585,1558593,1558601,
+    1558609,1558617,1558625,1558633,1558641,1558649,1558657,1558665,
+    1558673,1558681,1558689,1558697,1558705,1558713,1558721,1558729,
+    1558737,1558745,1558753,1558761,1558769,1558779,1558785,1558793,
+    1558801,1558809,1558817,1558825,1558833,1558841,1558849,1558857,
+    1558865,1558873,1558881,1558897,1558905,1558913,1558921,1558929,
+    1558937,1558945,1558953,1558961,1558969,1558977,1558985,1558993,
+    1559001,1559009,1559017,1559025,1559033,1559041,1559049,1559057,
+    1559065,1559073,1559081,1559089,1559105,1559113,1559121,1559129,
+    1559137,1559145,1559153,1559161,1559169,1559177,1559185,1559193,
+    1559201,1559209,1559217,1559225,1559233,1559241,1559249,1559257,
+    1559265,1559273,1559291,1559297,1559305,1559313,1559321,1559329,
+    1559337,1559345,1559353,1559361,1559369,1559377,1559385,1559393,
+    1559401,1559409,1559417,1559425,1559433,1559441,1559449,1559457,
+    1559465,1559473,1559481,1559489,1559497,1559505,1559513,1559521,
+    1559529,1559537,1559545,1559553,1559561,1559569,1559577,1559585,
+    1559593,1559601,1559609,1559617,1559625,1559633,1559641,1559649,
+    1559657,1559665,1559673,1559681,1559689,1559697,1559705,1559713,
+    1559721,1559729,1559737,1559745,1559753,1559761,1559769,1559777,
+    1559785,1559793,1559801,1559809,1559817,1559825,1559833,1559841,
+    1559849,1559857,1559865,1559873,1559881,1559889,1559897,1559905,
+    1559913,1559921,1559929,1559937,1559945,1559953,1559961,1559969,
+    1559977,1559985,1559993,1560001,1560009,1560017,1560025,1560033,
+    1560041,1560049,1560059,1560065,1560073,1560081,1560089,1560097,
+    1560105,1560113,1560121,1560129,1560137,1560145,1560153,1560161,
+    1560169,1560177,1560185,1560193,1560201,1560209,1560217,1560225,
+    1560233,1560241,1560249,1560257,1560265,1560273,1560281,1560289,
+    1560297,1560305,1560313,1560321,1560329,1560337,1560345,1560353,
+    1560361,1560369,1560377,1560385,1560393,1560401,1560409,1560417,
+    1560425,1560433,1560441,1560449,1560457,1560465,1560473,1560481,
+    1560489,1560497,1560505,1560513,1560521,1560529,1560537,1560545,
+    1560553,1560561,1560577,1560585,1560593,1560601,1560609,1560617,
+    1560625,1560633,1560641,1560649,1560657,1560665,1560673,1560681,
+    1560689,1560697,1560705,1560713,1560721,1560729,1560737,1560745,
+    1560753,1560761,1560769,1560777,1560785,1560793,1560801,1560809,
+    1560819,1572864,1612379,1612416,1645955,7342086,7344003,
+};
+
+// the mapping of each mapped range in urlIdnaPool, as
+// offset << URL_IDNA_LEN_BITS | length
+static const unsigned int urlIdnaMappings[8351] = {
+    0,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,0,0,1665,0,1730,
+    0,1,0,0,0,1858,0,1985,
+    2049,2114,2241,0,2306,2433,897,0,
+    2499,2691,2883,0,3073,3137,3201,3265,
+    3329,3393,3457,3521,3585,3649,3713,3777,
+    3841,3905,3969,4033,4097,4161,4225,4289,
+    4353,4417,4481,0,4545,4609,4673,4737,
+    4801,4865,4929,0,4993,0,5057,0,
+    5121,0,5185,0,5249,0,5313,0,
+    5377,0,5441,0,5505,0,5569,0,
+    5633,0,5697,0,5761,0,5825,0,
+    5889,0,5953,0,6017,0,6081,0,
+    6145,0,6209,0,6273,0,6337,0,
+    6401,0,6465,0,6530,0,6658,6785,
+    0,6849,0,6913,0,6977,0,7041,
+    0,7106,7233,0,7297,0,7361,0,
+    7425,0,7490,7617,0,7681,0,7745,
+    0,7809,0,7873,0,7937,0,8001,
+    0,8065,0,8129,0,8193,0,8257,
+    0,8321,0,8385,0,8449,0,8513,
+    0,8577,0,8641,0,8705,0,8769,
+    0,8833,0,8897,0,8961,0,9025,
+    0,9089,9153,0,9217,0,9281,0,
+    1153,0,9345,9409,0,9473,0,9537,
+    9601,0,9665,9729,9793,0,9857,9921,
+    9985,10049,0,10113,10177,0,10241,10305,
+    10369,0,10433,10497,0,10561,10625,0,
+    10689,0,10753,0,10817,10881,0,10945,
+    0,11009,0,11073,11137,0,11201,11265,
+    11329,0,11393,0,11457,11521,0,11585,
+    0,11650,11778,11906,12033,0,12097,0,
+    12161,0,12225,0,12289,0,12353,0,
+    12417,0,12481,0,12545,0,12609,0,
+    12673,0,12737,0,12801,0,12865,0,
+    12929,0,12993,0,13057,0,13122,13249,
+    0,13313,13377,13441,0,13505,0,13569,
+    0,13633,0,13697,0,13761,0,13825,
+    0,13889,0,13953,0,14017,0,14081,
+    0,14145,0,14209,0,14273,0,14337,
+    0,14401,0,14465,0,14529,0,14593,
+    0,14657,0,14721,0,14785,0,14849,
+    0,14913,0,14977,0,15041,0,15105,
+    0,15169,0,15233,0,15297,0,15361,
+    15425,0,15489,15553,0,15617,0,15681,
+    15745,15809,15873,0,15937,0,16001,0,
+    16065,0,16129,0,449,16193,577,1089,
+    16257,16321,16385,1409,1537,0,16450,16578,
+    16706,16834,16962,17090,0,10177,705,1153,
+    1473,17217,0,0,17281,17345,0,17409,
+    17474,17601,0,0,0,17665,0,17729,
+    0,17793,0,17857,0,0,17922,0,
+    18049,18113,0,2114,18179,18369,18433,18497,
+    18561,18625,0,18689,0,18753,18817,0,
+    18881,18945,19009,19073,19137,19201,19265,19329,
+    17601,19393,19457,2241,19521,19585,19649,19713,
+    19777,0,19841,19905,19969,20033,20097,20161,
+    20225,20289,20353,0,20417,18945,19329,19969,
+    18753,20353,20033,19713,0,20481,0,20545,
+    0,20609,0,20673,0,20737,0,20801,
+    0,20865,0,20929,0,20993,0,21057,
+    0,21121,0,21185,0,19393,19777,19841,
+    0,19329,19137,0,21249,0,19841,21313,
+    0,21377,21441,21505,21569,21633,21697,21761,
+    21825,21889,21953,22017,22081,22145,22209,22273,
+    22337,22401,22465,22529,22593,22657,22721,22785,
+    22849,22913,22977,23041,23105,23169,23233,23297,
+    23361,23425,23489,23553,23617,23681,23745,23809,
+    23873,23937,24001,24065,24129,24193,24257,24321,
+    24385,24449,24513,24577,0,24641,0,24705,
+    0,24769,0,24833,0,24897,0,24961,
+    0,25025,0,25089,0,25153,0,25217,
+    0,25281,0,25345,0,25409,0,25473,
+    0,25537,0,25601,0,25665,0,0,
+    25729,0,25793,0,25857,0,25921,0,
+    25985,0,26049,0,26113,0,26177,0,
+    26241,0,26305,0,26369,0,26433,0,
+    26497,0,26561,0,26625,0,26689,0,
+    26753,0,26817,0,26881,0,26945,0,
+    27009,0,27073,0,27137,0,27201,0,
+    27265,0,27329,0,27393,0,0,27457,
+    0,27521,0,27585,0,27649,0,27713,
+    0,27777,0,27841,0,27905,0,27969,
+    0,28033,0,28097,0,28161,0,28225,
+    0,28289,0,28353,0,28417,0,28481,
+    0,28545,0,28609,0,28673,0,28737,
+    0,28801,0,28865,0,28929,0,28993,
+    0,29057,0,29121,0,29185,0,29249,
+    0,29313,0,29377,0,29441,0,29505,
+    0,29569,0,29633,0,29697,0,29761,
+    0,29825,0,29889,0,29953,0,30017,
+    0,30081,0,30145,0,30209,0,30273,
+    0,30337,0,30401,0,30465,0,30529,
+    0,30593,0,30657,0,30721,0,30785,
+    0,30849,0,30913,0,0,30977,31041,
+    31105,31169,31233,31297,31361,31425,31489,31553,
+    31617,31681,31745,31809,31873,31937,32001,32065,
+    32129,32193,32257,32321,32385,32449,32513,32577,
+    32641,32705,32769,32833,32897,32961,33025,33089,
+    33153,33217,33281,33345,0,0,33410,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,33538,33666,33794,33922,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,34050,34178,
+    34306,34434,34562,34690,34818,34946,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,35074,35202,0,35330,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,35458,
+    0,0,35586,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    35714,35842,35970,0,0,36098,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,36226,36354,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,36482,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    36610,0,0,0,0,0,0,0,
+    0,0,0,0,36738,36866,0,0,
+    0,36993,0,0,0,0,0,0,
+    0,0,0,0,0,37058,0,0,
+    0,37186,0,37314,0,37442,0,37570,
+    0,37698,0,0,0,37826,0,37954,
+    38082,38211,38402,38531,0,38722,0,0,
+    0,0,0,38850,0,0,0,38978,
+    0,39106,0,39234,0,39362,0,39490,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,39617,0,39681,0,
+    0,39745,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,39809,39873,39937,40001,40065,
+    40129,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,22721,22849,23489,23681,
+    23745,24257,24705,40193,0,40257,40321,40385,
+    40449,40513,40577,40641,40705,40769,40833,40897,
+    40961,39745,41025,41089,41153,41217,41281,41345,
+    41409,41473,41537,41601,41665,41729,41793,41857,
+    41921,41985,42049,42113,42177,42241,42305,42369,
+    42433,42497,42561,42625,42689,42753,42817,42881,
+    0,42945,43009,43073,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,1,3457,65,0,193,257,
+    9857,385,449,513,577,641,705,769,
+    833,0,897,14785,961,1089,1217,1281,
+    1409,1,43137,43201,43265,65,193,257,
+    9921,9985,43329,385,0,641,769,7617,
+    897,9537,43393,43457,961,1217,1281,43521,
+    10433,1345,43585,18945,19009,19073,20033,20097,
+    513,1089,1281,1345,18945,19009,19777,20033,
+    20097,0,23425,0,43649,129,43713,4097,
+    43329,321,43777,43841,43905,10305,10241,43969,
+    44033,44097,44161,44225,44289,44353,44417,10497,
+    44481,44545,10561,44609,44673,10945,44737,15745,
+    11201,44801,11265,15809,1601,44865,44929,11457,
+    19329,0,44993,0,45057,0,45121,0,
+    45185,0,45249,0,45313,0,45377,0,
+    45441,0,45505,0,45569,0,45633,0,
+    45697,0,45761,0,45825,0,45889,0,
+    45953,0,46017,0,46081,0,46145,0,
+    46209,0,46273,0,46337,0,46401,0,
+    46465,0,46529,0,46593,0,46657,0,
+    46721,0,46785,0,46849,0,46913,0,
+    46977,0,47041,0,47105,0,47169,0,
+    47233,0,47297,0,47361,0,47425,0,
+    47489,0,47553,0,47617,0,47681,0,
+    47745,0,47809,0,47873,0,47937,0,
+    48001,0,48065,0,48129,0,48193,0,
+    48257,0,48321,0,48385,0,48449,0,
+    48513,0,48577,0,48641,0,48705,0,
+    48769,0,48833,0,48897,0,48961,0,
+    49025,0,49089,0,49153,0,49217,0,
+    49281,0,49345,0,49409,0,49473,0,
+    49537,0,49601,0,49665,0,49729,0,
+    49794,48065,0,49921,0,49985,0,50049,
+    0,50113,0,50177,0,50241,0,50305,
+    0,50369,0,50433,0,50497,0,50561,
+    0,50625,0,50689,0,50753,0,50817,
+    0,50881,0,50945,0,51009,0,51073,
+    0,51137,0,51201,0,51265,0,51329,
+    0,51393,0,51457,0,51521,0,51585,
+    0,51649,0,51713,0,51777,0,51841,
+    0,51905,0,51969,0,52033,0,52097,
+    0,52161,0,52225,0,52289,0,52353,
+    0,52417,0,52481,0,52545,0,52609,
+    0,52673,0,52737,0,52801,0,52865,
+    0,52929,0,52993,0,53057,53121,53185,
+    53249,53313,53377,53441,53505,0,0,53569,
+    53633,53697,53761,53825,53889,0,0,53953,
+    54017,54081,54145,54209,54273,54337,54401,0,
+    54465,54529,54593,54657,54721,54785,54849,54913,
+    0,0,54977,55041,55105,55169,55233,55297,
+    0,0,0,55361,0,55425,0,55489,
+    0,55553,0,55617,55681,55745,55809,55873,
+    55937,56001,56065,0,18369,0,18497,0,
+    18561,0,18625,0,18689,0,18753,0,
+    18817,0,56130,56258,56386,56514,56642,56770,
+    56898,57026,56130,56258,56386,56514,56642,56770,
+    56898,57026,57154,57282,57410,57538,57666,57794,
+    57922,58050,57154,57282,57410,57538,57666,57794,
+    57922,58050,58178,58306,58434,58562,58690,58818,
+    58946,59074,58178,58306,58434,58562,58690,58818,
+    58946,59074,0,59202,59330,59458,0,0,
+    59586,59713,59777,59841,18369,59330,59906,17601,
+    59906,60034,60163,60354,60482,60610,0,0,
+    60738,60865,18497,60929,18561,60482,60995,61187,
+    61379,0,61569,0,0,61633,61697,61761,
+    18625,0,61827,62019,62211,0,62401,0,
+    62465,62529,62593,18753,62657,62723,18179,62913,
+    0,62978,63106,63234,0,0,63362,63489,
+    18689,63553,18817,63106,2114,63618,0,1665,
+    0,0,0,0,63745,0,63810,0,
+    0,0,0,1665,0,63938,64067,0,
+    64258,64387,0,64578,0,64706,0,64834,
+    64962,65090,0,65220,0,1665,0,0,
+    0,0,65473,513,0,65537,65601,65665,
+    65729,65793,65857,65921,65985,66049,66113,66177,
+    833,65473,2433,1985,2049,65537,65601,65665,
+    65729,65793,65857,65921,65985,66049,66113,66177,
+    0,1,257,897,1473,9921,449,641,
+    705,769,833,961,1153,1217,0,0,
+    66242,0,0,0,0,66371,66563,129,
+    66754,0,66883,67075,9985,0,67266,385,
+    449,6209,513,705,0,833,67394,0,
+    961,1025,1089,0,67522,67651,67842,0,
+    1601,0,20225,0,1601,0,641,3393,
+    65,129,0,257,321,0,769,897,
+    67969,68033,68097,68161,513,0,68227,19713,
+    19009,19713,68417,0,193,257,513,577,
+    0,68483,68675,68868,69123,69315,69507,69699,
+    69891,70083,70275,70467,70659,70851,71043,71235,
+    71426,513,71554,71683,71874,1345,72002,72131,
+    72324,72578,1473,72706,72835,705,129,193,
+    769,513,71554,71683,71874,1345,72002,72131,
+    72324,72578,1473,72706,72835,705,129,193,
+    769,0,0,0,73027,0,0,0,
+    73218,73347,0,73538,73667,0,73857,73921,
+    0,0,0,0,2433,1985,2049,65537,
+    65601,65665,65729,65793,65857,73986,74114,74242,
+    74370,74498,74626,74754,74882,75010,75138,75266,
+    75395,75587,75779,75971,76163,76355,76547,76739,
+    76931,77124,77380,77636,77892,78148,78404,78660,
+    78916,79172,79428,79684,0,79939,80131,80323,
+    80515,80707,80899,81091,81283,81475,81667,81859,
+    82051,82243,82435,82627,82819,83011,83203,83395,
+    83587,83779,83971,84163,84355,84547,84739,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,65473,0,84932,0,85187,
+    85378,85507,0,85698,0,0,0,0,
+    0,85825,85889,85953,86017,86081,86145,86209,
+    86273,86337,86401,86465,86529,86593,86657,86721,
+    86785,86849,86913,86977,87041,87105,87169,87233,
+    87297,87361,87425,87489,87553,87617,87681,87745,
+    87809,87873,87937,88001,88065,88129,88193,88257,
+    88321,88385,88449,88513,88577,88641,88705,88769,
+    88833,0,88897,0,88961,89025,89089,0,
+    89153,0,89217,0,89281,0,43201,44353,
+    43137,43649,0,89345,0,89409,0,577,
+    1345,89473,89537,89601,0,89665,0,89729,
+    0,89793,0,89857,0,89921,0,89985,
+    0,90049,0,90113,0,90177,0,90241,
+    0,90305,0,90369,0,90433,0,90497,
+    0,90561,0,90625,0,90689,0,90753,
+    0,90817,0,90881,0,90945,0,91009,
+    0,91073,0,91137,0,91201,0,91265,
+    0,91329,0,91393,0,91457,0,91521,
+    0,91585,0,91649,0,91713,0,91777,
+    0,91841,0,91905,0,91969,0,92033,
+    0,92097,0,92161,0,92225,0,92289,
+    0,92353,0,92417,0,92481,0,92545,
+    0,92609,0,92673,0,92737,0,92801,
+    0,92865,0,0,92929,0,0,0,
+    0,0,0,0,0,0,0,92993,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,93057,0,93121,0,93185,
+    93249,93313,93377,93441,93505,93569,93633,93697,
+    93761,93825,93889,93953,94017,94081,94145,94209,
+    94273,94337,94401,94465,94529,94593,94657,94721,
+    94785,94849,94913,94977,95041,95105,95169,95233,
+    95297,95361,95425,95489,95553,95617,95681,95745,
+    95809,95873,95937,96001,96065,96129,96193,96257,
+    96321,96385,96449,96513,96577,96641,96705,96769,
+    96833,96897,96961,97025,97089,97153,97217,97281,
+    97345,97409,97473,97537,97601,97665,97729,97793,
+    97857,97921,97985,98049,98113,98177,98241,98305,
+    98369,98433,98497,98561,98625,98689,98753,98817,
+    98881,98945,99009,99073,99137,99201,99265,99329,
+    99393,99457,99521,99585,99649,99713,99777,99841,
+    99905,99969,100033,100097,100161,100225,100289,100353,
+    100417,100481,100545,100609,100673,100737,100801,100865,
+    100929,100993,101057,101121,101185,101249,101313,101377,
+    101441,101505,101569,101633,101697,101761,101825,101889,
+    101953,102017,102081,102145,102209,102273,102337,102401,
+    102465,102529,102593,102657,102721,102785,102849,102913,
+    102977,103041,103105,103169,103233,103297,103361,103425,
+    103489,103553,103617,103681,103745,103809,103873,103937,
+    104001,104065,104129,104193,104257,104321,104385,104449,
+    104513,104577,104641,104705,104769,104833,104897,104961,
+    105025,105089,105153,105217,105281,105345,105409,105473,
+    105537,105601,105665,105729,105793,105857,105921,105985,
+    106049,106113,106177,106241,106305,106369,106433,106497,
+    106561,106625,106689,106753,106817,0,1665,0,
+    106881,0,0,0,106945,0,94657,107009,
+    107073,0,0,0,0,0,107138,107266,
+    0,107394,0,107522,0,0,0,107649,
+    107713,107777,107841,107905,107969,108033,108097,108161,
+    108225,108289,108353,108417,108481,108545,108609,108673,
+    108737,108801,108865,108929,108993,109057,109121,109185,
+    109249,109313,109377,109441,109505,109569,109633,109697,
+    109761,109825,109889,109953,110017,110081,110145,110209,
+    110273,110337,110401,110465,110529,110593,110657,110721,
+    110785,110849,0,110913,110977,111041,111105,111169,
+    111233,111297,111361,111425,111489,111553,111617,111681,
+    111745,111809,111873,111937,112001,112065,112129,112193,
+    112257,112321,112385,112449,112513,112577,112641,112705,
+    112769,112833,112897,112961,113025,113089,113153,113217,
+    113281,113345,113409,113473,113537,0,0,93185,
+    93569,113601,113665,113729,113793,113857,113921,93441,
+    113985,114049,114113,114177,93697,0,0,0,
+    114243,114435,114627,114819,115011,115203,115395,115587,
+    115779,115971,116163,116355,116547,116739,116931,117123,
+    117315,117507,117699,117891,118083,118275,118467,118659,
+    118851,119043,119235,119427,119619,119812,120068,0,
+    120323,120515,120707,120899,121091,121283,121475,121667,
+    121859,122051,122243,122435,122627,122819,123011,123203,
+    123395,123587,123779,123971,124163,124355,124547,124739,
+    124931,125123,125315,125507,125699,125891,126083,126275,
+    126467,126659,126851,127043,127233,127297,97409,127361,
+    0,127427,127618,127746,127874,128002,128130,128258,
+    128386,128514,128642,128770,128898,129026,129154,129282,
+    129410,107649,107841,108033,108161,108673,108737,108929,
+    109057,109121,109249,109313,109377,109441,109505,129537,
+    129601,129665,129729,129793,129857,129921,129985,130049,
+    130113,130177,130241,130305,130369,130434,130562,130689,
+    0,93185,93569,113601,113665,130753,130817,130881,
+    93889,130945,94657,97857,98625,98561,97921,103809,
+    95169,97729,131009,131073,131137,131201,131265,131329,
+    131393,131457,131521,131585,95553,131649,131713,131777,
+    131841,131905,131969,132033,132097,113729,113793,113857,
+    132161,132225,132289,132353,132417,132481,132545,132609,
+    132673,132737,132802,132930,133058,133186,133314,133442,
+    133570,133698,133826,133954,134082,134210,134338,134466,
+    134594,134722,134850,134978,135106,135234,135362,135490,
+    135618,135746,135875,136067,136259,136450,136579,136770,
+    136899,137089,137153,137217,137281,137345,137409,137473,
+    137537,137601,137665,137729,137793,137857,137921,137985,
+    138049,138113,138177,138241,138305,138369,138433,138497,
+    138561,138625,138689,138753,138817,138881,138945,139009,
+    139073,139137,139201,139265,139329,139393,139457,139521,
+    139585,139649,139713,139777,139841,139905,139969,140033,
+    140098,140228,140484,140740,140995,141188,141443,141635,
+    141829,142148,142403,142595,142787,142980,143236,143491,
+    143683,143874,144003,144196,144452,144706,144837,145158,
+    145541,145859,146053,146373,146692,146947,147139,147331,
+    147524,147781,148100,148355,148547,148739,148930,149058,
+    149186,149314,149443,149635,149829,150147,150340,150597,
+    150915,151106,151234,151365,151684,151941,152259,152453,
+    152770,152899,153091,153283,153475,153667,153860,154115,
+    154306,154435,154627,154819,155012,155267,155459,155651,
+    155845,156164,156418,156549,156866,156996,157252,157507,
+    157699,157891,158084,158338,158467,158660,158914,159045,
+    159363,159554,159682,159810,159938,160066,160194,160322,
+    160450,160578,160706,160835,161027,161219,161411,161603,
+    161795,161987,162179,162371,162563,162755,162947,163139,
+    163331,163523,163715,163906,164034,164163,164354,164482,
+    164610,164739,164931,165122,165250,165378,165506,165634,
+    165764,166018,166146,166274,166402,166530,166658,166786,
+    166914,167043,167236,167490,167618,167746,167874,168002,
+    168130,168258,168387,168579,168771,168963,169154,169282,
+    169410,169538,169666,169794,169922,170050,170178,170306,
+    170435,170627,170818,170947,171139,171331,171522,171651,
+    171843,172036,166018,172291,172483,172675,172867,173061,
+    173382,173762,173890,174018,174146,174274,174402,174530,
+    174658,174786,174658,174914,175042,175170,175298,175426,
+    175298,175554,175682,0,175810,175938,176066,176196,
+    0,176450,176578,176706,176834,176962,177090,170306,
+    177218,177346,177474,177603,177794,166786,177923,178115,
+    178306,0,178435,178626,178754,178882,179010,179139,
+    179331,179522,179650,179778,179906,180034,180162,180290,
+    180418,180546,180675,180867,181059,181251,181443,181635,
+    181827,182019,182211,182403,182595,182787,182979,183171,
+    183363,183555,183747,183939,184131,184323,184515,184707,
+    184899,0,0,0,0,0,0,185089,
+    0,185153,0,185217,0,185281,0,185345,
+    0,40193,0,185409,0,185473,0,185537,
+    0,185601,0,185665,0,185729,0,185793,
+    0,185857,0,185921,0,185985,0,186049,
+    0,186113,0,186177,0,186241,0,186305,
+    0,186369,0,186433,0,0,0,0,
+    0,186497,0,186561,0,186625,0,186689,
+    0,186753,0,186817,0,186881,0,186945,
+    0,187009,0,187073,0,187137,0,187201,
+    0,187265,0,187329,0,24257,24385,0,
+    0,0,0,0,0,187393,0,187457,
+    0,187521,0,187585,0,187649,0,187713,
+    0,187777,0,187841,0,187905,0,187969,
+    0,188033,0,188097,0,188161,0,188225,
+    0,188289,0,188353,0,188417,0,188481,
+    0,188545,0,188609,0,188673,0,188737,
+    0,188801,0,188865,0,188929,0,188993,
+    0,189057,0,189121,0,189185,0,189249,
+    0,189313,0,189377,0,189441,0,189505,
+    0,189569,0,189633,0,189697,0,189761,
+    0,189761,0,189825,0,189889,0,189953,
+    190017,0,190081,0,190145,0,190209,0,
+    190273,0,190337,0,43905,0,190401,0,
+    190465,0,190529,0,190593,0,190657,0,
+    190721,0,190785,0,190849,0,190913,0,
+    190977,0,191041,0,191105,0,16193,43329,
+    43841,191169,43969,0,191233,191297,44097,191361,
+    191425,0,191489,0,191553,0,191617,0,
+    191681,0,191745,0,191809,0,191873,0,
+    191937,44673,192001,192065,0,192129,0,0,
+    192193,0,0,0,0,0,192257,0,
+    192321,0,0,129,321,1025,192385,0,
+    6209,7873,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,187521,192449,88961,192513,
+    0,192577,0,0,192641,192705,192769,192833,
+    192897,192961,193025,193089,193153,193217,193281,193345,
+    193409,193473,193537,193601,193665,193729,193793,193857,
+    193921,193985,194049,194113,194177,194241,194305,194369,
+    194433,194497,194561,194625,194689,194753,194817,194881,
+    194945,195009,195073,195137,195201,195265,195329,195393,
+    195457,195521,195585,195649,195713,195777,195841,195905,
+    195969,196033,196097,196161,196225,196289,196353,196417,
+    196481,196545,196609,196673,196737,196801,196865,196929,
+    196993,197057,197121,197185,197249,197313,197377,197441,
+    197505,197569,197633,197697,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,197761,197825,103297,197889,197953,198017,198081,
+    106753,198145,103809,198209,198273,198337,198401,198465,
+    198529,198593,198657,198721,198785,198849,198913,198977,
+    199041,199105,199169,199233,199297,199361,199425,199489,
+    199553,199617,199681,199745,199809,199873,199937,200001,
+    200065,200129,200193,200257,200321,200385,200449,200513,
+    200577,200641,200705,200769,101121,200833,200897,200961,
+    201025,201089,201153,201217,201281,201345,201409,201473,
+    105793,201537,201601,201665,201729,201793,201857,201921,
+    201985,202049,202113,202177,202241,202305,202369,202433,
+    202497,202561,202625,202689,202753,202817,202881,202945,
+    203009,203073,203137,203201,198785,203265,203329,203393,
+    203457,203521,203585,203649,203713,203777,203841,203905,
+    203969,204033,204097,204161,204225,204289,204353,204417,
+    204481,103425,204545,204609,204673,204737,204801,204865,
+    204929,204993,205057,205121,205185,205249,205313,205377,
+    205441,95553,205505,205569,205633,205697,205761,205825,
+    205889,205953,94337,206017,206081,206145,206209,206273,
+    206337,206401,206465,206529,206593,206657,206721,206785,
+    206849,206913,206977,207041,207105,207169,207233,207297,
+    207361,204417,207425,207489,207553,207617,207681,207745,
+    207809,207873,203393,207937,208001,208065,208129,208193,
+    208257,208321,208385,208449,208513,208577,208641,208705,
+    208769,208833,208897,208961,209025,209089,209153,198785,
+    209217,209281,209345,209409,106689,209473,209537,209601,
+    209665,209729,209793,209857,209921,209985,210049,210113,
+    210177,130817,210241,210305,210369,210433,210497,210561,
+    210625,210689,210753,203521,210817,210881,210945,211009,
+    211073,211137,211201,211265,211329,211393,211457,211521,
+    211585,103745,211649,211713,211777,211841,211905,211969,
+    212033,212097,212161,212225,212289,212353,212417,100609,
+    212481,212545,212609,212673,212737,212801,212865,212929,
+    212993,213057,213121,213185,213249,213313,213377,213441,
+    102337,213505,102529,213569,213633,213697,0,213761,
+    0,213825,0,213889,213953,214017,214081,214145,
+    214209,214273,214337,214401,101057,0,214465,0,
+    214529,0,214593,214657,0,214721,214785,214849,
+    214913,214977,215041,215105,215169,215233,215297,215361,
+    215425,215489,215553,215617,215681,215745,215809,96001,
+    215873,215937,216001,216065,216129,216193,216257,216321,
+    216385,216449,216513,216577,216641,216705,216769,131137,
+    216833,216897,216961,217025,131393,217089,217153,217217,
+    217281,217345,206721,217409,217473,217537,217601,217665,
+    217729,217793,217857,217921,217985,218049,218113,218177,
+    218241,214593,218305,218369,218433,218497,218561,218625,
+    0,218689,218753,218817,218881,218945,219009,219073,
+    219137,215489,219201,219265,219329,213761,219393,219457,
+    219521,219585,219649,219713,219777,219841,219905,219969,
+    220033,220097,216001,220161,216065,220225,220289,220353,
+    220417,220481,213825,200129,220545,220609,98113,204481,
+    209793,220673,220737,216513,220801,216577,220865,220929,
+    220993,213953,221057,221121,221185,221249,221313,214017,
+    221377,221441,221505,221569,221633,221697,217345,221761,
+    221825,206721,221889,217601,221953,222017,222081,222145,
+    222209,217921,222273,214529,222337,217985,203265,222401,
+    218049,222465,218177,222529,222593,222657,222721,222785,
+    218305,214337,222849,218369,222913,218433,222977,106753,
+    223041,223105,223169,223233,223297,223361,223425,223489,
+    223553,223617,223681,0,223746,223874,224002,224131,
+    224323,224514,0,224642,224770,224898,225026,225154,
+    0,225282,0,225410,225537,67969,68161,225601,
+    225665,225729,225793,225857,225921,65921,225986,226114,
+    226243,226435,226626,226754,226882,227010,227138,227266,
+    227394,227522,227650,0,227778,227906,228034,228162,
+    228290,0,228418,0,228546,228674,0,228802,
+    228930,0,229058,229186,229314,229442,229570,229698,
+    229826,229954,230082,230210,230337,230401,230465,230529,
+    230593,230657,230721,230785,230849,230913,230977,231041,
+    231105,231169,231233,231297,231361,231425,231489,231553,
+    231617,231681,231745,231809,231873,231937,232001,232065,
+    232129,232193,0,0,232257,232321,232385,232449,
+    33794,232513,232577,232641,232705,232769,232834,232962,
+    233090,233218,233346,233474,233602,233730,233857,233922,
+    234050,234178,233730,234306,234434,234562,234690,234818,
+    234946,235074,235202,235330,235458,235586,235714,235842,
+    235970,236098,236226,236354,236482,236610,236738,236866,
+    236994,237122,237250,237378,237506,237634,237762,237890,
+    238018,238146,238274,238402,238530,238658,238786,238914,
+    239042,239170,239298,239426,239554,239682,239810,239938,
+    240066,240194,240322,240450,240578,240706,240834,240962,
+    241090,241218,241346,241474,241602,241730,241858,241986,
+    242114,242242,242370,242498,242626,242754,242882,243010,
+    243138,243266,243394,243522,243650,243778,243906,244034,
+    244162,244290,244418,244546,244674,244802,244930,245058,
+    245186,245314,245442,245570,245698,245827,246019,246211,
+    246403,246595,246787,246978,247106,234178,247234,233730,
+    234306,247362,247490,234818,247618,234946,235074,247746,
+    247874,235586,248002,235714,235842,248130,248258,236098,
+    248386,236226,236354,240066,240194,240578,240706,240834,
+    241346,241474,241602,241730,242242,242370,242498,248514,
+    243010,248642,248770,243778,248898,243906,244034,245698,
+    249026,249154,245058,249282,245186,245314,233922,234050,
+    249410,234178,249538,234434,234562,234690,234818,249666,
+    235202,235330,235458,235586,249794,236098,236482,236610,
+    236738,236866,236994,237250,237378,237506,237634,237762,
+    237890,249922,238018,238146,238274,238402,238530,238658,
+    238914,239042,239170,239298,239426,239554,239682,239810,
+    239938,240322,240450,240962,241090,241218,241346,241474,
+    241858,241986,242114,242242,250050,242626,242754,242882,
+    243010,243394,243522,243650,243778,250178,244162,244290,
+    250306,244674,244802,244930,245058,250434,234178,249538,
+    234818,249666,235586,249794,236098,250562,237762,250690,
+    250818,250946,241346,241474,242242,243778,250178,245058,
+    250434,251075,251267,251459,251650,251778,251906,252034,
+    252162,252290,252418,252546,252674,252802,252930,253058,
+    253186,253314,253442,253570,253698,253826,253954,254082,
+    254210,254338,254466,250818,254594,254722,254850,254978,
+    251650,251778,251906,252034,252162,252290,252418,252546,
+    252674,252802,252930,253058,253186,253314,253442,253570,
+    253698,253826,253954,254082,254210,254338,254466,250818,
+    254594,254722,254850,254978,254210,254338,254466,250818,
+    250690,250946,238786,237378,237506,237634,254210,254338,
+    254466,238786,238914,255106,0,255235,255427,255619,
+    255811,256003,256195,256387,256579,256771,256963,257155,
+    257347,257539,257731,257923,258115,258307,258499,258691,
+    258883,259075,259267,259459,259651,259843,260035,260227,
+    260419,260611,260803,260995,261187,261379,261571,261763,
+    261955,262147,262339,262531,262723,262915,263107,263299,
+    263491,263683,263875,264067,264259,264451,0,264643,
+    264835,265027,265219,265411,265603,265795,265987,266179,
+    266371,266563,266755,266947,267139,267331,267523,267715,
+    267907,268099,268291,268483,268675,268867,269059,269251,
+    269443,269635,269827,270019,270211,270403,270595,261763,
+    262147,270787,270979,271171,271363,271555,271747,271555,
+    271171,271939,272131,272323,272515,272707,271747,260419,
+    258499,272899,273091,0,0,0,273283,273475,
+    273668,273924,274180,274436,274692,274948,275204,275459,
+    275666,276808,277316,0,0,277569,277633,0,
+    277697,18049,277761,277825,277889,277953,0,0,
+    0,278017,278081,278145,66113,66177,278209,278273,
+    278337,278401,278465,278529,278593,278657,73857,73921,
+    278721,278785,278849,278913,0,278977,279041,64706,
+    278145,277569,277633,0,18049,277697,277825,277761,
+    278017,66113,66177,278209,278273,278337,278401,279105,
+    279169,279233,65921,279297,279361,279425,66049,0,
+    279489,279553,279617,279681,0,279746,279874,280002,
+    0,280130,0,280258,280386,280514,280642,280770,
+    280898,281026,281154,281282,281410,281537,281601,281665,
+    281729,281793,281857,281921,281985,282049,282113,282177,
+    282241,282305,282369,282433,282497,282561,282625,282689,
+    282753,282817,282881,282945,283009,283073,283137,283201,
+    283265,283329,283393,283457,283521,283585,283649,232769,
+    283713,283778,283906,284034,284162,0,0,0,
+    277761,284289,279105,279553,279617,279169,284353,66113,
+    66177,279233,65921,277569,279297,106881,284417,65473,
+    2433,1985,2049,65537,65601,65665,65729,65793,
+    65857,277697,18049,279361,66049,279425,277825,279681,
+    1,65,129,193,257,321,385,449,
+    513,577,641,705,769,833,897,961,
+    1025,1089,1153,1217,1281,1345,1409,1473,
+    1537,1601,278977,279489,279041,284481,278145,62913,
+    1,65,129,193,257,321,385,449,
+    513,577,641,705,769,833,897,961,
+    1025,1089,1153,1217,1281,1345,1409,1473,
+    1537,1601,278209,284545,278273,284609,284673,284737,
+    106881,278721,278785,277633,284801,140033,284865,284929,
+    284993,285057,285121,285185,285249,285313,285377,285441,
+    137089,137153,137217,137281,137345,137409,137473,137537,
+    137601,137665,137729,137793,137857,137921,137985,138049,
+    138113,138177,138241,138305,138369,138433,138497,138561,
+    138625,138689,138753,138817,138881,138945,139009,139073,
+    139137,139201,139265,139329,139393,139457,139521,139585,
+    139649,139713,139777,139841,285505,285569,285633,0,
+    107649,107713,107777,107841,107905,107969,108033,108097,
+    108161,108225,108289,108353,108417,108481,108545,108609,
+    108673,108737,108801,108865,108929,108993,109057,109121,
+    109185,109249,109313,109377,109441,109505,0,109569,
+    109633,109697,109761,109825,109889,0,109953,110017,
+    110081,110145,110209,110273,0,110337,110401,110465,
+    110529,110593,110657,0,110721,110785,110849,0,
+    285697,285761,285825,1858,285889,285953,286017,0,
+    286081,286145,286209,286273,286337,286401,286465,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,286529,
+    286593,286657,286721,286785,286849,286913,286977,287041,
+    287105,287169,287233,287297,287361,287425,287489,287553,
+    287617,287681,287745,287809,287873,287937,288001,288065,
+    288129,288193,288257,288321,288385,288449,288513,288577,
+    288641,288705,288769,288833,288897,288961,289025,0,
+    0,0,0,289089,289153,289217,289281,289345,
+    289409,289473,289537,289601,289665,289729,289793,289857,
+    289921,289985,290049,290113,290177,290241,290305,290369,
+    290433,290497,290561,290625,290689,290753,290817,290881,
+    290945,291009,291073,291137,291201,291265,291329,0,
+    0,0,0,0,0,0,0,291393,
+    291457,291521,291585,291649,291713,291777,291841,291905,
+    291969,292033,0,292097,292161,292225,292289,292353,
+    292417,292481,292545,292609,292673,292737,292801,292865,
+    292929,292993,0,293057,293121,293185,293249,293313,
+    293377,293441,0,293505,293569,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,293633,293697,3457,
+    293761,9345,0,293825,293889,293953,294017,9665,
+    9729,294081,294145,294209,294273,294337,294401,10113,
+    294465,6209,294529,294593,294657,294721,294785,191169,
+    294849,294913,294977,295041,295105,295169,4545,295233,
+    295297,1025,295361,295425,89089,295489,10817,295553,
+    295617,295681,295745,11073,295809,0,295873,295937,
+    296001,296065,296129,296193,296257,296321,296385,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,296449,296513,
+    296577,296641,296705,296769,296833,296897,296961,297025,
+    297089,297153,297217,297281,297345,297409,297473,297537,
+    297601,297665,297729,297793,297857,297921,297985,298049,
+    298113,298177,298241,298305,298369,298433,298497,298561,
+    298625,298689,298753,298817,298881,298945,299009,299073,
+    299137,299201,299265,299329,299393,299457,299521,299585,
+    299649,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,299713,299777,299841,
+    299905,299969,300033,300097,300161,300225,300289,300353,
+    300417,300481,300545,300609,300673,300737,300801,300865,
+    300929,300993,301057,301121,301185,301249,301313,301377,
+    301441,301505,301569,301633,301697,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    301761,301825,301889,301953,302017,302081,302145,302209,
+    302273,302337,302401,302465,302529,302593,302657,302721,
+    302785,302849,302913,302977,303041,303105,303169,303233,
+    303297,303361,303425,303489,303553,303617,303681,303745,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    303810,303938,304067,304259,304451,304643,304835,0,
+    0,0,0,0,0,0,0,0,
+    0,305026,305154,305283,305475,305667,305859,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,65,129,
+    193,257,321,385,449,513,577,641,
+    705,769,833,897,961,1025,1089,1153,
+    1217,1281,1345,1409,1473,1537,1601,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,1,65,129,193,257,
+    321,385,0,513,577,641,705,769,
+    833,897,961,1025,1089,1153,1217,1281,
+    1345,1409,1473,1537,1601,1,65,129,
+    193,257,321,385,449,513,577,641,
+    705,769,833,897,961,1025,1089,1153,
+    1217,1281,1345,1409,1473,1537,1601,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,0,129,193,0,385,0,
+    577,641,0,833,897,961,1025,0,
+    1153,1217,1281,1345,1409,1473,1537,1601,
+    1,65,129,193,0,321,0,449,
+    513,577,641,705,769,833,0,961,
+    1025,1089,1153,1217,1281,1345,1409,1473,
+    1537,1601,1,65,129,193,257,321,
+    385,449,513,577,641,705,769,833,
+    897,961,1025,1089,1153,1217,1281,1345,
+    1409,1473,1537,1601,1,65,129,193,
+    257,321,385,449,513,577,641,705,
+    769,833,897,961,1025,1089,1153,1217,
+    1281,1345,1409,1473,1537,1601,1,65,
+    0,193,257,321,385,0,577,641,
+    705,769,833,897,961,1025,0,1153,
+    1217,1281,1345,1409,1473,1537,0,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,0,193,257,321,385,
+    0,513,577,641,705,769,0,897,
+    0,1153,1217,1281,1345,1409,1473,1537,
+    0,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,1,65,129,193,257,
+    321,385,449,513,577,641,705,769,
+    833,897,961,1025,1089,1153,1217,1281,
+    1345,1409,1473,1537,1601,1,65,129,
+    193,257,321,385,449,513,577,641,
+    705,769,833,897,961,1025,1089,1153,
+    1217,1281,1345,1409,1473,1537,1601,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,1,65,129,193,257,
+    321,385,449,513,577,641,705,769,
+    833,897,961,1025,1089,1153,1217,1281,
+    1345,1409,1473,1537,1601,1,65,129,
+    193,257,321,385,449,513,577,641,
+    705,769,833,897,961,1025,1089,1153,
+    1217,1281,1345,1409,1473,1537,1601,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,1,65,129,193,257,
+    321,385,449,513,577,641,705,769,
+    833,897,961,1025,1089,1153,1217,1281,
+    1345,1409,1473,1537,1601,1,65,129,
+    193,257,321,385,449,513,577,641,
+    705,769,833,897,961,1025,1089,1153,
+    1217,1281,1345,1409,1473,1537,1601,1,
+    65,129,193,257,321,385,449,513,
+    577,641,705,769,833,897,961,1025,
+    1089,1153,1217,1281,1345,1409,1473,1537,
+    1601,1,65,129,193,257,321,385,
+    449,513,577,641,705,769,833,897,
+    961,1025,1089,1153,1217,1281,1345,1409,
+    1473,1537,1601,306049,306113,0,18881,18945,
+    19009,19073,19137,19201,19265,19329,17601,19393,
+    19457,2241,19521,19585,19649,19713,19777,19329,
+    19841,19905,19969,20033,20097,20161,20225,306177,
+    18881,18945,19009,19073,19137,19201,19265,19329,
+    17601,19393,19457,2241,19521,19585,19649,19713,
+    19777,19841,19905,19969,20033,20097,20161,20225,
+    306241,19137,19329,19393,20033,19777,19713,18881,
+    18945,19009,19073,19137,19201,19265,19329,17601,
+    19393,19457,2241,19521,19585,19649,19713,19777,
+    19329,19841,19905,19969,20033,20097,20161,20225,
+    306177,18881,18945,19009,19073,19137,19201,19265,
+    19329,17601,19393,19457,2241,19521,19585,19649,
+    19713,19777,19841,19905,19969,20033,20097,20161,
+    20225,306241,19137,19329,19393,20033,19777,19713,
+    18881,18945,19009,19073,19137,19201,19265,19329,
+    17601,19393,19457,2241,19521,19585,19649,19713,
+    19777,19329,19841,19905,19969,20033,20097,20161,
+    20225,306177,18881,18945,19009,19073,19137,19201,
+    19265,19329,17601,19393,19457,2241,19521,19585,
+    19649,19713,19777,19841,19905,19969,20033,20097,
+    20161,20225,306241,19137,19329,19393,20033,19777,
+    19713,18881,18945,19009,19073,19137,19201,19265,
+    19329,17601,19393,19457,2241,19521,19585,19649,
+    19713,19777,19329,19841,19905,19969,20033,20097,
+    20161,20225,306177,18881,18945,19009,19073,19137,
+    19201,19265,19329,17601,19393,19457,2241,19521,
+    19585,19649,19713,19777,19841,19905,19969,20033,
+    20097,20161,20225,306241,19137,19329,19393,20033,
+    19777,19713,18881,18945,19009,19073,19137,19201,
+    19265,19329,17601,19393,19457,2241,19521,19585,
+    19649,19713,19777,19329,19841,19905,19969,20033,
+    20097,20161,20225,306177,18881,18945,19009,19073,
+    19137,19201,19265,19329,17601,19393,19457,2241,
+    19521,19585,19649,19713,19777,19841,19905,19969,
+    20033,20097,20161,20225,306241,19137,19329,19393,
+    20033,19777,19713,20609,0,65473,2433,1985,
+    2049,65537,65601,65665,65729,65793,65857,65473,
+    2433,1985,2049,65537,65601,65665,65729,65793,
+    65857,65473,2433,1985,2049,65537,65601,65665,
+    65729,65793,65857,65473,2433,1985,2049,65537,
+    65601,65665,65729,65793,65857,65473,2433,1985,
+    2049,65537,65601,65665,65729,65793,65857,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,22593,22657,22721,22785,22849,
+    22913,22977,23041,23105,23233,23297,23361,23489,
+    23553,23617,23681,23745,23809,23873,23937,24001,
+    24065,24129,24321,24449,24513,186753,28161,21953,
+    22081,28673,26881,306305,22593,22657,22721,22785,
+    22849,22913,22977,23041,23105,23233,23297,23489,
+    23553,23681,23809,23873,23937,24001,24065,24129,
+    24257,24321,25921,21953,21889,22529,26753,185537,
+    26945,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,306369,
+    306433,306497,306561,306625,306689,306753,306817,306881,
+    306945,307009,307073,307137,307201,307265,307329,307393,
+    307457,307521,307585,307649,307713,307777,307841,307905,
+    307969,308033,308097,308161,308225,308289,308353,308417,
+    308481,0,0,0,0,0,0,0,
+    0,0,0,0,0,281921,281985,282241,
+    282433,0,283649,282625,282305,282945,283713,283329,
+    283393,283457,283521,282689,283073,283201,282817,283265,
+    282561,282753,282113,282177,282369,282497,282881,283009,
+    283137,308545,231809,308609,308673,0,281985,282241,
+    0,283585,0,282305,0,283713,283329,283393,
+    283457,283521,282689,283073,283201,282817,283265,0,
+    282753,282113,282177,282369,0,282881,0,283137,
+    0,282241,0,282305,0,283713,0,283393,
+    0,283521,282689,283073,0,282817,283265,0,
+    282753,0,282369,0,282881,0,283137,0,
+    231809,0,308673,0,281985,282241,0,283585,
+    0,282305,282945,283713,283329,0,283457,283521,
+    282689,283073,283201,282817,283265,0,282753,282113,
+    282177,282369,0,282881,283009,283137,308545,0,
+    308609,0,281921,281985,282241,282433,283585,283649,
+    282625,282305,282945,283713,0,283393,283457,283521,
+    282689,283073,283201,282817,283265,282561,282753,282113,
+    282177,282369,282497,282881,283009,283137,0,281985,
+    282241,282433,0,283649,282625,282305,282945,283713,
+    0,283393,283457,283521,282689,283073,283201,282817,
+    283265,282561,282753,282113,282177,282369,282497,282881,
+    283009,283137,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,308738,308866,308994,309122,309250,309378,309506,
+    309634,309762,309890,0,79939,80131,80323,80515,
+    80707,80899,81091,81283,81475,81667,81859,82051,
+    82243,82435,82627,82819,83011,83203,83395,83587,
+    83779,83971,84163,84355,84547,84739,310019,129,
+    1089,176066,310210,0,1,65,129,193,
+    257,321,385,449,513,577,641,705,
+    769,833,897,961,1025,1089,1153,1217,
+    1281,1345,1409,1473,1537,1601,310338,174658,
+    310466,310594,310723,310914,0,311042,311170,311298,
+    0,311426,0,0,0,311554,311682,137729,
+    0,97217,311809,311873,311937,93569,312001,312065,
+    114113,312129,312193,312257,209153,312321,312385,312449,
+    312513,312577,312641,99521,312705,312769,312833,312897,
+    312961,313025,93185,113601,313089,132161,113793,132225,
+    313153,103105,313217,313281,313345,313409,313473,131073,
+    97857,313537,313601,313665,313729,0,313795,313987,
+    314179,314371,314563,314755,314947,315139,315331,0,
+    315521,315585,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,65473,2433,1985,
+    2049,65537,65601,65665,65729,65793,65857,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,315649,315713,315777,315841,
+    315905,215105,315969,316033,316097,316161,215169,316225,
+    316289,316353,215233,316417,316481,316545,316609,316673,
+    316737,312449,316801,316865,316929,316993,317057,218753,
+    317121,94209,317185,317249,317313,317377,313601,317441,
+    317505,219073,215297,215361,219137,317569,317633,203649,
+    317697,215425,317761,317825,317889,317953,318017,318081,
+    318145,318209,318273,318337,318401,318465,318529,318593,
+    318657,318721,318785,318849,318913,318977,319041,319105,
+    219265,319169,319233,319297,319361,215553,319425,319489,
+    319553,212993,319617,319681,319745,319809,319873,319937,
+    320001,320065,320129,320193,320257,320321,312001,320385,
+    320449,320513,320577,320641,320705,320769,320833,320897,
+    320961,0,321025,321089,321153,321217,321281,203393,
+    321345,321409,321473,321537,0,95873,321601,321665,
+    96001,321729,321793,321857,321921,321985,322049,322113,
+    322177,322241,322305,322369,322433,322497,322561,322625,
+    322689,322753,322817,322881,322945,323009,200065,323073,
+    96641,323137,323201,323265,323329,323393,323457,323521,
+    323585,323649,323713,323777,323841,323905,323969,324033,
+    324097,215873,324161,324225,324289,324353,220033,324353,
+    324417,216001,324481,324545,324609,324673,216065,198337,
+    324737,324801,324865,324929,324993,325057,325121,325185,
+    325249,325313,325377,325441,325505,325569,325633,325697,
+    325761,325825,325889,325953,326017,326081,216129,326145,
+    326209,326273,326337,326401,326465,216257,326529,326593,
+    326657,326721,326785,326849,326913,326977,200129,220545,
+    327041,327105,327169,327233,327297,327361,327425,327489,
+    216321,327553,327617,327681,327745,223233,327809,327873,
+    327937,328001,328065,328129,328193,328257,328321,328385,
+    328449,328513,328577,204481,328641,328705,328769,328833,
+    328897,328961,329025,329089,329153,329217,329281,216385,
+    209793,329345,329409,329473,329537,329601,329665,329729,
+    329793,220737,329857,329921,329985,330049,330113,330177,
+    330241,330305,220801,330369,330433,330497,330561,330625,
+    330689,330753,330817,330881,330945,0,331009,220929,
+    331073,331137,331201,331265,331329,331393,331457,331521,
+    331585,331649,331713,331777,331841,221057,331905,331969,
+    332033,332097,332161,332225,332289,203585,332353,332417,
+    332481,332545,332609,332673,332737,221441,332801,332865,
+    332929,332993,333057,333121,221505,223361,333185,333249,
+    333313,333377,333441,201217,221633,333505,333569,217025,
+    333633,333697,214273,333761,333825,217217,333889,333953,
+    334017,334081,0,334145,334209,334273,334337,334401,
+    334465,334529,334593,334657,334721,334785,334849,334913,
+    334977,335041,335105,335169,335233,335297,335361,335425,
+    335489,335553,335617,335681,335745,217601,335809,335873,
+    335937,336001,336065,336129,336193,336257,336321,336385,
+    336449,336513,336577,336641,336705,336769,323201,336833,
+    336897,336961,337025,337089,337153,337217,337281,337345,
+    337409,337473,337537,204673,337601,337665,337729,337793,
+    337857,337921,217793,337985,338049,338113,338177,338241,
+    338305,338369,338433,338497,338561,338625,338689,338753,
+    338817,338881,338945,339009,339073,339137,339201,200897,
+    339265,339329,339393,339457,339521,339585,222081,339649,
+    339713,339777,0,339841,339905,339969,340033,102401,
+    340097,340161,340225,340289,340353,340417,340481,340545,
+    340609,340673,340737,222401,222465,102849,340801,340865,
+    340929,340993,341057,341121,341185,341249,341313,341377,
+    341441,341505,222529,341569,341633,341697,341761,341825,
+    341889,341953,342017,342081,342145,342209,342273,342337,
+    342401,342465,342529,342593,342657,342721,342785,342849,
+    342913,342977,343041,343105,343169,343233,343297,343361,
+    343425,222913,343489,343553,343617,343681,343745,343809,
+    343873,343937,344001,344065,222977,344129,344193,344257,
+    344321,344385,344449,344513,344577,344641,344705,105921,
+    344769,106177,344833,344897,344961,345025,106497,345089,
+    0,0,0,0,0,0,0,
+};
+
+// first code point << 8 | canonical combining class of each range
+static const unsigned int urlIdnaClasses[581] = {
+    0,196838,202216,202460,203496,203736,203996,205258,
+    205788,206794,207324,209921,211420,212454,214512,214758,
+    215004,215782,216540,216832,217318,218076,219110,219368,
+    219612,220134,220393,220650,221161,221418,221929,222182,
+    225280,295910,296960,365020,365286,366300,366566,367326,
+    367580,367846,369372,370918,371420,371686,372190,372452,
+    372710,372746,373003,373260,373517,373774,374031,374288,
+    374545,374802,375059,375572,375829,376086,376320,376599,
+    376832,377112,377369,377600,378086,378332,378368,378642,
+    378880,397542,399390,399647,399904,400128,412443,412700,
+    412957,413214,413471,413728,413985,414242,414694,415196,
+    415718,416988,417254,417756,417792,421923,422144,448230,
+    449792,450534,451548,451814,451840,452582,452864,453340,
+    453606,454108,454144,463140,463360,471270,471516,471782,
+    472284,472550,473052,473830,474076,474598,474844,475110,
+    475868,476134,476380,476646,476892,477158,477404,477670,
+    477952,519142,520924,521190,521216,523740,523776,530150,
+    530944,531430,533504,533990,534528,535014,536064,547292,
+    547840,563430,563676,564454,565248,576230,577500,578790,
+    582144,582620,582886,583388,583654,584156,584422,585180,
+    585755,586012,586269,586726,587484,587750,588252,588774,
+    589824,605191,605440,609545,609792,610790,611036,611302,
+    611584,637959,638208,642313,642560,655078,655104,670727,
+    670976,675081,675328,703495,703744,707849,708096,736263,
+    736512,740617,740864,773385,773632,801799,802048,806153,
+    806400,808276,808539,808704,834567,834816,838921,839168,
+    867081,867584,871689,871936,903689,903936,931943,932361,
+    932608,936043,936960,964726,965129,965376,968826,969728,
+    989404,989696,996828,996864,997340,997376,997848,997888,
+    1012097,1012354,1012480,1012868,1012992,1014402,1015296,1015938,
+    1016064,1016550,1016841,1017088,1017574,1017856,1033948,1033984,
+    1062663,1062912,1063177,1063680,1084892,1084928,1269222,1269760,
+    1512457,1512960,1520649,1520896,1561097,1561344,1564134,1564160,
+    1616356,1616384,1653214,1653478,1653724,1653760,1710054,1710300,
+    1710336,1728521,1728768,1734118,1735936,1736668,1736704,1749222,
+    1750492,1752038,1752540,1752576,1753052,1753574,1754076,1754598,
+    1755868,1756134,1756928,1782791,1783040,1786889,1787136,1797094,
+    1797340,1797606,1799168,1813001,1813504,1828359,1828608,1831433,
+    1831936,1849095,1849344,1888486,1889024,1889281,1889756,1891046,
+    1891548,1892582,1892608,1892865,1894656,1895900,1895936,1897702,
+    1897728,1898726,1899008,1949926,1950428,1950694,1952476,1952742,
+    1953258,1953494,1953756,1953994,1954278,1963752,1964004,1964508,
+    1964762,1965030,1965289,1965532,1965798,1966044,1966080,2150630,
+    2150913,2151654,2152449,2153446,2153728,2154982,2155008,2155777,
+    2156518,2156764,2157030,2157057,2157788,2158822,2158848,2944998,
+    2945536,2981641,2981888,3006694,3014656,3156698,3156964,3157224,
+    3157470,3157728,3158016,3184904,3185408,10907622,10907648,10908902,
+    10911232,10919654,10919936,10940646,10940928,11011593,11011840,11021321,
+    11021568,11060233,11060480,11067622,11072000,11086812,11087360,11096841,
+    11097088,11121415,11121664,11124745,11124992,11186406,11186432,11186918,
+    11187420,11187456,11188198,11188480,11189990,11190272,11190758,11190784,
+    11204105,11204352,11267337,11267584,16457242,16457472,16654566,16656348,
+    16658150,16658432,16907740,16907776,16965852,16965888,17004262,17005312,
+    17436124,17436160,17436646,17436672,17447142,17447169,17447644,17447680,
+    17448713,17448960,17491430,17491676,17491712,17638630,17639424,17738726,
+    17739008,17759708,17760256,17778396,17778918,17779676,17779942,17780188,
+    17780992,17793766,17794012,17794278,17794524,17794560,17843721,17843968,
+    17854473,17854720,17858313,17858560,17873161,17873415,17873664,17891558,
+    17892096,17904393,17904896,17920775,17921024,17940489,17940736,17943047,
+    17943296,17970441,17970695,17970944,18016519,18016777,18017024,18037511,
+    18038016,18042121,18042368,18048742,18050304,18051302,18052352,18104841,
+    18105088,18105863,18106112,18112230,18112256,18137609,18137863,18138112,
+    18202377,18202631,18202880,18235145,18235392,18265609,18265863,18266112,
+    18295561,18295808,18364681,18364935,18365184,18431241,18431744,18432775,
+    18433024,18472969,18473216,18494473,18494720,18499337,18499584,18520329,
+    18520576,18628361,18628608,18694663,18694912,18695177,18695680,18716425,
+    18716672,18825481,18825984,23785473,23786752,23802086,23803648,24113158,
+    24113664,29138433,29138688,30500312,30500609,30501376,30502370,30502616,
+    30503680,30505948,30507776,30508518,30509788,30510080,30517990,30518784,
+    30556902,30557440,31457510,31459072,31459558,31463680,31464422,31465984,
+    31466470,31466752,31467238,31468288,31494118,31494144,31535334,31536896,
+    31633126,31633152,31648998,31649792,31780072,31780572,31780838,31780864,
+    32035036,32036608,32064742,32066055,32066304,
+};
+
+// code points with a canonical decomposition and their full
+// decomposition in urlIdnaPool, as offset << URL_IDNA_LEN_BITS | length
+static const unsigned int urlIdnaDecompositions[2061][2] = {
+    {192,345154},{193,345282},{194,345410},{195,345538},{196,345666},{197,345794},
+    {199,345922},{200,346050},{201,346178},{202,346306},{203,346434},{204,346562},
+    {205,346690},{206,346818},{207,346946},{209,347074},{210,347202},{211,347330},
+    {212,347458},{213,347586},{214,347714},{217,347842},{218,347970},{219,348098},
+    {220,348226},{221,348354},{224,348482},{225,348610},{226,348738},{227,348866},
+    {228,348994},{229,349122},{231,349250},{232,349378},{233,349506},{234,349634},
+    {235,349762},{236,349890},{237,350018},{238,350146},{239,350274},{241,350402},
+    {242,350530},{243,350658},{244,350786},{245,350914},{246,351042},{249,351170},
+    {250,351298},{251,351426},{252,351554},{253,351682},{255,351810},{256,351938},
+    {257,352066},{258,352194},{259,352322},{260,352450},{261,352578},{262,352706},
+    {263,352834},{264,352962},{265,353090},{266,353218},{267,353346},{268,353474},
+    {269,353602},{270,353730},{271,353858},{274,353986},{275,354114},{276,354242},
+    {277,354370},{278,354498},{279,354626},{280,354754},{281,354882},{282,355010},
+    {283,355138},{284,355266},{285,355394},{286,355522},{287,355650},{288,355778},
+    {289,355906},{290,356034},{291,356162},{292,356290},{293,356418},{296,356546},
+    {297,356674},{298,356802},{299,356930},{300,357058},{301,357186},{302,357314},
+    {303,357442},{304,357570},{308,357698},{309,357826},{310,357954},{311,358082},
+    {313,358210},{314,358338},{315,358466},{316,358594},{317,358722},{318,358850},
+    {323,358978},{324,359106},{325,359234},{326,359362},{327,359490},{328,359618},
+    {332,359746},{333,359874},{334,360002},{335,360130},{336,360258},{337,360386},
+    {340,360514},{341,360642},{342,360770},{343,360898},{344,361026},{345,361154},
+    {346,361282},{347,361410},{348,361538},{349,361666},{350,361794},{351,361922},
+    {352,362050},{353,362178},{354,362306},{355,362434},{356,362562},{357,362690},
+    {360,362818},{361,362946},{362,363074},{363,363202},{364,363330},{365,363458},
+    {366,363586},{367,363714},{368,363842},{369,363970},{370,364098},{371,364226},
+    {372,364354},{373,364482},{374,364610},{375,364738},{376,364866},{377,364994},
+    {378,365122},{379,365250},{380,365378},{381,365506},{382,365634},{416,365762},
+    {417,365890},{431,366018},{432,366146},{461,366274},{462,366402},{463,366530},
+    {464,366658},{465,366786},{466,366914},{467,367042},{468,367170},{469,367299},
+    {470,367491},{471,367683},{472,367875},{473,368067},{474,368259},{475,368451},
+    {476,368643},{478,368835},{479,369027},{480,369219},{481,369411},{482,369602},
+    {483,369730},{486,369858},{487,369986},{488,370114},{489,370242},{490,370370},
+    {491,370498},{492,370627},{493,370819},{494,371010},{495,371138},{496,371266},
+    {500,371394},{501,371522},{504,371650},{505,371778},{506,371907},{507,372099},
+    {508,372290},{509,372418},{510,372546},{511,372674},{512,372802},{513,372930},
+    {514,373058},{515,373186},{516,373314},{517,373442},{518,373570},{519,373698},
+    {520,373826},{521,373954},{522,374082},{523,374210},{524,374338},{525,374466},
+    {526,374594},{527,374722},{528,374850},{529,374978},{530,375106},{531,375234},
+    {532,375362},{533,375490},{534,375618},{535,375746},{536,375874},{537,376002},
+    {538,376130},{539,376258},{542,376386},{543,376514},{550,376642},{551,376770},
+    {552,376898},{553,377026},{554,377155},{555,377347},{556,377539},{557,377731},
+    {558,377922},{559,378050},{560,378179},{561,378371},{562,378562},{563,378690},
+    {832,17281},{833,17345},{835,17409},{836,17474},{884,17793},{894,18049},
+    {901,378818},{902,378946},{903,18433},{904,379074},{905,379202},{906,379330},
+    {908,379458},{910,379586},{911,379714},{912,379843},{938,380034},{939,380162},
+    {940,380290},{941,380418},{942,380546},{943,380674},{944,380803},{970,380994},
+    {971,381122},{972,381250},{973,381378},{974,381506},{979,381634},{980,381762},
+    {1024,381890},{1025,382018},{1027,382146},{1031,382274},{1036,382402},{1037,382530},
+    {1038,382658},{1049,382786},{1081,382914},{1104,383042},{1105,383170},{1107,383298},
+    {1111,383426},{1116,383554},{1117,383682},{1118,383810},{1142,383938},{1143,384066},
+    {1217,384194},{1218,384322},{1232,384450},{1233,384578},{1234,384706},{1235,384834},
+    {1238,384962},{1239,385090},{1242,385218},{1243,385346},{1244,385474},{1245,385602},
+    {1246,385730},{1247,385858},{1250,385986},{1251,386114},{1252,386242},{1253,386370},
+    {1254,386498},{1255,386626},{1258,386754},{1259,386882},{1260,387010},{1261,387138},
+    {1262,387266},{1263,387394},{1264,387522},{1265,387650},{1266,387778},{1267,387906},
+    {1268,388034},{1269,388162},{1272,388290},{1273,388418},{1570,388546},{1571,388674},
+    {1572,388802},{1573,388930},{1574,389058},{1728,389186},{1730,389314},{1747,389442},
+    {2345,389570},{2353,389698},{2356,389826},{2392,34050},{2393,34178},{2394,34306},
+    {2395,34434},{2396,34562},{2397,34690},{2398,34818},{2399,34946},{2507,389954},
+    {2508,390082},{2524,35074},{2525,35202},{2527,35330},{2611,35458},{2614,35586},
+    {2649,35714},{2650,35842},{2651,35970},{2654,36098},{2888,390210},{2891,390338},
+    {2892,390466},{2908,36226},{2909,36354},{2964,390594},{3018,390722},{3019,390850},
+    {3020,390978},{3144,391106},{3264,391234},{3271,391362},{3272,391490},{3274,391618},
+    {3275,391747},{3402,391938},{3403,392066},{3404,392194},{3546,392322},{3548,392450},
+    {3549,392579},{3550,392770},{3907,37058},{3917,37186},{3922,37314},{3927,37442},
+    {3932,37570},{3945,37698},{3955,37826},{3957,37954},{3958,38082},{3960,38402},
+    {3969,38722},{3987,38850},{3997,38978},{4002,39106},{4007,39234},{4012,39362},
+    {4025,39490},{4134,392898},{6918,393026},{6920,393154},{6922,393282},{6924,393410},
+    {6926,393538},{6930,393666},{6971,393794},{6973,393922},{6976,394050},{6977,394178},
+    {6979,394306},{7680,394434},{7681,394562},{7682,394690},{7683,394818},{7684,394946},
+    {7685,395074},{7686,395202},{7687,395330},{7688,395459},{7689,395651},{7690,395842},
+    {7691,395970},{7692,396098},{7693,396226},{7694,396354},{7695,396482},{7696,396610},
+    {7697,396738},{7698,396866},{7699,396994},{7700,397123},{7701,397315},{7702,397507},
+    {7703,397699},{7704,397890},{7705,398018},{7706,398146},{7707,398274},{7708,398403},
+    {7709,398595},{7710,398786},{7711,398914},{7712,399042},{7713,399170},{7714,399298},
+    {7715,399426},{7716,399554},{7717,399682},{7718,399810},{7719,399938},{7720,400066},
+    {7721,400194},{7722,400322},{7723,400450},{7724,400578},{7725,400706},{7726,400835},
+    {7727,401027},{7728,401218},{7729,401346},{7730,401474},{7731,401602},{7732,401730},
+    {7733,401858},{7734,401986},{7735,402114},{7736,402243},{7737,402435},{7738,402626},
+    {7739,402754},{7740,402882},{7741,403010},{7742,403138},{7743,403266},{7744,403394},
+    {7745,403522},{7746,403650},{7747,403778},{7748,403906},{7749,404034},{7750,404162},
+    {7751,404290},{7752,404418},{7753,404546},{7754,404674},{7755,404802},{7756,404931},
+    {7757,405123},{7758,405315},{7759,405507},{7760,405699},{7761,405891},{7762,406083},
+    {7763,406275},{7764,406466},{7765,406594},{7766,406722},{7767,406850},{7768,406978},
+    {7769,407106},{7770,407234},{7771,407362},{7772,407491},{7773,407683},{7774,407874},
+    {7775,408002},{7776,408130},{7777,408258},{7778,408386},{7779,408514},{7780,408643},
+    {7781,408835},{7782,409027},{7783,409219},{7784,409411},{7785,409603},{7786,409794},
+    {7787,409922},{7788,410050},{7789,410178},{7790,410306},{7791,410434},{7792,410562},
+    {7793,410690},{7794,410818},{7795,410946},{7796,411074},{7797,411202},{7798,411330},
+    {7799,411458},{7800,411587},{7801,411779},{7802,411971},{7803,412163},{7804,412354},
+    {7805,412482},{7806,412610},{7807,412738},{7808,412866},{7809,412994},{7810,413122},
+    {7811,413250},{7812,413378},{7813,413506},{7814,413634},{7815,413762},{7816,413890},
+    {7817,414018},{7818,414146},{7819,414274},{7820,414402},{7821,414530},{7822,414658},
+    {7823,414786},{7824,414914},{7825,415042},{7826,415170},{7827,415298},{7828,415426},
+    {7829,415554},{7830,415682},{7831,415810},{7832,415938},{7833,416066},{7835,416194},
+    {7840,416322},{7841,416450},{7842,416578},{7843,416706},{7844,416835},{7845,417027},
+    {7846,417219},{7847,417411},{7848,417603},{7849,417795},{7850,417987},{7851,418179},
+    {7852,418371},{7853,418563},{7854,418755},{7855,418947},{7856,419139},{7857,419331},
+    {7858,419523},{7859,419715},{7860,419907},{7861,420099},{7862,420291},{7863,420483},
+    {7864,420674},{7865,420802},{7866,420930},{7867,421058},{7868,421186},{7869,421314},
+    {7870,421443},{7871,421635},{7872,421827},{7873,422019},{7874,422211},{7875,422403},
+    {7876,422595},{7877,422787},{7878,422979},{7879,423171},{7880,423362},{7881,423490},
+    {7882,423618},{7883,423746},{7884,423874},{7885,424002},{7886,424130},{7887,424258},
+    {7888,424387},{7889,424579},{7890,424771},{7891,424963},{7892,425155},{7893,425347},
+    {7894,425539},{7895,425731},{7896,425923},{7897,426115},{7898,426307},{7899,426499},
+    {7900,426691},{7901,426883},{7902,427075},{7903,427267},{7904,427459},{7905,427651},
+    {7906,427843},{7907,428035},{7908,428226},{7909,428354},{7910,428482},{7911,428610},
+    {7912,428739},{7913,428931},{7914,429123},{7915,429315},{7916,429507},{7917,429699},
+    {7918,429891},{7919,430083},{7920,430275},{7921,430467},{7922,430658},{7923,430786},
+    {7924,430914},{7925,431042},{7926,431170},{7927,431298},{7928,431426},{7929,431554},
+    {7936,431682},{7937,431810},{7938,431939},{7939,432131},{7940,432323},{7941,432515},
+    {7942,432707},{7943,432899},{7944,433090},{7945,433218},{7946,433347},{7947,433539},
+    {7948,433731},{7949,433923},{7950,434115},{7951,434307},{7952,434498},{7953,434626},
+    {7954,434755},{7955,434947},{7956,435139},{7957,435331},{7960,435522},{7961,435650},
+    {7962,435779},{7963,435971},{7964,436163},{7965,436355},{7968,436546},{7969,436674},
+    {7970,436803},{7971,436995},{7972,437187},{7973,437379},{7974,437571},{7975,437763},
+    {7976,437954},{7977,438082},{7978,438211},{7979,438403},{7980,438595},{7981,438787},
+    {7982,438979},{7983,439171},{7984,439362},{7985,439490},{7986,439619},{7987,439811},
+    {7988,440003},{7989,440195},{7990,440387},{7991,440579},{7992,440770},{7993,440898},
+    {7994,441027},{7995,441219},{7996,441411},{7997,441603},{7998,441795},{7999,441987},
+    {8000,442178},{8001,442306},{8002,442435},{8003,442627},{8004,442819},{8005,443011},
+    {8008,443202},{8009,443330},{8010,443459},{8011,443651},{8012,443843},{8013,444035},
+    {8016,444226},{8017,444354},{8018,444483},{8019,444675},{8020,444867},{8021,445059},
+    {8022,445251},{8023,445443},{8025,445634},{8027,445763},{8029,445955},{8031,446147},
+    {8032,446338},{8033,446466},{8034,446595},{8035,446787},{8036,446979},{8037,447171},
+    {8038,447363},{8039,447555},{8040,447746},{8041,447874},{8042,448003},{8043,448195},
+    {8044,448387},{8045,448579},{8046,448771},{8047,448963},{8048,449154},{8049,380290},
+    {8050,449282},{8051,380418},{8052,449410},{8053,380546},{8054,449538},{8055,380674},
+    {8056,449666},{8057,381250},{8058,449794},{8059,381378},{8060,449922},{8061,381506},
+    {8064,450051},{8065,450243},{8066,450436},{8067,450692},{8068,450948},{8069,451204},
+    {8070,451460},{8071,451716},{8072,451971},{8073,452163},{8074,452356},{8075,452612},
+    {8076,452868},{8077,453124},{8078,453380},{8079,453636},{8080,453891},{8081,454083},
+    {8082,454276},{8083,454532},{8084,454788},{8085,455044},{8086,455300},{8087,455556},
+    {8088,455811},{8089,456003},{8090,456196},{8091,456452},{8092,456708},{8093,456964},
+    {8094,457220},{8095,457476},{8096,457731},{8097,457923},{8098,458116},{8099,458372},
+    {8100,458628},{8101,458884},{8102,459140},{8103,459396},{8104,459651},{8105,459843},
+    {8106,460036},{8107,460292},{8108,460548},{8109,460804},{8110,461060},{8111,461316},
+    {8112,461570},{8113,461698},{8114,461827},{8115,462018},{8116,462147},{8118,462338},
+    {8119,462467},{8120,462658},{8121,462786},{8122,462914},{8123,378946},{8124,463042},
+    {8126,17601},{8129,463170},{8130,463299},{8131,463490},{8132,463619},{8134,463810},
+    {8135,463939},{8136,464130},{8137,379074},{8138,464258},{8139,379202},{8140,464386},
+    {8141,464514},{8142,464642},{8143,464770},{8144,464898},{8145,465026},{8146,465155},
+    {8147,379843},{8150,465346},{8151,465475},{8152,465666},{8153,465794},{8154,465922},
+    {8155,379330},{8157,466050},{8158,466178},{8159,466306},{8160,466434},{8161,466562},
+    {8162,466691},{8163,380803},{8164,466882},{8165,467010},{8166,467138},{8167,467267},
+    {8168,467458},{8169,467586},{8170,467714},{8171,379586},{8172,467842},{8173,467970},
+    {8174,378818},{8175,62913},{8178,468099},{8179,468290},{8180,468419},{8182,468610},
+    {8183,468739},{8184,468930},{8185,379458},{8186,469058},{8187,379714},{8188,469186},
+    {8189,469313},{8192,469377},{8193,469441},{8486,469505},{8490,469569},{8491,345794},
+    {8602,469634},{8603,469762},{8622,469890},{8653,470018},{8654,470146},{8655,470274},
+    {8708,470402},{8713,470530},{8716,470658},{8740,470786},{8742,470914},{8769,471042},
+    {8772,471170},{8775,471298},{8777,471426},{8800,471554},{8802,471682},{8813,471810},
+    {8814,471938},{8815,472066},{8816,472194},{8817,472322},{8820,472450},{8821,472578},
+    {8824,472706},{8825,472834},{8832,472962},{8833,473090},{8836,473218},{8837,473346},
+    {8840,473474},{8841,473602},{8876,473730},{8877,473858},{8878,473986},{8879,474114},
+    {8928,474242},{8929,474370},{8930,474498},{8931,474626},{8938,474754},{8939,474882},
+    {8940,475010},{8941,475138},{9001,73857},{9002,73921},{10972,85698},{12364,475266},
+    {12366,475394},{12368,475522},{12370,475650},{12372,475778},{12374,475906},{12376,476034},
+    {12378,476162},{12380,476290},{12382,476418},{12384,476546},{12386,476674},{12389,476802},
+    {12391,476930},{12393,477058},{12400,477186},{12401,477314},{12403,477442},{12404,477570},
+    {12406,477698},{12407,477826},{12409,477954},{12410,478082},{12412,478210},{12413,478338},
+    {12436,478466},{12446,478594},{12460,478722},{12462,478850},{12464,478978},{12466,479106},
+    {12468,479234},{12470,479362},{12472,479490},{12474,479618},{12476,479746},{12478,479874},
+    {12480,480002},{12482,480130},{12485,480258},{12487,480386},{12489,480514},{12496,480642},
+    {12497,480770},{12499,480898},{12500,481026},{12502,481154},{12503,481282},{12505,481410},
+    {12506,481538},{12508,481666},{12509,481794},{12532,481922},{12535,482050},{12536,482178},
+    {12537,482306},{12538,482434},{12542,482562},{63744,197761},{63745,197825},{63746,103297},
+    {63747,197889},{63748,197953},{63749,198017},{63750,198081},{63751,106753},{63752,106753},
+    {63753,198145},{63754,103809},{63755,198209},{63756,198273},{63757,198337},{63758,198401},
+    {63759,198465},{63760,198529},{63761,198593},{63762,198657},{63763,198721},{63764,198785},
+    {63765,198849},{63766,198913},{63767,198977},{63768,199041},{63769,199105},{63770,199169},
+    {63771,199233},{63772,199297},{63773,199361},{63774,199425},{63775,199489},{63776,199553},
+    {63777,199617},{63778,199681},{63779,199745},{63780,199809},{63781,199873},{63782,199937},
+    {63783,200001},{63784,200065},{63785,200129},{63786,200193},{63787,200257},{63788,200321},
+    {63789,200385},{63790,200449},{63791,200513},{63792,200577},{63793,200641},{63794,200705},
+    {63795,200769},{63796,101121},{63797,200833},{63798,200897},{63799,200961},{63800,201025},
+    {63801,201089},{63802,201153},{63803,201217},{63804,201281},{63805,201345},{63806,201409},
+    {63807,201473},{63808,105793},{63809,201537},{63810,201601},{63811,201665},{63812,201729},
+    {63813,201793},{63814,201857},{63815,201921},{63816,201985},{63817,202049},{63818,202113},
+    {63819,202177},{63820,202241},{63821,202305},{63822,202369},{63823,202433},{63824,202497},
+    {63825,202561},{63826,202625},{63827,202689},{63828,202753},{63829,202817},{63830,202881},
+    {63831,202945},{63832,203009},{63833,203073},{63834,203137},{63835,203201},{63836,198785},
+    {63837,203265},{63838,203329},{63839,203393},{63840,203457},{63841,203521},{63842,203585},
+    {63843,203649},{63844,203713},{63845,203777},{63846,203841},{63847,203905},{63848,203969},
+    {63849,204033},{63850,204097},{63851,204161},{63852,204225},{63853,204289},{63854,204353},
+    {63855,204417},{63856,204481},{63857,103425},{63858,204545},{63859,204609},{63860,204673},
+    {63861,204737},{63862,204801},{63863,204865},{63864,204929},{63865,204993},{63866,205057},
+    {63867,205121},{63868,205185},{63869,205249},{63870,205313},{63871,205377},{63872,205441},
+    {63873,95553},{63874,205505},{63875,205569},{63876,205633},{63877,205697},{63878,205761},
+    {63879,205825},{63880,205889},{63881,205953},{63882,94337},{63883,206017},{63884,206081},
+    {63885,206145},{63886,206209},{63887,206273},{63888,206337},{63889,206401},{63890,206465},
+    {63891,206529},{63892,206593},{63893,206657},{63894,206721},{63895,206785},{63896,206849},
+    {63897,206913},{63898,206977},{63899,207041},{63900,207105},{63901,207169},{63902,207233},
+    {63903,207297},{63904,207361},{63905,204417},{63906,207425},{63907,207489},{63908,207553},
+    {63909,207617},{63910,207681},{63911,207745},{63912,207809},{63913,207873},{63914,203393},
+    {63915,207937},{63916,208001},{63917,208065},{63918,208129},{63919,208193},{63920,208257},
+    {63921,208321},{63922,208385},{63923,208449},{63924,208513},{63925,208577},{63926,208641},
+    {63927,208705},{63928,208769},{63929,208833},{63930,208897},{63931,208961},{63932,209025},
+    {63933,209089},{63934,209153},{63935,198785},{63936,209217},{63937,209281},{63938,209345},
+    {63939,209409},{63940,106689},{63941,209473},{63942,209537},{63943,209601},{63944,209665},
+    {63945,209729},{63946,209793},{63947,209857},{63948,209921},{63949,209985},{63950,210049},
+    {63951,210113},{63952,210177},{63953,130817},{63954,210241},{63955,210305},{63956,210369},
+    {63957,210433},{63958,210497},{63959,210561},{63960,210625},{63961,210689},{63962,210753},
+    {63963,203521},{63964,210817},{63965,210881},{63966,210945},{63967,211009},{63968,211073},
+    {63969,211137},{63970,211201},{63971,211265},{63972,211329},{63973,211393},{63974,211457},
+    {63975,211521},{63976,211585},{63977,103745},{63978,211649},{63979,211713},{63980,211777},
+    {63981,211841},{63982,211905},{63983,211969},{63984,212033},{63985,212097},{63986,212161},
+    {63987,212225},{63988,212289},{63989,212353},{63990,212417},{63991,100609},{63992,212481},
+    {63993,212545},{63994,212609},{63995,212673},{63996,212737},{63997,212801},{63998,212865},
+    {63999,212929},{64000,212993},{64001,213057},{64002,213121},{64003,213185},{64004,213249},
+    {64005,213313},{64006,213377},{64007,213441},{64008,102337},{64009,213505},{64010,102529},
+    {64011,213569},{64012,213633},{64013,213697},{64016,213761},{64018,213825},{64021,213889},
+    {64022,213953},{64023,214017},{64024,214081},{64025,214145},{64026,214209},{64027,214273},
+    {64028,214337},{64029,214401},{64030,101057},{64032,214465},{64034,214529},{64037,214593},
+    {64038,214657},{64042,214721},{64043,214785},{64044,214849},{64045,214913},{64046,214977},
+    {64047,215041},{64048,215105},{64049,215169},{64050,215233},{64051,215297},{64052,215361},
+    {64053,215425},{64054,215489},{64055,215553},{64056,215617},{64057,215681},{64058,215745},
+    {64059,215809},{64060,96001},{64061,215873},{64062,215937},{64063,216001},{64064,216065},
+    {64065,216129},{64066,216193},{64067,216257},{64068,216321},{64069,216385},{64070,216449},
+    {64071,216513},{64072,216577},{64073,216641},{64074,216705},{64075,216769},{64076,131137},
+    {64077,216833},{64078,216897},{64079,216961},{64080,217025},{64081,131393},{64082,217089},
+    {64083,217153},{64084,217217},{64085,217281},{64086,217345},{64087,206721},{64088,217409},
+    {64089,217473},{64090,217537},{64091,217601},{64092,217665},{64093,217729},{64094,217729},
+    {64095,217793},{64096,217857},{64097,217921},{64098,217985},{64099,218049},{64100,218113},
+    {64101,218177},{64102,218241},{64103,214593},{64104,218305},{64105,218369},{64106,218433},
+    {64107,218497},{64108,218561},{64109,218625},{64112,218689},{64113,218753},{64114,218817},
+    {64115,218881},{64116,218945},{64117,219009},{64118,219073},{64119,219137},{64120,215489},
+    {64121,219201},{64122,219265},{64123,219329},{64124,213761},{64125,219393},{64126,219457},
+    {64127,219521},{64128,219585},{64129,219649},{64130,219713},{64131,219777},{64132,219841},
+    {64133,219905},{64134,219969},{64135,220033},{64136,220097},{64137,216001},{64138,220161},
+    {64139,216065},{64140,220225},{64141,220289},{64142,220353},{64143,220417},{64144,220481},
+    {64145,213825},{64146,200129},{64147,220545},{64148,220609},{64149,98113},{64150,204481},
+    {64151,209793},{64152,220673},{64153,220737},{64154,216513},{64155,220801},{64156,216577},
+    {64157,220865},{64158,220929},{64159,220993},{64160,213953},{64161,221057},{64162,221121},
+    {64163,221185},{64164,221249},{64165,221313},{64166,214017},{64167,221377},{64168,221441},
+    {64169,221505},{64170,221569},{64171,221633},{64172,221697},{64173,217345},{64174,221761},
+    {64175,221825},{64176,206721},{64177,221889},{64178,217601},{64179,221953},{64180,222017},
+    {64181,222081},{64182,222145},{64183,222209},{64184,217921},{64185,222273},{64186,214529},
+    {64187,222337},{64188,217985},{64189,203265},{64190,222401},{64191,218049},{64192,222465},
+    {64193,218177},{64194,222529},{64195,222593},{64196,222657},{64197,222721},{64198,222785},
+    {64199,218305},{64200,214337},{64201,222849},{64202,218369},{64203,222913},{64204,218433},
+    {64205,222977},{64206,106753},{64207,223041},{64208,223105},{64209,223169},{64210,223233},
+    {64211,223297},{64212,223361},{64213,223425},{64214,223489},{64215,223553},{64216,223617},
+    {64217,223681},{64285,225282},{64287,225410},{64298,225986},{64299,226114},{64300,226243},
+    {64301,226435},{64302,226626},{64303,226754},{64304,226882},{64305,227010},{64306,227138},
+    {64307,227266},{64308,227394},{64309,227522},{64310,227650},{64312,227778},{64313,227906},
+    {64314,228034},{64315,228162},{64316,228290},{64318,228418},{64320,228546},{64321,228674},
+    {64323,228802},{64324,228930},{64326,229058},{64327,229186},{64328,229314},{64329,229442},
+    {64330,229570},{64331,229698},{64332,229826},{64333,229954},{64334,230082},{69786,482690},
+    {69788,482818},{69803,482946},{69934,483074},{69935,483202},{70475,483330},{70476,483458},
+    {70843,483586},{70844,483714},{70846,483842},{71098,483970},{71099,484098},{71992,484226},
+    {119134,303810},{119135,303938},{119136,304067},{119137,304259},{119138,304451},{119139,304643},
+    {119140,304835},{119227,305026},{119228,305154},{119229,305283},{119230,305475},{119231,305667},
+    {119232,305859},{194560,315649},{194561,315713},{194562,315777},{194563,315841},{194564,315905},
+    {194565,215105},{194566,315969},{194567,316033},{194568,316097},{194569,316161},{194570,215169},
+    {194571,316225},{194572,316289},{194573,316353},{194574,215233},{194575,316417},{194576,316481},
+    {194577,316545},{194578,316609},{194579,316673},{194580,316737},{194581,312449},{194582,316801},
+    {194583,316865},{194584,316929},{194585,316993},{194586,317057},{194587,218753},{194588,317121},
+    {194589,94209},{194590,317185},{194591,317249},{194592,317313},{194593,317377},{194594,313601},
+    {194595,317441},{194596,317505},{194597,219073},{194598,215297},{194599,215361},{194600,219137},
+    {194601,317569},{194602,317633},{194603,203649},{194604,317697},{194605,215425},{194606,317761},
+    {194607,317825},{194608,317889},{194609,317953},{194610,317953},{194611,317953},{194612,318017},
+    {194613,318081},{194614,318145},{194615,318209},{194616,318273},{194617,318337},{194618,318401},
+    {194619,318465},{194620,318529},{194621,318593},{194622,318657},{194623,318721},{194624,318785},
+    {194625,318849},{194626,318913},{194627,318977},{194628,319041},{194629,319105},{194630,319105},
+    {194631,219265},{194632,319169},{194633,319233},{194634,319297},{194635,319361},{194636,215553},
+    {194637,319425},{194638,319489},{194639,319553},{194640,212993},{194641,319617},{194642,319681},
+    {194643,319745},{194644,319809},{194645,319873},{194646,319937},{194647,320001},{194648,320065},
+    {194649,320129},{194650,320193},{194651,320257},{194652,320321},{194653,312001},{194654,320385},
+    {194655,320449},{194656,320513},{194657,320577},{194658,320641},{194659,320705},{194660,320769},
+    {194661,320833},{194662,320897},{194663,320961},{194664,484353},{194665,321025},{194666,321089},
+    {194667,321089},{194668,321153},{194669,321217},{194670,321281},{194671,203393},{194672,321345},
+    {194673,321409},{194674,321473},{194675,321537},{194676,484417},{194677,95873},{194678,321601},
+    {194679,321665},{194680,96001},{194681,321729},{194682,321793},{194683,321857},{194684,321921},
+    {194685,321985},{194686,322049},{194687,322113},{194688,322177},{194689,322241},{194690,322305},
+    {194691,322369},{194692,322433},{194693,322497},{194694,322561},{194695,322625},{194696,322689},
+    {194697,322753},{194698,322817},{194699,322881},{194700,322945},{194701,323009},{194702,200065},
+    {194703,323073},{194704,96641},{194705,323137},{194706,323137},{194707,323201},{194708,323265},
+    {194709,323265},{194710,323329},{194711,323393},{194712,323457},{194713,323521},{194714,323585},
+    {194715,323649},{194716,323713},{194717,323777},{194718,323841},{194719,323905},{194720,323969},
+    {194721,324033},{194722,324097},{194723,215873},{194724,324161},{194725,324225},{194726,324289},
+    {194727,324353},{194728,220033},{194729,324353},{194730,324417},{194731,216001},{194732,324481},
+    {194733,324545},{194734,324609},{194735,324673},{194736,216065},{194737,198337},{194738,324737},
+    {194739,324801},{194740,324865},{194741,324929},{194742,324993},{194743,325057},{194744,325121},
+    {194745,325185},{194746,325249},{194747,325313},{194748,325377},{194749,325441},{194750,325505},
+    {194751,325569},{194752,325633},{194753,325697},{194754,325761},{194755,325825},{194756,325889},
+    {194757,325953},{194758,326017},{194759,326081},{194760,216129},{194761,326145},{194762,326209},
+    {194763,326273},{194764,326337},{194765,326401},{194766,326465},{194767,216257},{194768,326529},
+    {194769,326593},{194770,326657},{194771,326721},{194772,326785},{194773,326849},{194774,326913},
+    {194775,326977},{194776,200129},{194777,220545},{194778,327041},{194779,327105},{194780,327169},
+    {194781,327233},{194782,327297},{194783,327361},{194784,327425},{194785,327489},{194786,216321},
+    {194787,327553},{194788,327617},{194789,327681},{194790,327745},{194791,223233},{194792,327809},
+    {194793,327873},{194794,327937},{194795,328001},{194796,328065},{194797,328129},{194798,328193},
+    {194799,328257},{194800,328321},{194801,328385},{194802,328449},{194803,328513},{194804,328577},
+    {194805,204481},{194806,328641},{194807,328705},{194808,328769},{194809,328833},{194810,328897},
+    {194811,328961},{194812,329025},{194813,329089},{194814,329153},{194815,329217},{194816,329281},
+    {194817,216385},{194818,209793},{194819,329345},{194820,329409},{194821,329473},{194822,329537},
+    {194823,329601},{194824,329665},{194825,329729},{194826,329793},{194827,220737},{194828,329857},
+    {194829,329921},{194830,329985},{194831,330049},{194832,330113},{194833,330177},{194834,330241},
+    {194835,330305},{194836,220801},{194837,330369},{194838,330433},{194839,330497},{194840,330561},
+    {194841,330625},{194842,330689},{194843,330753},{194844,330817},{194845,330881},{194846,330945},
+    {194847,484481},{194848,331009},{194849,220929},{194850,331073},{194851,331137},{194852,331201},
+    {194853,331265},{194854,331329},{194855,331393},{194856,331457},{194857,331521},{194858,331585},
+    {194859,331649},{194860,331713},{194861,331713},{194862,331777},{194863,331841},{194864,221057},
+    {194865,331905},{194866,331969},{194867,332033},{194868,332097},{194869,332161},{194870,332225},
+    {194871,332289},{194872,203585},{194873,332353},{194874,332417},{194875,332481},{194876,332545},
+    {194877,332609},{194878,332673},{194879,332737},{194880,221441},{194881,332801},{194882,332865},
+    {194883,332929},{194884,332993},{194885,333057},{194886,333121},{194887,333121},{194888,221505},
+    {194889,223361},{194890,333185},{194891,333249},{194892,333313},{194893,333377},{194894,333441},
+    {194895,201217},{194896,221633},{194897,333505},{194898,333569},{194899,217025},{194900,333633},
+    {194901,333697},{194902,214273},{194903,333761},{194904,333825},{194905,217217},{194906,333889},
+    {194907,333953},{194908,334017},{194909,334081},{194910,334081},{194911,484545},{194912,334145},
+    {194913,334209},{194914,334273},{194915,334337},{194916,334401},{194917,334465},{194918,334529},
+    {194919,334593},{194920,334657},{194921,334721},{194922,334785},{194923,334849},{194924,334913},
+    {194925,334977},{194926,335041},{194927,335105},{194928,335169},{194929,335233},{194930,335297},
+    {194931,335361},{194932,335425},{194933,335489},{194934,335553},{194935,335617},{194936,335681},
+    {194937,335745},{194938,217601},{194939,335809},{194940,335873},{194941,335937},{194942,336001},
+    {194943,336065},{194944,336129},{194945,336193},{194946,336257},{194947,336321},{194948,336385},
+    {194949,336449},{194950,336513},{194951,336577},{194952,336641},{194953,336705},{194954,336769},
+    {194955,323201},{194956,336833},{194957,336897},{194958,336961},{194959,337025},{194960,337089},
+    {194961,337153},{194962,337217},{194963,337281},{194964,337345},{194965,337409},{194966,337473},
+    {194967,337537},{194968,204673},{194969,337601},{194970,337665},{194971,337729},{194972,337793},
+    {194973,337857},{194974,337921},{194975,217793},{194976,337985},{194977,338049},{194978,338113},
+    {194979,338177},{194980,338241},{194981,338305},{194982,338369},{194983,338433},{194984,338497},
+    {194985,338561},{194986,338625},{194987,338689},{194988,338753},{194989,338817},{194990,338881},
+    {194991,338945},{194992,339009},{194993,339073},{194994,339137},{194995,339201},{194996,200897},
+    {194997,339265},{194998,339329},{194999,339393},{195000,339457},{195001,339521},{195002,339585},
+    {195003,222081},{195004,339649},{195005,339713},{195006,339777},{195007,484609},{195008,339841},
+    {195009,339905},{195010,339969},{195011,340033},{195012,102401},{195013,340097},{195014,340161},
+    {195015,340225},{195016,340289},{195017,340353},{195018,340417},{195019,340481},{195020,340545},
+    {195021,340609},{195022,340673},{195023,340737},{195024,222401},{195025,222465},{195026,102849},
+    {195027,340801},{195028,340865},{195029,340929},{195030,340993},{195031,341057},{195032,341121},
+    {195033,341185},{195034,341249},{195035,341313},{195036,341377},{195037,341441},{195038,341505},
+    {195039,222529},{195040,341569},{195041,341633},{195042,341697},{195043,341761},{195044,341825},
+    {195045,341889},{195046,341953},{195047,342017},{195048,342081},{195049,342145},{195050,342209},
+    {195051,342273},{195052,342337},{195053,342401},{195054,342465},{195055,342529},{195056,342593},
+    {195057,342657},{195058,342721},{195059,342785},{195060,342849},{195061,342913},{195062,342977},
+    {195063,343041},{195064,343105},{195065,343169},{195066,343233},{195067,343297},{195068,343361},
+    {195069,343425},{195070,222913},{195071,222913},{195072,343489},{195073,343553},{195074,343617},
+    {195075,343681},{195076,343745},{195077,343809},{195078,343873},{195079,343937},{195080,344001},
+    {195081,344065},{195082,222977},{195083,344129},{195084,344193},{195085,344257},{195086,344321},
+    {195087,344385},{195088,344449},{195089,344513},{195090,344577},{195091,344641},{195092,344705},
+    {195093,105921},{195094,344769},{195095,106177},{195096,344833},{195097,344897},{195098,344961},
+    {195099,345025},{195100,106497},{195101,345089},
+};
+
+// first, second and composite code points of the primary composites
+static const unsigned int urlIdnaCompositions[941][3] = {
+    {60,824,8814},{61,824,8800},{62,824,8815},{65,768,192},
+    {65,769,193},{65,770,194},{65,771,195},{65,772,256},
+    {65,774,258},{65,775,550},{65,776,196},{65,777,7842},
+    {65,778,197},{65,780,461},{65,783,512},{65,785,514},
+    {65,803,7840},{65,805,7680},{65,808,260},{66,775,7682},
+    {66,803,7684},{66,817,7686},{67,769,262},{67,770,264},
+    {67,775,266},{67,780,268},{67,807,199},{68,775,7690},
+    {68,780,270},{68,803,7692},{68,807,7696},{68,813,7698},
+    {68,817,7694},{69,768,200},{69,769,201},{69,770,202},
+    {69,771,7868},{69,772,274},{69,774,276},{69,775,278},
+    {69,776,203},{69,777,7866},{69,780,282},{69,783,516},
+    {69,785,518},{69,803,7864},{69,807,552},{69,808,280},
+    {69,813,7704},{69,816,7706},{70,775,7710},{71,769,500},
+    {71,770,284},{71,772,7712},{71,774,286},{71,775,288},
+    {71,780,486},{71,807,290},{72,770,292},{72,775,7714},
+    {72,776,7718},{72,780,542},{72,803,7716},{72,807,7720},
+    {72,814,7722},{73,768,204},{73,769,205},{73,770,206},
+    {73,771,296},{73,772,298},{73,774,300},{73,775,304},
+    {73,776,207},{73,777,7880},{73,780,463},{73,783,520},
+    {73,785,522},{73,803,7882},{73,808,302},{73,816,7724},
+    {74,770,308},{75,769,7728},{75,780,488},{75,803,7730},
+    {75,807,310},{75,817,7732},{76,769,313},{76,780,317},
+    {76,803,7734},{76,807,315},{76,813,7740},{76,817,7738},
+    {77,769,7742},{77,775,7744},{77,803,7746},{78,768,504},
+    {78,769,323},{78,771,209},{78,775,7748},{78,780,327},
+    {78,803,7750},{78,807,325},{78,813,7754},{78,817,7752},
+    {79,768,210},{79,769,211},{79,770,212},{79,771,213},
+    {79,772,332},{79,774,334},{79,775,558},{79,776,214},
+    {79,777,7886},{79,779,336},{79,780,465},{79,783,524},
+    {79,785,526},{79,795,416},{79,803,7884},{79,808,490},
+    {80,769,7764},{80,775,7766},{82,769,340},{82,775,7768},
+    {82,780,344},{82,783,528},{82,785,530},{82,803,7770},
+    {82,807,342},{82,817,7774},{83,769,346},{83,770,348},
+    {83,775,7776},{83,780,352},{83,803,7778},{83,806,536},
+    {83,807,350},{84,775,7786},{84,780,356},{84,803,7788},
+    {84,806,538},{84,807,354},{84,813,7792},{84,817,7790},
+    {85,768,217},{85,769,218},{85,770,219},{85,771,360},
+    {85,772,362},{85,774,364},{85,776,220},{85,777,7910},
+    {85,778,366},{85,779,368},{85,780,467},{85,783,532},
+    {85,785,534},{85,795,431},{85,803,7908},{85,804,7794},
+    {85,808,370},{85,813,7798},{85,816,7796},{86,771,7804},
+    {86,803,7806},{87,768,7808},{87,769,7810},{87,770,372},
+    {87,775,7814},{87,776,7812},{87,803,7816},{88,775,7818},
+    {88,776,7820},{89,768,7922},{89,769,221},{89,770,374},
+    {89,771,7928},{89,772,562},{89,775,7822},{89,776,376},
+    {89,777,7926},{89,803,7924},{90,769,377},{90,770,7824},
+    {90,775,379},{90,780,381},{90,803,7826},{90,817,7828},
+    {97,768,224},{97,769,225},{97,770,226},{97,771,227},
+    {97,772,257},{97,774,259},{97,775,551},{97,776,228},
+    {97,777,7843},{97,778,229},{97,780,462},{97,783,513},
+    {97,785,515},{97,803,7841},{97,805,7681},{97,808,261},
+    {98,775,7683},{98,803,7685},{98,817,7687},{99,769,263},
+    {99,770,265},{99,775,267},{99,780,269},{99,807,231},
+    {100,775,7691},{100,780,271},{100,803,7693},{100,807,7697},
+    {100,813,7699},{100,817,7695},{101,768,232},{101,769,233},
+    {101,770,234},{101,771,7869},{101,772,275},{101,774,277},
+    {101,775,279},{101,776,235},{101,777,7867},{101,780,283},
+    {101,783,517},{101,785,519},{101,803,7865},{101,807,553},
+    {101,808,281},{101,813,7705},{101,816,7707},{102,775,7711},
+    {103,769,501},{103,770,285},{103,772,7713},{103,774,287},
+    {103,775,289},{103,780,487},{103,807,291},{104,770,293},
+    {104,775,7715},{104,776,7719},{104,780,543},{104,803,7717},
+    {104,807,7721},{104,814,7723},{104,817,7830},{105,768,236},
+    {105,769,237},{105,770,238},{105,771,297},{105,772,299},
+    {105,774,301},{105,776,239},{105,777,7881},{105,780,464},
+    {105,783,521},{105,785,523},{105,803,7883},{105,808,303},
+    {105,816,7725},{106,770,309},{106,780,496},{107,769,7729},
+    {107,780,489},{107,803,7731},{107,807,311},{107,817,7733},
+    {108,769,314},{108,780,318},{108,803,7735},{108,807,316},
+    {108,813,7741},{108,817,7739},{109,769,7743},{109,775,7745},
+    {109,803,7747},{110,768,505},{110,769,324},{110,771,241},
+    {110,775,7749},{110,780,328},{110,803,7751},{110,807,326},
+    {110,813,7755},{110,817,7753},{111,768,242},{111,769,243},
+    {111,770,244},{111,771,245},{111,772,333},{111,774,335},
+    {111,775,559},{111,776,246},{111,777,7887},{111,779,337},
+    {111,780,466},{111,783,525},{111,785,527},{111,795,417},
+    {111,803,7885},{111,808,491},{112,769,7765},{112,775,7767},
+    {114,769,341},{114,775,7769},{114,780,345},{114,783,529},
+    {114,785,531},{114,803,7771},{114,807,343},{114,817,7775},
+    {115,769,347},{115,770,349},{115,775,7777},{115,780,353},
+    {115,803,7779},{115,806,537},{115,807,351},{116,775,7787},
+    {116,776,7831},{116,780,357},{116,803,7789},{116,806,539},
+    {116,807,355},{116,813,7793},{116,817,7791},{117,768,249},
+    {117,769,250},{117,770,251},{117,771,361},{117,772,363},
+    {117,774,365},{117,776,252},{117,777,7911},{117,778,367},
+    {117,779,369},{117,780,468},{117,783,533},{117,785,535},
+    {117,795,432},{117,803,7909},{117,804,7795},{117,808,371},
+    {117,813,7799},{117,816,7797},{118,771,7805},{118,803,7807},
+    {119,768,7809},{119,769,7811},{119,770,373},{119,775,7815},
+    {119,776,7813},{119,778,7832},{119,803,7817},{120,775,7819},
+    {120,776,7821},{121,768,7923},{121,769,253},{121,770,375},
+    {121,771,7929},{121,772,563},{121,775,7823},{121,776,255},
+    {121,777,7927},{121,778,7833},{121,803,7925},{122,769,378},
+    {122,770,7825},{122,775,380},{122,780,382},{122,803,7827},
+    {122,817,7829},{168,768,8173},{168,769,901},{168,834,8129},
+    {194,768,7846},{194,769,7844},{194,771,7850},{194,777,7848},
+    {196,772,478},{197,769,506},{198,769,508},{198,772,482},
+    {199,769,7688},{202,768,7872},{202,769,7870},{202,771,7876},
+    {202,777,7874},{207,769,7726},{212,768,7890},{212,769,7888},
+    {212,771,7894},{212,777,7892},{213,769,7756},{213,772,556},
+    {213,776,7758},{214,772,554},{216,769,510},{220,768,475},
+    {220,769,471},{220,772,469},{220,780,473},{226,768,7847},
+    {226,769,7845},{226,771,7851},{226,777,7849},{228,772,479},
+    {229,769,507},{230,769,509},{230,772,483},{231,769,7689},
+    {234,768,7873},{234,769,7871},{234,771,7877},{234,777,7875},
+    {239,769,7727},{244,768,7891},{244,769,7889},{244,771,7895},
+    {244,777,7893},{245,769,7757},{245,772,557},{245,776,7759},
+    {246,772,555},{248,769,511},{252,768,476},{252,769,472},
+    {252,772,470},{252,780,474},{258,768,7856},{258,769,7854},
+    {258,771,7860},{258,777,7858},{259,768,7857},{259,769,7855},
+    {259,771,7861},{259,777,7859},{274,768,7700},{274,769,7702},
+    {275,768,7701},{275,769,7703},{332,768,7760},{332,769,7762},
+    {333,768,7761},{333,769,7763},{346,775,7780},{347,775,7781},
+    {352,775,7782},{353,775,7783},{360,769,7800},{361,769,7801},
+    {362,776,7802},{363,776,7803},{383,775,7835},{416,768,7900},
+    {416,769,7898},{416,771,7904},{416,777,7902},{416,803,7906},
+    {417,768,7901},{417,769,7899},{417,771,7905},{417,777,7903},
+    {417,803,7907},{431,768,7914},{431,769,7912},{431,771,7918},
+    {431,777,7916},{431,803,7920},{432,768,7915},{432,769,7913},
+    {432,771,7919},{432,777,7917},{432,803,7921},{439,780,494},
+    {490,772,492},{491,772,493},{550,772,480},{551,772,481},
+    {552,774,7708},{553,774,7709},{558,772,560},{559,772,561},
+    {658,780,495},{913,768,8122},{913,769,902},{913,772,8121},
+    {913,774,8120},{913,787,7944},{913,788,7945},{913,837,8124},
+    {917,768,8136},{917,769,904},{917,787,7960},{917,788,7961},
+    {919,768,8138},{919,769,905},{919,787,7976},{919,788,7977},
+    {919,837,8140},{921,768,8154},{921,769,906},{921,772,8153},
+    {921,774,8152},{921,776,938},{921,787,7992},{921,788,7993},
+    {927,768,8184},{927,769,908},{927,787,8008},{927,788,8009},
+    {929,788,8172},{933,768,8170},{933,769,910},{933,772,8169},
+    {933,774,8168},{933,776,939},{933,788,8025},{937,768,8186},
+    {937,769,911},{937,787,8040},{937,788,8041},{937,837,8188},
+    {940,837,8116},{942,837,8132},{945,768,8048},{945,769,940},
+    {945,772,8113},{945,774,8112},{945,787,7936},{945,788,7937},
+    {945,834,8118},{945,837,8115},{949,768,8050},{949,769,941},
+    {949,787,7952},{949,788,7953},{951,768,8052},{951,769,942},
+    {951,787,7968},{951,788,7969},{951,834,8134},{951,837,8131},
+    {953,768,8054},{953,769,943},{953,772,8145},{953,774,8144},
+    {953,776,970},{953,787,7984},{953,788,7985},{953,834,8150},
+    {959,768,8056},{959,769,972},{959,787,8000},{959,788,8001},
+    {961,787,8164},{961,788,8165},{965,768,8058},{965,769,973},
+    {965,772,8161},{965,774,8160},{965,776,971},{965,787,8016},
+    {965,788,8017},{965,834,8166},{969,768,8060},{969,769,974},
+    {969,787,8032},{969,788,8033},{969,834,8182},{969,837,8179},
+    {970,768,8146},{970,769,912},{970,834,8151},{971,768,8162},
+    {971,769,944},{971,834,8167},{974,837,8180},{978,769,979},
+    {978,776,980},{1030,776,1031},{1040,774,1232},{1040,776,1234},
+    {1043,769,1027},{1045,768,1024},{1045,774,1238},{1045,776,1025},
+    {1046,774,1217},{1046,776,1244},{1047,776,1246},{1048,768,1037},
+    {1048,772,1250},{1048,774,1049},{1048,776,1252},{1050,769,1036},
+    {1054,776,1254},{1059,772,1262},{1059,774,1038},{1059,776,1264},
+    {1059,779,1266},{1063,776,1268},{1067,776,1272},{1069,776,1260},
+    {1072,774,1233},{1072,776,1235},{1075,769,1107},{1077,768,1104},
+    {1077,774,1239},{1077,776,1105},{1078,774,1218},{1078,776,1245},
+    {1079,776,1247},{1080,768,1117},{1080,772,1251},{1080,774,1081},
+    {1080,776,1253},{1082,769,1116},{1086,776,1255},{1091,772,1263},
+    {1091,774,1118},{1091,776,1265},{1091,779,1267},{1095,776,1269},
+    {1099,776,1273},{1101,776,1261},{1110,776,1111},{1140,783,1142},
+    {1141,783,1143},{1240,776,1242},{1241,776,1243},{1256,776,1258},
+    {1257,776,1259},{1575,1619,1570},{1575,1620,1571},{1575,1621,1573},
+    {1608,1620,1572},{1610,1620,1574},{1729,1620,1730},{1746,1620,1747},
+    {1749,1620,1728},{2344,2364,2345},{2352,2364,2353},{2355,2364,2356},
+    {2503,2494,2507},{2503,2519,2508},{2887,2878,2891},{2887,2902,2888},
+    {2887,2903,2892},{2962,3031,2964},{3014,3006,3018},{3014,3031,3020},
+    {3015,3006,3019},{3142,3158,3144},{3263,3285,3264},{3270,3266,3274},
+    {3270,3285,3271},{3270,3286,3272},{3274,3285,3275},{3398,3390,3402},
+    {3398,3415,3404},{3399,3390,3403},{3545,3530,3546},{3545,3535,3548},
+    {3545,3551,3550},{3548,3530,3549},{4133,4142,4134},{6917,6965,6918},
+    {6919,6965,6920},{6921,6965,6922},{6923,6965,6924},{6925,6965,6926},
+    {6929,6965,6930},{6970,6965,6971},{6972,6965,6973},{6974,6965,6976},
+    {6975,6965,6977},{6978,6965,6979},{7734,772,7736},{7735,772,7737},
+    {7770,772,7772},{7771,772,7773},{7778,775,7784},{7779,775,7785},
+    {7840,770,7852},{7840,774,7862},{7841,770,7853},{7841,774,7863},
+    {7864,770,7878},{7865,770,7879},{7884,770,7896},{7885,770,7897},
+    {7936,768,7938},{7936,769,7940},{7936,834,7942},{7936,837,8064},
+    {7937,768,7939},{7937,769,7941},{7937,834,7943},{7937,837,8065},
+    {7938,837,8066},{7939,837,8067},{7940,837,8068},{7941,837,8069},
+    {7942,837,8070},{7943,837,8071},{7944,768,7946},{7944,769,7948},
+    {7944,834,7950},{7944,837,8072},{7945,768,7947},{7945,769,7949},
+    {7945,834,7951},{7945,837,8073},{7946,837,8074},{7947,837,8075},
+    {7948,837,8076},{7949,837,8077},{7950,837,8078},{7951,837,8079},
+    {7952,768,7954},{7952,769,7956},{7953,768,7955},{7953,769,7957},
+    {7960,768,7962},{7960,769,7964},{7961,768,7963},{7961,769,7965},
+    {7968,768,7970},{7968,769,7972},{7968,834,7974},{7968,837,8080},
+    {7969,768,7971},{7969,769,7973},{7969,834,7975},{7969,837,8081},
+    {7970,837,8082},{7971,837,8083},{7972,837,8084},{7973,837,8085},
+    {7974,837,8086},{7975,837,8087},{7976,768,7978},{7976,769,7980},
+    {7976,834,7982},{7976,837,8088},{7977,768,7979},{7977,769,7981},
+    {7977,834,7983},{7977,837,8089},{7978,837,8090},{7979,837,8091},
+    {7980,837,8092},{7981,837,8093},{7982,837,8094},{7983,837,8095},
+    {7984,768,7986},{7984,769,7988},{7984,834,7990},{7985,768,7987},
+    {7985,769,7989},{7985,834,7991},{7992,768,7994},{7992,769,7996},
+    {7992,834,7998},{7993,768,7995},{7993,769,7997},{7993,834,7999},
+    {8000,768,8002},{8000,769,8004},{8001,768,8003},{8001,769,8005},
+    {8008,768,8010},{8008,769,8012},{8009,768,8011},{8009,769,8013},
+    {8016,768,8018},{8016,769,8020},{8016,834,8022},{8017,768,8019},
+    {8017,769,8021},{8017,834,8023},{8025,768,8027},{8025,769,8029},
+    {8025,834,8031},{8032,768,8034},{8032,769,8036},{8032,834,8038},
+    {8032,837,8096},{8033,768,8035},{8033,769,8037},{8033,834,8039},
+    {8033,837,8097},{8034,837,8098},{8035,837,8099},{8036,837,8100},
+    {8037,837,8101},{8038,837,8102},{8039,837,8103},{8040,768,8042},
+    {8040,769,8044},{8040,834,8046},{8040,837,8104},{8041,768,8043},
+    {8041,769,8045},{8041,834,8047},{8041,837,8105},{8042,837,8106},
+    {8043,837,8107},{8044,837,8108},{8045,837,8109},{8046,837,8110},
+    {8047,837,8111},{8048,837,8114},{8052,837,8130},{8060,837,8178},
+    {8118,837,8119},{8127,768,8141},{8127,769,8142},{8127,834,8143},
+    {8134,837,8135},{8182,837,8183},{8190,768,8157},{8190,769,8158},
+    {8190,834,8159},{8592,824,8602},{8594,824,8603},{8596,824,8622},
+    {8656,824,8653},{8658,824,8655},{8660,824,8654},{8707,824,8708},
+    {8712,824,8713},{8715,824,8716},{8739,824,8740},{8741,824,8742},
+    {8764,824,8769},{8771,824,8772},{8773,824,8775},{8776,824,8777},
+    {8781,824,8813},{8801,824,8802},{8804,824,8816},{8805,824,8817},
+    {8818,824,8820},{8819,824,8821},{8822,824,8824},{8823,824,8825},
+    {8826,824,8832},{8827,824,8833},{8828,824,8928},{8829,824,8929},
+    {8834,824,8836},{8835,824,8837},{8838,824,8840},{8839,824,8841},
+    {8849,824,8930},{8850,824,8931},{8866,824,8876},{8872,824,8877},
+    {8873,824,8878},{8875,824,8879},{8882,824,8938},{8883,824,8939},
+    {8884,824,8940},{8885,824,8941},{12358,12441,12436},{12363,12441,12364},
+    {12365,12441,12366},{12367,12441,12368},{12369,12441,12370},{12371,12441,12372},
+    {12373,12441,12374},{12375,12441,12376},{12377,12441,12378},{12379,12441,12380},
+    {12381,12441,12382},{12383,12441,12384},{12385,12441,12386},{12388,12441,12389},
+    {12390,12441,12391},{12392,12441,12393},{12399,12441,12400},{12399,12442,12401},
+    {12402,12441,12403},{12402,12442,12404},{12405,12441,12406},{12405,12442,12407},
+    {12408,12441,12409},{12408,12442,12410},{12411,12441,12412},{12411,12442,12413},
+    {12445,12441,12446},{12454,12441,12532},{12459,12441,12460},{12461,12441,12462},
+    {12463,12441,12464},{12465,12441,12466},{12467,12441,12468},{12469,12441,12470},
+    {12471,12441,12472},{12473,12441,12474},{12475,12441,12476},{12477,12441,12478},
+    {12479,12441,12480},{12481,12441,12482},{12484,12441,12485},{12486,12441,12487},
+    {12488,12441,12489},{12495,12441,12496},{12495,12442,12497},{12498,12441,12499},
+    {12498,12442,12500},{12501,12441,12502},{12501,12442,12503},{12504,12441,12505},
+    {12504,12442,12506},{12507,12441,12508},{12507,12442,12509},{12527,12441,12535},
+    {12528,12441,12536},{12529,12441,12537},{12530,12441,12538},{12541,12441,12542},
+    {69785,69818,69786},{69787,69818,69788},{69797,69818,69803},{69937,69927,69934},
+    {69938,69927,69935},{70471,70462,70475},{70471,70487,70476},{70841,70832,70844},
+    {70841,70842,70843},{70841,70845,70846},{71096,71087,71098},{71097,71087,71099},
+    {71989,71984,71992},
+};
+
+static const unsigned int urlIdnaPool[7573] = {
+    97,98,99,100,101,102,103,104,105,106,
+    107,108,109,110,111,112,113,114,115,116,
+    117,118,119,120,121,122,32,32,776,32,
+    772,50,51,32,769,956,32,807,49,49,
+    8260,52,49,8260,50,51,8260,52,224,225,
+    226,227,228,229,230,231,232,233,234,235,
+    236,237,238,239,240,241,242,243,244,245,
+    246,248,249,250,251,252,253,254,257,259,
+    261,263,265,267,269,271,273,275,277,279,
+    281,283,285,287,289,291,293,295,297,299,
+    301,303,105,775,105,106,309,311,314,316,
+    318,108,183,322,324,326,328,700,110,331,
+    333,335,337,339,341,343,345,347,349,351,
+    353,355,357,359,361,363,365,367,369,371,
+    373,375,255,378,380,382,595,387,389,596,
+    392,598,599,396,477,601,603,402,608,611,
+    617,616,409,623,626,629,417,419,421,640,
+    424,643,429,648,432,650,651,436,438,658,
+    441,445,100,382,108,106,110,106,462,464,
+    466,468,470,472,474,476,479,481,483,485,
+    487,489,491,493,495,100,122,501,405,447,
+    505,507,509,511,513,515,517,519,521,523,
+    525,527,529,531,533,535,537,539,541,543,
+    414,547,549,551,553,555,557,559,561,563,
+    11365,572,410,11366,578,384,649,652,583,585,
+    587,589,591,614,633,635,641,32,774,32,
+    775,32,778,32,808,32,771,32,779,661,
+    768,769,787,776,769,953,881,883,697,887,
+    32,953,59,1011,32,776,769,940,183,941,
+    942,943,972,973,974,945,946,947,948,949,
+    950,951,952,954,955,957,958,959,960,961,
+    963,964,965,966,967,968,969,970,971,983,
+    985,987,989,991,993,995,997,999,1001,1003,
+    1005,1007,1016,1019,891,892,893,1104,1105,1106,
+    1107,1108,1109,1110,1111,1112,1113,1114,1115,1116,
+    1117,1118,1119,1072,1073,1074,1075,1076,1077,1078,
+    1079,1080,1081,1082,1083,1084,1085,1086,1087,1088,
+    1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,
+    1099,1100,1101,1102,1103,1121,1123,1125,1127,1129,
+    1131,1133,1135,1137,1139,1141,1143,1145,1147,1149,
+    1151,1153,1163,1165,1167,1169,1171,1173,1175,1177,
+    1179,1181,1183,1185,1187,1189,1191,1193,1195,1197,
+    1199,1201,1203,1205,1207,1209,1211,1213,1215,1218,
+    1220,1222,1224,1226,1228,1230,1233,1235,1237,1239,
+    1241,1243,1245,1247,1249,1251,1253,1255,1257,1259,
+    1261,1263,1265,1267,1269,1271,1273,1275,1277,1279,
+    1281,1283,1285,1287,1289,1291,1293,1295,1297,1299,
+    1301,1303,1305,1307,1309,1311,1313,1315,1317,1319,
+    1321,1323,1325,1327,1377,1378,1379,1380,1381,1382,
+    1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,
+    1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,
+    1403,1404,1405,1406,1407,1408,1409,1410,1411,1412,
+    1413,1414,1381,1410,1575,1652,1608,1652,1735,1652,
+    1610,1652,2325,2364,2326,2364,2327,2364,2332,2364,
+    2337,2364,2338,2364,2347,2364,2351,2364,2465,2492,
+    2466,2492,2479,2492,2610,2620,2616,2620,2582,2620,
+    2583,2620,2588,2620,2603,2620,2849,2876,2850,2876,
+    3661,3634,3789,3762,3755,3737,3755,3745,3851,3906,
+    4023,3916,4023,3921,4023,3926,4023,3931,4023,3904,
+    4021,3953,3954,3953,3956,4018,3968,4018,3953,3968,
+    4019,3968,4019,3953,3968,3953,3968,3986,4023,3996,
+    4023,4001,4023,4006,4023,4011,4023,3984,4021,11559,
+    11565,4316,5104,5105,5106,5107,5108,5109,42571,4304,
+    4305,4306,4307,4308,4309,4310,4311,4312,4313,4314,
+    4315,4317,4318,4319,4320,4321,4322,4323,4324,4325,
+    4326,4327,4328,4329,4330,4331,4332,4333,4334,4335,
+    4336,4337,4338,4339,4340,4341,4342,4343,4344,4345,
+    4346,4349,4350,4351,592,593,7426,604,7446,7447,
+    7453,7461,594,597,607,609,613,618,7547,669,
+    621,7557,671,625,624,627,628,632,642,427,
+    7452,656,657,7681,7683,7685,7687,7689,7691,7693,
+    7695,7697,7699,7701,7703,7705,7707,7709,7711,7713,
+    7715,7717,7719,7721,7723,7725,7727,7729,7731,7733,
+    7735,7737,7739,7741,7743,7745,7747,7749,7751,7753,
+    7755,7757,7759,7761,7763,7765,7767,7769,7771,7773,
+    7775,7777,7779,7781,7783,7785,7787,7789,7791,7793,
+    7795,7797,7799,7801,7803,7805,7807,7809,7811,7813,
+    7815,7817,7819,7821,7823,7825,7827,7829,97,702,
+    223,7841,7843,7845,7847,7849,7851,7853,7855,7857,
+    7859,7861,7863,7865,7867,7869,7871,7873,7875,7877,
+    7879,7881,7883,7885,7887,7889,7891,7893,7895,7897,
+    7899,7901,7903,7905,7907,7909,7911,7913,7915,7917,
+    7919,7921,7923,7925,7927,7929,7931,7933,7935,7936,
+    7937,7938,7939,7940,7941,7942,7943,7952,7953,7954,
+    7955,7956,7957,7968,7969,7970,7971,7972,7973,7974,
+    7975,7984,7985,7986,7987,7988,7989,7990,7991,8000,
+    8001,8002,8003,8004,8005,8017,8019,8021,8023,8032,
+    8033,8034,8035,8036,8037,8038,8039,7936,953,7937,
+    953,7938,953,7939,953,7940,953,7941,953,7942,
+    953,7943,953,7968,953,7969,953,7970,953,7971,
+    953,7972,953,7973,953,7974,953,7975,953,8032,
+    953,8033,953,8034,953,8035,953,8036,953,8037,
+    953,8038,953,8039,953,8048,953,945,953,940,
+    953,8118,953,8112,8113,8048,32,787,32,834,
+    32,776,834,8052,953,951,953,942,953,8134,
+    953,8050,8052,32,787,768,32,787,769,32,
+    787,834,912,8144,8145,8054,32,788,768,32,
+    788,769,32,788,834,944,8160,8161,8058,8165,
+    32,776,768,96,8060,953,969,953,974,953,
+    8182,953,8056,8060,32,788,8208,32,819,8242,
+    8242,8242,8242,8242,8245,8245,8245,8245,8245,33,
+    33,32,773,63,63,63,33,33,63,8242,
+    8242,8242,8242,48,52,53,54,55,56,57,
+    43,8722,61,40,41,114,115,97,47,99,
+    97,47,115,176,99,99,47,111,99,47,
+    117,176,102,110,111,115,109,116,101,108,
+    116,109,1488,1489,1490,1491,102,97,120,8721,
+    49,8260,55,49,8260,57,49,8260,49,48,
+    49,8260,51,50,8260,51,49,8260,53,50,
+    8260,53,51,8260,53,52,8260,53,49,8260,
+    54,53,8260,54,49,8260,56,51,8260,56,
+    53,8260,56,55,8260,56,49,8260,105,105,
+    105,105,105,105,118,118,105,118,105,105,
+    118,105,105,105,105,120,120,105,120,105,
+    105,48,8260,51,8747,8747,8747,8747,8747,8750,
+    8750,8750,8750,8750,12296,12297,49,48,49,49,
+    49,50,49,51,49,52,49,53,49,54,
+    49,55,49,56,49,57,50,48,40,49,
+    41,40,50,41,40,51,41,40,52,41,
+    40,53,41,40,54,41,40,55,41,40,
+    56,41,40,57,41,40,49,48,41,40,
+    49,49,41,40,49,50,41,40,49,51,
+    41,40,49,52,41,40,49,53,41,40,
+    49,54,41,40,49,55,41,40,49,56,
+    41,40,49,57,41,40,50,48,41,40,
+    97,41,40,98,41,40,99,41,40,100,
+    41,40,101,41,40,102,41,40,103,41,
+    40,104,41,40,105,41,40,106,41,40,
+    107,41,40,108,41,40,109,41,40,110,
+    41,40,111,41,40,112,41,40,113,41,
+    40,114,41,40,115,41,40,116,41,40,
+    117,41,40,118,41,40,119,41,40,120,
+    41,40,121,41,40,122,41,8747,8747,8747,
+    8747,58,58,61,61,61,61,61,61,10973,
+    824,11312,11313,11314,11315,11316,11317,11318,11319,11320,
+    11321,11322,11323,11324,11325,11326,11327,11328,11329,11330,
+    11331,11332,11333,11334,11335,11336,11337,11338,11339,11340,
+    11341,11342,11343,11344,11345,11346,11347,11348,11349,11350,
+    11351,11352,11353,11354,11355,11356,11357,11358,11359,11361,
+    619,7549,637,11368,11370,11372,11379,11382,575,576,
+    11393,11395,11397,11399,11401,11403,11405,11407,11409,11411,
+    11413,11415,11417,11419,11421,11423,11425,11427,11429,11431,
+    11433,11435,11437,11439,11441,11443,11445,11447,11449,11451,
+    11453,11455,11457,11459,11461,11463,11465,11467,11469,11471,
+    11473,11475,11477,11479,11481,11483,11485,11487,11489,11491,
+    11500,11502,11507,11617,27597,40863,19968,20008,20022,20031,
+    20057,20101,20108,20128,20154,20799,20837,20843,20866,20886,
+    20907,20960,20981,20992,21147,21241,21269,21274,21304,21313,
+    21340,21353,21378,21430,21448,21475,22231,22303,22763,22786,
+    22794,22805,22823,22899,23376,23424,23544,23567,23586,23608,
+    23662,23665,24027,24037,24049,24062,24178,24186,24191,24308,
+    24318,24331,24339,24400,24417,24435,24515,25096,25142,25163,
+    25903,25908,25991,26007,26020,26041,26080,26085,26352,26376,
+    26408,27424,27490,27513,27571,27595,27604,27611,27663,27668,
+    27700,28779,29226,29238,29243,29247,29255,29273,29275,29356,
+    29572,29577,29916,29926,29976,29983,29992,30000,30091,30098,
+    30326,30333,30382,30399,30446,30683,30690,30707,31034,31160,
+    31166,31348,31435,31481,31859,31992,32566,32593,32650,32701,
+    32769,32780,32786,32819,32895,32905,33251,33258,33267,33276,
+    33292,33307,33311,33390,33394,33400,34381,34411,34880,34892,
+    34915,35198,35211,35282,35328,35895,35910,35925,35960,35997,
+    36196,36208,36275,36523,36554,36763,36784,36789,37009,37193,
+    37318,37324,37329,38263,38272,38428,38582,38585,38632,38737,
+    38750,38754,38761,38859,38893,38899,38913,39080,39131,39135,
+    39318,39321,39340,39592,39640,39647,39717,39727,39730,39740,
+    39770,40165,40565,40575,40613,40635,40643,40653,40657,40697,
+    40701,40718,40723,40736,40763,40778,40786,40845,40860,40864,
+    46,12306,21316,21317,32,12441,32,12442,12424,12426,
+    12467,12488,4352,4353,4522,4354,4524,4525,4355,4356,
+    4357,4528,4529,4530,4531,4532,4533,4378,4358,4359,
+    4360,4385,4361,4362,4363,4364,4365,4366,4367,4368,
+    4369,4370,4449,4450,4451,4452,4453,4454,4455,4456,
+    4457,4458,4459,4460,4461,4462,4463,4464,4465,4466,
+    4467,4468,4469,4372,4373,4551,4552,4556,4558,4563,
+    4567,4569,4380,4573,4575,4381,4382,4384,4386,4387,
+    4391,4393,4395,4396,4397,4398,4399,4402,4406,4416,
+    4423,4428,4593,4594,4439,4440,4441,4484,4485,4488,
+    4497,4498,4500,4510,4513,19977,22235,19978,20013,19979,
+    30002,19993,19969,22825,22320,40,4352,41,40,4354,
+    41,40,4355,41,40,4357,41,40,4358,41,
+    40,4359,41,40,4361,41,40,4363,41,40,
+    4364,41,40,4366,41,40,4367,41,40,4368,
+    41,40,4369,41,40,4370,41,40,44032,41,
+    40,45208,41,40,45796,41,40,46972,41,40,
+    47560,41,40,48148,41,40,49324,41,40,50500,
+    41,40,51088,41,40,52264,41,40,52852,41,
+    40,53440,41,40,54028,41,40,54616,41,40,
+    51452,41,40,50724,51204,41,40,50724,54980,41,
+    40,19968,41,40,20108,41,40,19977,41,40,
+    22235,41,40,20116,41,40,20845,41,40,19971,
+    41,40,20843,41,40,20061,41,40,21313,41,
+    40,26376,41,40,28779,41,40,27700,41,40,
+    26408,41,40,37329,41,40,22303,41,40,26085,
+    41,40,26666,41,40,26377,41,40,31038,41,
+    40,21517,41,40,29305,41,40,36001,41,40,
+    31069,41,40,21172,41,40,20195,41,40,21628,
+    41,40,23398,41,40,30435,41,40,20225,41,
+    40,36039,41,40,21332,41,40,31085,41,40,
+    20241,41,40,33258,41,40,33267,41,21839,24188,
+    31631,112,116,101,50,49,50,50,50,51,
+    50,52,50,53,50,54,50,55,50,56,
+    50,57,51,48,51,49,51,50,51,51,
+    51,52,51,53,44032,45208,45796,46972,47560,48148,
+    49324,50500,51088,52264,52852,53440,54028,54616,52280,44256,
+    51452,51032,50864,20116,20845,19971,20061,26666,26377,31038,
+    21517,29305,36001,31069,21172,31192,30007,36969,20778,21360,
+    27880,38917,20241,20889,27491,24038,21491,21307,23447,23398,
+    30435,20225,36039,21332,22812,51,54,51,55,51,
+    56,51,57,52,48,52,49,52,50,52,
+    51,52,52,52,53,52,54,52,55,52,
+    56,52,57,53,48,49,26376,50,26376,51,
+    26376,52,26376,53,26376,54,26376,55,26376,56,
+    26376,57,26376,49,48,26376,49,49,26376,49,
+    50,26376,104,103,101,114,103,101,118,108,
+    116,100,12450,12452,12454,12456,12458,12459,12461,12463,
+    12465,12467,12469,12471,12473,12475,12477,12479,12481,12484,
+    12486,12488,12490,12491,12492,12493,12494,12495,12498,12501,
+    12504,12507,12510,12511,12512,12513,12514,12516,12518,12520,
+    12521,12522,12523,12524,12525,12527,12528,12529,12530,20196,
+    21644,12450,12497,12540,12488,12450,12523,12501,12449,12450,
+    12531,12506,12450,12450,12540,12523,12452,12491,12531,12464,
+    12452,12531,12481,12454,12457,12531,12456,12473,12463,12540,
+    12489,12456,12540,12459,12540,12458,12531,12473,12458,12540,
+    12512,12459,12452,12522,12459,12521,12483,12488,12459,12525,
+    12522,12540,12460,12525,12531,12460,12531,12510,12462,12460,
+    12462,12491,12540,12461,12517,12522,12540,12462,12523,12480,
+    12540,12461,12525,12461,12525,12464,12521,12512,12461,12525,
+    12513,12540,12488,12523,12461,12525,12527,12483,12488,12464,
+    12521,12512,12464,12521,12512,12488,12531,12463,12523,12476,
+    12452,12525,12463,12525,12540,12493,12465,12540,12473,12467,
+    12523,12490,12467,12540,12509,12469,12452,12463,12523,12469,
+    12531,12481,12540,12512,12471,12522,12531,12464,12475,12531,
+    12481,12475,12531,12488,12480,12540,12473,12487,12471,12489,
+    12523,12488,12531,12490,12494,12494,12483,12488,12495,12452,
+    12484,12497,12540,12475,12531,12488,12497,12540,12484,12496,
+    12540,12524,12523,12500,12450,12473,12488,12523,12500,12463,
+    12523,12500,12467,12499,12523,12501,12449,12521,12483,12489,
+    12501,12451,12540,12488,12502,12483,12471,12455,12523,12501,
+    12521,12531,12504,12463,12479,12540,12523,12506,12477,12506,
+    12491,12498,12504,12523,12484,12506,12531,12473,12506,12540,
+    12472,12505,12540,12479,12509,12452,12531,12488,12508,12523,
+    12488,12507,12531,12509,12531,12489,12507,12540,12523,12507,
+    12540,12531,12510,12452,12463,12525,12510,12452,12523,12510,
+    12483,12495,12510,12523,12463,12510,12531,12471,12519,12531,
+    12511,12463,12525,12531,12511,12522,12511,12522,12496,12540,
+    12523,12513,12460,12513,12460,12488,12531,12513,12540,12488,
+    12523,12516,12540,12489,12516,12540,12523,12518,12450,12531,
+    12522,12483,12488,12523,12522,12521,12523,12500,12540,12523,
+    12540,12502,12523,12524,12512,12524,12531,12488,12466,12531,
+    12527,12483,12488,48,28857,49,28857,50,28857,51,
+    28857,52,28857,53,28857,54,28857,55,28857,56,
+    28857,57,28857,49,48,28857,49,49,28857,49,
+    50,28857,49,51,28857,49,52,28857,49,53,
+    28857,49,54,28857,49,55,28857,49,56,28857,
+    49,57,28857,50,48,28857,50,49,28857,50,
+    50,28857,50,51,28857,50,52,28857,104,112,
+    97,100,97,97,117,98,97,114,111,118,
+    112,99,100,109,100,109,50,100,109,51,
+    105,117,24179,25104,26157,21644,22823,27491,26126,27835,
+    26666,24335,20250,31038,112,97,110,97,956,97,
+    109,97,107,97,107,98,109,98,103,98,
+    99,97,108,107,99,97,108,112,102,110,
+    102,956,102,956,103,109,103,107,103,104,
+    122,107,104,122,109,104,122,103,104,122,
+    116,104,122,956,108,109,108,100,108,107,
+    108,102,109,110,109,956,109,109,109,99,
+    109,107,109,109,109,50,99,109,50,109,
+    50,107,109,50,109,109,51,99,109,51,
+    109,51,107,109,51,109,8725,115,109,8725,
+    115,50,107,112,97,109,112,97,103,112,
+    97,114,97,100,114,97,100,8725,115,114,
+    97,100,8725,115,50,112,115,110,115,956,
+    115,109,115,112,118,110,118,956,118,109,
+    118,107,118,112,119,110,119,956,119,109,
+    119,107,119,107,969,109,969,98,113,99,
+    99,99,100,99,8725,107,103,100,98,103,
+    121,104,97,104,112,105,110,107,107,107,
+    116,108,109,108,110,108,111,103,108,120,
+    109,105,108,109,111,108,112,104,112,112,
+    109,112,114,115,114,115,118,119,98,118,
+    8725,109,97,8725,109,49,26085,50,26085,51,
+    26085,52,26085,53,26085,54,26085,55,26085,56,
+    26085,57,26085,49,48,26085,49,49,26085,49,
+    50,26085,49,51,26085,49,52,26085,49,53,
+    26085,49,54,26085,49,55,26085,49,56,26085,
+    49,57,26085,50,48,26085,50,49,26085,50,
+    50,26085,50,51,26085,50,52,26085,50,53,
+    26085,50,54,26085,50,55,26085,50,56,26085,
+    50,57,26085,51,48,26085,51,49,26085,103,
+    97,108,42561,42563,42565,42567,42569,42573,42575,42577,
+    42579,42581,42583,42585,42587,42589,42591,42593,42595,42597,
+    42599,42601,42603,42605,42625,42627,42629,42631,42633,42635,
+    42637,42639,42641,42643,42645,42647,42649,42651,42787,42789,
+    42791,42793,42795,42797,42799,42803,42805,42807,42809,42811,
+    42813,42815,42817,42819,42821,42823,42825,42827,42829,42831,
+    42833,42835,42837,42839,42841,42843,42845,42847,42849,42851,
+    42853,42855,42857,42859,42861,42863,42874,42876,7545,42879,
+    42881,42883,42885,42887,42892,42897,42899,42903,42905,42907,
+    42909,42911,42913,42915,42917,42919,42921,620,670,647,
+    43859,42933,42935,42937,42939,42941,42943,42945,42947,42900,
+    7566,42952,42954,42961,42967,42969,42998,43831,43858,653,
+    5024,5025,5026,5027,5028,5029,5030,5031,5032,5033,
+    5034,5035,5036,5037,5038,5039,5040,5041,5042,5043,
+    5044,5045,5046,5047,5048,5049,5050,5051,5052,5053,
+    5054,5055,5056,5057,5058,5059,5060,5061,5062,5063,
+    5064,5065,5066,5067,5068,5069,5070,5071,5072,5073,
+    5074,5075,5076,5077,5078,5079,5080,5081,5082,5083,
+    5084,5085,5086,5087,5088,5089,5090,5091,5092,5093,
+    5094,5095,5096,5097,5098,5099,5100,5101,5102,5103,
+    35912,26356,36040,28369,20018,21477,22865,21895,22856,25078,
+    30313,32645,34367,34746,35064,37007,27138,27931,28889,29662,
+    33853,37226,39409,20098,21365,27396,29211,34349,40478,23888,
+    28651,34253,35172,25289,33240,34847,24266,26391,28010,29436,
+    37070,20358,20919,21214,25796,27347,29200,30439,34310,34396,
+    36335,38706,39791,40442,30860,31103,32160,33737,37636,35542,
+    22751,24324,31840,32894,29282,30922,36034,38647,22744,23650,
+    27155,28122,28431,32047,32311,38475,21202,32907,20956,20940,
+    31260,32190,33777,38517,35712,25295,35582,20025,23527,24594,
+    29575,30064,21271,30971,20415,24489,19981,27852,25976,32034,
+    21443,22622,30465,33865,35498,27578,27784,25342,33509,25504,
+    30053,20142,20841,20937,26753,31975,33391,35538,37327,21237,
+    21570,24300,26053,28670,31018,38317,39530,40599,40654,26310,
+    27511,36706,24180,24976,25088,25754,28451,29001,29833,31178,
+    32244,32879,36646,34030,36899,37706,21015,21155,21693,28872,
+    35010,24265,24565,25467,27566,31806,29557,20196,22265,23994,
+    24604,29618,29801,32666,32838,37428,38646,38728,38936,20363,
+    31150,37300,38584,24801,20102,20698,23534,23615,26009,29134,
+    30274,34044,36988,26248,38446,21129,26491,26611,27969,28316,
+    29705,30041,30827,32016,39006,25134,38520,20523,23833,28138,
+    36650,24459,24900,26647,38534,21033,21519,23653,26131,26446,
+    26792,27877,29702,30178,32633,35023,35041,38626,21311,28346,
+    21533,29136,29848,34298,38563,40023,40607,26519,28107,33256,
+    31520,31890,29376,28825,35672,20160,33590,21050,20999,24230,
+    25299,31958,23429,27934,26292,36667,38477,24275,20800,21952,
+    22618,26228,20958,29482,30410,31036,31070,31077,31119,38742,
+    31934,34322,35576,36920,37117,39151,39164,39208,40372,37086,
+    38583,20398,20711,20813,21193,21220,21329,21917,22022,22120,
+    22592,22696,23652,24724,24936,24974,25074,25935,26082,26257,
+    26757,28023,28186,28450,29038,29227,29730,30865,31049,31048,
+    31056,31062,31117,31118,31296,31361,31680,32265,32321,32626,
+    32773,33261,33401,33879,35088,35222,35585,35641,36051,36104,
+    36790,38627,38911,38971,24693,148206,33304,20006,20917,20840,
+    20352,20805,20864,21191,21242,21845,21913,21986,22707,22852,
+    22868,23138,23336,24274,24281,24425,24493,24792,24910,24840,
+    24928,25140,25540,25628,25682,25942,26395,26454,28379,28363,
+    28702,30631,29237,29359,29809,29958,30011,30237,30239,30427,
+    30452,30538,30528,30924,31409,31867,32091,32574,33618,33775,
+    34681,35137,35206,35519,35531,35565,35722,36664,36978,37273,
+    37494,38524,38875,38923,39698,141386,141380,144341,15261,16408,
+    16441,152137,154832,163539,40771,40846,102,102,102,105,
+    102,108,102,102,105,102,102,108,115,116,
+    1396,1398,1396,1381,1396,1387,1406,1398,1396,1389,
+    1497,1460,1522,1463,1506,1492,1499,1500,1501,1512,
+    1514,1513,1473,1513,1474,1513,1468,1473,1513,1468,
+    1474,1488,1463,1488,1464,1488,1468,1489,1468,1490,
+    1468,1491,1468,1492,1468,1493,1468,1494,1468,1496,
+    1468,1497,1468,1498,1468,1499,1468,1500,1468,1502,
+    1468,1504,1468,1505,1468,1507,1468,1508,1468,1510,
+    1468,1511,1468,1512,1468,1513,1468,1514,1468,1493,
+    1465,1489,1471,1499,1471,1508,1471,1488,1500,1649,
+    1659,1662,1664,1658,1663,1657,1700,1702,1668,1667,
+    1670,1671,1677,1676,1678,1672,1688,1681,1705,1711,
+    1715,1713,1722,1723,1728,1729,1726,1746,1747,1709,
+    1735,1734,1736,1739,1733,1737,1744,1609,1574,1575,
+    1574,1749,1574,1608,1574,1735,1574,1734,1574,1736,
+    1574,1744,1574,1609,1740,1574,1580,1574,1581,1574,
+    1605,1574,1610,1576,1580,1576,1581,1576,1582,1576,
+    1605,1576,1609,1576,1610,1578,1580,1578,1581,1578,
+    1582,1578,1605,1578,1609,1578,1610,1579,1580,1579,
+    1605,1579,1609,1579,1610,1580,1581,1580,1605,1581,
+    1580,1581,1605,1582,1580,1582,1581,1582,1605,1587,
+    1580,1587,1581,1587,1582,1587,1605,1589,1581,1589,
+    1605,1590,1580,1590,1581,1590,1582,1590,1605,1591,
+    1581,1591,1605,1592,1605,1593,1580,1593,1605,1594,
+    1580,1594,1605,1601,1580,1601,1581,1601,1582,1601,
+    1605,1601,1609,1601,1610,1602,1581,1602,1605,1602,
+    1609,1602,1610,1603,1575,1603,1580,1603,1581,1603,
+    1582,1603,1604,1603,1605,1603,1609,1603,1610,1604,
+    1580,1604,1581,1604,1582,1604,1605,1604,1609,1604,
+    1610,1605,1580,1605,1581,1605,1582,1605,1605,1605,
+    1609,1605,1610,1606,1580,1606,1581,1606,1582,1606,
+    1605,1606,1609,1606,1610,1607,1580,1607,1605,1607,
+    1609,1607,1610,1610,1580,1610,1581,1610,1582,1610,
+    1605,1610,1609,1610,1610,1584,1648,1585,1648,1609,
+    1648,32,1612,1617,32,1613,1617,32,1614,1617,
+    32,1615,1617,32,1616,1617,32,1617,1648,1574,
+    1585,1574,1586,1574,1606,1576,1585,1576,1586,1576,
+    1606,1578,1585,1578,1586,1578,1606,1579,1585,1579,
+    1586,1579,1606,1605,1575,1606,1585,1606,1586,1606,
+    1606,1610,1585,1610,1586,1610,1606,1574,1582,1574,
+    1607,1576,1607,1578,1607,1589,1582,1604,1607,1606,
+    1607,1607,1648,1610,1607,1579,1607,1587,1607,1588,
+    1605,1588,1607,1600,1614,1617,1600,1615,1617,1600,
+    1616,1617,1591,1609,1591,1610,1593,1609,1593,1610,
+    1594,1609,1594,1610,1587,1609,1587,1610,1588,1609,
+    1588,1610,1581,1609,1581,1610,1580,1609,1580,1610,
+    1582,1609,1582,1610,1589,1609,1589,1610,1590,1609,
+    1590,1610,1588,1580,1588,1581,1588,1582,1588,1585,
+    1587,1585,1589,1585,1590,1585,1575,1611,1578,1580,
+    1605,1578,1581,1580,1578,1581,1605,1578,1582,1605,
+    1578,1605,1580,1578,1605,1581,1578,1605,1582,1580,
+    1605,1581,1581,1605,1610,1581,1605,1609,1587,1581,
+    1580,1587,1580,1581,1587,1580,1609,1587,1605,1581,
+    1587,1605,1580,1587,1605,1605,1589,1581,1581,1589,
+    1605,1605,1588,1581,1605,1588,1580,1610,1588,1605,
+    1582,1588,1605,1605,1590,1581,1609,1590,1582,1605,
+    1591,1605,1581,1591,1605,1605,1591,1605,1610,1593,
+    1580,1605,1593,1605,1605,1593,1605,1609,1594,1605,
+    1605,1594,1605,1610,1594,1605,1609,1601,1582,1605,
+    1602,1605,1581,1602,1605,1605,1604,1581,1605,1604,
+    1581,1610,1604,1581,1609,1604,1580,1580,1604,1582,
+    1605,1604,1605,1581,1605,1581,1580,1605,1581,1605,
+    1605,1581,1610,1605,1580,1581,1605,1580,1605,1605,
+    1582,1580,1605,1582,1605,1605,1580,1582,1607,1605,
+    1580,1607,1605,1605,1606,1581,1605,1606,1581,1609,
+    1606,1580,1605,1606,1580,1609,1606,1605,1610,1606,
+    1605,1609,1610,1605,1605,1576,1582,1610,1578,1580,
+    1610,1578,1580,1609,1578,1582,1610,1578,1582,1609,
+    1578,1605,1610,1578,1605,1609,1580,1605,1610,1580,
+    1581,1609,1580,1605,1609,1587,1582,1609,1589,1581,
+    1610,1588,1581,1610,1590,1581,1610,1604,1580,1610,
+    1604,1605,1610,1610,1581,1610,1610,1580,1610,1610,
+    1605,1610,1605,1605,1610,1602,1605,1610,1606,1581,
+    1610,1593,1605,1610,1603,1605,1610,1606,1580,1581,
+    1605,1582,1610,1604,1580,1605,1603,1605,1605,1580,
+    1581,1610,1581,1580,1610,1605,1580,1610,1601,1605,
+    1610,1576,1581,1610,1587,1582,1610,1606,1580,1610,
+    1589,1604,1746,1602,1604,1746,1575,1604,1604,1607,
+    1575,1603,1576,1585,1605,1581,1605,1583,1589,1604,
+    1593,1605,1585,1587,1608,1604,1593,1604,1610,1607,
+    1608,1587,1604,1605,1589,1604,1609,1589,1604,1609,
+    32,1575,1604,1604,1607,32,1593,1604,1610,1607,
+    32,1608,1587,1604,1605,1580,1604,32,1580,1604,
+    1575,1604,1607,1585,1740,1575,1604,44,12289,58,
+    33,63,12310,12311,8212,8211,95,123,125,12308,
+    12309,12304,12305,12298,12299,12300,12301,12302,12303,91,
+    93,35,38,42,45,60,62,92,36,37,
+    64,32,1611,1600,1611,32,1612,32,1613,32,
+    1614,1600,1614,32,1615,1600,1615,32,1616,1600,
+    1616,32,1617,1600,1617,32,1618,1600,1618,1569,
+    1570,1571,1572,1573,1574,1575,1576,1577,1578,1579,
+    1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,
+    1590,1591,1592,1593,1594,1601,1602,1603,1604,1605,
+    1606,1607,1608,1610,1604,1570,1604,1571,1604,1573,
+    1604,1575,34,39,47,94,124,126,10629,10630,
+    12539,12449,12451,12453,12455,12457,12515,12517,12519,12483,
+    12540,12531,12441,12442,162,163,172,166,165,8361,
+    9474,8592,8593,8594,8595,9632,9675,66600,66601,66602,
+    66603,66604,66605,66606,66607,66608,66609,66610,66611,66612,
+    66613,66614,66615,66616,66617,66618,66619,66620,66621,66622,
+    66623,66624,66625,66626,66627,66628,66629,66630,66631,66632,
+    66633,66634,66635,66636,66637,66638,66639,66776,66777,66778,
+    66779,66780,66781,66782,66783,66784,66785,66786,66787,66788,
+    66789,66790,66791,66792,66793,66794,66795,66796,66797,66798,
+    66799,66800,66801,66802,66803,66804,66805,66806,66807,66808,
+    66809,66810,66811,66967,66968,66969,66970,66971,66972,66973,
+    66974,66975,66976,66977,66979,66980,66981,66982,66983,66984,
+    66985,66986,66987,66988,66989,66990,66991,66992,66993,66995,
+    66996,66997,66998,66999,67000,67001,67003,67004,720,721,
+    665,675,43878,677,676,7569,600,606,681,612,
+    610,667,668,615,644,682,683,122628,42894,622,
+    122629,654,122630,630,631,634,122632,638,680,678,
+    43879,679,11377,655,673,674,664,448,449,450,
+    122634,122654,68800,68801,68802,68803,68804,68805,68806,68807,
+    68808,68809,68810,68811,68812,68813,68814,68815,68816,68817,
+    68818,68819,68820,68821,68822,68823,68824,68825,68826,68827,
+    68828,68829,68830,68831,68832,68833,68834,68835,68836,68837,
+    68838,68839,68840,68841,68842,68843,68844,68845,68846,68847,
+    68848,68849,68850,71872,71873,71874,71875,71876,71877,71878,
+    71879,71880,71881,71882,71883,71884,71885,71886,71887,71888,
+    71889,71890,71891,71892,71893,71894,71895,71896,71897,71898,
+    71899,71900,71901,71902,71903,93792,93793,93794,93795,93796,
+    93797,93798,93799,93800,93801,93802,93803,93804,93805,93806,
+    93807,93808,93809,93810,93811,93812,93813,93814,93815,93816,
+    93817,93818,93819,93820,93821,93822,93823,119127,119141,119128,
+    119141,119128,119141,119150,119128,119141,119151,119128,119141,119152,
+    119128,119141,119153,119128,119141,119154,119225,119141,119226,119141,
+    119225,119141,119150,119226,119141,119150,119225,119141,119151,119226,
+    119141,119151,305,567,8711,8706,1231,125218,125219,125220,
+    125221,125222,125223,125224,125225,125226,125227,125228,125229,125230,
+    125231,125232,125233,125234,125235,125236,125237,125238,125239,125240,
+    125241,125242,125243,125244,125245,125246,125247,125248,125249,125250,
+    125251,1646,1697,1647,48,44,49,44,50,44,
+    51,44,52,44,53,44,54,44,55,44,
+    56,44,57,44,12308,115,12309,119,122,104,
+    118,115,100,115,115,112,112,118,119,99,
+    109,99,109,100,109,114,100,106,12411,12363,
+    12467,12467,23383,21452,12487,22810,35299,20132,26144,28961,
+    21069,24460,20877,26032,21021,32066,36009,22768,21561,28436,
+    25237,25429,36938,25351,25171,31105,31354,21512,28288,30003,
+    21106,21942,37197,12308,26412,12309,12308,19977,12309,12308,
+    20108,12309,12308,23433,12309,12308,28857,12309,12308,25171,
+    12309,12308,30423,12309,12308,21213,12309,12308,25943,12309,
+    24471,21487,20029,20024,20033,131362,20320,20411,20482,20602,
+    20633,20687,13470,132666,20820,20836,20855,132380,13497,20839,
+    132427,20887,20900,20172,20908,168415,20995,13535,21051,21062,
+    21111,13589,21253,21254,21321,21338,21363,21373,21375,133676,
+    28784,21450,21471,133987,21483,21489,21510,21662,21560,21576,
+    21608,21666,21750,21776,21843,21859,21892,21931,21939,21954,
+    22294,22295,22097,22132,22766,22478,22516,22541,22411,22578,
+    22577,22700,136420,22770,22775,22790,22818,22882,136872,136938,
+    23020,23067,23079,23000,23142,14062,23304,23358,137672,23491,
+    23512,23539,138008,23551,23558,14209,23648,23744,23693,138724,
+    23875,138726,23918,23915,23932,24033,24034,14383,24061,24104,
+    24125,24169,14434,139651,14460,24240,24243,24246,172946,140081,
+    33281,24354,14535,144056,156122,24418,24427,14563,24474,24525,
+    24535,24569,24705,14650,14620,141012,24775,24904,24908,24954,
+    25010,24996,25007,25054,25104,25115,25181,25265,25300,25424,
+    142092,25405,25340,25448,25475,25572,142321,25634,25541,25513,
+    14894,25705,25726,25757,25719,14956,25964,143370,26083,26360,
+    26185,15129,15112,15076,20882,20885,26368,26268,32941,17369,
+    26401,26462,26451,144323,15177,26618,26501,26706,144493,26766,
+    26655,26900,26946,27043,27114,27304,145059,27355,15384,27425,
+    145575,27476,15438,27506,27551,27579,146061,138507,146170,27726,
+    146620,27839,27853,27751,27926,27966,28009,28024,28037,146718,
+    27956,28207,28270,15667,28359,147153,28153,28526,147294,147342,
+    28614,28729,28699,15766,28746,28797,28791,28845,132389,28997,
+    148067,29084,29224,29264,149000,29312,29333,149301,149524,29562,
+    29579,16044,29605,16056,29767,29788,29829,29898,16155,29988,
+    150582,30014,150674,139679,30224,151457,151480,151620,16380,16392,
+    151795,151794,151833,151859,30494,30495,30603,16454,16534,152605,
+    30798,16611,153126,153242,153285,31211,16687,31306,31311,153980,
+    154279,16898,154539,31686,31689,16935,154752,31954,17056,31976,
+    31971,32000,155526,32099,17153,32199,32258,32325,17204,156200,
+    156231,17241,156377,32634,156478,32661,32762,156890,156963,32864,
+    157096,32880,144223,17365,32946,33027,17419,33086,23221,157607,
+    157621,144275,144284,33284,36766,17515,33425,33419,33437,21171,
+    33457,33459,33469,33510,158524,33565,33635,33709,33571,33725,
+    33767,33619,33738,33740,33756,158774,159083,158933,17707,34033,
+    34035,34070,160714,34148,159532,17757,17761,159665,159954,17771,
+    34384,34407,34409,34473,34440,34574,34530,34600,34667,34694,
+    34785,34817,17913,34912,161383,35031,35038,17973,35066,13499,
+    161966,162150,18110,18119,35488,162984,36011,36033,36123,36215,
+    163631,133124,36299,36284,36336,133342,36564,165330,165357,37012,
+    37105,37137,165678,37147,37432,37591,37592,37500,37881,37909,
+    166906,38283,18837,38327,167287,18918,38595,23986,38691,168261,
+    168474,19054,19062,38880,168970,19122,169110,38953,169398,39138,
+    19251,39209,39335,39362,39422,19406,170800,40000,40189,19662,
+    19693,40295,172238,19704,172293,172558,172689,19798,40702,40709,
+    40719,40726,173568,65,768,65,769,65,770,65,
+    771,65,776,65,778,67,807,69,768,69,
+    769,69,770,69,776,73,768,73,769,73,
+    770,73,776,78,771,79,768,79,769,79,
+    770,79,771,79,776,85,768,85,769,85,
+    770,85,776,89,769,97,768,97,769,97,
+    770,97,771,97,776,97,778,99,807,101,
+    768,101,769,101,770,101,776,105,768,105,
+    769,105,770,105,776,110,771,111,768,111,
+    769,111,770,111,771,111,776,117,768,117,
+    769,117,770,117,776,121,769,121,776,65,
+    772,97,772,65,774,97,774,65,808,97,
+    808,67,769,99,769,67,770,99,770,67,
+    775,99,775,67,780,99,780,68,780,100,
+    780,69,772,101,772,69,774,101,774,69,
+    775,101,775,69,808,101,808,69,780,101,
+    780,71,770,103,770,71,774,103,774,71,
+    775,103,775,71,807,103,807,72,770,104,
+    770,73,771,105,771,73,772,105,772,73,
+    774,105,774,73,808,105,808,73,775,74,
+    770,106,770,75,807,107,807,76,769,108,
+    769,76,807,108,807,76,780,108,780,78,
+    769,110,769,78,807,110,807,78,780,110,
+    780,79,772,111,772,79,774,111,774,79,
+    779,111,779,82,769,114,769,82,807,114,
+    807,82,780,114,780,83,769,115,769,83,
+    770,115,770,83,807,115,807,83,780,115,
+    780,84,807,116,807,84,780,116,780,85,
+    771,117,771,85,772,117,772,85,774,117,
+    774,85,778,117,778,85,779,117,779,85,
+    808,117,808,87,770,119,770,89,770,121,
+    770,89,776,90,769,122,769,90,775,122,
+    775,90,780,122,780,79,795,111,795,85,
+    795,117,795,65,780,97,780,73,780,105,
+    780,79,780,111,780,85,780,117,780,85,
+    776,772,117,776,772,85,776,769,117,776,
+    769,85,776,780,117,776,780,85,776,768,
+    117,776,768,65,776,772,97,776,772,65,
+    775,772,97,775,772,198,772,230,772,71,
+    780,103,780,75,780,107,780,79,808,111,
+    808,79,808,772,111,808,772,439,780,658,
+    780,106,780,71,769,103,769,78,768,110,
+    768,65,778,769,97,778,769,198,769,230,
+    769,216,769,248,769,65,783,97,783,65,
+    785,97,785,69,783,101,783,69,785,101,
+    785,73,783,105,783,73,785,105,785,79,
+    783,111,783,79,785,111,785,82,783,114,
+    783,82,785,114,785,85,783,117,783,85,
+    785,117,785,83,806,115,806,84,806,116,
+    806,72,780,104,780,65,775,97,775,69,
+    807,101,807,79,776,772,111,776,772,79,
+    771,772,111,771,772,79,775,111,775,79,
+    775,772,111,775,772,89,772,121,772,168,
+    769,913,769,917,769,919,769,921,769,927,
+    769,933,769,937,769,953,776,769,921,776,
+    933,776,945,769,949,769,951,769,953,769,
+    965,776,769,953,776,965,776,959,769,965,
+    769,969,769,978,769,978,776,1045,768,1045,
+    776,1043,769,1030,776,1050,769,1048,768,1059,
+    774,1048,774,1080,774,1077,768,1077,776,1075,
+    769,1110,776,1082,769,1080,768,1091,774,1140,
+    783,1141,783,1046,774,1078,774,1040,774,1072,
+    774,1040,776,1072,776,1045,774,1077,774,1240,
+    776,1241,776,1046,776,1078,776,1047,776,1079,
+    776,1048,772,1080,772,1048,776,1080,776,1054,
+    776,1086,776,1256,776,1257,776,1069,776,1101,
+    776,1059,772,1091,772,1059,776,1091,776,1059,
+    779,1091,779,1063,776,1095,776,1067,776,1099,
+    776,1575,1619,1575,1620,1608,1620,1575,1621,1610,
+    1620,1749,1620,1729,1620,1746,1620,2344,2364,2352,
+    2364,2355,2364,2503,2494,2503,2519,2887,2902,2887,
+    2878,2887,2903,2962,3031,3014,3006,3015,3006,3014,
+    3031,3142,3158,3263,3285,3270,3285,3270,3286,3270,
+    3266,3270,3266,3285,3398,3390,3399,3390,3398,3415,
+    3545,3530,3545,3535,3545,3535,3530,3545,3551,4133,
+    4142,6917,6965,6919,6965,6921,6965,6923,6965,6925,
+    6965,6929,6965,6970,6965,6972,6965,6974,6965,6975,
+    6965,6978,6965,65,805,97,805,66,775,98,
+    775,66,803,98,803,66,817,98,817,67,
+    807,769,99,807,769,68,775,100,775,68,
+    803,100,803,68,817,100,817,68,807,100,
+    807,68,813,100,813,69,772,768,101,772,
+    768,69,772,769,101,772,769,69,813,101,
+    813,69,816,101,816,69,807,774,101,807,
+    774,70,775,102,775,71,772,103,772,72,
+    775,104,775,72,803,104,803,72,776,104,
+    776,72,807,104,807,72,814,104,814,73,
+    816,105,816,73,776,769,105,776,769,75,
+    769,107,769,75,803,107,803,75,817,107,
+    817,76,803,108,803,76,803,772,108,803,
+    772,76,817,108,817,76,813,108,813,77,
+    769,109,769,77,775,109,775,77,803,109,
+    803,78,775,110,775,78,803,110,803,78,
+    817,110,817,78,813,110,813,79,771,769,
+    111,771,769,79,771,776,111,771,776,79,
+    772,768,111,772,768,79,772,769,111,772,
+    769,80,769,112,769,80,775,112,775,82,
+    775,114,775,82,803,114,803,82,803,772,
+    114,803,772,82,817,114,817,83,775,115,
+    775,83,803,115,803,83,769,775,115,769,
+    775,83,780,775,115,780,775,83,803,775,
+    115,803,775,84,775,116,775,84,803,116,
+    803,84,817,116,817,84,813,116,813,85,
+    804,117,804,85,816,117,816,85,813,117,
+    813,85,771,769,117,771,769,85,772,776,
+    117,772,776,86,771,118,771,86,803,118,
+    803,87,768,119,768,87,769,119,769,87,
+    776,119,776,87,775,119,775,87,803,119,
+    803,88,775,120,775,88,776,120,776,89,
+    775,121,775,90,770,122,770,90,803,122,
+    803,90,817,122,817,104,817,116,776,119,
+    778,121,778,383,775,65,803,97,803,65,
+    777,97,777,65,770,769,97,770,769,65,
+    770,768,97,770,768,65,770,777,97,770,
+    777,65,770,771,97,770,771,65,803,770,
+    97,803,770,65,774,769,97,774,769,65,
+    774,768,97,774,768,65,774,777,97,774,
+    777,65,774,771,97,774,771,65,803,774,
+    97,803,774,69,803,101,803,69,777,101,
+    777,69,771,101,771,69,770,769,101,770,
+    769,69,770,768,101,770,768,69,770,777,
+    101,770,777,69,770,771,101,770,771,69,
+    803,770,101,803,770,73,777,105,777,73,
+    803,105,803,79,803,111,803,79,777,111,
+    777,79,770,769,111,770,769,79,770,768,
+    111,770,768,79,770,777,111,770,777,79,
+    770,771,111,770,771,79,803,770,111,803,
+    770,79,795,769,111,795,769,79,795,768,
+    111,795,768,79,795,777,111,795,777,79,
+    795,771,111,795,771,79,795,803,111,795,
+    803,85,803,117,803,85,777,117,777,85,
+    795,769,117,795,769,85,795,768,117,795,
+    768,85,795,777,117,795,777,85,795,771,
+    117,795,771,85,795,803,117,795,803,89,
+    768,121,768,89,803,121,803,89,777,121,
+    777,89,771,121,771,945,787,945,788,945,
+    787,768,945,788,768,945,787,769,945,788,
+    769,945,787,834,945,788,834,913,787,913,
+    788,913,787,768,913,788,768,913,787,769,
+    913,788,769,913,787,834,913,788,834,949,
+    787,949,788,949,787,768,949,788,768,949,
+    787,769,949,788,769,917,787,917,788,917,
+    787,768,917,788,768,917,787,769,917,788,
+    769,951,787,951,788,951,787,768,951,788,
+    768,951,787,769,951,788,769,951,787,834,
+    951,788,834,919,787,919,788,919,787,768,
+    919,788,768,919,787,769,919,788,769,919,
+    787,834,919,788,834,953,787,953,788,953,
+    787,768,953,788,768,953,787,769,953,788,
+    769,953,787,834,953,788,834,921,787,921,
+    788,921,787,768,921,788,768,921,787,769,
+    921,788,769,921,787,834,921,788,834,959,
+    787,959,788,959,787,768,959,788,768,959,
+    787,769,959,788,769,927,787,927,788,927,
+    787,768,927,788,768,927,787,769,927,788,
+    769,965,787,965,788,965,787,768,965,788,
+    768,965,787,769,965,788,769,965,787,834,
+    965,788,834,933,788,933,788,768,933,788,
+    769,933,788,834,969,787,969,788,969,787,
+    768,969,788,768,969,787,769,969,788,769,
+    969,787,834,969,788,834,937,787,937,788,
+    937,787,768,937,788,768,937,787,769,937,
+    788,769,937,787,834,937,788,834,945,768,
+    949,768,951,768,953,768,959,768,965,768,
+    969,768,945,787,837,945,788,837,945,787,
+    768,837,945,788,768,837,945,787,769,837,
+    945,788,769,837,945,787,834,837,945,788,
+    834,837,913,787,837,913,788,837,913,787,
+    768,837,913,788,768,837,913,787,769,837,
+    913,788,769,837,913,787,834,837,913,788,
+    834,837,951,787,837,951,788,837,951,787,
+    768,837,951,788,768,837,951,787,769,837,
+    951,788,769,837,951,787,834,837,951,788,
+    834,837,919,787,837,919,788,837,919,787,
+    768,837,919,788,768,837,919,787,769,837,
+    919,788,769,837,919,787,834,837,919,788,
+    834,837,969,787,837,969,788,837,969,787,
+    768,837,969,788,768,837,969,787,769,837,
+    969,788,769,837,969,787,834,837,969,788,
+    834,837,937,787,837,937,788,837,937,787,
+    768,837,937,788,768,837,937,787,769,837,
+    937,788,769,837,937,787,834,837,937,788,
+    834,837,945,774,945,772,945,768,837,945,
+    837,945,769,837,945,834,945,834,837,913,
+    774,913,772,913,768,913,837,168,834,951,
+    768,837,951,837,951,769,837,951,834,951,
+    834,837,917,768,919,768,919,837,8127,768,
+    8127,769,8127,834,953,774,953,772,953,776,
+    768,953,834,953,776,834,921,774,921,772,
+    921,768,8190,768,8190,769,8190,834,965,774,
+    965,772,965,776,768,961,787,961,788,965,
+    834,965,776,834,933,774,933,772,933,768,
+    929,788,168,768,969,768,837,969,837,969,
+    769,837,969,834,969,834,837,927,768,937,
+    768,937,837,180,8194,8195,937,75,8592,824,
+    8594,824,8596,824,8656,824,8660,824,8658,824,
+    8707,824,8712,824,8715,824,8739,824,8741,824,
+    8764,824,8771,824,8773,824,8776,824,61,824,
+    8801,824,8781,824,60,824,62,824,8804,824,
+    8805,824,8818,824,8819,824,8822,824,8823,824,
+    8826,824,8827,824,8834,824,8835,824,8838,824,
+    8839,824,8866,824,8872,824,8873,824,8875,824,
+    8828,824,8829,824,8849,824,8850,824,8882,824,
+    8883,824,8884,824,8885,824,12363,12441,12365,12441,
+    12367,12441,12369,12441,12371,12441,12373,12441,12375,12441,
+    12377,12441,12379,12441,12381,12441,12383,12441,12385,12441,
+    12388,12441,12390,12441,12392,12441,12399,12441,12399,12442,
+    12402,12441,12402,12442,12405,12441,12405,12442,12408,12441,
+    12408,12442,12411,12441,12411,12442,12358,12441,12445,12441,
+    12459,12441,12461,12441,12463,12441,12465,12441,12467,12441,
+    12469,12441,12471,12441,12473,12441,12475,12441,12477,12441,
+    12479,12441,12481,12441,12484,12441,12486,12441,12488,12441,
+    12495,12441,12495,12442,12498,12441,12498,12442,12501,12441,
+    12501,12442,12504,12441,12504,12442,12507,12441,12507,12442,
+    12454,12441,12527,12441,12528,12441,12529,12441,12530,12441,
+    12541,12441,69785,69818,69787,69818,69797,69818,69937,69927,
+    69938,69927,70471,70462,70471,70487,70841,70842,70841,70832,
+    70841,70845,71096,71087,71097,71087,71989,71984,14076,24403,
+    148395,31470,17879,
+};
+
@@ -0,0 +1,11577 @@
+// Generated by scripts/generate-psl.py from the Public Suffix List,
+// https://publicsuffix.org/list/public_suffix_list.dat. Do not edit.
+// 9506 rules, 10168 suffixes.
+
+#define URL_PSL_PRESENT 1
+#define URL_PSL_RULE 2
+#define URL_PSL_WILDCARD 4
+#define URL_PSL_EXCEPTION 8
+#define URL_PSL_LEN_BITS 8
+#define URL_PSL_HASH_BITS 15
+#define URL_PSL_FNV_OFFSET 2166136261u
+#define URL_PSL_FNV_PRIME 16777619u
+
+static const unsigned char urlPslPool[119406] = {
+    48,46,98,103,0,48,48,49,119,119,119,46,99,111,109,0,
+    48,101,46,118,99,0,48,101,109,109,46,99,111,109,0,49,
+    46,97,122,117,114,101,115,116,97,116,105,99,97,112,112,115,
+    46,110,101,116,0,49,46,98,103,0,49,50,51,104,106,101,
+    109,109,101,115,105,100,101,46,100,107,0,49,50,51,104,106,
+    101,109,109,101,115,105,100,101,46,110,111,0,49,50,51,104,
+    111,109,101,112,97,103,101,46,105,116,0,49,50,51,107,111,
+    116,105,115,105,118,117,46,102,105,0,49,50,51,109,105,110,
+    115,105,100,97,46,115,101,0,49,50,51,109,105,119,101,98,
+    46,101,115,0,49,50,51,112,97,103,105,110,97,119,101,98,
+    46,112,116,0,49,50,51,115,97,105,116,46,114,117,0,49,
+    50,51,115,105,116,101,119,101,98,46,102,114,0,49,50,51,
+    119,101,98,115,101,105,116,101,46,97,116,0,49,50,51,119,
+    101,98,115,101,105,116,101,46,100,101,0,49,50,51,119,101,
+    98,115,105,116,101,46,98,101,0,49,50,51,119,101,98,115,
+    105,116,101,46,99,104,0,49,50,51,119,101,98,115,105,116,
+    101,46,108,117,0,49,50,51,119,101,98,115,105,116,101,46,
+    110,108,0,49,50,104,112,46,97,116,0,49,50,104,112,46,
+    99,104,0,49,50,104,112,46,100,101,0,49,51,51,55,46,
+    112,105,99,116,117,114,101,115,0,49,54,45,98,46,105,116,
+    0,49,107,97,112,112,46,99,111,109,0,50,46,97,122,117,
+    114,101,115,116,97,116,105,99,97,112,112,115,46,110,101,116,
+    0,50,46,98,103,0,50,48,48,48,46,104,117,0,50,48,
+    51,56,46,105,111,0,50,105,120,46,97,116,0,50,105,120,
+    46,99,104,0,50,105,120,46,100,101,0,51,46,98,103,0,
+    51,50,45,98,46,105,116,0,51,117,116,105,108,105,116,105,
+    101,115,46,99,111,109,0,52,46,98,103,0,52,108,105,109,
+    97,46,97,116,0,52,108,105,109,97,46,99,104,0,52,108,
+    105,109,97,46,100,101,0,52,117,46,99,111,109,0,53,46,
+    98,103,0,53,103,46,105,110,0,54,46,98,103,0,54,49,
+    49,46,116,111,0,54,52,45,98,46,105,116,0,54,103,46,
+    105,110,0,55,46,98,103,0,56,46,98,103,0,57,46,98,
+    103,0,57,103,117,97,99,117,46,98,114,0,97,46,98,103,
+    0,97,46,112,114,111,100,46,102,97,115,116,108,121,46,110,
+    101,116,0,97,46,114,117,110,46,97,112,112,0,97,46,115,
+    101,0,97,46,115,115,108,46,102,97,115,116,108,121,46,110,
+    101,116,0,97,97,97,0,97,97,97,46,112,114,111,0,97,
+    97,114,98,111,114,116,101,46,110,111,0,97,97,114,112,0,
+    97,98,46,99,97,0,97,98,97,114,116,104,0,97,98,97,
+    115,104,105,114,105,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,97,98,98,0,97,98,98,111,116,116,0,97,98,98,
+    118,105,101,0,97,98,99,0,97,98,99,46,98,114,0,97,
+    98,101,110,111,46,111,115,97,107,97,46,106,112,0,97,98,
+    105,107,111,46,99,104,105,98,97,46,106,112,0,97,98,105,
+    114,97,46,104,111,107,107,97,105,100,111,46,106,112,0,97,
+    98,107,104,97,122,105,97,46,115,117,0,97,98,108,101,0,
+    97,98,111,46,112,97,0,97,98,111,103,97,100,111,0,97,
+    98,114,46,105,116,0,97,98,114,117,122,122,111,46,105,116,
+    0,97,98,117,46,121,97,109,97,103,117,99,104,105,46,106,
+    112,0,97,98,117,100,104,97,98,105,0,97,99,46,97,101,
+    0,97,99,46,98,101,0,97,99,46,99,105,0,97,99,46,
+    99,110,0,97,99,46,99,114,0,97,99,46,99,121,0,97,
+    99,46,102,106,0,97,99,46,103,110,0,97,99,46,103,111,
+    118,46,98,114,0,97,99,46,105,100,0,97,99,46,105,108,
+    0,97,99,46,105,109,0,97,99,46,105,110,0,97,99,46,
+    105,114,0,97,99,46,106,112,0,97,99,46,107,101,0,97,
+    99,46,107,114,0,97,99,46,108,101,103,46,98,114,0,97,
+    99,46,108,107,0,97,99,46,108,115,0,97,99,46,109,97,
+    0,97,99,46,109,101,0,97,99,46,109,117,0,97,99,46,
+    109,119,0,97,99,46,109,122,0,97,99,46,110,105,0,97,
+    99,46,110,122,0,97,99,46,112,97,0,97,99,46,112,114,
+    0,97,99,46,114,115,0,97,99,46,114,117,0,97,99,46,
+    114,119,0,97,99,46,115,101,0,97,99,46,115,122,0,97,
+    99,46,116,104,0,97,99,46,116,106,0,97,99,46,116,122,
+    0,97,99,46,117,103,0,97,99,46,117,107,0,97,99,46,
+    118,110,0,97,99,46,122,97,0,97,99,46,122,109,0,97,
+    99,46,122,119,0,97,99,97,46,112,114,111,0,97,99,97,
+    100,101,109,105,97,46,98,111,0,97,99,97,100,101,109,121,
+    46,109,117,115,101,117,109,0,97,99,99,101,110,116,117,114,
+    101,0,97,99,99,101,115,115,99,97,109,46,111,114,103,0,
+    97,99,99,105,100,101,110,116,45,105,110,118,101,115,116,105,
+    103,97,116,105,111,110,46,97,101,114,111,0,97,99,99,105,
+    100,101,110,116,45,112,114,101,118,101,110,116,105,111,110,46,
+    97,101,114,111,0,97,99,99,111,117,110,116,97,110,116,0,
+    97,99,99,111,117,110,116,97,110,116,115,0,97,99,99,116,
+    46,112,114,111,0,97,99,104,105,46,110,97,103,97,110,111,
+    46,106,112,0,97,99,111,0,97,99,116,46,97,117,0,97,
+    99,116,46,101,100,117,46,97,117,0,97,99,116,105,118,101,
+    116,114,97,105,108,46,98,105,122,0,97,99,116,111,114,0,
+    97,100,46,106,112,0,97,100,97,99,104,105,46,116,111,107,
+    121,111,46,106,112,0,97,100,105,109,111,46,99,111,46,117,
+    107,0,97,100,109,46,98,114,0,97,100,111,98,101,97,101,
+    109,99,108,111,117,100,46,110,101,116,0,97,100,111,98,101,
+    105,111,45,115,116,97,116,105,99,46,110,101,116,0,97,100,
+    111,98,101,105,111,114,117,110,116,105,109,101,46,110,101,116,
+    0,97,100,115,0,97,100,117,108,116,0,97,100,117,108,116,
+    46,104,116,0,97,100,118,46,98,114,0,97,100,118,46,109,
+    122,0,97,100,118,105,115,111,114,46,119,115,0,97,100,121,
+    103,101,121,97,46,114,117,0,97,100,121,103,101,121,97,46,
+    115,117,0,97,101,46,111,114,103,0,97,101,103,0,97,101,
+    106,114,105,101,46,110,111,0,97,101,114,111,46,109,118,0,
+    97,101,114,111,46,116,116,0,97,101,114,111,98,97,116,105,
+    99,46,97,101,114,111,0,97,101,114,111,99,108,117,98,46,
+    97,101,114,111,0,97,101,114,111,100,114,111,109,101,46,97,
+    101,114,111,0,97,101,114,111,112,111,114,116,46,102,114,0,
+    97,101,116,110,97,0,97,102,102,105,110,105,116,121,108,111,
+    116,116,101,114,121,46,111,114,103,46,117,107,0,97,102,106,
+    111,114,100,46,110,111,0,97,102,108,0,97,102,114,105,99,
+    97,0,97,102,114,105,99,97,46,98,106,0,97,102,114,105,
+    99,97,46,99,111,109,0,97,103,46,105,116,0,97,103,97,
+    46,110,105,105,103,97,116,97,46,106,112,0,97,103,97,107,
+    104,97,110,0,97,103,97,110,111,46,110,105,105,103,97,116,
+    97,46,106,112,0,97,103,100,101,110,101,115,46,110,111,0,
+    97,103,101,109,97,116,115,117,46,110,97,103,97,110,111,46,
+    106,112,0,97,103,101,110,99,121,0,97,103,101,110,116,115,
+    46,97,101,114,111,0,97,103,114,46,98,114,0,97,103,114,
+    97,114,46,104,117,0,97,103,114,105,99,46,122,97,0,97,
+    103,114,105,99,117,108,116,117,114,101,46,109,117,115,101,117,
+    109,0,97,103,114,105,103,101,110,116,111,46,105,116,0,97,
+    103,114,111,46,98,106,0,97,103,114,111,46,98,111,0,97,
+    103,114,111,46,112,108,0,97,103,117,110,105,46,111,107,105,
+    110,97,119,97,46,106,112,0,97,104,46,99,110,0,97,105,
+    46,105,110,0,97,105,98,101,116,115,117,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,97,105,100,46,112,108,0,97,
+    105,103,0,97,105,107,97,119,97,46,107,97,110,97,103,97,
+    119,97,46,106,112,0,97,105,110,97,110,46,101,104,105,109,
+    101,46,106,112,0,97,105,111,105,46,104,121,111,103,111,46,
+    106,112,0,97,105,112,46,101,101,0,97,105,114,45,115,117,
+    114,118,101,105,108,108,97,110,99,101,46,97,101,114,111,0,
+    97,105,114,45,116,114,97,102,102,105,99,45,99,111,110,116,
+    114,111,108,46,97,101,114,111,0,97,105,114,46,109,117,115,
+    101,117,109,0,97,105,114,98,117,115,0,97,105,114,99,114,
+    97,102,116,46,97,101,114,111,0,97,105,114,102,111,114,99,
+    101,0,97,105,114,103,117,97,114,100,46,109,117,115,101,117,
+    109,0,97,105,114,107,105,116,97,112,112,115,45,97,117,46,
+    99,111,109,0,97,105,114,107,105,116,97,112,112,115,46,99,
+    111,109,0,97,105,114,107,105,116,97,112,112,115,46,101,117,
+    0,97,105,114,108,105,110,101,46,97,101,114,111,0,97,105,
+    114,112,111,114,116,46,97,101,114,111,0,97,105,114,116,101,
+    108,0,97,105,114,116,114,97,102,102,105,99,46,97,101,114,
+    111,0,97,105,115,97,105,46,97,105,99,104,105,46,106,112,
+    0,97,105,115,104,111,46,115,104,105,103,97,46,106,112,0,
+    97,105,118,101,110,99,108,111,117,100,46,99,111,109,0,97,
+    105,122,117,98,97,110,103,101,46,102,117,107,117,115,104,105,
+    109,97,46,106,112,0,97,105,122,117,109,105,46,116,111,107,
+    117,115,104,105,109,97,46,106,112,0,97,105,122,117,109,105,
+    115,97,116,111,46,102,117,107,117,115,104,105,109,97,46,106,
+    112,0,97,105,122,117,119,97,107,97,109,97,116,115,117,46,
+    102,117,107,117,115,104,105,109,97,46,106,112,0,97,106,117,
+    46,98,114,0,97,107,97,98,105,114,97,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,97,107,97,100,110,115,46,110,
+    101,116,0,97,107,97,103,105,46,115,104,105,109,97,110,101,
+    46,106,112,0,97,107,97,105,119,97,46,111,107,97,121,97,
+    109,97,46,106,112,0,97,107,97,109,97,105,45,115,116,97,
+    103,105,110,103,46,110,101,116,0,97,107,97,109,97,105,46,
+    110,101,116,0,97,107,97,109,97,105,101,100,103,101,45,115,
+    116,97,103,105,110,103,46,110,101,116,0,97,107,97,109,97,
+    105,101,100,103,101,46,110,101,116,0,97,107,97,109,97,105,
+    104,100,45,115,116,97,103,105,110,103,46,110,101,116,0,97,
+    107,97,109,97,105,104,100,46,110,101,116,0,97,107,97,109,
+    97,105,111,114,105,103,105,110,45,115,116,97,103,105,110,103,
+    46,110,101,116,0,97,107,97,109,97,105,111,114,105,103,105,
+    110,46,110,101,116,0,97,107,97,109,97,105,122,101,100,45,
+    115,116,97,103,105,110,103,46,110,101,116,0,97,107,97,109,
+    97,105,122,101,100,46,110,101,116,0,97,107,97,115,104,105,
+    46,104,121,111,103,111,46,106,112,0,97,107,100,110,0,97,
+    107,105,46,107,111,99,104,105,46,106,112,0,97,107,105,114,
+    117,110,111,46,116,111,107,121,111,46,106,112,0,97,107,105,
+    115,104,105,109,97,46,116,111,107,121,111,46,106,112,0,97,
+    107,105,116,97,46,97,107,105,116,97,46,106,112,0,97,107,
+    107,101,115,104,105,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,97,107,110,111,108,117,111,107,116,97,46,110,111,0,
+    97,107,111,46,104,121,111,103,111,46,106,112,0,97,107,114,
+    101,104,97,109,110,46,110,111,0,97,107,116,121,117,98,105,
+    110,115,107,46,115,117,0,97,107,117,110,101,46,107,97,103,
+    111,115,104,105,109,97,46,106,112,0,97,108,46,101,117,46,
+    111,114,103,0,97,108,46,103,111,118,46,98,114,0,97,108,
+    46,105,116,0,97,108,46,108,101,103,46,98,114,0,97,108,
+    46,110,111,0,97,108,97,98,97,109,97,46,109,117,115,101,
+    117,109,0,97,108,97,104,101,97,100,106,117,46,110,111,0,
+    97,108,97,110,100,46,102,105,0,97,108,97,115,107,97,46,
+    109,117,115,101,117,109,0,97,108,99,101,115,46,110,101,116,
+    119,111,114,107,0,97,108,101,115,115,97,110,100,114,105,97,
+    46,105,116,0,97,108,101,115,117,110,100,46,110,111,0,97,
+    108,102,97,114,111,109,101,111,0,97,108,103,97,114,100,46,
+    110,111,0,97,108,105,98,97,98,97,0,97,108,105,112,97,
+    121,0,97,108,108,102,105,110,97,110,122,0,97,108,108,115,
+    116,97,116,101,0,97,108,108,121,0,97,108,112,49,46,97,
+    101,46,102,108,111,119,46,99,104,0,97,108,112,104,97,45,
+    109,121,113,110,97,112,99,108,111,117,100,46,99,111,109,0,
+    97,108,112,104,97,46,98,111,117,110,116,121,45,102,117,108,
+    108,46,99,111,109,0,97,108,115,97,99,101,0,97,108,115,
+    116,97,104,97,117,103,46,110,111,0,97,108,115,116,111,109,
+    0,97,108,116,46,122,97,0,97,108,116,97,46,110,111,0,
+    97,108,116,101,114,118,105,115,116,97,46,111,114,103,0,97,
+    108,116,111,45,97,100,105,103,101,46,105,116,0,97,108,116,
+    111,97,100,105,103,101,46,105,116,0,97,108,118,100,97,108,
+    46,110,111,0,97,108,119,97,121,115,100,97,116,97,46,110,
+    101,116,0,97,109,46,98,114,0,97,109,46,103,111,118,46,
+    98,114,0,97,109,46,105,110,0,97,109,46,108,101,103,46,
+    98,114,0,97,109,97,46,97,105,99,104,105,46,106,112,0,
+    97,109,97,46,115,104,105,109,97,110,101,46,106,112,0,97,
+    109,97,103,97,115,97,107,105,46,104,121,111,103,111,46,106,
+    112,0,97,109,97,107,117,115,97,46,107,117,109,97,109,111,
+    116,111,46,106,112,0,97,109,97,109,105,46,107,97,103,111,
+    115,104,105,109,97,46,106,112,0,97,109,97,122,111,110,0,
+    97,109,98,101,114,46,109,117,115,101,117,109,0,97,109,98,
+    117,108,97,110,99,101,46,97,101,114,111,0,97,109,98,117,
+    108,97,110,99,101,46,109,117,115,101,117,109,0,97,109,101,
+    114,105,99,97,110,46,109,117,115,101,117,109,0,97,109,101,
+    114,105,99,97,110,97,46,109,117,115,101,117,109,0,97,109,
+    101,114,105,99,97,110,97,110,116,105,113,117,101,115,46,109,
+    117,115,101,117,109,0,97,109,101,114,105,99,97,110,97,114,
+    116,46,109,117,115,101,117,109,0,97,109,101,114,105,99,97,
+    110,101,120,112,114,101,115,115,0,97,109,101,114,105,99,97,
+    110,102,97,109,105,108,121,0,97,109,101,120,0,97,109,102,
+    97,109,0,97,109,105,46,105,98,97,114,97,107,105,46,106,
+    112,0,97,109,105,99,97,0,97,109,108,105,46,110,111,0,
+    97,109,111,116,46,110,111,0,97,109,115,99,111,109,112,117,
+    116,101,46,99,111,109,0,97,109,115,116,101,114,100,97,109,
+    0,97,109,115,116,101,114,100,97,109,46,109,117,115,101,117,
+    109,0,97,109,117,115,101,109,101,110,116,46,97,101,114,111,
+    0,97,110,46,105,116,0,97,110,97,108,121,116,105,99,115,
+    0,97,110,97,109,105,122,117,46,105,115,104,105,107,97,119,
+    97,46,106,112,0,97,110,97,110,46,110,97,103,97,110,111,
+    46,106,112,0,97,110,97,110,46,116,111,107,117,115,104,105,
+    109,97,46,106,112,0,97,110,97,110,105,46,98,114,0,97,
+    110,99,111,110,97,46,105,116,0,97,110,100,46,109,117,115,
+    101,117,109,0,97,110,100,97,115,117,111,108,111,46,110,111,
+    0,97,110,100,101,98,117,46,110,111,0,97,110,100,111,46,
+    110,97,114,97,46,106,112,0,97,110,100,111,121,46,110,111,
+    0,97,110,100,114,105,97,45,98,97,114,108,101,116,116,97,
+    45,116,114,97,110,105,46,105,116,0,97,110,100,114,105,97,
+    45,116,114,97,110,105,45,98,97,114,108,101,116,116,97,46,
+    105,116,0,97,110,100,114,105,97,98,97,114,108,101,116,116,
+    97,116,114,97,110,105,46,105,116,0,97,110,100,114,105,97,
+    116,114,97,110,105,98,97,114,108,101,116,116,97,46,105,116,
+    0,97,110,100,114,111,105,100,0,97,110,100,195,184,121,46,
+    110,111,0,97,110,103,114,121,46,106,112,0,97,110,106,111,
+    46,97,105,99,104,105,46,106,112,0,97,110,110,45,97,114,
+    98,111,114,46,109,105,46,117,115,0,97,110,110,97,107,97,
+    46,103,117,110,109,97,46,106,112,0,97,110,110,101,102,114,
+    97,110,107,46,109,117,115,101,117,109,0,97,110,112,97,99,
+    104,105,46,103,105,102,117,46,106,112,0,97,110,113,117,97,
+    110,0,97,110,116,104,114,111,46,109,117,115,101,117,109,0,
+    97,110,116,104,114,111,112,111,108,111,103,121,46,109,117,115,
+    101,117,109,0,97,110,116,105,113,117,101,115,46,109,117,115,
+    101,117,109,0,97,110,122,0,97,111,46,105,116,0,97,111,
+    103,97,107,105,46,104,121,111,103,111,46,106,112,0,97,111,
+    103,97,115,104,105,109,97,46,116,111,107,121,111,46,106,112,
+    0,97,111,107,105,46,110,97,103,97,110,111,46,106,112,0,
+    97,111,108,0,97,111,109,111,114,105,46,97,111,109,111,114,
+    105,46,106,112,0,97,111,115,116,97,45,118,97,108,108,101,
+    121,46,105,116,0,97,111,115,116,97,46,105,116,0,97,111,
+    115,116,97,118,97,108,108,101,121,46,105,116,0,97,111,115,
+    116,101,46,105,116,0,97,112,45,110,111,114,116,104,101,97,
+    115,116,45,49,46,101,108,97,115,116,105,99,98,101,97,110,
+    115,116,97,108,107,46,99,111,109,0,97,112,45,110,111,114,
+    116,104,101,97,115,116,45,50,46,101,108,97,115,116,105,99,
+    98,101,97,110,115,116,97,108,107,46,99,111,109,0,97,112,
+    45,110,111,114,116,104,101,97,115,116,45,51,46,101,108,97,
+    115,116,105,99,98,101,97,110,115,116,97,108,107,46,99,111,
+    109,0,97,112,45,115,111,117,116,104,45,49,46,101,108,97,
+    115,116,105,99,98,101,97,110,115,116,97,108,107,46,99,111,
+    109,0,97,112,45,115,111,117,116,104,101,97,115,116,45,49,
+    46,101,108,97,115,116,105,99,98,101,97,110,115,116,97,108,
+    107,46,99,111,109,0,97,112,45,115,111,117,116,104,101,97,
+    115,116,45,50,46,101,108,97,115,116,105,99,98,101,97,110,
+    115,116,97,108,107,46,99,111,109,0,97,112,46,103,111,118,
+    46,98,114,0,97,112,46,103,111,118,46,112,108,0,97,112,
+    46,105,116,0,97,112,46,108,101,103,46,98,114,0,97,112,
+    97,114,101,99,105,100,97,46,98,114,0,97,112,97,114,116,
+    109,101,110,116,115,0,97,112,105,46,103,111,118,46,117,107,
+    0,97,112,105,46,115,116,100,108,105,98,46,99,111,109,0,
+    97,112,105,103,101,101,46,105,111,0,97,112,112,46,98,97,
+    110,122,97,105,99,108,111,117,100,46,105,111,0,97,112,112,
+    46,98,114,0,97,112,112,46,103,112,0,97,112,112,46,108,
+    109,112,109,46,99,111,109,0,97,112,112,46,111,115,46,102,
+    101,100,111,114,97,112,114,111,106,101,99,116,46,111,114,103,
+    0,97,112,112,46,111,115,46,115,116,103,46,102,101,100,111,
+    114,97,112,114,111,106,101,99,116,46,111,114,103,0,97,112,
+    112,46,114,101,110,100,101,114,46,99,111,109,0,97,112,112,
+    99,104,105,122,105,46,99,111,109,0,97,112,112,101,110,103,
+    105,110,101,46,102,108,111,119,46,99,104,0,97,112,112,108,
+    101,0,97,112,112,108,105,110,122,105,46,99,111,109,0,97,
+    112,112,115,46,102,98,115,98,120,46,99,111,109,0,97,112,
+    112,115,46,108,97,105,114,46,105,111,0,97,112,112,115,112,
+    97,99,101,104,111,115,116,101,100,46,99,111,109,0,97,112,
+    112,115,112,97,99,101,117,115,101,114,99,111,110,116,101,110,
+    116,46,99,111,109,0,97,112,112,117,100,111,46,110,101,116,
+    0,97,113,0,97,113,46,105,116,0,97,113,117,97,114,101,
+    108,108,101,0,97,113,117,97,114,105,117,109,46,109,117,115,
+    101,117,109,0,97,113,117,105,108,97,46,105,116,0,97,114,
+    46,99,111,109,0,97,114,46,105,116,0,97,114,97,98,0,
+    97,114,97,105,46,115,104,105,122,117,111,107,97,46,106,112,
+    0,97,114,97,107,97,119,97,46,115,97,105,116,97,109,97,
+    46,106,112,0,97,114,97,107,97,119,97,46,116,111,107,121,
+    111,46,106,112,0,97,114,97,109,99,111,0,97,114,97,111,
+    46,107,117,109,97,109,111,116,111,46,106,112,0,97,114,98,
+    111,114,101,116,117,109,46,109,117,115,101,117,109,0,97,114,
+    99,104,97,101,111,108,111,103,105,99,97,108,46,109,117,115,
+    101,117,109,0,97,114,99,104,97,101,111,108,111,103,121,46,
+    109,117,115,101,117,109,0,97,114,99,104,105,0,97,114,99,
+    104,105,116,101,99,116,101,115,46,98,106,0,97,114,99,104,
+    105,116,101,99,116,117,114,101,46,109,117,115,101,117,109,0,
+    97,114,100,97,108,46,110,111,0,97,114,101,109,97,114,107,
+    46,110,111,0,97,114,101,110,100,97,108,46,110,111,0,97,
+    114,101,122,122,111,46,105,116,0,97,114,105,97,107,101,46,
+    115,97,103,97,46,106,112,0,97,114,105,100,97,46,119,97,
+    107,97,121,97,109,97,46,106,112,0,97,114,105,100,97,103,
+    97,119,97,46,119,97,107,97,121,97,109,97,46,106,112,0,
+    97,114,105,116,97,46,115,97,103,97,46,106,112,0,97,114,
+    107,104,97,110,103,101,108,115,107,46,115,117,0,97,114,109,
+    101,110,105,97,46,115,117,0,97,114,109,121,0,97,114,110,
+    97,46,110,111,0,97,114,113,46,98,114,0,97,114,116,0,
+    97,114,116,46,98,114,0,97,114,116,46,100,111,0,97,114,
+    116,46,100,122,0,97,114,116,46,104,116,0,97,114,116,46,
+    109,117,115,101,117,109,0,97,114,116,46,112,108,0,97,114,
+    116,46,115,110,0,97,114,116,97,110,100,100,101,115,105,103,
+    110,46,109,117,115,101,117,109,0,97,114,116,99,101,110,116,
+    101,114,46,109,117,115,101,117,109,0,97,114,116,100,101,99,
+    111,46,109,117,115,101,117,109,0,97,114,116,101,0,97,114,
+    116,101,46,98,111,0,97,114,116,101,100,117,99,97,116,105,
+    111,110,46,109,117,115,101,117,109,0,97,114,116,103,97,108,
+    108,101,114,121,46,109,117,115,101,117,109,0,97,114,116,115,
+    46,99,111,0,97,114,116,115,46,109,117,115,101,117,109,0,
+    97,114,116,115,46,110,102,0,97,114,116,115,46,114,111,0,
+    97,114,116,115,46,118,101,0,97,114,116,115,97,110,100,99,
+    114,97,102,116,115,46,109,117,115,101,117,109,0,97,114,118,
+    111,46,110,101,116,119,111,114,107,0,97,115,97,103,111,46,
+    104,121,111,103,111,46,106,112,0,97,115,97,104,105,46,99,
+    104,105,98,97,46,106,112,0,97,115,97,104,105,46,105,98,
+    97,114,97,107,105,46,106,112,0,97,115,97,104,105,46,109,
+    105,101,46,106,112,0,97,115,97,104,105,46,110,97,103,97,
+    110,111,46,106,112,0,97,115,97,104,105,46,116,111,121,97,
+    109,97,46,106,112,0,97,115,97,104,105,46,121,97,109,97,
+    103,97,116,97,46,106,112,0,97,115,97,104,105,107,97,119,
+    97,46,104,111,107,107,97,105,100,111,46,106,112,0,97,115,
+    97,107,97,46,115,97,105,116,97,109,97,46,106,112,0,97,
+    115,97,107,97,119,97,46,102,117,107,117,115,104,105,109,97,
+    46,106,112,0,97,115,97,107,117,99,104,105,46,111,107,97,
+    121,97,109,97,46,106,112,0,97,115,97,109,105,110,97,109,
+    105,46,104,105,114,111,115,104,105,109,97,46,106,112,0,97,
+    115,99,111,108,105,45,112,105,99,101,110,111,46,105,116,0,
+    97,115,99,111,108,105,112,105,99,101,110,111,46,105,116,0,
+    97,115,100,97,0,97,115,101,114,97,108,46,110,111,0,97,
+    115,104,103,97,98,97,100,46,115,117,0,97,115,104,105,98,
+    101,116,115,117,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,97,115,104,105,107,97,103,97,46,116,111,99,104,105,103,
+    105,46,106,112,0,97,115,104,105,121,97,46,102,117,107,117,
+    111,107,97,46,106,112,0,97,115,104,105,121,97,46,104,121,
+    111,103,111,46,106,112,0,97,115,104,111,114,111,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,97,115,107,101,114,46,
+    110,111,0,97,115,107,105,109,46,110,111,0,97,115,107,111,
+    121,46,110,111,0,97,115,107,118,111,108,108,46,110,111,0,
+    97,115,107,195,184,121,46,110,111,0,97,115,109,97,116,97,
+    114,116,46,109,117,115,101,117,109,0,97,115,110,46,97,117,
+    0,97,115,110,46,108,118,0,97,115,110,101,115,46,110,111,
+    0,97,115,111,46,107,117,109,97,109,111,116,111,46,106,112,
+    0,97,115,115,46,107,109,0,97,115,115,97,98,117,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,97,115,115,97,115,
+    115,105,110,97,116,105,111,110,46,109,117,115,101,117,109,0,
+    97,115,115,105,115,105,46,109,117,115,101,117,109,0,97,115,
+    115,110,46,108,107,0,97,115,115,111,46,99,105,0,97,115,
+    115,111,46,100,122,0,97,115,115,111,46,101,117,46,111,114,
+    103,0,97,115,115,111,46,102,114,0,97,115,115,111,46,103,
+    112,0,97,115,115,111,46,104,116,0,97,115,115,111,46,107,
+    109,0,97,115,115,111,46,109,99,0,97,115,115,111,46,110,
+    99,0,97,115,115,111,46,114,101,0,97,115,115,111,99,105,
+    97,116,101,115,0,97,115,115,111,99,105,97,116,105,111,110,
+    46,97,101,114,111,0,97,115,115,111,99,105,97,116,105,111,
+    110,46,109,117,115,101,117,109,0,97,115,115,117,114,46,98,
+    106,0,97,115,116,105,46,105,116,0,97,115,116,114,111,110,
+    111,109,121,46,109,117,115,101,117,109,0,97,115,117,107,101,
+    46,97,105,99,104,105,46,106,112,0,97,116,45,98,97,110,
+    100,45,99,97,109,112,46,110,101,116,0,97,116,46,101,117,
+    46,111,114,103,0,97,116,46,105,116,0,97,116,46,109,100,
+    0,97,116,46,118,103,0,97,116,97,109,105,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,97,116,104,46,99,120,0,
+    97,116,104,108,101,116,97,0,97,116,108,46,106,101,108,97,
+    115,116,105,99,46,118,112,115,45,104,111,115,116,46,110,101,
+    116,0,97,116,108,97,110,116,97,46,109,117,115,101,117,109,
+    0,97,116,109,46,112,108,0,97,116,111,46,98,114,0,97,
+    116,115,117,103,105,46,107,97,110,97,103,97,119,97,46,106,
+    112,0,97,116,115,117,109,97,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,97,116,116,111,114,110,101,121,0,97,117,
+    46,101,117,46,111,114,103,0,97,117,99,116,105,111,110,0,
+    97,117,100,105,0,97,117,100,105,98,108,101,0,97,117,100,
+    105,111,0,97,117,100,110,101,100,97,108,110,46,110,111,0,
+    97,117,103,117,115,116,111,119,46,112,108,0,97,117,107,114,
+    97,46,110,111,0,97,117,114,101,46,110,111,0,97,117,114,
+    108,97,110,100,46,110,111,0,97,117,114,115,107,111,103,45,
+    104,111,108,97,110,100,46,110,111,0,97,117,114,115,107,111,
+    103,45,104,195,184,108,97,110,100,46,110,111,0,97,117,115,
+    46,98,97,115,107,101,116,98,97,108,108,0,97,117,115,112,
+    111,115,116,0,97,117,115,116,101,118,111,108,108,46,110,111,
+    0,97,117,115,116,105,110,46,109,117,115,101,117,109,0,97,
+    117,115,116,114,97,108,105,97,46,109,117,115,101,117,109,0,
+    97,117,115,116,114,104,101,105,109,46,110,111,0,97,117,116,
+    104,103,101,97,114,45,115,116,97,103,105,110,103,46,99,111,
+    109,0,97,117,116,104,103,101,97,114,97,112,112,115,46,99,
+    111,109,0,97,117,116,104,111,114,0,97,117,116,104,111,114,
+    46,97,101,114,111,0,97,117,116,111,0,97,117,116,111,46,
+    112,108,0,97,117,116,111,99,111,100,101,46,100,101,118,0,
+    97,117,116,111,109,111,116,105,118,101,46,109,117,115,101,117,
+    109,0,97,117,116,111,115,0,97,118,46,105,116,0,97,118,
+    46,116,114,0,97,118,101,108,108,105,110,111,46,105,116,0,
+    97,118,101,114,111,121,46,110,111,0,97,118,101,114,195,184,
+    121,46,110,111,0,97,118,105,97,110,99,97,0,97,118,105,
+    97,116,105,111,110,46,109,117,115,101,117,109,0,97,118,111,
+    99,97,116,46,102,114,0,97,118,111,99,97,116,46,112,114,
+    111,0,97,118,111,99,97,116,115,46,98,106,0,97,118,111,
+    117,101,115,46,102,114,0,97,119,97,106,105,46,104,121,111,
+    103,111,46,106,112,0,97,119,100,101,118,46,99,97,0,97,
+    119,115,0,97,119,115,103,108,111,98,97,108,97,99,99,101,
+    108,101,114,97,116,111,114,46,99,111,109,0,97,119,115,109,
+    112,112,108,46,99,111,109,0,97,120,97,0,97,120,105,115,
+    46,109,117,115,101,117,109,0,97,121,97,46,109,105,121,97,
+    122,97,107,105,46,106,112,0,97,121,97,98,101,46,107,121,
+    111,116,111,46,106,112,0,97,121,97,103,97,119,97,46,107,
+    97,103,97,119,97,46,106,112,0,97,121,97,115,101,46,107,
+    97,110,97,103,97,119,97,46,106,112,0,97,122,101,114,98,
+    97,105,106,97,110,46,115,117,0,97,122,105,109,117,116,104,
+    46,110,101,116,119,111,114,107,0,97,122,117,109,105,110,111,
+    46,110,97,103,97,110,111,46,106,112,0,97,122,117,114,101,
+    0,97,122,117,114,101,45,109,111,98,105,108,101,46,110,101,
+    116,0,97,122,117,114,101,99,111,110,116,97,105,110,101,114,
+    46,105,111,0,97,122,117,114,101,119,101,98,115,105,116,101,
+    115,46,110,101,116,0,97,195,169,114,111,112,111,114,116,46,
+    99,105,0,98,45,100,97,116,97,46,105,111,0,98,46,98,
+    103,0,98,46,98,114,0,98,46,115,101,0,98,46,115,115,
+    108,46,102,97,115,116,108,121,46,110,101,116,0,98,97,46,
+    103,111,118,46,98,114,0,98,97,46,105,116,0,98,97,46,
+    108,101,103,46,98,114,0,98,97,98,105,97,45,103,111,114,
+    97,46,112,108,0,98,97,98,121,0,98,97,98,121,98,108,
+    117,101,46,106,112,0,98,97,98,121,109,105,108,107,46,106,
+    112,0,98,97,99,107,100,114,111,112,46,106,112,0,98,97,
+    99,107,112,108,97,110,101,97,112,112,46,105,111,0,98,97,
+    99,107,121,97,114,100,115,46,98,97,110,122,97,105,99,108,
+    111,117,100,46,105,111,0,98,97,100,97,100,100,106,97,46,
+    110,111,0,98,97,100,97,106,111,122,46,109,117,115,101,117,
+    109,0,98,97,103,104,100,97,100,46,109,117,115,101,117,109,
+    0,98,97,104,99,97,118,117,111,116,110,97,46,110,111,0,
+    98,97,104,99,99,97,118,117,111,116,110,97,46,110,111,0,
+    98,97,104,110,46,109,117,115,101,117,109,0,98,97,105,100,
+    97,114,46,110,111,0,98,97,105,100,117,0,98,97,106,100,
+    100,97,114,46,110,111,0,98,97,108,97,115,104,111,118,46,
+    115,117,0,98,97,108,97,116,46,110,111,0,98,97,108,101,
+    46,109,117,115,101,117,109,0,98,97,108,101,110,97,45,100,
+    101,118,105,99,101,115,46,99,111,109,0,98,97,108,101,115,
+    116,114,97,110,100,46,110,111,0,98,97,108,108,97,110,103,
+    101,110,46,110,111,0,98,97,108,108,111,111,110,105,110,103,
+    46,97,101,114,111,0,98,97,108,115,97,110,45,115,117,100,
+    116,105,114,111,108,46,105,116,0,98,97,108,115,97,110,45,
+    115,117,101,100,116,105,114,111,108,46,105,116,0,98,97,108,
+    115,97,110,45,115,195,188,100,116,105,114,111,108,46,105,116,
+    0,98,97,108,115,97,110,46,105,116,0,98,97,108,115,102,
+    106,111,114,100,46,110,111,0,98,97,108,116,105,109,111,114,
+    101,46,109,117,115,101,117,109,0,98,97,109,98,105,110,97,
+    46,106,112,0,98,97,109,98,108,101,46,110,111,0,98,97,
+    110,97,109,101,120,0,98,97,110,97,110,97,114,101,112,117,
+    98,108,105,99,0,98,97,110,100,0,98,97,110,100,97,105,
+    46,102,117,107,117,115,104,105,109,97,46,106,112,0,98,97,
+    110,100,111,46,105,98,97,114,97,107,105,46,106,112,0,98,
+    97,110,107,0,98,97,110,122,97,105,46,99,108,111,117,100,
+    0,98,97,114,0,98,97,114,46,112,114,111,0,98,97,114,
+    48,46,110,101,116,0,98,97,114,49,46,110,101,116,0,98,
+    97,114,50,46,110,101,116,0,98,97,114,99,101,108,111,110,
+    97,0,98,97,114,99,101,108,111,110,97,46,109,117,115,101,
+    117,109,0,98,97,114,99,108,97,121,99,97,114,100,0,98,
+    97,114,99,108,97,121,115,0,98,97,114,100,117,46,110,111,
+    0,98,97,114,101,102,111,111,116,0,98,97,114,103,97,105,
+    110,115,0,98,97,114,105,46,105,116,0,98,97,114,108,101,
+    116,116,97,45,116,114,97,110,105,45,97,110,100,114,105,97,
+    46,105,116,0,98,97,114,108,101,116,116,97,116,114,97,110,
+    105,97,110,100,114,105,97,46,105,116,0,98,97,114,114,101,
+    108,45,111,102,45,107,110,111,119,108,101,100,103,101,46,105,
+    110,102,111,0,98,97,114,114,101,108,108,45,111,102,45,107,
+    110,111,119,108,101,100,103,101,46,105,110,102,111,0,98,97,
+    114,115,121,46,98,103,0,98,97,114,115,121,46,99,97,0,
+    98,97,114,115,121,46,99,108,117,98,0,98,97,114,115,121,
+    46,99,111,46,117,107,0,98,97,114,115,121,46,100,101,0,
+    98,97,114,115,121,46,101,117,0,98,97,114,115,121,46,105,
+    110,0,98,97,114,115,121,46,105,110,102,111,0,98,97,114,
+    115,121,46,105,111,0,98,97,114,115,121,46,109,101,0,98,
+    97,114,115,121,46,109,101,110,117,0,98,97,114,115,121,46,
+    109,111,98,105,0,98,97,114,115,121,46,110,101,116,0,98,
+    97,114,115,121,46,111,110,108,105,110,101,0,98,97,114,115,
+    121,46,111,114,103,0,98,97,114,115,121,46,112,114,111,0,
+    98,97,114,115,121,46,112,117,98,0,98,97,114,115,121,46,
+    114,111,0,98,97,114,115,121,46,115,104,111,112,0,98,97,
+    114,115,121,46,115,105,116,101,0,98,97,114,115,121,46,115,
+    117,112,112,111,114,116,0,98,97,114,115,121,46,117,107,0,
+    98,97,114,115,121,99,101,110,116,101,114,46,99,111,109,0,
+    98,97,114,115,121,111,110,108,105,110,101,46,99,111,46,117,
+    107,0,98,97,114,115,121,111,110,108,105,110,101,46,99,111,
+    109,0,98,97,114,117,101,114,105,46,98,114,0,98,97,114,
+    117,109,46,110,111,0,98,97,115,46,105,116,0,98,97,115,
+    101,46,101,99,0,98,97,115,101,46,115,104,111,112,0,98,
+    97,115,101,98,97,108,108,0,98,97,115,101,98,97,108,108,
+    46,109,117,115,101,117,109,0,98,97,115,101,108,46,109,117,
+    115,101,117,109,0,98,97,115,104,107,105,114,105,97,46,114,
+    117,0,98,97,115,104,107,105,114,105,97,46,115,117,0,98,
+    97,115,105,99,115,101,114,118,101,114,46,105,111,0,98,97,
+    115,105,108,105,99,97,116,97,46,105,116,0,98,97,116,104,
+    115,46,109,117,115,101,117,109,0,98,97,116,111,46,116,111,
+    99,104,105,103,105,46,106,112,0,98,97,116,115,102,106,111,
+    114,100,46,110,111,0,98,97,117,101,114,110,46,109,117,115,
+    101,117,109,0,98,97,117,104,97,117,115,0,98,97,121,101,
+    114,110,0,98,98,99,0,98,98,115,46,116,114,0,98,98,
+    116,0,98,98,118,97,0,98,99,46,99,97,0,98,99,46,
+    112,108,97,116,102,111,114,109,46,115,104,0,98,99,103,0,
+    98,99,105,46,100,110,115,116,114,97,99,101,46,112,114,111,
+    0,98,99,110,0,98,100,0,98,100,46,115,101,0,98,101,
+    46,97,120,0,98,101,46,101,117,46,111,114,103,0,98,101,
+    46,103,121,0,98,101,97,103,108,101,98,111,97,114,100,46,
+    105,111,0,98,101,97,114,97,108,118,97,104,107,105,46,110,
+    111,0,98,101,97,114,97,108,118,195,161,104,107,105,46,110,
+    111,0,98,101,97,114,100,117,46,110,111,0,98,101,97,116,
+    115,0,98,101,97,117,116,121,0,98,101,97,117,120,97,114,
+    116,115,46,109,117,115,101,117,109,0,98,101,100,122,105,110,
+    46,112,108,0,98,101,101,108,100,101,110,103,101,108,117,105,
+    100,46,109,117,115,101,117,109,0,98,101,101,112,46,112,108,
+    0,98,101,101,114,0,98,101,103,101,116,46,97,112,112,0,
+    98,101,105,97,114,110,46,110,111,0,98,101,108,46,116,114,
+    0,98,101,108,97,117,46,112,119,0,98,101,108,101,109,46,
+    98,114,0,98,101,108,108,101,118,117,101,46,109,117,115,101,
+    117,109,0,98,101,108,108,117,110,111,46,105,116,0,98,101,
+    110,101,118,101,110,116,111,46,105,116,0,98,101,110,116,108,
+    101,121,0,98,101,112,112,117,46,111,105,116,97,46,106,112,
+    0,98,101,114,103,46,110,111,0,98,101,114,103,97,109,111,
+    46,105,116,0,98,101,114,103,98,97,117,46,109,117,115,101,
+    117,109,0,98,101,114,103,101,110,46,110,111,0,98,101,114,
+    107,101,108,101,121,46,109,117,115,101,117,109,0,98,101,114,
+    108,101,118,97,103,46,110,111,0,98,101,114,108,101,118,195,
+    165,103,46,110,111,0,98,101,114,108,105,110,0,98,101,114,
+    108,105,110,46,109,117,115,101,117,109,0,98,101,114,110,46,
+    109,117,115,101,117,109,0,98,101,115,107,105,100,121,46,112,
+    108,0,98,101,115,116,0,98,101,115,116,98,117,121,0,98,
+    101,116,0,98,101,116,46,97,114,0,98,101,116,97,46,98,
+    111,117,110,116,121,45,102,117,108,108,46,99,111,109,0,98,
+    101,116,97,46,116,97,105,108,115,99,97,108,101,46,110,101,
+    116,0,98,101,116,97,105,110,97,98,111,120,46,99,111,109,
+    0,98,101,116,116,101,114,45,116,104,97,110,46,116,118,0,
+    98,103,46,101,117,46,111,114,103,0,98,103,46,105,116,0,
+    98,104,97,114,116,105,0,98,104,122,46,98,114,0,98,105,
+    46,105,116,0,98,105,97,108,111,119,105,101,122,97,46,112,
+    108,0,98,105,97,108,121,115,116,111,107,46,112,108,0,98,
+    105,98,46,98,114,0,98,105,98,46,118,101,0,98,105,98,
+    97,105,46,104,111,107,107,97,105,100,111,46,106,112,0,98,
+    105,98,108,101,0,98,105,98,108,101,46,109,117,115,101,117,
+    109,0,98,105,100,0,98,105,101,105,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,98,105,101,108,97,119,97,46,112,
+    108,0,98,105,101,108,108,97,46,105,116,0,98,105,101,115,
+    122,99,122,97,100,121,46,112,108,0,98,105,101,118,97,116,
+    46,110,111,0,98,105,101,118,195,161,116,46,110,111,0,98,
+    105,102,117,107,97,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,98,105,104,97,114,46,105,110,0,98,105,104,111,114,
+    111,46,104,111,107,107,97,105,100,111,46,106,112,0,98,105,
+    107,101,0,98,105,108,98,97,111,46,109,117,115,101,117,109,
+    0,98,105,108,108,46,109,117,115,101,117,109,0,98,105,110,
+    100,97,108,46,110,111,0,98,105,110,103,0,98,105,110,103,
+    111,0,98,105,111,0,98,105,111,46,98,114,0,98,105,112,
+    46,115,104,0,98,105,114,46,114,117,0,98,105,114,97,116,
+    111,114,105,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    98,105,114,100,97,114,116,46,109,117,115,101,117,109,0,98,
+    105,114,107,101,110,101,115,46,110,111,0,98,105,114,116,104,
+    112,108,97,99,101,46,109,117,115,101,117,109,0,98,105,116,
+    98,114,105,100,103,101,46,110,101,116,0,98,105,116,98,117,
+    99,107,101,116,46,105,111,0,98,105,116,116,101,114,46,106,
+    112,0,98,105,122,46,97,116,0,98,105,122,46,97,122,0,
+    98,105,122,46,98,98,0,98,105,122,46,99,121,0,98,105,
+    122,46,100,107,0,98,105,122,46,101,116,0,98,105,122,46,
+    102,106,0,98,105,122,46,103,108,0,98,105,122,46,105,100,
+    0,98,105,122,46,105,110,0,98,105,122,46,107,105,0,98,
+    105,122,46,108,115,0,98,105,122,46,109,118,0,98,105,122,
+    46,109,119,0,98,105,122,46,109,121,0,98,105,122,46,110,
+    105,0,98,105,122,46,110,114,0,98,105,122,46,112,107,0,
+    98,105,122,46,112,108,0,98,105,122,46,112,114,0,98,105,
+    122,46,115,115,0,98,105,122,46,116,106,0,98,105,122,46,
+    116,114,0,98,105,122,46,116,116,0,98,105,122,46,117,97,
+    0,98,105,122,46,118,110,0,98,105,122,46,119,102,0,98,
+    105,122,46,122,109,0,98,105,122,101,110,46,111,107,97,121,
+    97,109,97,46,106,112,0,98,106,46,99,110,0,98,106,97,
+    114,107,111,121,46,110,111,0,98,106,97,114,107,195,184,121,
+    46,110,111,0,98,106,101,114,107,114,101,105,109,46,110,111,
+    0,98,106,117,103,110,46,110,111,0,98,108,46,105,116,0,
+    98,108,97,99,107,0,98,108,97,99,107,98,97,117,100,99,
+    100,110,46,110,101,116,0,98,108,97,99,107,102,114,105,100,
+    97,121,0,98,108,111,99,107,98,117,115,116,101,114,0,98,
+    108,111,103,0,98,108,111,103,46,98,111,0,98,108,111,103,
+    46,98,114,0,98,108,111,103,46,103,116,0,98,108,111,103,
+    46,107,103,0,98,108,111,103,46,118,117,0,98,108,111,103,
+    100,110,115,46,99,111,109,0,98,108,111,103,100,110,115,46,
+    110,101,116,0,98,108,111,103,100,110,115,46,111,114,103,0,
+    98,108,111,103,115,105,116,101,46,111,114,103,0,98,108,111,
+    103,115,105,116,101,46,120,121,122,0,98,108,111,103,115,112,
+    111,116,46,97,101,0,98,108,111,103,115,112,111,116,46,97,
+    108,0,98,108,111,103,115,112,111,116,46,97,109,0,98,108,
+    111,103,115,112,111,116,46,98,97,0,98,108,111,103,115,112,
+    111,116,46,98,101,0,98,108,111,103,115,112,111,116,46,98,
+    103,0,98,108,111,103,115,112,111,116,46,98,106,0,98,108,
+    111,103,115,112,111,116,46,99,97,0,98,108,111,103,115,112,
+    111,116,46,99,102,0,98,108,111,103,115,112,111,116,46,99,
+    104,0,98,108,111,103,115,112,111,116,46,99,108,0,98,108,
+    111,103,115,112,111,116,46,99,111,46,97,116,0,98,108,111,
+    103,115,112,111,116,46,99,111,46,105,100,0,98,108,111,103,
+    115,112,111,116,46,99,111,46,105,108,0,98,108,111,103,115,
+    112,111,116,46,99,111,46,107,101,0,98,108,111,103,115,112,
+    111,116,46,99,111,46,110,122,0,98,108,111,103,115,112,111,
+    116,46,99,111,46,117,107,0,98,108,111,103,115,112,111,116,
+    46,99,111,46,122,97,0,98,108,111,103,115,112,111,116,46,
+    99,111,109,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,97,114,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,97,117,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,98,114,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,98,121,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,99,111,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,99,121,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,101,101,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,101,103,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,101,115,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,109,116,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,110,103,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,116,114,0,98,108,111,103,115,112,111,116,46,99,111,109,
+    46,117,121,0,98,108,111,103,115,112,111,116,46,99,118,0,
+    98,108,111,103,115,112,111,116,46,99,122,0,98,108,111,103,
+    115,112,111,116,46,100,101,0,98,108,111,103,115,112,111,116,
+    46,100,107,0,98,108,111,103,115,112,111,116,46,102,105,0,
+    98,108,111,103,115,112,111,116,46,102,114,0,98,108,111,103,
+    115,112,111,116,46,103,114,0,98,108,111,103,115,112,111,116,
+    46,104,107,0,98,108,111,103,115,112,111,116,46,104,114,0,
+    98,108,111,103,115,112,111,116,46,104,117,0,98,108,111,103,
+    115,112,111,116,46,105,101,0,98,108,111,103,115,112,111,116,
+    46,105,110,0,98,108,111,103,115,112,111,116,46,105,115,0,
+    98,108,111,103,115,112,111,116,46,105,116,0,98,108,111,103,
+    115,112,111,116,46,106,112,0,98,108,111,103,115,112,111,116,
+    46,107,114,0,98,108,111,103,115,112,111,116,46,108,105,0,
+    98,108,111,103,115,112,111,116,46,108,116,0,98,108,111,103,
+    115,112,111,116,46,108,117,0,98,108,111,103,115,112,111,116,
+    46,109,100,0,98,108,111,103,115,112,111,116,46,109,107,0,
+    98,108,111,103,115,112,111,116,46,109,114,0,98,108,111,103,
+    115,112,111,116,46,109,120,0,98,108,111,103,115,112,111,116,
+    46,109,121,0,98,108,111,103,115,112,111,116,46,110,108,0,
+    98,108,111,103,115,112,111,116,46,110,111,0,98,108,111,103,
+    115,112,111,116,46,112,101,0,98,108,111,103,115,112,111,116,
+    46,112,116,0,98,108,111,103,115,112,111,116,46,113,97,0,
+    98,108,111,103,115,112,111,116,46,114,101,0,98,108,111,103,
+    115,112,111,116,46,114,111,0,98,108,111,103,115,112,111,116,
+    46,114,115,0,98,108,111,103,115,112,111,116,46,114,117,0,
+    98,108,111,103,115,112,111,116,46,115,101,0,98,108,111,103,
+    115,112,111,116,46,115,103,0,98,108,111,103,115,112,111,116,
+    46,115,105,0,98,108,111,103,115,112,111,116,46,115,107,0,
+    98,108,111,103,115,112,111,116,46,115,110,0,98,108,111,103,
+    115,112,111,116,46,116,100,0,98,108,111,103,115,112,111,116,
+    46,116,119,0,98,108,111,103,115,112,111,116,46,117,103,0,
+    98,108,111,103,115,112,111,116,46,118,110,0,98,108,111,103,
+    115,121,116,101,46,99,111,109,0,98,108,111,111,109,98,101,
+    114,103,0,98,108,111,120,99,109,115,46,99,111,109,0,98,
+    108,117,101,0,98,108,117,101,98,105,116,101,46,105,111,0,
+    98,108,117,115,104,46,106,112,0,98,109,100,46,98,114,0,
+    98,109,111,97,116,116,97,99,104,109,101,110,116,115,46,111,
+    114,103,0,98,109,115,0,98,109,119,0,98,110,46,105,116,
+    0,98,110,112,112,97,114,105,98,97,115,0,98,110,114,46,
+    108,97,0,98,111,46,105,116,0,98,111,46,110,111,114,100,
+    108,97,110,100,46,110,111,0,98,111,46,116,101,108,101,109,
+    97,114,107,46,110,111,0,98,111,97,116,115,0,98,111,97,
+    118,105,115,116,97,46,98,114,0,98,111,100,111,46,110,111,
+    0,98,111,100,195,184,46,110,111,0,98,111,101,104,114,105,
+    110,103,101,114,0,98,111,102,97,0,98,111,107,110,46,110,
+    111,0,98,111,108,100,108,121,103,111,105,110,103,110,111,119,
+    104,101,114,101,46,111,114,103,0,98,111,108,101,115,108,97,
+    119,105,101,99,46,112,108,0,98,111,108,105,118,105,97,46,
+    98,111,0,98,111,108,111,103,110,97,46,105,116,0,98,111,
+    108,116,46,104,117,0,98,111,108,122,97,110,111,45,97,108,
+    116,111,97,100,105,103,101,46,105,116,0,98,111,108,122,97,
+    110,111,46,105,116,0,98,111,109,0,98,111,109,108,111,46,
+    110,111,0,98,111,110,100,0,98,111,110,110,46,109,117,115,
+    101,117,109,0,98,111,111,0,98,111,111,46,106,112,0,98,
+    111,111,107,0,98,111,111,107,105,110,103,0,98,111,111,107,
+    111,110,108,105,110,101,46,97,112,112,0,98,111,111,109,108,
+    97,46,110,101,116,0,98,111,115,99,104,0,98,111,115,116,
+    105,107,0,98,111,115,116,111,110,0,98,111,115,116,111,110,
+    46,109,117,115,101,117,109,0,98,111,116,0,98,111,116,97,
+    110,105,99,97,108,46,109,117,115,101,117,109,0,98,111,116,
+    97,110,105,99,97,108,103,97,114,100,101,110,46,109,117,115,
+    101,117,109,0,98,111,116,97,110,105,99,103,97,114,100,101,
+    110,46,109,117,115,101,117,109,0,98,111,116,97,110,121,46,
+    109,117,115,101,117,109,0,98,111,117,110,99,101,109,101,46,
+    110,101,116,0,98,111,117,116,105,113,117,101,0,98,111,117,
+    116,105,114,46,99,111,109,0,98,111,120,0,98,111,120,102,
+    117,115,101,46,105,111,0,98,111,121,46,106,112,0,98,111,
+    121,102,114,105,101,110,100,46,106,112,0,98,111,122,101,110,
+    45,115,117,100,116,105,114,111,108,46,105,116,0,98,111,122,
+    101,110,45,115,117,101,100,116,105,114,111,108,46,105,116,0,
+    98,111,122,101,110,45,115,195,188,100,116,105,114,111,108,46,
+    105,116,0,98,111,122,101,110,46,105,116,0,98,112,108,97,
+    99,101,100,46,99,111,109,0,98,112,108,97,99,101,100,46,
+    100,101,0,98,112,108,97,99,101,100,46,110,101,116,0,98,
+    114,46,99,111,109,0,98,114,46,105,116,0,98,114,97,100,
+    101,115,99,111,0,98,114,97,110,100,46,115,101,0,98,114,
+    97,110,100,121,119,105,110,101,118,97,108,108,101,121,46,109,
+    117,115,101,117,109,0,98,114,97,115,105,108,46,109,117,115,
+    101,117,109,0,98,114,97,115,105,108,105,97,46,109,101,0,
+    98,114,101,109,97,110,103,101,114,46,110,111,0,98,114,101,
+    115,99,105,97,46,105,116,0,98,114,105,100,103,101,115,116,
+    111,110,101,0,98,114,105,110,100,105,115,105,46,105,116,0,
+    98,114,105,115,116,111,108,46,109,117,115,101,117,109,0,98,
+    114,105,116,105,115,104,46,109,117,115,101,117,109,0,98,114,
+    105,116,105,115,104,99,111,108,117,109,98,105,97,46,109,117,
+    115,101,117,109,0,98,114,111,97,100,99,97,115,116,46,109,
+    117,115,101,117,109,0,98,114,111,97,100,119,97,121,0,98,
+    114,111,107,101,45,105,116,46,110,101,116,0,98,114,111,107,
+    101,114,0,98,114,111,107,101,114,46,97,101,114,111,0,98,
+    114,111,110,110,111,121,46,110,111,0,98,114,111,110,110,111,
+    121,115,117,110,100,46,110,111,0,98,114,111,116,104,101,114,
+    0,98,114,111,119,115,101,114,115,97,102,101,116,121,109,97,
+    114,107,46,105,111,0,98,114,117,109,117,110,100,100,97,108,
+    46,110,111,0,98,114,117,110,101,108,46,109,117,115,101,117,
+    109,0,98,114,117,115,115,101,108,46,109,117,115,101,117,109,
+    0,98,114,117,115,115,101,108,115,0,98,114,117,115,115,101,
+    108,115,46,109,117,115,101,117,109,0,98,114,117,120,101,108,
+    108,101,115,46,109,117,115,101,117,109,0,98,114,121,97,110,
+    115,107,46,115,117,0,98,114,121,110,101,46,110,111,0,98,
+    114,195,184,110,110,195,184,121,46,110,111,0,98,114,195,184,
+    110,110,195,184,121,115,117,110,100,46,110,111,0,98,115,46,
+    105,116,0,98,115,98,46,98,114,0,98,115,115,46,100,101,
+    115,105,103,110,0,98,116,46,105,116,0,98,117,100,101,106,
+    106,117,46,110,111,0,98,117,105,108,100,0,98,117,105,108,
+    100,46,114,117,110,0,98,117,105,108,100,101,114,46,99,111,
+    100,101,46,99,111,109,0,98,117,105,108,100,105,110,103,46,
+    109,117,115,101,117,109,0,98,117,105,108,116,119,105,116,104,
+    100,97,114,107,46,99,111,109,0,98,117,107,104,97,114,97,
+    46,115,117,0,98,117,108,115,97,110,45,115,117,100,116,105,
+    114,111,108,46,105,116,0,98,117,108,115,97,110,45,115,117,
+    101,100,116,105,114,111,108,46,105,116,0,98,117,108,115,97,
+    110,45,115,195,188,100,116,105,114,111,108,46,105,116,0,98,
+    117,108,115,97,110,46,105,116,0,98,117,110,103,111,111,110,
+    111,46,111,105,116,97,46,106,112,0,98,117,110,103,111,116,
+    97,107,97,100,97,46,111,105,116,97,46,106,112,0,98,117,
+    110,107,121,111,46,116,111,107,121,111,46,106,112,0,98,117,
+    114,103,104,111,102,46,109,117,115,101,117,109,0,98,117,115,
+    46,109,117,115,101,117,109,0,98,117,115,97,110,46,107,114,
+    0,98,117,115,104,101,121,46,109,117,115,101,117,109,0,98,
+    117,115,105,110,101,115,115,46,105,110,0,98,117,116,46,106,
+    112,0,98,117,121,0,98,117,121,115,104,111,112,46,106,112,
+    0,98,117,121,115,104,111,117,115,101,115,46,110,101,116,0,
+    98,117,122,101,110,46,102,117,107,117,111,107,97,46,106,112,
+    0,98,117,122,122,0,98,118,0,98,121,100,103,111,115,122,
+    99,122,46,112,108,0,98,121,101,110,46,115,105,116,101,0,
+    98,121,103,108,97,110,100,46,110,111,0,98,121,107,108,101,
+    46,110,111,0,98,121,116,111,109,46,112,108,0,98,122,46,
+    105,116,0,98,122,104,0,98,122,122,46,100,97,112,112,115,
+    46,101,97,114,116,104,0,98,195,161,104,99,97,118,117,111,
+    116,110,97,46,110,111,0,98,195,161,104,99,99,97,118,117,
+    111,116,110,97,46,110,111,0,98,195,161,105,100,195,161,114,
+    46,110,111,0,98,195,161,106,100,100,97,114,46,110,111,0,
+    98,195,161,108,195,161,116,46,110,111,0,98,195,165,100,195,
+    165,100,100,106,195,165,46,110,111,0,98,195,165,116,115,102,
+    106,111,114,100,46,110,111,0,98,195,166,114,117,109,46,110,
+    111,0,98,195,184,46,110,111,114,100,108,97,110,100,46,110,
+    111,0,98,195,184,46,116,101,108,101,109,97,114,107,46,110,
+    111,0,98,195,184,109,108,111,46,110,111,0,99,46,98,103,
+    0,99,46,99,100,110,55,55,46,111,114,103,0,99,46,108,
+    97,0,99,46,115,101,0,99,54,54,46,109,101,0,99,97,
+    45,99,101,110,116,114,97,108,45,49,46,101,108,97,115,116,
+    105,99,98,101,97,110,115,116,97,108,107,46,99,111,109,0,
+    99,97,46,101,117,46,111,114,103,0,99,97,46,105,110,0,
+    99,97,46,105,116,0,99,97,46,110,97,0,99,97,46,114,
+    101,99,108,97,105,109,46,99,108,111,117,100,0,99,97,97,
+    46,97,101,114,111,0,99,97,97,46,108,105,0,99,97,98,
+    0,99,97,98,108,101,45,109,111,100,101,109,46,111,114,103,
+    0,99,97,100,97,113,117,101,115,46,109,117,115,101,117,109,
+    0,99,97,102,101,0,99,97,102,106,115,46,99,111,109,0,
+    99,97,103,108,105,97,114,105,46,105,116,0,99,97,104,99,
+    101,115,117,111,108,111,46,110,111,0,99,97,108,0,99,97,
+    108,46,105,116,0,99,97,108,97,98,114,105,97,46,105,116,
+    0,99,97,108,105,102,111,114,110,105,97,46,109,117,115,101,
+    117,109,0,99,97,108,108,0,99,97,108,116,97,110,105,115,
+    115,101,116,116,97,46,105,116,0,99,97,108,118,105,110,107,
+    108,101,105,110,0,99,97,109,0,99,97,109,46,105,116,0,
+    99,97,109,98,114,105,100,103,101,46,109,117,115,101,117,109,
+    0,99,97,109,100,118,114,46,111,114,103,0,99,97,109,101,
+    114,97,0,99,97,109,112,0,99,97,109,112,97,105,103,110,
+    46,103,111,118,46,117,107,0,99,97,109,112,97,110,105,97,
+    46,105,116,0,99,97,109,112,105,100,97,110,111,45,109,101,
+    100,105,111,46,105,116,0,99,97,109,112,105,100,97,110,111,
+    109,101,100,105,111,46,105,116,0,99,97,109,112,105,110,97,
+    103,114,97,110,100,101,46,98,114,0,99,97,109,112,105,110,
+    97,115,46,98,114,0,99,97,109,112,111,98,97,115,115,111,
+    46,105,116,0,99,97,110,46,109,117,115,101,117,109,0,99,
+    97,110,97,100,97,46,109,117,115,101,117,109,0,99,97,110,
+    100,121,112,111,112,46,106,112,0,99,97,110,111,110,0,99,
+    97,110,118,97,45,97,112,112,115,46,99,110,0,99,97,110,
+    118,97,45,97,112,112,115,46,99,111,109,0,99,97,112,101,
+    98,114,101,116,111,110,46,109,117,115,101,117,109,0,99,97,
+    112,101,116,111,119,110,0,99,97,112,105,116,97,108,0,99,
+    97,112,105,116,97,108,111,110,101,0,99,97,112,111,111,46,
+    106,112,0,99,97,114,0,99,97,114,97,99,97,108,46,109,
+    121,116,104,105,99,45,98,101,97,115,116,115,46,99,111,109,
+    0,99,97,114,97,118,97,110,0,99,97,114,98,111,110,105,
+    97,45,105,103,108,101,115,105,97,115,46,105,116,0,99,97,
+    114,98,111,110,105,97,105,103,108,101,115,105,97,115,46,105,
+    116,0,99,97,114,100,115,0,99,97,114,101,0,99,97,114,
+    101,101,114,0,99,97,114,101,101,114,115,0,99,97,114,103,
+    111,46,97,101,114,111,0,99,97,114,114,97,114,97,45,109,
+    97,115,115,97,46,105,116,0,99,97,114,114,97,114,97,109,
+    97,115,115,97,46,105,116,0,99,97,114,114,100,46,99,111,
+    0,99,97,114,114,105,101,114,46,109,117,115,101,117,109,0,
+    99,97,114,115,0,99,97,114,116,111,111,110,97,114,116,46,
+    109,117,115,101,117,109,0,99,97,115,97,99,97,109,46,110,
+    101,116,0,99,97,115,97,100,101,108,97,109,111,110,101,100,
+    97,46,109,117,115,101,117,109,0,99,97,115,101,0,99,97,
+    115,101,114,116,97,46,105,116,0,99,97,115,104,0,99,97,
+    115,105,110,111,0,99,97,115,105,110,111,46,104,117,0,99,
+    97,115,116,108,101,46,109,117,115,101,117,109,0,99,97,115,
+    116,114,101,115,46,109,117,115,101,117,109,0,99,97,116,0,
+    99,97,116,46,97,120,0,99,97,116,97,110,105,97,46,105,
+    116,0,99,97,116,97,110,122,97,114,111,46,105,116,0,99,
+    97,116,101,114,105,110,103,0,99,97,116,101,114,105,110,103,
+    46,97,101,114,111,0,99,97,116,102,111,111,100,46,106,112,
+    0,99,97,116,104,111,108,105,99,0,99,97,116,104,111,108,
+    105,99,46,101,100,117,46,97,117,0,99,97,120,105,97,115,
+    46,98,114,0,99,98,46,105,116,0,99,98,97,0,99,98,
+    103,46,114,117,0,99,98,110,0,99,98,114,101,0,99,98,
+    115,0,99,99,46,97,107,46,117,115,0,99,99,46,97,108,
+    46,117,115,0,99,99,46,97,114,46,117,115,0,99,99,46,
+    97,115,46,117,115,0,99,99,46,97,122,46,117,115,0,99,
+    99,46,99,97,46,117,115,0,99,99,46,99,111,46,117,115,
+    0,99,99,46,99,116,46,117,115,0,99,99,46,100,99,46,
+    117,115,0,99,99,46,100,101,46,117,115,0,99,99,46,102,
+    108,46,117,115,0,99,99,46,103,97,46,117,115,0,99,99,
+    46,103,117,46,117,115,0,99,99,46,104,105,46,117,115,0,
+    99,99,46,104,110,0,99,99,46,105,97,46,117,115,0,99,
+    99,46,105,100,46,117,115,0,99,99,46,105,108,46,117,115,
+    0,99,99,46,105,110,46,117,115,0,99,99,46,107,115,46,
+    117,115,0,99,99,46,107,121,46,117,115,0,99,99,46,108,
+    97,46,117,115,0,99,99,46,109,97,46,117,115,0,99,99,
+    46,109,100,46,117,115,0,99,99,46,109,101,46,117,115,0,
+    99,99,46,109,105,46,117,115,0,99,99,46,109,110,46,117,
+    115,0,99,99,46,109,111,46,117,115,0,99,99,46,109,115,
+    46,117,115,0,99,99,46,109,116,46,117,115,0,99,99,46,
+    110,97,0,99,99,46,110,99,46,117,115,0,99,99,46,110,
+    100,46,117,115,0,99,99,46,110,101,46,117,115,0,99,99,
+    46,110,104,46,117,115,0,99,99,46,110,106,46,117,115,0,
+    99,99,46,110,109,46,117,115,0,99,99,46,110,118,46,117,
+    115,0,99,99,46,110,121,46,117,115,0,99,99,46,111,104,
+    46,117,115,0,99,99,46,111,107,46,117,115,0,99,99,46,
+    111,114,46,117,115,0,99,99,46,112,97,46,117,115,0,99,
+    99,46,112,114,46,117,115,0,99,99,46,114,105,46,117,115,
+    0,99,99,46,115,99,46,117,115,0,99,99,46,115,100,46,
+    117,115,0,99,99,46,116,110,46,117,115,0,99,99,46,116,
+    120,46,117,115,0,99,99,46,117,97,0,99,99,46,117,116,
+    46,117,115,0,99,99,46,118,97,46,117,115,0,99,99,46,
+    118,105,46,117,115,0,99,99,46,118,116,46,117,115,0,99,
+    99,46,119,97,46,117,115,0,99,99,46,119,105,46,117,115,
+    0,99,99,46,119,118,46,117,115,0,99,99,46,119,121,46,
+    117,115,0,99,99,105,46,102,114,0,99,100,46,101,117,46,
+    111,114,103,0,99,100,110,45,101,100,103,101,115,46,110,101,
+    116,0,99,100,110,46,112,114,111,100,46,97,116,108,97,115,
+    115,105,97,110,45,100,101,118,46,110,101,116,0,99,100,110,
+    55,55,45,115,115,108,46,110,101,116,0,99,101,46,103,111,
+    118,46,98,114,0,99,101,46,105,116,0,99,101,46,108,101,
+    103,46,98,114,0,99,101,99,104,105,114,101,46,99,111,109,
+    0,99,101,108,116,105,99,46,109,117,115,101,117,109,0,99,
+    101,110,116,101,114,0,99,101,110,116,101,114,46,109,117,115,
+    101,117,109,0,99,101,110,116,114,97,108,117,115,46,97,122,
+    117,114,101,115,116,97,116,105,99,97,112,112,115,46,110,101,
+    116,0,99,101,111,0,99,101,114,110,0,99,101,114,116,105,
+    102,105,99,97,116,105,111,110,46,97,101,114,111,0,99,101,
+    114,116,109,103,114,46,111,114,103,0,99,101,115,101,110,97,
+    45,102,111,114,108,105,46,105,116,0,99,101,115,101,110,97,
+    45,102,111,114,108,195,172,46,105,116,0,99,101,115,101,110,
+    97,102,111,114,108,105,46,105,116,0,99,101,115,101,110,97,
+    102,111,114,108,195,172,46,105,116,0,99,102,45,105,112,102,
+    115,46,99,111,109,0,99,102,97,0,99,102,100,0,99,103,
+    0,99,104,46,101,117,46,111,114,103,0,99,104,46,105,116,
+    0,99,104,46,116,99,0,99,104,46,116,114,101,110,100,104,
+    111,115,116,105,110,103,46,99,108,111,117,100,0,99,104,97,
+    109,98,97,103,114,105,46,102,114,0,99,104,97,109,112,105,
+    111,110,115,104,105,112,46,97,101,114,111,0,99,104,97,110,
+    101,108,0,99,104,97,110,110,101,108,0,99,104,97,114,105,
+    116,121,0,99,104,97,114,116,101,114,46,97,101,114,111,0,
+    99,104,97,115,101,0,99,104,97,116,0,99,104,97,116,116,
+    97,110,111,111,103,97,46,109,117,115,101,117,109,0,99,104,
+    101,97,112,0,99,104,101,97,112,46,106,112,0,99,104,101,
+    108,116,101,110,104,97,109,46,109,117,115,101,117,109,0,99,
+    104,101,114,107,97,115,115,121,46,117,97,0,99,104,101,114,
+    107,97,115,121,46,117,97,0,99,104,101,114,110,105,103,111,
+    118,46,117,97,0,99,104,101,114,110,105,104,105,118,46,117,
+    97,0,99,104,101,114,110,105,118,116,115,105,46,117,97,0,
+    99,104,101,114,110,111,118,116,115,121,46,117,97,0,99,104,
+    101,115,97,112,101,97,107,101,98,97,121,46,109,117,115,101,
+    117,109,0,99,104,105,99,97,103,111,46,109,117,115,101,117,
+    109,0,99,104,105,99,97,112,112,97,46,106,112,0,99,104,
+    105,99,104,105,98,117,46,115,97,105,116,97,109,97,46,106,
+    112,0,99,104,105,101,116,105,46,105,116,0,99,104,105,103,
+    97,115,97,107,105,46,107,97,110,97,103,97,119,97,46,106,
+    112,0,99,104,105,104,97,121,97,97,107,97,115,97,107,97,
+    46,111,115,97,107,97,46,106,112,0,99,104,105,106,105,119,
+    97,46,110,97,103,97,115,97,107,105,46,106,112,0,99,104,
+    105,107,117,103,111,46,102,117,107,117,111,107,97,46,106,112,
+    0,99,104,105,107,117,104,111,46,102,117,107,117,111,107,97,
+    46,106,112,0,99,104,105,107,117,104,111,107,117,46,110,97,
+    103,97,110,111,46,106,112,0,99,104,105,107,117,106,111,46,
+    102,117,107,117,111,107,97,46,106,112,0,99,104,105,107,117,
+    109,97,46,110,97,103,97,110,111,46,106,112,0,99,104,105,
+    107,117,115,101,105,46,105,98,97,114,97,107,105,46,106,112,
+    0,99,104,105,107,117,115,104,105,110,111,46,102,117,107,117,
+    111,107,97,46,106,112,0,99,104,105,107,117,122,101,110,46,
+    102,117,107,117,111,107,97,46,106,112,0,99,104,105,108,100,
+    114,101,110,46,109,117,115,101,117,109,0,99,104,105,108,100,
+    114,101,110,115,46,109,117,115,101,117,109,0,99,104,105,108,
+    100,114,101,110,115,103,97,114,100,101,110,46,109,117,115,101,
+    117,109,0,99,104,105,108,108,111,117,116,46,106,112,0,99,
+    104,105,109,107,101,110,116,46,115,117,0,99,104,105,110,111,
+    46,110,97,103,97,110,111,46,106,112,0,99,104,105,110,116,
+    97,105,0,99,104,105,112,112,117,98,101,116,115,117,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,99,104,105,112,115,
+    46,106,112,0,99,104,105,114,111,112,114,97,99,116,105,99,
+    46,109,117,115,101,117,109,0,99,104,105,114,117,114,103,105,
+    101,110,115,45,100,101,110,116,105,115,116,101,115,45,101,110,
+    45,102,114,97,110,99,101,46,102,114,0,99,104,105,114,117,
+    114,103,105,101,110,115,45,100,101,110,116,105,115,116,101,115,
+    46,102,114,0,99,104,105,114,121,117,46,97,105,99,104,105,
+    46,106,112,0,99,104,105,116,97,46,97,105,99,104,105,46,
+    106,112,0,99,104,105,116,111,115,101,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,99,104,105,121,111,100,97,46,103,
+    117,110,109,97,46,106,112,0,99,104,105,121,111,100,97,46,
+    116,111,107,121,111,46,106,112,0,99,104,105,122,117,46,116,
+    111,116,116,111,114,105,46,106,112,0,99,104,111,99,111,108,
+    97,116,101,46,109,117,115,101,117,109,0,99,104,111,102,117,
+    46,116,111,107,121,111,46,106,112,0,99,104,111,110,97,110,
+    46,99,104,105,98,97,46,106,112,0,99,104,111,115,101,105,
+    46,99,104,105,98,97,46,106,112,0,99,104,111,115,104,105,
+    46,99,104,105,98,97,46,106,112,0,99,104,111,119,100,101,
+    114,46,106,112,0,99,104,111,121,111,46,107,117,109,97,109,
+    111,116,111,46,106,112,0,99,104,114,105,115,116,105,97,110,
+    115,98,117,114,103,46,109,117,115,101,117,109,0,99,104,114,
+    105,115,116,109,97,115,0,99,104,114,111,109,101,0,99,104,
+    116,114,46,107,49,50,46,109,97,46,117,115,0,99,104,117,
+    46,106,112,0,99,104,117,110,103,98,117,107,46,107,114,0,
+    99,104,117,110,103,110,97,109,46,107,114,0,99,104,117,111,
+    46,99,104,105,98,97,46,106,112,0,99,104,117,111,46,102,
+    117,107,117,111,107,97,46,106,112,0,99,104,117,111,46,111,
+    115,97,107,97,46,106,112,0,99,104,117,111,46,116,111,107,
+    121,111,46,106,112,0,99,104,117,111,46,121,97,109,97,110,
+    97,115,104,105,46,106,112,0,99,104,117,114,99,104,0,99,
+    105,46,105,116,0,99,105,97,111,46,106,112,0,99,105,101,
+    110,99,105,97,46,98,111,0,99,105,101,115,122,121,110,46,
+    112,108,0,99,105,109,46,98,114,0,99,105,110,99,105,110,
+    110,97,116,105,46,109,117,115,101,117,109,0,99,105,110,101,
+    109,97,46,109,117,115,101,117,109,0,99,105,112,114,105,97,
+    110,105,0,99,105,114,99,108,101,0,99,105,114,99,117,115,
+    46,109,117,115,101,117,109,0,99,105,115,99,111,0,99,105,
+    115,99,111,102,114,101,97,107,46,99,111,109,0,99,105,115,
+    116,114,111,110,46,110,108,0,99,105,116,97,100,101,108,0,
+    99,105,116,105,0,99,105,116,105,99,0,99,105,116,121,0,
+    99,105,116,121,46,104,117,0,99,105,116,121,46,107,97,119,
+    97,115,97,107,105,46,106,112,0,99,105,116,121,46,107,105,
+    116,97,107,121,117,115,104,117,46,106,112,0,99,105,116,121,
+    46,107,111,98,101,46,106,112,0,99,105,116,121,46,110,97,
+    103,111,121,97,46,106,112,0,99,105,116,121,46,115,97,112,
+    112,111,114,111,46,106,112,0,99,105,116,121,46,115,101,110,
+    100,97,105,46,106,112,0,99,105,116,121,46,121,111,107,111,
+    104,97,109,97,46,106,112,0,99,105,116,121,101,97,116,115,
+    0,99,105,118,105,108,97,118,105,97,116,105,111,110,46,97,
+    101,114,111,0,99,105,118,105,108,105,115,97,116,105,111,110,
+    46,109,117,115,101,117,109,0,99,105,118,105,108,105,122,97,
+    116,105,111,110,46,109,117,115,101,117,109,0,99,105,118,105,
+    108,119,97,114,46,109,117,115,101,117,109,0,99,107,46,117,
+    97,0,99,108,46,105,116,0,99,108,97,105,109,115,0,99,
+    108,97,110,46,114,105,112,0,99,108,101,97,110,105,110,103,
+    0,99,108,101,114,107,46,97,112,112,0,99,108,101,114,107,
+    115,116,97,103,101,46,97,112,112,0,99,108,101,118,101,114,
+    97,112,112,115,46,105,111,0,99,108,105,99,107,0,99,108,
+    105,99,107,101,116,99,108,111,117,100,46,99,111,109,0,99,
+    108,105,99,107,114,105,115,105,110,103,46,110,101,116,0,99,
+    108,105,110,105,99,0,99,108,105,110,105,113,117,101,0,99,
+    108,105,110,116,111,110,46,109,117,115,101,117,109,0,99,108,
+    111,99,107,46,109,117,115,101,117,109,0,99,108,111,116,104,
+    105,110,103,0,99,108,111,117,100,45,102,114,49,46,117,110,
+    105,115,112,97,99,101,46,105,111,0,99,108,111,117,100,46,
+    102,101,100,111,114,97,112,114,111,106,101,99,116,46,111,114,
+    103,0,99,108,111,117,100,46,103,111,111,103,0,99,108,111,
+    117,100,46,105,110,116,101,114,104,111,115,116,115,111,108,117,
+    116,105,111,110,115,46,98,101,0,99,108,111,117,100,46,106,
+    101,108,97,115,116,105,99,46,111,112,101,110,46,116,105,109,
+    46,105,116,0,99,108,111,117,100,46,109,101,116,97,99,101,
+    110,116,114,117,109,46,99,122,0,99,108,111,117,100,46,110,
+    111,115,112,97,109,112,114,111,120,121,46,99,111,109,0,99,
+    108,111,117,100,54,54,46,119,115,0,99,108,111,117,100,54,
+    54,46,122,111,110,101,0,99,108,111,117,100,97,99,99,101,
+    115,115,46,104,111,115,116,0,99,108,111,117,100,97,99,99,
+    101,115,115,46,110,101,116,0,99,108,111,117,100,97,112,112,
+    46,110,101,116,0,99,108,111,117,100,99,111,110,116,114,111,
+    108,97,112,112,46,99,111,109,0,99,108,111,117,100,99,111,
+    110,116,114,111,108,108,101,100,46,99,111,109,0,99,108,111,
+    117,100,101,114,97,46,115,105,116,101,0,99,108,111,117,100,
+    102,108,97,114,101,45,105,112,102,115,46,99,111,109,0,99,
+    108,111,117,100,102,114,111,110,116,46,110,101,116,0,99,108,
+    111,117,100,102,117,110,99,116,105,111,110,115,46,110,101,116,
+    0,99,108,111,117,100,110,115,46,97,115,105,97,0,99,108,
+    111,117,100,110,115,46,98,105,122,0,99,108,111,117,100,110,
+    115,46,99,99,0,99,108,111,117,100,110,115,46,99,108,117,
+    98,0,99,108,111,117,100,110,115,46,101,117,0,99,108,111,
+    117,100,110,115,46,105,110,0,99,108,111,117,100,110,115,46,
+    105,110,102,111,0,99,108,111,117,100,110,115,46,111,114,103,
+    0,99,108,111,117,100,110,115,46,112,114,111,0,99,108,111,
+    117,100,110,115,46,112,119,0,99,108,111,117,100,110,115,46,
+    117,115,0,99,108,111,117,100,115,105,116,101,46,98,117,105,
+    108,100,101,114,115,0,99,108,111,117,100,121,99,108,117,115,
+    116,101,114,46,110,101,116,0,99,108,117,98,46,97,101,114,
+    111,0,99,108,117,98,46,116,119,0,99,108,117,98,109,101,
+    100,0,99,110,45,110,111,114,116,104,45,49,46,101,98,46,
+    97,109,97,122,111,110,97,119,115,46,99,111,109,46,99,110,
+    0,99,110,45,110,111,114,116,104,119,101,115,116,45,49,46,
+    101,98,46,97,109,97,122,111,110,97,119,115,46,99,111,109,
+    46,99,110,0,99,110,46,99,111,109,0,99,110,46,101,117,
+    46,111,114,103,0,99,110,46,105,110,0,99,110,46,105,116,
+    0,99,110,46,117,97,0,99,110,46,118,117,0,99,110,103,
+    46,98,114,0,99,110,112,121,46,103,100,110,0,99,110,115,
+    46,106,111,121,101,110,116,46,99,111,109,0,99,110,116,46,
+    98,114,0,99,111,46,97,101,0,99,111,46,97,103,0,99,
+    111,46,97,109,0,99,111,46,97,111,0,99,111,46,98,98,
+    0,99,111,46,98,105,0,99,111,46,98,106,0,99,111,46,
+    98,110,0,99,111,46,98,117,115,105,110,101,115,115,0,99,
+    111,46,98,119,0,99,111,46,99,97,0,99,111,46,99,105,
+    0,99,111,46,99,108,0,99,111,46,99,109,0,99,111,46,
+    99,111,109,0,99,111,46,99,114,0,99,111,46,99,122,0,
+    99,111,46,100,107,0,99,111,46,101,100,117,99,97,116,105,
+    111,110,0,99,111,46,101,118,101,110,116,115,0,99,111,46,
+    102,105,110,97,110,99,105,97,108,0,99,111,46,103,103,0,
+    99,111,46,103,108,0,99,111,46,103,121,0,99,111,46,104,
+    117,0,99,111,46,105,110,0,99,111,46,105,114,0,99,111,
+    46,105,116,0,99,111,46,106,101,0,99,111,46,106,112,0,
+    99,111,46,107,114,0,99,111,46,107,114,100,0,99,111,46,
+    108,99,0,99,111,46,108,115,0,99,111,46,109,97,0,99,
+    111,46,109,101,0,99,111,46,109,103,0,99,111,46,109,117,
+    0,99,111,46,109,119,0,99,111,46,109,122,0,99,111,46,
+    110,97,0,99,111,46,110,101,116,119,111,114,107,0,99,111,
+    46,110,105,0,99,111,46,110,108,0,99,111,46,110,111,0,
+    99,111,46,111,109,0,99,111,46,112,108,0,99,111,46,112,
+    108,97,99,101,0,99,111,46,112,110,0,99,111,46,112,119,
+    0,99,111,46,114,111,0,99,111,46,114,115,0,99,111,46,
+    114,119,0,99,111,46,115,116,0,99,111,46,115,122,0,99,
+    111,46,116,101,99,104,110,111,108,111,103,121,0,99,111,46,
+    116,104,0,99,111,46,116,106,0,99,111,46,116,109,0,99,
+    111,46,116,116,0,99,111,46,116,122,0,99,111,46,117,97,
+    0,99,111,46,117,103,0,99,111,46,117,122,0,99,111,46,
+    118,101,0,99,111,46,118,105,0,99,111,46,122,109,0,99,
+    111,46,122,119,0,99,111,97,99,104,0,99,111,97,108,46,
+    109,117,115,101,117,109,0,99,111,97,115,116,97,108,100,101,
+    102,101,110,99,101,46,109,117,115,101,117,109,0,99,111,99,
+    111,116,116,101,46,106,112,0,99,111,100,101,46,114,117,110,
+    0,99,111,100,101,98,101,114,103,46,112,97,103,101,0,99,
+    111,100,101,115,112,111,116,46,99,111,109,0,99,111,100,121,
+    46,109,117,115,101,117,109,0,99,111,102,102,101,101,0,99,
+    111,103,46,109,105,46,117,115,0,99,111,108,46,110,103,0,
+    99,111,108,100,119,97,114,46,109,117,115,101,117,109,0,99,
+    111,108,108,101,99,116,105,111,110,46,109,117,115,101,117,109,
+    0,99,111,108,108,101,103,101,0,99,111,108,108,101,103,101,
+    102,97,110,46,111,114,103,0,99,111,108,111,103,110,101,0,
+    99,111,108,111,110,105,97,108,119,105,108,108,105,97,109,115,
+    98,117,114,103,46,109,117,115,101,117,109,0,99,111,108,111,
+    114,97,100,111,112,108,97,116,101,97,117,46,109,117,115,101,
+    117,109,0,99,111,108,117,109,98,105,97,46,109,117,115,101,
+    117,109,0,99,111,108,117,109,98,117,115,46,109,117,115,101,
+    117,109,0,99,111,109,46,97,99,0,99,111,109,46,97,102,
+    0,99,111,109,46,97,103,0,99,111,109,46,97,105,0,99,
+    111,109,46,97,108,0,99,111,109,46,97,109,0,99,111,109,
+    46,97,119,0,99,111,109,46,97,122,0,99,111,109,46,98,
+    97,0,99,111,109,46,98,98,0,99,111,109,46,98,104,0,
+    99,111,109,46,98,105,0,99,111,109,46,98,106,0,99,111,
+    109,46,98,109,0,99,111,109,46,98,110,0,99,111,109,46,
+    98,111,0,99,111,109,46,98,115,0,99,111,109,46,98,116,
+    0,99,111,109,46,98,122,0,99,111,109,46,99,105,0,99,
+    111,109,46,99,109,0,99,111,109,46,99,117,0,99,111,109,
+    46,99,118,0,99,111,109,46,99,119,0,99,111,109,46,100,
+    101,0,99,111,109,46,100,109,0,99,111,109,46,100,111,0,
+    99,111,109,46,100,122,0,99,111,109,46,101,99,0,99,111,
+    109,46,101,116,0,99,111,109,46,102,106,0,99,111,109,46,
+    102,109,0,99,111,109,46,102,114,0,99,111,109,46,103,101,
+    0,99,111,109,46,103,104,0,99,111,109,46,103,105,0,99,
+    111,109,46,103,108,0,99,111,109,46,103,110,0,99,111,109,
+    46,103,112,0,99,111,109,46,103,114,0,99,111,109,46,103,
+    116,0,99,111,109,46,103,117,0,99,111,109,46,103,121,0,
+    99,111,109,46,104,107,0,99,111,109,46,104,110,0,99,111,
+    109,46,104,114,0,99,111,109,46,104,116,0,99,111,109,46,
+    105,109,0,99,111,109,46,105,110,0,99,111,109,46,105,111,
+    0,99,111,109,46,105,113,0,99,111,109,46,105,115,0,99,
+    111,109,46,106,111,0,99,111,109,46,107,103,0,99,111,109,
+    46,107,105,0,99,111,109,46,107,109,0,99,111,109,46,107,
+    112,0,99,111,109,46,107,119,0,99,111,109,46,107,121,0,
+    99,111,109,46,107,122,0,99,111,109,46,108,97,0,99,111,
+    109,46,108,98,0,99,111,109,46,108,99,0,99,111,109,46,
+    108,107,0,99,111,109,46,108,114,0,99,111,109,46,108,118,
+    0,99,111,109,46,108,121,0,99,111,109,46,109,103,0,99,
+    111,109,46,109,107,0,99,111,109,46,109,108,0,99,111,109,
+    46,109,111,0,99,111,109,46,109,115,0,99,111,109,46,109,
+    117,0,99,111,109,46,109,118,0,99,111,109,46,109,119,0,
+    99,111,109,46,109,120,0,99,111,109,46,109,121,0,99,111,
+    109,46,110,97,0,99,111,109,46,110,102,0,99,111,109,46,
+    110,105,0,99,111,109,46,110,114,0,99,111,109,46,111,109,
+    0,99,111,109,46,112,97,0,99,111,109,46,112,101,0,99,
+    111,109,46,112,102,0,99,111,109,46,112,104,0,99,111,109,
+    46,112,107,0,99,111,109,46,112,108,0,99,111,109,46,112,
+    114,0,99,111,109,46,112,115,0,99,111,109,46,112,116,0,
+    99,111,109,46,112,121,0,99,111,109,46,113,97,0,99,111,
+    109,46,114,101,0,99,111,109,46,114,111,0,99,111,109,46,
+    114,117,0,99,111,109,46,115,97,0,99,111,109,46,115,98,
+    0,99,111,109,46,115,99,0,99,111,109,46,115,100,0,99,
+    111,109,46,115,101,0,99,111,109,46,115,103,0,99,111,109,
+    46,115,104,0,99,111,109,46,115,108,0,99,111,109,46,115,
+    110,0,99,111,109,46,115,111,0,99,111,109,46,115,115,0,
+    99,111,109,46,115,116,0,99,111,109,46,115,118,0,99,111,
+    109,46,115,121,0,99,111,109,46,116,106,0,99,111,109,46,
+    116,109,0,99,111,109,46,116,110,0,99,111,109,46,116,111,
+    0,99,111,109,46,116,116,0,99,111,109,46,117,97,0,99,
+    111,109,46,117,103,0,99,111,109,46,117,122,0,99,111,109,
+    46,118,99,0,99,111,109,46,118,101,0,99,111,109,46,118,
+    105,0,99,111,109,46,118,110,0,99,111,109,46,118,117,0,
+    99,111,109,46,119,115,0,99,111,109,46,121,101,0,99,111,
+    109,46,122,109,0,99,111,109,99,97,115,116,0,99,111,109,
+    109,98,97,110,107,0,99,111,109,109,117,110,101,46,97,109,
+    0,99,111,109,109,117,110,105,99,97,116,105,111,110,46,109,
+    117,115,101,117,109,0,99,111,109,109,117,110,105,99,97,116,
+    105,111,110,115,46,109,117,115,101,117,109,0,99,111,109,109,
+    117,110,105,116,121,45,112,114,111,46,100,101,0,99,111,109,
+    109,117,110,105,116,121,45,112,114,111,46,110,101,116,0,99,
+    111,109,109,117,110,105,116,121,46,109,117,115,101,117,109,0,
+    99,111,109,111,46,105,116,0,99,111,109,112,97,110,121,0,
+    99,111,109,112,97,114,101,0,99,111,109,112,117,116,101,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    99,111,109,112,117,116,101,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,99,111,109,112,117,116,101,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,46,99,110,0,99,
+    111,109,112,117,116,101,46,101,115,116,97,116,101,0,99,111,
+    109,112,117,116,101,114,0,99,111,109,112,117,116,101,114,46,
+    109,117,115,101,117,109,0,99,111,109,112,117,116,101,114,104,
+    105,115,116,111,114,121,46,109,117,115,101,117,109,0,99,111,
+    109,115,101,99,0,99,111,109,117,110,105,99,97,195,167,195,
+    181,101,115,46,109,117,115,101,117,109,0,99,111,110,100,111,
+    115,0,99,111,110,102,46,97,117,0,99,111,110,102,46,108,
+    118,0,99,111,110,102,46,115,101,0,99,111,110,102,101,114,
+    101,110,99,101,46,97,101,114,111,0,99,111,110,110,46,117,
+    107,0,99,111,110,115,116,114,117,99,116,105,111,110,0,99,
+    111,110,115,117,108,97,100,111,46,115,116,0,99,111,110,115,
+    117,108,116,97,110,116,46,97,101,114,111,0,99,111,110,115,
+    117,108,116,105,110,103,0,99,111,110,115,117,108,116,105,110,
+    103,46,97,101,114,111,0,99,111,110,116,97,99,116,0,99,
+    111,110,116,97,103,101,109,46,98,114,0,99,111,110,116,101,
+    109,112,111,114,97,114,121,46,109,117,115,101,117,109,0,99,
+    111,110,116,101,109,112,111,114,97,114,121,97,114,116,46,109,
+    117,115,101,117,109,0,99,111,110,116,114,97,99,116,111,114,
+    115,0,99,111,110,116,114,111,108,46,97,101,114,111,0,99,
+    111,110,118,101,110,116,46,109,117,115,101,117,109,0,99,111,
+    111,107,105,110,103,0,99,111,111,107,105,110,103,99,104,97,
+    110,110,101,108,0,99,111,111,108,98,108,111,103,46,106,112,
+    0,99,111,111,112,0,99,111,111,112,46,97,114,0,99,111,
+    111,112,46,98,114,0,99,111,111,112,46,104,116,0,99,111,
+    111,112,46,105,110,0,99,111,111,112,46,107,109,0,99,111,
+    111,112,46,109,118,0,99,111,111,112,46,109,119,0,99,111,
+    111,112,46,112,121,0,99,111,111,112,46,114,119,0,99,111,
+    111,112,46,116,116,0,99,111,111,112,101,114,97,116,105,118,
+    97,46,98,111,0,99,111,112,101,110,104,97,103,101,110,46,
+    109,117,115,101,117,109,0,99,111,112,114,111,46,117,107,0,
+    99,111,114,112,111,114,97,116,105,111,110,46,109,117,115,101,
+    117,109,0,99,111,114,114,101,105,111,115,45,101,45,116,101,
+    108,101,99,111,109,117,110,105,99,97,195,167,195,181,101,115,
+    46,109,117,115,101,117,109,0,99,111,114,115,105,99,97,0,
+    99,111,114,118,101,116,116,101,46,109,117,115,101,117,109,0,
+    99,111,115,101,110,122,97,46,105,116,0,99,111,115,116,117,
+    109,101,46,109,117,115,101,117,109,0,99,111,117,99,104,112,
+    111,116,97,116,111,102,114,105,101,115,46,111,114,103,0,99,
+    111,117,110,99,105,108,46,97,101,114,111,0,99,111,117,110,
+    116,114,121,0,99,111,117,110,116,114,121,101,115,116,97,116,
+    101,46,109,117,115,101,117,109,0,99,111,117,110,116,121,46,
+    109,117,115,101,117,109,0,99,111,117,112,111,110,0,99,111,
+    117,112,111,110,115,0,99,111,117,114,115,101,115,0,99,111,
+    122,46,98,114,0,99,112,97,0,99,112,97,46,112,114,111,
+    0,99,113,46,99,110,0,99,114,46,105,116,0,99,114,46,
+    117,97,0,99,114,97,102,116,105,110,103,46,120,121,122,0,
+    99,114,97,102,116,115,46,109,117,115,101,117,109,0,99,114,
+    97,110,98,114,111,111,107,46,109,117,115,101,117,109,0,99,
+    114,97,110,107,121,46,106,112,0,99,114,100,46,99,111,0,
+    99,114,101,97,116,105,111,110,46,109,117,115,101,117,109,0,
+    99,114,101,100,105,116,0,99,114,101,100,105,116,99,97,114,
+    100,0,99,114,101,100,105,116,117,110,105,111,110,0,99,114,
+    101,109,111,110,97,46,105,116,0,99,114,101,119,46,97,101,
+    114,111,0,99,114,105,46,98,114,0,99,114,105,46,110,122,
+    0,99,114,105,99,107,101,116,0,99,114,105,109,101,97,46,
+    117,97,0,99,114,111,116,111,110,101,46,105,116,0,99,114,
+    111,119,110,0,99,114,115,0,99,114,117,105,115,101,0,99,
+    114,117,105,115,101,115,0,99,114,121,112,116,111,110,111,109,
+    105,99,46,110,101,116,0,99,115,46,105,110,0,99,115,46,
+    105,116,0,99,115,46,107,101,108,105,119,101,98,46,99,108,
+    111,117,100,0,99,115,120,46,99,99,0,99,116,46,105,116,
+    0,99,117,105,97,98,97,46,98,114,0,99,117,105,115,105,
+    110,101,108,108,97,0,99,117,108,116,117,114,97,108,46,109,
+    117,115,101,117,109,0,99,117,108,116,117,114,97,108,99,101,
+    110,116,101,114,46,109,117,115,101,117,109,0,99,117,108,116,
+    117,114,101,46,109,117,115,101,117,109,0,99,117,110,101,111,
+    46,105,116,0,99,117,112,99,97,107,101,46,105,115,0,99,
+    117,114,105,116,105,98,97,46,98,114,0,99,117,114,118,46,
+    100,101,118,0,99,117,115,116,46,100,101,118,46,116,104,105,
+    110,103,100,117,115,116,46,105,111,0,99,117,115,116,46,100,
+    105,115,114,101,99,46,116,104,105,110,103,100,117,115,116,46,
+    105,111,0,99,117,115,116,46,112,114,111,100,46,116,104,105,
+    110,103,100,117,115,116,46,105,111,0,99,117,115,116,46,114,
+    101,116,114,111,115,110,117,98,46,99,111,46,117,107,0,99,
+    117,115,116,46,116,101,115,116,105,110,103,46,116,104,105,110,
+    103,100,117,115,116,46,105,111,0,99,117,115,116,111,109,46,
+    109,101,116,97,99,101,110,116,114,117,109,46,99,122,0,99,
+    117,115,116,111,109,101,114,46,109,121,116,104,105,99,45,98,
+    101,97,115,116,115,46,99,111,109,0,99,117,115,116,111,109,
+    101,114,46,115,112,101,101,100,112,97,114,116,110,101,114,46,
+    100,101,0,99,117,116,101,103,105,114,108,46,106,112,0,99,
+    118,46,117,97,0,99,120,46,117,97,0,99,121,46,101,117,
+    46,111,114,103,0,99,121,97,46,103,103,0,99,121,98,101,
+    114,46,109,117,115,101,117,109,0,99,121,109,114,117,0,99,
+    121,109,114,117,46,109,117,115,101,117,109,0,99,121,111,110,
+    46,108,105,110,107,0,99,121,111,110,46,115,105,116,101,0,
+    99,121,111,117,0,99,122,46,101,117,46,111,114,103,0,99,
+    122,46,105,116,0,99,122,101,108,97,100,122,46,112,108,0,
+    99,122,101,115,116,46,112,108,0,100,46,98,103,0,100,46,
+    103,118,46,118,99,0,100,46,115,101,0,100,97,97,46,106,
+    112,0,100,97,98,117,114,0,100,97,100,0,100,97,101,103,
+    117,46,107,114,0,100,97,101,106,101,111,110,46,107,114,0,
+    100,97,101,109,111,110,46,112,97,110,101,108,46,103,103,0,
+    100,97,103,101,115,116,97,110,46,114,117,0,100,97,103,101,
+    115,116,97,110,46,115,117,0,100,97,105,103,111,46,105,98,
+    97,114,97,107,105,46,106,112,0,100,97,105,115,101,110,46,
+    97,107,105,116,97,46,106,112,0,100,97,105,116,111,46,111,
+    115,97,107,97,46,106,112,0,100,97,105,119,97,46,104,105,
+    114,111,115,104,105,109,97,46,106,112,0,100,97,108,105,46,
+    109,117,115,101,117,109,0,100,97,108,108,97,115,46,109,117,
+    115,101,117,109,0,100,97,109,110,115,101,114,118,101,114,46,
+    99,111,109,0,100,97,110,99,101,0,100,97,116,97,0,100,
+    97,116,97,98,97,115,101,46,109,117,115,101,117,109,0,100,
+    97,116,97,98,97,115,101,46,114,117,110,0,100,97,116,101,
+    0,100,97,116,101,46,102,117,107,117,115,104,105,109,97,46,
+    106,112,0,100,97,116,101,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,100,97,116,105,110,103,0,100,97,116,115,117,
+    110,0,100,97,116,116,111,108,111,99,97,108,46,99,111,109,
+    0,100,97,116,116,111,108,111,99,97,108,46,110,101,116,0,
+    100,97,116,116,111,114,101,108,97,121,46,99,111,109,0,100,
+    97,116,116,111,119,101,98,46,99,111,109,0,100,97,118,118,
+    101,110,106,97,114,103,97,46,110,111,0,100,97,118,118,101,
+    110,106,195,161,114,103,97,46,110,111,0,100,97,118,118,101,
+    115,105,105,100,97,46,110,111,0,100,97,121,0,100,97,122,
+    97,105,102,117,46,102,117,107,117,111,107,97,46,106,112,0,
+    100,99,108,107,0,100,100,45,100,110,115,46,100,101,0,100,
+    100,110,115,46,109,101,0,100,100,110,115,46,110,101,116,0,
+    100,100,110,115,53,46,99,111,109,0,100,100,110,115,102,114,
+    101,101,46,99,111,109,0,100,100,110,115,103,101,101,107,46,
+    99,111,109,0,100,100,110,115,107,105,110,103,46,99,111,109,
+    0,100,100,110,115,108,105,118,101,46,99,111,109,0,100,100,
+    110,115,115,46,111,114,103,0,100,100,114,46,109,117,115,101,
+    117,109,0,100,100,115,0,100,101,46,99,111,109,0,100,101,
+    46,99,111,111,108,0,100,101,46,101,117,46,111,114,103,0,
+    100,101,46,103,116,0,100,101,46,108,115,0,100,101,46,109,
+    100,0,100,101,46,116,114,101,110,100,104,111,115,116,105,110,
+    103,46,99,108,111,117,100,0,100,101,97,108,0,100,101,97,
+    108,101,114,0,100,101,97,108,115,0,100,101,97,116,110,117,
+    46,110,111,0,100,101,98,105,97,110,46,110,101,116,0,100,
+    101,99,97,46,106,112,0,100,101,99,105,46,106,112,0,100,
+    101,99,111,114,97,116,105,118,101,97,114,116,115,46,109,117,
+    115,101,117,109,0,100,101,100,105,98,111,120,46,102,114,0,
+    100,101,100,121,110,46,105,111,0,100,101,102,46,98,114,0,
+    100,101,102,105,110,105,109,97,46,105,111,0,100,101,102,105,
+    110,105,109,97,46,110,101,116,0,100,101,103,114,101,101,0,
+    100,101,108,97,119,97,114,101,46,109,117,115,101,117,109,0,
+    100,101,108,104,105,46,105,110,0,100,101,108,105,118,101,114,
+    121,0,100,101,108,108,0,100,101,108,108,45,111,103,108,105,
+    97,115,116,114,97,46,105,116,0,100,101,108,108,111,103,108,
+    105,97,115,116,114,97,46,105,116,0,100,101,108,109,101,110,
+    104,111,114,115,116,46,109,117,115,101,117,109,0,100,101,108,
+    111,105,116,116,101,0,100,101,108,116,97,0,100,101,109,111,
+    46,100,97,116,97,99,101,110,116,101,114,46,102,105,0,100,
+    101,109,111,46,100,97,116,97,100,101,116,101,99,116,46,99,
+    111,109,0,100,101,109,111,46,106,101,108,97,115,116,105,99,
+    46,99,111,109,0,100,101,109,111,99,114,97,99,105,97,46,
+    98,111,0,100,101,109,111,99,114,97,116,0,100,101,109,111,
+    110,46,110,108,0,100,101,110,109,97,114,107,46,109,117,115,
+    101,117,109,0,100,101,110,111,45,115,116,97,103,105,110,103,
+    46,100,101,118,0,100,101,110,111,46,100,101,118,0,100,101,
+    110,116,97,108,0,100,101,110,116,105,115,116,0,100,101,112,
+    46,110,111,0,100,101,112,111,114,116,101,46,98,111,0,100,
+    101,112,111,116,46,109,117,115,101,117,109,0,100,101,115,46,
+    98,114,0,100,101,115,97,46,105,100,0,100,101,115,105,0,
+    100,101,115,105,103,110,46,97,101,114,111,0,100,101,115,105,
+    103,110,46,109,117,115,101,117,109,0,100,101,116,46,98,114,
+    0,100,101,116,97,46,97,112,112,0,100,101,116,97,46,100,
+    101,118,0,100,101,116,114,111,105,116,46,109,117,115,101,117,
+    109,0,100,101,118,45,98,117,105,108,100,101,114,46,99,111,
+    100,101,46,99,111,109,0,100,101,118,45,109,121,113,110,97,
+    112,99,108,111,117,100,46,99,111,109,0,100,101,118,46,97,
+    100,111,98,101,97,101,109,99,108,111,117,100,46,99,111,109,
+    0,100,101,118,46,98,114,0,100,101,118,46,115,116,97,116,
+    105,99,46,108,97,110,100,0,100,101,118,46,118,117,0,100,
+    101,118,99,100,110,97,99,99,101,115,115,111,46,99,111,109,
+    0,100,101,118,101,108,111,112,101,114,46,97,112,112,0,100,
+    101,118,101,108,111,112,109,101,110,116,46,114,117,110,0,100,
+    101,118,105,99,101,115,46,114,101,115,105,110,115,116,97,103,
+    105,110,103,46,105,111,0,100,102,46,103,111,118,46,98,114,
+    0,100,102,46,108,101,103,46,98,114,0,100,103,99,97,46,
+    97,101,114,111,0,100,104,46,98,121,116,101,109,97,114,107,
+    46,99,111,46,117,107,0,100,104,108,0,100,105,97,100,101,
+    109,46,99,108,111,117,100,0,100,105,97,109,111,110,100,115,
+    0,100,105,101,108,100,100,97,110,117,111,114,114,105,46,110,
+    111,0,100,105,101,116,0,100,105,103,105,99,107,46,106,112,
+    0,100,105,103,105,116,97,108,111,99,101,97,110,115,112,97,
+    99,101,115,46,99,111,109,0,100,105,104,101,114,46,115,111,
+    108,117,116,105,111,110,115,0,100,105,110,111,115,97,117,114,
+    46,109,117,115,101,117,109,0,100,105,114,101,99,116,0,100,
+    105,114,101,99,116,46,113,117,105,99,107,99,111,110,110,101,
+    99,116,46,99,110,0,100,105,114,101,99,116,46,113,117,105,
+    99,107,99,111,110,110,101,99,116,46,116,111,0,100,105,114,
+    101,99,116,111,114,121,0,100,105,115,99,111,114,100,115,97,
+    121,115,46,99,111,109,0,100,105,115,99,111,114,100,115,101,
+    122,46,99,111,109,0,100,105,115,99,111,117,110,116,0,100,
+    105,115,99,111,117,114,115,101,46,103,114,111,117,112,0,100,
+    105,115,99,111,117,114,115,101,46,116,101,97,109,0,100,105,
+    115,99,111,118,101,114,0,100,105,115,99,111,118,101,114,121,
+    46,109,117,115,101,117,109,0,100,105,115,104,0,100,105,115,
+    107,115,116,97,116,105,111,110,46,101,117,0,100,105,115,107,
+    115,116,97,116,105,111,110,46,109,101,0,100,105,115,107,115,
+    116,97,116,105,111,110,46,111,114,103,0,100,105,115,107,117,
+    115,115,105,111,110,115,98,101,114,101,105,99,104,46,100,101,
+    0,100,105,116,99,104,121,111,117,114,105,112,46,99,111,109,
+    0,100,105,118,116,97,115,118,117,111,100,110,97,46,110,111,
+    0,100,105,118,116,116,97,115,118,117,111,116,110,97,46,110,
+    111,0,100,105,121,0,100,106,0,100,107,46,101,117,46,111,
+    114,103,0,100,108,117,103,111,108,101,107,97,46,112,108,0,
+    100,110,46,117,97,0,100,110,101,112,114,111,112,101,116,114,
+    111,118,115,107,46,117,97,0,100,110,105,46,117,115,0,100,
+    110,105,112,114,111,112,101,116,114,111,118,115,107,46,117,97,
+    0,100,110,112,0,100,110,115,97,108,105,97,115,46,99,111,
+    109,0,100,110,115,97,108,105,97,115,46,110,101,116,0,100,
+    110,115,97,108,105,97,115,46,111,114,103,0,100,110,115,100,
+    111,106,111,46,99,111,109,0,100,110,115,100,111,106,111,46,
+    110,101,116,0,100,110,115,100,111,106,111,46,111,114,103,0,
+    100,110,115,102,111,114,46,109,101,0,100,110,115,104,111,109,
+    101,46,100,101,0,100,110,115,105,115,107,105,110,107,121,46,
+    99,111,109,0,100,110,115,107,105,110,103,46,99,104,0,100,
+    110,115,117,112,46,110,101,116,0,100,110,115,117,112,100,97,
+    116,101,46,105,110,102,111,0,100,110,115,117,112,100,97,116,
+    101,114,46,100,101,0,100,111,99,115,0,100,111,99,116,111,
+    114,0,100,111,101,115,45,105,116,46,110,101,116,0,100,111,
+    101,115,110,116,101,120,105,115,116,46,99,111,109,0,100,111,
+    101,115,110,116,101,120,105,115,116,46,111,114,103,0,100,111,
+    103,0,100,111,108,108,115,46,109,117,115,101,117,109,0,100,
+    111,109,97,105,110,115,0,100,111,110,101,116,115,107,46,117,
+    97,0,100,111,110,110,97,46,110,111,0,100,111,110,111,115,
+    116,105,97,46,109,117,115,101,117,109,0,100,111,110,116,101,
+    120,105,115,116,46,99,111,109,0,100,111,110,116,101,120,105,
+    115,116,46,110,101,116,0,100,111,110,116,101,120,105,115,116,
+    46,111,114,103,0,100,111,111,109,100,110,115,46,99,111,109,
+    0,100,111,111,109,100,110,115,46,111,114,103,0,100,111,112,
+    97,97,115,46,99,111,109,0,100,111,115,104,105,46,121,97,
+    109,97,110,97,115,104,105,46,106,112,0,100,111,116,0,100,
+    111,118,114,101,46,110,111,0,100,111,119,110,108,111,97,100,
+    0,100,112,46,117,97,0,100,114,46,105,110,0,100,114,46,
+    110,97,0,100,114,46,116,114,0,100,114,97,109,109,101,110,
+    46,110,111,0,100,114,97,110,103,101,100,97,108,46,110,111,
+    0,100,114,97,121,45,100,110,115,46,100,101,0,100,114,97,
+    121,100,100,110,115,46,99,111,109,0,100,114,97,121,100,110,
+    115,46,100,101,0,100,114,101,97,109,104,111,115,116,101,114,
+    115,46,99,111,109,0,100,114,105,118,101,0,100,114,111,98,
+    97,107,46,110,111,0,100,114,114,46,97,99,0,100,114,117,
+    100,46,105,111,0,100,114,117,100,46,117,115,0,100,114,195,
+    184,98,97,107,46,110,111,0,100,115,99,108,111,117,100,46,
+    98,105,122,0,100,115,99,108,111,117,100,46,109,101,0,100,
+    115,99,108,111,117,100,46,109,111,98,105,0,100,115,109,121,
+    110,97,115,46,99,111,109,0,100,115,109,121,110,97,115,46,
+    110,101,116,0,100,115,109,121,110,97,115,46,111,114,103,0,
+    100,115,116,46,109,105,46,117,115,0,100,116,118,0,100,117,
+    98,97,105,0,100,117,99,107,100,110,115,46,111,114,103,0,
+    100,117,110,108,111,112,0,100,117,112,111,110,116,0,100,117,
+    114,98,97,110,0,100,117,114,104,97,109,46,109,117,115,101,
+    117,109,0,100,118,97,103,0,100,118,114,0,100,118,114,99,
+    97,109,46,105,110,102,111,0,100,118,114,100,110,115,46,111,
+    114,103,0,100,119,101,98,46,108,105,110,107,0,100,121,46,
+    102,105,0,100,121,110,45,98,101,114,108,105,110,46,100,101,
+    0,100,121,110,45,105,112,50,52,46,100,101,0,100,121,110,
+    45,111,45,115,97,117,114,46,99,111,109,0,100,121,110,45,
+    118,112,110,46,100,101,0,100,121,110,46,99,111,115,105,100,
+    110,115,46,100,101,0,100,121,110,46,100,100,110,115,115,46,
+    100,101,0,100,121,110,46,104,111,109,101,45,119,101,98,115,
+    101,114,118,101,114,46,100,101,0,100,121,110,53,51,46,105,
+    111,0,100,121,110,97,108,105,97,115,46,99,111,109,0,100,
+    121,110,97,108,105,97,115,46,110,101,116,0,100,121,110,97,
+    108,105,97,115,46,111,114,103,0,100,121,110,97,109,105,99,
+    45,100,110,115,46,105,110,102,111,0,100,121,110,97,109,105,
+    115,99,104,101,115,45,100,110,115,46,100,101,0,100,121,110,
+    97,116,104,111,109,101,46,110,101,116,0,100,121,110,100,110,
+    115,45,97,116,45,104,111,109,101,46,99,111,109,0,100,121,
+    110,100,110,115,45,97,116,45,119,111,114,107,46,99,111,109,
+    0,100,121,110,100,110,115,45,98,108,111,103,46,99,111,109,
+    0,100,121,110,100,110,115,45,102,114,101,101,46,99,111,109,
+    0,100,121,110,100,110,115,45,104,111,109,101,46,99,111,109,
+    0,100,121,110,100,110,115,45,105,112,46,99,111,109,0,100,
+    121,110,100,110,115,45,109,97,105,108,46,99,111,109,0,100,
+    121,110,100,110,115,45,111,102,102,105,99,101,46,99,111,109,
+    0,100,121,110,100,110,115,45,112,105,99,115,46,99,111,109,
+    0,100,121,110,100,110,115,45,114,101,109,111,116,101,46,99,
+    111,109,0,100,121,110,100,110,115,45,115,101,114,118,101,114,
+    46,99,111,109,0,100,121,110,100,110,115,45,119,101,98,46,
+    99,111,109,0,100,121,110,100,110,115,45,119,105,107,105,46,
+    99,111,109,0,100,121,110,100,110,115,45,119,111,114,107,46,
+    99,111,109,0,100,121,110,100,110,115,46,98,105,122,0,100,
+    121,110,100,110,115,46,100,97,112,112,110,111,100,101,46,105,
+    111,0,100,121,110,100,110,115,46,100,100,110,115,115,46,100,
+    101,0,100,121,110,100,110,115,46,105,110,102,111,0,100,121,
+    110,100,110,115,46,116,118,0,100,121,110,100,110,115,46,119,
+    115,0,100,121,110,100,110,115,49,46,100,101,0,100,121,110,
+    110,115,46,99,111,109,0,100,121,110,115,101,114,118,46,111,
+    114,103,0,100,121,110,117,46,110,101,116,0,100,121,110,118,
+    54,46,110,101,116,0,100,121,110,118,112,110,46,100,101,0,
+    100,121,114,111,121,46,110,111,0,100,121,114,195,184,121,46,
+    110,111,0,100,195,184,110,110,97,46,110,111,0,101,46,98,
+    103,0,101,46,115,101,0,101,49,50,46,118,101,0,101,49,
+    54,52,46,97,114,112,97,0,101,52,46,99,122,0,101,97,
+    115,116,45,107,97,122,97,107,104,115,116,97,110,46,115,117,
+    0,101,97,115,116,97,102,114,105,99,97,46,109,117,115,101,
+    117,109,0,101,97,115,116,97,115,105,97,46,97,122,117,114,
+    101,115,116,97,116,105,99,97,112,112,115,46,110,101,116,0,
+    101,97,115,116,99,111,97,115,116,46,109,117,115,101,117,109,
+    0,101,97,115,116,117,115,50,46,97,122,117,114,101,115,116,
+    97,116,105,99,97,112,112,115,46,110,101,116,0,101,97,115,
+    121,112,97,110,101,108,46,97,112,112,0,101,97,115,121,112,
+    97,110,101,108,46,104,111,115,116,0,101,97,116,0,101,97,
+    116,105,110,103,45,111,114,103,97,110,105,99,46,110,101,116,
+    0,101,97,116,111,110,46,109,105,46,117,115,0,101,98,101,
+    116,115,117,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    101,98,105,110,97,46,107,97,110,97,103,97,119,97,46,106,
+    112,0,101,98,105,110,111,46,109,105,121,97,122,97,107,105,
+    46,106,112,0,101,98,105,122,46,116,119,0,101,99,104,105,
+    122,101,110,46,102,117,107,117,105,46,106,112,0,101,99,110,
+    46,98,114,0,101,99,111,0,101,99,111,46,98,106,0,101,
+    99,111,46,98,114,0,101,99,111,108,111,103,105,97,46,98,
+    111,0,101,99,111,109,109,101,114,99,101,45,115,104,111,112,
+    46,112,108,0,101,99,111,110,111,46,98,106,0,101,99,111,
+    110,111,109,105,97,46,98,111,0,101,100,46,97,111,0,101,
+    100,46,99,105,0,101,100,46,99,114,0,101,100,46,106,112,
+    0,101,100,46,112,119,0,101,100,101,107,97,0,101,100,103,
+    101,97,112,112,46,110,101,116,0,101,100,103,101,99,111,109,
+    112,117,116,101,46,97,112,112,0,101,100,103,101,107,101,121,
+    45,115,116,97,103,105,110,103,46,110,101,116,0,101,100,103,
+    101,107,101,121,46,110,101,116,0,101,100,103,101,115,116,97,
+    99,107,46,109,101,0,101,100,103,101,115,117,105,116,101,45,
+    115,116,97,103,105,110,103,46,110,101,116,0,101,100,103,101,
+    115,117,105,116,101,46,110,101,116,0,101,100,105,116,111,114,
+    120,46,105,111,0,101,100,111,103,97,119,97,46,116,111,107,
+    121,111,46,106,112,0,101,100,117,46,97,99,0,101,100,117,
+    46,97,102,0,101,100,117,46,97,108,0,101,100,117,46,97,
+    114,0,101,100,117,46,97,122,0,101,100,117,46,98,97,0,
+    101,100,117,46,98,98,0,101,100,117,46,98,104,0,101,100,
+    117,46,98,105,0,101,100,117,46,98,106,0,101,100,117,46,
+    98,109,0,101,100,117,46,98,110,0,101,100,117,46,98,111,
+    0,101,100,117,46,98,114,0,101,100,117,46,98,115,0,101,
+    100,117,46,98,116,0,101,100,117,46,98,122,0,101,100,117,
+    46,99,105,0,101,100,117,46,99,110,0,101,100,117,46,99,
+    111,0,101,100,117,46,99,117,0,101,100,117,46,99,118,0,
+    101,100,117,46,99,119,0,101,100,117,46,100,109,0,101,100,
+    117,46,100,111,0,101,100,117,46,100,122,0,101,100,117,46,
+    101,99,0,101,100,117,46,101,101,0,101,100,117,46,101,103,
+    0,101,100,117,46,101,115,0,101,100,117,46,101,116,0,101,
+    100,117,46,101,117,46,111,114,103,0,101,100,117,46,102,109,
+    0,101,100,117,46,103,100,0,101,100,117,46,103,101,0,101,
+    100,117,46,103,104,0,101,100,117,46,103,105,0,101,100,117,
+    46,103,108,0,101,100,117,46,103,110,0,101,100,117,46,103,
+    112,0,101,100,117,46,103,114,0,101,100,117,46,103,116,0,
+    101,100,117,46,103,117,0,101,100,117,46,103,121,0,101,100,
+    117,46,104,107,0,101,100,117,46,104,110,0,101,100,117,46,
+    104,116,0,101,100,117,46,105,110,0,101,100,117,46,105,113,
+    0,101,100,117,46,105,115,0,101,100,117,46,105,116,0,101,
+    100,117,46,106,111,0,101,100,117,46,107,103,0,101,100,117,
+    46,107,105,0,101,100,117,46,107,109,0,101,100,117,46,107,
+    110,0,101,100,117,46,107,112,0,101,100,117,46,107,114,100,
+    0,101,100,117,46,107,119,0,101,100,117,46,107,121,0,101,
+    100,117,46,107,122,0,101,100,117,46,108,97,0,101,100,117,
+    46,108,98,0,101,100,117,46,108,99,0,101,100,117,46,108,
+    107,0,101,100,117,46,108,114,0,101,100,117,46,108,115,0,
+    101,100,117,46,108,118,0,101,100,117,46,108,121,0,101,100,
+    117,46,109,101,0,101,100,117,46,109,103,0,101,100,117,46,
+    109,107,0,101,100,117,46,109,108,0,101,100,117,46,109,110,
+    0,101,100,117,46,109,111,0,101,100,117,46,109,115,0,101,
+    100,117,46,109,116,0,101,100,117,46,109,118,0,101,100,117,
+    46,109,119,0,101,100,117,46,109,120,0,101,100,117,46,109,
+    121,0,101,100,117,46,109,122,0,101,100,117,46,110,103,0,
+    101,100,117,46,110,105,0,101,100,117,46,110,114,0,101,100,
+    117,46,111,109,0,101,100,117,46,112,97,0,101,100,117,46,
+    112,101,0,101,100,117,46,112,102,0,101,100,117,46,112,104,
+    0,101,100,117,46,112,107,0,101,100,117,46,112,108,0,101,
+    100,117,46,112,110,0,101,100,117,46,112,114,0,101,100,117,
+    46,112,115,0,101,100,117,46,112,116,0,101,100,117,46,112,
+    121,0,101,100,117,46,113,97,0,101,100,117,46,114,115,0,
+    101,100,117,46,114,117,0,101,100,117,46,115,97,0,101,100,
+    117,46,115,98,0,101,100,117,46,115,99,0,101,100,117,46,
+    115,99,111,116,0,101,100,117,46,115,100,0,101,100,117,46,
+    115,103,0,101,100,117,46,115,108,0,101,100,117,46,115,110,
+    0,101,100,117,46,115,111,0,101,100,117,46,115,115,0,101,
+    100,117,46,115,116,0,101,100,117,46,115,118,0,101,100,117,
+    46,115,121,0,101,100,117,46,116,106,0,101,100,117,46,116,
+    109,0,101,100,117,46,116,111,0,101,100,117,46,116,114,0,
+    101,100,117,46,116,116,0,101,100,117,46,116,119,0,101,100,
+    117,46,117,97,0,101,100,117,46,117,121,0,101,100,117,46,
+    118,99,0,101,100,117,46,118,101,0,101,100,117,46,118,110,
+    0,101,100,117,46,118,117,0,101,100,117,46,119,115,0,101,
+    100,117,46,121,101,0,101,100,117,46,122,97,0,101,100,117,
+    46,122,109,0,101,100,117,99,97,116,105,111,110,46,109,117,
+    115,101,117,109,0,101,100,117,99,97,116,105,111,110,97,108,
+    46,109,117,115,101,117,109,0,101,100,117,99,97,116,111,114,
+    46,97,101,114,111,0,101,100,117,103,105,116,46,105,111,0,
+    101,101,46,101,117,46,111,114,103,0,101,101,114,111,45,115,
+    116,97,103,101,46,111,110,108,105,110,101,0,101,101,114,111,
+    46,111,110,108,105,110,101,0,101,103,101,114,115,117,110,100,
+    46,110,111,0,101,103,111,105,115,109,46,106,112,0,101,103,
+    121,112,116,105,97,110,46,109,117,115,101,117,109,0,101,105,
+    100,46,110,111,0,101,105,100,102,106,111,114,100,46,110,111,
+    0,101,105,100,115,98,101,114,103,46,110,111,0,101,105,100,
+    115,107,111,103,46,110,111,0,101,105,100,115,118,111,108,108,
+    46,110,111,0,101,105,103,101,114,115,117,110,100,46,110,111,
+    0,101,105,104,101,105,106,105,46,102,117,107,117,105,46,106,
+    112,0,101,105,115,101,110,98,97,104,110,46,109,117,115,101,
+    117,109,0,101,107,108,111,103,101,115,46,99,121,0,101,108,
+    98,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    101,108,98,46,97,109,97,122,111,110,97,119,115,46,99,111,
+    109,46,99,110,0,101,108,98,108,97,103,46,112,108,0,101,
+    108,98,117,114,103,46,109,117,115,101,117,109,0,101,108,101,
+    109,101,110,116,111,114,46,99,108,111,117,100,0,101,108,101,
+    109,101,110,116,111,114,46,99,111,111,108,0,101,108,107,46,
+    112,108,0,101,108,118,101,110,100,114,101,108,108,46,109,117,
+    115,101,117,109,0,101,108,118,101,114,117,109,46,110,111,0,
+    101,109,97,105,108,0,101,109,98,46,107,119,0,101,109,98,
+    97,105,120,97,100,97,46,115,116,0,101,109,98,101,116,115,
+    117,46,104,111,107,107,97,105,100,111,46,106,112,0,101,109,
+    98,114,111,105,100,101,114,121,46,109,117,115,101,117,109,0,
+    101,109,101,114,99,107,0,101,109,101,114,103,101,110,99,121,
+    46,97,101,114,111,0,101,109,105,108,105,97,45,114,111,109,
+    97,103,110,97,46,105,116,0,101,109,105,108,105,97,114,111,
+    109,97,103,110,97,46,105,116,0,101,109,112,46,98,114,0,
+    101,109,112,114,101,115,97,46,98,111,0,101,109,114,46,105,
+    116,0,101,110,45,114,111,111,116,46,102,114,0,101,110,46,
+    105,116,0,101,110,97,46,103,105,102,117,46,106,112,0,101,
+    110,99,111,114,101,97,112,105,46,99,111,109,0,101,110,99,
+    114,46,97,112,112,0,101,110,99,121,99,108,111,112,101,100,
+    105,99,46,109,117,115,101,117,109,0,101,110,100,111,102,105,
+    110,116,101,114,110,101,116,46,110,101,116,0,101,110,100,111,
+    102,105,110,116,101,114,110,101,116,46,111,114,103,0,101,110,
+    100,111,102,116,104,101,105,110,116,101,114,110,101,116,46,111,
+    114,103,0,101,110,101,98,97,107,107,46,110,111,0,101,110,
+    101,114,103,121,0,101,110,102,46,98,114,0,101,110,103,46,
+    98,114,0,101,110,103,46,112,114,111,0,101,110,103,101,114,
+    100,97,108,46,110,111,0,101,110,103,105,110,101,46,97,101,
+    114,111,0,101,110,103,105,110,101,101,114,0,101,110,103,105,
+    110,101,101,114,46,97,101,114,111,0,101,110,103,105,110,101,
+    101,114,105,110,103,0,101,110,103,108,97,110,100,46,109,117,
+    115,101,117,109,0,101,110,105,119,97,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,101,110,110,97,46,105,116,0,101,
+    110,115,46,116,110,0,101,110,115,99,97,108,101,100,46,115,
+    103,0,101,110,116,46,112,108,97,116,102,111,114,109,46,115,
+    104,0,101,110,116,101,114,112,114,105,115,101,99,108,111,117,
+    100,46,110,117,0,101,110,116,101,114,112,114,105,115,101,115,
+    0,101,110,116,101,114,116,97,105,110,109,101,110,116,46,97,
+    101,114,111,0,101,110,116,111,109,111,108,111,103,121,46,109,
+    117,115,101,117,109,0,101,110,118,105,114,111,110,109,101,110,
+    116,46,109,117,115,101,117,109,0,101,110,118,105,114,111,110,
+    109,101,110,116,97,108,99,111,110,115,101,114,118,97,116,105,
+    111,110,46,109,117,115,101,117,109,0,101,112,105,108,101,112,
+    115,121,46,109,117,115,101,117,109,0,101,112,115,111,110,0,
+    101,113,117,105,112,109,101,110,116,0,101,113,117,105,112,109,
+    101,110,116,46,97,101,114,111,0,101,114,0,101,114,46,105,
+    110,0,101,114,105,99,115,115,111,110,0,101,114,105,109,111,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,101,114,110,
+    105,0,101,114,111,116,105,99,97,46,104,117,0,101,114,111,
+    116,105,107,97,46,104,117,0,101,115,45,49,46,97,120,97,
+    114,110,101,116,46,99,108,111,117,100,0,101,115,46,97,120,
+    0,101,115,46,101,117,46,111,114,103,0,101,115,46,103,111,
+    118,46,98,114,0,101,115,46,107,114,0,101,115,46,108,101,
+    103,46,98,114,0,101,115,97,110,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,101,115,97,115,104,105,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,101,115,112,46,98,114,0,
+    101,115,113,0,101,115,115,101,120,46,109,117,115,101,117,109,
+    0,101,115,116,45,97,45,108,97,45,109,97,105,115,111,110,
+    46,99,111,109,0,101,115,116,45,97,45,108,97,45,109,97,
+    115,105,111,110,46,99,111,109,0,101,115,116,45,108,101,45,
+    112,97,116,114,111,110,46,99,111,109,0,101,115,116,45,109,
+    111,110,45,98,108,111,103,117,101,117,114,46,99,111,109,0,
+    101,115,116,46,112,114,0,101,115,116,97,116,101,46,109,117,
+    115,101,117,109,0,101,116,97,106,105,109,97,46,104,105,114,
+    111,115,104,105,109,97,46,106,112,0,101,116,99,46,98,114,
+    0,101,116,104,110,111,108,111,103,121,46,109,117,115,101,117,
+    109,0,101,116,105,46,98,114,0,101,116,105,115,97,108,97,
+    116,0,101,116,110,101,46,110,111,0,101,116,110,101,100,97,
+    108,46,110,111,0,101,117,45,49,46,101,118,101,110,110,111,
+    100,101,46,99,111,109,0,101,117,45,50,46,101,118,101,110,
+    110,111,100,101,46,99,111,109,0,101,117,45,51,46,101,118,
+    101,110,110,111,100,101,46,99,111,109,0,101,117,45,52,46,
+    101,118,101,110,110,111,100,101,46,99,111,109,0,101,117,45,
+    99,101,110,116,114,97,108,45,49,46,101,108,97,115,116,105,
+    99,98,101,97,110,115,116,97,108,107,46,99,111,109,0,101,
+    117,45,119,101,115,116,45,49,46,101,108,97,115,116,105,99,
+    98,101,97,110,115,116,97,108,107,46,99,111,109,0,101,117,
+    45,119,101,115,116,45,50,46,101,108,97,115,116,105,99,98,
+    101,97,110,115,116,97,108,107,46,99,111,109,0,101,117,45,
+    119,101,115,116,45,51,46,101,108,97,115,116,105,99,98,101,
+    97,110,115,116,97,108,107,46,99,111,109,0,101,117,46,97,
+    120,0,101,117,46,99,111,109,0,101,117,46,101,110,99,111,
+    119,97,121,46,99,108,111,117,100,0,101,117,46,105,110,116,
+    0,101,117,46,109,101,116,101,111,114,97,112,112,46,99,111,
+    109,0,101,117,46,112,108,97,116,102,111,114,109,46,115,104,
+    0,101,117,46,112,121,116,104,111,110,97,110,121,119,104,101,
+    114,101,46,99,111,109,0,101,117,110,46,101,103,0,101,117,
+    114,111,100,105,114,46,114,117,0,101,117,114,111,118,105,115,
+    105,111,110,0,101,118,101,110,97,115,115,105,46,110,111,0,
+    101,118,101,110,101,115,46,110,111,0,101,118,101,110,195,161,
+    197,161,197,161,105,46,110,111,0,101,118,106,101,45,111,103,
+    45,104,111,114,110,110,101,115,46,110,111,0,101,120,46,102,
+    117,116,117,114,101,99,109,115,46,97,116,0,101,120,46,111,
+    114,116,115,105,110,102,111,46,97,116,0,101,120,99,104,97,
+    110,103,101,0,101,120,99,104,97,110,103,101,46,97,101,114,
+    111,0,101,120,101,116,101,114,46,109,117,115,101,117,109,0,
+    101,120,104,105,98,105,116,105,111,110,46,109,117,115,101,117,
+    109,0,101,120,110,101,116,46,115,117,0,101,120,112,101,114,
+    116,0,101,120,112,101,114,116,115,45,99,111,109,112,116,97,
+    98,108,101,115,46,102,114,0,101,120,112,111,115,101,100,0,
+    101,120,112,114,101,115,115,0,101,120,112,114,101,115,115,46,
+    97,101,114,111,0,101,120,116,114,97,115,112,97,99,101,0,
+    101,122,112,114,111,120,121,46,107,117,108,101,117,118,101,110,
+    46,98,101,0,102,46,98,103,0,102,46,115,101,0,102,97,
+    103,101,0,102,97,105,108,0,102,97,105,114,119,105,110,100,
+    115,0,102,97,107,101,102,117,114,46,106,112,0,102,97,109,
+    46,112,107,0,102,97,109,105,108,121,0,102,97,109,105,108,
+    121,46,109,117,115,101,117,109,0,102,97,109,105,108,121,100,
+    115,46,99,111,109,0,102,97,109,105,108,121,100,115,46,110,
+    101,116,0,102,97,109,105,108,121,100,115,46,111,114,103,0,
+    102,97,110,0,102,97,110,115,0,102,97,110,116,97,115,121,
+    108,101,97,103,117,101,46,99,99,0,102,97,114,46,98,114,
+    0,102,97,114,109,46,109,117,115,101,117,109,0,102,97,114,
+    109,101,113,117,105,112,109,101,110,116,46,109,117,115,101,117,
+    109,0,102,97,114,109,101,114,115,0,102,97,114,109,101,114,
+    115,46,109,117,115,101,117,109,0,102,97,114,109,115,116,101,
+    97,100,46,109,117,115,101,117,109,0,102,97,114,115,117,110,
+    100,46,110,111,0,102,97,115,104,105,111,110,0,102,97,115,
+    104,105,111,110,115,116,111,114,101,46,106,112,0,102,97,115,
+    116,0,102,97,115,116,108,121,45,101,100,103,101,46,99,111,
+    109,0,102,97,115,116,108,121,45,116,101,114,114,97,114,105,
+    117,109,46,99,111,109,0,102,97,115,116,115,116,97,99,107,
+    115,46,110,101,116,0,102,97,115,116,118,112,115,45,115,101,
+    114,118,101,114,46,99,111,109,0,102,97,115,116,118,112,115,
+    46,104,111,115,116,0,102,97,115,116,118,112,115,46,115,105,
+    116,101,0,102,97,117,115,107,101,46,110,111,0,102,98,120,
+    45,111,115,46,102,114,0,102,98,120,111,115,46,102,114,0,
+    102,99,46,105,116,0,102,101,46,105,116,0,102,101,100,46,
+    117,115,0,102,101,100,101,114,97,116,105,111,110,46,97,101,
+    114,111,0,102,101,100,101,120,0,102,101,100,106,101,46,110,
+    111,0,102,101,100,111,114,97,105,110,102,114,97,99,108,111,
+    117,100,46,111,114,103,0,102,101,100,111,114,97,112,101,111,
+    112,108,101,46,111,114,103,0,102,101,101,100,98,97,99,107,
+    0,102,101,105,114,97,46,98,114,0,102,101,109,46,106,112,
+    0,102,101,110,116,105,103,101,114,46,109,121,116,104,105,99,
+    45,98,101,97,115,116,115,46,99,111,109,0,102,101,114,109,
+    111,46,105,116,0,102,101,114,114,97,114,97,46,105,116,0,
+    102,101,114,114,97,114,105,0,102,101,114,114,101,114,111,0,
+    102,101,115,116,101,45,105,112,46,110,101,116,0,102,101,116,
+    46,110,111,0,102,101,116,115,117,110,100,46,110,111,0,102,
+    103,46,105,116,0,102,104,45,109,117,101,110,115,116,101,114,
+    46,105,111,0,102,104,46,115,101,0,102,104,115,46,110,111,
+    0,102,104,115,107,46,115,101,0,102,104,118,46,115,101,0,
+    102,105,46,99,108,111,117,100,112,108,97,116,102,111,114,109,
+    46,102,105,0,102,105,46,99,114,0,102,105,46,101,117,46,
+    111,114,103,0,102,105,46,105,116,0,102,105,97,116,0,102,
+    105,100,101,108,105,116,121,0,102,105,100,111,0,102,105,101,
+    46,101,101,0,102,105,101,108,100,46,109,117,115,101,117,109,
+    0,102,105,103,117,101,114,101,115,46,109,117,115,101,117,109,
+    0,102,105,108,97,116,101,108,105,97,46,109,117,115,101,117,
+    109,0,102,105,108,101,103,101,97,114,45,97,117,46,109,101,
+    0,102,105,108,101,103,101,97,114,45,100,101,46,109,101,0,
+    102,105,108,101,103,101,97,114,45,103,98,46,109,101,0,102,
+    105,108,101,103,101,97,114,45,105,101,46,109,101,0,102,105,
+    108,101,103,101,97,114,45,106,112,46,109,101,0,102,105,108,
+    101,103,101,97,114,45,115,103,46,109,101,0,102,105,108,101,
+    103,101,97,114,46,109,101,0,102,105,108,109,0,102,105,108,
+    109,46,104,117,0,102,105,108,109,46,109,117,115,101,117,109,
+    0,102,105,110,46,99,105,0,102,105,110,46,101,99,0,102,
+    105,110,46,116,110,0,102,105,110,97,108,0,102,105,110,97,
+    110,99,101,0,102,105,110,101,97,114,116,46,109,117,115,101,
+    117,109,0,102,105,110,101,97,114,116,115,46,109,117,115,101,
+    117,109,0,102,105,110,108,97,110,100,46,109,117,115,101,117,
+    109,0,102,105,110,110,111,121,46,110,111,0,102,105,110,110,
+    195,184,121,46,110,111,0,102,105,114,101,0,102,105,114,101,
+    98,97,115,101,97,112,112,46,99,111,109,0,102,105,114,101,
+    110,122,101,46,105,116,0,102,105,114,101,115,116,111,110,101,
+    0,102,105,114,101,119,97,108,108,45,103,97,116,101,119,97,
+    121,46,99,111,109,0,102,105,114,101,119,97,108,108,45,103,
+    97,116,101,119,97,121,46,100,101,0,102,105,114,101,119,97,
+    108,108,45,103,97,116,101,119,97,121,46,110,101,116,0,102,
+    105,114,101,119,101,98,46,97,112,112,0,102,105,114,109,46,
+    99,111,0,102,105,114,109,46,100,107,0,102,105,114,109,46,
+    104,116,0,102,105,114,109,46,105,110,0,102,105,114,109,46,
+    110,102,0,102,105,114,109,46,110,103,0,102,105,114,109,46,
+    114,111,0,102,105,114,109,46,118,101,0,102,105,114,109,100,
+    97,108,101,0,102,105,115,104,0,102,105,115,104,105,110,103,
+    0,102,105,116,0,102,105,116,106,97,114,46,110,111,0,102,
+    105,116,110,101,115,115,0,102,106,46,99,110,0,102,106,97,
+    108,101,114,46,110,111,0,102,106,101,108,108,46,110,111,0,
+    102,107,0,102,108,97,46,110,111,0,102,108,97,107,115,116,
+    97,100,46,110,111,0,102,108,97,110,100,101,114,115,46,109,
+    117,115,101,117,109,0,102,108,97,112,46,105,100,0,102,108,
+    97,116,97,110,103,101,114,46,110,111,0,102,108,100,114,118,
+    46,99,111,109,0,102,108,101,107,107,101,102,106,111,114,100,
+    46,110,111,0,102,108,101,115,98,101,114,103,46,110,111,0,
+    102,108,105,99,107,114,0,102,108,105,101,114,46,106,112,0,
+    102,108,105,103,104,116,46,97,101,114,111,0,102,108,105,103,
+    104,116,115,0,102,108,105,114,0,102,108,111,103,46,98,114,
+    0,102,108,111,112,112,121,46,106,112,0,102,108,111,114,97,
+    46,110,111,0,102,108,111,114,101,110,99,101,46,105,116,0,
+    102,108,111,114,105,100,97,46,109,117,115,101,117,109,0,102,
+    108,111,114,105,112,97,46,98,114,0,102,108,111,114,105,115,
+    116,0,102,108,111,114,111,46,110,111,0,102,108,111,114,195,
+    184,46,110,111,0,102,108,111,119,101,114,115,0,102,108,116,
+    46,99,108,111,117,100,46,109,117,110,105,46,99,122,0,102,
+    108,121,0,102,108,121,46,100,101,118,0,102,108,121,110,110,
+    104,111,115,116,105,110,103,46,110,101,116,0,102,108,195,165,
+    46,110,111,0,102,109,46,98,114,0,102,109,46,105,116,0,
+    102,110,100,46,98,114,0,102,110,119,107,46,115,105,116,101,
+    0,102,111,0,102,111,103,103,105,97,46,105,116,0,102,111,
+    108,105,111,110,101,116,119,111,114,107,46,115,105,116,101,0,
+    102,111,108,107,101,98,105,98,108,46,110,111,0,102,111,108,
+    108,100,97,108,46,110,111,0,102,111,111,0,102,111,111,100,
+    0,102,111,111,100,110,101,116,119,111,114,107,0,102,111,111,
+    108,46,106,112,0,102,111,111,116,98,97,108,108,0,102,111,
+    114,45,98,101,116,116,101,114,46,98,105,122,0,102,111,114,
+    45,109,111,114,101,46,98,105,122,0,102,111,114,45,111,117,
+    114,46,105,110,102,111,0,102,111,114,45,115,111,109,101,46,
+    98,105,122,0,102,111,114,45,116,104,101,46,98,105,122,0,
+    102,111,114,99,101,46,109,117,115,101,117,109,0,102,111,114,
+    100,0,102,111,114,100,101,46,110,111,0,102,111,114,101,120,
+    0,102,111,114,103,101,98,108,111,99,107,115,46,99,111,109,
+    0,102,111,114,103,111,116,46,104,101,114,46,110,97,109,101,
+    0,102,111,114,103,111,116,46,104,105,115,46,110,97,109,101,
+    0,102,111,114,108,105,45,99,101,115,101,110,97,46,105,116,
+    0,102,111,114,108,105,99,101,115,101,110,97,46,105,116,0,
+    102,111,114,108,195,172,45,99,101,115,101,110,97,46,105,116,
+    0,102,111,114,108,195,172,99,101,115,101,110,97,46,105,116,
+    0,102,111,114,115,97,108,101,0,102,111,114,115,97,110,100,
+    46,110,111,0,102,111,114,116,97,108,46,98,114,0,102,111,
+    114,116,101,46,105,100,0,102,111,114,116,109,105,115,115,111,
+    117,108,97,46,109,117,115,101,117,109,0,102,111,114,116,119,
+    111,114,116,104,46,109,117,115,101,117,109,0,102,111,114,117,
+    109,0,102,111,114,117,109,46,104,117,0,102,111,114,117,109,
+    122,46,105,110,102,111,0,102,111,115,110,101,115,46,110,111,
+    0,102,111,116,46,98,114,0,102,111,117,110,100,97,116,105,
+    111,110,0,102,111,117,110,100,97,116,105,111,110,46,109,117,
+    115,101,117,109,0,102,111,120,0,102,111,122,46,98,114,0,
+    102,114,45,49,46,112,97,97,115,46,109,97,115,115,105,118,
+    101,103,114,105,100,46,110,101,116,0,102,114,45,112,97,114,
+    45,49,46,98,97,114,101,109,101,116,97,108,46,115,99,119,
+    46,99,108,111,117,100,0,102,114,45,112,97,114,45,50,46,
+    98,97,114,101,109,101,116,97,108,46,115,99,119,46,99,108,
+    111,117,100,0,102,114,46,101,117,46,111,114,103,0,102,114,
+    46,105,116,0,102,114,97,49,45,100,101,46,99,108,111,117,
+    100,106,105,102,102,121,46,110,101,116,0,102,114,97,109,101,
+    114,46,97,112,112,0,102,114,97,109,101,114,46,109,101,100,
+    105,97,0,102,114,97,109,101,114,46,112,104,111,116,111,115,
+    0,102,114,97,109,101,114,46,119,101,98,115,105,116,101,0,
+    102,114,97,109,101,114,46,119,105,107,105,0,102,114,97,109,
+    101,114,99,97,110,118,97,115,46,99,111,109,0,102,114,97,
+    110,97,46,110,111,0,102,114,97,110,99,97,105,115,101,46,
+    109,117,115,101,117,109,0,102,114,97,110,107,102,117,114,116,
+    46,109,117,115,101,117,109,0,102,114,97,110,122,105,115,107,
+    97,110,101,114,46,109,117,115,101,117,109,0,102,114,101,100,
+    114,105,107,115,116,97,100,46,110,111,0,102,114,101,101,0,
+    102,114,101,101,46,104,114,0,102,114,101,101,98,111,120,45,
+    111,115,46,99,111,109,0,102,114,101,101,98,111,120,45,111,
+    115,46,102,114,0,102,114,101,101,98,111,120,111,115,46,99,
+    111,109,0,102,114,101,101,98,111,120,111,115,46,102,114,0,
+    102,114,101,101,100,100,110,115,46,111,114,103,0,102,114,101,
+    101,100,100,110,115,46,117,115,0,102,114,101,101,100,101,115,
+    107,116,111,112,46,111,114,103,0,102,114,101,101,109,97,115,
+    111,110,114,121,46,109,117,115,101,117,109,0,102,114,101,101,
+    109,121,105,112,46,99,111,109,0,102,114,101,101,115,105,116,
+    101,46,104,111,115,116,0,102,114,101,101,116,108,115,46,102,
+    97,115,116,108,121,46,110,101,116,0,102,114,101,105,46,110,
+    111,0,102,114,101,105,98,117,114,103,46,109,117,115,101,117,
+    109,0,102,114,101,110,99,104,107,105,115,115,46,106,112,0,
+    102,114,101,115,101,110,105,117,115,0,102,114,105,98,111,117,
+    114,103,46,109,117,115,101,117,109,0,102,114,105,117,108,105,
+    45,118,45,103,105,117,108,105,97,46,105,116,0,102,114,105,
+    117,108,105,45,118,101,45,103,105,117,108,105,97,46,105,116,
+    0,102,114,105,117,108,105,45,118,101,103,105,117,108,105,97,
+    46,105,116,0,102,114,105,117,108,105,45,118,101,110,101,122,
+    105,97,45,103,105,117,108,105,97,46,105,116,0,102,114,105,
+    117,108,105,45,118,101,110,101,122,105,97,103,105,117,108,105,
+    97,46,105,116,0,102,114,105,117,108,105,45,118,103,105,117,
+    108,105,97,46,105,116,0,102,114,105,117,108,105,118,45,103,
+    105,117,108,105,97,46,105,116,0,102,114,105,117,108,105,118,
+    101,45,103,105,117,108,105,97,46,105,116,0,102,114,105,117,
+    108,105,118,101,103,105,117,108,105,97,46,105,116,0,102,114,
+    105,117,108,105,118,101,110,101,122,105,97,45,103,105,117,108,
+    105,97,46,105,116,0,102,114,105,117,108,105,118,101,110,101,
+    122,105,97,103,105,117,108,105,97,46,105,116,0,102,114,105,
+    117,108,105,118,103,105,117,108,105,97,46,105,116,0,102,114,
+    108,0,102,114,111,103,46,109,117,115,101,117,109,0,102,114,
+    111,103,97,110,115,0,102,114,111,103,110,46,110,111,0,102,
+    114,111,108,97,110,100,46,110,111,0,102,114,111,109,45,97,
+    107,46,99,111,109,0,102,114,111,109,45,97,108,46,99,111,
+    109,0,102,114,111,109,45,97,114,46,99,111,109,0,102,114,
+    111,109,45,97,122,46,110,101,116,0,102,114,111,109,45,99,
+    97,46,99,111,109,0,102,114,111,109,45,99,111,46,110,101,
+    116,0,102,114,111,109,45,99,116,46,99,111,109,0,102,114,
+    111,109,45,100,99,46,99,111,109,0,102,114,111,109,45,100,
+    101,46,99,111,109,0,102,114,111,109,45,102,108,46,99,111,
+    109,0,102,114,111,109,45,103,97,46,99,111,109,0,102,114,
+    111,109,45,104,105,46,99,111,109,0,102,114,111,109,45,105,
+    97,46,99,111,109,0,102,114,111,109,45,105,100,46,99,111,
+    109,0,102,114,111,109,45,105,108,46,99,111,109,0,102,114,
+    111,109,45,105,110,46,99,111,109,0,102,114,111,109,45,107,
+    115,46,99,111,109,0,102,114,111,109,45,107,121,46,99,111,
+    109,0,102,114,111,109,45,108,97,46,110,101,116,0,102,114,
+    111,109,45,109,97,46,99,111,109,0,102,114,111,109,45,109,
+    100,46,99,111,109,0,102,114,111,109,45,109,101,46,111,114,
+    103,0,102,114,111,109,45,109,105,46,99,111,109,0,102,114,
+    111,109,45,109,110,46,99,111,109,0,102,114,111,109,45,109,
+    111,46,99,111,109,0,102,114,111,109,45,109,115,46,99,111,
+    109,0,102,114,111,109,45,109,116,46,99,111,109,0,102,114,
+    111,109,45,110,99,46,99,111,109,0,102,114,111,109,45,110,
+    100,46,99,111,109,0,102,114,111,109,45,110,101,46,99,111,
+    109,0,102,114,111,109,45,110,104,46,99,111,109,0,102,114,
+    111,109,45,110,106,46,99,111,109,0,102,114,111,109,45,110,
+    109,46,99,111,109,0,102,114,111,109,45,110,118,46,99,111,
+    109,0,102,114,111,109,45,110,121,46,110,101,116,0,102,114,
+    111,109,45,111,104,46,99,111,109,0,102,114,111,109,45,111,
+    107,46,99,111,109,0,102,114,111,109,45,111,114,46,99,111,
+    109,0,102,114,111,109,45,112,97,46,99,111,109,0,102,114,
+    111,109,45,112,114,46,99,111,109,0,102,114,111,109,45,114,
+    105,46,99,111,109,0,102,114,111,109,45,115,99,46,99,111,
+    109,0,102,114,111,109,45,115,100,46,99,111,109,0,102,114,
+    111,109,45,116,110,46,99,111,109,0,102,114,111,109,45,116,
+    120,46,99,111,109,0,102,114,111,109,45,117,116,46,99,111,
+    109,0,102,114,111,109,45,118,97,46,99,111,109,0,102,114,
+    111,109,45,118,116,46,99,111,109,0,102,114,111,109,45,119,
+    97,46,99,111,109,0,102,114,111,109,45,119,105,46,99,111,
+    109,0,102,114,111,109,45,119,118,46,99,111,109,0,102,114,
+    111,109,45,119,121,46,99,111,109,0,102,114,111,109,46,104,
+    114,0,102,114,111,110,116,100,111,111,114,0,102,114,111,110,
+    116,105,101,114,0,102,114,111,115,105,110,111,110,101,46,105,
+    116,0,102,114,111,115,116,97,46,110,111,0,102,114,111,121,
+    97,46,110,111,0,102,114,117,115,107,121,46,100,101,0,102,
+    114,195,166,110,97,46,110,111,0,102,114,195,184,121,97,46,
+    110,111,0,102,115,116,46,98,114,0,102,116,112,97,99,99,
+    101,115,115,46,99,99,0,102,116,114,0,102,117,99,104,117,
+    46,104,105,114,111,115,104,105,109,97,46,106,112,0,102,117,
+    99,104,117,46,116,111,107,121,111,46,106,112,0,102,117,99,
+    104,117,46,116,111,121,97,109,97,46,106,112,0,102,117,100,
+    97,105,46,105,119,97,116,101,46,106,112,0,102,117,101,102,
+    117,107,105,46,121,97,109,97,110,97,115,104,105,46,106,112,
+    0,102,117,101,108,46,97,101,114,111,0,102,117,101,116,116,
+    101,114,116,100,97,115,110,101,116,122,46,100,101,0,102,117,
+    106,105,46,115,104,105,122,117,111,107,97,46,106,112,0,102,
+    117,106,105,101,100,97,46,115,104,105,122,117,111,107,97,46,
+    106,112,0,102,117,106,105,105,100,101,114,97,46,111,115,97,
+    107,97,46,106,112,0,102,117,106,105,107,97,119,97,46,115,
+    104,105,122,117,111,107,97,46,106,112,0,102,117,106,105,107,
+    97,119,97,46,121,97,109,97,110,97,115,104,105,46,106,112,
+    0,102,117,106,105,107,97,119,97,103,117,99,104,105,107,111,
+    46,121,97,109,97,110,97,115,104,105,46,106,112,0,102,117,
+    106,105,109,105,46,110,97,103,97,110,111,46,106,112,0,102,
+    117,106,105,109,105,46,115,97,105,116,97,109,97,46,106,112,
+    0,102,117,106,105,109,105,110,111,46,115,97,105,116,97,109,
+    97,46,106,112,0,102,117,106,105,110,111,109,105,121,97,46,
+    115,104,105,122,117,111,107,97,46,106,112,0,102,117,106,105,
+    111,107,97,46,103,117,110,109,97,46,106,112,0,102,117,106,
+    105,115,97,116,111,46,97,107,105,116,97,46,106,112,0,102,
+    117,106,105,115,97,119,97,46,105,119,97,116,101,46,106,112,
+    0,102,117,106,105,115,97,119,97,46,107,97,110,97,103,97,
+    119,97,46,106,112,0,102,117,106,105,115,104,105,114,111,46,
+    105,98,97,114,97,107,105,46,106,112,0,102,117,106,105,116,
+    115,117,0,102,117,106,105,121,111,115,104,105,100,97,46,121,
+    97,109,97,110,97,115,104,105,46,106,112,0,102,117,107,97,
+    103,97,119,97,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,102,117,107,97,121,97,46,115,97,105,116,97,109,97,46,
+    106,112,0,102,117,107,117,99,104,105,46,102,117,107,117,111,
+    107,97,46,106,112,0,102,117,107,117,99,104,105,121,97,109,
+    97,46,107,121,111,116,111,46,106,112,0,102,117,107,117,100,
+    111,109,105,46,115,97,103,97,46,106,112,0,102,117,107,117,
+    105,46,102,117,107,117,105,46,106,112,0,102,117,107,117,109,
+    105,116,115,117,46,116,111,121,97,109,97,46,106,112,0,102,
+    117,107,117,114,111,105,46,115,104,105,122,117,111,107,97,46,
+    106,112,0,102,117,107,117,115,97,107,105,46,104,121,111,103,
+    111,46,106,112,0,102,117,107,117,115,104,105,109,97,46,102,
+    117,107,117,115,104,105,109,97,46,106,112,0,102,117,107,117,
+    115,104,105,109,97,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,102,117,107,117,121,97,109,97,46,104,105,114,111,115,
+    104,105,109,97,46,106,112,0,102,117,110,0,102,117,110,97,
+    98,97,115,104,105,46,99,104,105,98,97,46,106,112,0,102,
+    117,110,97,103,97,116,97,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,102,117,110,97,104,97,115,104,105,46,116,111,
+    121,97,109,97,46,106,112,0,102,117,110,99,116,105,111,110,
+    115,46,102,110,99,46,102,114,45,112,97,114,46,115,99,119,
+    46,99,108,111,117,100,0,102,117,110,100,0,102,117,110,100,
+    97,99,105,111,46,109,117,115,101,117,109,0,102,117,111,105,
+    115,107,117,46,110,111,0,102,117,111,115,115,107,111,46,110,
+    111,0,102,117,114,97,110,111,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,102,117,114,110,105,116,117,114,101,0,102,
+    117,114,110,105,116,117,114,101,46,109,117,115,101,117,109,0,
+    102,117,114,117,98,105,114,97,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,102,117,114,117,100,111,110,111,46,102,117,
+    107,117,115,104,105,109,97,46,106,112,0,102,117,114,117,107,
+    97,119,97,46,109,105,121,97,103,105,46,106,112,0,102,117,
+    115,97,46,110,111,0,102,117,115,111,46,97,105,99,104,105,
+    46,106,112,0,102,117,115,115,97,46,116,111,107,121,111,46,
+    106,112,0,102,117,116,97,98,97,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,102,117,116,98,111,108,0,102,117,
+    116,115,117,46,110,97,103,97,115,97,107,105,46,106,112,0,
+    102,117,116,116,115,117,46,99,104,105,98,97,46,106,112,0,
+    102,117,116,117,114,101,104,111,115,116,105,110,103,46,97,116,
+    0,102,117,116,117,114,101,109,97,105,108,105,110,103,46,97,
+    116,0,102,118,103,46,105,116,0,102,121,105,0,102,121,108,
+    107,101,115,98,105,98,108,46,110,111,0,102,121,114,101,115,
+    100,97,108,46,110,111,0,102,195,184,114,100,101,46,110,111,
+    0,103,46,98,103,0,103,46,115,101,0,103,46,118,98,114,
+    112,108,115,98,120,46,105,111,0,103,49,50,46,98,114,0,
+    103,97,0,103,97,105,118,117,111,116,110,97,46,110,111,0,
+    103,97,108,0,103,97,108,108,101,114,121,0,103,97,108,108,
+    101,114,121,46,109,117,115,101,117,109,0,103,97,108,108,111,
+    0,103,97,108,108,117,112,0,103,97,108,115,97,46,110,111,
+    0,103,97,109,97,103,111,114,105,46,97,105,99,104,105,46,
+    106,112,0,103,97,109,101,0,103,97,109,101,45,104,111,115,
+    116,46,111,114,103,0,103,97,109,101,45,115,101,114,118,101,
+    114,46,99,99,0,103,97,109,101,46,116,119,0,103,97,109,
+    101,115,0,103,97,109,101,115,46,104,117,0,103,97,109,111,
+    46,115,104,105,103,97,46,106,112,0,103,97,109,118,105,107,
+    46,110,111,0,103,97,110,103,97,118,105,105,107,97,46,110,
+    111,0,103,97,110,103,119,111,110,46,107,114,0,103,97,112,
+    0,103,97,114,100,101,110,0,103,97,114,100,101,110,46,109,
+    117,115,101,117,109,0,103,97,116,101,119,97,121,46,100,101,
+    118,0,103,97,116,101,119,97,121,46,109,117,115,101,117,109,
+    0,103,97,117,108,97,114,46,110,111,0,103,97,117,115,100,
+    97,108,46,110,111,0,103,97,121,0,103,98,0,103,98,46,
+    110,101,116,0,103,98,105,122,0,103,99,46,99,97,0,103,
+    100,46,99,110,0,103,100,97,46,112,108,0,103,100,97,110,
+    115,107,46,112,108,0,103,100,121,110,105,97,46,112,108,0,
+    103,101,46,105,116,0,103,101,97,0,103,101,101,107,46,110,
+    122,0,103,101,101,107,103,97,108,97,120,121,46,99,111,109,
+    0,103,101,101,108,118,105,110,99,107,46,109,117,115,101,117,
+    109,0,103,101,104,105,114,110,46,110,101,46,106,112,0,103,
+    101,105,115,101,105,46,107,111,99,104,105,46,106,112,0,103,
+    101,109,111,108,111,103,105,99,97,108,46,109,117,115,101,117,
+    109,0,103,101,110,46,105,110,0,103,101,110,46,109,105,46,
+    117,115,0,103,101,110,46,110,103,0,103,101,110,46,110,122,
+    0,103,101,110,46,116,114,0,103,101,110,107,97,105,46,115,
+    97,103,97,46,106,112,0,103,101,110,111,97,46,105,116,0,
+    103,101,110,111,118,97,46,105,116,0,103,101,110,116,0,103,
+    101,110,116,97,112,112,115,46,99,111,109,0,103,101,110,116,
+    105,110,103,0,103,101,110,116,108,101,110,116,97,112,105,115,
+    46,99,111,109,0,103,101,111,46,98,114,0,103,101,111,108,
+    111,103,121,46,109,117,115,101,117,109,0,103,101,111,109,101,
+    116,114,101,45,101,120,112,101,114,116,46,102,114,0,103,101,
+    111,114,103,101,0,103,101,111,114,103,105,97,46,109,117,115,
+    101,117,109,0,103,101,111,114,103,105,97,46,115,117,0,103,
+    101,116,109,121,105,112,46,99,111,109,0,103,101,116,115,45,
+    105,116,46,110,101,116,0,103,102,0,103,103,46,97,120,0,
+    103,103,101,101,0,103,103,102,46,98,114,0,103,104,111,115,
+    116,46,105,111,0,103,105,101,104,116,97,118,117,111,97,116,
+    110,97,46,110,111,0,103,105,101,115,115,101,110,46,109,117,
+    115,101,117,109,0,103,105,102,116,0,103,105,102,116,115,0,
+    103,105,102,117,46,103,105,102,117,46,106,112,0,103,105,105,
+    122,101,46,99,111,109,0,103,105,108,100,101,115,107,97,108,
+    46,110,111,0,103,105,108,100,101,115,107,195,165,108,46,110,
+    111,0,103,105,110,97,110,46,103,105,102,117,46,106,112,0,
+    103,105,110,111,119,97,110,46,111,107,105,110,97,119,97,46,
+    106,112,0,103,105,110,111,122,97,46,111,107,105,110,97,119,
+    97,46,106,112,0,103,105,114,108,102,114,105,101,110,100,46,
+    106,112,0,103,105,114,108,121,46,106,112,0,103,105,115,107,
+    101,46,110,111,0,103,105,116,45,112,97,103,101,115,46,114,
+    105,116,46,101,100,117,0,103,105,116,45,114,101,112,111,115,
+    46,100,101,0,103,105,116,97,112,112,46,115,105,0,103,105,
+    116,104,117,98,46,105,111,0,103,105,116,104,117,98,112,114,
+    101,118,105,101,119,46,100,101,118,0,103,105,116,104,117,98,
+    117,115,101,114,99,111,110,116,101,110,116,46,99,111,109,0,
+    103,105,116,108,97,98,46,105,111,0,103,105,116,112,97,103,
+    101,46,115,105,0,103,105,118,101,115,0,103,105,118,105,110,
+    103,0,103,106,101,109,110,101,115,46,110,111,0,103,106,101,
+    114,100,114,117,109,46,110,111,0,103,106,101,114,115,116,97,
+    100,46,110,111,0,103,106,101,115,100,97,108,46,110,111,0,
+    103,106,111,118,105,107,46,110,111,0,103,106,195,184,118,105,
+    107,46,110,111,0,103,108,97,115,46,109,117,115,101,117,109,
+    0,103,108,97,115,115,0,103,108,97,115,115,46,109,117,115,
+    101,117,109,0,103,108,101,0,103,108,101,101,122,101,46,99,
+    111,109,0,103,108,105,100,105,110,103,46,97,101,114,111,0,
+    103,108,105,116,99,104,46,109,101,0,103,108,105,119,105,99,
+    101,46,112,108,0,103,108,111,98,97,108,0,103,108,111,98,
+    97,108,46,112,114,111,100,46,102,97,115,116,108,121,46,110,
+    101,116,0,103,108,111,98,97,108,46,115,115,108,46,102,97,
+    115,116,108,121,46,110,101,116,0,103,108,111,98,111,0,103,
+    108,111,103,111,119,46,112,108,0,103,108,111,111,109,121,46,
+    106,112,0,103,108,111,112,112,101,110,46,110,111,0,103,108,
+    117,103,46,111,114,103,46,117,107,0,103,109,0,103,109,97,
+    105,108,0,103,109,98,104,0,103,109,105,110,97,46,112,108,
+    0,103,109,111,0,103,109,120,0,103,110,105,101,122,110,111,
+    46,112,108,0,103,111,46,99,105,0,103,111,46,99,114,0,
+    103,111,46,100,121,110,100,110,115,46,111,114,103,0,103,111,
+    46,103,111,118,46,98,114,0,103,111,46,105,100,0,103,111,
+    46,105,116,0,103,111,46,106,112,0,103,111,46,107,101,0,
+    103,111,46,107,114,0,103,111,46,108,101,103,46,98,114,0,
+    103,111,46,112,119,0,103,111,46,116,104,0,103,111,46,116,
+    106,0,103,111,46,116,122,0,103,111,46,117,103,0,103,111,
+    98,46,97,114,0,103,111,98,46,98,111,0,103,111,98,46,
+    99,108,0,103,111,98,46,100,111,0,103,111,98,46,101,99,
+    0,103,111,98,46,101,115,0,103,111,98,46,103,116,0,103,
+    111,98,46,104,110,0,103,111,98,46,109,120,0,103,111,98,
+    46,110,105,0,103,111,98,46,112,97,0,103,111,98,46,112,
+    101,0,103,111,98,46,112,107,0,103,111,98,46,115,118,0,
+    103,111,98,46,118,101,0,103,111,98,111,46,119,97,107,97,
+    121,97,109,97,46,106,112,0,103,111,100,97,100,100,121,0,
+    103,111,100,111,46,103,105,102,117,46,106,112,0,103,111,105,
+    97,110,105,97,46,98,114,0,103,111,105,112,46,100,101,0,
+    103,111,106,111,109,101,46,97,107,105,116,97,46,106,112,0,
+    103,111,107,46,112,107,0,103,111,107,97,115,101,46,109,105,
+    121,97,122,97,107,105,46,106,112,0,103,111,108,46,110,111,
+    0,103,111,108,100,0,103,111,108,100,112,111,105,110,116,0,
+    103,111,108,102,0,103,111,108,102,102,97,110,46,117,115,0,
+    103,111,110,46,112,107,0,103,111,110,110,97,46,106,112,0,
+    103,111,110,111,104,101,46,97,111,109,111,114,105,46,106,112,
+    0,103,111,111,0,103,111,111,100,121,101,97,114,0,103,111,
+    111,103,108,101,0,103,111,111,103,108,101,97,112,105,115,46,
+    99,111,109,0,103,111,111,103,108,101,99,111,100,101,46,99,
+    111,109,0,103,111,112,0,103,111,112,46,112,107,0,103,111,
+    114,103,101,46,109,117,115,101,117,109,0,103,111,114,105,122,
+    105,97,46,105,116,0,103,111,114,108,105,99,101,46,112,108,
+    0,103,111,115,46,112,107,0,103,111,115,101,46,110,97,114,
+    97,46,106,112,0,103,111,115,101,110,46,110,105,105,103,97,
+    116,97,46,106,112,0,103,111,115,104,105,107,105,46,104,121,
+    111,103,111,46,106,112,0,103,111,116,0,103,111,116,100,110,
+    115,46,99,104,0,103,111,116,100,110,115,46,99,111,109,0,
+    103,111,116,100,110,115,46,111,114,103,0,103,111,116,101,109,
+    98,97,46,115,104,105,122,117,111,107,97,46,106,112,0,103,
+    111,116,111,46,110,97,103,97,115,97,107,105,46,106,112,0,
+    103,111,116,112,97,110,116,104,101,111,110,46,99,111,109,0,
+    103,111,116,115,117,46,115,104,105,109,97,110,101,46,106,112,
+    0,103,111,117,112,105,108,101,46,102,114,0,103,111,117,118,
+    46,99,105,0,103,111,117,118,46,102,114,0,103,111,117,118,
+    46,104,116,0,103,111,117,118,46,107,109,0,103,111,117,118,
+    46,109,108,0,103,111,117,118,46,115,110,0,103,111,118,0,
+    103,111,118,46,97,99,0,103,111,118,46,97,101,0,103,111,
+    118,46,97,102,0,103,111,118,46,97,108,0,103,111,118,46,
+    97,114,0,103,111,118,46,97,115,0,103,111,118,46,97,122,
+    0,103,111,118,46,98,97,0,103,111,118,46,98,98,0,103,
+    111,118,46,98,102,0,103,111,118,46,98,104,0,103,111,118,
+    46,98,109,0,103,111,118,46,98,110,0,103,111,118,46,98,
+    115,0,103,111,118,46,98,116,0,103,111,118,46,98,121,0,
+    103,111,118,46,98,122,0,103,111,118,46,99,100,0,103,111,
+    118,46,99,108,0,103,111,118,46,99,109,0,103,111,118,46,
+    99,110,0,103,111,118,46,99,111,0,103,111,118,46,99,117,
+    0,103,111,118,46,99,120,0,103,111,118,46,99,121,0,103,
+    111,118,46,100,109,0,103,111,118,46,100,111,0,103,111,118,
+    46,100,122,0,103,111,118,46,101,99,0,103,111,118,46,101,
+    101,0,103,111,118,46,101,103,0,103,111,118,46,101,116,0,
+    103,111,118,46,102,106,0,103,111,118,46,103,100,0,103,111,
+    118,46,103,101,0,103,111,118,46,103,104,0,103,111,118,46,
+    103,105,0,103,111,118,46,103,110,0,103,111,118,46,103,114,
+    0,103,111,118,46,103,117,0,103,111,118,46,103,121,0,103,
+    111,118,46,104,107,0,103,111,118,46,105,101,0,103,111,118,
+    46,105,108,0,103,111,118,46,105,110,0,103,111,118,46,105,
+    113,0,103,111,118,46,105,114,0,103,111,118,46,105,115,0,
+    103,111,118,46,105,116,0,103,111,118,46,106,111,0,103,111,
+    118,46,107,103,0,103,111,118,46,107,105,0,103,111,118,46,
+    107,109,0,103,111,118,46,107,110,0,103,111,118,46,107,112,
+    0,103,111,118,46,107,119,0,103,111,118,46,107,122,0,103,
+    111,118,46,108,97,0,103,111,118,46,108,98,0,103,111,118,
+    46,108,99,0,103,111,118,46,108,107,0,103,111,118,46,108,
+    114,0,103,111,118,46,108,115,0,103,111,118,46,108,116,0,
+    103,111,118,46,108,118,0,103,111,118,46,108,121,0,103,111,
+    118,46,109,97,0,103,111,118,46,109,101,0,103,111,118,46,
+    109,103,0,103,111,118,46,109,107,0,103,111,118,46,109,108,
+    0,103,111,118,46,109,110,0,103,111,118,46,109,111,0,103,
+    111,118,46,109,114,0,103,111,118,46,109,115,0,103,111,118,
+    46,109,117,0,103,111,118,46,109,118,0,103,111,118,46,109,
+    119,0,103,111,118,46,109,121,0,103,111,118,46,109,122,0,
+    103,111,118,46,110,99,46,116,114,0,103,111,118,46,110,103,
+    0,103,111,118,46,110,108,0,103,111,118,46,110,114,0,103,
+    111,118,46,111,109,0,103,111,118,46,112,104,0,103,111,118,
+    46,112,107,0,103,111,118,46,112,110,0,103,111,118,46,112,
+    114,0,103,111,118,46,112,115,0,103,111,118,46,112,116,0,
+    103,111,118,46,112,121,0,103,111,118,46,113,97,0,103,111,
+    118,46,114,115,0,103,111,118,46,114,117,0,103,111,118,46,
+    114,119,0,103,111,118,46,115,97,0,103,111,118,46,115,98,
+    0,103,111,118,46,115,99,0,103,111,118,46,115,100,0,103,
+    111,118,46,115,103,0,103,111,118,46,115,104,0,103,111,118,
+    46,115,108,0,103,111,118,46,115,111,0,103,111,118,46,115,
+    115,0,103,111,118,46,115,120,0,103,111,118,46,115,121,0,
+    103,111,118,46,116,106,0,103,111,118,46,116,108,0,103,111,
+    118,46,116,109,0,103,111,118,46,116,110,0,103,111,118,46,
+    116,111,0,103,111,118,46,116,114,0,103,111,118,46,116,116,
+    0,103,111,118,46,116,119,0,103,111,118,46,117,97,0,103,
+    111,118,46,118,99,0,103,111,118,46,118,101,0,103,111,118,
+    46,118,110,0,103,111,118,46,119,115,0,103,111,118,46,121,
+    101,0,103,111,118,46,122,97,0,103,111,118,46,122,109,0,
+    103,111,118,46,122,119,0,103,111,118,101,114,110,109,101,110,
+    116,46,97,101,114,111,0,103,111,118,116,46,110,122,0,103,
+    113,0,103,114,46,99,111,109,0,103,114,46,101,117,46,111,
+    114,103,0,103,114,46,105,116,0,103,114,46,106,112,0,103,
+    114,97,105,110,103,101,114,0,103,114,97,106,101,119,111,46,
+    112,108,0,103,114,97,110,46,110,111,0,103,114,97,110,100,
+    114,97,112,105,100,115,46,109,117,115,101,117,109,0,103,114,
+    97,110,101,46,110,111,0,103,114,97,110,118,105,110,46,110,
+    111,0,103,114,97,112,104,105,99,115,0,103,114,97,112,104,
+    111,120,46,117,115,0,103,114,97,116,97,110,103,101,110,46,
+    110,111,0,103,114,97,116,105,115,0,103,114,97,122,46,109,
+    117,115,101,117,109,0,103,114,101,97,116,101,114,46,106,112,
+    0,103,114,101,101,110,0,103,114,101,116,97,46,102,114,0,
+    103,114,105,109,115,116,97,100,46,110,111,0,103,114,105,112,
+    101,0,103,114,105,119,46,103,111,118,46,112,108,0,103,114,
+    111,99,101,114,121,0,103,114,111,107,115,45,116,104,101,46,
+    105,110,102,111,0,103,114,111,107,115,45,116,104,105,115,46,
+    105,110,102,111,0,103,114,111,110,100,97,114,46,122,97,0,
+    103,114,111,110,103,46,110,111,0,103,114,111,115,115,101,116,
+    111,46,105,116,0,103,114,111,117,110,100,104,97,110,100,108,
+    105,110,103,46,97,101,114,111,0,103,114,111,117,112,46,97,
+    101,114,111,0,103,114,111,122,110,121,46,114,117,0,103,114,
+    111,122,110,121,46,115,117,0,103,114,112,46,108,107,0,103,
+    114,117,46,98,114,0,103,114,117,101,46,110,111,0,103,115,
+    0,103,115,46,97,97,46,110,111,0,103,115,46,97,104,46,
+    110,111,0,103,115,46,98,117,46,110,111,0,103,115,46,99,
+    110,0,103,115,46,102,109,46,110,111,0,103,115,46,104,108,
+    46,110,111,0,103,115,46,104,109,46,110,111,0,103,115,46,
+    106,97,110,45,109,97,121,101,110,46,110,111,0,103,115,46,
+    109,114,46,110,111,0,103,115,46,110,108,46,110,111,0,103,
+    115,46,110,116,46,110,111,0,103,115,46,111,102,46,110,111,
+    0,103,115,46,111,108,46,110,111,0,103,115,46,111,115,108,
+    111,46,110,111,0,103,115,46,114,108,46,110,111,0,103,115,
+    46,115,102,46,110,111,0,103,115,46,115,116,46,110,111,0,
+    103,115,46,115,118,97,108,98,97,114,100,46,110,111,0,103,
+    115,46,116,109,46,110,111,0,103,115,46,116,114,46,110,111,
+    0,103,115,46,118,97,46,110,111,0,103,115,46,118,102,46,
+    110,111,0,103,115,106,46,98,122,0,103,115,109,46,112,108,
+    0,103,117,97,109,46,103,117,0,103,117,97,114,100,105,97,
+    110,0,103,117,98,46,117,121,0,103,117,99,99,105,0,103,
+    117,101,114,110,115,101,121,46,109,117,115,101,117,109,0,103,
+    117,103,101,0,103,117,105,100,101,0,103,117,105,116,97,114,
+    115,0,103,117,106,97,114,97,116,46,105,110,0,103,117,106,
+    111,46,103,105,102,117,46,106,112,0,103,117,108,101,110,46,
+    110,111,0,103,117,111,118,100,97,103,101,97,105,100,110,117,
+    46,110,111,0,103,117,114,117,0,103,117,115,104,105,107,97,
+    109,105,46,111,107,105,110,97,119,97,46,106,112,0,103,118,
+    46,97,111,0,103,118,46,97,116,0,103,119,0,103,119,97,
+    110,103,106,117,46,107,114,0,103,120,46,99,110,0,103,121,
+    101,111,110,103,98,117,107,46,107,114,0,103,121,101,111,110,
+    103,103,105,46,107,114,0,103,121,101,111,110,103,110,97,109,
+    46,107,114,0,103,121,111,107,117,116,111,46,107,117,109,97,
+    109,111,116,111,46,106,112,0,103,122,46,99,110,0,103,195,
+    161,105,118,117,111,116,110,97,46,110,111,0,103,195,161,108,
+    115,195,161,46,110,111,0,103,195,161,197,139,103,97,118,105,
+    105,107,97,46,110,111,0,103,195,188,110,115,116,105,103,98,
+    101,115,116,101,108,108,101,110,46,100,101,0,103,195,188,110,
+    115,116,105,103,108,105,101,102,101,114,110,46,100,101,0,104,
+    46,98,103,0,104,46,115,101,0,104,97,46,99,110,0,104,
+    97,46,110,111,0,104,97,98,105,107,105,110,111,46,111,115,
+    97,107,97,46,106,112,0,104,97,98,109,101,114,46,110,111,
+    0,104,97,98,111,114,111,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,104,97,99,99,97,46,106,112,0,104,97,99,
+    104,105,106,111,46,116,111,107,121,111,46,106,112,0,104,97,
+    99,104,105,110,111,104,101,46,97,111,109,111,114,105,46,106,
+    112,0,104,97,99,104,105,111,106,105,46,116,111,107,121,111,
+    46,106,112,0,104,97,99,104,105,114,111,103,97,116,97,46,
+    97,107,105,116,97,46,106,112,0,104,97,100,97,110,111,46,
+    107,97,110,97,103,97,119,97,46,106,112,0,104,97,100,115,
+    101,108,46,110,111,0,104,97,101,98,97,114,117,46,111,107,
+    105,110,97,119,97,46,106,112,0,104,97,103,97,46,116,111,
+    99,104,105,103,105,46,106,112,0,104,97,103,101,98,111,115,
+    116,97,100,46,110,111,0,104,97,103,105,46,121,97,109,97,
+    103,117,99,104,105,46,106,112,0,104,97,105,98,97,114,97,
+    46,115,104,105,122,117,111,107,97,46,106,112,0,104,97,105,
+    114,0,104,97,107,97,116,97,46,102,117,107,117,111,107,97,
+    46,106,112,0,104,97,107,111,100,97,116,101,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,104,97,107,111,110,101,46,
+    107,97,110,97,103,97,119,97,46,106,112,0,104,97,107,117,
+    98,97,46,110,97,103,97,110,111,46,106,112,0,104,97,107,
+    117,105,46,105,115,104,105,107,97,119,97,46,106,112,0,104,
+    97,107,117,115,97,110,46,105,115,104,105,107,97,119,97,46,
+    106,112,0,104,97,108,100,101,110,46,110,111,0,104,97,108,
+    102,46,104,111,115,116,0,104,97,108,108,111,102,102,97,109,
+    101,46,109,117,115,101,117,109,0,104,97,108,115,97,46,110,
+    111,0,104,97,109,45,114,97,100,105,111,45,111,112,46,110,
+    101,116,0,104,97,109,97,100,97,46,115,104,105,109,97,110,
+    101,46,106,112,0,104,97,109,97,109,97,116,115,117,46,115,
+    104,105,122,117,111,107,97,46,106,112,0,104,97,109,97,114,
+    46,110,111,0,104,97,109,97,114,111,121,46,110,111,0,104,
+    97,109,97,116,97,109,97,46,115,97,103,97,46,106,112,0,
+    104,97,109,97,116,111,110,98,101,116,115,117,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,104,97,109,98,117,114,103,
+    0,104,97,109,98,117,114,103,46,109,117,115,101,117,109,0,
+    104,97,109,109,97,114,102,101,97,115,116,97,46,110,111,0,
+    104,97,109,109,101,114,102,101,115,116,46,110,111,0,104,97,
+    109,117,114,97,46,116,111,107,121,111,46,106,112,0,104,97,
+    110,97,109,97,107,105,46,105,119,97,116,101,46,106,112,0,
+    104,97,110,97,109,105,103,97,119,97,46,99,104,105,98,97,
+    46,106,112,0,104,97,110,97,119,97,46,102,117,107,117,115,
+    104,105,109,97,46,106,112,0,104,97,110,100,97,46,97,105,
+    99,104,105,46,106,112,0,104,97,110,100,99,114,97,102,116,
+    101,100,46,106,112,0,104,97,110,100,115,111,110,46,109,117,
+    115,101,117,109,0,104,97,110,103,103,108,105,100,105,110,103,
+    46,97,101,114,111,0,104,97,110,103,111,117,116,0,104,97,
+    110,110,97,110,46,111,115,97,107,97,46,106,112,0,104,97,
+    110,110,111,46,115,97,105,116,97,109,97,46,106,112,0,104,
+    97,110,121,117,46,115,97,105,116,97,109,97,46,106,112,0,
+    104,97,112,109,105,114,46,110,111,0,104,97,112,112,111,117,
+    46,97,107,105,116,97,46,106,112,0,104,97,114,97,46,110,
+    97,103,97,110,111,46,106,112,0,104,97,114,97,109,46,110,
+    111,0,104,97,114,101,105,100,46,110,111,0,104,97,114,105,
+    109,97,46,104,121,111,103,111,46,106,112,0,104,97,114,115,
+    116,97,100,46,110,111,0,104,97,114,118,101,115,116,99,101,
+    108,101,98,114,97,116,105,111,110,46,109,117,115,101,117,109,
+    0,104,97,115,97,109,97,46,111,105,116,97,46,106,112,0,
+    104,97,115,97,109,105,46,110,97,103,97,115,97,107,105,46,
+    106,112,0,104,97,115,104,98,97,110,103,46,115,104,0,104,
+    97,115,104,105,107,97,109,105,46,97,111,109,111,114,105,46,
+    106,112,0,104,97,115,104,105,109,97,46,103,105,102,117,46,
+    106,112,0,104,97,115,104,105,109,111,116,111,46,119,97,107,
+    97,121,97,109,97,46,106,112,0,104,97,115,117,100,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,104,97,115,117,114,
+    97,45,97,112,112,46,105,111,0,104,97,115,117,114,97,46,
+    97,112,112,0,104,97,115,118,105,107,46,110,111,0,104,97,
+    116,111,103,97,121,97,46,115,97,105,116,97,109,97,46,106,
+    112,0,104,97,116,111,121,97,109,97,46,115,97,105,116,97,
+    109,97,46,106,112,0,104,97,116,115,117,107,97,105,99,104,
+    105,46,104,105,114,111,115,104,105,109,97,46,106,112,0,104,
+    97,116,116,102,106,101,108,108,100,97,108,46,110,111,0,104,
+    97,117,103,101,115,117,110,100,46,110,111,0,104,97,117,115,
+    0,104,97,119,97,105,105,46,109,117,115,101,117,109,0,104,
+    97,121,97,107,97,119,97,46,121,97,109,97,110,97,115,104,
+    105,46,106,112,0,104,97,121,97,115,104,105,109,97,46,111,
+    107,97,121,97,109,97,46,106,112,0,104,97,122,117,46,97,
+    105,99,104,105,46,106,112,0,104,98,46,99,108,100,109,97,
+    105,108,46,114,117,0,104,98,46,99,110,0,104,98,111,0,
+    104,100,102,99,0,104,100,102,99,98,97,110,107,0,104,101,
+    46,99,110,0,104,101,97,108,116,104,45,99,97,114,101,114,
+    101,102,111,114,109,46,99,111,109,0,104,101,97,108,116,104,
+    46,109,117,115,101,117,109,0,104,101,97,108,116,104,46,110,
+    122,0,104,101,97,108,116,104,46,118,110,0,104,101,97,108,
+    116,104,99,97,114,101,0,104,101,97,118,121,46,106,112,0,
+    104,101,103,117,114,105,46,110,97,114,97,46,106,112,0,104,
+    101,105,109,97,116,117,110,100,117,104,114,101,110,46,109,117,
+    115,101,117,109,0,104,101,107,105,110,97,110,46,97,105,99,
+    104,105,46,106,112,0,104,101,108,108,97,115,46,109,117,115,
+    101,117,109,0,104,101,108,112,0,104,101,108,115,105,110,107,
+    105,0,104,101,108,115,105,110,107,105,46,109,117,115,101,117,
+    109,0,104,101,109,98,121,103,100,115,102,111,114,98,117,110,
+    100,46,109,117,115,101,117,109,0,104,101,109,110,101,46,110,
+    111,0,104,101,109,110,101,115,46,110,111,0,104,101,109,115,
+    101,100,97,108,46,110,111,0,104,101,112,102,111,114,103,101,
+    46,111,114,103,0,104,101,114,46,106,112,0,104,101,114,97,
+    100,46,110,111,0,104,101,114,101,0,104,101,114,101,45,102,
+    111,114,45,109,111,114,101,46,105,110,102,111,0,104,101,114,
+    105,116,97,103,101,46,109,117,115,101,117,109,0,104,101,114,
+    109,101,115,0,104,101,114,111,107,117,97,112,112,46,99,111,
+    109,0,104,101,114,111,107,117,115,115,108,46,99,111,109,0,
+    104,101,114,111,121,46,109,111,114,101,45,111,103,45,114,111,
+    109,115,100,97,108,46,110,111,0,104,101,114,111,121,46,110,
+    111,114,100,108,97,110,100,46,110,111,0,104,101,114,195,184,
+    121,46,109,195,184,114,101,45,111,103,45,114,111,109,115,100,
+    97,108,46,110,111,0,104,101,114,195,184,121,46,110,111,114,
+    100,108,97,110,100,46,110,111,0,104,101,116,101,109,108,46,
+    110,101,116,0,104,103,116,118,0,104,105,46,99,110,0,104,
+    105,99,97,109,46,110,101,116,0,104,105,99,104,105,115,111,
+    46,103,105,102,117,46,106,112,0,104,105,100,97,46,103,105,
+    102,117,46,106,112,0,104,105,100,97,107,97,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,104,105,100,97,107,97,46,
+    107,111,99,104,105,46,106,112,0,104,105,100,97,107,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,104,105,100,97,107,
+    97,46,119,97,107,97,121,97,109,97,46,106,112,0,104,105,
+    100,111,114,97,46,99,111,109,0,104,105,103,97,115,104,105,
+    46,102,117,107,117,111,107,97,46,106,112,0,104,105,103,97,
+    115,104,105,46,102,117,107,117,115,104,105,109,97,46,106,112,
+    0,104,105,103,97,115,104,105,46,111,107,105,110,97,119,97,
+    46,106,112,0,104,105,103,97,115,104,105,97,103,97,116,115,
+    117,109,97,46,103,117,110,109,97,46,106,112,0,104,105,103,
+    97,115,104,105,99,104,105,99,104,105,98,117,46,115,97,105,
+    116,97,109,97,46,106,112,0,104,105,103,97,115,104,105,104,
+    105,114,111,115,104,105,109,97,46,104,105,114,111,115,104,105,
+    109,97,46,106,112,0,104,105,103,97,115,104,105,105,122,117,
+    46,115,104,105,122,117,111,107,97,46,106,112,0,104,105,103,
+    97,115,104,105,105,122,117,109,111,46,115,104,105,109,97,110,
+    101,46,106,112,0,104,105,103,97,115,104,105,107,97,103,97,
+    119,97,46,107,97,103,97,119,97,46,106,112,0,104,105,103,
+    97,115,104,105,107,97,103,117,114,97,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,104,105,103,97,115,104,105,107,97,
+    119,97,46,104,111,107,107,97,105,100,111,46,106,112,0,104,
+    105,103,97,115,104,105,107,117,114,117,109,101,46,116,111,107,
+    121,111,46,106,112,0,104,105,103,97,115,104,105,109,97,116,
+    115,117,115,104,105,109,97,46,109,105,121,97,103,105,46,106,
+    112,0,104,105,103,97,115,104,105,109,97,116,115,117,121,97,
+    109,97,46,115,97,105,116,97,109,97,46,106,112,0,104,105,
+    103,97,115,104,105,109,117,114,97,121,97,109,97,46,116,111,
+    107,121,111,46,106,112,0,104,105,103,97,115,104,105,110,97,
+    114,117,115,101,46,97,107,105,116,97,46,106,112,0,104,105,
+    103,97,115,104,105,110,101,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,104,105,103,97,115,104,105,111,109,105,46,115,
+    104,105,103,97,46,106,112,0,104,105,103,97,115,104,105,111,
+    115,97,107,97,46,111,115,97,107,97,46,106,112,0,104,105,
+    103,97,115,104,105,115,104,105,114,97,107,97,119,97,46,103,
+    105,102,117,46,106,112,0,104,105,103,97,115,104,105,115,117,
+    109,105,121,111,115,104,105,46,111,115,97,107,97,46,106,112,
+    0,104,105,103,97,115,104,105,116,115,117,110,111,46,107,111,
+    99,104,105,46,106,112,0,104,105,103,97,115,104,105,117,114,
+    97,46,97,105,99,104,105,46,106,112,0,104,105,103,97,115,
+    104,105,121,97,109,97,46,107,121,111,116,111,46,106,112,0,
+    104,105,103,97,115,104,105,121,97,109,97,116,111,46,116,111,
+    107,121,111,46,106,112,0,104,105,103,97,115,104,105,121,111,
+    100,111,103,97,119,97,46,111,115,97,107,97,46,106,112,0,
+    104,105,103,97,115,104,105,121,111,115,104,105,110,111,46,110,
+    97,114,97,46,106,112,0,104,105,104,111,46,106,112,0,104,
+    105,106,105,46,111,105,116,97,46,106,112,0,104,105,107,97,
+    114,105,46,121,97,109,97,103,117,99,104,105,46,106,112,0,
+    104,105,107,97,119,97,46,115,104,105,109,97,110,101,46,106,
+    112,0,104,105,107,105,109,105,46,115,104,105,109,97,110,101,
+    46,106,112,0,104,105,107,111,110,101,46,115,104,105,103,97,
+    46,106,112,0,104,105,109,101,106,105,46,104,121,111,103,111,
+    46,106,112,0,104,105,109,101,115,104,105,109,97,46,111,105,
+    116,97,46,106,112,0,104,105,109,105,46,116,111,121,97,109,
+    97,46,106,112,0,104,105,110,111,46,116,111,107,121,111,46,
+    106,112,0,104,105,110,111,46,116,111,116,116,111,114,105,46,
+    106,112,0,104,105,110,111,100,101,46,116,111,107,121,111,46,
+    106,112,0,104,105,110,111,104,97,114,97,46,116,111,107,121,
+    111,46,106,112,0,104,105,111,107,105,46,107,97,103,111,115,
+    104,105,109,97,46,106,112,0,104,105,112,104,111,112,0,104,
+    105,112,112,121,46,106,112,0,104,105,114,97,100,111,46,110,
+    97,103,97,115,97,107,105,46,106,112,0,104,105,114,97,105,
+    122,117,109,105,46,105,119,97,116,101,46,106,112,0,104,105,
+    114,97,107,97,116,97,46,111,115,97,107,97,46,106,112,0,
+    104,105,114,97,110,97,105,46,97,111,109,111,114,105,46,106,
+    112,0,104,105,114,97,114,97,46,111,107,105,110,97,119,97,
+    46,106,112,0,104,105,114,97,116,97,46,102,117,107,117,115,
+    104,105,109,97,46,106,112,0,104,105,114,97,116,115,117,107,
+    97,46,107,97,110,97,103,97,119,97,46,106,112,0,104,105,
+    114,97,121,97,46,110,97,103,97,110,111,46,106,112,0,104,
+    105,114,111,103,97,119,97,46,119,97,107,97,121,97,109,97,
+    46,106,112,0,104,105,114,111,107,97,119,97,46,102,117,107,
+    117,111,107,97,46,106,112,0,104,105,114,111,110,111,46,102,
+    117,107,117,115,104,105,109,97,46,106,112,0,104,105,114,111,
+    110,111,46,105,119,97,116,101,46,106,112,0,104,105,114,111,
+    111,46,104,111,107,107,97,105,100,111,46,106,112,0,104,105,
+    114,111,115,97,107,105,46,97,111,109,111,114,105,46,106,112,
+    0,104,105,115,97,109,105,116,115,117,0,104,105,115,97,121,
+    97,109,97,46,102,117,107,117,111,107,97,46,106,112,0,104,
+    105,115,116,111,105,114,101,46,109,117,115,101,117,109,0,104,
+    105,115,116,111,114,105,99,97,108,46,109,117,115,101,117,109,
+    0,104,105,115,116,111,114,105,99,97,108,115,111,99,105,101,
+    116,121,46,109,117,115,101,117,109,0,104,105,115,116,111,114,
+    105,99,104,111,117,115,101,115,46,109,117,115,101,117,109,0,
+    104,105,115,116,111,114,105,115,99,104,46,109,117,115,101,117,
+    109,0,104,105,115,116,111,114,105,115,99,104,101,115,46,109,
+    117,115,101,117,109,0,104,105,115,116,111,114,121,46,109,117,
+    115,101,117,109,0,104,105,115,116,111,114,121,111,102,115,99,
+    105,101,110,99,101,46,109,117,115,101,117,109,0,104,105,116,
+    97,46,111,105,116,97,46,106,112,0,104,105,116,97,99,104,
+    105,0,104,105,116,97,99,104,105,46,105,98,97,114,97,107,
+    105,46,106,112,0,104,105,116,97,99,104,105,110,97,107,97,
+    46,105,98,97,114,97,107,105,46,106,112,0,104,105,116,97,
+    99,104,105,111,109,105,121,97,46,105,98,97,114,97,107,105,
+    46,106,112,0,104,105,116,97,99,104,105,111,116,97,46,105,
+    98,97,114,97,107,105,46,106,112,0,104,105,116,114,97,46,
+    110,111,0,104,105,118,0,104,105,122,101,110,46,115,97,103,
+    97,46,106,112,0,104,106,97,114,116,100,97,108,46,110,111,
+    0,104,106,101,108,109,101,108,97,110,100,46,110,111,0,104,
+    107,46,99,110,0,104,107,46,99,111,109,0,104,107,46,111,
+    114,103,0,104,107,116,0,104,108,46,99,110,0,104,108,120,
+    46,108,105,118,101,0,104,108,120,46,112,97,103,101,0,104,
+    108,120,51,46,112,97,103,101,0,104,109,0,104,110,46,99,
+    110,0,104,111,98,98,121,45,115,105,116,101,46,99,111,109,
+    0,104,111,98,98,121,45,115,105,116,101,46,111,114,103,0,
+    104,111,98,111,108,46,110,111,0,104,111,98,195,184,108,46,
+    110,111,0,104,111,99,107,101,121,0,104,111,102,46,110,111,
+    0,104,111,102,117,46,121,97,109,97,103,117,99,104,105,46,
+    106,112,0,104,111,107,107,115,117,110,100,46,110,111,0,104,
+    111,107,117,114,121,117,46,104,111,107,107,97,105,100,111,46,
+    106,112,0,104,111,107,117,116,111,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,104,111,107,117,116,111,46,121,97,109,
+    97,110,97,115,104,105,46,106,112,0,104,111,108,46,110,111,
+    0,104,111,108,100,105,110,103,115,0,104,111,108,101,46,110,
+    111,0,104,111,108,105,100,97,121,0,104,111,108,109,101,115,
+    116,114,97,110,100,46,110,111,0,104,111,108,116,97,108,101,
+    110,46,110,111,0,104,111,108,116,195,165,108,101,110,46,110,
+    111,0,104,111,108,121,46,106,112,0,104,111,109,101,46,100,
+    121,110,100,110,115,46,111,114,103,0,104,111,109,101,98,117,
+    105,108,116,46,97,101,114,111,0,104,111,109,101,100,101,112,
+    111,116,0,104,111,109,101,100,110,115,46,111,114,103,0,104,
+    111,109,101,102,116,112,46,110,101,116,0,104,111,109,101,102,
+    116,112,46,111,114,103,0,104,111,109,101,103,111,111,100,115,
+    0,104,111,109,101,105,112,46,110,101,116,0,104,111,109,101,
+    108,105,110,107,46,111,110,101,0,104,111,109,101,108,105,110,
+    117,120,46,99,111,109,0,104,111,109,101,108,105,110,117,120,
+    46,110,101,116,0,104,111,109,101,108,105,110,117,120,46,111,
+    114,103,0,104,111,109,101,111,102,102,105,99,101,46,103,111,
+    118,46,117,107,0,104,111,109,101,115,0,104,111,109,101,115,
+    101,99,117,114,105,116,121,109,97,99,46,99,111,109,0,104,
+    111,109,101,115,101,99,117,114,105,116,121,112,99,46,99,111,
+    109,0,104,111,109,101,115,101,110,115,101,0,104,111,109,101,
+    115,107,108,101,112,46,112,108,0,104,111,109,101,117,110,105,
+    120,46,99,111,109,0,104,111,109,101,117,110,105,120,46,110,
+    101,116,0,104,111,109,101,117,110,105,120,46,111,114,103,0,
+    104,111,110,97,105,46,101,104,105,109,101,46,106,112,0,104,
+    111,110,98,101,116,115,117,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,104,111,110,100,97,0,104,111,110,101,102,111,
+    115,115,46,110,111,0,104,111,110,103,111,46,104,105,114,111,
+    115,104,105,109,97,46,106,112,0,104,111,110,106,111,46,97,
+    107,105,116,97,46,106,112,0,104,111,110,106,111,46,115,97,
+    105,116,97,109,97,46,106,112,0,104,111,110,106,121,111,46,
+    97,107,105,116,97,46,106,112,0,104,111,112,108,105,120,46,
+    115,104,111,112,0,104,111,112,116,111,46,109,101,0,104,111,
+    112,116,111,46,111,114,103,0,104,111,114,110,105,110,100,97,
+    108,46,110,111,0,104,111,114,111,107,97,110,97,105,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,104,111,114,111,108,
+    111,103,121,46,109,117,115,101,117,109,0,104,111,114,111,110,
+    111,98,101,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    104,111,114,115,101,0,104,111,114,116,101,110,46,110,111,0,
+    104,111,115,112,46,117,107,0,104,111,115,112,105,116,97,108,
+    0,104,111,115,116,101,100,112,105,46,99,111,109,0,104,111,
+    115,116,105,110,103,45,99,108,117,115,116,101,114,46,110,108,
+    0,104,111,115,116,105,110,103,46,109,121,106,105,110,111,46,
+    114,117,0,104,111,115,116,105,110,103,46,111,118,104,46,110,
+    101,116,0,104,111,115,116,121,104,111,115,116,105,110,103,46,
+    105,111,0,104,111,116,0,104,111,116,101,108,46,104,117,0,
+    104,111,116,101,108,46,108,107,0,104,111,116,101,108,46,116,
+    122,0,104,111,116,101,108,101,115,0,104,111,116,101,108,115,
+    0,104,111,116,101,108,119,105,116,104,102,108,105,103,104,116,
+    46,99,111,109,0,104,111,116,109,97,105,108,0,104,111,117,
+    115,101,0,104,111,117,115,101,46,109,117,115,101,117,109,0,
+    104,111,119,0,104,111,121,97,110,103,101,114,46,110,111,0,
+    104,111,121,108,97,110,100,101,116,46,110,111,0,104,114,46,
+    101,117,46,111,114,103,0,104,114,97,46,104,101,97,108,116,
+    104,0,104,115,46,107,114,0,104,115,46,114,117,110,0,104,
+    115,46,122,111,110,101,0,104,115,98,99,0,104,116,116,112,
+    98,105,110,46,111,114,103,0,104,117,46,99,111,109,0,104,
+    117,46,101,117,46,111,114,103,0,104,117,46,110,101,116,0,
+    104,117,103,104,101,115,0,104,117,105,115,115,105,101,114,45,
+    106,117,115,116,105,99,101,46,102,114,0,104,117,109,97,110,
+    105,116,105,101,115,46,109,117,115,101,117,109,0,104,117,110,
+    103,114,121,46,106,112,0,104,117,114,100,97,108,46,110,111,
+    0,104,117,114,117,109,46,110,111,0,104,118,97,108,101,114,
+    46,110,111,0,104,121,97,116,116,0,104,121,108,108,101,115,
+    116,97,100,46,110,111,0,104,121,117,103,97,46,109,105,121,
+    97,122,97,107,105,46,106,112,0,104,121,117,110,100,97,105,
+    0,104,122,99,46,105,111,0,104,195,161,98,109,101,114,46,
+    110,111,0,104,195,161,109,109,195,161,114,102,101,97,115,116,
+    97,46,110,111,0,104,195,161,112,109,105,114,46,110,111,0,
+    104,195,164,107,107,105,110,101,110,46,102,105,0,104,195,165,
+    46,110,111,0,104,195,166,103,101,98,111,115,116,97,100,46,
+    110,111,0,104,195,184,110,101,102,111,115,115,46,110,111,0,
+    104,195,184,121,97,110,103,101,114,46,110,111,0,104,195,184,
+    121,108,97,110,100,101,116,46,110,111,0,105,46,98,103,0,
+    105,46,110,103,0,105,46,112,104,0,105,46,115,101,0,105,
+    50,51,52,46,109,101,0,105,97,109,97,108,108,97,109,97,
+    46,99,111,109,0,105,98,97,114,97,46,111,107,97,121,97,
+    109,97,46,106,112,0,105,98,97,114,97,107,105,46,105,98,
+    97,114,97,107,105,46,106,112,0,105,98,97,114,97,107,105,
+    46,111,115,97,107,97,46,106,112,0,105,98,101,115,116,97,
+    100,46,110,111,0,105,98,105,103,97,119,97,46,103,105,102,
+    117,46,106,112,0,105,98,109,0,105,98,120,111,115,46,105,
+    116,0,105,99,46,103,111,118,46,112,108,0,105,99,98,99,
+    0,105,99,101,0,105,99,104,105,98,97,46,116,111,107,117,
+    115,104,105,109,97,46,106,112,0,105,99,104,105,104,97,114,
+    97,46,99,104,105,98,97,46,106,112,0,105,99,104,105,107,
+    97,105,46,116,111,99,104,105,103,105,46,106,112,0,105,99,
+    104,105,107,97,119,97,46,99,104,105,98,97,46,106,112,0,
+    105,99,104,105,107,97,119,97,46,104,121,111,103,111,46,106,
+    112,0,105,99,104,105,107,97,119,97,109,105,115,97,116,111,
+    46,121,97,109,97,110,97,115,104,105,46,106,112,0,105,99,
+    104,105,110,111,104,101,46,105,119,97,116,101,46,106,112,0,
+    105,99,104,105,110,111,109,105,121,97,46,97,105,99,104,105,
+    46,106,112,0,105,99,104,105,110,111,109,105,121,97,46,99,
+    104,105,98,97,46,106,112,0,105,99,104,105,110,111,115,101,
+    107,105,46,105,119,97,116,101,46,106,112,0,105,99,117,0,
+    105,99,117,114,117,115,46,106,112,0,105,100,46,97,117,0,
+    105,100,46,102,105,114,101,119,97,108,108,101,100,114,101,112,
+    108,105,116,46,99,111,0,105,100,46,102,111,114,103,101,114,
+    111,99,107,46,105,111,0,105,100,46,105,114,0,105,100,46,
+    108,118,0,105,100,46,108,121,0,105,100,46,114,101,112,108,
+    46,99,111,0,105,100,101,46,107,121,111,116,111,46,106,112,
+    0,105,100,102,46,105,108,0,105,100,114,101,116,116,46,110,
+    111,0,105,100,118,46,104,107,0,105,100,118,46,116,119,0,
+    105,101,46,101,117,46,111,114,103,0,105,101,101,101,0,105,
+    102,46,117,97,0,105,102,109,0,105,103,108,101,115,105,97,
+    115,45,99,97,114,98,111,110,105,97,46,105,116,0,105,103,
+    108,101,115,105,97,115,99,97,114,98,111,110,105,97,46,105,
+    116,0,105,104,101,121,97,46,111,107,105,110,97,119,97,46,
+    106,112,0,105,105,100,97,46,110,97,103,97,110,111,46,106,
+    112,0,105,105,100,101,46,121,97,109,97,103,97,116,97,46,
+    106,112,0,105,105,106,105,109,97,46,110,97,103,97,110,111,
+    46,106,112,0,105,105,116,97,116,101,46,102,117,107,117,115,
+    104,105,109,97,46,106,112,0,105,105,121,97,109,97,46,110,
+    97,103,97,110,111,46,106,112,0,105,105,122,117,107,97,46,
+    102,117,107,117,111,107,97,46,106,112,0,105,105,122,117,110,
+    97,46,110,97,103,97,110,111,46,106,112,0,105,107,97,110,
+    111,0,105,107,97,114,117,103,97,46,110,97,114,97,46,106,
+    112,0,105,107,97,116,97,46,101,104,105,109,101,46,106,112,
+    0,105,107,97,119,97,46,97,107,105,116,97,46,106,112,0,
+    105,107,101,100,97,46,102,117,107,117,105,46,106,112,0,105,
+    107,101,100,97,46,103,105,102,117,46,106,112,0,105,107,101,
+    100,97,46,104,111,107,107,97,105,100,111,46,106,112,0,105,
+    107,101,100,97,46,110,97,103,97,110,111,46,106,112,0,105,
+    107,101,100,97,46,111,115,97,107,97,46,106,112,0,105,107,
+    105,46,102,105,0,105,107,105,46,110,97,103,97,115,97,107,
+    105,46,106,112,0,105,107,111,109,97,46,110,97,114,97,46,
+    106,112,0,105,107,117,115,97,107,97,46,110,97,103,97,110,
+    111,46,106,112,0,105,108,46,101,117,46,111,114,103,0,105,
+    108,97,119,97,46,112,108,0,105,108,105,97,100,98,111,120,
+    111,115,46,105,116,0,105,108,108,117,115,116,114,97,116,105,
+    111,110,46,109,117,115,101,117,109,0,105,108,111,118,101,99,
+    111,108,108,101,103,101,46,105,110,102,111,0,105,109,46,105,
+    116,0,105,109,97,98,97,114,105,46,101,104,105,109,101,46,
+    106,112,0,105,109,97,103,101,97,110,100,115,111,117,110,100,
+    46,109,117,115,101,117,109,0,105,109,97,107,97,110,101,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,105,109,97,109,
+    97,116,0,105,109,97,114,105,46,115,97,103,97,46,106,112,
+    0,105,109,98,46,98,114,0,105,109,100,98,0,105,109,105,
+    122,117,46,116,111,121,97,109,97,46,106,112,0,105,109,109,
+    111,0,105,109,109,111,98,105,108,105,101,110,0,105,109,112,
+    101,114,105,97,46,105,116,0,105,109,112,101,114,116,114,105,
+    120,46,99,111,109,0,105,109,112,101,114,116,114,105,120,99,
+    100,110,46,99,111,109,0,105,110,45,97,100,100,114,46,97,
+    114,112,97,0,105,110,45,98,101,114,108,105,110,46,100,101,
+    0,105,110,45,98,114,98,46,100,101,0,105,110,45,98,117,
+    116,116,101,114,46,100,101,0,105,110,45,100,115,108,46,100,
+    101,0,105,110,45,100,115,108,46,110,101,116,0,105,110,45,
+    100,115,108,46,111,114,103,0,105,110,45,116,104,101,45,98,
+    97,110,100,46,110,101,116,0,105,110,45,118,112,110,46,100,
+    101,0,105,110,45,118,112,110,46,110,101,116,0,105,110,45,
+    118,112,110,46,111,114,103,0,105,110,46,101,117,46,111,114,
+    103,0,105,110,46,102,117,116,117,114,101,99,109,115,46,97,
+    116,0,105,110,46,110,97,0,105,110,46,110,101,116,0,105,
+    110,46,110,105,0,105,110,46,114,115,0,105,110,46,116,104,
+    0,105,110,46,117,97,0,105,110,97,46,105,98,97,114,97,
+    107,105,46,106,112,0,105,110,97,46,110,97,103,97,110,111,
+    46,106,112,0,105,110,97,46,115,97,105,116,97,109,97,46,
+    106,112,0,105,110,97,98,101,46,109,105,101,46,106,112,0,
+    105,110,97,103,97,119,97,46,104,121,111,103,111,46,106,112,
+    0,105,110,97,103,105,46,116,111,107,121,111,46,106,112,0,
+    105,110,97,109,105,46,116,111,121,97,109,97,46,106,112,0,
+    105,110,97,109,105,46,119,97,107,97,121,97,109,97,46,106,
+    112,0,105,110,97,115,104,105,107,105,46,105,98,97,114,97,
+    107,105,46,106,112,0,105,110,97,116,115,117,107,105,46,102,
+    117,107,117,111,107,97,46,106,112,0,105,110,97,119,97,115,
+    104,105,114,111,46,102,117,107,117,115,104,105,109,97,46,106,
+    112,0,105,110,97,122,97,119,97,46,97,105,99,104,105,46,
+    106,112,0,105,110,99,0,105,110,99,46,104,107,0,105,110,
+    99,104,101,111,110,46,107,114,0,105,110,100,46,98,114,0,
+    105,110,100,46,103,116,0,105,110,100,46,105,110,0,105,110,
+    100,46,107,119,0,105,110,100,46,116,110,0,105,110,100,101,
+    112,101,110,100,101,110,116,45,99,111,109,109,105,115,115,105,
+    111,110,46,117,107,0,105,110,100,101,112,101,110,100,101,110,
+    116,45,105,110,113,117,101,115,116,46,117,107,0,105,110,100,
+    101,112,101,110,100,101,110,116,45,105,110,113,117,105,114,121,
+    46,117,107,0,105,110,100,101,112,101,110,100,101,110,116,45,
+    112,97,110,101,108,46,117,107,0,105,110,100,101,112,101,110,
+    100,101,110,116,45,114,101,118,105,101,119,46,117,107,0,105,
+    110,100,101,114,111,121,46,110,111,0,105,110,100,101,114,195,
+    184,121,46,110,111,0,105,110,100,105,97,110,46,109,117,115,
+    101,117,109,0,105,110,100,105,97,110,97,46,109,117,115,101,
+    117,109,0,105,110,100,105,97,110,97,112,111,108,105,115,46,
+    109,117,115,101,117,109,0,105,110,100,105,97,110,109,97,114,
+    107,101,116,46,109,117,115,101,117,109,0,105,110,100,105,101,
+    46,112,111,114,110,0,105,110,100,105,103,101,110,97,46,98,
+    111,0,105,110,100,117,115,116,114,105,97,46,98,111,0,105,
+    110,100,117,115,116,114,105,101,115,0,105,110,101,46,107,121,
+    111,116,111,46,106,112,0,105,110,102,46,98,114,0,105,110,
+    102,46,99,117,0,105,110,102,46,109,107,0,105,110,102,46,
+    117,97,0,105,110,102,105,110,105,116,105,0,105,110,102,111,
+    46,97,116,0,105,110,102,111,46,97,117,0,105,110,102,111,
+    46,97,122,0,105,110,102,111,46,98,98,0,105,110,102,111,
+    46,98,106,0,105,110,102,111,46,98,111,0,105,110,102,111,
+    46,99,111,0,105,110,102,111,46,99,120,0,105,110,102,111,
+    46,101,99,0,105,110,102,111,46,101,116,0,105,110,102,111,
+    46,102,106,0,105,110,102,111,46,103,117,0,105,110,102,111,
+    46,104,116,0,105,110,102,111,46,104,117,0,105,110,102,111,
+    46,105,110,0,105,110,102,111,46,107,101,0,105,110,102,111,
+    46,107,105,0,105,110,102,111,46,108,97,0,105,110,102,111,
+    46,108,115,0,105,110,102,111,46,109,118,0,105,110,102,111,
+    46,110,97,0,105,110,102,111,46,110,102,0,105,110,102,111,
+    46,110,105,0,105,110,102,111,46,110,114,0,105,110,102,111,
+    46,112,107,0,105,110,102,111,46,112,108,0,105,110,102,111,
+    46,112,114,0,105,110,102,111,46,114,111,0,105,110,102,111,
+    46,115,100,0,105,110,102,111,46,116,110,0,105,110,102,111,
+    46,116,114,0,105,110,102,111,46,116,116,0,105,110,102,111,
+    46,116,122,0,105,110,102,111,46,118,101,0,105,110,102,111,
+    46,118,110,0,105,110,102,111,46,122,109,0,105,110,103,0,
+    105,110,103,46,112,97,0,105,110,103,97,116,108,97,110,46,
+    104,117,0,105,110,107,0,105,110,111,46,107,111,99,104,105,
+    46,106,112,0,105,110,115,116,97,110,99,101,46,100,97,116,
+    97,100,101,116,101,99,116,46,99,111,109,0,105,110,115,116,
+    97,110,99,101,115,46,115,112,97,119,110,46,99,99,0,105,
+    110,115,116,97,110,116,99,108,111,117,100,46,99,110,0,105,
+    110,115,116,105,116,117,116,101,0,105,110,115,117,114,97,110,
+    99,101,0,105,110,115,117,114,97,110,99,101,46,97,101,114,
+    111,0,105,110,115,117,114,101,0,105,110,116,46,97,114,0,
+    105,110,116,46,97,122,0,105,110,116,46,98,111,0,105,110,
+    116,46,99,105,0,105,110,116,46,99,111,0,105,110,116,46,
+    99,118,0,105,110,116,46,101,117,46,111,114,103,0,105,110,
+    116,46,105,110,0,105,110,116,46,105,115,0,105,110,116,46,
+    108,97,0,105,110,116,46,108,107,0,105,110,116,46,109,118,
+    0,105,110,116,46,109,119,0,105,110,116,46,110,105,0,105,
+    110,116,46,112,116,0,105,110,116,46,114,117,0,105,110,116,
+    46,116,106,0,105,110,116,46,116,116,0,105,110,116,46,118,
+    101,0,105,110,116,46,118,110,0,105,110,116,101,108,108,105,
+    103,101,110,99,101,46,109,117,115,101,117,109,0,105,110,116,
+    101,114,97,99,116,105,118,101,46,109,117,115,101,117,109,0,
+    105,110,116,101,114,110,97,116,105,111,110,97,108,0,105,110,
+    116,101,114,110,101,116,45,100,110,115,46,100,101,0,105,110,
+    116,101,114,110,101,116,46,105,110,0,105,110,116,108,46,116,
+    110,0,105,110,116,117,105,116,0,105,110,117,121,97,109,97,
+    46,97,105,99,104,105,46,106,112,0,105,110,118,101,115,116,
+    109,101,110,116,115,0,105,110,122,97,105,46,99,104,105,98,
+    97,46,106,112,0,105,111,46,105,110,0,105,111,46,107,103,
+    0,105,111,98,98,46,110,101,116,0,105,111,112,115,121,115,
+    46,115,101,0,105,112,46,108,105,110,111,100,101,117,115,101,
+    114,99,111,110,116,101,110,116,46,99,111,109,0,105,112,54,
+    46,97,114,112,97,0,105,112,105,102,111,110,121,46,110,101,
+    116,0,105,112,105,114,97,110,103,97,0,105,114,97,113,46,
+    109,117,115,101,117,109,0,105,114,105,115,46,97,114,112,97,
+    0,105,114,105,115,104,0,105,114,111,110,46,109,117,115,101,
+    117,109,0,105,114,117,109,97,46,115,97,105,116,97,109,97,
+    46,106,112,0,105,115,45,97,45,97,110,97,114,99,104,105,
+    115,116,46,99,111,109,0,105,115,45,97,45,98,108,111,103,
+    103,101,114,46,99,111,109,0,105,115,45,97,45,98,111,111,
+    107,107,101,101,112,101,114,46,99,111,109,0,105,115,45,97,
+    45,98,114,117,105,110,115,102,97,110,46,111,114,103,0,105,
+    115,45,97,45,98,117,108,108,115,45,102,97,110,46,99,111,
+    109,0,105,115,45,97,45,99,97,110,100,105,100,97,116,101,
+    46,111,114,103,0,105,115,45,97,45,99,97,116,101,114,101,
+    114,46,99,111,109,0,105,115,45,97,45,99,101,108,116,105,
+    99,115,102,97,110,46,111,114,103,0,105,115,45,97,45,99,
+    104,101,102,46,99,111,109,0,105,115,45,97,45,99,104,101,
+    102,46,110,101,116,0,105,115,45,97,45,99,104,101,102,46,
+    111,114,103,0,105,115,45,97,45,99,111,110,115,101,114,118,
+    97,116,105,118,101,46,99,111,109,0,105,115,45,97,45,99,
+    112,97,46,99,111,109,0,105,115,45,97,45,99,117,98,105,
+    99,108,101,45,115,108,97,118,101,46,99,111,109,0,105,115,
+    45,97,45,100,101,109,111,99,114,97,116,46,99,111,109,0,
+    105,115,45,97,45,100,101,115,105,103,110,101,114,46,99,111,
+    109,0,105,115,45,97,45,100,111,99,116,111,114,46,99,111,
+    109,0,105,115,45,97,45,102,105,110,97,110,99,105,97,108,
+    97,100,118,105,115,111,114,46,99,111,109,0,105,115,45,97,
+    45,103,101,101,107,46,99,111,109,0,105,115,45,97,45,103,
+    101,101,107,46,110,101,116,0,105,115,45,97,45,103,101,101,
+    107,46,111,114,103,0,105,115,45,97,45,103,114,101,101,110,
+    46,99,111,109,0,105,115,45,97,45,103,117,114,117,46,99,
+    111,109,0,105,115,45,97,45,104,97,114,100,45,119,111,114,
+    107,101,114,46,99,111,109,0,105,115,45,97,45,104,117,110,
+    116,101,114,46,99,111,109,0,105,115,45,97,45,107,110,105,
+    103,104,116,46,111,114,103,0,105,115,45,97,45,108,97,110,
+    100,115,99,97,112,101,114,46,99,111,109,0,105,115,45,97,
+    45,108,97,119,121,101,114,46,99,111,109,0,105,115,45,97,
+    45,108,105,98,101,114,97,108,46,99,111,109,0,105,115,45,
+    97,45,108,105,98,101,114,116,97,114,105,97,110,46,99,111,
+    109,0,105,115,45,97,45,108,105,110,117,120,45,117,115,101,
+    114,46,111,114,103,0,105,115,45,97,45,108,108,97,109,97,
+    46,99,111,109,0,105,115,45,97,45,109,117,115,105,99,105,
+    97,110,46,99,111,109,0,105,115,45,97,45,110,97,115,99,
+    97,114,102,97,110,46,99,111,109,0,105,115,45,97,45,110,
+    117,114,115,101,46,99,111,109,0,105,115,45,97,45,112,97,
+    105,110,116,101,114,46,99,111,109,0,105,115,45,97,45,112,
+    97,116,115,102,97,110,46,111,114,103,0,105,115,45,97,45,
+    112,101,114,115,111,110,97,108,116,114,97,105,110,101,114,46,
+    99,111,109,0,105,115,45,97,45,112,104,111,116,111,103,114,
+    97,112,104,101,114,46,99,111,109,0,105,115,45,97,45,112,
+    108,97,121,101,114,46,99,111,109,0,105,115,45,97,45,114,
+    101,112,117,98,108,105,99,97,110,46,99,111,109,0,105,115,
+    45,97,45,114,111,99,107,115,116,97,114,46,99,111,109,0,
+    105,115,45,97,45,115,111,99,105,97,108,105,115,116,46,99,
+    111,109,0,105,115,45,97,45,115,111,120,102,97,110,46,111,
+    114,103,0,105,115,45,97,45,115,116,117,100,101,110,116,46,
+    99,111,109,0,105,115,45,97,45,116,101,97,99,104,101,114,
+    46,99,111,109,0,105,115,45,97,45,116,101,99,104,105,101,
+    46,99,111,109,0,105,115,45,97,45,116,104,101,114,97,112,
+    105,115,116,46,99,111,109,0,105,115,45,97,110,45,97,99,
+    99,111,117,110,116,97,110,116,46,99,111,109,0,105,115,45,
+    97,110,45,97,99,116,111,114,46,99,111,109,0,105,115,45,
+    97,110,45,97,99,116,114,101,115,115,46,99,111,109,0,105,
+    115,45,97,110,45,97,110,97,114,99,104,105,115,116,46,99,
+    111,109,0,105,115,45,97,110,45,97,114,116,105,115,116,46,
+    99,111,109,0,105,115,45,97,110,45,101,110,103,105,110,101,
+    101,114,46,99,111,109,0,105,115,45,97,110,45,101,110,116,
+    101,114,116,97,105,110,101,114,46,99,111,109,0,105,115,45,
+    98,121,46,117,115,0,105,115,45,99,101,114,116,105,102,105,
+    101,100,46,99,111,109,0,105,115,45,102,111,117,110,100,46,
+    111,114,103,0,105,115,45,103,111,110,101,46,99,111,109,0,
+    105,115,45,105,110,116,111,45,97,110,105,109,101,46,99,111,
+    109,0,105,115,45,105,110,116,111,45,99,97,114,115,46,99,
+    111,109,0,105,115,45,105,110,116,111,45,99,97,114,116,111,
+    111,110,115,46,99,111,109,0,105,115,45,105,110,116,111,45,
+    103,97,109,101,115,46,99,111,109,0,105,115,45,108,101,101,
+    116,46,99,111,109,0,105,115,45,108,111,115,116,46,111,114,
+    103,0,105,115,45,110,111,116,45,99,101,114,116,105,102,105,
+    101,100,46,99,111,109,0,105,115,45,115,97,118,101,100,46,
+    111,114,103,0,105,115,45,115,108,105,99,107,46,99,111,109,
+    0,105,115,45,117,98,101,114,108,101,101,116,46,99,111,109,
+    0,105,115,45,118,101,114,121,45,98,97,100,46,111,114,103,
+    0,105,115,45,118,101,114,121,45,101,118,105,108,46,111,114,
+    103,0,105,115,45,118,101,114,121,45,103,111,111,100,46,111,
+    114,103,0,105,115,45,118,101,114,121,45,110,105,99,101,46,
+    111,114,103,0,105,115,45,118,101,114,121,45,115,119,101,101,
+    116,46,111,114,103,0,105,115,45,119,105,116,104,45,116,104,
+    101,98,97,110,100,46,99,111,109,0,105,115,46,101,117,46,
+    111,114,103,0,105,115,46,103,111,118,46,112,108,0,105,115,
+    46,105,116,0,105,115,97,45,103,101,101,107,46,99,111,109,
+    0,105,115,97,45,103,101,101,107,46,110,101,116,0,105,115,
+    97,45,103,101,101,107,46,111,114,103,0,105,115,97,45,104,
+    111,99,107,101,121,110,117,116,46,99,111,109,0,105,115,97,
+    46,107,97,103,111,115,104,105,109,97,46,106,112,0,105,115,
+    97,46,117,115,0,105,115,97,104,97,121,97,46,110,97,103,
+    97,115,97,107,105,46,106,112,0,105,115,101,46,109,105,101,
+    46,106,112,0,105,115,101,104,97,114,97,46,107,97,110,97,
+    103,97,119,97,46,106,112,0,105,115,101,110,46,107,97,103,
+    111,115,104,105,109,97,46,106,112,0,105,115,101,114,110,105,
+    97,46,105,116,0,105,115,101,114,118,46,100,101,118,0,105,
+    115,101,114,118,115,99,104,117,108,101,46,100,101,0,105,115,
+    101,115,97,107,105,46,103,117,110,109,97,46,106,112,0,105,
+    115,104,105,103,97,107,105,46,111,107,105,110,97,119,97,46,
+    106,112,0,105,115,104,105,107,97,114,105,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,105,115,104,105,107,97,119,97,
+    46,102,117,107,117,115,104,105,109,97,46,106,112,0,105,115,
+    104,105,107,97,119,97,46,111,107,105,110,97,119,97,46,106,
+    112,0,105,115,104,105,110,111,109,97,107,105,46,109,105,121,
+    97,103,105,46,106,112,0,105,115,108,97,46,112,114,0,105,
+    115,108,101,111,102,109,97,110,46,109,117,115,101,117,109,0,
+    105,115,109,97,105,108,105,0,105,115,115,104,105,107,105,46,
+    97,105,99,104,105,46,106,112,0,105,115,115,109,97,114,116,
+    101,114,116,104,97,110,121,111,117,46,99,111,109,0,105,115,
+    116,0,105,115,116,97,110,98,117,108,0,105,115,116,101,105,
+    110,103,101,101,107,46,100,101,0,105,115,116,109,101,105,110,
+    46,100,101,0,105,115,117,109,105,46,99,104,105,98,97,46,
+    106,112,0,105,116,46,97,111,0,105,116,46,99,111,109,0,
+    105,116,46,101,117,46,111,114,103,0,105,116,49,46,101,117,
+    114,46,97,114,117,98,97,46,106,101,110,118,45,97,114,117,
+    98,97,46,99,108,111,117,100,0,105,116,49,46,106,101,110,
+    118,45,97,114,117,98,97,46,99,108,111,117,100,0,105,116,
+    97,98,97,115,104,105,46,116,111,107,121,111,46,106,112,0,
+    105,116,97,107,111,46,105,98,97,114,97,107,105,46,106,112,
+    0,105,116,97,107,117,114,97,46,103,117,110,109,97,46,106,
+    112,0,105,116,97,109,105,46,104,121,111,103,111,46,106,112,
+    0,105,116,97,110,111,46,116,111,107,117,115,104,105,109,97,
+    46,106,112,0,105,116,97,117,0,105,116,97,121,97,110,97,
+    103,105,46,97,111,109,111,114,105,46,106,112,0,105,116,99,
+    111,117,108,100,98,101,119,111,114,46,115,101,0,105,116,105,
+    103,111,46,106,112,0,105,116,111,46,115,104,105,122,117,111,
+    107,97,46,106,112,0,105,116,111,105,103,97,119,97,46,110,
+    105,105,103,97,116,97,46,106,112,0,105,116,111,109,97,110,
+    46,111,107,105,110,97,119,97,46,106,112,0,105,116,115,46,
+    109,101,0,105,116,118,0,105,118,97,110,111,45,102,114,97,
+    110,107,105,118,115,107,46,117,97,0,105,118,97,110,111,118,
+    111,46,115,117,0,105,118,101,108,97,110,100,46,110,111,0,
+    105,118,103,117,46,110,111,0,105,119,97,100,101,46,119,97,
+    107,97,121,97,109,97,46,106,112,0,105,119,97,102,117,110,
+    101,46,116,111,99,104,105,103,105,46,106,112,0,105,119,97,
+    105,122,117,109,105,46,105,119,97,116,101,46,106,112,0,105,
+    119,97,107,105,46,102,117,107,117,115,104,105,109,97,46,106,
+    112,0,105,119,97,107,117,110,105,46,121,97,109,97,103,117,
+    99,104,105,46,106,112,0,105,119,97,107,117,114,97,46,97,
+    105,99,104,105,46,106,112,0,105,119,97,109,97,46,105,98,
+    97,114,97,107,105,46,106,112,0,105,119,97,109,105,122,97,
+    119,97,46,104,111,107,107,97,105,100,111,46,106,112,0,105,
+    119,97,110,97,105,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,105,119,97,110,117,109,97,46,109,105,121,97,103,105,
+    46,106,112,0,105,119,97,116,97,46,115,104,105,122,117,111,
+    107,97,46,106,112,0,105,119,97,116,101,46,105,119,97,116,
+    101,46,106,112,0,105,119,97,116,115,117,107,105,46,115,97,
+    105,116,97,109,97,46,106,112,0,105,119,105,46,110,122,0,
+    105,121,111,46,101,104,105,109,101,46,106,112,0,105,122,46,
+    104,114,0,105,122,101,110,97,46,111,107,105,110,97,119,97,
+    46,106,112,0,105,122,117,46,115,104,105,122,117,111,107,97,
+    46,106,112,0,105,122,117,109,105,46,107,97,103,111,115,104,
+    105,109,97,46,106,112,0,105,122,117,109,105,46,111,115,97,
+    107,97,46,106,112,0,105,122,117,109,105,111,116,115,117,46,
+    111,115,97,107,97,46,106,112,0,105,122,117,109,105,115,97,
+    110,111,46,111,115,97,107,97,46,106,112,0,105,122,117,109,
+    105,122,97,107,105,46,102,117,107,117,115,104,105,109,97,46,
+    106,112,0,105,122,117,109,111,46,115,104,105,109,97,110,101,
+    46,106,112,0,105,122,117,109,111,122,97,107,105,46,110,105,
+    105,103,97,116,97,46,106,112,0,105,122,117,110,111,107,117,
+    110,105,46,115,104,105,122,117,111,107,97,46,106,112,0,106,
+    46,98,103,0,106,46,108,97,121,101,114,115,104,105,102,116,
+    46,99,111,46,117,107,0,106,46,115,99,97,108,101,102,111,
+    114,99,101,46,99,111,109,46,99,121,0,106,46,115,99,97,
+    108,101,102,111,114,99,101,46,110,101,116,0,106,97,98,46,
+    98,114,0,106,97,103,117,97,114,0,106,97,109,98,121,108,
+    46,115,117,0,106,97,109,105,115,111,110,46,109,117,115,101,
+    117,109,0,106,97,109,112,97,46,98,114,0,106,97,118,97,
+    0,106,97,119,111,114,122,110,111,46,112,108,0,106,99,46,
+    110,101,101,110,46,105,116,0,106,99,98,0,106,99,108,111,
+    117,100,45,118,101,114,45,106,112,99,46,105,107,45,115,101,
+    114,118,101,114,46,99,111,109,0,106,99,108,111,117,100,46,
+    105,107,45,115,101,114,118,101,114,46,99,111,109,0,106,99,
+    108,111,117,100,46,107,122,0,106,100,101,118,99,108,111,117,
+    100,46,99,111,109,0,106,100,102,46,98,114,0,106,101,100,
+    46,119,97,102,97,105,99,108,111,117,100,46,99,111,109,0,
+    106,101,101,112,0,106,101,102,102,101,114,115,111,110,46,109,
+    117,115,101,117,109,0,106,101,106,117,46,107,114,0,106,101,
+    108,97,115,116,105,99,46,100,111,103,97,100,111,46,101,117,
+    0,106,101,108,97,115,116,105,99,46,114,101,103,114,117,104,
+    111,115,116,105,110,103,46,114,117,0,106,101,108,97,115,116,
+    105,99,46,115,97,118,101,105,110,99,108,111,117,100,46,110,
+    101,116,0,106,101,108,97,115,116,105,99,46,116,101,97,109,
+    0,106,101,108,97,115,116,105,99,46,116,115,117,107,97,101,
+    114,117,46,110,101,116,0,106,101,108,101,46,99,108,111,117,
+    100,0,106,101,108,101,46,99,108,117,98,0,106,101,108,101,
+    46,104,111,115,116,0,106,101,108,101,46,105,111,0,106,101,
+    108,101,46,115,105,116,101,0,106,101,108,101,110,105,97,45,
+    103,111,114,97,46,112,108,0,106,101,108,108,121,98,101,97,
+    110,46,106,112,0,106,101,111,110,98,117,107,46,107,114,0,
+    106,101,111,110,110,97,109,46,107,114,0,106,101,114,117,115,
+    97,108,101,109,46,109,117,115,101,117,109,0,106,101,115,115,
+    104,101,105,109,46,110,111,0,106,101,116,122,116,0,106,101,
+    118,110,97,107,101,114,46,110,111,0,106,101,119,101,108,114,
+    121,0,106,101,119,101,108,114,121,46,109,117,115,101,117,109,
+    0,106,101,119,105,115,104,46,109,117,115,101,117,109,0,106,
+    101,119,105,115,104,97,114,116,46,109,117,115,101,117,109,0,
+    106,102,107,46,109,117,115,101,117,109,0,106,103,111,114,97,
+    46,112,108,0,106,105,110,115,101,107,105,107,111,103,101,110,
+    46,104,105,114,111,115,104,105,109,97,46,106,112,0,106,105,
+    111,0,106,108,46,99,110,0,106,108,108,0,106,108,115,45,
+    115,116,111,49,46,101,108,97,115,116,120,46,110,101,116,0,
+    106,108,115,45,115,116,111,50,46,101,108,97,115,116,120,46,
+    110,101,116,0,106,108,115,45,115,116,111,51,46,101,108,97,
+    115,116,120,46,110,101,116,0,106,109,0,106,109,112,0,106,
+    110,106,0,106,111,98,111,106,105,46,105,119,97,116,101,46,
+    106,112,0,106,111,98,115,0,106,111,98,115,46,116,116,0,
+    106,111,98,117,114,103,0,106,111,101,116,115,117,46,110,105,
+    105,103,97,116,97,46,106,112,0,106,111,103,97,115,122,46,
+    104,117,0,106,111,104,97,110,97,46,116,111,121,97,109,97,
+    46,106,112,0,106,111,105,110,118,105,108,108,101,46,98,114,
+    0,106,111,108,115,116,101,114,46,110,111,0,106,111,110,100,
+    97,108,46,110,111,0,106,111,114,46,98,114,0,106,111,114,
+    112,101,108,97,110,100,46,110,111,0,106,111,115,111,46,105,
+    98,97,114,97,107,105,46,106,112,0,106,111,116,0,106,111,
+    116,101,108,117,108,117,46,99,108,111,117,100,0,106,111,117,
+    114,110,97,108,46,97,101,114,111,0,106,111,117,114,110,97,
+    108,105,115,109,46,109,117,115,101,117,109,0,106,111,117,114,
+    110,97,108,105,115,116,46,97,101,114,111,0,106,111,121,0,
+    106,111,121,111,46,107,121,111,116,111,46,106,112,0,106,111,
+    122,105,46,98,105,122,0,106,112,46,101,117,46,111,114,103,
+    0,106,112,46,107,103,0,106,112,46,109,100,0,106,112,46,
+    110,101,116,0,106,112,109,111,114,103,97,110,0,106,112,110,
+    46,99,111,109,0,106,112,114,115,0,106,115,46,99,110,0,
+    106,115,46,111,114,103,0,106,115,46,119,112,101,110,103,105,
+    110,101,112,111,119,101,114,101,100,46,99,111,109,0,106,117,
+    46,109,112,0,106,117,100,97,105,99,97,46,109,117,115,101,
+    117,109,0,106,117,100,121,103,97,114,108,97,110,100,46,109,
+    117,115,101,117,109,0,106,117,101,100,105,115,99,104,101,115,
+    46,109,117,115,101,117,109,0,106,117,101,103,111,115,0,106,
+    117,105,102,46,109,117,115,101,117,109,0,106,117,110,105,112,
+    101,114,0,106,117,114,46,112,114,111,0,106,117,115,46,98,
+    114,0,106,120,46,99,110,0,106,195,184,108,115,116,101,114,
+    46,110,111,0,106,195,184,114,112,101,108,97,110,100,46,110,
+    111,0,107,46,98,103,0,107,46,115,101,0,107,49,50,46,
+    97,107,46,117,115,0,107,49,50,46,97,108,46,117,115,0,
+    107,49,50,46,97,114,46,117,115,0,107,49,50,46,97,115,
+    46,117,115,0,107,49,50,46,97,122,46,117,115,0,107,49,
+    50,46,99,97,46,117,115,0,107,49,50,46,99,111,46,117,
+    115,0,107,49,50,46,99,116,46,117,115,0,107,49,50,46,
+    100,99,46,117,115,0,107,49,50,46,100,101,46,117,115,0,
+    107,49,50,46,101,99,0,107,49,50,46,102,108,46,117,115,
+    0,107,49,50,46,103,97,46,117,115,0,107,49,50,46,103,
+    117,46,117,115,0,107,49,50,46,105,97,46,117,115,0,107,
+    49,50,46,105,100,46,117,115,0,107,49,50,46,105,108,0,
+    107,49,50,46,105,108,46,117,115,0,107,49,50,46,105,110,
+    46,117,115,0,107,49,50,46,107,115,46,117,115,0,107,49,
+    50,46,107,121,46,117,115,0,107,49,50,46,108,97,46,117,
+    115,0,107,49,50,46,109,100,46,117,115,0,107,49,50,46,
+    109,101,46,117,115,0,107,49,50,46,109,105,46,117,115,0,
+    107,49,50,46,109,110,46,117,115,0,107,49,50,46,109,111,
+    46,117,115,0,107,49,50,46,109,115,46,117,115,0,107,49,
+    50,46,109,116,46,117,115,0,107,49,50,46,110,99,46,117,
+    115,0,107,49,50,46,110,101,46,117,115,0,107,49,50,46,
+    110,104,46,117,115,0,107,49,50,46,110,106,46,117,115,0,
+    107,49,50,46,110,109,46,117,115,0,107,49,50,46,110,118,
+    46,117,115,0,107,49,50,46,110,121,46,117,115,0,107,49,
+    50,46,111,104,46,117,115,0,107,49,50,46,111,107,46,117,
+    115,0,107,49,50,46,111,114,46,117,115,0,107,49,50,46,
+    112,97,46,117,115,0,107,49,50,46,112,114,46,117,115,0,
+    107,49,50,46,115,99,46,117,115,0,107,49,50,46,116,110,
+    46,117,115,0,107,49,50,46,116,114,0,107,49,50,46,116,
+    120,46,117,115,0,107,49,50,46,117,116,46,117,115,0,107,
+    49,50,46,118,97,46,117,115,0,107,49,50,46,118,105,0,
+    107,49,50,46,118,105,46,117,115,0,107,49,50,46,118,116,
+    46,117,115,0,107,49,50,46,119,97,46,117,115,0,107,49,
+    50,46,119,105,46,117,115,0,107,49,50,46,119,121,46,117,
+    115,0,107,56,115,46,115,99,119,46,99,108,111,117,100,0,
+    107,97,97,115,46,103,103,0,107,97,100,101,110,97,46,111,
+    107,105,110,97,119,97,46,106,112,0,107,97,100,111,103,97,
+    119,97,46,109,105,121,97,122,97,107,105,46,106,112,0,107,
+    97,100,111,109,97,46,111,115,97,107,97,46,106,112,0,107,
+    97,102,106,111,114,100,46,110,111,0,107,97,103,97,46,105,
+    115,104,105,107,97,119,97,46,106,112,0,107,97,103,97,109,
+    105,46,107,111,99,104,105,46,106,112,0,107,97,103,97,109,
+    105,105,115,104,105,46,102,117,107,117,115,104,105,109,97,46,
+    106,112,0,107,97,103,97,109,105,110,111,46,111,107,97,121,
+    97,109,97,46,106,112,0,107,97,103,111,115,104,105,109,97,
+    46,107,97,103,111,115,104,105,109,97,46,106,112,0,107,97,
+    104,111,46,102,117,107,117,111,107,97,46,106,112,0,107,97,
+    104,111,107,117,46,105,115,104,105,107,97,119,97,46,106,112,
+    0,107,97,104,111,107,117,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,107,97,105,46,121,97,109,97,110,97,115,104,
+    105,46,106,112,0,107,97,105,110,97,110,46,116,111,107,117,
+    115,104,105,109,97,46,106,112,0,107,97,105,110,97,110,46,
+    119,97,107,97,121,97,109,97,46,106,112,0,107,97,105,115,
+    101,105,46,107,97,110,97,103,97,119,97,46,106,112,0,107,
+    97,105,116,97,46,104,105,114,111,115,104,105,109,97,46,106,
+    112,0,107,97,105,122,117,107,97,46,111,115,97,107,97,46,
+    106,112,0,107,97,107,97,109,105,103,97,104,97,114,97,46,
+    103,105,102,117,46,106,112,0,107,97,107,101,103,97,119,97,
+    46,115,104,105,122,117,111,107,97,46,106,112,0,107,97,107,
+    105,110,111,107,105,46,115,104,105,109,97,110,101,46,106,112,
+    0,107,97,107,111,103,97,119,97,46,104,121,111,103,111,46,
+    106,112,0,107,97,107,117,100,97,46,109,105,121,97,103,105,
+    46,106,112,0,107,97,108,105,115,122,46,112,108,0,107,97,
+    108,109,121,107,105,97,46,114,117,0,107,97,108,109,121,107,
+    105,97,46,115,117,0,107,97,108,117,103,97,46,115,117,0,
+    107,97,109,97,103,97,121,97,46,99,104,105,98,97,46,106,
+    112,0,107,97,109,97,105,115,104,105,46,105,119,97,116,101,
+    46,106,112,0,107,97,109,97,107,117,114,97,46,107,97,110,
+    97,103,97,119,97,46,106,112,0,107,97,109,101,111,107,97,
+    46,107,121,111,116,111,46,106,112,0,107,97,109,101,121,97,
+    109,97,46,109,105,101,46,106,112,0,107,97,109,105,46,107,
+    111,99,104,105,46,106,112,0,107,97,109,105,46,109,105,121,
+    97,103,105,46,106,112,0,107,97,109,105,97,109,97,107,117,
+    115,97,46,107,117,109,97,109,111,116,111,46,106,112,0,107,
+    97,109,105,102,117,114,97,110,111,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,107,97,109,105,103,111,114,105,46,104,
+    121,111,103,111,46,106,112,0,107,97,109,105,105,99,104,105,
+    46,116,111,121,97,109,97,46,106,112,0,107,97,109,105,105,
+    122,117,109,105,46,115,97,105,116,97,109,97,46,106,112,0,
+    107,97,109,105,106,105,109,97,46,101,104,105,109,101,46,106,
+    112,0,107,97,109,105,107,97,119,97,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,107,97,109,105,107,97,119,97,46,
+    104,121,111,103,111,46,106,112,0,107,97,109,105,107,97,119,
+    97,46,115,97,105,116,97,109,97,46,106,112,0,107,97,109,
+    105,107,105,116,97,121,97,109,97,46,110,97,114,97,46,106,
+    112,0,107,97,109,105,107,111,97,110,105,46,97,107,105,116,
+    97,46,106,112,0,107,97,109,105,109,105,110,101,46,115,97,
+    103,97,46,106,112,0,107,97,109,105,110,111,107,97,119,97,
+    46,116,111,99,104,105,103,105,46,106,112,0,107,97,109,105,
+    110,111,121,97,109,97,46,121,97,109,97,103,97,116,97,46,
+    106,112,0,107,97,109,105,111,107,97,46,97,107,105,116,97,
+    46,106,112,0,107,97,109,105,115,97,116,111,46,115,97,105,
+    116,97,109,97,46,106,112,0,107,97,109,105,115,104,105,104,
+    111,114,111,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    107,97,109,105,115,117,46,105,98,97,114,97,107,105,46,106,
+    112,0,107,97,109,105,115,117,110,97,103,97,119,97,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,107,97,109,105,116,
+    111,110,100,97,46,119,97,107,97,121,97,109,97,46,106,112,
+    0,107,97,109,105,116,115,117,101,46,111,105,116,97,46,106,
+    112,0,107,97,109,111,46,107,121,111,116,111,46,106,112,0,
+    107,97,109,111,46,110,105,105,103,97,116,97,46,106,112,0,
+    107,97,109,111,101,110,97,105,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,107,97,109,111,103,97,119,97,46,99,104,
+    105,98,97,46,106,112,0,107,97,110,97,110,46,111,115,97,
+    107,97,46,106,112,0,107,97,110,97,122,97,119,97,46,105,
+    115,104,105,107,97,119,97,46,106,112,0,107,97,110,101,103,
+    97,115,97,107,105,46,105,119,97,116,101,46,106,112,0,107,
+    97,110,101,121,97,109,97,46,102,117,107,117,115,104,105,109,
+    97,46,106,112,0,107,97,110,101,121,97,109,97,46,121,97,
+    109,97,103,97,116,97,46,106,112,0,107,97,110,105,46,103,
+    105,102,117,46,106,112,0,107,97,110,105,101,46,97,105,99,
+    104,105,46,106,112,0,107,97,110,109,97,107,105,46,110,97,
+    114,97,46,106,112,0,107,97,110,110,97,46,103,117,110,109,
+    97,46,106,112,0,107,97,110,110,97,109,105,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,107,97,110,111,110,106,105,
+    46,107,97,103,97,119,97,46,106,112,0,107,97,110,111,121,
+    97,46,107,97,103,111,115,104,105,109,97,46,106,112,0,107,
+    97,110,114,97,46,103,117,110,109,97,46,106,112,0,107,97,
+    110,117,109,97,46,116,111,99,104,105,103,105,46,106,112,0,
+    107,97,110,122,97,107,105,46,115,97,103,97,46,106,112,0,
+    107,97,112,115,105,46,102,105,0,107,97,114,97,99,111,108,
+    46,115,117,0,107,97,114,97,103,97,110,100,97,46,115,117,
+    0,107,97,114,97,115,106,111,104,107,97,46,110,111,0,107,
+    97,114,97,115,106,111,107,46,110,111,0,107,97,114,97,115,
+    117,121,97,109,97,46,116,111,99,104,105,103,105,46,106,112,
+    0,107,97,114,97,116,101,46,109,117,115,101,117,109,0,107,
+    97,114,97,116,115,117,46,115,97,103,97,46,106,112,0,107,
+    97,114,101,108,105,97,46,115,117,0,107,97,114,105,107,97,
+    116,117,114,46,109,117,115,101,117,109,0,107,97,114,105,119,
+    97,46,110,105,105,103,97,116,97,46,106,112,0,107,97,114,
+    105,121,97,46,97,105,99,104,105,46,106,112,0,107,97,114,
+    108,115,111,121,46,110,111,0,107,97,114,109,111,121,46,110,
+    111,0,107,97,114,109,195,184,121,46,110,111,0,107,97,114,
+    112,97,99,122,46,112,108,0,107,97,114,116,117,122,121,46,
+    112,108,0,107,97,114,117,105,122,97,119,97,46,110,97,103,
+    97,110,111,46,106,112,0,107,97,114,117,109,97,105,46,105,
+    119,97,116,101,46,106,112,0,107,97,115,97,104,97,114,97,
+    46,103,105,102,117,46,106,112,0,107,97,115,97,105,46,104,
+    121,111,103,111,46,106,112,0,107,97,115,97,109,97,46,105,
+    98,97,114,97,107,105,46,106,112,0,107,97,115,97,109,97,
+    116,115,117,46,103,105,102,117,46,106,112,0,107,97,115,97,
+    111,107,97,46,111,107,97,121,97,109,97,46,106,112,0,107,
+    97,115,104,105,98,97,46,110,97,114,97,46,106,112,0,107,
+    97,115,104,105,104,97,114,97,46,110,97,114,97,46,106,112,
+    0,107,97,115,104,105,109,97,46,105,98,97,114,97,107,105,
+    46,106,112,0,107,97,115,104,105,109,97,46,115,97,103,97,
+    46,106,112,0,107,97,115,104,105,119,97,46,99,104,105,98,
+    97,46,106,112,0,107,97,115,104,105,119,97,114,97,46,111,
+    115,97,107,97,46,106,112,0,107,97,115,104,105,119,97,122,
+    97,107,105,46,110,105,105,103,97,116,97,46,106,112,0,107,
+    97,115,115,101,114,118,101,114,46,99,111,109,0,107,97,115,
+    117,103,97,46,102,117,107,117,111,107,97,46,106,112,0,107,
+    97,115,117,103,97,46,104,121,111,103,111,46,106,112,0,107,
+    97,115,117,103,97,105,46,97,105,99,104,105,46,106,112,0,
+    107,97,115,117,107,97,98,101,46,115,97,105,116,97,109,97,
+    46,106,112,0,107,97,115,117,109,105,103,97,117,114,97,46,
+    105,98,97,114,97,107,105,46,106,112,0,107,97,115,117,121,
+    97,46,102,117,107,117,111,107,97,46,106,112,0,107,97,115,
+    122,117,98,121,46,112,108,0,107,97,116,97,103,97,109,105,
+    46,97,107,105,116,97,46,106,112,0,107,97,116,97,110,111,
+    46,111,115,97,107,97,46,106,112,0,107,97,116,97,115,104,
+    105,110,97,46,103,117,110,109,97,46,106,112,0,107,97,116,
+    111,114,105,46,99,104,105,98,97,46,106,112,0,107,97,116,
+    111,119,105,99,101,46,112,108,0,107,97,116,115,117,114,97,
+    103,105,46,110,97,114,97,46,106,112,0,107,97,116,115,117,
+    114,97,103,105,46,119,97,107,97,121,97,109,97,46,106,112,
+    0,107,97,116,115,117,115,104,105,107,97,46,116,111,107,121,
+    111,46,106,112,0,107,97,116,115,117,117,114,97,46,99,104,
+    105,98,97,46,106,112,0,107,97,116,115,117,121,97,109,97,
+    46,102,117,107,117,105,46,106,112,0,107,97,117,102,101,110,
+    0,107,97,117,116,111,107,101,105,110,111,46,110,111,0,107,
+    97,119,97,98,97,46,103,117,110,109,97,46,106,112,0,107,
+    97,119,97,99,104,105,110,97,103,97,110,111,46,111,115,97,
+    107,97,46,106,112,0,107,97,119,97,103,111,101,46,109,105,
+    101,46,106,112,0,107,97,119,97,103,111,101,46,115,97,105,
+    116,97,109,97,46,106,112,0,107,97,119,97,103,117,99,104,
+    105,46,115,97,105,116,97,109,97,46,106,112,0,107,97,119,
+    97,104,97,114,97,46,116,111,116,116,111,114,105,46,106,112,
+    0,107,97,119,97,105,46,105,119,97,116,101,46,106,112,0,
+    107,97,119,97,105,46,110,97,114,97,46,106,112,0,107,97,
+    119,97,105,105,115,104,111,112,46,106,112,0,107,97,119,97,
+    106,105,109,97,46,115,97,105,116,97,109,97,46,106,112,0,
+    107,97,119,97,107,97,109,105,46,110,97,103,97,110,111,46,
+    106,112,0,107,97,119,97,107,97,109,105,46,110,97,114,97,
+    46,106,112,0,107,97,119,97,107,105,116,97,46,105,115,104,
+    105,107,97,119,97,46,106,112,0,107,97,119,97,109,97,116,
+    97,46,102,117,107,117,115,104,105,109,97,46,106,112,0,107,
+    97,119,97,109,105,110,97,109,105,46,109,105,121,97,122,97,
+    107,105,46,106,112,0,107,97,119,97,110,97,98,101,46,107,
+    97,103,111,115,104,105,109,97,46,106,112,0,107,97,119,97,
+    110,101,104,111,110,46,115,104,105,122,117,111,107,97,46,106,
+    112,0,107,97,119,97,110,105,115,104,105,46,104,121,111,103,
+    111,46,106,112,0,107,97,119,97,110,105,115,104,105,46,110,
+    97,114,97,46,106,112,0,107,97,119,97,110,105,115,104,105,
+    46,121,97,109,97,103,97,116,97,46,106,112,0,107,97,119,
+    97,114,97,46,102,117,107,117,111,107,97,46,106,112,0,107,
+    97,119,97,115,97,107,105,46,109,105,121,97,103,105,46,106,
+    112,0,107,97,119,97,116,97,110,97,46,110,97,103,97,115,
+    97,107,105,46,106,112,0,107,97,119,97,117,101,46,103,105,
+    102,117,46,106,112,0,107,97,119,97,122,117,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,107,97,121,97,98,101,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,107,97,122,105,
+    109,105,101,114,122,45,100,111,108,110,121,46,112,108,0,107,
+    97,122,111,46,115,97,105,116,97,109,97,46,106,112,0,107,
+    97,122,117,110,111,46,97,107,105,116,97,46,106,112,0,107,
+    100,100,105,0,107,101,105,115,101,110,46,102,117,107,117,111,
+    107,97,46,106,112,0,107,101,109,98,117,99,104,105,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,107,101,112,46,116,
+    114,0,107,101,112,110,111,46,112,108,0,107,101,114,114,121,
+    104,111,116,101,108,115,0,107,101,114,114,121,108,111,103,105,
+    115,116,105,99,115,0,107,101,114,114,121,112,114,111,112,101,
+    114,116,105,101,115,0,107,101,116,114,122,121,110,46,112,108,
+    0,107,101,121,109,97,99,104,105,110,101,46,100,101,0,107,
+    102,104,0,107,103,46,107,114,0,107,104,0,107,104,46,117,
+    97,0,107,104,97,107,97,115,115,105,97,46,115,117,0,107,
+    104,97,114,107,105,118,46,117,97,0,107,104,97,114,107,111,
+    118,46,117,97,0,107,104,101,114,115,111,110,46,117,97,0,
+    107,104,109,101,108,110,105,116,115,107,105,121,46,117,97,0,
+    107,104,109,101,108,110,121,116,115,107,121,105,46,117,97,0,
+    107,104,112,108,97,121,46,110,108,0,107,105,97,0,107,105,
+    98,105,99,104,117,111,46,111,107,97,121,97,109,97,46,106,
+    112,0,107,105,99,107,115,45,97,115,115,46,110,101,116,0,
+    107,105,99,107,115,45,97,115,115,46,111,114,103,0,107,105,
+    100,115,0,107,105,100,115,46,109,117,115,101,117,109,0,107,
+    105,100,115,46,117,115,0,107,105,101,118,46,117,97,0,107,
+    105,104,111,46,109,105,101,46,106,112,0,107,105,104,111,107,
+    117,46,101,104,105,109,101,46,106,112,0,107,105,106,111,46,
+    109,105,121,97,122,97,107,105,46,106,112,0,107,105,107,105,
+    114,97,114,97,46,106,112,0,107,105,107,111,110,97,105,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,107,105,107,117,
+    99,104,105,46,107,117,109,97,109,111,116,111,46,106,112,0,
+    107,105,107,117,103,97,119,97,46,115,104,105,122,117,111,107,
+    97,46,106,112,0,107,105,108,97,116,105,114,111,110,46,99,
+    111,109,0,107,105,108,108,46,106,112,0,107,105,108,111,46,
+    106,112,0,107,105,109,0,107,105,109,105,110,111,46,119,97,
+    107,97,121,97,109,97,46,106,112,0,107,105,109,105,116,115,
+    117,46,99,104,105,98,97,46,106,112,0,107,105,109,111,98,
+    101,116,115,117,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,107,105,110,46,111,107,105,110,97,119,97,46,106,112,0,
+    107,105,110,100,101,114,0,107,105,110,100,108,101,0,107,105,
+    110,103,104,111,115,116,46,110,101,116,0,107,105,110,107,111,
+    46,107,97,103,111,115,104,105,109,97,46,106,112,0,107,105,
+    110,111,107,97,119,97,46,119,97,107,97,121,97,109,97,46,
+    106,112,0,107,105,114,97,46,97,105,99,104,105,46,106,112,
+    0,107,105,114,107,101,110,101,115,46,110,111,0,107,105,114,
+    111,118,111,103,114,97,100,46,117,97,0,107,105,114,121,117,
+    46,103,117,110,109,97,46,106,112,0,107,105,115,97,114,97,
+    122,117,46,99,104,105,98,97,46,106,112,0,107,105,115,104,
+    105,119,97,100,97,46,111,115,97,107,97,46,106,112,0,107,
+    105,115,111,46,110,97,103,97,110,111,46,106,112,0,107,105,
+    115,111,102,117,107,117,115,104,105,109,97,46,110,97,103,97,
+    110,111,46,106,112,0,107,105,115,111,115,97,107,105,46,109,
+    105,101,46,106,112,0,107,105,116,97,46,107,121,111,116,111,
+    46,106,112,0,107,105,116,97,46,111,115,97,107,97,46,106,
+    112,0,107,105,116,97,46,116,111,107,121,111,46,106,112,0,
+    107,105,116,97,97,105,107,105,46,110,97,103,97,110,111,46,
+    106,112,0,107,105,116,97,97,107,105,116,97,46,97,107,105,
+    116,97,46,106,112,0,107,105,116,97,100,97,105,116,111,46,
+    111,107,105,110,97,119,97,46,106,112,0,107,105,116,97,103,
+    97,116,97,46,103,105,102,117,46,106,112,0,107,105,116,97,
+    103,97,116,97,46,115,97,103,97,46,106,112,0,107,105,116,
+    97,103,97,119,97,46,107,111,99,104,105,46,106,112,0,107,
+    105,116,97,103,97,119,97,46,109,105,121,97,122,97,107,105,
+    46,106,112,0,107,105,116,97,104,97,116,97,46,115,97,103,
+    97,46,106,112,0,107,105,116,97,104,105,114,111,115,104,105,
+    109,97,46,104,111,107,107,97,105,100,111,46,106,112,0,107,
+    105,116,97,107,97,109,105,46,105,119,97,116,101,46,106,112,
+    0,107,105,116,97,107,97,116,97,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,107,105,116,97,107,97,116,97,46,
+    109,105,121,97,122,97,107,105,46,106,112,0,107,105,116,97,
+    109,105,46,104,111,107,107,97,105,100,111,46,106,112,0,107,
+    105,116,97,109,111,116,111,46,115,97,105,116,97,109,97,46,
+    106,112,0,107,105,116,97,110,97,107,97,103,117,115,117,107,
+    117,46,111,107,105,110,97,119,97,46,106,112,0,107,105,116,
+    97,115,104,105,111,98,97,114,97,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,107,105,116,97,117,114,97,46,109,
+    105,121,97,122,97,107,105,46,106,112,0,107,105,116,97,121,
+    97,109,97,46,119,97,107,97,121,97,109,97,46,106,112,0,
+    107,105,116,99,104,101,110,0,107,105,119,97,46,109,105,101,
+    46,106,112,0,107,105,119,105,0,107,105,119,105,46,110,122,
+    0,107,105,121,97,109,97,46,115,97,103,97,46,106,112,0,
+    107,105,121,111,107,97,119,97,46,107,97,110,97,103,97,119,
+    97,46,106,112,0,107,105,121,111,115,97,116,111,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,107,105,121,111,115,101,
+    46,116,111,107,121,111,46,106,112,0,107,105,121,111,115,117,
+    46,97,105,99,104,105,46,106,112,0,107,105,122,117,46,107,
+    121,111,116,111,46,106,112,0,107,108,97,98,117,46,110,111,
+    0,107,108,101,112,112,46,110,111,0,107,108,111,100,122,107,
+    111,46,112,108,0,107,108,195,166,98,117,46,110,111,0,107,
+    109,46,117,97,0,107,109,112,115,112,46,103,111,118,46,112,
+    108,0,107,110,105,103,104,116,112,111,105,110,116,46,115,121,
+    115,116,101,109,115,0,107,110,111,119,115,105,116,97,108,108,
+    46,105,110,102,111,0,107,110,120,45,115,101,114,118,101,114,
+    46,110,101,116,0,107,111,98,97,121,97,115,104,105,46,109,
+    105,121,97,122,97,107,105,46,106,112,0,107,111,98,105,101,
+    114,122,121,99,101,46,112,108,0,107,111,99,104,105,46,107,
+    111,99,104,105,46,106,112,0,107,111,100,97,105,114,97,46,
+    116,111,107,121,111,46,106,112,0,107,111,101,98,101,110,104,
+    97,118,110,46,109,117,115,101,117,109,0,107,111,101,108,110,
+    0,107,111,101,108,110,46,109,117,115,101,117,109,0,107,111,
+    102,117,46,121,97,109,97,110,97,115,104,105,46,106,112,0,
+    107,111,103,97,46,102,117,107,117,111,107,97,46,106,112,0,
+    107,111,103,97,46,105,98,97,114,97,107,105,46,106,112,0,
+    107,111,103,97,110,101,105,46,116,111,107,121,111,46,106,112,
+    0,107,111,103,101,46,116,111,116,116,111,114,105,46,106,112,
+    0,107,111,107,97,46,115,104,105,103,97,46,106,112,0,107,
+    111,107,111,110,111,101,46,111,105,116,97,46,106,112,0,107,
+    111,107,117,98,117,110,106,105,46,116,111,107,121,111,46,106,
+    112,0,107,111,108,111,98,114,122,101,103,46,112,108,0,107,
+    111,109,97,101,46,116,111,107,121,111,46,106,112,0,107,111,
+    109,97,103,97,110,101,46,110,97,103,97,110,111,46,106,112,
+    0,107,111,109,97,107,105,46,97,105,99,104,105,46,106,112,
+    0,107,111,109,97,116,115,117,0,107,111,109,97,116,115,117,
+    46,105,115,104,105,107,97,119,97,46,106,112,0,107,111,109,
+    97,116,115,117,115,104,105,109,97,46,116,111,107,117,115,104,
+    105,109,97,46,106,112,0,107,111,109,102,111,114,98,46,115,
+    101,0,107,111,109,109,117,110,97,108,102,111,114,98,117,110,
+    100,46,115,101,0,107,111,109,109,117,110,101,46,110,111,0,
+    107,111,109,111,110,111,46,109,105,101,46,106,112,0,107,111,
+    109,111,114,111,46,110,97,103,97,110,111,46,106,112,0,107,
+    111,109,118,117,120,46,115,101,0,107,111,110,97,110,46,97,
+    105,99,104,105,46,106,112,0,107,111,110,97,110,46,115,104,
+    105,103,97,46,106,112,0,107,111,110,103,115,98,101,114,103,
+    46,110,111,0,107,111,110,103,115,118,105,110,103,101,114,46,
+    110,111,0,107,111,110,105,110,46,112,108,0,107,111,110,115,
+    107,111,119,111,108,97,46,112,108,0,107,111,110,115,117,108,
+    97,116,46,103,111,118,46,112,108,0,107,111,110,121,118,101,
+    108,111,46,104,117,0,107,111,111,98,105,110,46,101,118,101,
+    110,116,115,0,107,111,111,114,105,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,107,111,112,101,114,118,105,107,46,
+    110,111,0,107,111,114,105,121,97,109,97,46,102,117,107,117,
+    115,104,105,109,97,46,106,112,0,107,111,114,121,111,46,110,
+    97,114,97,46,106,112,0,107,111,115,97,105,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,107,111,115,97,107,97,46,
+    97,107,105,116,97,46,106,112,0,107,111,115,101,105,46,115,
+    104,105,103,97,46,106,112,0,107,111,115,104,101,114,0,107,
+    111,115,104,105,103,97,121,97,46,115,97,105,116,97,109,97,
+    46,106,112,0,107,111,115,104,105,109,105,122,117,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,107,111,115,104,117,46,
+    121,97,109,97,110,97,115,104,105,46,106,112,0,107,111,115,
+    117,103,101,46,121,97,109,97,110,97,115,104,105,46,106,112,
+    0,107,111,116,97,46,97,105,99,104,105,46,106,112,0,107,
+    111,116,111,46,115,104,105,103,97,46,106,112,0,107,111,116,
+    111,46,116,111,107,121,111,46,106,112,0,107,111,116,111,104,
+    105,114,97,46,107,97,103,97,119,97,46,106,112,0,107,111,
+    116,111,117,114,97,46,116,111,116,116,111,114,105,46,106,112,
+    0,107,111,117,104,111,107,117,46,115,97,103,97,46,106,112,
+    0,107,111,117,110,111,115,117,46,115,97,105,116,97,109,97,
+    46,106,112,0,107,111,117,121,97,109,97,46,107,97,103,111,
+    115,104,105,109,97,46,106,112,0,107,111,117,122,117,115,104,
+    105,109,97,46,116,111,107,121,111,46,106,112,0,107,111,121,
+    97,46,119,97,107,97,121,97,109,97,46,106,112,0,107,111,
+    122,97,46,119,97,107,97,121,97,109,97,46,106,112,0,107,
+    111,122,97,103,97,119,97,46,119,97,107,97,121,97,109,97,
+    46,106,112,0,107,111,122,97,107,105,46,99,104,105,98,97,
+    46,106,112,0,107,111,122,111,119,46,99,111,109,0,107,112,
+    109,103,0,107,112,110,0,107,112,112,115,112,46,103,111,118,
+    46,112,108,0,107,114,46,99,111,109,0,107,114,46,101,117,
+    46,111,114,103,0,107,114,46,105,116,0,107,114,46,117,97,
+    0,107,114,97,97,110,103,104,107,101,46,110,111,0,107,114,
+    97,103,101,114,111,46,110,111,0,107,114,97,103,101,114,195,
+    184,46,110,111,0,107,114,97,107,111,119,46,112,108,0,107,
+    114,97,115,110,105,107,46,112,108,0,107,114,97,115,110,111,
+    100,97,114,46,115,117,0,107,114,101,100,0,107,114,101,108,
+    108,105,97,110,46,110,101,116,0,107,114,105,115,116,105,97,
+    110,115,97,110,100,46,110,111,0,107,114,105,115,116,105,97,
+    110,115,117,110,100,46,110,111,0,107,114,111,100,115,104,101,
+    114,97,100,46,110,111,0,107,114,111,107,115,116,97,100,101,
+    108,118,97,46,110,111,0,107,114,121,109,46,117,97,0,107,
+    114,195,165,97,110,103,104,107,101,46,110,111,0,107,114,195,
+    184,100,115,104,101,114,97,100,46,110,111,0,107,115,46,117,
+    97,0,107,116,105,115,116,111,114,121,46,99,111,109,0,107,
+    117,99,104,105,110,111,116,115,117,46,110,97,103,97,115,97,
+    107,105,46,106,112,0,107,117,100,97,109,97,116,115,117,46,
+    121,97,109,97,103,117,99,104,105,46,106,112,0,107,117,100,
+    111,121,97,109,97,46,119,97,107,97,121,97,109,97,46,106,
+    112,0,107,117,105,46,104,105,114,111,115,104,105,109,97,46,
+    106,112,0,107,117,106,105,46,105,119,97,116,101,46,106,112,
+    0,107,117,106,117,46,111,105,116,97,46,106,112,0,107,117,
+    106,117,107,117,114,105,46,99,104,105,98,97,46,106,112,0,
+    107,117,107,105,46,115,97,105,116,97,109,97,46,106,112,0,
+    107,117,108,101,117,118,101,110,46,99,108,111,117,100,0,107,
+    117,109,97,103,97,121,97,46,115,97,105,116,97,109,97,46,
+    106,112,0,107,117,109,97,107,111,103,101,110,46,101,104,105,
+    109,101,46,106,112,0,107,117,109,97,109,111,116,111,46,107,
+    117,109,97,109,111,116,111,46,106,112,0,107,117,109,97,110,
+    111,46,104,105,114,111,115,104,105,109,97,46,106,112,0,107,
+    117,109,97,110,111,46,109,105,101,46,106,112,0,107,117,109,
+    97,116,111,114,105,46,111,115,97,107,97,46,106,112,0,107,
+    117,109,101,106,105,109,97,46,111,107,105,110,97,119,97,46,
+    106,112,0,107,117,109,101,110,97,110,46,111,107,97,121,97,
+    109,97,46,106,112,0,107,117,109,105,121,97,109,97,46,107,
+    121,111,116,111,46,106,112,0,107,117,110,100,101,110,46,111,
+    114,116,115,105,110,102,111,46,97,116,0,107,117,110,105,103,
+    97,109,105,46,111,107,105,110,97,119,97,46,106,112,0,107,
+    117,110,105,109,105,46,102,117,107,117,115,104,105,109,97,46,
+    106,112,0,107,117,110,105,115,97,107,105,46,111,105,116,97,
+    46,106,112,0,107,117,110,105,116,97,99,104,105,46,116,111,
+    107,121,111,46,106,112,0,107,117,110,105,116,111,109,105,46,
+    109,105,121,97,122,97,107,105,46,106,112,0,107,117,110,110,
+    101,112,112,117,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,107,117,110,111,104,101,46,105,119,97,116,101,46,106,112,
+    0,107,117,110,115,116,46,109,117,115,101,117,109,0,107,117,
+    110,115,116,115,97,109,109,108,117,110,103,46,109,117,115,101,
+    117,109,0,107,117,110,115,116,117,110,100,100,101,115,105,103,
+    110,46,109,117,115,101,117,109,0,107,117,111,107,103,114,111,
+    117,112,0,107,117,114,97,115,104,105,107,105,46,111,107,97,
+    121,97,109,97,46,106,112,0,107,117,114,97,116,101,46,102,
+    117,107,117,111,107,97,46,106,112,0,107,117,114,101,46,104,
+    105,114,111,115,104,105,109,97,46,106,112,0,107,117,114,103,
+    97,110,46,115,117,0,107,117,114,105,121,97,109,97,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,107,117,114,111,98,
+    101,46,116,111,121,97,109,97,46,106,112,0,107,117,114,111,
+    103,105,46,102,117,107,117,111,107,97,46,106,112,0,107,117,
+    114,111,105,115,104,105,46,97,111,109,111,114,105,46,106,112,
+    0,107,117,114,111,105,115,111,46,116,111,99,104,105,103,105,
+    46,106,112,0,107,117,114,111,109,97,116,115,117,110,97,105,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,107,117,114,
+    111,110,46,106,112,0,107,117,114,111,116,97,107,105,46,110,
+    97,114,97,46,106,112,0,107,117,114,117,109,101,46,102,117,
+    107,117,111,107,97,46,106,112,0,107,117,115,97,116,115,117,
+    46,103,117,110,109,97,46,106,112,0,107,117,115,97,116,115,
+    117,46,115,104,105,103,97,46,106,112,0,107,117,115,104,105,
+    109,97,46,109,105,121,97,122,97,107,105,46,106,112,0,107,
+    117,115,104,105,109,111,116,111,46,119,97,107,97,121,97,109,
+    97,46,106,112,0,107,117,115,104,105,114,111,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,107,117,115,116,97,110,97,
+    105,46,114,117,0,107,117,115,116,97,110,97,105,46,115,117,
+    0,107,117,115,117,46,111,105,116,97,46,106,112,0,107,117,
+    116,99,104,97,110,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,107,117,116,110,111,46,112,108,0,107,117,119,97,110,
+    97,46,109,105,101,46,106,112,0,107,117,122,117,109,97,107,
+    105,46,105,119,97,116,101,46,106,112,0,107,118,46,117,97,
+    0,107,118,97,102,106,111,114,100,46,110,111,0,107,118,97,
+    108,115,117,110,100,46,110,111,0,107,118,97,109,46,110,111,
+    0,107,118,97,110,97,110,103,101,110,46,110,111,0,107,118,
+    105,110,101,115,100,97,108,46,110,111,0,107,118,105,110,110,
+    104,101,114,97,100,46,110,111,0,107,118,105,116,101,115,101,
+    105,100,46,110,111,0,107,118,105,116,115,111,121,46,110,111,
+    0,107,118,105,116,115,195,184,121,46,110,111,0,107,118,195,
+    166,102,106,111,114,100,46,110,111,0,107,118,195,166,110,97,
+    110,103,101,110,46,110,111,0,107,119,112,46,103,111,118,46,
+    112,108,0,107,119,112,115,112,46,103,111,118,46,112,108,0,
+    107,121,105,118,46,117,97,0,107,121,111,110,97,110,46,99,
+    104,105,98,97,46,106,112,0,107,121,111,116,97,109,98,97,
+    46,107,121,111,116,111,46,106,112,0,107,121,111,116,97,110,
+    97,98,101,46,107,121,111,116,111,46,106,112,0,107,121,111,
+    116,97,110,103,111,46,107,121,111,116,111,46,106,112,0,107,
+    121,111,116,111,0,107,121,111,119,97,46,97,107,105,116,97,
+    46,106,112,0,107,121,111,119,97,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,107,121,117,114,97,103,105,46,115,97,
+    103,97,46,106,112,0,107,195,161,114,195,161,197,161,106,111,
+    104,107,97,46,110,111,0,107,195,165,102,106,111,114,100,46,
+    110,111,0,108,45,111,45,103,45,105,45,110,46,100,101,0,
+    108,46,98,103,0,108,46,115,101,0,108,97,45,115,112,101,
+    122,105,97,46,105,116,0,108,97,97,107,101,115,118,117,101,
+    109,105,101,46,110,111,0,108,97,98,46,109,115,0,108,97,
+    98,111,114,46,109,117,115,101,117,109,0,108,97,98,111,117,
+    114,46,109,117,115,101,117,109,0,108,97,99,97,105,120,97,
+    0,108,97,104,112,112,105,46,110,111,0,108,97,106,111,108,
+    108,97,46,109,117,115,101,117,109,0,108,97,107,97,115,46,
+    104,117,0,108,97,109,98,111,114,103,104,105,110,105,0,108,
+    97,109,101,114,0,108,97,110,98,105,98,46,115,101,0,108,
+    97,110,99,97,115,104,105,114,101,46,109,117,115,101,117,109,
+    0,108,97,110,99,97,115,116,101,114,0,108,97,110,99,105,
+    97,0,108,97,110,100,45,52,45,115,97,108,101,46,117,115,
+    0,108,97,110,100,101,115,46,109,117,115,101,117,109,0,108,
+    97,110,100,105,110,103,46,109,121,106,105,110,111,46,114,117,
+    0,108,97,110,100,114,111,118,101,114,0,108,97,110,103,101,
+    118,97,103,46,110,111,0,108,97,110,103,101,118,195,165,103,
+    46,110,111,0,108,97,110,115,46,109,117,115,101,117,109,0,
+    108,97,110,120,101,115,115,0,108,97,112,121,46,112,108,0,
+    108,97,113,117,105,108,97,46,105,116,0,108,97,114,100,97,
+    108,46,110,111,0,108,97,114,115,115,111,110,46,109,117,115,
+    101,117,109,0,108,97,114,118,105,107,46,110,111,0,108,97,
+    115,97,108,108,101,0,108,97,115,112,101,122,105,97,46,105,
+    116,0,108,97,116,0,108,97,116,105,110,97,46,105,116,0,
+    108,97,116,105,110,111,0,108,97,116,114,111,98,101,0,108,
+    97,118,97,103,105,115,46,110,111,0,108,97,118,97,110,103,
+    101,110,46,110,111,0,108,97,119,0,108,97,119,46,112,114,
+    111,0,108,97,119,46,122,97,0,108,97,119,121,101,114,0,
+    108,97,122,46,105,116,0,108,97,122,105,111,46,105,116,0,
+    108,99,46,105,116,0,108,99,108,46,100,101,118,0,108,99,
+    108,115,116,97,103,101,46,100,101,118,0,108,99,117,98,101,
+    45,115,101,114,118,101,114,46,100,101,0,108,100,115,0,108,
+    101,46,105,116,0,108,101,97,100,112,97,103,101,115,46,99,
+    111,0,108,101,97,110,103,97,118,105,105,107,97,46,110,111,
+    0,108,101,97,115,101,0,108,101,97,115,105,110,103,46,97,
+    101,114,111,0,108,101,97,197,139,103,97,118,105,105,107,97,
+    46,110,111,0,108,101,98,101,115,98,121,46,110,111,0,108,
+    101,98,111,114,107,46,112,108,0,108,101,98,116,105,109,110,
+    101,116,122,46,100,101,0,108,101,99,99,101,46,105,116,0,
+    108,101,99,99,111,46,105,116,0,108,101,99,108,101,114,99,
+    0,108,101,99,122,110,97,46,112,108,0,108,101,102,114,97,
+    107,0,108,101,103,97,108,0,108,101,103,110,105,99,97,46,
+    112,108,0,108,101,103,111,0,108,101,105,107,97,110,103,101,
+    114,46,110,111,0,108,101,105,114,102,106,111,114,100,46,110,
+    111,0,108,101,105,114,118,105,107,46,110,111,0,108,101,105,
+    116,117,110,103,115,101,110,46,100,101,0,108,101,107,97,46,
+    110,111,0,108,101,107,115,118,105,107,46,110,111,0,108,101,
+    108,46,98,114,0,108,101,108,117,120,46,115,105,116,101,0,
+    108,101,110,117,103,46,115,117,0,108,101,110,118,105,107,46,
+    110,111,0,108,101,114,100,97,108,46,110,111,0,108,101,115,
+    106,97,46,110,111,0,108,101,118,97,110,103,101,114,46,110,
+    111,0,108,101,119,105,115,109,105,108,108,101,114,46,109,117,
+    115,101,117,109,0,108,101,120,117,115,0,108,101,122,97,106,
+    115,107,46,112,108,0,108,103,46,106,112,0,108,103,46,117,
+    97,0,108,103,98,116,0,108,105,46,105,116,0,108,105,98,
+    46,97,107,46,117,115,0,108,105,98,46,97,108,46,117,115,
+    0,108,105,98,46,97,114,46,117,115,0,108,105,98,46,97,
+    115,46,117,115,0,108,105,98,46,97,122,46,117,115,0,108,
+    105,98,46,99,97,46,117,115,0,108,105,98,46,99,111,46,
+    117,115,0,108,105,98,46,99,116,46,117,115,0,108,105,98,
+    46,100,99,46,117,115,0,108,105,98,46,100,101,46,117,115,
+    0,108,105,98,46,101,101,0,108,105,98,46,102,108,46,117,
+    115,0,108,105,98,46,103,97,46,117,115,0,108,105,98,46,
+    103,117,46,117,115,0,108,105,98,46,104,105,46,117,115,0,
+    108,105,98,46,105,97,46,117,115,0,108,105,98,46,105,100,
+    46,117,115,0,108,105,98,46,105,108,46,117,115,0,108,105,
+    98,46,105,110,46,117,115,0,108,105,98,46,107,115,46,117,
+    115,0,108,105,98,46,107,121,46,117,115,0,108,105,98,46,
+    108,97,46,117,115,0,108,105,98,46,109,97,46,117,115,0,
+    108,105,98,46,109,100,46,117,115,0,108,105,98,46,109,101,
+    46,117,115,0,108,105,98,46,109,105,46,117,115,0,108,105,
+    98,46,109,110,46,117,115,0,108,105,98,46,109,111,46,117,
+    115,0,108,105,98,46,109,115,46,117,115,0,108,105,98,46,
+    109,116,46,117,115,0,108,105,98,46,110,99,46,117,115,0,
+    108,105,98,46,110,100,46,117,115,0,108,105,98,46,110,101,
+    46,117,115,0,108,105,98,46,110,104,46,117,115,0,108,105,
+    98,46,110,106,46,117,115,0,108,105,98,46,110,109,46,117,
+    115,0,108,105,98,46,110,118,46,117,115,0,108,105,98,46,
+    110,121,46,117,115,0,108,105,98,46,111,104,46,117,115,0,
+    108,105,98,46,111,107,46,117,115,0,108,105,98,46,111,114,
+    46,117,115,0,108,105,98,46,112,97,46,117,115,0,108,105,
+    98,46,112,114,46,117,115,0,108,105,98,46,114,105,46,117,
+    115,0,108,105,98,46,115,99,46,117,115,0,108,105,98,46,
+    115,100,46,117,115,0,108,105,98,46,116,110,46,117,115,0,
+    108,105,98,46,116,120,46,117,115,0,108,105,98,46,117,116,
+    46,117,115,0,108,105,98,46,118,97,46,117,115,0,108,105,
+    98,46,118,105,46,117,115,0,108,105,98,46,118,116,46,117,
+    115,0,108,105,98,46,119,97,46,117,115,0,108,105,98,46,
+    119,105,46,117,115,0,108,105,98,46,119,121,46,117,115,0,
+    108,105,100,108,0,108,105,101,114,46,110,111,0,108,105,101,
+    114,110,101,46,110,111,0,108,105,102,101,0,108,105,102,101,
+    105,110,115,117,114,97,110,99,101,0,108,105,102,101,115,116,
+    121,108,101,0,108,105,103,46,105,116,0,108,105,103,104,116,
+    105,110,103,0,108,105,103,117,114,105,97,46,105,116,0,108,
+    105,107,101,0,108,105,107,101,115,45,112,105,101,46,99,111,
+    109,0,108,105,107,101,115,99,97,110,100,121,46,99,111,109,
+    0,108,105,108,108,101,104,97,109,109,101,114,46,110,111,0,
+    108,105,108,108,101,115,97,110,100,46,110,111,0,108,105,108,
+    108,121,0,108,105,109,97,45,99,105,116,121,46,97,116,0,
+    108,105,109,97,45,99,105,116,121,46,99,104,0,108,105,109,
+    97,45,99,105,116,121,46,100,101,0,108,105,109,97,45,99,
+    105,116,121,46,114,111,99,107,115,0,108,105,109,97,46,122,
+    111,110,101,0,108,105,109,97,110,111,119,97,46,112,108,0,
+    108,105,109,105,116,101,100,0,108,105,109,111,0,108,105,110,
+    99,111,108,110,0,108,105,110,99,111,108,110,46,109,117,115,
+    101,117,109,0,108,105,110,100,97,115,46,110,111,0,108,105,
+    110,100,101,0,108,105,110,100,101,115,110,101,115,46,110,111,
+    0,108,105,110,100,195,165,115,46,110,111,0,108,105,110,107,
+    121,97,114,100,45,99,108,111,117,100,46,99,104,0,108,105,
+    110,107,121,97,114,100,46,99,108,111,117,100,0,108,105,110,
+    111,100,101,111,98,106,101,99,116,115,46,99,111,109,0,108,
+    105,110,122,46,109,117,115,101,117,109,0,108,105,112,115,121,
+    0,108,105,116,116,108,101,115,116,97,114,46,106,112,0,108,
+    105,118,105,110,103,0,108,105,118,105,110,103,46,109,117,115,
+    101,117,109,0,108,105,118,105,110,103,104,105,115,116,111,114,
+    121,46,109,117,115,101,117,109,0,108,105,118,111,114,110,111,
+    46,105,116,0,108,107,51,46,114,117,0,108,108,99,0,108,
+    108,112,0,108,110,46,99,110,0,108,111,46,105,116,0,108,
+    111,97,98,97,116,46,110,111,0,108,111,97,98,195,161,116,
+    46,110,111,0,108,111,97,110,0,108,111,97,110,115,0,108,
+    111,99,97,108,104,105,115,116,111,114,121,46,109,117,115,101,
+    117,109,0,108,111,99,97,108,104,111,115,116,46,100,97,112,
+    108,105,101,46,109,101,0,108,111,99,97,108,122,111,110,101,
+    46,120,121,122,0,108,111,99,107,101,114,0,108,111,99,117,
+    115,0,108,111,100,105,46,105,116,0,108,111,100,105,110,103,
+    101,110,46,110,111,0,108,111,103,46,98,114,0,108,111,103,
+    105,110,108,105,110,101,46,97,112,112,0,108,111,103,105,110,
+    108,105,110,101,46,100,101,118,0,108,111,103,105,110,108,105,
+    110,101,46,105,111,0,108,111,103,105,110,108,105,110,101,46,
+    115,101,114,118,105,99,101,115,0,108,111,103,105,110,108,105,
+    110,101,46,115,105,116,101,0,108,111,103,105,110,116,111,46,
+    109,101,0,108,111,103,105,115,116,105,99,115,46,97,101,114,
+    111,0,108,111,103,111,105,112,46,99,111,109,0,108,111,103,
+    111,105,112,46,100,101,0,108,111,104,109,117,115,46,109,101,
+    0,108,111,105,115,105,114,115,46,98,106,0,108,111,108,105,
+    112,111,112,46,105,111,0,108,111,108,105,112,111,112,109,99,
+    46,106,112,0,108,111,108,105,116,97,112,117,110,107,46,106,
+    112,0,108,111,109,46,105,116,0,108,111,109,46,110,111,0,
+    108,111,109,98,97,114,100,105,97,46,105,116,0,108,111,109,
+    98,97,114,100,121,46,105,116,0,108,111,109,111,46,106,112,
+    0,108,111,109,122,97,46,112,108,0,108,111,110,45,49,46,
+    112,97,97,115,46,109,97,115,115,105,118,101,103,114,105,100,
+    46,110,101,116,0,108,111,110,45,50,46,112,97,97,115,46,
+    109,97,115,115,105,118,101,103,114,105,100,46,110,101,116,0,
+    108,111,110,46,119,97,102,97,105,99,108,111,117,100,46,99,
+    111,109,0,108,111,110,100,111,110,0,108,111,110,100,111,110,
+    46,99,108,111,117,100,97,112,112,115,46,100,105,103,105,116,
+    97,108,0,108,111,110,100,111,110,46,109,117,115,101,117,109,
+    0,108,111,110,100,114,105,110,97,46,98,114,0,108,111,112,
+    112,97,46,110,111,0,108,111,114,101,110,115,107,111,103,46,
+    110,111,0,108,111,115,97,110,103,101,108,101,115,46,109,117,
+    115,101,117,109,0,108,111,115,101,121,111,117,114,105,112,46,
+    99,111,109,0,108,111,116,101,110,46,110,111,0,108,111,116,
+    116,101,0,108,111,116,116,111,0,108,111,117,118,114,101,46,
+    109,117,115,101,117,109,0,108,111,118,101,0,108,111,118,101,
+    112,111,112,46,106,112,0,108,111,118,101,115,105,99,107,46,
+    106,112,0,108,111,119,105,99,122,46,112,108,0,108,111,121,
+    97,108,105,115,116,46,109,117,115,101,117,109,0,108,112,97,
+    103,101,115,46,99,111,0,108,112,108,0,108,112,108,102,105,
+    110,97,110,99,105,97,108,0,108,112,117,115,101,114,99,111,
+    110,116,101,110,116,46,99,111,109,0,108,116,46,101,117,46,
+    111,114,103,0,108,116,46,105,116,0,108,116,46,117,97,0,
+    108,116,100,0,108,116,100,46,99,111,46,105,109,0,108,116,
+    100,46,99,121,0,108,116,100,46,103,105,0,108,116,100,46,
+    104,107,0,108,116,100,46,108,107,0,108,116,100,46,110,103,
+    0,108,116,100,46,117,97,0,108,116,100,46,117,107,0,108,
+    116,100,97,0,108,117,46,101,117,46,111,114,103,0,108,117,
+    46,105,116,0,108,117,98,97,114,116,111,119,46,112,108,0,
+    108,117,98,105,110,46,112,108,0,108,117,98,108,105,110,46,
+    112,108,0,108,117,99,97,110,105,97,46,105,116,0,108,117,
+    99,99,97,46,105,116,0,108,117,99,101,114,110,101,46,109,
+    117,115,101,117,109,0,108,117,103,46,111,114,103,46,117,107,
+    0,108,117,103,97,110,115,107,46,117,97,0,108,117,103,115,
+    46,111,114,103,46,117,107,0,108,117,107,111,119,46,112,108,
+    0,108,117,110,100,46,110,111,0,108,117,110,100,98,101,99,
+    107,0,108,117,110,110,101,114,46,110,111,0,108,117,114,111,
+    121,46,110,111,0,108,117,114,195,184,121,46,110,111,0,108,
+    117,115,116,101,114,46,110,111,0,108,117,116,115,107,46,117,
+    97,0,108,117,120,101,0,108,117,120,101,109,98,111,117,114,
+    103,46,109,117,115,101,117,109,0,108,117,120,117,114,121,0,
+    108,117,122,101,114,110,46,109,117,115,101,117,109,0,108,118,
+    46,101,117,46,111,114,103,0,108,118,46,117,97,0,108,118,
+    105,118,46,117,97,0,108,121,110,103,100,97,108,46,110,111,
+    0,108,121,110,103,101,110,46,110,111,0,108,121,110,120,46,
+    109,121,116,104,105,99,45,98,101,97,115,116,115,46,99,111,
+    109,0,108,195,161,104,112,112,105,46,110,111,0,108,195,164,
+    110,115,46,109,117,115,101,117,109,0,108,195,166,114,100,97,
+    108,46,110,111,0,108,195,184,100,105,110,103,101,110,46,110,
+    111,0,108,195,184,114,101,110,115,107,111,103,46,110,111,0,
+    108,195,184,116,101,110,46,110,111,0,109,46,98,103,0,109,
+    46,115,101,0,109,97,46,103,111,118,46,98,114,0,109,97,
+    46,108,101,103,46,98,114,0,109,97,99,97,112,97,46,98,
+    114,0,109,97,99,101,105,111,46,98,114,0,109,97,99,101,
+    114,97,116,97,46,105,116,0,109,97,99,104,105,100,97,46,
+    116,111,107,121,111,46,106,112,0,109,97,99,121,115,0,109,
+    97,100,46,109,117,115,101,117,109,0,109,97,100,114,105,100,
+    0,109,97,100,114,105,100,46,109,117,115,101,117,109,0,109,
+    97,101,98,97,115,104,105,46,103,117,110,109,97,46,106,112,
+    0,109,97,103,97,122,105,110,101,46,97,101,114,111,0,109,
+    97,103,101,110,116,111,115,105,116,101,46,99,108,111,117,100,
+    0,109,97,103,110,101,116,46,112,97,103,101,0,109,97,105,
+    98,97,114,97,46,115,104,105,103,97,46,106,112,0,109,97,
+    105,102,0,109,97,105,108,46,112,108,0,109,97,105,110,46,
+    106,112,0,109,97,105,110,116,101,110,97,110,99,101,46,97,
+    101,114,111,0,109,97,105,115,111,110,0,109,97,105,122,117,
+    114,117,46,107,121,111,116,111,46,106,112,0,109,97,107,101,
+    117,112,0,109,97,107,105,110,111,104,97,114,97,46,115,104,
+    105,122,117,111,107,97,46,106,112,0,109,97,107,117,114,97,
+    122,97,107,105,46,107,97,103,111,115,104,105,109,97,46,106,
+    112,0,109,97,108,97,116,118,117,111,112,109,105,46,110,111,
+    0,109,97,108,98,111,114,107,46,112,108,0,109,97,108,108,
+    111,114,99,97,46,109,117,115,101,117,109,0,109,97,108,111,
+    112,111,108,115,107,97,46,112,108,0,109,97,108,115,101,108,
+    118,46,110,111,0,109,97,108,118,105,107,46,110,111,0,109,
+    97,109,117,114,111,103,97,119,97,46,121,97,109,97,103,97,
+    116,97,46,106,112,0,109,97,110,0,109,97,110,97,117,115,
+    46,98,114,0,109,97,110,99,104,101,115,116,101,114,46,109,
+    117,115,101,117,109,0,109,97,110,100,97,108,46,110,111,0,
+    109,97,110,103,111,0,109,97,110,103,121,115,104,108,97,107,
+    46,115,117,0,109,97,110,105,119,97,46,111,107,97,121,97,
+    109,97,46,106,112,0,109,97,110,110,111,46,107,97,103,97,
+    119,97,46,106,112,0,109,97,110,115,105,111,110,46,109,117,
+    115,101,117,109,0,109,97,110,115,105,111,110,115,46,109,117,
+    115,101,117,109,0,109,97,110,116,111,118,97,46,105,116,0,
+    109,97,110,120,46,109,117,115,101,117,109,0,109,97,111,114,
+    105,46,110,122,0,109,97,112,0,109,97,112,46,102,97,115,
+    116,108,121,46,110,101,116,0,109,97,112,46,102,97,115,116,
+    108,121,108,98,46,110,101,116,0,109,97,114,46,105,116,0,
+    109,97,114,98,117,114,103,46,109,117,115,101,117,109,0,109,
+    97,114,99,104,101,46,105,116,0,109,97,114,105,110,101,46,
+    114,117,0,109,97,114,105,110,103,97,46,98,114,0,109,97,
+    114,105,116,105,109,101,46,109,117,115,101,117,109,0,109,97,
+    114,105,116,105,109,111,46,109,117,115,101,117,109,0,109,97,
+    114,107,101,114,46,110,111,0,109,97,114,107,101,116,0,109,
+    97,114,107,101,116,105,110,103,0,109,97,114,107,101,116,115,
+    0,109,97,114,110,97,114,100,97,108,46,110,111,0,109,97,
+    114,114,105,111,116,116,0,109,97,114,115,104,97,108,108,115,
+    0,109,97,114,117,103,97,109,101,46,107,97,103,97,119,97,
+    46,106,112,0,109,97,114,117,109,111,114,105,46,109,105,121,
+    97,103,105,46,106,112,0,109,97,114,121,108,97,110,100,46,
+    109,117,115,101,117,109,0,109,97,114,121,108,104,117,114,115,
+    116,46,109,117,115,101,117,109,0,109,97,115,97,107,105,46,
+    101,104,105,109,101,46,106,112,0,109,97,115,101,114,97,116,
+    105,0,109,97,115,102,106,111,114,100,101,110,46,110,111,0,
+    109,97,115,104,105,107,101,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,109,97,115,104,105,107,105,46,107,117,109,97,
+    109,111,116,111,46,106,112,0,109,97,115,104,105,107,111,46,
+    116,111,99,104,105,103,105,46,106,112,0,109,97,115,111,121,
+    46,110,111,0,109,97,115,115,97,45,99,97,114,114,97,114,
+    97,46,105,116,0,109,97,115,115,97,99,97,114,114,97,114,
+    97,46,105,116,0,109,97,115,117,100,97,46,115,104,105,109,
+    97,110,101,46,106,112,0,109,97,116,46,98,114,0,109,97,
+    116,101,114,97,46,105,116,0,109,97,116,115,117,98,97,114,
+    97,46,111,115,97,107,97,46,106,112,0,109,97,116,115,117,
+    98,117,115,104,105,46,115,97,105,116,97,109,97,46,106,112,
+    0,109,97,116,115,117,100,97,46,107,97,110,97,103,97,119,
+    97,46,106,112,0,109,97,116,115,117,100,111,46,99,104,105,
+    98,97,46,106,112,0,109,97,116,115,117,101,46,115,104,105,
+    109,97,110,101,46,106,112,0,109,97,116,115,117,107,97,119,
+    97,46,110,97,103,97,110,111,46,106,112,0,109,97,116,115,
+    117,109,97,101,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,109,97,116,115,117,109,111,116,111,46,107,97,103,111,115,
+    104,105,109,97,46,106,112,0,109,97,116,115,117,109,111,116,
+    111,46,110,97,103,97,110,111,46,106,112,0,109,97,116,115,
+    117,110,111,46,101,104,105,109,101,46,106,112,0,109,97,116,
+    115,117,115,97,107,97,46,109,105,101,46,106,112,0,109,97,
+    116,115,117,115,104,105,103,101,46,116,111,107,117,115,104,105,
+    109,97,46,106,112,0,109,97,116,115,117,115,104,105,109,97,
+    46,109,105,121,97,103,105,46,106,112,0,109,97,116,115,117,
+    117,114,97,46,110,97,103,97,115,97,107,105,46,106,112,0,
+    109,97,116,115,117,121,97,109,97,46,101,104,105,109,101,46,
+    106,112,0,109,97,116,115,117,122,97,107,105,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,109,97,116,116,97,45,118,
+    97,114,106,106,97,116,46,110,111,0,109,97,116,116,101,108,
+    0,109,97,121,102,105,114,115,116,46,105,110,102,111,0,109,
+    97,121,102,105,114,115,116,46,111,114,103,0,109,97,122,101,
+    112,108,97,121,46,99,111,109,0,109,97,122,111,119,115,122,
+    101,46,112,108,0,109,97,122,117,114,121,46,112,108,0,109,
+    98,46,99,97,0,109,98,46,105,116,0,109,98,97,0,109,
+    99,46,97,120,0,109,99,46,101,117,46,111,114,103,0,109,
+    99,46,105,116,0,109,99,100,105,114,46,109,101,0,109,99,
+    107,105,110,115,101,121,0,109,99,112,101,46,109,101,0,109,
+    99,112,114,101,46,114,117,0,109,100,46,99,105,0,109,101,
+    46,101,117,46,111,114,103,0,109,101,46,105,110,0,109,101,
+    46,105,116,0,109,101,46,107,101,0,109,101,46,115,111,0,
+    109,101,46,115,115,0,109,101,46,116,99,0,109,101,46,116,
+    122,0,109,101,46,117,107,0,109,101,46,118,117,0,109,101,
+    100,0,109,101,100,46,98,114,0,109,101,100,46,101,99,0,
+    109,101,100,46,101,101,0,109,101,100,46,104,116,0,109,101,
+    100,46,108,121,0,109,101,100,46,111,109,0,109,101,100,46,
+    112,97,0,109,101,100,46,112,108,0,109,101,100,46,112,114,
+    111,0,109,101,100,46,115,97,0,109,101,100,46,115,100,0,
+    109,101,100,101,99,105,110,46,102,114,0,109,101,100,101,99,
+    105,110,46,107,109,0,109,101,100,105,97,46,97,101,114,111,
+    0,109,101,100,105,97,46,104,117,0,109,101,100,105,97,46,
+    109,117,115,101,117,109,0,109,101,100,105,97,46,112,108,0,
+    109,101,100,105,97,116,101,99,104,46,98,121,0,109,101,100,
+    105,97,116,101,99,104,46,100,101,118,0,109,101,100,105,99,
+    97,108,46,109,117,115,101,117,109,0,109,101,100,105,99,105,
+    110,97,46,98,111,0,109,101,100,105,111,45,99,97,109,112,
+    105,100,97,110,111,46,105,116,0,109,101,100,105,111,99,97,
+    109,112,105,100,97,110,111,46,105,116,0,109,101,100,105,122,
+    105,110,104,105,115,116,111,114,105,115,99,104,101,115,46,109,
+    117,115,101,117,109,0,109,101,101,114,101,115,46,109,117,115,
+    101,117,109,0,109,101,101,116,0,109,101,103,117,114,111,46,
+    116,111,107,121,111,46,106,112,0,109,101,105,110,45,105,115,
+    101,114,118,46,100,101,0,109,101,105,110,45,118,105,103,111,
+    114,46,100,101,0,109,101,105,110,102,111,114,117,109,46,110,
+    101,116,0,109,101,105,119,97,46,103,117,110,109,97,46,106,
+    112,0,109,101,105,119,97,46,109,105,101,46,106,112,0,109,
+    101,108,46,99,108,111,117,100,108,101,116,115,46,99,111,109,
+    46,97,117,0,109,101,108,97,110,100,46,110,111,0,109,101,
+    108,98,111,117,114,110,101,0,109,101,108,100,97,108,46,110,
+    111,0,109,101,108,104,117,115,46,110,111,0,109,101,108,111,
+    121,46,110,111,0,109,101,108,195,184,121,46,110,111,0,109,
+    101,109,98,101,114,115,46,108,105,110,111,100,101,46,99,111,
+    109,0,109,101,109,101,0,109,101,109,111,114,105,97,108,0,
+    109,101,109,111,114,105,97,108,46,109,117,115,101,117,109,0,
+    109,101,109,115,101,116,46,110,101,116,0,109,101,110,0,109,
+    101,114,97,107,101,114,46,110,111,0,109,101,114,99,107,109,
+    115,100,0,109,101,114,115,101,105,110,101,46,110,117,0,109,
+    101,114,195,165,107,101,114,46,110,111,0,109,101,115,97,118,
+    101,114,100,101,46,109,117,115,101,117,109,0,109,101,115,115,
+    101,114,108,105,46,97,112,112,0,109,101,115,115,105,110,97,
+    46,105,116,0,109,101,115,115,119,105,116,104,100,110,115,46,
+    99,111,109,0,109,101,120,46,99,111,109,0,109,103,46,103,
+    111,118,46,98,114,0,109,103,46,108,101,103,46,98,114,0,
+    109,104,0,109,105,46,105,116,0,109,105,46,116,104,0,109,
+    105,97,109,105,0,109,105,97,115,97,46,110,97,103,97,110,
+    111,46,106,112,0,109,105,97,115,116,97,46,112,108,0,109,
+    105,98,117,46,116,111,99,104,105,103,105,46,106,112,0,109,
+    105,99,104,105,103,97,110,46,109,117,115,101,117,109,0,109,
+    105,99,114,111,108,105,103,104,116,46,97,101,114,111,0,109,
+    105,99,114,111,115,111,102,116,0,109,105,100,97,116,108,97,
+    110,116,105,99,46,109,117,115,101,117,109,0,109,105,100,111,
+    114,105,46,99,104,105,98,97,46,106,112,0,109,105,100,111,
+    114,105,46,103,117,110,109,97,46,106,112,0,109,105,100,115,
+    117,110,100,46,110,111,0,109,105,100,116,114,101,45,103,97,
+    117,108,100,97,108,46,110,111,0,109,105,101,108,101,99,46,
+    112,108,0,109,105,101,108,110,111,46,112,108,0,109,105,102,
+    117,110,101,46,107,117,109,97,109,111,116,111,46,106,112,0,
+    109,105,103,114,97,116,105,111,110,46,114,117,110,0,109,105,
+    104,97,109,97,46,97,105,99,104,105,46,106,112,0,109,105,
+    104,97,109,97,46,99,104,105,98,97,46,106,112,0,109,105,
+    104,97,109,97,46,102,117,107,117,105,46,106,112,0,109,105,
+    104,97,109,97,46,109,105,101,46,106,112,0,109,105,104,97,
+    109,97,46,119,97,107,97,121,97,109,97,46,106,112,0,109,
+    105,104,97,114,97,46,104,105,114,111,115,104,105,109,97,46,
+    106,112,0,109,105,104,97,114,97,46,107,111,99,104,105,46,
+    106,112,0,109,105,104,97,114,117,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,109,105,104,111,46,105,98,97,114,
+    97,107,105,46,106,112,0,109,105,107,97,115,97,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,109,105,107,97,119,97,
+    46,121,97,109,97,103,97,116,97,46,106,112,0,109,105,107,
+    105,46,104,121,111,103,111,46,106,112,0,109,105,108,0,109,
+    105,108,46,97,99,0,109,105,108,46,97,101,0,109,105,108,
+    46,97,108,0,109,105,108,46,97,114,0,109,105,108,46,97,
+    122,0,109,105,108,46,98,97,0,109,105,108,46,98,111,0,
+    109,105,108,46,98,114,0,109,105,108,46,98,121,0,109,105,
+    108,46,99,108,0,109,105,108,46,99,110,0,109,105,108,46,
+    99,111,0,109,105,108,46,99,121,0,109,105,108,46,100,111,
+    0,109,105,108,46,101,99,0,109,105,108,46,101,103,0,109,
+    105,108,46,102,106,0,109,105,108,46,103,101,0,109,105,108,
+    46,103,104,0,109,105,108,46,103,116,0,109,105,108,46,104,
+    110,0,109,105,108,46,105,100,0,109,105,108,46,105,110,0,
+    109,105,108,46,105,113,0,109,105,108,46,106,111,0,109,105,
+    108,46,107,103,0,109,105,108,46,107,109,0,109,105,108,46,
+    107,114,0,109,105,108,46,107,122,0,109,105,108,46,108,118,
+    0,109,105,108,46,109,103,0,109,105,108,46,109,118,0,109,
+    105,108,46,109,121,0,109,105,108,46,109,122,0,109,105,108,
+    46,110,103,0,109,105,108,46,110,105,0,109,105,108,46,110,
+    111,0,109,105,108,46,110,122,0,109,105,108,46,112,101,0,
+    109,105,108,46,112,104,0,109,105,108,46,112,108,0,109,105,
+    108,46,112,121,0,109,105,108,46,113,97,0,109,105,108,46,
+    114,117,0,109,105,108,46,114,119,0,109,105,108,46,115,104,
+    0,109,105,108,46,115,116,0,109,105,108,46,115,121,0,109,
+    105,108,46,116,106,0,109,105,108,46,116,109,0,109,105,108,
+    46,116,111,0,109,105,108,46,116,114,0,109,105,108,46,116,
+    119,0,109,105,108,46,116,122,0,109,105,108,46,117,121,0,
+    109,105,108,46,118,99,0,109,105,108,46,118,101,0,109,105,
+    108,46,121,101,0,109,105,108,46,122,97,0,109,105,108,46,
+    122,109,0,109,105,108,46,122,119,0,109,105,108,97,110,46,
+    105,116,0,109,105,108,97,110,111,46,105,116,0,109,105,108,
+    105,116,97,114,121,46,109,117,115,101,117,109,0,109,105,108,
+    108,46,109,117,115,101,117,109,0,109,105,109,97,46,116,111,
+    107,117,115,104,105,109,97,46,106,112,0,109,105,109,97,116,
+    97,46,109,105,121,97,122,97,107,105,46,106,112,0,109,105,
+    110,97,107,97,109,105,46,103,117,110,109,97,46,106,112,0,
+    109,105,110,97,109,97,116,97,46,107,117,109,97,109,111,116,
+    111,46,106,112,0,109,105,110,97,109,105,45,97,108,112,115,
+    46,121,97,109,97,110,97,115,104,105,46,106,112,0,109,105,
+    110,97,109,105,46,102,117,107,117,111,107,97,46,106,112,0,
+    109,105,110,97,109,105,46,107,121,111,116,111,46,106,112,0,
+    109,105,110,97,109,105,46,116,111,107,117,115,104,105,109,97,
+    46,106,112,0,109,105,110,97,109,105,97,105,107,105,46,110,
+    97,103,97,110,111,46,106,112,0,109,105,110,97,109,105,97,
+    115,104,105,103,97,114,97,46,107,97,110,97,103,97,119,97,
+    46,106,112,0,109,105,110,97,109,105,97,119,97,106,105,46,
+    104,121,111,103,111,46,106,112,0,109,105,110,97,109,105,98,
+    111,115,111,46,99,104,105,98,97,46,106,112,0,109,105,110,
+    97,109,105,100,97,105,116,111,46,111,107,105,110,97,119,97,
+    46,106,112,0,109,105,110,97,109,105,101,99,104,105,122,101,
+    110,46,102,117,107,117,105,46,106,112,0,109,105,110,97,109,
+    105,102,117,114,97,110,111,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,109,105,110,97,109,105,105,115,101,46,109,105,
+    101,46,106,112,0,109,105,110,97,109,105,105,122,117,46,115,
+    104,105,122,117,111,107,97,46,106,112,0,109,105,110,97,109,
+    105,109,97,107,105,46,110,97,103,97,110,111,46,106,112,0,
+    109,105,110,97,109,105,109,105,110,111,119,97,46,110,97,103,
+    97,110,111,46,106,112,0,109,105,110,97,109,105,111,103,117,
+    110,105,46,107,117,109,97,109,111,116,111,46,106,112,0,109,
+    105,110,97,109,105,115,97,110,114,105,107,117,46,109,105,121,
+    97,103,105,46,106,112,0,109,105,110,97,109,105,116,97,110,
+    101,46,107,97,103,111,115,104,105,109,97,46,106,112,0,109,
+    105,110,97,109,105,117,111,110,117,109,97,46,110,105,105,103,
+    97,116,97,46,106,112,0,109,105,110,97,109,105,121,97,109,
+    97,115,104,105,114,111,46,107,121,111,116,111,46,106,112,0,
+    109,105,110,97,110,111,46,115,97,105,116,97,109,97,46,106,
+    112,0,109,105,110,97,116,111,46,111,115,97,107,97,46,106,
+    112,0,109,105,110,97,116,111,46,116,111,107,121,111,46,106,
+    112,0,109,105,110,99,111,109,46,116,110,0,109,105,110,101,
+    46,110,117,0,109,105,110,101,114,115,46,109,117,115,101,117,
+    109,0,109,105,110,105,0,109,105,110,105,110,103,46,109,117,
+    115,101,117,109,0,109,105,110,105,115,101,114,118,101,114,46,
+    99,111,109,0,109,105,110,105,115,105,116,101,46,109,115,0,
+    109,105,110,110,101,115,111,116,97,46,109,117,115,101,117,109,
+    0,109,105,110,111,46,103,105,102,117,46,106,112,0,109,105,
+    110,111,98,117,46,121,97,109,97,110,97,115,104,105,46,106,
+    112,0,109,105,110,111,104,46,111,115,97,107,97,46,106,112,
+    0,109,105,110,111,107,97,109,111,46,103,105,102,117,46,106,
+    112,0,109,105,110,111,119,97,46,110,97,103,97,110,111,46,
+    106,112,0,109,105,110,116,0,109,105,110,116,101,114,101,46,
+    115,105,116,101,0,109,105,114,99,108,111,117,100,46,104,111,
+    115,116,0,109,105,114,99,108,111,117,100,46,114,117,0,109,
+    105,114,99,108,111,117,100,46,117,115,0,109,105,115,97,107,
+    105,46,111,107,97,121,97,109,97,46,106,112,0,109,105,115,
+    97,107,105,46,111,115,97,107,97,46,106,112,0,109,105,115,
+    97,115,97,46,116,111,116,116,111,114,105,46,106,112,0,109,
+    105,115,97,116,111,46,97,107,105,116,97,46,106,112,0,109,
+    105,115,97,116,111,46,109,105,121,97,103,105,46,106,112,0,
+    109,105,115,97,116,111,46,115,97,105,116,97,109,97,46,106,
+    112,0,109,105,115,97,116,111,46,115,104,105,109,97,110,101,
+    46,106,112,0,109,105,115,97,116,111,46,119,97,107,97,121,
+    97,109,97,46,106,112,0,109,105,115,97,119,97,46,97,111,
+    109,111,114,105,46,106,112,0,109,105,115,99,111,110,102,117,
+    115,101,100,46,111,114,103,0,109,105,115,104,105,109,97,46,
+    102,117,107,117,115,104,105,109,97,46,106,112,0,109,105,115,
+    104,105,109,97,46,115,104,105,122,117,111,107,97,46,106,112,
+    0,109,105,115,115,105,108,101,46,109,117,115,101,117,109,0,
+    109,105,115,115,111,117,108,97,46,109,117,115,101,117,109,0,
+    109,105,115,117,103,105,46,109,105,101,46,106,112,0,109,105,
+    116,0,109,105,116,97,107,97,46,116,111,107,121,111,46,106,
+    112,0,109,105,116,97,107,101,46,103,105,102,117,46,106,112,
+    0,109,105,116,97,110,101,46,97,107,105,116,97,46,106,112,
+    0,109,105,116,111,46,105,98,97,114,97,107,105,46,106,112,
+    0,109,105,116,111,117,46,121,97,109,97,103,117,99,104,105,
+    46,106,112,0,109,105,116,111,121,111,46,107,97,103,97,119,
+    97,46,106,112,0,109,105,116,115,117,98,105,115,104,105,0,
+    109,105,116,115,117,101,46,110,97,114,97,46,106,112,0,109,
+    105,116,115,117,107,101,46,110,105,105,103,97,116,97,46,106,
+    112,0,109,105,117,114,97,46,107,97,110,97,103,97,119,97,
+    46,106,112,0,109,105,121,97,100,97,46,110,97,103,97,110,
+    111,46,106,112,0,109,105,121,97,107,101,46,110,97,114,97,
+    46,106,112,0,109,105,121,97,107,111,46,102,117,107,117,111,
+    107,97,46,106,112,0,109,105,121,97,107,111,46,105,119,97,
+    116,101,46,106,112,0,109,105,121,97,107,111,110,111,106,111,
+    46,109,105,121,97,122,97,107,105,46,106,112,0,109,105,121,
+    97,109,97,46,102,117,107,117,111,107,97,46,106,112,0,109,
+    105,121,97,109,97,46,109,105,101,46,106,112,0,109,105,121,
+    97,115,104,105,114,111,46,115,97,105,116,97,109,97,46,106,
+    112,0,109,105,121,97,119,97,107,97,46,102,117,107,117,111,
+    107,97,46,106,112,0,109,105,121,97,122,97,107,105,46,109,
+    105,121,97,122,97,107,105,46,106,112,0,109,105,121,97,122,
+    117,46,107,121,111,116,111,46,106,112,0,109,105,121,111,115,
+    104,105,46,97,105,99,104,105,46,106,112,0,109,105,121,111,
+    115,104,105,46,104,105,114,111,115,104,105,109,97,46,106,112,
+    0,109,105,121,111,115,104,105,46,115,97,105,116,97,109,97,
+    46,106,112,0,109,105,121,111,115,104,105,46,116,111,107,117,
+    115,104,105,109,97,46,106,112,0,109,105,121,111,116,97,46,
+    110,97,103,97,110,111,46,106,112,0,109,105,122,117,104,111,
+    46,116,111,107,121,111,46,106,112,0,109,105,122,117,109,97,
+    107,105,46,102,117,107,117,111,107,97,46,106,112,0,109,105,
+    122,117,110,97,109,105,46,103,105,102,117,46,106,112,0,109,
+    105,122,117,115,97,119,97,46,105,119,97,116,101,46,106,112,
+    0,109,106,111,110,100,97,108,101,110,46,110,111,0,109,106,
+    195,184,110,100,97,108,101,110,46,110,111,0,109,107,46,101,
+    117,46,111,114,103,0,109,107,46,117,97,0,109,108,98,0,
+    109,108,98,102,97,110,46,111,114,103,0,109,108,115,0,109,
+    109,0,109,109,97,0,109,109,97,102,97,110,46,98,105,122,
+    0,109,110,46,105,116,0,109,111,45,105,45,114,97,110,97,
+    46,110,111,0,109,111,45,115,105,101,109,101,110,115,46,105,
+    111,0,109,111,46,99,110,0,109,111,46,105,116,0,109,111,
+    97,114,101,107,101,46,110,111,0,109,111,98,97,114,97,46,
+    99,104,105,98,97,46,106,112,0,109,111,98,105,46,103,112,
+    0,109,111,98,105,46,107,101,0,109,111,98,105,46,110,97,
+    0,109,111,98,105,46,110,103,0,109,111,98,105,46,116,116,
+    0,109,111,98,105,46,116,122,0,109,111,98,105,108,101,0,
+    109,111,99,104,105,122,117,107,105,46,110,97,103,97,110,111,
+    46,106,112,0,109,111,99,107,46,112,115,116,109,110,46,105,
+    111,0,109,111,100,46,103,105,0,109,111,100,97,0,109,111,
+    100,97,108,101,110,46,110,111,0,109,111,100,101,108,108,105,
+    110,103,46,97,101,114,111,0,109,111,100,101,110,97,46,105,
+    116,0,109,111,100,101,114,110,46,109,117,115,101,117,109,0,
+    109,111,100,115,46,106,112,0,109,111,100,117,109,46,110,111,
+    0,109,111,101,0,109,111,105,0,109,111,107,97,46,116,111,
+    99,104,105,103,105,46,106,112,0,109,111,108,46,105,116,0,
+    109,111,108,100,101,46,110,111,0,109,111,108,105,115,101,46,
+    105,116,0,109,111,109,0,109,111,109,97,46,109,117,115,101,
+    117,109,0,109,111,109,98,101,116,115,117,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,109,111,110,97,115,104,0,109,
+    111,110,100,46,106,112,0,109,111,110,101,121,0,109,111,110,
+    101,121,46,98,106,0,109,111,110,101,121,46,109,117,115,101,
+    117,109,0,109,111,110,103,111,108,105,97,110,46,106,112,0,
+    109,111,110,109,111,117,116,104,46,109,117,115,101,117,109,0,
+    109,111,110,115,116,101,114,0,109,111,110,116,105,99,101,108,
+    108,111,46,109,117,115,101,117,109,0,109,111,110,116,114,101,
+    97,108,46,109,117,115,101,117,109,0,109,111,110,122,97,45,
+    98,114,105,97,110,122,97,46,105,116,0,109,111,110,122,97,
+    45,101,45,100,101,108,108,97,45,98,114,105,97,110,122,97,
+    46,105,116,0,109,111,110,122,97,46,105,116,0,109,111,110,
+    122,97,98,114,105,97,110,122,97,46,105,116,0,109,111,110,
+    122,97,101,98,114,105,97,110,122,97,46,105,116,0,109,111,
+    110,122,97,101,100,101,108,108,97,98,114,105,97,110,122,97,
+    46,105,116,0,109,111,111,46,106,112,0,109,111,111,110,115,
+    99,97,108,101,46,105,111,0,109,111,111,110,115,99,97,108,
+    101,46,110,101,116,0,109,111,114,100,111,118,105,97,46,114,
+    117,0,109,111,114,100,111,118,105,97,46,115,117,0,109,111,
+    114,101,110,97,46,98,114,0,109,111,114,105,103,117,99,104,
+    105,46,111,115,97,107,97,46,106,112,0,109,111,114,105,109,
+    97,99,104,105,46,115,104,105,122,117,111,107,97,46,106,112,
+    0,109,111,114,105,111,107,97,46,105,119,97,116,101,46,106,
+    112,0,109,111,114,105,121,97,46,105,98,97,114,97,107,105,
+    46,106,112,0,109,111,114,105,121,97,109,97,46,115,104,105,
+    103,97,46,106,112,0,109,111,114,105,121,111,115,104,105,46,
+    97,107,105,116,97,46,106,112,0,109,111,114,109,111,110,0,
+    109,111,114,111,116,115,117,107,97,46,109,105,121,97,122,97,
+    107,105,46,106,112,0,109,111,114,111,121,97,109,97,46,115,
+    97,105,116,97,109,97,46,106,112,0,109,111,114,116,103,97,
+    103,101,0,109,111,115,99,111,119,0,109,111,115,99,111,119,
+    46,109,117,115,101,117,109,0,109,111,115,101,117,115,104,105,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,109,111,115,
+    106,111,101,110,46,110,111,0,109,111,115,106,195,184,101,110,
+    46,110,111,0,109,111,115,107,101,110,101,115,46,110,111,0,
+    109,111,115,115,46,110,111,0,109,111,115,118,105,107,46,110,
+    111,0,109,111,116,101,103,105,46,116,111,99,104,105,103,105,
+    46,106,112,0,109,111,116,111,0,109,111,116,111,98,117,46,
+    111,107,105,110,97,119,97,46,106,112,0,109,111,116,111,114,
+    99,121,99,108,101,46,109,117,115,101,117,109,0,109,111,116,
+    111,114,99,121,99,108,101,115,0,109,111,116,111,115,117,46,
+    103,105,102,117,46,106,112,0,109,111,116,111,121,97,109,97,
+    46,107,111,99,104,105,46,106,112,0,109,111,118,0,109,111,
+    118,105,101,0,109,111,118,105,109,105,101,110,116,111,46,98,
+    111,0,109,111,122,105,108,108,97,45,105,111,116,46,111,114,
+    103,0,109,111,195,165,114,101,107,101,46,110,111,0,109,112,
+    46,98,114,0,109,113,0,109,114,97,103,111,119,111,46,112,
+    108,0,109,115,46,103,111,118,46,98,114,0,109,115,46,105,
+    116,0,109,115,46,107,114,0,109,115,46,108,101,103,46,98,
+    114,0,109,115,100,0,109,115,107,46,114,117,0,109,115,107,
+    46,115,117,0,109,116,46,101,117,46,111,114,103,0,109,116,
+    46,103,111,118,46,98,114,0,109,116,46,105,116,0,109,116,
+    46,108,101,103,46,98,114,0,109,116,110,0,109,116,114,0,
+    109,117,101,110,99,104,101,110,46,109,117,115,101,117,109,0,
+    109,117,101,110,115,116,101,114,46,109,117,115,101,117,109,0,
+    109,117,103,105,46,116,111,107,117,115,104,105,109,97,46,106,
+    112,0,109,117,105,107,97,46,110,105,105,103,97,116,97,46,
+    106,112,0,109,117,107,97,119,97,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,109,117,107,111,46,107,121,111,116,111,
+    46,106,112,0,109,117,108,104,111,117,115,101,46,109,117,115,
+    101,117,109,0,109,117,110,97,107,97,116,97,46,102,117,107,
+    117,111,107,97,46,106,112,0,109,117,110,99,105,101,46,109,
+    117,115,101,117,109,0,109,117,110,105,46,105,108,0,109,117,
+    111,115,97,116,46,110,111,0,109,117,111,115,195,161,116,46,
+    110,111,0,109,117,112,46,103,111,118,46,112,108,0,109,117,
+    114,97,107,97,109,105,46,110,105,105,103,97,116,97,46,106,
+    112,0,109,117,114,97,116,97,46,109,105,121,97,103,105,46,
+    106,112,0,109,117,114,97,121,97,109,97,46,121,97,109,97,
+    103,97,116,97,46,106,112,0,109,117,114,109,97,110,115,107,
+    46,115,117,0,109,117,114,111,114,97,110,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,109,117,114,111,116,111,46,107,
+    111,99,104,105,46,106,112,0,109,117,115,46,98,114,0,109,
+    117,115,46,109,105,46,117,115,0,109,117,115,97,115,104,105,
+    109,117,114,97,121,97,109,97,46,116,111,107,121,111,46,106,
+    112,0,109,117,115,97,115,104,105,110,111,46,116,111,107,121,
+    111,46,106,112,0,109,117,115,101,101,116,46,109,117,115,101,
+    117,109,0,109,117,115,101,117,109,46,109,118,0,109,117,115,
+    101,117,109,46,109,119,0,109,117,115,101,117,109,46,110,111,
+    0,109,117,115,101,117,109,46,111,109,0,109,117,115,101,117,
+    109,46,116,116,0,109,117,115,101,117,109,99,101,110,116,101,
+    114,46,109,117,115,101,117,109,0,109,117,115,101,117,109,118,
+    101,114,101,110,105,103,105,110,103,46,109,117,115,101,117,109,
+    0,109,117,115,105,99,0,109,117,115,105,99,46,109,117,115,
+    101,117,109,0,109,117,115,105,99,97,46,97,114,0,109,117,
+    115,105,99,97,46,98,111,0,109,117,115,105,99,105,97,110,
+    46,105,111,0,109,117,116,115,117,46,97,111,109,111,114,105,
+    46,106,112,0,109,117,116,115,117,122,97,119,97,46,99,104,
+    105,98,97,46,106,112,0,109,117,116,117,97,108,0,109,117,
+    116,117,97,108,46,97,114,0,109,119,46,103,111,118,46,112,
+    108,0,109,120,46,110,97,0,109,121,45,102,105,114,101,119,
+    97,108,108,46,111,114,103,0,109,121,45,103,97,116,101,119,
+    97,121,46,100,101,0,109,121,45,114,111,117,116,101,114,46,
+    100,101,0,109,121,45,118,105,103,111,114,46,100,101,0,109,
+    121,45,119,97,110,46,100,101,0,109,121,46,101,117,46,111,
+    114,103,0,109,121,97,99,116,105,118,101,100,105,114,101,99,
+    116,111,114,121,46,99,111,109,0,109,121,97,109,97,122,101,
+    46,110,101,116,0,109,121,97,115,117,115,116,111,114,46,99,
+    111,109,0,109,121,99,100,46,101,117,0,109,121,99,108,111,
+    117,100,46,98,121,0,109,121,100,97,116,116,111,46,99,111,
+    109,0,109,121,100,97,116,116,111,46,110,101,116,0,109,121,
+    100,100,110,115,46,114,111,99,107,115,0,109,121,100,105,115,
+    115,101,110,116,46,110,101,116,0,109,121,100,111,98,105,115,
+    115,46,99,111,109,0,109,121,100,114,111,98,111,46,99,111,
+    109,0,109,121,100,115,46,109,101,0,109,121,101,102,102,101,
+    99,116,46,110,101,116,0,109,121,102,97,115,116,46,104,111,
+    115,116,0,109,121,102,97,115,116,46,115,112,97,99,101,0,
+    109,121,102,105,114,101,119,97,108,108,46,111,114,103,0,109,
+    121,102,111,114,117,109,46,99,111,109,109,117,110,105,116,121,
+    0,109,121,102,114,105,116,122,46,110,101,116,0,109,121,102,
+    116,112,46,98,105,122,0,109,121,102,116,112,46,111,114,103,
+    0,109,121,104,111,109,101,45,115,101,114,118,101,114,46,100,
+    101,0,109,121,105,112,104,111,115,116,46,99,111,109,0,109,
+    121,107,111,108,97,105,118,46,117,97,0,109,121,109,97,105,
+    108,101,114,46,99,111,109,46,116,119,0,109,121,109,101,100,
+    105,97,112,99,46,110,101,116,0,109,121,111,107,111,46,110,
+    105,105,103,97,116,97,46,106,112,0,109,121,112,101,112,46,
+    108,105,110,107,0,109,121,112,101,116,115,46,119,115,0,109,
+    121,112,104,111,116,111,115,46,99,99,0,109,121,112,105,46,
+    99,111,0,109,121,112,115,120,46,110,101,116,0,109,121,113,
+    110,97,112,99,108,111,117,100,46,99,111,109,0,109,121,115,
+    101,99,117,114,105,116,121,99,97,109,101,114,97,46,99,111,
+    109,0,109,121,115,101,99,117,114,105,116,121,99,97,109,101,
+    114,97,46,110,101,116,0,109,121,115,101,99,117,114,105,116,
+    121,99,97,109,101,114,97,46,111,114,103,0,109,121,115,104,
+    111,112,98,108,111,99,107,115,46,99,111,109,0,109,121,115,
+    104,111,112,105,102,121,46,99,111,109,0,109,121,115,112,114,
+    101,97,100,115,104,111,112,46,97,116,0,109,121,115,112,114,
+    101,97,100,115,104,111,112,46,98,101,0,109,121,115,112,114,
+    101,97,100,115,104,111,112,46,99,97,0,109,121,115,112,114,
+    101,97,100,115,104,111,112,46,99,104,0,109,121,115,112,114,
+    101,97,100,115,104,111,112,46,99,111,46,117,107,0,109,121,
+    115,112,114,101,97,100,115,104,111,112,46,99,111,109,0,109,
+    121,115,112,114,101,97,100,115,104,111,112,46,99,111,109,46,
+    97,117,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    100,101,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    100,107,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    101,115,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    102,105,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    102,114,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    105,101,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    105,116,0,109,121,115,112,114,101,97,100,115,104,111,112,46,
+    110,101,116,0,109,121,115,112,114,101,97,100,115,104,111,112,
+    46,110,108,0,109,121,115,112,114,101,97,100,115,104,111,112,
+    46,110,111,0,109,121,115,112,114,101,97,100,115,104,111,112,
+    46,112,108,0,109,121,115,112,114,101,97,100,115,104,111,112,
+    46,115,101,0,109,121,116,97,98,105,116,46,99,111,46,105,
+    108,0,109,121,116,97,98,105,116,46,99,111,109,0,109,121,
+    116,105,115,46,114,117,0,109,121,116,117,108,101,97,112,46,
+    99,111,109,0,109,121,118,110,99,46,99,111,109,0,109,121,
+    119,105,114,101,46,111,114,103,0,109,195,161,108,97,116,118,
+    117,111,112,109,105,46,110,111,0,109,195,161,116,116,97,45,
+    118,195,161,114,106,106,97,116,46,110,111,0,109,195,165,108,
+    115,101,108,118,46,110,111,0,109,195,165,115,195,184,121,46,
+    110,111,0,109,196,129,111,114,105,46,110,122,0,110,46,98,
+    103,0,110,46,115,101,0,110,52,116,46,99,111,0,110,97,
+    46,105,116,0,110,97,52,117,46,114,117,0,110,97,97,109,
+    101,115,106,101,118,117,101,109,105,101,46,110,111,0,110,97,
+    98,0,110,97,98,97,114,105,46,109,105,101,46,106,112,0,
+    110,97,99,104,105,107,97,116,115,117,117,114,97,46,119,97,
+    107,97,121,97,109,97,46,106,112,0,110,97,103,97,104,97,
+    109,97,46,115,104,105,103,97,46,106,112,0,110,97,103,97,
+    105,46,121,97,109,97,103,97,116,97,46,106,112,0,110,97,
+    103,97,110,111,46,110,97,103,97,110,111,46,106,112,0,110,
+    97,103,97,110,111,104,97,114,97,46,103,117,110,109,97,46,
+    106,112,0,110,97,103,97,111,107,97,46,110,105,105,103,97,
+    116,97,46,106,112,0,110,97,103,97,111,107,97,107,121,111,
+    46,107,121,111,116,111,46,106,112,0,110,97,103,97,114,97,
+    46,99,104,105,98,97,46,106,112,0,110,97,103,97,114,101,
+    121,97,109,97,46,99,104,105,98,97,46,106,112,0,110,97,
+    103,97,115,97,107,105,46,110,97,103,97,115,97,107,105,46,
+    106,112,0,110,97,103,97,115,117,46,107,117,109,97,109,111,
+    116,111,46,106,112,0,110,97,103,97,116,111,46,121,97,109,
+    97,103,117,99,104,105,46,106,112,0,110,97,103,97,116,111,
+    114,111,46,115,97,105,116,97,109,97,46,106,112,0,110,97,
+    103,97,119,97,46,110,97,103,97,110,111,46,106,112,0,110,
+    97,103,105,46,111,107,97,121,97,109,97,46,106,112,0,110,
+    97,103,105,115,111,46,110,97,103,97,110,111,46,106,112,0,
+    110,97,103,111,46,111,107,105,110,97,119,97,46,106,112,0,
+    110,97,103,111,121,97,0,110,97,104,97,46,111,107,105,110,
+    97,119,97,46,106,112,0,110,97,104,97,114,105,46,107,111,
+    99,104,105,46,106,112,0,110,97,105,101,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,110,97,107,97,46,104,105,114,
+    111,115,104,105,109,97,46,106,112,0,110,97,107,97,46,105,
+    98,97,114,97,107,105,46,106,112,0,110,97,107,97,100,111,
+    109,97,114,105,46,97,111,109,111,114,105,46,106,112,0,110,
+    97,107,97,103,97,119,97,46,102,117,107,117,111,107,97,46,
+    106,112,0,110,97,107,97,103,97,119,97,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,110,97,107,97,103,97,119,97,
+    46,110,97,103,97,110,111,46,106,112,0,110,97,107,97,103,
+    97,119,97,46,116,111,107,117,115,104,105,109,97,46,106,112,
+    0,110,97,107,97,103,117,115,117,107,117,46,111,107,105,110,
+    97,119,97,46,106,112,0,110,97,107,97,103,121,111,46,107,
+    121,111,116,111,46,106,112,0,110,97,107,97,105,46,107,97,
+    110,97,103,97,119,97,46,106,112,0,110,97,107,97,109,97,
+    46,102,117,107,117,111,107,97,46,106,112,0,110,97,107,97,
+    109,105,99,104,105,46,121,97,109,97,110,97,115,104,105,46,
+    106,112,0,110,97,107,97,109,117,114,97,46,107,111,99,104,
+    105,46,106,112,0,110,97,107,97,110,105,105,107,97,119,97,
+    46,116,111,121,97,109,97,46,106,112,0,110,97,107,97,110,
+    111,46,110,97,103,97,110,111,46,106,112,0,110,97,107,97,
+    110,111,46,116,111,107,121,111,46,106,112,0,110,97,107,97,
+    110,111,106,111,46,103,117,110,109,97,46,106,112,0,110,97,
+    107,97,110,111,116,111,46,105,115,104,105,107,97,119,97,46,
+    106,112,0,110,97,107,97,115,97,116,115,117,110,97,105,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,110,97,107,97,
+    116,97,110,101,46,107,97,103,111,115,104,105,109,97,46,106,
+    112,0,110,97,107,97,116,111,109,98,101,116,115,117,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,110,97,107,97,116,
+    115,117,103,97,119,97,46,103,105,102,117,46,106,112,0,110,
+    97,107,97,121,97,109,97,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,110,97,107,105,106,105,110,46,111,107,105,110,
+    97,119,97,46,106,112,0,110,97,107,108,111,46,112,108,0,
+    110,97,108,99,104,105,107,46,114,117,0,110,97,108,99,104,
+    105,107,46,115,117,0,110,97,109,97,115,116,101,46,106,112,
+    0,110,97,109,100,97,108,115,101,105,100,46,110,111,0,110,
+    97,109,101,46,97,122,0,110,97,109,101,46,101,103,0,110,
+    97,109,101,46,101,116,0,110,97,109,101,46,102,106,0,110,
+    97,109,101,46,104,114,0,110,97,109,101,46,106,111,0,110,
+    97,109,101,46,109,107,0,110,97,109,101,46,109,118,0,110,
+    97,109,101,46,109,121,0,110,97,109,101,46,110,97,0,110,
+    97,109,101,46,110,103,0,110,97,109,101,46,112,109,0,110,
+    97,109,101,46,112,114,0,110,97,109,101,46,113,97,0,110,
+    97,109,101,46,116,106,0,110,97,109,101,46,116,114,0,110,
+    97,109,101,46,116,116,0,110,97,109,101,46,118,110,0,110,
+    97,109,101,103,97,116,97,46,105,98,97,114,97,107,105,46,
+    106,112,0,110,97,109,101,103,97,119,97,46,115,97,105,116,
+    97,109,97,46,106,112,0,110,97,109,101,114,105,107,97,119,
+    97,46,116,111,121,97,109,97,46,106,112,0,110,97,109,105,
+    101,46,102,117,107,117,115,104,105,109,97,46,106,112,0,110,
+    97,109,105,107,97,116,97,46,101,104,105,109,101,46,106,112,
+    0,110,97,109,115,111,115,46,110,111,0,110,97,109,115,115,
+    107,111,103,97,110,46,110,111,0,110,97,110,97,101,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,110,97,110,97,111,
+    46,105,115,104,105,107,97,119,97,46,106,112,0,110,97,110,
+    98,117,46,116,111,116,116,111,114,105,46,106,112,0,110,97,
+    110,98,117,46,121,97,109,97,110,97,115,104,105,46,106,112,
+    0,110,97,110,103,111,46,102,117,107,117,115,104,105,109,97,
+    46,106,112,0,110,97,110,106,111,46,111,107,105,110,97,119,
+    97,46,106,112,0,110,97,110,107,111,107,117,46,107,111,99,
+    104,105,46,106,112,0,110,97,110,109,111,107,117,46,103,117,
+    110,109,97,46,106,112,0,110,97,110,110,101,115,116,97,100,
+    46,110,111,0,110,97,110,112,111,114,111,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,110,97,110,116,97,110,46,107,
+    121,111,116,111,46,106,112,0,110,97,110,116,111,46,116,111,
+    121,97,109,97,46,106,112,0,110,97,110,121,111,46,121,97,
+    109,97,103,97,116,97,46,106,112,0,110,97,111,115,104,105,
+    109,97,46,107,97,103,97,119,97,46,106,112,0,110,97,112,
+    108,101,115,46,105,116,0,110,97,112,111,108,105,46,105,116,
+    0,110,97,114,97,46,110,97,114,97,46,106,112,0,110,97,
+    114,97,115,104,105,110,111,46,99,104,105,98,97,46,106,112,
+    0,110,97,114,105,116,97,46,99,104,105,98,97,46,106,112,
+    0,110,97,114,111,121,46,110,111,0,110,97,114,117,115,97,
+    119,97,46,121,97,109,97,110,97,115,104,105,46,106,112,0,
+    110,97,114,117,116,111,46,116,111,107,117,115,104,105,109,97,
+    46,106,112,0,110,97,114,118,105,105,107,97,46,110,111,0,
+    110,97,114,118,105,107,46,110,111,0,110,97,115,117,46,116,
+    111,99,104,105,103,105,46,106,112,0,110,97,115,117,115,104,
+    105,111,98,97,114,97,46,116,111,99,104,105,103,105,46,106,
+    112,0,110,97,116,46,116,110,0,110,97,116,97,108,46,98,
+    114,0,110,97,116,105,111,110,97,108,46,109,117,115,101,117,
+    109,0,110,97,116,105,111,110,97,108,102,105,114,101,97,114,
+    109,115,46,109,117,115,101,117,109,0,110,97,116,105,111,110,
+    97,108,104,101,114,105,116,97,103,101,46,109,117,115,101,117,
+    109,0,110,97,116,105,118,101,97,109,101,114,105,99,97,110,
+    46,109,117,115,101,117,109,0,110,97,116,111,114,105,46,109,
+    105,121,97,103,105,46,106,112,0,110,97,116,117,114,97,0,
+    110,97,116,117,114,97,108,46,98,111,0,110,97,116,117,114,
+    97,108,104,105,115,116,111,114,121,46,109,117,115,101,117,109,
+    0,110,97,116,117,114,97,108,104,105,115,116,111,114,121,109,
+    117,115,101,117,109,46,109,117,115,101,117,109,0,110,97,116,
+    117,114,97,108,115,99,105,101,110,99,101,115,46,109,117,115,
+    101,117,109,0,110,97,116,117,114,98,114,117,107,115,103,121,
+    109,110,46,115,101,0,110,97,116,117,114,101,46,109,117,115,
+    101,117,109,0,110,97,116,117,114,104,105,115,116,111,114,105,
+    115,99,104,101,115,46,109,117,115,101,117,109,0,110,97,116,
+    117,117,114,119,101,116,101,110,115,99,104,97,112,112,101,110,
+    46,109,117,115,101,117,109,0,110,97,117,109,98,117,114,103,
+    46,109,117,115,101,117,109,0,110,97,117,115,116,100,97,108,
+    46,110,111,0,110,97,118,97,108,46,109,117,115,101,117,109,
+    0,110,97,118,105,103,97,116,105,111,110,46,97,101,114,111,
+    0,110,97,118,111,105,46,115,117,0,110,97,118,117,111,116,
+    110,97,46,110,111,0,110,97,118,121,0,110,97,121,111,114,
+    111,46,104,111,107,107,97,105,100,111,46,106,112,0,110,98,
+    46,99,97,0,110,98,97,0,110,101,0,110,101,46,107,101,
+    0,110,101,46,107,114,0,110,101,46,112,119,0,110,101,46,
+    116,122,0,110,101,46,117,103,0,110,101,97,116,45,117,114,
+    108,46,99,111,109,0,110,101,98,114,97,115,107,97,46,109,
+    117,115,101,117,109,0,110,101,99,0,110,101,100,114,101,45,
+    101,105,107,101,114,46,110,111,0,110,101,107,111,46,97,109,
+    0,110,101,109,117,114,111,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,110,101,114,100,112,111,108,46,111,118,104,0,
+    110,101,114,105,109,97,46,116,111,107,121,111,46,106,112,0,
+    110,101,115,46,97,107,101,114,115,104,117,115,46,110,111,0,
+    110,101,115,46,98,117,115,107,101,114,117,100,46,110,111,0,
+    110,101,115,110,97,46,110,111,0,110,101,115,111,100,100,101,
+    110,46,110,111,0,110,101,115,111,100,100,116,97,110,103,101,
+    110,46,110,111,0,110,101,115,115,101,98,121,46,110,111,0,
+    110,101,115,115,101,116,46,110,111,0,110,101,116,45,102,114,
+    101,97,107,115,46,99,111,109,0,110,101,116,46,97,99,0,
+    110,101,116,46,97,101,0,110,101,116,46,97,102,0,110,101,
+    116,46,97,103,0,110,101,116,46,97,105,0,110,101,116,46,
+    97,108,0,110,101,116,46,97,109,0,110,101,116,46,97,114,
+    0,110,101,116,46,97,117,0,110,101,116,46,97,122,0,110,
+    101,116,46,98,97,0,110,101,116,46,98,98,0,110,101,116,
+    46,98,104,0,110,101,116,46,98,106,0,110,101,116,46,98,
+    109,0,110,101,116,46,98,110,0,110,101,116,46,98,111,0,
+    110,101,116,46,98,114,0,110,101,116,46,98,115,0,110,101,
+    116,46,98,116,0,110,101,116,46,98,122,0,110,101,116,46,
+    99,105,0,110,101,116,46,99,109,0,110,101,116,46,99,110,
+    0,110,101,116,46,99,111,0,110,101,116,46,99,117,0,110,
+    101,116,46,99,119,0,110,101,116,46,99,121,0,110,101,116,
+    46,100,109,0,110,101,116,46,100,111,0,110,101,116,46,100,
+    122,0,110,101,116,46,101,99,0,110,101,116,46,101,103,0,
+    110,101,116,46,101,116,0,110,101,116,46,101,117,46,111,114,
+    103,0,110,101,116,46,102,106,0,110,101,116,46,102,109,0,
+    110,101,116,46,103,101,0,110,101,116,46,103,103,0,110,101,
+    116,46,103,108,0,110,101,116,46,103,110,0,110,101,116,46,
+    103,112,0,110,101,116,46,103,114,0,110,101,116,46,103,116,
+    0,110,101,116,46,103,117,0,110,101,116,46,103,121,0,110,
+    101,116,46,104,107,0,110,101,116,46,104,110,0,110,101,116,
+    46,104,116,0,110,101,116,46,105,100,0,110,101,116,46,105,
+    108,0,110,101,116,46,105,109,0,110,101,116,46,105,110,0,
+    110,101,116,46,105,113,0,110,101,116,46,105,114,0,110,101,
+    116,46,105,115,0,110,101,116,46,106,101,0,110,101,116,46,
+    106,111,0,110,101,116,46,107,103,0,110,101,116,46,107,105,
+    0,110,101,116,46,107,110,0,110,101,116,46,107,119,0,110,
+    101,116,46,107,121,0,110,101,116,46,107,122,0,110,101,116,
+    46,108,97,0,110,101,116,46,108,98,0,110,101,116,46,108,
+    99,0,110,101,116,46,108,107,0,110,101,116,46,108,114,0,
+    110,101,116,46,108,115,0,110,101,116,46,108,118,0,110,101,
+    116,46,108,121,0,110,101,116,46,109,97,0,110,101,116,46,
+    109,101,0,110,101,116,46,109,107,0,110,101,116,46,109,108,
+    0,110,101,116,46,109,111,0,110,101,116,46,109,115,0,110,
+    101,116,46,109,116,0,110,101,116,46,109,117,0,110,101,116,
+    46,109,118,0,110,101,116,46,109,119,0,110,101,116,46,109,
+    120,0,110,101,116,46,109,121,0,110,101,116,46,109,122,0,
+    110,101,116,46,110,102,0,110,101,116,46,110,103,0,110,101,
+    116,46,110,105,0,110,101,116,46,110,114,0,110,101,116,46,
+    110,122,0,110,101,116,46,111,109,0,110,101,116,46,112,97,
+    0,110,101,116,46,112,101,0,110,101,116,46,112,104,0,110,
+    101,116,46,112,107,0,110,101,116,46,112,108,0,110,101,116,
+    46,112,110,0,110,101,116,46,112,114,0,110,101,116,46,112,
+    115,0,110,101,116,46,112,116,0,110,101,116,46,112,121,0,
+    110,101,116,46,113,97,0,110,101,116,46,114,117,0,110,101,
+    116,46,114,119,0,110,101,116,46,115,97,0,110,101,116,46,
+    115,98,0,110,101,116,46,115,99,0,110,101,116,46,115,100,
+    0,110,101,116,46,115,103,0,110,101,116,46,115,104,0,110,
+    101,116,46,115,108,0,110,101,116,46,115,111,0,110,101,116,
+    46,115,115,0,110,101,116,46,115,116,0,110,101,116,46,115,
+    121,0,110,101,116,46,116,104,0,110,101,116,46,116,106,0,
+    110,101,116,46,116,109,0,110,101,116,46,116,110,0,110,101,
+    116,46,116,111,0,110,101,116,46,116,114,0,110,101,116,46,
+    116,116,0,110,101,116,46,116,119,0,110,101,116,46,117,97,
+    0,110,101,116,46,117,107,0,110,101,116,46,117,121,0,110,
+    101,116,46,117,122,0,110,101,116,46,118,99,0,110,101,116,
+    46,118,101,0,110,101,116,46,118,105,0,110,101,116,46,118,
+    110,0,110,101,116,46,118,117,0,110,101,116,46,119,115,0,
+    110,101,116,46,121,101,0,110,101,116,46,122,97,0,110,101,
+    116,46,122,109,0,110,101,116,98,97,110,107,0,110,101,116,
+    102,108,105,120,0,110,101,116,108,105,102,121,46,97,112,112,
+    0,110,101,117,101,115,46,109,117,115,101,117,109,0,110,101,
+    117,115,116,97,114,0,110,101,119,0,110,101,119,104,97,109,
+    112,115,104,105,114,101,46,109,117,115,101,117,109,0,110,101,
+    119,106,101,114,115,101,121,46,109,117,115,101,117,109,0,110,
+    101,119,109,101,120,105,99,111,46,109,117,115,101,117,109,0,
+    110,101,119,112,111,114,116,46,109,117,115,101,117,109,0,110,
+    101,119,115,46,104,117,0,110,101,119,115,112,97,112,101,114,
+    46,109,117,115,101,117,109,0,110,101,119,121,111,114,107,46,
+    109,117,115,101,117,109,0,110,101,120,116,0,110,101,120,116,
+    100,105,114,101,99,116,0,110,101,120,117,115,0,110,101,121,
+    97,103,97,119,97,46,111,115,97,107,97,46,106,112,0,110,
+    102,46,99,97,0,110,102,108,0,110,102,108,102,97,110,46,
+    111,114,103,0,110,102,115,104,111,115,116,46,99,111,109,0,
+    110,103,46,101,117,46,111,114,103,0,110,103,111,0,110,103,
+    111,46,108,107,0,110,103,111,46,110,103,0,110,103,111,46,
+    112,104,0,110,103,111,46,122,97,0,110,103,114,111,107,46,
+    105,111,0,110,104,45,115,101,114,118,46,99,111,46,117,107,
+    0,110,104,107,0,110,104,108,102,97,110,46,110,101,116,0,
+    110,104,115,46,117,107,0,110,105,99,46,105,110,0,110,105,
+    99,46,116,106,0,110,105,99,46,122,97,0,110,105,99,104,
+    105,110,97,110,46,109,105,121,97,122,97,107,105,46,106,112,
+    0,110,105,99,104,105,110,97,110,46,116,111,116,116,111,114,
+    105,46,106,112,0,110,105,99,111,0,110,105,100,46,105,111,
+    0,110,105,101,112,99,101,46,109,117,115,101,117,109,0,110,
+    105,101,114,117,99,104,111,109,111,115,99,105,46,112,108,0,
+    110,105,105,103,97,116,97,46,110,105,105,103,97,116,97,46,
+    106,112,0,110,105,105,104,97,109,97,46,101,104,105,109,101,
+    46,106,112,0,110,105,105,107,97,112,112,117,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,110,105,105,109,105,46,111,
+    107,97,121,97,109,97,46,106,112,0,110,105,105,122,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,110,105,107,97,104,
+    111,46,97,107,105,116,97,46,106,112,0,110,105,107,101,0,
+    110,105,107,105,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,110,105,107,105,116,97,46,106,112,0,110,105,107,107,111,
+    46,116,111,99,104,105,103,105,46,106,112,0,110,105,107,111,
+    108,97,101,118,46,117,97,0,110,105,107,111,110,0,110,105,
+    110,106,97,0,110,105,110,111,104,101,46,105,119,97,116,101,
+    46,106,112,0,110,105,110,111,109,105,121,97,46,107,97,110,
+    97,103,97,119,97,46,106,112,0,110,105,114,97,115,97,107,
+    105,46,121,97,109,97,110,97,115,104,105,46,106,112,0,110,
+    105,115,46,122,97,0,110,105,115,104,105,46,102,117,107,117,
+    111,107,97,46,106,112,0,110,105,115,104,105,46,111,115,97,
+    107,97,46,106,112,0,110,105,115,104,105,97,105,122,117,46,
+    102,117,107,117,115,104,105,109,97,46,106,112,0,110,105,115,
+    104,105,97,114,105,116,97,46,115,97,103,97,46,106,112,0,
+    110,105,115,104,105,97,119,97,107,117,114,97,46,111,107,97,
+    121,97,109,97,46,106,112,0,110,105,115,104,105,97,122,97,
+    105,46,115,104,105,103,97,46,106,112,0,110,105,115,104,105,
+    103,111,46,102,117,107,117,115,104,105,109,97,46,106,112,0,
+    110,105,115,104,105,104,97,114,97,46,107,117,109,97,109,111,
+    116,111,46,106,112,0,110,105,115,104,105,104,97,114,97,46,
+    111,107,105,110,97,119,97,46,106,112,0,110,105,115,104,105,
+    105,122,117,46,115,104,105,122,117,111,107,97,46,106,112,0,
+    110,105,115,104,105,107,97,116,97,46,116,111,99,104,105,103,
+    105,46,106,112,0,110,105,115,104,105,107,97,116,115,117,114,
+    97,46,121,97,109,97,110,97,115,104,105,46,106,112,0,110,
+    105,115,104,105,107,97,119,97,46,121,97,109,97,103,97,116,
+    97,46,106,112,0,110,105,115,104,105,109,101,114,97,46,109,
+    105,121,97,122,97,107,105,46,106,112,0,110,105,115,104,105,
+    110,111,109,105,121,97,46,104,121,111,103,111,46,106,112,0,
+    110,105,115,104,105,110,111,111,109,111,116,101,46,107,97,103,
+    111,115,104,105,109,97,46,106,112,0,110,105,115,104,105,110,
+    111,115,104,105,109,97,46,115,104,105,109,97,110,101,46,106,
+    112,0,110,105,115,104,105,111,46,97,105,99,104,105,46,106,
+    112,0,110,105,115,104,105,111,107,111,112,112,101,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,110,105,115,104,105,116,
+    111,115,97,46,107,111,99,104,105,46,106,112,0,110,105,115,
+    104,105,119,97,107,105,46,104,121,111,103,111,46,106,112,0,
+    110,105,115,115,97,110,0,110,105,115,115,97,121,0,110,105,
+    115,115,101,100,97,108,46,110,111,0,110,105,115,115,104,105,
+    110,46,97,105,99,104,105,46,106,112,0,110,105,116,101,114,
+    111,105,46,98,114,0,110,105,116,116,101,100,97,108,46,110,
+    111,0,110,105,121,111,100,111,103,97,119,97,46,107,111,99,
+    104,105,46,106,112,0,110,106,115,46,106,101,108,97,115,116,
+    105,99,46,118,112,115,45,104,111,115,116,46,110,101,116,0,
+    110,108,45,97,109,115,45,49,46,98,97,114,101,109,101,116,
+    97,108,46,115,99,119,46,99,108,111,117,100,0,110,108,46,
+    99,97,0,110,108,46,99,105,0,110,108,46,101,117,46,111,
+    114,103,0,110,109,46,99,110,0,110,111,45,105,112,46,98,
+    105,122,0,110,111,45,105,112,46,99,97,0,110,111,45,105,
+    112,46,99,111,46,117,107,0,110,111,45,105,112,46,105,110,
+    102,111,0,110,111,45,105,112,46,110,101,116,0,110,111,45,
+    105,112,46,111,114,103,0,110,111,46,99,111,109,0,110,111,
+    46,101,117,46,111,114,103,0,110,111,46,105,116,0,110,111,
+    98,101,111,107,97,46,109,105,121,97,122,97,107,105,46,106,
+    112,0,110,111,98,111,114,105,98,101,116,115,117,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,110,111,98,117,115,104,
+    105,46,106,112,0,110,111,100,97,46,99,104,105,98,97,46,
+    106,112,0,110,111,100,97,46,105,119,97,116,101,46,106,112,
+    0,110,111,100,101,98,97,108,97,110,99,101,114,46,108,105,
+    110,111,100,101,46,99,111,109,0,110,111,100,101,115,46,107,
+    56,115,46,102,114,45,112,97,114,46,115,99,119,46,99,108,
+    111,117,100,0,110,111,100,101,115,46,107,56,115,46,110,108,
+    45,97,109,115,46,115,99,119,46,99,108,111,117,100,0,110,
+    111,100,101,115,46,107,56,115,46,112,108,45,119,97,119,46,
+    115,99,119,46,99,108,111,117,100,0,110,111,103,46,99,111,
+    109,109,117,110,105,116,121,0,110,111,103,97,116,97,46,102,
+    117,107,117,111,107,97,46,106,112,0,110,111,103,105,46,116,
+    111,99,104,105,103,105,46,106,112,0,110,111,104,101,106,105,
+    46,97,111,109,111,114,105,46,106,112,0,110,111,104,111,46,
+    115,116,0,110,111,104,111,115,116,46,109,101,0,110,111,105,
+    112,46,109,101,0,110,111,105,112,46,117,115,0,110,111,107,
+    105,97,0,110,111,109,46,97,100,0,110,111,109,46,97,103,
+    0,110,111,109,46,98,114,0,110,111,109,46,99,111,0,110,
+    111,109,46,101,115,0,110,111,109,46,102,114,0,110,111,109,
+    46,107,109,0,110,111,109,46,109,103,0,110,111,109,46,110,
+    99,0,110,111,109,46,110,105,0,110,111,109,46,112,97,0,
+    110,111,109,46,112,101,0,110,111,109,46,112,108,0,110,111,
+    109,46,114,101,0,110,111,109,46,114,111,0,110,111,109,46,
+    116,109,0,110,111,109,46,118,101,0,110,111,109,46,122,97,
+    0,110,111,109,98,114,101,46,98,111,0,110,111,109,101,46,
+    99,118,0,110,111,109,101,46,112,116,0,110,111,109,105,46,
+    105,115,104,105,107,97,119,97,46,106,112,0,110,111,110,111,
+    105,99,104,105,46,105,115,104,105,107,97,119,97,46,106,112,
+    0,110,111,111,112,46,97,112,112,0,110,111,111,114,46,106,
+    112,0,110,111,114,100,45,97,117,114,100,97,108,46,110,111,
+    0,110,111,114,100,45,102,114,111,110,46,110,111,0,110,111,
+    114,100,45,111,100,97,108,46,110,111,0,110,111,114,100,100,
+    97,108,46,110,111,0,110,111,114,100,101,115,116,101,45,105,
+    100,99,46,115,97,118,101,105,110,99,108,111,117,100,46,110,
+    101,116,0,110,111,114,100,107,97,112,112,46,110,111,0,110,
+    111,114,100,114,101,45,108,97,110,100,46,110,111,0,110,111,
+    114,100,114,101,105,115,97,46,110,111,0,110,111,114,101,45,
+    111,103,45,117,118,100,97,108,46,110,111,0,110,111,114,102,
+    111,108,107,46,109,117,115,101,117,109,0,110,111,114,116,104,
+    45,107,97,122,97,107,104,115,116,97,110,46,115,117,0,110,
+    111,114,116,104,46,109,117,115,101,117,109,0,110,111,114,116,
+    104,102,108,97,110,107,46,97,112,112,0,110,111,114,116,104,
+    119,101,115,116,101,114,110,109,117,116,117,97,108,0,110,111,
+    114,116,111,110,0,110,111,115,101,46,111,115,97,107,97,46,
+    106,112,0,110,111,115,101,103,97,119,97,46,110,97,114,97,
+    46,106,112,0,110,111,115,104,105,114,111,46,97,107,105,116,
+    97,46,106,112,0,110,111,116,46,98,114,0,110,111,116,97,
+    105,114,101,115,46,102,114,0,110,111,116,97,105,114,101,115,
+    46,107,109,0,110,111,116,105,99,101,97,98,108,101,46,110,
+    101,119,115,0,110,111,116,105,99,105,97,115,46,98,111,0,
+    110,111,116,111,46,105,115,104,105,107,97,119,97,46,106,112,
+    0,110,111,116,111,100,100,101,110,46,110,111,0,110,111,116,
+    111,103,97,119,97,46,115,104,105,103,97,46,106,112,0,110,
+    111,116,116,101,114,111,121,46,110,111,0,110,111,118,46,114,
+    117,0,110,111,118,46,115,117,0,110,111,118,97,114,97,46,
+    105,116,0,110,111,118,101,99,111,114,101,46,115,105,116,101,
+    0,110,111,119,0,110,111,119,45,100,110,115,46,110,101,116,
+    0,110,111,119,45,100,110,115,46,111,114,103,0,110,111,119,
+    45,100,110,115,46,116,111,112,0,110,111,119,46,115,104,0,
+    110,111,119,97,114,117,100,97,46,112,108,0,110,111,119,114,
+    117,122,0,110,111,119,116,118,0,110,111,122,97,119,97,111,
+    110,115,101,110,46,110,97,103,97,110,111,46,106,112,0,110,
+    112,0,110,114,97,0,110,114,119,0,110,114,119,46,109,117,
+    115,101,117,109,0,110,115,46,99,97,0,110,115,110,46,117,
+    115,0,110,115,117,112,100,97,116,101,46,105,110,102,111,0,
+    110,115,119,46,97,117,0,110,116,46,97,117,0,110,116,46,
+    99,97,0,110,116,46,101,100,117,46,97,117,0,110,116,46,
+    114,111,0,110,116,100,108,108,46,116,111,112,0,110,116,114,
+    46,98,114,0,110,116,116,0,110,117,46,99,97,0,110,117,
+    46,105,116,0,110,117,109,97,116,97,46,103,117,110,109,97,
+    46,106,112,0,110,117,109,97,116,97,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,110,117,109,97,122,117,46,115,104,
+    105,122,117,111,107,97,46,106,112,0,110,117,111,114,111,46,
+    105,116,0,110,120,46,99,110,0,110,121,45,49,46,112,97,
+    97,115,46,109,97,115,115,105,118,101,103,114,105,100,46,110,
+    101,116,0,110,121,45,50,46,112,97,97,115,46,109,97,115,
+    115,105,118,101,103,114,105,100,46,110,101,116,0,110,121,97,
+    97,46,97,109,0,110,121,97,110,46,116,111,0,110,121,99,
+    0,110,121,99,46,109,110,0,110,121,99,46,109,117,115,101,
+    117,109,0,110,121,110,121,46,109,117,115,101,117,109,0,110,
+    121,115,97,46,112,108,0,110,121,117,122,101,110,46,116,111,
+    121,97,109,97,46,106,112,0,110,122,46,98,97,115,107,101,
+    116,98,97,108,108,0,110,122,46,101,117,46,111,114,103,0,
+    110,195,161,118,117,111,116,110,97,46,110,111,0,110,195,165,
+    195,165,109,101,115,106,101,118,117,101,109,105,101,46,110,111,
+    0,110,195,166,114,195,184,121,46,110,111,0,110,195,184,116,
+    116,101,114,195,184,121,46,110,111,0,111,46,98,103,0,111,
+    46,115,101,0,111,97,109,105,115,104,105,114,97,115,97,116,
+    111,46,99,104,105,98,97,46,106,112,0,111,97,114,97,105,
+    46,105,98,97,114,97,107,105,46,106,112,0,111,98,97,109,
+    97,46,102,117,107,117,105,46,106,112,0,111,98,97,109,97,
+    46,110,97,103,97,115,97,107,105,46,106,112,0,111,98,97,
+    110,97,122,97,119,97,46,121,97,109,97,103,97,116,97,46,
+    106,112,0,111,98,105,0,111,98,105,104,105,114,111,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,111,98,105,114,97,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,111,98,110,
+    105,110,115,107,46,115,117,0,111,98,115,101,114,118,101,114,
+    0,111,98,117,46,97,105,99,104,105,46,106,112,0,111,98,
+    117,115,101,46,110,97,103,97,110,111,46,106,112,0,111,99,
+    101,97,110,111,103,114,97,112,104,105,99,46,109,117,115,101,
+    117,109,0,111,99,101,97,110,111,103,114,97,112,104,105,113,
+    117,101,46,109,117,115,101,117,109,0,111,99,101,108,111,116,
+    46,109,121,116,104,105,99,45,98,101,97,115,116,115,46,99,
+    111,109,0,111,99,104,105,46,107,111,99,104,105,46,106,112,
+    0,111,99,105,46,99,117,115,116,111,109,101,114,45,111,99,
+    105,46,99,111,109,0,111,99,112,46,99,117,115,116,111,109,
+    101,114,45,111,99,105,46,99,111,109,0,111,99,115,46,99,
+    117,115,116,111,109,101,114,45,111,99,105,46,99,111,109,0,
+    111,100,46,117,97,0,111,100,97,116,101,46,97,107,105,116,
+    97,46,106,112,0,111,100,97,119,97,114,97,46,107,97,110,
+    97,103,97,119,97,46,106,112,0,111,100,100,97,46,110,111,
+    0,111,100,101,115,97,46,117,97,0,111,100,101,115,115,97,
+    46,117,97,0,111,100,111,46,98,114,0,111,101,46,121,97,
+    109,97,103,97,116,97,46,106,112,0,111,102,46,98,121,0,
+    111,102,46,106,101,0,111,102,102,46,97,105,0,111,102,102,
+    105,99,101,0,111,102,102,105,99,101,45,111,110,45,116,104,
+    101,46,110,101,116,0,111,102,102,105,99,105,97,108,46,97,
+    99,97,100,101,109,121,0,111,102,102,105,99,105,97,108,46,
+    101,99,0,111,102,117,110,97,116,111,46,105,119,97,116,101,
+    46,106,112,0,111,103,46,97,111,0,111,103,46,105,116,0,
+    111,103,97,46,97,107,105,116,97,46,106,112,0,111,103,97,
+    107,105,46,103,105,102,117,46,106,112,0,111,103,97,110,111,
+    46,115,97,105,116,97,109,97,46,106,112,0,111,103,97,115,
+    97,119,97,114,97,46,116,111,107,121,111,46,106,112,0,111,
+    103,97,116,97,46,97,107,105,116,97,46,106,112,0,111,103,
+    97,119,97,46,105,98,97,114,97,107,105,46,106,112,0,111,
+    103,97,119,97,46,110,97,103,97,110,111,46,106,112,0,111,
+    103,97,119,97,46,115,97,105,116,97,109,97,46,106,112,0,
+    111,103,97,119,97,114,97,46,109,105,121,97,103,105,46,106,
+    112,0,111,103,105,46,115,97,103,97,46,106,112,0,111,103,
+    105,109,105,46,111,107,105,110,97,119,97,46,106,112,0,111,
+    103,108,105,97,115,116,114,97,46,105,116,0,111,103,111,114,
+    105,46,102,117,107,117,111,107,97,46,106,112,0,111,103,111,
+    115,101,46,115,97,105,116,97,109,97,46,106,112,0,111,103,
+    117,99,104,105,46,97,105,99,104,105,46,106,112,0,111,103,
+    117,110,105,46,107,117,109,97,109,111,116,111,46,106,112,0,
+    111,103,117,110,105,46,121,97,109,97,103,97,116,97,46,106,
+    112,0,111,104,97,114,117,46,97,105,99,104,105,46,106,112,
+    0,111,104,100,97,46,115,104,105,109,97,110,101,46,106,112,
+    0,111,104,105,46,102,117,107,117,105,46,106,112,0,111,104,
+    105,114,97,46,109,105,121,97,103,105,46,106,112,0,111,104,
+    105,114,97,46,116,111,99,104,105,103,105,46,106,112,0,111,
+    104,107,117,114,97,46,121,97,109,97,103,97,116,97,46,106,
+    112,0,111,104,116,97,119,97,114,97,46,116,111,99,104,105,
+    103,105,46,106,112,0,111,105,46,107,97,110,97,103,97,119,
+    97,46,106,112,0,111,105,114,97,115,101,46,97,111,109,111,
+    114,105,46,106,112,0,111,105,114,109,46,103,111,118,46,112,
+    108,0,111,105,115,104,105,100,97,46,121,97,109,97,103,97,
+    116,97,46,106,112,0,111,105,115,111,46,107,97,110,97,103,
+    97,119,97,46,106,112,0,111,105,116,97,46,111,105,116,97,
+    46,106,112,0,111,105,122,117,109,105,46,103,117,110,109,97,
+    46,106,112,0,111,106,105,46,110,97,114,97,46,106,112,0,
+    111,106,105,121,97,46,110,105,105,103,97,116,97,46,106,112,
+    0,111,107,97,103,97,107,105,46,102,117,107,117,111,107,97,
+    46,106,112,0,111,107,97,119,97,46,102,117,107,117,111,107,
+    97,46,106,112,0,111,107,97,119,97,46,107,111,99,104,105,
+    46,106,112,0,111,107,97,121,97,46,110,97,103,97,110,111,
+    46,106,112,0,111,107,97,121,97,109,97,46,111,107,97,121,
+    97,109,97,46,106,112,0,111,107,97,122,97,107,105,46,97,
+    105,99,104,105,46,106,112,0,111,107,101,103,97,119,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,111,107,101,116,111,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,111,107,105,
+    46,102,117,107,117,111,107,97,46,106,112,0,111,107,105,110,
+    97,119,97,0,111,107,105,110,97,119,97,46,111,107,105,110,
+    97,119,97,46,106,112,0,111,107,105,110,111,115,104,105,109,
+    97,46,115,104,105,109,97,110,101,46,106,112,0,111,107,111,
+    112,112,101,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    111,107,115,110,101,115,46,110,111,0,111,107,117,105,122,117,
+    109,111,46,115,104,105,109,97,110,101,46,106,112,0,111,107,
+    117,109,97,46,102,117,107,117,115,104,105,109,97,46,106,112,
+    0,111,107,117,116,97,109,97,46,116,111,107,121,111,46,106,
+    112,0,111,108,97,119,97,46,112,108,0,111,108,97,121,97,
+    110,0,111,108,97,121,97,110,103,114,111,117,112,0,111,108,
+    98,105,97,45,116,101,109,112,105,111,46,105,116,0,111,108,
+    98,105,97,116,101,109,112,105,111,46,105,116,0,111,108,100,
+    110,97,118,121,0,111,108,101,99,107,111,46,112,108,0,111,
+    108,107,117,115,122,46,112,108,0,111,108,108,111,0,111,108,
+    115,122,116,121,110,46,112,108,0,111,109,97,99,104,105,46,
+    110,97,103,97,110,111,46,106,112,0,111,109,97,99,104,105,
+    46,115,97,103,97,46,106,112,0,111,109,97,101,122,97,107,
+    105,46,115,104,105,122,117,111,107,97,46,106,112,0,111,109,
+    97,104,97,46,109,117,115,101,117,109,0,111,109,97,115,118,
+    117,111,116,110,97,46,110,111,0,111,109,101,46,116,111,107,
+    121,111,46,106,112,0,111,109,101,103,97,0,111,109,103,46,
+    108,111,108,0,111,109,105,46,110,97,103,97,110,111,46,106,
+    112,0,111,109,105,46,110,105,105,103,97,116,97,46,106,112,
+    0,111,109,105,103,97,119,97,46,99,104,105,98,97,46,106,
+    112,0,111,109,105,104,97,99,104,105,109,97,110,46,115,104,
+    105,103,97,46,106,112,0,111,109,105,116,97,109,97,46,105,
+    98,97,114,97,107,105,46,106,112,0,111,109,105,121,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,111,109,110,105,119,
+    101,46,115,105,116,101,0,111,109,111,116,101,103,111,46,102,
+    117,107,117,115,104,105,109,97,46,106,112,0,111,109,117,114,
+    97,46,110,97,103,97,115,97,107,105,46,106,112,0,111,109,
+    117,116,97,46,102,117,107,117,111,107,97,46,106,112,0,111,
+    110,45,97,99,111,114,110,46,105,111,0,111,110,45,97,112,
+    116,105,98,108,101,46,99,111,109,0,111,110,45,107,51,115,
+    46,105,111,0,111,110,45,114,97,110,99,104,101,114,46,99,
+    108,111,117,100,0,111,110,45,114,105,111,46,105,111,0,111,
+    110,45,116,104,101,45,119,101,98,46,116,118,0,111,110,45,
+    119,101,98,46,102,114,0,111,110,46,99,97,0,111,110,97,
+    103,97,119,97,46,109,105,121,97,103,105,46,106,112,0,111,
+    110,97,118,115,116,97,99,107,46,110,101,116,0,111,110,99,
+    105,108,108,97,46,109,121,116,104,105,99,45,98,101,97,115,
+    116,115,46,99,111,109,0,111,110,100,105,103,105,116,97,108,
+    111,99,101,97,110,46,97,112,112,0,111,110,102,97,98,114,
+    105,99,97,46,99,111,109,0,111,110,102,108,97,115,104,100,
+    114,105,118,101,46,97,112,112,0,111,110,103,0,111,110,103,
+    46,98,114,0,111,110,103,97,46,102,117,107,117,111,107,97,
+    46,106,112,0,111,110,105,111,110,0,111,110,106,117,107,117,
+    46,99,104,105,98,97,46,106,112,0,111,110,108,0,111,110,
+    108,105,110,101,46,109,117,115,101,117,109,0,111,110,108,105,
+    110,101,46,116,104,0,111,110,110,97,46,111,107,105,110,97,
+    119,97,46,106,112,0,111,110,111,46,102,117,107,117,105,46,
+    106,112,0,111,110,111,46,102,117,107,117,115,104,105,109,97,
+    46,106,112,0,111,110,111,46,104,121,111,103,111,46,106,112,
+    0,111,110,111,106,111,46,102,117,107,117,111,107,97,46,106,
+    112,0,111,110,111,109,105,99,104,105,46,104,105,114,111,115,
+    104,105,109,97,46,106,112,0,111,110,112,111,114,116,101,114,
+    46,114,117,110,0,111,110,114,101,110,100,101,114,46,99,111,
+    109,0,111,110,116,97,114,105,111,46,109,117,115,101,117,109,
+    0,111,110,116,104,101,119,105,102,105,46,99,111,109,0,111,
+    110,122,97,46,109,121,116,104,105,99,45,98,101,97,115,116,
+    115,46,99,111,109,0,111,111,103,117,121,46,99,111,109,0,
+    111,111,107,117,119,97,46,110,97,103,97,110,111,46,106,112,
+    0,111,111,111,0,111,111,112,115,46,106,112,0,111,111,115,
+    104,105,107,97,46,110,97,103,97,110,111,46,106,112,0,111,
+    112,101,110,0,111,112,101,110,97,105,114,46,109,117,115,101,
+    117,109,0,111,112,101,110,99,114,97,102,116,46,104,111,115,
+    116,105,110,103,0,111,112,101,110,115,111,99,105,97,108,46,
+    115,105,116,101,0,111,112,101,114,97,117,110,105,116,101,46,
+    99,111,109,0,111,112,111,99,122,110,111,46,112,108,0,111,
+    112,111,108,101,46,112,108,0,111,112,112,100,97,108,46,110,
+    111,0,111,112,112,101,103,97,114,100,46,110,111,0,111,112,
+    112,101,103,195,165,114,100,46,110,111,0,111,114,46,97,116,
+    0,111,114,46,98,105,0,111,114,46,99,105,0,111,114,46,
+    99,114,0,111,114,46,105,100,0,111,114,46,105,116,0,111,
+    114,46,106,112,0,111,114,46,107,101,0,111,114,46,107,114,
+    0,111,114,46,109,117,0,111,114,46,110,97,0,111,114,46,
+    112,119,0,111,114,46,116,104,0,111,114,46,116,122,0,111,
+    114,46,117,103,0,111,114,97,46,103,117,110,109,97,46,106,
+    112,0,111,114,97,99,108,101,0,111,114,97,110,103,101,99,
+    108,111,117,100,46,116,110,0,111,114,101,103,111,110,46,109,
+    117,115,101,117,109,0,111,114,101,103,111,110,116,114,97,105,
+    108,46,109,117,115,101,117,109,0,111,114,103,46,97,99,0,
+    111,114,103,46,97,101,0,111,114,103,46,97,102,0,111,114,
+    103,46,97,103,0,111,114,103,46,97,105,0,111,114,103,46,
+    97,108,0,111,114,103,46,97,109,0,111,114,103,46,97,114,
+    0,111,114,103,46,97,117,0,111,114,103,46,97,122,0,111,
+    114,103,46,98,97,0,111,114,103,46,98,98,0,111,114,103,
+    46,98,104,0,111,114,103,46,98,105,0,111,114,103,46,98,
+    106,0,111,114,103,46,98,109,0,111,114,103,46,98,110,0,
+    111,114,103,46,98,111,0,111,114,103,46,98,114,0,111,114,
+    103,46,98,115,0,111,114,103,46,98,116,0,111,114,103,46,
+    98,119,0,111,114,103,46,98,122,0,111,114,103,46,99,105,
+    0,111,114,103,46,99,110,0,111,114,103,46,99,111,0,111,
+    114,103,46,99,117,0,111,114,103,46,99,118,0,111,114,103,
+    46,99,119,0,111,114,103,46,99,121,0,111,114,103,46,100,
+    109,0,111,114,103,46,100,111,0,111,114,103,46,100,122,0,
+    111,114,103,46,101,99,0,111,114,103,46,101,101,0,111,114,
+    103,46,101,103,0,111,114,103,46,101,115,0,111,114,103,46,
+    101,116,0,111,114,103,46,102,106,0,111,114,103,46,102,109,
+    0,111,114,103,46,103,101,0,111,114,103,46,103,103,0,111,
+    114,103,46,103,104,0,111,114,103,46,103,105,0,111,114,103,
+    46,103,108,0,111,114,103,46,103,110,0,111,114,103,46,103,
+    112,0,111,114,103,46,103,114,0,111,114,103,46,103,116,0,
+    111,114,103,46,103,117,0,111,114,103,46,103,121,0,111,114,
+    103,46,104,107,0,111,114,103,46,104,110,0,111,114,103,46,
+    104,116,0,111,114,103,46,104,117,0,111,114,103,46,105,108,
+    0,111,114,103,46,105,109,0,111,114,103,46,105,110,0,111,
+    114,103,46,105,113,0,111,114,103,46,105,114,0,111,114,103,
+    46,105,115,0,111,114,103,46,106,101,0,111,114,103,46,106,
+    111,0,111,114,103,46,107,103,0,111,114,103,46,107,105,0,
+    111,114,103,46,107,109,0,111,114,103,46,107,110,0,111,114,
+    103,46,107,112,0,111,114,103,46,107,119,0,111,114,103,46,
+    107,121,0,111,114,103,46,107,122,0,111,114,103,46,108,97,
+    0,111,114,103,46,108,98,0,111,114,103,46,108,99,0,111,
+    114,103,46,108,107,0,111,114,103,46,108,114,0,111,114,103,
+    46,108,115,0,111,114,103,46,108,118,0,111,114,103,46,108,
+    121,0,111,114,103,46,109,97,0,111,114,103,46,109,101,0,
+    111,114,103,46,109,103,0,111,114,103,46,109,107,0,111,114,
+    103,46,109,108,0,111,114,103,46,109,110,0,111,114,103,46,
+    109,111,0,111,114,103,46,109,115,0,111,114,103,46,109,116,
+    0,111,114,103,46,109,117,0,111,114,103,46,109,118,0,111,
+    114,103,46,109,119,0,111,114,103,46,109,120,0,111,114,103,
+    46,109,121,0,111,114,103,46,109,122,0,111,114,103,46,110,
+    97,0,111,114,103,46,110,103,0,111,114,103,46,110,105,0,
+    111,114,103,46,110,114,0,111,114,103,46,110,122,0,111,114,
+    103,46,111,109,0,111,114,103,46,112,97,0,111,114,103,46,
+    112,101,0,111,114,103,46,112,102,0,111,114,103,46,112,104,
+    0,111,114,103,46,112,107,0,111,114,103,46,112,108,0,111,
+    114,103,46,112,110,0,111,114,103,46,112,114,0,111,114,103,
+    46,112,115,0,111,114,103,46,112,116,0,111,114,103,46,112,
+    121,0,111,114,103,46,113,97,0,111,114,103,46,114,111,0,
+    111,114,103,46,114,115,0,111,114,103,46,114,117,0,111,114,
+    103,46,114,119,0,111,114,103,46,115,97,0,111,114,103,46,
+    115,98,0,111,114,103,46,115,99,0,111,114,103,46,115,100,
+    0,111,114,103,46,115,101,0,111,114,103,46,115,103,0,111,
+    114,103,46,115,104,0,111,114,103,46,115,108,0,111,114,103,
+    46,115,110,0,111,114,103,46,115,111,0,111,114,103,46,115,
+    115,0,111,114,103,46,115,116,0,111,114,103,46,115,118,0,
+    111,114,103,46,115,121,0,111,114,103,46,115,122,0,111,114,
+    103,46,116,106,0,111,114,103,46,116,109,0,111,114,103,46,
+    116,110,0,111,114,103,46,116,111,0,111,114,103,46,116,114,
+    0,111,114,103,46,116,116,0,111,114,103,46,116,119,0,111,
+    114,103,46,117,97,0,111,114,103,46,117,103,0,111,114,103,
+    46,117,121,0,111,114,103,46,117,122,0,111,114,103,46,118,
+    99,0,111,114,103,46,118,101,0,111,114,103,46,118,105,0,
+    111,114,103,46,118,110,0,111,114,103,46,118,117,0,111,114,
+    103,46,119,115,0,111,114,103,46,121,101,0,111,114,103,46,
+    121,116,0,111,114,103,46,122,97,0,111,114,103,46,122,109,
+    0,111,114,103,46,122,119,0,111,114,103,97,110,105,99,0,
+    111,114,105,103,105,110,115,0,111,114,105,115,116,97,110,111,
+    46,105,116,0,111,114,107,97,110,103,101,114,46,110,111,0,
+    111,114,107,100,97,108,46,110,111,0,111,114,108,97,110,100,
+    46,110,111,0,111,114,115,105,116,101,115,46,99,111,109,0,
+    111,114,115,107,111,103,46,110,111,0,111,114,115,116,97,46,
+    110,111,0,111,114,120,46,98,105,122,0,111,115,46,104,101,
+    100,109,97,114,107,46,110,111,0,111,115,46,104,111,114,100,
+    97,108,97,110,100,46,110,111,0,111,115,97,107,97,0,111,
+    115,97,107,97,115,97,121,97,109,97,46,111,115,97,107,97,
+    46,106,112,0,111,115,97,107,105,46,109,105,121,97,103,105,
+    46,106,112,0,111,115,97,107,105,107,97,109,105,106,105,109,
+    97,46,104,105,114,111,115,104,105,109,97,46,106,112,0,111,
+    115,97,115,99,111,46,98,114,0,111,115,101,110,46,110,111,
+    0,111,115,101,116,111,46,110,97,103,97,115,97,107,105,46,
+    106,112,0,111,115,104,105,109,97,46,116,111,107,121,111,46,
+    106,112,0,111,115,104,105,109,97,46,121,97,109,97,103,117,
+    99,104,105,46,106,112,0,111,115,104,105,110,111,46,121,97,
+    109,97,110,97,115,104,105,46,106,112,0,111,115,104,117,46,
+    105,119,97,116,101,46,106,112,0,111,115,111,121,114,111,46,
+    110,111,0,111,115,116,101,114,111,121,46,110,111,0,111,115,
+    116,101,114,195,184,121,46,110,111,0,111,115,116,114,101,45,
+    116,111,116,101,110,46,110,111,0,111,115,116,114,111,100,97,
+    46,112,108,0,111,115,116,114,111,108,101,107,97,46,112,108,
+    0,111,115,116,114,111,119,105,101,99,46,112,108,0,111,115,
+    116,114,111,119,119,108,107,112,46,112,108,0,111,115,195,184,
+    121,114,111,46,110,111,0,111,116,46,105,116,0,111,116,97,
+    46,103,117,110,109,97,46,106,112,0,111,116,97,46,116,111,
+    107,121,111,46,106,112,0,111,116,97,103,111,46,109,117,115,
+    101,117,109,0,111,116,97,107,101,46,104,105,114,111,115,104,
+    105,109,97,46,106,112,0,111,116,97,107,105,46,99,104,105,
+    98,97,46,106,112,0,111,116,97,107,105,46,110,97,103,97,
+    110,111,46,106,112,0,111,116,97,107,105,46,115,97,105,116,
+    97,109,97,46,106,112,0,111,116,97,109,97,46,102,117,107,
+    117,115,104,105,109,97,46,106,112,0,111,116,97,112,46,99,
+    111,0,111,116,97,114,105,46,110,97,103,97,110,111,46,106,
+    112,0,111,116,97,114,117,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,111,116,101,46,98,106,0,111,116,104,101,114,
+    46,110,102,0,111,116,111,46,102,117,107,117,111,107,97,46,
+    106,112,0,111,116,111,98,101,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,111,116,111,102,117,107,101,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,111,116,111,105,110,101,112,
+    112,117,46,104,111,107,107,97,105,100,111,46,106,112,0,111,
+    116,111,121,111,46,107,111,99,104,105,46,106,112,0,111,116,
+    115,117,46,115,104,105,103,97,46,106,112,0,111,116,115,117,
+    99,104,105,46,105,119,97,116,101,46,106,112,0,111,116,115,
+    117,107,97,0,111,116,115,117,107,105,46,107,111,99,104,105,
+    46,106,112,0,111,116,115,117,107,105,46,121,97,109,97,110,
+    97,115,104,105,46,106,112,0,111,116,116,0,111,117,99,104,
+    105,46,115,97,103,97,46,106,112,0,111,117,100,97,46,110,
+    97,114,97,46,106,112,0,111,117,109,46,103,111,118,46,112,
+    108,0,111,117,109,117,46,104,111,107,107,97,105,100,111,46,
+    106,112,0,111,117,116,115,121,115,116,101,109,115,99,108,111,
+    117,100,46,99,111,109,0,111,118,101,114,104,97,108,108,97,
+    46,110,111,0,111,118,114,101,45,101,105,107,101,114,46,110,
+    111,0,111,119,97,110,105,46,97,111,109,111,114,105,46,106,
+    112,0,111,119,97,114,105,97,115,97,104,105,46,97,105,99,
+    104,105,46,106,112,0,111,119,110,46,112,109,0,111,119,110,
+    105,112,46,110,101,116,0,111,119,110,112,114,111,118,105,100,
+    101,114,46,99,111,109,0,111,119,111,46,99,111,100,101,115,
+    0,111,120,46,114,115,0,111,120,102,111,114,100,46,109,117,
+    115,101,117,109,0,111,121,46,108,99,0,111,121,97,46,116,
+    111,0,111,121,97,98,101,46,116,111,121,97,109,97,46,106,
+    112,0,111,121,97,109,97,46,116,111,99,104,105,103,105,46,
+    106,112,0,111,121,97,109,97,122,97,107,105,46,107,121,111,
+    116,111,46,106,112,0,111,121,101,114,46,110,111,0,111,121,
+    103,97,114,100,101,110,46,110,111,0,111,121,111,100,111,46,
+    110,97,114,97,46,106,112,0,111,121,115,116,114,101,45,115,
+    108,105,100,114,101,46,110,111,0,111,122,46,97,117,0,111,
+    122,111,114,97,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,111,122,117,46,101,104,105,109,101,46,106,112,0,111,122,
+    117,46,107,117,109,97,109,111,116,111,46,106,112,0,112,46,
+    98,103,0,112,46,115,101,0,112,97,46,103,111,118,46,98,
+    114,0,112,97,46,103,111,118,46,112,108,0,112,97,46,105,
+    116,0,112,97,46,108,101,103,46,98,114,0,112,97,97,115,
+    46,98,101,101,98,121,116,101,46,105,111,0,112,97,97,115,
+    46,100,97,116,97,99,101,110,116,101,114,46,102,105,0,112,
+    97,97,115,46,104,111,115,116,101,100,45,98,121,45,112,114,
+    101,118,105,100,101,114,46,99,111,109,0,112,97,97,115,46,
+    109,97,115,115,105,118,101,103,114,105,100,46,99,111,109,0,
+    112,97,99,105,102,105,99,46,109,117,115,101,117,109,0,112,
+    97,100,101,114,98,111,114,110,46,109,117,115,101,117,109,0,
+    112,97,100,111,118,97,46,105,116,0,112,97,100,117,97,46,
+    105,116,0,112,97,103,101,102,114,111,110,116,97,112,112,46,
+    99,111,109,0,112,97,103,101,115,46,100,101,118,0,112,97,
+    103,101,115,46,105,116,46,104,115,45,104,101,105,108,98,114,
+    111,110,110,46,100,101,0,112,97,103,101,115,46,116,111,114,
+    112,114,111,106,101,99,116,46,110,101,116,0,112,97,103,101,
+    115,46,119,105,97,114,100,119,101,98,46,99,111,109,0,112,
+    97,103,101,115,112,101,101,100,109,111,98,105,108,105,122,101,
+    114,46,99,111,109,0,112,97,103,101,120,108,46,99,111,109,
+    0,112,97,108,97,99,101,46,109,117,115,101,117,109,0,112,
+    97,108,101,111,46,109,117,115,101,117,109,0,112,97,108,101,
+    114,109,111,46,105,116,0,112,97,108,109,97,115,46,98,114,
+    0,112,97,108,109,115,112,114,105,110,103,115,46,109,117,115,
+    101,117,109,0,112,97,110,97,109,97,46,109,117,115,101,117,
+    109,0,112,97,110,97,115,111,110,105,99,0,112,97,110,116,
+    104,101,111,110,115,105,116,101,46,105,111,0,112,97,114,97,
+    99,104,117,116,105,110,103,46,97,101,114,111,0,112,97,114,
+    97,103,108,105,100,105,110,103,46,97,101,114,111,0,112,97,
+    114,97,108,108,101,108,46,106,112,0,112,97,114,97,115,105,
+    116,101,46,106,112,0,112,97,114,105,115,0,112,97,114,105,
+    115,46,101,117,46,111,114,103,0,112,97,114,105,115,46,109,
+    117,115,101,117,109,0,112,97,114,108,105,97,109,101,110,116,
+    46,110,122,0,112,97,114,109,97,46,105,116,0,112,97,114,
+    111,99,104,46,107,49,50,46,109,97,46,117,115,0,112,97,
+    114,115,0,112,97,114,116,105,46,115,101,0,112,97,114,116,
+    110,101,114,115,0,112,97,114,116,115,0,112,97,115,97,100,
+    101,110,97,46,109,117,115,101,117,109,0,112,97,115,115,97,
+    103,101,110,115,0,112,97,115,115,101,110,103,101,114,45,97,
+    115,115,111,99,105,97,116,105,111,110,46,97,101,114,111,0,
+    112,97,116,114,105,97,46,98,111,0,112,97,118,105,97,46,
+    105,116,0,112,97,121,0,112,97,121,119,104,105,114,108,46,
+    99,111,109,0,112,98,46,97,111,0,112,98,46,103,111,118,
+    46,98,114,0,112,98,46,108,101,103,46,98,114,0,112,99,
+    46,105,116,0,112,99,46,112,108,0,112,99,99,119,0,112,
+    99,108,111,117,100,46,104,111,115,116,0,112,100,46,105,116,
+    0,112,100,110,115,46,112,97,103,101,0,112,101,46,99,97,
+    0,112,101,46,103,111,118,46,98,114,0,112,101,46,105,116,
+    0,112,101,46,107,114,0,112,101,46,108,101,103,46,98,114,
+    0,112,101,99,111,114,105,46,106,112,0,112,101,101,119,101,
+    101,46,106,112,0,112,101,110,110,101,46,106,112,0,112,101,
+    110,122,97,46,115,117,0,112,101,112,112,101,114,46,106,112,
+    0,112,101,114,46,108,97,0,112,101,114,46,110,102,0,112,
+    101,114,46,115,103,0,112,101,114,109,97,46,106,112,0,112,
+    101,114,115,111,46,104,116,0,112,101,114,115,111,46,115,110,
+    0,112,101,114,115,111,46,116,110,0,112,101,114,115,112,101,
+    99,116,97,46,99,108,111,117,100,0,112,101,114,117,103,105,
+    97,46,105,116,0,112,101,115,97,114,111,45,117,114,98,105,
+    110,111,46,105,116,0,112,101,115,97,114,111,117,114,98,105,
+    110,111,46,105,116,0,112,101,115,99,97,114,97,46,105,116,
+    0,112,101,116,0,112,102,105,122,101,114,0,112,103,0,112,
+    103,46,105,110,0,112,103,46,105,116,0,112,103,97,102,97,
+    110,46,110,101,116,0,112,103,102,111,103,46,99,111,109,0,
+    112,104,97,114,109,97,99,105,101,110,46,102,114,0,112,104,
+    97,114,109,97,99,105,101,110,115,46,107,109,0,112,104,97,
+    114,109,97,99,121,0,112,104,97,114,109,97,99,121,46,109,
+    117,115,101,117,109,0,112,104,100,0,112,104,105,108,97,100,
+    101,108,112,104,105,97,46,109,117,115,101,117,109,0,112,104,
+    105,108,97,100,101,108,112,104,105,97,97,114,101,97,46,109,
+    117,115,101,117,109,0,112,104,105,108,97,116,101,108,121,46,
+    109,117,115,101,117,109,0,112,104,105,108,105,112,115,0,112,
+    104,111,101,110,105,120,46,109,117,115,101,117,109,0,112,104,
+    111,110,101,0,112,104,111,116,111,0,112,104,111,116,111,103,
+    114,97,112,104,121,0,112,104,111,116,111,103,114,97,112,104,
+    121,46,109,117,115,101,117,109,0,112,104,120,46,101,110,115,
+    99,97,108,101,100,46,117,115,0,112,104,121,115,105,111,0,
+    112,105,46,103,111,118,46,98,114,0,112,105,46,105,116,0,
+    112,105,46,108,101,103,46,98,114,0,112,105,97,99,101,110,
+    122,97,46,105,116,0,112,105,99,115,0,112,105,99,116,101,
+    116,0,112,105,100,0,112,105,101,100,109,111,110,116,46,105,
+    116,0,112,105,101,109,111,110,116,101,46,105,116,0,112,105,
+    103,98,111,97,116,46,106,112,0,112,105,108,97,46,112,108,
+    0,112,105,108,111,116,46,97,101,114,111,0,112,105,108,111,
+    116,115,46,109,117,115,101,117,109,0,112,105,109,105,101,110,
+    116,97,46,111,114,103,0,112,105,110,0,112,105,110,98,46,
+    103,111,118,46,112,108,0,112,105,110,103,0,112,105,110,107,
+    0,112,105,110,111,107,111,46,106,112,0,112,105,111,110,101,
+    101,114,0,112,105,112,112,117,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,112,105,115,97,46,105,116,0,112,105,115,
+    116,111,105,97,46,105,116,0,112,105,115,122,46,112,108,0,
+    112,105,116,116,115,98,117,114,103,104,46,109,117,115,101,117,
+    109,0,112,105,119,46,103,111,118,46,112,108,0,112,105,120,
+    111,108,105,110,111,46,99,111,109,0,112,105,122,122,97,0,
+    112,108,46,101,117,46,111,114,103,0,112,108,46,117,97,0,
+    112,108,97,110,101,116,97,114,105,117,109,46,109,117,115,101,
+    117,109,0,112,108,97,110,116,97,116,105,111,110,46,109,117,
+    115,101,117,109,0,112,108,97,110,116,115,46,109,117,115,101,
+    117,109,0,112,108,97,116,102,111,114,109,48,46,97,112,112,
+    0,112,108,97,116,102,111,114,109,115,104,46,115,105,116,101,
+    0,112,108,97,116,116,101,114,45,97,112,112,46,99,111,109,
+    0,112,108,97,116,116,101,114,45,97,112,112,46,100,101,118,
+    0,112,108,97,116,116,101,114,112,46,117,115,0,112,108,97,
+    121,0,112,108,97,121,115,116,97,116,105,111,110,0,112,108,
+    97,121,115,116,97,116,105,111,110,45,99,108,111,117,100,46,
+    99,111,109,0,112,108,97,122,97,46,109,117,115,101,117,109,
+    0,112,108,99,46,99,111,46,105,109,0,112,108,99,46,108,
+    121,0,112,108,99,46,117,107,0,112,108,101,115,107,46,112,
+    97,103,101,0,112,108,101,115,107,110,115,46,99,111,109,0,
+    112,108,111,46,112,115,0,112,108,117,109,98,105,110,103,0,
+    112,108,117,114,105,110,97,99,105,111,110,97,108,46,98,111,
+    0,112,108,117,115,0,112,109,110,46,105,116,0,112,110,46,
+    105,116,0,112,110,99,0,112,111,46,103,111,118,46,112,108,
+    0,112,111,46,105,116,0,112,111,97,46,98,114,0,112,111,
+    100,104,97,108,101,46,112,108,0,112,111,100,108,97,115,105,
+    101,46,112,108,0,112,111,100,122,111,110,101,46,110,101,116,
+    0,112,111,100,122,111,110,101,46,111,114,103,0,112,111,104,
+    108,0,112,111,105,110,116,50,116,104,105,115,46,99,111,109,
+    0,112,111,105,110,116,116,111,46,117,115,0,112,111,105,118,
+    114,111,110,46,111,114,103,0,112,111,107,101,114,0,112,111,
+    107,114,111,118,115,107,46,115,117,0,112,111,108,46,100,122,
+    0,112,111,108,46,104,116,0,112,111,108,46,116,114,0,112,
+    111,108,105,99,101,46,117,107,0,112,111,108,105,116,105,99,
+    97,46,98,111,0,112,111,108,105,116,105,101,0,112,111,108,
+    107,111,119,105,99,101,46,112,108,0,112,111,108,116,97,118,
+    97,46,117,97,0,112,111,109,111,114,115,107,105,101,46,112,
+    108,0,112,111,109,111,114,122,101,46,112,108,0,112,111,110,
+    105,97,116,111,119,97,46,112,108,0,112,111,110,112,101,115,
+    46,105,100,0,112,111,114,100,101,110,111,110,101,46,105,116,
+    0,112,111,114,115,97,110,103,101,114,46,110,111,0,112,111,
+    114,115,97,110,103,117,46,110,111,0,112,111,114,115,103,114,
+    117,110,110,46,110,111,0,112,111,114,115,195,161,197,139,103,
+    117,46,110,111,0,112,111,114,116,46,102,114,0,112,111,114,
+    116,97,108,46,109,117,115,101,117,109,0,112,111,114,116,108,
+    97,110,100,46,109,117,115,101,117,109,0,112,111,114,116,108,
+    108,105,103,97,116,46,109,117,115,101,117,109,0,112,111,115,
+    116,0,112,111,115,116,46,105,110,0,112,111,115,116,109,97,
+    110,45,101,99,104,111,46,99,111,109,0,112,111,115,116,115,
+    45,97,110,100,45,116,101,108,101,99,111,109,109,117,110,105,
+    99,97,116,105,111,110,115,46,109,117,115,101,117,109,0,112,
+    111,116,97,103,101,114,46,111,114,103,0,112,111,116,101,110,
+    122,97,46,105,116,0,112,111,119,105,97,116,46,112,108,0,
+    112,111,122,110,97,110,46,112,108,0,112,112,46,97,122,0,
+    112,112,46,114,117,0,112,112,46,115,101,0,112,112,46,117,
+    97,0,112,112,103,46,98,114,0,112,114,46,103,111,118,46,
+    98,114,0,112,114,46,105,116,0,112,114,46,108,101,103,46,
+    98,114,0,112,114,97,109,101,114,105,99,97,0,112,114,97,
+    116,111,46,105,116,0,112,114,97,120,105,0,112,114,100,46,
+    102,114,0,112,114,100,46,107,109,0,112,114,100,46,109,103,
+    0,112,114,101,113,117,97,108,105,102,121,109,101,46,116,111,
+    100,97,121,0,112,114,101,115,101,114,118,97,116,105,111,110,
+    46,109,117,115,101,117,109,0,112,114,101,115,105,100,105,111,
+    46,109,117,115,101,117,109,0,112,114,101,115,115,0,112,114,
+    101,115,115,46,97,101,114,111,0,112,114,101,115,115,46,99,
+    121,0,112,114,101,115,115,46,109,97,0,112,114,101,115,115,
+    46,109,117,115,101,117,109,0,112,114,101,115,115,46,115,101,
+    0,112,114,101,115,115,101,46,99,105,0,112,114,101,115,115,
+    101,46,107,109,0,112,114,101,115,115,101,46,109,108,0,112,
+    114,105,46,101,101,0,112,114,105,109,101,0,112,114,105,110,
+    99,105,112,101,46,115,116,0,112,114,105,118,46,97,116,0,
+    112,114,105,118,46,104,117,0,112,114,105,118,46,105,110,115,
+    116,97,110,99,101,115,46,115,99,119,46,99,108,111,117,100,
+    0,112,114,105,118,46,109,101,0,112,114,105,118,46,110,111,
+    0,112,114,105,118,46,112,108,0,112,114,105,118,97,116,101,
+    108,105,110,107,46,115,110,111,119,102,108,97,107,101,46,97,
+    112,112,0,112,114,105,118,97,116,105,122,101,104,101,97,108,
+    116,104,105,110,115,117,114,97,110,99,101,46,110,101,116,0,
+    112,114,111,46,97,122,0,112,114,111,46,98,114,0,112,114,
+    111,46,99,121,0,112,114,111,46,101,99,0,112,114,111,46,
+    102,106,0,112,114,111,46,104,116,0,112,114,111,46,105,110,
+    0,112,114,111,46,109,118,0,112,114,111,46,110,97,0,112,
+    114,111,46,111,109,0,112,114,111,46,112,114,0,112,114,111,
+    46,116,116,0,112,114,111,46,116,121,112,101,102,111,114,109,
+    46,99,111,109,0,112,114,111,46,118,110,0,112,114,111,99,
+    104,111,119,105,99,101,46,112,108,0,112,114,111,100,0,112,
+    114,111,100,117,99,116,105,111,110,46,97,101,114,111,0,112,
+    114,111,100,117,99,116,105,111,110,115,0,112,114,111,102,0,
+    112,114,111,102,46,112,114,0,112,114,111,102,101,115,105,111,
+    110,97,108,46,98,111,0,112,114,111,103,114,101,115,115,105,
+    118,101,0,112,114,111,106,101,99,116,46,109,117,115,101,117,
+    109,0,112,114,111,109,111,0,112,114,111,112,101,114,116,105,
+    101,115,0,112,114,111,112,101,114,116,121,0,112,114,111,116,
+    101,99,116,105,111,110,0,112,114,111,116,111,110,101,116,46,
+    105,111,0,112,114,117,0,112,114,117,100,101,110,116,105,97,
+    108,0,112,114,117,115,122,107,111,119,46,112,108,0,112,114,
+    118,99,121,46,112,97,103,101,0,112,114,122,101,119,111,114,
+    115,107,46,112,108,0,112,115,99,46,98,114,0,112,115,105,
+    46,98,114,0,112,115,112,46,103,111,118,46,112,108,0,112,
+    115,115,101,46,103,111,118,46,112,108,0,112,116,46,101,117,
+    46,111,114,103,0,112,116,46,105,116,0,112,117,46,105,116,
+    0,112,117,98,46,105,110,115,116,97,110,99,101,115,46,115,
+    99,119,46,99,108,111,117,100,0,112,117,98,46,115,97,0,
+    112,117,98,108,46,112,116,0,112,117,98,108,105,99,45,105,
+    110,113,117,105,114,121,46,117,107,0,112,117,98,108,105,99,
+    46,109,117,115,101,117,109,0,112,117,98,108,105,115,104,112,
+    114,111,120,121,46,99,111,109,0,112,117,98,111,108,46,109,
+    117,115,101,117,109,0,112,117,98,116,108,115,46,111,114,103,
+    0,112,117,101,98,108,111,46,98,111,0,112,117,103,46,105,
+    116,0,112,117,103,108,105,97,46,105,116,0,112,117,108,97,
+    119,121,46,112,108,0,112,117,110,121,117,46,106,112,0,112,
+    117,112,46,103,111,118,46,112,108,0,112,117,112,117,46,106,
+    112,0,112,117,115,115,121,99,97,116,46,106,112,0,112,118,
+    46,105,116,0,112,118,104,46,98,114,0,112,118,116,46,103,
+    101,0,112,118,116,46,107,49,50,46,109,97,46,117,115,0,
+    112,119,99,0,112,121,97,46,106,112,0,112,121,97,116,105,
+    103,111,114,115,107,46,114,117,0,112,121,109,110,116,46,117,
+    107,0,112,122,46,105,116,0,113,45,97,46,101,117,46,111,
+    114,103,0,113,46,98,103,0,113,97,50,46,99,111,109,0,
+    113,98,117,115,101,114,46,99,111,109,0,113,99,46,99,97,
+    0,113,99,46,99,111,109,0,113,104,46,99,110,0,113,108,
+    100,46,97,117,0,113,108,100,46,101,100,117,46,97,117,0,
+    113,108,100,46,103,111,118,46,97,117,0,113,111,116,111,46,
+    105,111,0,113,112,111,110,0,113,115,108,46,98,114,0,113,
+    117,97,108,105,102,105,111,97,112,112,46,99,111,109,0,113,
+    117,101,98,101,99,0,113,117,101,98,101,99,46,109,117,115,
+    101,117,109,0,113,117,101,115,116,0,113,117,105,99,107,115,
+    121,116,101,115,46,99,111,109,0,113,117,105,112,101,108,101,
+    109,101,110,116,115,46,99,111,109,0,114,46,97,112,112,115,
+    112,111,116,46,99,111,109,0,114,46,98,103,0,114,46,99,
+    100,110,55,55,46,110,101,116,0,114,46,115,101,0,114,50,
+    46,100,101,118,0,114,97,46,105,116,0,114,97,99,105,110,
+    103,0,114,97,99,107,109,97,122,101,46,99,111,109,0,114,
+    97,99,107,109,97,122,101,46,110,101,116,0,114,97,100,101,
+    46,110,111,0,114,97,100,105,111,0,114,97,100,105,111,46,
+    97,109,0,114,97,100,105,111,46,98,114,0,114,97,100,105,
+    111,46,102,109,0,114,97,100,111,109,46,112,108,0,114,97,
+    100,111,121,46,110,111,0,114,97,100,195,184,121,46,110,111,
+    0,114,97,102,102,108,101,101,110,116,114,121,46,111,114,103,
+    46,117,107,0,114,97,103,45,99,108,111,117,100,45,99,104,
+    46,104,111,115,116,101,117,114,46,99,111,109,0,114,97,103,
+    45,99,108,111,117,100,46,104,111,115,116,101,117,114,46,99,
+    111,109,0,114,97,103,117,115,97,46,105,116,0,114,97,104,
+    107,107,101,114,97,118,106,117,46,110,111,0,114,97,104,111,
+    108,116,46,110,111,0,114,97,105,108,114,111,97,100,46,109,
+    117,115,101,117,109,0,114,97,105,108,119,97,121,46,109,117,
+    115,101,117,109,0,114,97,105,110,100,114,111,112,46,106,112,
+    0,114,97,105,115,97,46,110,111,0,114,97,107,107,101,115,
+    116,97,100,46,110,111,0,114,97,108,105,110,103,101,110,46,
+    110,111,0,114,97,110,97,46,110,111,0,114,97,110,100,97,
+    98,101,114,103,46,110,111,0,114,97,110,107,111,115,104,105,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,114,97,110,
+    122,97,110,46,115,97,105,116,97,109,97,46,106,112,0,114,
+    97,114,46,118,101,0,114,97,115,46,114,117,0,114,97,117,
+    109,97,46,110,111,0,114,97,118,101,110,100,98,46,99,108,
+    111,117,100,0,114,97,118,101,110,100,98,46,99,111,109,109,
+    117,110,105,116,121,0,114,97,118,101,110,100,98,46,109,101,
+    0,114,97,118,101,110,100,98,46,114,117,110,0,114,97,118,
+    101,110,110,97,46,105,116,0,114,97,118,112,97,103,101,46,
+    99,111,46,105,108,0,114,97,119,97,45,109,97,122,46,112,
+    108,0,114,99,46,105,116,0,114,100,118,46,116,111,0,114,
+    101,46,105,116,0,114,101,46,107,114,0,114,101,97,100,0,
+    114,101,97,100,45,98,111,111,107,115,46,111,114,103,0,114,
+    101,97,100,109,121,98,108,111,103,46,111,114,103,0,114,101,
+    97,100,116,104,101,100,111,99,115,46,105,111,0,114,101,97,
+    100,121,109,97,100,101,46,106,112,0,114,101,97,108,101,115,
+    116,97,116,101,0,114,101,97,108,101,115,116,97,116,101,46,
+    112,108,0,114,101,97,108,109,46,99,122,0,114,101,97,108,
+    116,111,114,0,114,101,97,108,116,121,0,114,101,98,117,110,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,114,101,99,
+    46,98,114,0,114,101,99,46,99,111,0,114,101,99,46,110,
+    102,0,114,101,99,46,114,111,0,114,101,99,46,118,101,0,
+    114,101,99,104,116,46,112,114,111,0,114,101,99,105,102,101,
+    46,98,114,0,114,101,99,105,112,101,115,0,114,101,99,114,
+    101,97,116,105,111,110,46,97,101,114,111,0,114,101,100,0,
+    114,101,100,46,115,118,0,114,101,100,105,114,101,99,116,109,
+    101,46,110,101,116,0,114,101,100,115,116,111,110,101,0,114,
+    101,100,117,109,98,114,101,108,108,97,0,114,101,103,46,100,
+    107,0,114,101,103,103,105,111,45,99,97,108,97,98,114,105,
+    97,46,105,116,0,114,101,103,103,105,111,45,101,109,105,108,
+    105,97,46,105,116,0,114,101,103,103,105,111,99,97,108,97,
+    98,114,105,97,46,105,116,0,114,101,103,103,105,111,101,109,
+    105,108,105,97,46,105,116,0,114,101,104,97,98,0,114,101,
+    105,115,101,0,114,101,105,115,101,110,0,114,101,105,116,0,
+    114,101,107,108,97,109,46,104,117,0,114,101,108,46,104,116,
+    0,114,101,108,46,112,108,0,114,101,108,105,97,110,99,101,
+    0,114,101,109,111,116,101,119,100,46,99,111,109,0,114,101,
+    110,0,114,101,110,100,97,108,101,110,46,110,111,0,114,101,
+    110,110,101,98,117,46,110,111,0,114,101,110,110,101,115,111,
+    121,46,110,111,0,114,101,110,110,101,115,195,184,121,46,110,
+    111,0,114,101,110,116,0,114,101,110,116,97,108,115,0,114,
+    101,112,46,98,114,0,114,101,112,46,107,112,0,114,101,112,
+    97,105,114,0,114,101,112,98,111,100,121,46,97,101,114,111,
+    0,114,101,112,108,46,114,117,110,0,114,101,112,111,114,116,
+    0,114,101,112,117,98,108,105,99,97,110,0,114,101,115,46,
+    97,101,114,111,0,114,101,115,46,105,110,0,114,101,115,101,
+    97,114,99,104,46,97,101,114,111,0,114,101,115,101,97,114,
+    99,104,46,109,117,115,101,117,109,0,114,101,115,101,114,118,
+    100,46,99,111,109,0,114,101,115,101,114,118,100,46,100,101,
+    118,46,116,104,105,110,103,100,117,115,116,46,105,111,0,114,
+    101,115,101,114,118,100,46,100,105,115,114,101,99,46,116,104,
+    105,110,103,100,117,115,116,46,105,111,0,114,101,115,101,114,
+    118,100,46,116,101,115,116,105,110,103,46,116,104,105,110,103,
+    100,117,115,116,46,105,111,0,114,101,115,101,114,118,101,45,
+    111,110,108,105,110,101,46,99,111,109,0,114,101,115,101,114,
+    118,101,45,111,110,108,105,110,101,46,110,101,116,0,114,101,
+    115,105,110,100,101,118,105,99,101,46,105,111,0,114,101,115,
+    105,115,116,97,110,99,101,46,109,117,115,101,117,109,0,114,
+    101,115,116,0,114,101,115,116,97,117,114,97,110,116,0,114,
+    101,115,116,97,117,114,97,110,116,46,98,106,0,114,101,115,
+    116,111,46,98,106,0,114,101,118,105,101,119,115,0,114,101,
+    118,105,115,116,97,46,98,111,0,114,101,120,114,111,116,104,
+    0,114,103,46,105,116,0,114,104,99,108,111,117,100,46,99,
+    111,109,0,114,105,46,105,116,0,114,105,98,101,105,114,97,
+    111,46,98,114,0,114,105,99,46,106,101,108,97,115,116,105,
+    99,46,118,112,115,45,104,111,115,116,46,110,101,116,0,114,
+    105,99,104,0,114,105,99,104,97,114,100,108,105,0,114,105,
+    99,111,104,0,114,105,101,116,105,46,105,116,0,114,105,102,
+    117,46,109,105,121,97,103,105,46,106,112,0,114,105,105,107,
+    46,101,101,0,114,105,107,117,98,101,116,115,117,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,114,105,107,117,122,101,
+    110,116,97,107,97,116,97,46,105,119,97,116,101,46,106,112,
+    0,114,105,108,0,114,105,109,105,110,105,46,105,116,0,114,
+    105,110,100,97,108,46,110,111,0,114,105,110,103,101,98,117,
+    46,110,111,0,114,105,110,103,101,114,105,107,101,46,110,111,
+    0,114,105,110,103,115,97,107,101,114,46,110,111,0,114,105,
+    111,0,114,105,111,46,98,114,0,114,105,111,98,114,97,110,
+    99,111,46,98,114,0,114,105,111,100,101,106,97,110,101,105,
+    114,111,46,109,117,115,101,117,109,0,114,105,111,112,114,101,
+    116,111,46,98,114,0,114,105,115,104,105,114,105,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,114,105,115,104,105,114,
+    105,102,117,106,105,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,114,105,115,111,114,46,110,111,0,114,105,115,115,97,
+    46,110,111,0,114,105,115,195,184,114,46,110,111,0,114,105,
+    116,116,111,46,115,104,105,103,97,46,106,112,0,114,105,118,
+    110,101,46,117,97,0,114,106,46,103,111,118,46,98,114,0,
+    114,106,46,108,101,103,46,98,114,0,114,109,46,105,116,0,
+    114,110,46,103,111,118,46,98,114,0,114,110,46,105,116,0,
+    114,110,46,108,101,103,46,98,114,0,114,111,46,101,117,46,
+    111,114,103,0,114,111,46,103,111,118,46,98,114,0,114,111,
+    46,105,109,0,114,111,46,105,116,0,114,111,46,108,101,103,
+    46,98,114,0,114,111,97,110,46,110,111,0,114,111,99,104,
+    101,114,0,114,111,99,104,101,115,116,101,114,46,109,117,115,
+    101,117,109,0,114,111,99,107,97,114,116,46,109,117,115,101,
+    117,109,0,114,111,99,107,121,46,112,97,103,101,0,114,111,
+    100,101,111,0,114,111,100,111,121,46,110,111,0,114,111,103,
+    101,114,115,0,114,111,107,117,110,111,104,101,46,97,111,109,
+    111,114,105,46,106,112,0,114,111,108,108,97,103,46,110,111,
+    0,114,111,109,97,46,105,116,0,114,111,109,97,46,109,117,
+    115,101,117,109,0,114,111,109,101,46,105,116,0,114,111,109,
+    115,97,46,110,111,0,114,111,109,115,107,111,103,46,110,111,
+    0,114,111,111,109,0,114,111,114,111,115,46,110,111,0,114,
+    111,115,116,46,110,111,0,114,111,116,111,114,99,114,97,102,
+    116,46,97,101,114,111,0,114,111,117,116,101,114,46,109,97,
+    110,97,103,101,109,101,110,116,0,114,111,118,105,103,111,46,
+    105,116,0,114,111,118,110,111,46,117,97,0,114,111,121,97,
+    108,45,99,111,109,109,105,115,115,105,111,110,46,117,107,0,
+    114,111,121,107,101,110,46,110,111,0,114,111,121,114,118,105,
+    107,46,110,111,0,114,114,46,103,111,118,46,98,114,0,114,
+    114,46,108,101,103,46,98,114,0,114,115,46,98,97,0,114,
+    115,46,103,111,118,46,98,114,0,114,115,46,108,101,103,46,
+    98,114,0,114,115,99,46,99,100,110,55,55,46,111,114,103,
+    0,114,115,115,46,109,121,46,105,100,0,114,115,118,112,0,
+    114,117,46,99,111,109,0,114,117,46,101,117,46,111,114,103,
+    0,114,117,46,110,101,116,0,114,117,103,98,121,0,114,117,
+    104,114,0,114,117,111,118,97,116,46,110,111,0,114,117,115,
+    115,105,97,46,109,117,115,101,117,109,0,114,118,46,117,97,
+    0,114,119,101,0,114,121,98,110,105,107,46,112,108,0,114,
+    121,100,46,119,97,102,97,105,99,108,111,117,100,46,99,111,
+    109,0,114,121,103,103,101,46,110,111,0,114,121,111,107,97,
+    109,105,46,115,97,105,116,97,109,97,46,106,112,0,114,121,
+    117,103,97,115,97,107,105,46,105,98,97,114,97,107,105,46,
+    106,112,0,114,121,117,107,121,117,0,114,121,117,111,104,46,
+    115,104,105,103,97,46,106,112,0,114,122,101,115,122,111,119,
+    46,112,108,0,114,122,103,119,46,103,111,118,46,112,108,0,
+    114,195,161,104,107,107,101,114,195,161,118,106,117,46,110,111,
+    0,114,195,161,105,115,97,46,110,111,0,114,195,165,100,101,
+    46,110,111,0,114,195,165,104,111,108,116,46,110,111,0,114,
+    195,166,108,105,110,103,101,110,46,110,111,0,114,195,184,100,
+    195,184,121,46,110,111,0,114,195,184,109,115,107,111,103,46,
+    110,111,0,114,195,184,114,111,115,46,110,111,0,114,195,184,
+    115,116,46,110,111,0,114,195,184,121,107,101,110,46,110,111,
+    0,114,195,184,121,114,118,105,107,46,110,111,0,115,46,98,
+    103,0,115,46,115,101,0,115,51,45,97,112,45,110,111,114,
+    116,104,101,97,115,116,45,49,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,115,51,45,97,112,45,110,111,114,
+    116,104,101,97,115,116,45,50,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,115,51,45,97,112,45,115,111,117,
+    116,104,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,45,97,112,45,115,111,117,116,104,101,97,
+    115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,45,97,112,45,115,111,117,116,104,101,97,
+    115,116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,45,99,97,45,99,101,110,116,114,97,108,
+    45,49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,
+    0,115,51,45,101,117,45,99,101,110,116,114,97,108,45,49,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,
+    51,45,101,117,45,119,101,115,116,45,49,46,97,109,97,122,
+    111,110,97,119,115,46,99,111,109,0,115,51,45,101,117,45,
+    119,101,115,116,45,50,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,115,51,45,101,117,45,119,101,115,116,45,
+    51,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    115,51,45,101,120,116,101,114,110,97,108,45,49,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,0,115,51,45,102,
+    105,112,115,45,117,115,45,103,111,118,45,119,101,115,116,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    115,51,45,115,97,45,101,97,115,116,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,45,117,115,
+    45,101,97,115,116,45,50,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,115,51,45,117,115,45,103,111,118,45,
+    119,101,115,116,45,49,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,115,51,45,117,115,45,119,101,115,116,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    115,51,45,117,115,45,119,101,115,116,45,50,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,45,119,101,
+    98,115,105,116,101,45,97,112,45,110,111,114,116,104,101,97,
+    115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,45,119,101,98,115,105,116,101,45,97,112,
+    45,115,111,117,116,104,101,97,115,116,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,45,119,101,
+    98,115,105,116,101,45,97,112,45,115,111,117,116,104,101,97,
+    115,116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,45,119,101,98,115,105,116,101,45,101,117,
+    45,119,101,115,116,45,49,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,115,51,45,119,101,98,115,105,116,101,
+    45,115,97,45,101,97,115,116,45,49,46,97,109,97,122,111,
+    110,97,119,115,46,99,111,109,0,115,51,45,119,101,98,115,
+    105,116,101,45,117,115,45,101,97,115,116,45,49,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,0,115,51,45,119,
+    101,98,115,105,116,101,45,117,115,45,119,101,115,116,45,49,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,
+    51,45,119,101,98,115,105,116,101,45,117,115,45,119,101,115,
+    116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,111,
+    109,0,115,51,45,119,101,98,115,105,116,101,46,97,112,45,
+    110,111,114,116,104,101,97,115,116,45,50,46,97,109,97,122,
+    111,110,97,119,115,46,99,111,109,0,115,51,45,119,101,98,
+    115,105,116,101,46,97,112,45,115,111,117,116,104,45,49,46,
+    97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,51,
+    45,119,101,98,115,105,116,101,46,99,97,45,99,101,110,116,
+    114,97,108,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,115,51,45,119,101,98,115,105,116,101,46,101,
+    117,45,99,101,110,116,114,97,108,45,49,46,97,109,97,122,
+    111,110,97,119,115,46,99,111,109,0,115,51,45,119,101,98,
+    115,105,116,101,46,101,117,45,119,101,115,116,45,50,46,97,
+    109,97,122,111,110,97,119,115,46,99,111,109,0,115,51,45,
+    119,101,98,115,105,116,101,46,101,117,45,119,101,115,116,45,
+    51,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    115,51,45,119,101,98,115,105,116,101,46,102,114,45,112,97,
+    114,46,115,99,119,46,99,108,111,117,100,0,115,51,45,119,
+    101,98,115,105,116,101,46,110,108,45,97,109,115,46,115,99,
+    119,46,99,108,111,117,100,0,115,51,45,119,101,98,115,105,
+    116,101,46,112,108,45,119,97,119,46,115,99,119,46,99,108,
+    111,117,100,0,115,51,45,119,101,98,115,105,116,101,46,117,
+    115,45,101,97,115,116,45,50,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,115,51,46,97,109,97,122,111,110,
+    97,119,115,46,99,111,109,0,115,51,46,97,112,45,110,111,
+    114,116,104,101,97,115,116,45,50,46,97,109,97,122,111,110,
+    97,119,115,46,99,111,109,0,115,51,46,97,112,45,115,111,
+    117,116,104,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,115,51,46,99,97,45,99,101,110,116,114,97,
+    108,45,49,46,97,109,97,122,111,110,97,119,115,46,99,111,
+    109,0,115,51,46,99,110,45,110,111,114,116,104,45,49,46,
+    97,109,97,122,111,110,97,119,115,46,99,111,109,46,99,110,
+    0,115,51,46,100,117,97,108,115,116,97,99,107,46,97,112,
+    45,110,111,114,116,104,101,97,115,116,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,46,100,117,
+    97,108,115,116,97,99,107,46,97,112,45,110,111,114,116,104,
+    101,97,115,116,45,50,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,115,51,46,100,117,97,108,115,116,97,99,
+    107,46,97,112,45,115,111,117,116,104,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,46,100,117,
+    97,108,115,116,97,99,107,46,97,112,45,115,111,117,116,104,
+    101,97,115,116,45,49,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,115,51,46,100,117,97,108,115,116,97,99,
+    107,46,97,112,45,115,111,117,116,104,101,97,115,116,45,50,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,
+    51,46,100,117,97,108,115,116,97,99,107,46,99,97,45,99,
+    101,110,116,114,97,108,45,49,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,115,51,46,100,117,97,108,115,116,
+    97,99,107,46,101,117,45,99,101,110,116,114,97,108,45,49,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,
+    51,46,100,117,97,108,115,116,97,99,107,46,101,117,45,119,
+    101,115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,115,51,46,100,117,97,108,115,116,97,99,107,
+    46,101,117,45,119,101,115,116,45,50,46,97,109,97,122,111,
+    110,97,119,115,46,99,111,109,0,115,51,46,100,117,97,108,
+    115,116,97,99,107,46,101,117,45,119,101,115,116,45,51,46,
+    97,109,97,122,111,110,97,119,115,46,99,111,109,0,115,51,
+    46,100,117,97,108,115,116,97,99,107,46,115,97,45,101,97,
+    115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,115,51,46,100,117,97,108,115,116,97,99,107,46,
+    117,115,45,101,97,115,116,45,49,46,97,109,97,122,111,110,
+    97,119,115,46,99,111,109,0,115,51,46,100,117,97,108,115,
+    116,97,99,107,46,117,115,45,101,97,115,116,45,50,46,97,
+    109,97,122,111,110,97,119,115,46,99,111,109,0,115,51,46,
+    101,117,45,99,101,110,116,114,97,108,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,115,51,46,101,117,
+    45,119,101,115,116,45,50,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,115,51,46,101,117,45,119,101,115,116,
+    45,51,46,97,109,97,122,111,110,97,119,115,46,99,111,109,
+    0,115,51,46,102,114,45,112,97,114,46,115,99,119,46,99,
+    108,111,117,100,0,115,51,46,110,108,45,97,109,115,46,115,
+    99,119,46,99,108,111,117,100,0,115,51,46,112,108,45,119,
+    97,119,46,115,99,119,46,99,108,111,117,100,0,115,51,46,
+    116,101,99,107,105,100,115,46,111,114,103,0,115,51,46,117,
+    115,45,101,97,115,116,45,50,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,115,53,121,46,105,111,0,115,97,
+    45,101,97,115,116,45,49,46,101,108,97,115,116,105,99,98,
+    101,97,110,115,116,97,108,107,46,99,111,109,0,115,97,46,
+    97,117,0,115,97,46,99,111,109,0,115,97,46,99,114,0,
+    115,97,46,101,100,117,46,97,117,0,115,97,46,103,111,118,
+    46,97,117,0,115,97,46,103,111,118,46,112,108,0,115,97,
+    46,105,116,0,115,97,97,114,108,97,110,100,0,115,97,98,
+    97,101,46,102,117,107,117,105,46,106,112,0,115,97,100,105,
+    115,116,46,106,112,0,115,97,100,111,46,110,105,105,103,97,
+    116,97,46,106,112,0,115,97,102,101,0,115,97,102,101,116,
+    121,0,115,97,102,101,116,121,46,97,101,114,111,0,115,97,
+    103,97,46,115,97,103,97,46,106,112,0,115,97,103,97,101,
+    46,121,97,109,97,103,97,116,97,46,106,112,0,115,97,103,
+    97,109,105,104,97,114,97,46,107,97,110,97,103,97,119,97,
+    46,106,112,0,115,97,105,103,97,119,97,46,102,117,107,117,
+    111,107,97,46,106,112,0,115,97,105,106,111,46,101,104,105,
+    109,101,46,106,112,0,115,97,105,107,97,105,46,110,97,103,
+    97,115,97,107,105,46,106,112,0,115,97,105,107,105,46,111,
+    105,116,97,46,106,112,0,115,97,105,110,116,108,111,117,105,
+    115,46,109,117,115,101,117,109,0,115,97,105,116,97,109,97,
+    46,115,97,105,116,97,109,97,46,106,112,0,115,97,105,116,
+    111,46,109,105,121,97,122,97,107,105,46,106,112,0,115,97,
+    107,97,46,104,105,114,111,115,104,105,109,97,46,106,112,0,
+    115,97,107,97,100,111,46,115,97,105,116,97,109,97,46,106,
+    112,0,115,97,107,97,101,46,99,104,105,98,97,46,106,112,
+    0,115,97,107,97,101,46,110,97,103,97,110,111,46,106,112,
+    0,115,97,107,97,104,111,103,105,46,103,105,102,117,46,106,
+    112,0,115,97,107,97,105,46,102,117,107,117,105,46,106,112,
+    0,115,97,107,97,105,46,105,98,97,114,97,107,105,46,106,
+    112,0,115,97,107,97,105,46,111,115,97,107,97,46,106,112,
+    0,115,97,107,97,105,109,105,110,97,116,111,46,116,111,116,
+    116,111,114,105,46,106,112,0,115,97,107,97,107,105,46,110,
+    97,103,97,110,111,46,106,112,0,115,97,107,97,116,97,46,
+    121,97,109,97,103,97,116,97,46,106,112,0,115,97,107,97,
+    119,97,46,107,111,99,104,105,46,106,112,0,115,97,107,101,
+    103,97,119,97,46,121,97,109,97,103,97,116,97,46,106,112,
+    0,115,97,107,117,46,110,97,103,97,110,111,46,106,112,0,
+    115,97,107,117,104,111,46,110,97,103,97,110,111,46,106,112,
+    0,115,97,107,117,114,97,0,115,97,107,117,114,97,46,99,
+    104,105,98,97,46,106,112,0,115,97,107,117,114,97,46,116,
+    111,99,104,105,103,105,46,106,112,0,115,97,107,117,114,97,
+    103,97,119,97,46,105,98,97,114,97,107,105,46,106,112,0,
+    115,97,107,117,114,97,105,46,110,97,114,97,46,106,112,0,
+    115,97,107,121,111,46,107,121,111,116,111,46,106,112,0,115,
+    97,108,97,110,103,101,110,46,110,111,0,115,97,108,97,116,
+    46,110,111,0,115,97,108,101,0,115,97,108,101,109,46,109,
+    117,115,101,117,109,0,115,97,108,101,114,110,111,46,105,116,
+    0,115,97,108,111,110,0,115,97,108,116,100,97,108,46,110,
+    111,0,115,97,108,117,100,46,98,111,0,115,97,108,118,97,
+    100,111,114,46,98,114,0,115,97,108,118,97,100,111,114,100,
+    97,108,105,46,109,117,115,101,117,109,0,115,97,108,122,98,
+    117,114,103,46,109,117,115,101,117,109,0,115,97,109,101,103,
+    97,119,97,46,102,117,107,117,115,104,105,109,97,46,106,112,
+    0,115,97,109,110,97,110,103,101,114,46,110,111,0,115,97,
+    109,112,97,46,98,114,0,115,97,109,115,99,108,117,98,0,
+    115,97,109,115,117,110,103,0,115,97,109,117,107,97,119,97,
+    46,107,97,110,97,103,97,119,97,46,106,112,0,115,97,110,
+    97,103,111,99,104,105,46,116,111,107,117,115,104,105,109,97,
+    46,106,112,0,115,97,110,100,97,46,104,121,111,103,111,46,
+    106,112,0,115,97,110,100,99,97,116,115,46,105,111,0,115,
+    97,110,100,101,46,109,111,114,101,45,111,103,45,114,111,109,
+    115,100,97,108,46,110,111,0,115,97,110,100,101,46,109,195,
+    184,114,101,45,111,103,45,114,111,109,115,100,97,108,46,110,
+    111,0,115,97,110,100,101,46,118,101,115,116,102,111,108,100,
+    46,110,111,0,115,97,110,100,101,46,120,110,45,45,109,114,
+    101,45,111,103,45,114,111,109,115,100,97,108,45,113,113,98,
+    46,110,111,0,115,97,110,100,101,102,106,111,114,100,46,110,
+    111,0,115,97,110,100,105,101,103,111,46,109,117,115,101,117,
+    109,0,115,97,110,100,110,101,115,46,110,111,0,115,97,110,
+    100,110,101,115,115,106,111,101,110,46,110,111,0,115,97,110,
+    100,110,101,115,115,106,195,184,101,110,46,110,111,0,115,97,
+    110,100,111,121,46,110,111,0,115,97,110,100,118,105,107,0,
+    115,97,110,100,118,105,107,99,111,114,111,109,97,110,116,0,
+    115,97,110,100,195,184,121,46,110,111,0,115,97,110,102,114,
+    97,110,99,105,115,99,111,46,109,117,115,101,117,109,0,115,
+    97,110,103,111,46,110,97,114,97,46,106,112,0,115,97,110,
+    106,111,46,110,105,105,103,97,116,97,46,106,112,0,115,97,
+    110,110,97,110,46,104,121,111,103,111,46,106,112,0,115,97,
+    110,110,111,104,101,46,97,111,109,111,114,105,46,106,112,0,
+    115,97,110,111,46,116,111,99,104,105,103,105,46,106,112,0,
+    115,97,110,111,102,105,0,115,97,110,111,107,46,112,108,0,
+    115,97,110,116,97,98,97,114,98,97,114,97,46,109,117,115,
+    101,117,109,0,115,97,110,116,97,99,114,117,122,46,109,117,
+    115,101,117,109,0,115,97,110,116,97,102,101,46,109,117,115,
+    101,117,109,0,115,97,110,116,97,109,97,114,105,97,46,98,
+    114,0,115,97,110,116,111,97,110,100,114,101,46,98,114,0,
+    115,97,110,117,107,105,46,107,97,103,97,119,97,46,106,112,
+    0,115,97,111,98,101,114,110,97,114,100,111,46,98,114,0,
+    115,97,111,103,111,110,99,97,46,98,114,0,115,97,111,116,
+    111,109,101,46,115,116,0,115,97,112,0,115,97,114,46,105,
+    116,0,115,97,114,100,101,103,110,97,46,105,116,0,115,97,
+    114,100,105,110,105,97,46,105,116,0,115,97,114,108,0,115,
+    97,114,111,109,97,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,115,97,114,112,115,98,111,114,103,46,110,111,0,115,
+    97,114,117,102,117,116,115,117,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,115,97,115,0,115,97,115,97,103,117,114,
+    105,46,102,117,107,117,111,107,97,46,106,112,0,115,97,115,
+    97,121,97,109,97,46,104,121,111,103,111,46,106,112,0,115,
+    97,115,101,98,111,46,110,97,103,97,115,97,107,105,46,106,
+    112,0,115,97,115,107,97,116,99,104,101,119,97,110,46,109,
+    117,115,101,117,109,0,115,97,115,115,97,114,105,46,105,116,
+    0,115,97,116,111,115,104,111,46,111,107,97,121,97,109,97,
+    46,106,112,0,115,97,116,115,117,109,97,115,101,110,100,97,
+    105,46,107,97,103,111,115,104,105,109,97,46,106,112,0,115,
+    97,116,116,101,46,115,97,105,116,97,109,97,46,106,112,0,
+    115,97,116,120,46,109,117,115,101,117,109,0,115,97,117,100,
+    97,46,110,111,0,115,97,117,104,101,114,97,100,46,110,111,
+    0,115,97,118,97,110,110,97,104,103,97,46,109,117,115,101,
+    117,109,0,115,97,118,101,0,115,97,118,101,115,45,116,104,
+    101,45,119,104,97,108,101,115,46,99,111,109,0,115,97,118,
+    111,110,97,46,105,116,0,115,97,120,111,0,115,97,121,97,
+    109,97,46,111,115,97,107,97,46,106,112,0,115,97,121,97,
+    109,97,46,115,97,105,116,97,109,97,46,106,112,0,115,97,
+    121,111,46,104,121,111,103,111,46,106,112,0,115,98,46,117,
+    97,0,115,98,105,0,115,98,115,0,115,99,46,99,110,0,
+    115,99,46,103,111,118,46,98,114,0,115,99,46,107,101,0,
+    115,99,46,107,114,0,115,99,46,108,101,103,46,98,114,0,
+    115,99,46,108,115,0,115,99,46,116,122,0,115,99,46,117,
+    103,0,115,99,97,0,115,99,97,108,101,98,111,111,107,46,
+    115,99,119,46,99,108,111,117,100,0,115,99,98,0,115,99,
+    104,46,97,101,0,115,99,104,46,105,100,0,115,99,104,46,
+    105,114,0,115,99,104,46,106,111,0,115,99,104,46,108,107,
+    0,115,99,104,46,108,121,0,115,99,104,46,110,103,0,115,
+    99,104,46,113,97,0,115,99,104,46,115,97,0,115,99,104,
+    46,115,111,0,115,99,104,46,115,115,0,115,99,104,46,116,
+    102,0,115,99,104,46,117,107,0,115,99,104,46,119,102,0,
+    115,99,104,46,122,109,0,115,99,104,97,101,102,102,108,101,
+    114,0,115,99,104,108,101,115,105,115,99,104,101,115,46,109,
+    117,115,101,117,109,0,115,99,104,109,105,100,116,0,115,99,
+    104,111,101,110,98,114,117,110,110,46,109,117,115,101,117,109,
+    0,115,99,104,111,107,111,107,101,107,115,46,110,101,116,0,
+    115,99,104,111,107,111,108,97,100,101,110,46,109,117,115,101,
+    117,109,0,115,99,104,111,108,97,114,115,104,105,112,115,0,
+    115,99,104,111,111,108,0,115,99,104,111,111,108,46,109,117,
+    115,101,117,109,0,115,99,104,111,111,108,46,110,97,0,115,
+    99,104,111,111,108,46,110,122,0,115,99,104,111,111,108,46,
+    122,97,0,115,99,104,111,111,108,98,117,115,46,106,112,0,
+    115,99,104,111,111,108,115,46,110,115,119,46,101,100,117,46,
+    97,117,0,115,99,104,117,108,101,0,115,99,104,117,108,112,
+    108,97,116,116,102,111,114,109,46,100,101,0,115,99,104,117,
+    108,115,101,114,118,101,114,46,100,101,0,115,99,104,119,97,
+    114,122,0,115,99,104,119,101,105,122,46,109,117,115,101,117,
+    109,0,115,99,105,46,101,103,0,115,99,105,101,110,99,101,
+    45,102,105,99,116,105,111,110,46,109,117,115,101,117,109,0,
+    115,99,105,101,110,99,101,46,109,117,115,101,117,109,0,115,
+    99,105,101,110,99,101,97,110,100,104,105,115,116,111,114,121,
+    46,109,117,115,101,117,109,0,115,99,105,101,110,99,101,97,
+    110,100,105,110,100,117,115,116,114,121,46,109,117,115,101,117,
+    109,0,115,99,105,101,110,99,101,99,101,110,116,101,114,46,
+    109,117,115,101,117,109,0,115,99,105,101,110,99,101,99,101,
+    110,116,101,114,115,46,109,117,115,101,117,109,0,115,99,105,
+    101,110,99,101,104,105,115,116,111,114,121,46,109,117,115,101,
+    117,109,0,115,99,105,101,110,99,101,115,46,109,117,115,101,
+    117,109,0,115,99,105,101,110,99,101,115,110,97,116,117,114,
+    101,108,108,101,115,46,109,117,115,101,117,109,0,115,99,105,
+    101,110,116,105,115,116,46,97,101,114,111,0,115,99,111,116,
+    108,97,110,100,46,109,117,115,101,117,109,0,115,99,114,97,
+    112,112,101,114,45,115,105,116,101,46,110,101,116,0,115,99,
+    114,97,112,112,105,110,103,46,99,99,0,115,99,114,121,115,
+    101,99,46,99,111,109,0,115,100,46,99,110,0,115,100,110,
+    46,103,111,118,46,112,108,0,115,100,115,99,108,111,117,100,
+    46,112,108,0,115,101,46,101,117,46,111,114,103,0,115,101,
+    46,103,111,118,46,98,114,0,115,101,46,108,101,103,46,98,
+    114,0,115,101,46,110,101,116,0,115,101,97,112,111,114,116,
+    46,109,117,115,101,117,109,0,115,101,97,114,99,104,0,115,
+    101,97,116,0,115,101,98,97,115,116,111,112,111,108,46,117,
+    97,0,115,101,99,46,112,115,0,115,101,99,97,97,115,46,
+    104,107,0,115,101,99,114,101,116,46,106,112,0,115,101,99,
+    117,114,101,0,115,101,99,117,114,105,116,121,0,115,101,99,
+    117,114,105,116,121,116,97,99,116,105,99,115,46,99,111,109,
+    0,115,101,101,107,0,115,101,103,46,98,114,0,115,101,105,
+    100,97,116,46,110,101,116,0,115,101,105,104,105,46,110,97,
+    103,97,115,97,107,105,46,106,112,0,115,101,105,107,97,46,
+    107,121,111,116,111,46,106,112,0,115,101,105,114,111,46,110,
+    105,105,103,97,116,97,46,106,112,0,115,101,105,114,111,117,
+    46,110,105,105,103,97,116,97,46,106,112,0,115,101,105,121,
+    111,46,101,104,105,109,101,46,106,112,0,115,101,106,110,121,
+    46,112,108,0,115,101,107,100,49,46,98,101,101,98,121,116,
+    101,97,112,112,46,105,111,0,115,101,107,105,46,103,105,102,
+    117,46,106,112,0,115,101,107,105,103,97,104,97,114,97,46,
+    103,105,102,117,46,106,112,0,115,101,107,105,107,97,119,97,
+    46,110,105,105,103,97,116,97,46,106,112,0,115,101,108,46,
+    110,111,0,115,101,108,98,117,46,110,111,0,115,101,108,101,
+    99,116,0,115,101,108,102,105,112,46,98,105,122,0,115,101,
+    108,102,105,112,46,99,111,109,0,115,101,108,102,105,112,46,
+    105,110,102,111,0,115,101,108,102,105,112,46,110,101,116,0,
+    115,101,108,102,105,112,46,111,114,103,0,115,101,108,106,101,
+    46,110,111,0,115,101,108,106,111,114,100,46,110,111,0,115,
+    101,108,108,102,121,46,115,116,111,114,101,0,115,101,108,108,
+    115,45,102,111,114,45,108,101,115,115,46,99,111,109,0,115,
+    101,108,108,115,45,102,111,114,45,117,46,99,111,109,0,115,
+    101,108,108,115,45,105,116,46,110,101,116,0,115,101,108,108,
+    115,121,111,117,114,104,111,109,101,46,111,114,103,0,115,101,
+    109,98,111,107,117,46,97,107,105,116,97,46,106,112,0,115,
+    101,109,105,110,101,46,109,105,121,97,103,105,46,106,112,0,
+    115,101,110,97,115,97,46,97,114,0,115,101,110,101,114,0,
+    115,101,110,110,97,110,46,111,115,97,107,97,46,106,112,0,
+    115,101,110,115,101,101,114,105,110,103,46,110,101,116,0,115,
+    101,110,115,105,111,115,105,116,101,46,99,108,111,117,100,0,
+    115,101,111,117,108,46,107,114,0,115,101,114,97,46,104,105,
+    114,111,115,104,105,109,97,46,106,112,0,115,101,114,97,110,
+    105,115,104,105,46,104,105,114,111,115,104,105,109,97,46,106,
+    112,0,115,101,114,118,101,98,98,115,46,99,111,109,0,115,
+    101,114,118,101,98,98,115,46,110,101,116,0,115,101,114,118,
+    101,98,98,115,46,111,114,103,0,115,101,114,118,101,98,101,
+    101,114,46,99,111,109,0,115,101,114,118,101,98,108,111,103,
+    46,110,101,116,0,115,101,114,118,101,99,111,117,110,116,101,
+    114,115,116,114,105,107,101,46,99,111,109,0,115,101,114,118,
+    101,101,120,99,104,97,110,103,101,46,99,111,109,0,115,101,
+    114,118,101,102,116,112,46,99,111,109,0,115,101,114,118,101,
+    102,116,112,46,110,101,116,0,115,101,114,118,101,102,116,112,
+    46,111,114,103,0,115,101,114,118,101,103,97,109,101,46,99,
+    111,109,0,115,101,114,118,101,103,97,109,101,46,111,114,103,
+    0,115,101,114,118,101,104,97,108,102,108,105,102,101,46,99,
+    111,109,0,115,101,114,118,101,104,116,116,112,46,99,111,109,
+    0,115,101,114,118,101,104,117,109,111,117,114,46,99,111,109,
+    0,115,101,114,118,101,105,114,99,46,99,111,109,0,115,101,
+    114,118,101,109,105,110,101,99,114,97,102,116,46,110,101,116,
+    0,115,101,114,118,101,109,112,51,46,99,111,109,0,115,101,
+    114,118,101,112,50,112,46,99,111,109,0,115,101,114,118,101,
+    112,105,99,115,46,99,111,109,0,115,101,114,118,101,113,117,
+    97,107,101,46,99,111,109,0,115,101,114,118,101,114,115,46,
+    114,117,110,0,115,101,114,118,101,115,97,114,99,97,115,109,
+    46,99,111,109,0,115,101,114,118,105,99,101,46,103,111,118,
+    46,115,99,111,116,0,115,101,114,118,105,99,101,46,103,111,
+    118,46,117,107,0,115,101,114,118,105,99,101,46,111,110,101,
+    0,115,101,114,118,105,99,101,115,46,97,101,114,111,0,115,
+    101,116,97,103,97,121,97,46,116,111,107,121,111,46,106,112,
+    0,115,101,116,111,46,97,105,99,104,105,46,106,112,0,115,
+    101,116,111,117,99,104,105,46,111,107,97,121,97,109,97,46,
+    106,112,0,115,101,116,116,108,101,109,101,110,116,46,109,117,
+    115,101,117,109,0,115,101,116,116,108,101,114,115,46,109,117,
+    115,101,117,109,0,115,101,116,116,115,117,46,111,115,97,107,
+    97,46,106,112,0,115,101,118,97,115,116,111,112,111,108,46,
+    117,97,0,115,101,118,101,110,0,115,101,119,0,115,101,120,
+    0,115,101,120,46,104,117,0,115,101,120,46,112,108,0,115,
+    101,120,121,0,115,102,114,0,115,103,45,49,46,112,97,97,
+    115,46,109,97,115,115,105,118,101,103,114,105,100,46,110,101,
+    116,0,115,104,46,99,110,0,115,104,97,99,107,110,101,116,
+    46,110,117,0,115,104,97,107,111,116,97,110,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,115,104,97,110,103,114,105,
+    108,97,0,115,104,97,114,105,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,115,104,97,114,112,0,115,104,97,119,0,
+    115,104,101,108,108,0,115,104,101,108,108,46,109,117,115,101,
+    117,109,0,115,104,101,114,98,114,111,111,107,101,46,109,117,
+    115,101,117,109,0,115,104,105,97,0,115,104,105,98,97,116,
+    97,46,109,105,121,97,103,105,46,106,112,0,115,104,105,98,
+    97,116,97,46,110,105,105,103,97,116,97,46,106,112,0,115,
+    104,105,98,101,99,104,97,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,115,104,105,98,101,116,115,117,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,115,104,105,98,117,107,97,
+    119,97,46,103,117,110,109,97,46,106,112,0,115,104,105,98,
+    117,121,97,46,116,111,107,121,111,46,106,112,0,115,104,105,
+    99,104,105,107,97,115,104,117,107,117,46,109,105,121,97,103,
+    105,46,106,112,0,115,104,105,99,104,105,110,111,104,101,46,
+    97,111,109,111,114,105,46,106,112,0,115,104,105,102,116,99,
+    114,121,112,116,111,46,100,101,118,0,115,104,105,102,116,99,
+    114,121,112,116,111,46,105,111,0,115,104,105,102,116,101,100,
+    105,116,46,105,111,0,115,104,105,105,98,97,46,109,105,121,
+    97,122,97,107,105,46,106,112,0,115,104,105,106,111,110,97,
+    119,97,116,101,46,111,115,97,107,97,46,106,112,0,115,104,
+    105,107,97,46,105,115,104,105,107,97,119,97,46,106,112,0,
+    115,104,105,107,97,98,101,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,115,104,105,107,97,109,97,46,109,105,121,97,
+    103,105,46,106,112,0,115,104,105,107,97,111,105,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,115,104,105,107,97,116,
+    115,117,46,97,105,99,104,105,46,106,112,0,115,104,105,107,
+    105,46,115,97,105,116,97,109,97,46,106,112,0,115,104,105,
+    107,111,107,117,99,104,117,111,46,101,104,105,109,101,46,106,
+    112,0,115,104,105,107,115,104,97,0,115,104,105,109,97,46,
+    109,105,101,46,106,112,0,115,104,105,109,97,98,97,114,97,
+    46,110,97,103,97,115,97,107,105,46,106,112,0,115,104,105,
+    109,97,100,97,46,115,104,105,122,117,111,107,97,46,106,112,
+    0,115,104,105,109,97,109,97,107,105,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,115,104,105,109,97,109,111,116,111,
+    46,111,115,97,107,97,46,106,112,0,115,104,105,109,97,110,
+    101,46,115,104,105,109,97,110,101,46,106,112,0,115,104,105,
+    109,105,122,117,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,115,104,105,109,105,122,117,46,115,104,105,122,117,111,107,
+    97,46,106,112,0,115,104,105,109,111,100,97,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,115,104,105,109,111,100,97,
+    116,101,46,105,98,97,114,97,107,105,46,106,112,0,115,104,
+    105,109,111,102,117,115,97,46,99,104,105,98,97,46,106,112,
+    0,115,104,105,109,111,103,111,46,102,117,107,117,115,104,105,
+    109,97,46,106,112,0,115,104,105,109,111,105,99,104,105,46,
+    110,97,114,97,46,106,112,0,115,104,105,109,111,106,105,46,
+    111,107,105,110,97,119,97,46,106,112,0,115,104,105,109,111,
+    107,97,119,97,46,104,111,107,107,97,105,100,111,46,106,112,
+    0,115,104,105,109,111,107,105,116,97,121,97,109,97,46,110,
+    97,114,97,46,106,112,0,115,104,105,109,111,110,105,116,97,
+    46,103,117,110,109,97,46,106,112,0,115,104,105,109,111,110,
+    111,115,101,107,105,46,121,97,109,97,103,117,99,104,105,46,
+    106,112,0,115,104,105,109,111,115,117,119,97,46,110,97,103,
+    97,110,111,46,106,112,0,115,104,105,109,111,116,115,117,107,
+    101,46,116,111,99,104,105,103,105,46,106,112,0,115,104,105,
+    109,111,116,115,117,109,97,46,105,98,97,114,97,107,105,46,
+    106,112,0,115,104,105,110,97,103,97,119,97,46,116,111,107,
+    121,111,46,106,112,0,115,104,105,110,97,110,111,109,97,99,
+    104,105,46,110,97,103,97,110,111,46,106,112,0,115,104,105,
+    110,103,111,46,97,111,109,111,114,105,46,106,112,0,115,104,
+    105,110,103,117,46,102,117,107,117,111,107,97,46,106,112,0,
+    115,104,105,110,103,117,46,104,121,111,103,111,46,106,112,0,
+    115,104,105,110,103,117,46,119,97,107,97,121,97,109,97,46,
+    106,112,0,115,104,105,110,105,99,104,105,46,104,105,114,111,
+    115,104,105,109,97,46,106,112,0,115,104,105,110,106,111,46,
+    110,97,114,97,46,106,112,0,115,104,105,110,106,111,46,111,
+    107,97,121,97,109,97,46,106,112,0,115,104,105,110,106,111,
+    46,121,97,109,97,103,97,116,97,46,106,112,0,115,104,105,
+    110,106,117,107,117,46,116,111,107,121,111,46,106,112,0,115,
+    104,105,110,107,97,109,105,103,111,116,111,46,110,97,103,97,
+    115,97,107,105,46,106,112,0,115,104,105,110,111,110,115,101,
+    110,46,104,121,111,103,111,46,106,112,0,115,104,105,110,115,
+    104,105,110,111,116,115,117,46,104,111,107,107,97,105,100,111,
+    46,106,112,0,115,104,105,110,115,104,105,114,111,46,97,105,
+    99,104,105,46,106,112,0,115,104,105,110,116,111,46,103,117,
+    110,109,97,46,106,112,0,115,104,105,110,116,111,107,117,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,115,104,105,110,
+    116,111,109,105,46,109,105,121,97,122,97,107,105,46,106,112,
+    0,115,104,105,110,121,111,115,104,105,116,111,109,105,46,102,
+    117,107,117,111,107,97,46,106,112,0,115,104,105,111,103,97,
+    109,97,46,109,105,121,97,103,105,46,106,112,0,115,104,105,
+    111,106,105,114,105,46,110,97,103,97,110,111,46,106,112,0,
+    115,104,105,111,121,97,46,116,111,99,104,105,103,105,46,106,
+    112,0,115,104,105,114,97,104,97,109,97,46,119,97,107,97,
+    121,97,109,97,46,106,112,0,115,104,105,114,97,107,97,119,
+    97,46,102,117,107,117,115,104,105,109,97,46,106,112,0,115,
+    104,105,114,97,107,97,119,97,46,103,105,102,117,46,106,112,
+    0,115,104,105,114,97,107,111,46,99,104,105,98,97,46,106,
+    112,0,115,104,105,114,97,110,117,107,97,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,115,104,105,114,97,111,105,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,115,104,105,114,
+    97,111,107,97,46,115,97,105,116,97,109,97,46,106,112,0,
+    115,104,105,114,97,116,97,107,97,46,121,97,109,97,103,97,
+    116,97,46,106,112,0,115,104,105,114,105,117,99,104,105,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,115,104,105,114,
+    111,105,46,99,104,105,98,97,46,106,112,0,115,104,105,114,
+    111,105,115,104,105,46,109,105,121,97,103,105,46,106,112,0,
+    115,104,105,114,111,105,115,104,105,46,115,97,103,97,46,106,
+    112,0,115,104,105,114,111,115,97,116,111,46,105,98,97,114,
+    97,107,105,46,106,112,0,115,104,105,115,104,105,107,117,105,
+    46,116,111,107,117,115,104,105,109,97,46,106,112,0,115,104,
+    105,115,111,46,104,121,111,103,111,46,106,112,0,115,104,105,
+    115,117,105,46,99,104,105,98,97,46,106,112,0,115,104,105,
+    116,97,114,97,46,97,105,99,104,105,46,106,112,0,115,104,
+    105,119,97,46,105,119,97,116,101,46,106,112,0,115,104,105,
+    122,117,107,117,105,115,104,105,46,105,119,97,116,101,46,106,
+    112,0,115,104,105,122,117,111,107,97,46,115,104,105,122,117,
+    111,107,97,46,106,112,0,115,104,111,98,97,114,97,46,104,
+    105,114,111,115,104,105,109,97,46,106,112,0,115,104,111,101,
+    115,0,115,104,111,110,97,105,46,102,117,107,117,111,107,97,
+    46,106,112,0,115,104,111,110,97,105,46,121,97,109,97,103,
+    97,116,97,46,106,112,0,115,104,111,111,46,111,107,97,121,
+    97,109,97,46,106,112,0,115,104,111,112,46,98,114,101,110,
+    100,108,121,46,114,115,0,115,104,111,112,46,104,116,0,115,
+    104,111,112,46,104,117,0,115,104,111,112,46,112,108,0,115,
+    104,111,112,46,114,111,0,115,104,111,112,46,116,104,0,115,
+    104,111,112,97,114,101,110,97,46,112,108,0,115,104,111,112,
+    105,116,115,105,116,101,46,99,111,109,0,115,104,111,112,112,
+    105,110,103,0,115,104,111,112,115,101,108,101,99,116,46,110,
+    101,116,0,115,104,111,112,119,97,114,101,46,115,116,111,114,
+    101,0,115,104,111,117,106,105,0,115,104,111,119,0,115,104,
+    111,119,46,97,101,114,111,0,115,104,111,119,97,46,102,117,
+    107,117,115,104,105,109,97,46,106,112,0,115,104,111,119,97,
+    46,103,117,110,109,97,46,106,112,0,115,104,111,119,97,46,
+    121,97,109,97,110,97,115,104,105,46,106,112,0,115,104,111,
+    119,116,105,109,101,0,115,104,117,110,97,110,46,121,97,109,
+    97,103,117,99,104,105,46,106,112,0,115,104,119,46,105,111,
+    0,115,105,46,101,117,46,111,114,103,0,115,105,46,105,116,
+    0,115,105,98,101,110,105,107,46,109,117,115,101,117,109,0,
+    115,105,99,46,105,116,0,115,105,99,105,108,105,97,46,105,
+    116,0,115,105,99,105,108,121,46,105,116,0,115,105,101,108,
+    108,97,107,46,110,111,0,115,105,101,110,97,46,105,116,0,
+    115,105,103,100,97,108,46,110,111,0,115,105,105,105,116,101,
+    115,46,99,111,109,0,115,105,108,106,97,110,46,110,111,0,
+    115,105,108,107,0,115,105,108,107,46,109,117,115,101,117,109,
+    0,115,105,109,112,108,101,45,117,114,108,46,99,111,109,0,
+    115,105,109,112,108,101,115,105,116,101,46,99,111,109,0,115,
+    105,109,112,108,101,115,105,116,101,46,99,111,109,46,98,114,
+    0,115,105,109,112,108,101,115,105,116,101,46,103,114,0,115,
+    105,109,112,108,101,115,105,116,101,46,112,108,0,115,105,110,
+    97,0,115,105,110,97,97,112,112,46,99,111,109,0,115,105,
+    110,103,108,101,115,0,115,105,114,97,99,117,115,97,46,105,
+    116,0,115,105,114,100,97,108,46,110,111,0,115,105,116,101,
+    46,116,98,45,104,111,115,116,105,110,103,46,99,111,109,0,
+    115,105,116,101,46,116,114,97,110,115,105,112,46,109,101,0,
+    115,105,116,101,108,101,97,102,46,110,101,116,0,115,105,116,
+    101,115,46,115,116,97,116,105,99,46,108,97,110,100,0,115,
+    106,0,115,106,99,46,98,114,0,115,107,46,99,97,0,115,
+    107,46,101,117,46,111,114,103,0,115,107,97,110,105,116,46,
+    110,111,0,115,107,97,110,108,97,110,100,46,110,111,0,115,
+    107,97,117,110,46,110,111,0,115,107,101,100,115,109,111,46,
+    110,111,0,115,107,101,100,115,109,111,107,111,114,115,101,116,
+    46,110,111,0,115,107,105,0,115,107,105,46,109,117,115,101,
+    117,109,0,115,107,105,46,110,111,0,115,107,105,101,110,46,
+    110,111,0,115,107,105,101,114,118,97,46,110,111,0,115,107,
+    105,101,114,118,195,161,46,110,111,0,115,107,105,110,0,115,
+    107,105,112,116,118,101,116,46,110,111,0,115,107,106,97,107,
+    46,110,111,0,115,107,106,101,114,118,111,121,46,110,111,0,
+    115,107,106,101,114,118,195,184,121,46,110,111,0,115,107,106,
+    195,165,107,46,110,111,0,115,107,108,101,112,46,112,108,0,
+    115,107,111,46,103,111,118,46,112,108,0,115,107,111,99,122,
+    111,119,46,112,108,0,115,107,111,100,106,101,46,110,111,0,
+    115,107,111,108,101,46,109,117,115,101,117,109,0,115,107,121,
+    0,115,107,121,100,105,118,105,110,103,46,97,101,114,111,0,
+    115,107,121,103,101,97,114,97,112,112,46,99,111,109,0,115,
+    107,121,112,101,0,115,107,195,161,110,105,116,46,110,111,0,
+    115,107,195,165,110,108,97,110,100,46,110,111,0,115,108,97,
+    115,107,46,112,108,0,115,108,97,116,116,117,109,46,110,111,
+    0,115,108,100,46,100,111,0,115,108,100,46,112,97,0,115,
+    108,103,46,98,114,0,115,108,105,110,103,0,115,108,117,112,
+    115,107,46,112,108,0,115,108,122,46,98,114,0,115,109,0,
+    115,109,46,117,97,0,115,109,97,108,108,45,119,101,98,46,
+    111,114,103,0,115,109,97,114,116,0,115,109,97,114,116,108,
+    97,98,101,108,105,110,103,46,115,99,119,46,99,108,111,117,
+    100,0,115,109,105,108,101,0,115,109,111,108,97,46,110,111,
+    0,115,109,117,115,104,99,100,110,46,99,111,109,0,115,109,
+    195,184,108,97,46,110,111,0,115,110,46,99,110,0,115,110,
+    97,97,115,101,46,110,111,0,115,110,97,115,97,46,110,111,
+    0,115,110,99,102,0,115,110,105,108,108,102,106,111,114,100,
+    46,110,111,0,115,110,111,97,115,97,46,110,111,0,115,110,
+    195,165,97,115,101,46,110,111,0,115,110,195,165,115,97,46,
+    110,111,0,115,111,46,103,111,118,46,112,108,0,115,111,46,
+    105,116,0,115,111,98,101,116,115,117,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,115,111,99,46,100,122,0,115,111,
+    99,46,108,107,0,115,111,99,46,115,114,99,102,46,110,101,
+    116,0,115,111,99,99,101,114,0,115,111,99,104,105,46,115,
+    117,0,115,111,99,105,97,108,0,115,111,99,105,101,116,121,
+    46,109,117,115,101,117,109,0,115,111,100,101,103,97,117,114,
+    97,46,99,104,105,98,97,46,106,112,0,115,111,101,100,97,
+    46,102,117,107,117,111,107,97,46,106,112,0,115,111,102,116,
+    98,97,110,107,0,115,111,102,116,119,97,114,101,0,115,111,
+    102,116,119,97,114,101,46,97,101,114,111,0,115,111,103,110,
+    100,97,108,46,110,111,0,115,111,103,110,101,46,110,111,0,
+    115,111,104,117,0,115,111,106,97,46,111,107,97,121,97,109,
+    97,46,106,112,0,115,111,107,97,46,115,97,105,116,97,109,
+    97,46,106,112,0,115,111,107,110,100,97,108,46,110,111,0,
+    115,111,108,97,46,110,111,0,115,111,108,97,114,0,115,111,
+    108,111,103,110,101,46,109,117,115,101,117,109,0,115,111,108,
+    117,110,100,46,110,111,0,115,111,109,97,46,102,117,107,117,
+    115,104,105,109,97,46,106,112,0,115,111,109,110,97,46,110,
+    111,0,115,111,110,100,114,101,45,108,97,110,100,46,110,111,
+    0,115,111,110,100,114,105,111,46,105,116,0,115,111,110,103,
+    0,115,111,110,103,100,97,108,101,110,46,110,111,0,115,111,
+    110,105,46,110,97,114,97,46,106,112,0,115,111,110,121,0,
+    115,111,111,46,107,97,103,111,115,104,105,109,97,46,106,112,
+    0,115,111,112,111,116,46,112,108,0,115,111,114,45,97,117,
+    114,100,97,108,46,110,111,0,115,111,114,45,102,114,111,110,
+    46,110,111,0,115,111,114,45,111,100,97,108,46,110,111,0,
+    115,111,114,45,118,97,114,97,110,103,101,114,46,110,111,0,
+    115,111,114,102,111,108,100,46,110,111,0,115,111,114,111,99,
+    97,98,97,46,98,114,0,115,111,114,114,101,105,115,97,46,
+    110,111,0,115,111,114,116,108,97,110,100,46,110,111,0,115,
+    111,114,117,109,46,110,111,0,115,111,115,46,112,108,0,115,
+    111,115,97,46,99,104,105,98,97,46,106,112,0,115,111,115,
+    110,111,119,105,101,99,46,112,108,0,115,111,117,110,100,97,
+    110,100,118,105,115,105,111,110,46,109,117,115,101,117,109,0,
+    115,111,117,110,100,99,97,115,116,46,109,101,0,115,111,117,
+    116,104,99,97,114,111,108,105,110,97,46,109,117,115,101,117,
+    109,0,115,111,117,116,104,119,101,115,116,46,109,117,115,101,
+    117,109,0,115,111,119,97,46,105,98,97,114,97,107,105,46,
+    106,112,0,115,111,121,0,115,112,46,103,111,118,46,98,114,
+    0,115,112,46,105,116,0,115,112,46,108,101,103,46,98,114,
+    0,115,112,97,0,115,112,97,99,101,45,116,111,45,114,101,
+    110,116,46,99,111,109,0,115,112,97,99,101,46,109,117,115,
+    101,117,109,0,115,112,97,99,101,107,105,116,46,105,111,0,
+    115,112,98,46,114,117,0,115,112,98,46,115,117,0,115,112,
+    100,110,115,46,100,101,0,115,112,100,110,115,46,101,117,0,
+    115,112,100,110,115,46,111,114,103,0,115,112,101,99,116,114,
+    117,109,46,109,121,106,105,110,111,46,114,117,0,115,112,104,
+    105,110,120,46,109,121,116,104,105,99,45,98,101,97,115,116,
+    115,46,99,111,109,0,115,112,106,101,108,107,97,118,105,107,
+    46,110,111,0,115,112,111,114,116,0,115,112,111,114,116,46,
+    104,117,0,115,112,111,116,0,115,112,121,46,109,117,115,101,
+    117,109,0,115,112,121,100,101,98,101,114,103,46,110,111,0,
+    115,113,117,97,114,101,46,109,117,115,101,117,109,0,115,113,
+    117,97,114,101,55,46,99,104,0,115,113,117,97,114,101,55,
+    46,100,101,0,115,113,117,97,114,101,55,46,110,101,116,0,
+    115,114,0,115,114,46,103,111,118,46,112,108,0,115,114,46,
+    105,116,0,115,114,104,116,46,115,105,116,101,0,115,114,108,
+    0,115,114,118,46,98,114,0,115,115,46,105,116,0,115,115,
+    108,46,111,114,105,103,105,110,46,99,100,110,55,55,45,115,
+    101,99,117,114,101,46,111,114,103,0,115,116,97,98,97,46,
+    106,112,0,115,116,97,99,107,104,101,114,111,45,110,101,116,
+    119,111,114,107,46,99,111,109,0,115,116,97,100,97,0,115,
+    116,97,100,116,46,109,117,115,101,117,109,0,115,116,97,103,
+    101,46,110,111,100,101,97,114,116,46,105,111,0,115,116,97,
+    103,105,110,103,46,111,110,114,101,100,46,111,110,101,0,115,
+    116,97,108,98,97,110,115,46,109,117,115,101,117,109,0,115,
+    116,97,108,111,119,97,45,119,111,108,97,46,112,108,0,115,
+    116,97,110,103,101,46,110,111,0,115,116,97,112,108,101,115,
+    0,115,116,97,114,0,115,116,97,114,97,99,104,111,119,105,
+    99,101,46,112,108,0,115,116,97,114,103,97,114,100,46,112,
+    108,0,115,116,97,114,110,98,101,114,103,46,109,117,115,101,
+    117,109,0,115,116,97,114,111,115,116,119,111,46,103,111,118,
+    46,112,108,0,115,116,97,116,46,110,111,0,115,116,97,116,
+    101,46,109,117,115,101,117,109,0,115,116,97,116,101,98,97,
+    110,107,0,115,116,97,116,101,102,97,114,109,0,115,116,97,
+    116,101,111,102,100,101,108,97,119,97,114,101,46,109,117,115,
+    101,117,109,0,115,116,97,116,104,101,108,108,101,46,110,111,
+    0,115,116,97,116,105,99,45,97,99,99,101,115,115,46,110,
+    101,116,0,115,116,97,116,105,99,46,111,98,115,101,114,118,
+    97,98,108,101,117,115,101,114,99,111,110,116,101,110,116,46,
+    99,111,109,0,115,116,97,116,105,99,115,46,99,108,111,117,
+    100,0,115,116,97,116,105,111,110,46,109,117,115,101,117,109,
+    0,115,116,97,118,97,110,103,101,114,46,110,111,0,115,116,
+    97,118,101,114,110,46,110,111,0,115,116,99,0,115,116,99,
+    103,114,111,117,112,0,115,116,101,97,109,46,109,117,115,101,
+    117,109,0,115,116,101,105,101,114,109,97,114,107,46,109,117,
+    115,101,117,109,0,115,116,101,105,103,101,110,46,110,111,0,
+    115,116,101,105,110,107,106,101,114,46,110,111,0,115,116,103,
+    45,98,117,105,108,100,101,114,46,99,111,100,101,46,99,111,
+    109,0,115,116,103,46,100,101,118,0,115,116,103,115,116,97,
+    103,101,46,100,101,118,0,115,116,104,46,97,99,46,97,116,
+    0,115,116,106,111,104,110,46,109,117,115,101,117,109,0,115,
+    116,106,111,114,100,97,108,46,110,111,0,115,116,106,111,114,
+    100,97,108,115,104,97,108,115,101,110,46,110,111,0,115,116,
+    106,195,184,114,100,97,108,46,110,111,0,115,116,106,195,184,
+    114,100,97,108,115,104,97,108,115,101,110,46,110,111,0,115,
+    116,111,99,107,104,111,108,109,0,115,116,111,99,107,104,111,
+    108,109,46,109,117,115,101,117,109,0,115,116,111,107,107,101,
+    46,110,111,0,115,116,111,108,111,115,46,105,111,0,115,116,
+    111,114,45,101,108,118,100,97,108,46,110,111,0,115,116,111,
+    114,97,103,101,0,115,116,111,114,97,103,101,46,121,97,110,
+    100,101,120,99,108,111,117,100,46,110,101,116,0,115,116,111,
+    114,100,46,110,111,0,115,116,111,114,100,97,108,46,110,111,
+    0,115,116,111,114,101,46,98,98,0,115,116,111,114,101,46,
+    100,107,0,115,116,111,114,101,46,110,102,0,115,116,111,114,
+    101,46,114,111,0,115,116,111,114,101,46,115,116,0,115,116,
+    111,114,101,46,118,101,0,115,116,111,114,101,98,97,115,101,
+    46,115,116,111,114,101,0,115,116,111,114,102,106,111,114,100,
+    46,110,111,0,115,116,111,114,106,46,102,97,114,109,0,115,
+    116,112,101,116,101,114,115,98,117,114,103,46,109,117,115,101,
+    117,109,0,115,116,114,97,110,100,46,110,111,0,115,116,114,
+    97,110,100,97,46,110,111,0,115,116,114,101,97,109,0,115,
+    116,114,101,97,109,108,105,116,46,97,112,112,0,115,116,114,
+    101,97,109,108,105,116,97,112,112,46,99,111,109,0,115,116,
+    114,105,112,112,101,114,46,106,112,0,115,116,114,121,110,46,
+    110,111,0,115,116,117,100,101,110,116,46,97,101,114,111,0,
+    115,116,117,100,105,111,0,115,116,117,100,121,0,115,116,117,
+    102,102,45,52,45,115,97,108,101,46,111,114,103,0,115,116,
+    117,102,102,45,52,45,115,97,108,101,46,117,115,0,115,116,
+    117,102,102,116,111,114,101,97,100,46,99,111,109,0,115,116,
+    117,116,116,103,97,114,116,46,109,117,115,101,117,109,0,115,
+    116,121,108,101,0,115,117,46,112,97,98,97,46,115,101,0,
+    115,117,98,46,106,112,0,115,117,99,107,115,0,115,117,101,
+    46,102,117,107,117,111,107,97,46,106,112,0,115,117,101,100,
+    116,105,114,111,108,46,105,116,0,115,117,103,105,110,97,109,
+    105,46,116,111,107,121,111,46,106,112,0,115,117,103,105,116,
+    111,46,115,97,105,116,97,109,97,46,106,112,0,115,117,105,
+    102,117,46,105,98,97,114,97,107,105,46,106,112,0,115,117,
+    105,115,115,101,46,109,117,115,101,117,109,0,115,117,105,116,
+    97,46,111,115,97,107,97,46,106,112,0,115,117,107,97,103,
+    97,119,97,46,102,117,107,117,115,104,105,109,97,46,106,112,
+    0,115,117,107,117,109,111,46,107,111,99,104,105,46,106,112,
+    0,115,117,108,97,46,110,111,0,115,117,108,100,97,108,46,
+    110,111,0,115,117,108,105,46,104,117,0,115,117,109,105,100,
+    97,46,116,111,107,121,111,46,106,112,0,115,117,109,105,116,
+    97,46,105,119,97,116,101,46,106,112,0,115,117,109,111,116,
+    111,46,104,121,111,103,111,46,106,112,0,115,117,109,111,116,
+    111,46,107,117,109,97,109,111,116,111,46,106,112,0,115,117,
+    109,121,46,117,97,0,115,117,110,97,103,97,119,97,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,115,117,110,100,46,
+    110,111,0,115,117,110,110,100,97,108,46,110,111,0,115,117,
+    110,110,121,100,97,121,46,106,112,0,115,117,112,97,98,97,
+    115,101,46,99,111,0,115,117,112,97,98,97,115,101,46,105,
+    110,0,115,117,112,97,98,97,115,101,46,110,101,116,0,115,
+    117,112,101,114,115,97,108,101,46,106,112,0,115,117,112,112,
+    108,105,101,115,0,115,117,112,112,108,121,0,115,117,114,102,
+    0,115,117,114,103,101,111,110,115,104,97,108,108,46,109,117,
+    115,101,117,109,0,115,117,114,103,101,114,121,0,115,117,114,
+    110,97,100,97,108,46,110,111,0,115,117,114,114,101,121,46,
+    109,117,115,101,117,109,0,115,117,115,97,107,105,46,107,111,
+    99,104,105,46,106,112,0,115,117,115,111,110,111,46,115,104,
+    105,122,117,111,107,97,46,106,112,0,115,117,119,97,46,110,
+    97,103,97,110,111,46,106,112,0,115,117,119,97,108,107,105,
+    46,112,108,0,115,117,122,97,107,97,46,110,97,103,97,110,
+    111,46,106,112,0,115,117,122,117,46,105,115,104,105,107,97,
+    119,97,46,106,112,0,115,117,122,117,107,97,46,109,105,101,
+    46,106,112,0,115,117,122,117,107,105,0,115,118,46,105,116,
+    0,115,118,99,46,102,105,114,101,110,101,116,46,99,104,0,
+    115,118,101,105,111,46,110,111,0,115,118,101,108,118,105,107,
+    46,110,111,0,115,118,105,122,122,101,114,97,46,109,117,115,
+    101,117,109,0,115,118,110,45,114,101,112,111,115,46,100,101,
+    0,115,119,97,116,99,104,0,115,119,101,100,101,110,46,109,
+    117,115,101,117,109,0,115,119,101,101,116,112,101,112,112,101,
+    114,46,111,114,103,0,115,119,105,100,110,105,99,97,46,112,
+    108,0,115,119,105,100,110,105,107,46,112,108,0,115,119,105,
+    101,98,111,100,122,105,110,46,112,108,0,115,119,105,110,111,
+    117,106,115,99,105,101,46,112,108,0,115,119,105,115,115,0,
+    115,120,46,99,110,0,115,121,100,110,101,121,0,115,121,100,
+    110,101,121,46,109,117,115,101,117,109,0,115,121,107,107,121,
+    108,118,101,110,46,110,111,0,115,121,110,99,108,111,117,100,
+    46,105,116,0,115,121,110,111,45,100,115,46,100,101,0,115,
+    121,110,111,108,111,103,121,45,100,105,115,107,115,116,97,116,
+    105,111,110,46,100,101,0,115,121,110,111,108,111,103,121,45,
+    100,115,46,100,101,0,115,121,110,111,108,111,103,121,46,109,
+    101,0,115,121,115,46,113,99,120,46,105,111,0,115,121,116,
+    101,115,46,110,101,116,0,115,122,99,122,101,99,105,110,46,
+    112,108,0,115,122,99,122,121,116,110,111,46,112,108,0,115,
+    122,101,120,46,104,117,0,115,122,107,111,108,97,46,112,108,
+    0,115,195,161,108,97,116,46,110,111,0,115,195,161,108,195,
+    161,116,46,110,111,0,115,195,184,103,110,101,46,110,111,0,
+    115,195,184,109,110,97,46,110,111,0,115,195,184,110,100,114,
+    101,45,108,97,110,100,46,110,111,0,115,195,184,114,45,97,
+    117,114,100,97,108,46,110,111,0,115,195,184,114,45,102,114,
+    111,110,46,110,111,0,115,195,184,114,45,111,100,97,108,46,
+    110,111,0,115,195,184,114,45,118,97,114,97,110,103,101,114,
+    46,110,111,0,115,195,184,114,102,111,108,100,46,110,111,0,
+    115,195,184,114,114,101,105,115,97,46,110,111,0,115,195,184,
+    114,117,109,46,110,111,0,115,195,188,100,116,105,114,111,108,
+    46,105,116,0,116,46,98,103,0,116,46,115,101,0,116,51,
+    108,51,112,48,114,116,46,110,101,116,0,116,97,46,105,116,
+    0,116,97,97,46,105,116,0,116,97,98,0,116,97,98,97,
+    121,97,109,97,46,121,97,109,97,110,97,115,104,105,46,106,
+    112,0,116,97,98,105,116,111,114,100,101,114,46,99,111,46,
+    105,108,0,116,97,98,117,115,101,46,121,97,109,97,103,117,
+    99,104,105,46,106,112,0,116,97,99,104,105,97,114,97,105,
+    46,102,117,107,117,111,107,97,46,106,112,0,116,97,99,104,
+    105,107,97,119,97,46,116,111,107,121,111,46,106,112,0,116,
+    97,100,97,111,107,97,46,111,115,97,107,97,46,106,112,0,
+    116,97,100,111,46,109,105,101,46,106,112,0,116,97,100,111,
+    116,115,117,46,107,97,103,97,119,97,46,106,112,0,116,97,
+    103,97,106,111,46,109,105,121,97,103,105,46,106,112,0,116,
+    97,103,97,109,105,46,110,105,105,103,97,116,97,46,106,112,
+    0,116,97,103,97,119,97,46,102,117,107,117,111,107,97,46,
+    106,112,0,116,97,104,97,114,97,46,97,105,99,104,105,46,
+    106,112,0,116,97,105,102,117,110,45,100,110,115,46,100,101,
+    0,116,97,105,106,105,46,119,97,107,97,121,97,109,97,46,
+    106,112,0,116,97,105,107,105,46,104,111,107,107,97,105,100,
+    111,46,106,112,0,116,97,105,107,105,46,109,105,101,46,106,
+    112,0,116,97,105,110,97,105,46,110,105,105,103,97,116,97,
+    46,106,112,0,116,97,105,112,101,105,0,116,97,105,114,97,
+    46,116,111,121,97,109,97,46,106,112,0,116,97,105,115,104,
+    105,46,104,121,111,103,111,46,106,112,0,116,97,105,115,104,
+    105,46,111,115,97,107,97,46,106,112,0,116,97,105,115,104,
+    105,110,46,102,117,107,117,115,104,105,109,97,46,106,112,0,
+    116,97,105,116,111,46,116,111,107,121,111,46,106,112,0,116,
+    97,105,119,97,46,109,105,121,97,103,105,46,106,112,0,116,
+    97,106,105,109,105,46,103,105,102,117,46,106,112,0,116,97,
+    106,105,114,105,46,111,115,97,107,97,46,106,112,0,116,97,
+    107,97,46,104,121,111,103,111,46,106,112,0,116,97,107,97,
+    103,105,46,110,97,103,97,110,111,46,106,112,0,116,97,107,
+    97,104,97,103,105,46,105,98,97,114,97,107,105,46,106,112,
+    0,116,97,107,97,104,97,109,97,46,97,105,99,104,105,46,
+    106,112,0,116,97,107,97,104,97,109,97,46,102,117,107,117,
+    105,46,106,112,0,116,97,107,97,104,97,114,117,46,109,105,
+    121,97,122,97,107,105,46,106,112,0,116,97,107,97,104,97,
+    115,104,105,46,111,107,97,121,97,109,97,46,106,112,0,116,
+    97,107,97,104,97,116,97,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,116,97,107,97,105,115,104,105,46,111,115,97,
+    107,97,46,106,112,0,116,97,107,97,109,97,116,115,117,46,
+    107,97,103,97,119,97,46,106,112,0,116,97,107,97,109,111,
+    114,105,46,107,117,109,97,109,111,116,111,46,106,112,0,116,
+    97,107,97,109,111,114,105,46,110,97,103,97,110,111,46,106,
+    112,0,116,97,107,97,110,97,98,101,46,109,105,121,97,122,
+    97,107,105,46,106,112,0,116,97,107,97,110,101,122,97,119,
+    97,46,116,111,99,104,105,103,105,46,106,112,0,116,97,107,
+    97,111,107,97,46,116,111,121,97,109,97,46,106,112,0,116,
+    97,107,97,114,97,122,117,107,97,46,104,121,111,103,111,46,
+    106,112,0,116,97,107,97,115,97,103,111,46,104,121,111,103,
+    111,46,106,112,0,116,97,107,97,115,97,107,105,46,103,117,
+    110,109,97,46,106,112,0,116,97,107,97,115,104,105,109,97,
+    46,115,104,105,103,97,46,106,112,0,116,97,107,97,115,117,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,97,107,
+    97,116,97,46,102,117,107,117,111,107,97,46,106,112,0,116,
+    97,107,97,116,111,114,105,46,110,97,114,97,46,106,112,0,
+    116,97,107,97,116,115,117,107,105,46,111,115,97,107,97,46,
+    106,112,0,116,97,107,97,116,115,117,107,105,46,115,104,105,
+    103,97,46,106,112,0,116,97,107,97,121,97,109,97,46,103,
+    105,102,117,46,106,112,0,116,97,107,97,121,97,109,97,46,
+    103,117,110,109,97,46,106,112,0,116,97,107,97,121,97,109,
+    97,46,110,97,103,97,110,111,46,106,112,0,116,97,107,97,
+    122,97,107,105,46,109,105,121,97,122,97,107,105,46,106,112,
+    0,116,97,107,101,104,97,114,97,46,104,105,114,111,115,104,
+    105,109,97,46,106,112,0,116,97,107,101,116,97,46,111,105,
+    116,97,46,106,112,0,116,97,107,101,116,111,109,105,46,111,
+    107,105,110,97,119,97,46,106,112,0,116,97,107,105,46,109,
+    105,101,46,106,112,0,116,97,107,105,107,97,119,97,46,104,
+    111,107,107,97,105,100,111,46,106,112,0,116,97,107,105,110,
+    111,46,104,121,111,103,111,46,106,112,0,116,97,107,105,110,
+    111,117,101,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    116,97,107,107,111,46,97,111,109,111,114,105,46,106,112,0,
+    116,97,107,111,46,99,104,105,98,97,46,106,112,0,116,97,
+    107,117,46,115,97,103,97,46,106,112,0,116,97,108,107,0,
+    116,97,109,97,46,116,111,107,121,111,46,106,112,0,116,97,
+    109,97,107,97,119,97,46,102,117,107,117,115,104,105,109,97,
+    46,106,112,0,116,97,109,97,107,105,46,109,105,101,46,106,
+    112,0,116,97,109,97,109,117,114,97,46,103,117,110,109,97,
+    46,106,112,0,116,97,109,97,110,111,46,111,107,97,121,97,
+    109,97,46,106,112,0,116,97,109,97,116,115,117,107,117,114,
+    105,46,105,98,97,114,97,107,105,46,106,112,0,116,97,109,
+    97,121,117,46,115,104,105,109,97,110,101,46,106,112,0,116,
+    97,109,98,97,46,104,121,111,103,111,46,106,112,0,116,97,
+    110,97,46,110,111,0,116,97,110,97,98,101,46,107,121,111,
+    116,111,46,106,112,0,116,97,110,97,98,101,46,119,97,107,
+    97,121,97,109,97,46,106,112,0,116,97,110,97,103,117,114,
+    97,46,102,117,107,117,115,104,105,109,97,46,106,112,0,116,
+    97,110,97,110,103,101,114,46,110,111,0,116,97,110,107,46,
+    109,117,115,101,117,109,0,116,97,110,111,104,97,116,97,46,
+    105,119,97,116,101,46,106,112,0,116,97,111,98,97,111,0,
+    116,97,114,97,46,115,97,103,97,46,106,112,0,116,97,114,
+    97,109,97,46,111,107,105,110,97,119,97,46,106,112,0,116,
+    97,114,97,110,116,111,46,105,116,0,116,97,114,103,101,116,
+    0,116,97,114,103,105,46,112,108,0,116,97,114,110,111,98,
+    114,122,101,103,46,112,108,0,116,97,114,117,105,46,103,105,
+    102,117,46,106,112,0,116,97,114,117,109,105,122,117,46,107,
+    97,103,111,115,104,105,109,97,46,106,112,0,116,97,115,46,
+    97,117,0,116,97,115,46,101,100,117,46,97,117,0,116,97,
+    115,46,103,111,118,46,97,117,0,116,97,115,104,107,101,110,
+    116,46,115,117,0,116,97,116,97,109,111,116,111,114,115,0,
+    116,97,116,97,114,0,116,97,116,101,98,97,121,97,115,104,
+    105,46,103,117,110,109,97,46,106,112,0,116,97,116,101,115,
+    104,105,110,97,46,110,97,103,97,110,111,46,106,112,0,116,
+    97,116,101,121,97,109,97,46,99,104,105,98,97,46,106,112,
+    0,116,97,116,101,121,97,109,97,46,116,111,121,97,109,97,
+    46,106,112,0,116,97,116,115,117,110,111,46,104,121,111,103,
+    111,46,106,112,0,116,97,116,115,117,110,111,46,110,97,103,
+    97,110,111,46,106,112,0,116,97,116,116,111,111,0,116,97,
+    119,97,114,97,109,111,116,111,46,110,97,114,97,46,106,112,
+    0,116,97,120,0,116,97,120,105,0,116,97,120,105,46,98,
+    114,0,116,99,46,98,114,0,116,99,105,0,116,99,109,46,
+    109,117,115,101,117,109,0,116,99,112,52,46,109,101,0,116,
+    100,107,0,116,101,46,105,116,0,116,101,46,117,97,0,116,
+    101,97,99,104,101,115,45,121,111,103,97,46,99,111,109,0,
+    116,101,99,46,98,114,0,116,101,99,46,109,105,46,117,115,
+    0,116,101,99,46,118,101,0,116,101,99,104,0,116,101,99,
+    104,46,111,114,97,110,103,101,0,116,101,99,104,110,111,108,
+    111,103,121,46,109,117,115,101,117,109,0,116,101,99,110,111,
+    108,111,103,105,97,46,98,111,0,116,101,108,0,116,101,108,
+    46,116,114,0,116,101,108,101,46,97,109,117,110,101,46,111,
+    114,103,0,116,101,108,101,98,105,116,46,97,112,112,0,116,
+    101,108,101,98,105,116,46,105,111,0,116,101,108,101,98,105,
+    116,46,120,121,122,0,116,101,108,101,107,111,109,109,117,110,
+    105,107,97,116,105,111,110,46,109,117,115,101,117,109,0,116,
+    101,108,101,118,105,115,105,111,110,46,109,117,115,101,117,109,
+    0,116,101,109,97,115,101,107,0,116,101,109,112,45,100,110,
+    115,46,99,111,109,0,116,101,109,112,105,111,45,111,108,98,
+    105,97,46,105,116,0,116,101,109,112,105,111,111,108,98,105,
+    97,46,105,116,0,116,101,109,112,117,114,108,46,104,111,115,
+    116,0,116,101,110,100,111,46,121,97,109,97,103,97,116,97,
+    46,106,112,0,116,101,110,101,105,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,116,101,110,107,97,119,97,46,110,
+    97,114,97,46,106,112,0,116,101,110,110,105,115,0,116,101,
+    110,114,105,46,110,97,114,97,46,106,112,0,116,101,111,46,
+    98,114,0,116,101,114,97,109,111,46,105,116,0,116,101,114,
+    109,101,122,46,115,117,0,116,101,114,110,105,46,105,116,0,
+    116,101,114,110,111,112,105,108,46,117,97,0,116,101,115,104,
+    105,107,97,103,97,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,116,101,115,116,45,105,115,101,114,118,46,100,101,0,
+    116,101,115,116,46,114,117,0,116,101,115,116,46,116,106,0,
+    116,101,118,97,0,116,101,120,97,115,46,109,117,115,101,117,
+    109,0,116,101,120,116,105,108,101,46,109,117,115,101,117,109,
+    0,116,103,0,116,103,111,114,121,46,112,108,0,116,104,100,
+    0,116,104,101,46,98,114,0,116,104,101,97,116,101,114,0,
+    116,104,101,97,116,101,114,46,109,117,115,101,117,109,0,116,
+    104,101,97,116,114,101,0,116,104,101,115,104,111,112,46,106,
+    112,0,116,104,101,119,111,114,107,112,99,46,99,111,109,0,
+    116,104,105,99,107,46,106,112,0,116,104,105,110,103,100,117,
+    115,116,100,97,116,97,46,99,111,109,0,116,104,114,117,104,
+    101,114,101,46,110,101,116,0,116,105,97,97,0,116,105,99,
+    107,101,116,115,0,116,105,99,107,101,116,115,46,105,111,0,
+    116,105,101,110,100,97,0,116,105,102,102,97,110,121,0,116,
+    105,109,101,46,109,117,115,101,117,109,0,116,105,109,101,46,
+    110,111,0,116,105,109,101,107,101,101,112,105,110,103,46,109,
+    117,115,101,117,109,0,116,105,110,103,118,111,108,108,46,110,
+    111,0,116,105,110,110,46,110,111,0,116,105,112,115,0,116,
+    105,114,101,115,0,116,105,114,111,108,0,116,106,46,99,110,
+    0,116,106,101,108,100,115,117,110,100,46,110,111,0,116,106,
+    109,97,120,120,0,116,106,111,109,101,46,110,111,0,116,106,
+    120,0,116,106,195,184,109,101,46,110,111,0,116,107,0,116,
+    107,109,97,120,120,0,116,107,115,97,116,46,98,111,0,116,
+    108,111,110,46,110,101,116,119,111,114,107,0,116,109,46,99,
+    121,0,116,109,46,100,122,0,116,109,46,102,114,0,116,109,
+    46,104,117,0,116,109,46,107,109,0,116,109,46,109,99,0,
+    116,109,46,109,103,0,116,109,46,112,108,0,116,109,46,114,
+    111,0,116,109,46,115,101,0,116,109,46,122,97,0,116,109,
+    97,108,108,0,116,109,112,46,98,114,0,116,110,46,105,116,
+    0,116,110,46,111,120,97,46,99,108,111,117,100,0,116,111,
+    46,103,111,118,46,98,114,0,116,111,46,103,116,0,116,111,
+    46,105,116,0,116,111,46,108,101,103,46,98,114,0,116,111,
+    46,109,100,0,116,111,98,97,46,109,105,101,46,106,112,0,
+    116,111,98,101,46,101,104,105,109,101,46,106,112,0,116,111,
+    98,101,116,115,117,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,116,111,98,105,115,104,105,109,97,46,97,105,99,104,
+    105,46,106,112,0,116,111,99,104,105,103,105,46,116,111,99,
+    104,105,103,105,46,106,112,0,116,111,99,104,105,111,46,110,
+    105,105,103,97,116,97,46,106,112,0,116,111,100,97,46,115,
+    97,105,116,97,109,97,46,106,112,0,116,111,101,105,46,97,
+    105,99,104,105,46,106,112,0,116,111,103,97,46,116,111,121,
+    97,109,97,46,106,112,0,116,111,103,97,107,117,115,104,105,
+    46,110,97,103,97,110,111,46,106,112,0,116,111,103,97,110,
+    101,46,99,104,105,98,97,46,106,112,0,116,111,103,105,116,
+    115,117,46,110,97,103,97,115,97,107,105,46,106,112,0,116,
+    111,103,108,105,97,116,116,105,46,115,117,0,116,111,103,111,
+    46,97,105,99,104,105,46,106,112,0,116,111,103,117,114,97,
+    46,110,97,103,97,110,111,46,106,112,0,116,111,104,109,97,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,111,104,
+    110,111,115,104,111,46,99,104,105,98,97,46,106,112,0,116,
+    111,104,111,46,102,117,107,117,111,107,97,46,106,112,0,116,
+    111,107,97,105,46,97,105,99,104,105,46,106,112,0,116,111,
+    107,97,105,46,105,98,97,114,97,107,105,46,106,112,0,116,
+    111,107,97,109,97,99,104,105,46,110,105,105,103,97,116,97,
+    46,106,112,0,116,111,107,97,115,104,105,107,105,46,111,107,
+    105,110,97,119,97,46,106,112,0,116,111,107,105,46,103,105,
+    102,117,46,106,112,0,116,111,107,105,103,97,119,97,46,115,
+    97,105,116,97,109,97,46,106,112,0,116,111,107,107,101,46,
+    110,111,0,116,111,107,111,110,97,109,101,46,97,105,99,104,
+    105,46,106,112,0,116,111,107,111,114,111,122,97,119,97,46,
+    115,97,105,116,97,109,97,46,106,112,0,116,111,107,117,115,
+    104,105,109,97,46,116,111,107,117,115,104,105,109,97,46,106,
+    112,0,116,111,107,117,121,97,109,97,46,121,97,109,97,103,
+    117,99,104,105,46,106,112,0,116,111,107,121,111,0,116,111,
+    108,103,97,46,110,111,0,116,111,109,97,107,111,109,97,105,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,111,109,
+    97,114,105,46,104,111,107,107,97,105,100,111,46,106,112,0,
+    116,111,109,101,46,109,105,121,97,103,105,46,106,112,0,116,
+    111,109,105,46,110,97,103,97,110,111,46,106,112,0,116,111,
+    109,105,103,117,115,117,107,117,46,111,107,105,110,97,119,97,
+    46,106,112,0,116,111,109,105,107,97,46,103,105,102,117,46,
+    106,112,0,116,111,109,105,111,107,97,46,103,117,110,109,97,
+    46,106,112,0,116,111,109,105,115,97,116,111,46,99,104,105,
+    98,97,46,106,112,0,116,111,109,105,121,97,46,109,105,121,
+    97,103,105,46,106,112,0,116,111,109,111,98,101,46,105,98,
+    97,114,97,107,105,46,106,112,0,116,111,110,97,107,105,46,
+    111,107,105,110,97,119,97,46,106,112,0,116,111,110,97,109,
+    105,46,116,111,121,97,109,97,46,106,112,0,116,111,110,100,
+    97,98,97,121,97,115,104,105,46,111,115,97,107,97,46,106,
+    112,0,116,111,110,101,46,105,98,97,114,97,107,105,46,106,
+    112,0,116,111,110,107,111,116,115,117,46,106,112,0,116,111,
+    110,111,46,105,119,97,116,101,46,106,112,0,116,111,110,111,
+    115,104,111,46,107,97,103,97,119,97,46,106,112,0,116,111,
+    110,115,98,101,114,103,46,110,111,0,116,111,111,108,102,111,
+    114,103,101,46,111,114,103,0,116,111,111,108,115,0,116,111,
+    111,110,46,101,104,105,109,101,46,106,112,0,116,111,112,111,
+    108,111,103,121,46,109,117,115,101,117,109,0,116,111,114,97,
+    104,105,109,101,46,115,104,105,103,97,46,106,112,0,116,111,
+    114,97,121,0,116,111,114,105,100,101,46,105,98,97,114,97,
+    107,105,46,106,112,0,116,111,114,105,110,111,46,105,116,0,
+    116,111,114,105,110,111,46,109,117,115,101,117,109,0,116,111,
+    114,115,107,101,110,46,110,111,0,116,111,115,46,105,116,0,
+    116,111,115,97,46,107,111,99,104,105,46,106,112,0,116,111,
+    115,97,115,104,105,109,105,122,117,46,107,111,99,104,105,46,
+    106,112,0,116,111,115,99,97,110,97,46,105,116,0,116,111,
+    115,104,105,98,97,0,116,111,115,104,105,109,97,46,116,111,
+    107,121,111,46,106,112,0,116,111,115,117,46,115,97,103,97,
+    46,106,112,0,116,111,116,97,108,0,116,111,116,116,111,114,
+    105,46,116,111,116,116,111,114,105,46,106,112,0,116,111,117,
+    99,104,46,109,117,115,101,117,109,0,116,111,117,114,105,115,
+    109,46,98,106,0,116,111,117,114,105,115,109,46,112,108,0,
+    116,111,117,114,105,115,109,46,116,110,0,116,111,117,114,115,
+    0,116,111,119,97,100,97,46,97,111,109,111,114,105,46,106,
+    112,0,116,111,119,110,0,116,111,119,110,46,109,117,115,101,
+    117,109,0,116,111,119,110,110,101,119,115,45,115,116,97,103,
+    105,110,103,46,99,111,109,0,116,111,121,97,46,104,111,107,
+    107,97,105,100,111,46,106,112,0,116,111,121,97,107,111,46,
+    104,111,107,107,97,105,100,111,46,106,112,0,116,111,121,97,
+    109,97,46,116,111,121,97,109,97,46,106,112,0,116,111,121,
+    111,46,107,111,99,104,105,46,106,112,0,116,111,121,111,97,
+    107,101,46,97,105,99,104,105,46,106,112,0,116,111,121,111,
+    104,97,115,104,105,46,97,105,99,104,105,46,106,112,0,116,
+    111,121,111,107,97,119,97,46,97,105,99,104,105,46,106,112,
+    0,116,111,121,111,110,97,107,97,46,111,115,97,107,97,46,
+    106,112,0,116,111,121,111,110,101,46,97,105,99,104,105,46,
+    106,112,0,116,111,121,111,110,111,46,111,115,97,107,97,46,
+    106,112,0,116,111,121,111,111,107,97,46,104,121,111,103,111,
+    46,106,112,0,116,111,121,111,115,97,116,111,46,115,104,105,
+    103,97,46,106,112,0,116,111,121,111,116,97,0,116,111,121,
+    111,116,97,46,97,105,99,104,105,46,106,112,0,116,111,121,
+    111,116,97,46,121,97,109,97,103,117,99,104,105,46,106,112,
+    0,116,111,121,111,116,111,109,105,46,104,111,107,107,97,105,
+    100,111,46,106,112,0,116,111,121,111,116,115,117,46,102,117,
+    107,117,111,107,97,46,106,112,0,116,111,121,111,117,114,97,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,111,121,
+    115,0,116,111,122,97,119,97,46,121,97,109,97,103,97,116,
+    97,46,106,112,0,116,111,122,115,100,101,46,104,117,0,116,
+    112,46,105,116,0,116,114,46,101,117,46,111,114,103,0,116,
+    114,46,105,116,0,116,114,97,46,107,112,0,116,114,97,100,
+    101,114,46,97,101,114,111,0,116,114,97,100,105,110,103,0,
+    116,114,97,100,105,110,103,46,97,101,114,111,0,116,114,97,
+    101,117,109,116,103,101,114,97,100,101,46,100,101,0,116,114,
+    97,102,102,105,99,112,108,101,120,46,99,108,111,117,100,0,
+    116,114,97,105,110,101,114,46,97,101,114,111,0,116,114,97,
+    105,110,105,110,103,0,116,114,97,110,97,46,110,111,0,116,
+    114,97,110,98,121,46,110,111,0,116,114,97,110,105,45,97,
+    110,100,114,105,97,45,98,97,114,108,101,116,116,97,46,105,
+    116,0,116,114,97,110,105,45,98,97,114,108,101,116,116,97,
+    45,97,110,100,114,105,97,46,105,116,0,116,114,97,110,105,
+    97,110,100,114,105,97,98,97,114,108,101,116,116,97,46,105,
+    116,0,116,114,97,110,105,98,97,114,108,101,116,116,97,97,
+    110,100,114,105,97,46,105,116,0,116,114,97,110,111,121,46,
+    110,111,0,116,114,97,110,115,108,97,116,101,46,103,111,111,
+    103,0,116,114,97,110,115,108,97,116,101,100,46,112,97,103,
+    101,0,116,114,97,110,115,112,111,114,116,46,109,117,115,101,
+    117,109,0,116,114,97,110,115,112,111,114,116,101,46,98,111,
+    0,116,114,97,110,115,117,114,108,46,98,101,0,116,114,97,
+    110,115,117,114,108,46,101,117,0,116,114,97,110,115,117,114,
+    108,46,110,108,0,116,114,97,110,195,184,121,46,110,111,0,
+    116,114,97,112,97,110,105,46,105,116,0,116,114,97,118,101,
+    108,0,116,114,97,118,101,108,46,105,110,0,116,114,97,118,
+    101,108,46,112,108,0,116,114,97,118,101,108,46,116,116,0,
+    116,114,97,118,101,108,99,104,97,110,110,101,108,0,116,114,
+    97,118,101,108,101,114,115,0,116,114,97,118,101,108,101,114,
+    115,105,110,115,117,114,97,110,99,101,0,116,114,100,46,98,
+    114,0,116,114,101,101,46,109,117,115,101,117,109,0,116,114,
+    101,110,116,105,110,45,115,117,100,45,116,105,114,111,108,46,
+    105,116,0,116,114,101,110,116,105,110,45,115,117,100,116,105,
+    114,111,108,46,105,116,0,116,114,101,110,116,105,110,45,115,
+    117,101,100,45,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,45,115,117,101,100,116,105,114,111,108,46,105,
+    116,0,116,114,101,110,116,105,110,45,115,195,188,100,45,116,
+    105,114,111,108,46,105,116,0,116,114,101,110,116,105,110,45,
+    115,195,188,100,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,111,45,97,45,97,100,105,103,101,46,105,116,
+    0,116,114,101,110,116,105,110,111,45,97,97,100,105,103,101,
+    46,105,116,0,116,114,101,110,116,105,110,111,45,97,108,116,
+    111,45,97,100,105,103,101,46,105,116,0,116,114,101,110,116,
+    105,110,111,45,97,108,116,111,97,100,105,103,101,46,105,116,
+    0,116,114,101,110,116,105,110,111,45,115,45,116,105,114,111,
+    108,46,105,116,0,116,114,101,110,116,105,110,111,45,115,116,
+    105,114,111,108,46,105,116,0,116,114,101,110,116,105,110,111,
+    45,115,117,100,45,116,105,114,111,108,46,105,116,0,116,114,
+    101,110,116,105,110,111,45,115,117,100,116,105,114,111,108,46,
+    105,116,0,116,114,101,110,116,105,110,111,45,115,117,101,100,
+    45,116,105,114,111,108,46,105,116,0,116,114,101,110,116,105,
+    110,111,45,115,117,101,100,116,105,114,111,108,46,105,116,0,
+    116,114,101,110,116,105,110,111,45,115,195,188,100,45,116,105,
+    114,111,108,46,105,116,0,116,114,101,110,116,105,110,111,45,
+    115,195,188,100,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,111,46,105,116,0,116,114,101,110,116,105,110,
+    111,97,45,97,100,105,103,101,46,105,116,0,116,114,101,110,
+    116,105,110,111,97,97,100,105,103,101,46,105,116,0,116,114,
+    101,110,116,105,110,111,97,108,116,111,45,97,100,105,103,101,
+    46,105,116,0,116,114,101,110,116,105,110,111,97,108,116,111,
+    97,100,105,103,101,46,105,116,0,116,114,101,110,116,105,110,
+    111,115,45,116,105,114,111,108,46,105,116,0,116,114,101,110,
+    116,105,110,111,115,116,105,114,111,108,46,105,116,0,116,114,
+    101,110,116,105,110,111,115,117,100,45,116,105,114,111,108,46,
+    105,116,0,116,114,101,110,116,105,110,111,115,117,100,116,105,
+    114,111,108,46,105,116,0,116,114,101,110,116,105,110,111,115,
+    117,101,100,45,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,111,115,117,101,100,116,105,114,111,108,46,105,
+    116,0,116,114,101,110,116,105,110,111,115,195,188,100,45,116,
+    105,114,111,108,46,105,116,0,116,114,101,110,116,105,110,111,
+    115,195,188,100,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,115,117,100,45,116,105,114,111,108,46,105,116,
+    0,116,114,101,110,116,105,110,115,117,100,116,105,114,111,108,
+    46,105,116,0,116,114,101,110,116,105,110,115,117,101,100,45,
+    116,105,114,111,108,46,105,116,0,116,114,101,110,116,105,110,
+    115,117,101,100,116,105,114,111,108,46,105,116,0,116,114,101,
+    110,116,105,110,115,195,188,100,45,116,105,114,111,108,46,105,
+    116,0,116,114,101,110,116,105,110,115,195,188,100,116,105,114,
+    111,108,46,105,116,0,116,114,101,110,116,111,46,105,116,0,
+    116,114,101,118,105,115,111,46,105,116,0,116,114,105,101,115,
+    116,101,46,105,116,0,116,114,105,116,111,110,46,122,111,110,
+    101,0,116,114,111,97,110,100,105,110,46,110,111,0,116,114,
+    111,103,115,116,97,100,46,110,111,0,116,114,111,105,116,115,
+    107,46,115,117,0,116,114,111,108,108,101,121,46,109,117,115,
+    101,117,109,0,116,114,111,109,115,97,46,110,111,0,116,114,
+    111,109,115,111,46,110,111,0,116,114,111,109,115,195,184,46,
+    110,111,0,116,114,111,110,100,104,101,105,109,46,110,111,0,
+    116,114,117,115,116,0,116,114,117,115,116,46,109,117,115,101,
+    117,109,0,116,114,117,115,116,101,101,46,109,117,115,101,117,
+    109,0,116,114,118,0,116,114,121,45,115,110,111,119,112,108,
+    111,119,46,99,111,109,0,116,114,121,99,108,111,117,100,102,
+    108,97,114,101,46,99,111,109,0,116,114,121,115,105,108,46,
+    110,111,0,116,114,195,166,110,97,46,110,111,0,116,114,195,
+    184,103,115,116,97,100,46,110,111,0,116,115,46,105,116,0,
+    116,115,46,110,101,116,0,116,115,101,108,105,110,111,103,114,
+    97,100,46,115,117,0,116,115,107,46,116,114,0,116,115,116,
+    46,115,105,116,101,0,116,115,117,46,109,105,101,46,106,112,
+    0,116,115,117,98,97,109,101,46,110,105,105,103,97,116,97,
+    46,106,112,0,116,115,117,98,97,116,97,46,105,115,104,105,
+    107,97,119,97,46,106,112,0,116,115,117,98,101,116,115,117,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,115,117,
+    99,104,105,117,114,97,46,105,98,97,114,97,107,105,46,106,
+    112,0,116,115,117,103,97,46,116,111,99,104,105,103,105,46,
+    106,112,0,116,115,117,103,97,114,117,46,97,111,109,111,114,
+    105,46,106,112,0,116,115,117,105,107,105,46,102,117,107,117,
+    111,107,97,46,106,112,0,116,115,117,107,105,103,97,116,97,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,116,115,117,
+    107,105,121,111,110,111,46,103,117,110,109,97,46,106,112,0,
+    116,115,117,107,117,98,97,46,105,98,97,114,97,107,105,46,
+    106,112,0,116,115,117,107,117,105,46,107,97,110,97,103,97,
+    119,97,46,106,112,0,116,115,117,107,117,109,105,46,111,105,
+    116,97,46,106,112,0,116,115,117,109,97,103,111,105,46,103,
+    117,110,109,97,46,106,112,0,116,115,117,110,97,110,46,110,
+    105,105,103,97,116,97,46,106,112,0,116,115,117,110,111,46,
+    107,111,99,104,105,46,106,112,0,116,115,117,110,111,46,109,
+    105,121,97,122,97,107,105,46,106,112,0,116,115,117,114,117,
+    46,121,97,109,97,110,97,115,104,105,46,106,112,0,116,115,
+    117,114,117,103,97,46,102,117,107,117,105,46,106,112,0,116,
+    115,117,114,117,103,97,115,104,105,109,97,46,115,97,105,116,
+    97,109,97,46,106,112,0,116,115,117,114,117,103,105,46,105,
+    115,104,105,107,97,119,97,46,106,112,0,116,115,117,114,117,
+    111,107,97,46,121,97,109,97,103,97,116,97,46,106,112,0,
+    116,115,117,114,117,116,97,46,97,111,109,111,114,105,46,106,
+    112,0,116,115,117,115,104,105,109,97,46,97,105,99,104,105,
+    46,106,112,0,116,115,117,115,104,105,109,97,46,110,97,103,
+    97,115,97,107,105,46,106,112,0,116,115,117,119,97,110,111,
+    46,115,104,105,109,97,110,101,46,106,112,0,116,115,117,121,
+    97,109,97,46,111,107,97,121,97,109,97,46,106,112,0,116,
+    116,46,105,109,0,116,117,98,101,0,116,117,105,0,116,117,
+    108,97,46,115,117,0,116,117,108,101,97,112,45,112,97,114,
+    116,110,101,114,115,46,99,111,109,0,116,117,110,101,115,0,
+    116,117,110,107,46,111,114,103,0,116,117,114,46,97,114,0,
+    116,117,114,46,98,114,0,116,117,114,101,107,46,112,108,0,
+    116,117,114,105,110,46,105,116,0,116,117,114,121,115,116,121,
+    107,97,46,112,108,0,116,117,115,99,97,110,121,46,105,116,
+    0,116,117,115,104,117,0,116,117,118,97,46,115,117,0,116,
+    117,120,102,97,109,105,108,121,46,111,114,103,0,116,118,46,
+    98,98,0,116,118,46,98,111,0,116,118,46,98,114,0,116,
+    118,46,105,109,0,116,118,46,105,110,0,116,118,46,105,116,
+    0,116,118,46,107,103,0,116,118,46,110,97,0,116,118,46,
+    115,100,0,116,118,46,116,114,0,116,118,46,116,122,0,116,
+    118,101,100,101,115,116,114,97,110,100,46,110,111,0,116,118,
+    115,0,116,119,46,99,110,0,116,119,109,97,105,108,46,99,
+    99,0,116,119,109,97,105,108,46,110,101,116,0,116,119,109,
+    97,105,108,46,111,114,103,0,116,121,99,104,121,46,112,108,
+    0,116,121,100,97,108,46,110,111,0,116,121,110,115,101,116,
+    46,110,111,0,116,121,112,101,100,114,101,97,109,46,97,112,
+    112,0,116,121,115,102,106,111,114,100,46,110,111,0,116,121,
+    115,110,101,115,46,110,111,0,116,121,115,118,97,114,46,110,
+    111,0,116,121,115,118,195,166,114,46,110,111,0,116,195,184,
+    110,115,98,101,114,103,46,110,111,0,117,46,98,103,0,117,
+    46,99,104,97,110,110,101,108,115,100,118,114,46,110,101,116,
+    0,117,46,115,101,0,117,50,45,108,111,99,97,108,46,120,
+    110,98,97,121,46,99,111,109,0,117,50,46,120,110,98,97,
+    121,46,99,111,109,0,117,97,46,114,115,0,117,98,97,110,
+    107,0,117,98,101,46,121,97,109,97,103,117,99,104,105,46,
+    106,112,0,117,98,101,114,46,115,112,97,99,101,0,117,98,
+    101,114,115,112,97,99,101,46,100,101,0,117,98,115,0,117,
+    99,104,105,104,97,114,97,46,105,98,97,114,97,107,105,46,
+    106,112,0,117,99,104,105,107,111,46,101,104,105,109,101,46,
+    106,112,0,117,99,104,105,110,97,100,97,46,105,115,104,105,
+    107,97,119,97,46,106,112,0,117,99,104,105,110,111,109,105,
+    46,107,97,103,97,119,97,46,106,112,0,117,100,46,105,116,
+    0,117,100,97,46,110,97,114,97,46,106,112,0,117,100,105,
+    46,98,114,0,117,100,105,110,101,46,105,116,0,117,100,111,
+    110,111,46,109,105,101,46,106,112,0,117,101,100,97,46,110,
+    97,103,97,110,111,46,106,112,0,117,101,110,111,46,103,117,
+    110,109,97,46,106,112,0,117,101,110,111,104,97,114,97,46,
+    121,97,109,97,110,97,115,104,105,46,106,112,0,117,102,99,
+    102,97,110,46,111,114,103,0,117,103,46,103,111,118,46,112,
+    108,0,117,103,105,109,46,103,111,118,46,112,108,0,117,104,
+    114,101,110,46,109,117,115,101,117,109,0,117,105,46,110,97,
+    98,117,46,99,97,115,97,0,117,106,105,46,107,121,111,116,
+    111,46,106,112,0,117,106,105,105,101,46,116,111,99,104,105,
+    103,105,46,106,112,0,117,106,105,116,97,119,97,114,97,46,
+    107,121,111,116,111,46,106,112,0,117,107,46,99,111,109,0,
+    117,107,46,101,117,46,111,114,103,0,117,107,46,105,110,0,
+    117,107,46,107,103,0,117,107,46,110,101,116,0,117,107,46,
+    111,120,97,46,99,108,111,117,100,0,117,107,46,112,114,105,
+    109,101,116,101,108,46,99,108,111,117,100,0,117,107,46,114,
+    101,99,108,97,105,109,46,99,108,111,117,100,0,117,107,48,
+    46,98,105,103,118,46,105,111,0,117,107,105,46,107,117,109,
+    97,109,111,116,111,46,106,112,0,117,107,105,104,97,46,102,
+    117,107,117,111,107,97,46,106,112,0,117,108,108,101,110,115,
+    97,107,101,114,46,110,111,0,117,108,108,101,110,115,118,97,
+    110,103,46,110,111,0,117,108,109,46,109,117,115,101,117,109,
+    0,117,108,115,97,110,46,107,114,0,117,108,118,105,107,46,
+    110,111,0,117,109,46,103,111,118,46,112,108,0,117,109,97,
+    106,105,46,107,111,99,104,105,46,106,112,0,117,109,98,46,
+    105,116,0,117,109,98,114,105,97,46,105,116,0,117,109,105,
+    46,102,117,107,117,111,107,97,46,106,112,0,117,109,105,103,
+    46,103,111,118,46,112,108,0,117,110,97,122,117,107,105,46,
+    116,111,121,97,109,97,46,106,112,0,117,110,100,101,114,46,
+    106,112,0,117,110,100,101,114,115,101,97,46,109,117,115,101,
+    117,109,0,117,110,105,53,46,110,101,116,0,117,110,105,99,
+    108,111,117,100,46,112,108,0,117,110,105,99,111,109,0,117,
+    110,105,111,110,46,97,101,114,111,0,117,110,105,118,46,98,
+    106,0,117,110,105,118,46,115,110,0,117,110,105,118,101,114,
+    115,105,116,121,0,117,110,105,118,101,114,115,105,116,121,46,
+    109,117,115,101,117,109,0,117,110,106,97,114,103,97,46,110,
+    111,0,117,110,106,195,161,114,103,97,46,110,111,0,117,110,
+    110,97,110,46,115,104,105,109,97,110,101,46,106,112,0,117,
+    110,111,0,117,110,117,115,117,97,108,112,101,114,115,111,110,
+    46,99,111,109,0,117,110,122,101,110,46,110,97,103,97,115,
+    97,107,105,46,106,112,0,117,111,108,0,117,111,110,117,109,
+    97,46,110,105,105,103,97,116,97,46,106,112,0,117,111,122,
+    117,46,116,111,121,97,109,97,46,106,112,0,117,112,46,105,
+    110,0,117,112,97,97,115,46,107,97,122,116,101,108,101,112,
+    111,114,116,46,107,122,0,117,112,108,105,46,105,111,0,117,
+    112,111,119,46,103,111,118,46,112,108,0,117,112,112,101,114,
+    46,106,112,0,117,112,112,111,46,103,111,118,46,112,108,0,
+    117,112,115,0,117,114,97,107,97,119,97,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,117,114,97,115,111,101,46,111,
+    107,105,110,97,119,97,46,106,112,0,117,114,97,117,115,117,
+    46,104,111,107,107,97,105,100,111,46,106,112,0,117,114,97,
+    119,97,46,115,97,105,116,97,109,97,46,106,112,0,117,114,
+    97,121,97,115,117,46,99,104,105,98,97,46,106,112,0,117,
+    114,98,105,110,111,45,112,101,115,97,114,111,46,105,116,0,
+    117,114,98,105,110,111,112,101,115,97,114,111,46,105,116,0,
+    117,114,101,115,104,105,110,111,46,109,105,101,46,106,112,0,
+    117,114,105,46,97,114,112,97,0,117,114,108,46,116,119,0,
+    117,114,110,46,97,114,112,97,0,117,114,111,119,110,46,99,
+    108,111,117,100,0,117,114,117,109,97,46,111,107,105,110,97,
+    119,97,46,106,112,0,117,114,121,117,46,104,111,107,107,97,
+    105,100,111,46,106,112,0,117,115,45,49,46,101,118,101,110,
+    110,111,100,101,46,99,111,109,0,117,115,45,50,46,101,118,
+    101,110,110,111,100,101,46,99,111,109,0,117,115,45,51,46,
+    101,118,101,110,110,111,100,101,46,99,111,109,0,117,115,45,
+    52,46,101,118,101,110,110,111,100,101,46,99,111,109,0,117,
+    115,45,101,97,115,116,45,49,46,101,108,97,115,116,105,99,
+    98,101,97,110,115,116,97,108,107,46,99,111,109,0,117,115,
+    45,101,97,115,116,45,50,46,101,108,97,115,116,105,99,98,
+    101,97,110,115,116,97,108,107,46,99,111,109,0,117,115,45,
+    103,111,118,45,119,101,115,116,45,49,46,101,108,97,115,116,
+    105,99,98,101,97,110,115,116,97,108,107,46,99,111,109,0,
+    117,115,45,119,101,115,116,45,49,46,101,108,97,115,116,105,
+    99,98,101,97,110,115,116,97,108,107,46,99,111,109,0,117,
+    115,45,119,101,115,116,45,50,46,101,108,97,115,116,105,99,
+    98,101,97,110,115,116,97,108,107,46,99,111,109,0,117,115,
+    46,97,120,0,117,115,46,99,111,109,0,117,115,46,101,117,
+    46,111,114,103,0,117,115,46,103,111,118,46,112,108,0,117,
+    115,46,105,110,0,117,115,46,107,103,0,117,115,46,110,97,
+    0,117,115,46,111,114,103,0,117,115,46,112,108,97,116,102,
+    111,114,109,46,115,104,0,117,115,46,114,101,99,108,97,105,
+    109,46,99,108,111,117,100,0,117,115,97,46,109,117,115,101,
+    117,109,0,117,115,97,46,111,105,116,97,46,106,112,0,117,
+    115,97,110,116,105,113,117,101,115,46,109,117,115,101,117,109,
+    0,117,115,97,114,116,115,46,109,117,115,101,117,109,0,117,
+    115,99,111,117,110,116,114,121,101,115,116,97,116,101,46,109,
+    117,115,101,117,109,0,117,115,99,117,108,116,117,114,101,46,
+    109,117,115,101,117,109,0,117,115,100,101,99,111,114,97,116,
+    105,118,101,97,114,116,115,46,109,117,115,101,117,109,0,117,
+    115,101,114,46,97,115,101,105,110,101,116,46,110,101,46,106,
+    112,0,117,115,101,114,46,102,109,0,117,115,101,114,46,108,
+    111,99,97,108,99,101,114,116,46,100,101,118,0,117,115,101,
+    114,46,112,97,114,116,121,46,101,117,115,0,117,115,101,114,
+    46,115,114,99,102,46,110,101,116,0,117,115,101,114,99,111,
+    110,116,101,110,116,46,103,111,111,103,0,117,115,101,114,99,
+    111,110,116,101,110,116,46,106,112,0,117,115,101,114,115,46,
+    115,99,97,108,101,46,118,105,114,116,117,97,108,99,108,111,
+    117,100,46,99,111,109,46,98,114,0,117,115,103,97,114,100,
+    101,110,46,109,117,115,101,117,109,0,117,115,104,105,107,117,
+    46,105,98,97,114,97,107,105,46,106,112,0,117,115,104,105,
+    115,116,111,114,121,46,109,117,115,101,117,109,0,117,115,104,
+    117,97,105,97,46,109,117,115,101,117,109,0,117,115,108,105,
+    118,105,110,103,104,105,115,116,111,114,121,46,109,117,115,101,
+    117,109,0,117,115,114,46,99,108,111,117,100,46,109,117,110,
+    105,46,99,122,0,117,115,116,107,97,46,112,108,0,117,115,
+    117,105,46,102,117,107,117,111,107,97,46,106,112,0,117,115,
+    117,107,105,46,111,105,116,97,46,106,112,0,117,116,97,104,
+    46,109,117,115,101,117,109,0,117,116,97,115,104,105,110,97,
+    105,46,104,111,107,107,97,105,100,111,46,106,112,0,117,116,
+    97,122,97,115,46,104,117,0,117,116,97,122,117,46,107,97,
+    103,97,119,97,46,106,112,0,117,116,111,46,107,117,109,97,
+    109,111,116,111,46,106,112,0,117,116,115,105,114,97,46,110,
+    111,0,117,116,115,117,110,111,109,105,121,97,46,116,111,99,
+    104,105,103,105,46,106,112,0,117,116,119,101,110,116,101,46,
+    105,111,0,117,118,105,99,46,109,117,115,101,117,109,0,117,
+    119,46,103,111,118,46,112,108,0,117,119,97,106,105,109,97,
+    46,101,104,105,109,101,46,106,112,0,117,119,117,46,97,105,
+    0,117,121,46,99,111,109,0,117,122,46,117,97,0,117,122,
+    104,103,111,114,111,100,46,117,97,0,117,122,115,46,103,111,
+    118,46,112,108,0,118,45,105,110,102,111,46,105,110,102,111,
+    0,118,46,98,103,0,118,46,117,97,0,118,97,0,118,97,
+    46,105,116,0,118,97,97,112,115,116,101,46,110,111,0,118,
+    97,99,97,116,105,111,110,115,0,118,97,100,115,111,46,110,
+    111,0,118,97,100,115,195,184,46,110,111,0,118,97,103,97,
+    46,110,111,0,118,97,103,97,110,46,110,111,0,118,97,103,
+    115,111,121,46,110,111,0,118,97,107,115,100,97,108,46,110,
+    111,0,118,97,108,45,100,45,97,111,115,116,97,46,105,116,
+    0,118,97,108,45,100,97,111,115,116,97,46,105,116,0,118,
+    97,108,100,45,97,111,115,116,97,46,105,116,0,118,97,108,
+    100,97,111,115,116,97,46,105,116,0,118,97,108,101,114,46,
+    104,101,100,109,97,114,107,46,110,111,0,118,97,108,101,114,
+    46,111,115,116,102,111,108,100,46,110,111,0,118,97,108,108,
+    101,45,97,111,115,116,97,46,105,116,0,118,97,108,108,101,
+    45,100,45,97,111,115,116,97,46,105,116,0,118,97,108,108,
+    101,45,100,97,111,115,116,97,46,105,116,0,118,97,108,108,
+    101,46,110,111,0,118,97,108,108,101,97,111,115,116,97,46,
+    105,116,0,118,97,108,108,101,100,45,97,111,115,116,97,46,
+    105,116,0,118,97,108,108,101,100,97,111,115,116,97,46,105,
+    116,0,118,97,108,108,101,101,45,97,111,115,116,101,46,105,
+    116,0,118,97,108,108,101,101,45,100,45,97,111,115,116,101,
+    46,105,116,0,118,97,108,108,101,101,97,111,115,116,101,46,
+    105,116,0,118,97,108,108,101,101,100,97,111,115,116,101,46,
+    105,116,0,118,97,108,108,101,121,46,109,117,115,101,117,109,
+    0,118,97,108,108,195,169,101,45,97,111,115,116,101,46,105,
+    116,0,118,97,108,108,195,169,101,45,100,45,97,111,115,116,
+    101,46,105,116,0,118,97,108,108,195,169,101,97,111,115,116,
+    101,46,105,116,0,118,97,108,108,195,169,101,100,97,111,115,
+    116,101,46,105,116,0,118,97,110,97,0,118,97,110,103,46,
+    110,111,0,118,97,110,103,117,97,114,100,0,118,97,110,116,
+    97,97,46,109,117,115,101,117,109,0,118,97,110,121,108,118,
+    101,110,46,110,111,0,118,97,111,46,105,116,0,118,97,112,
+    111,114,46,99,108,111,117,100,0,118,97,112,111,114,99,108,
+    111,117,100,46,105,111,0,118,97,114,100,111,46,110,111,0,
+    118,97,114,100,195,184,46,110,111,0,118,97,114,101,115,101,
+    46,105,116,0,118,97,114,103,103,97,116,46,110,111,0,118,
+    97,114,111,121,46,110,111,0,118,98,46,105,116,0,118,99,
+    46,105,116,0,118,100,97,46,105,116,0,118,101,46,105,116,
+    0,118,101,102,115,110,46,110,111,0,118,101,103,97,46,110,
+    111,0,118,101,103,97,114,115,104,101,105,46,110,111,0,118,
+    101,103,97,115,0,118,101,103,195,165,114,115,104,101,105,46,
+    110,111,0,118,101,108,118,101,116,46,106,112,0,118,101,110,
+    46,105,116,0,118,101,110,101,116,111,46,105,116,0,118,101,
+    110,101,122,105,97,46,105,116,0,118,101,110,105,99,101,46,
+    105,116,0,118,101,110,110,101,115,108,97,46,110,111,0,118,
+    101,110,116,117,114,101,115,0,118,101,114,98,97,110,105,97,
+    46,105,116,0,118,101,114,99,101,108,46,97,112,112,0,118,
+    101,114,99,101,108,46,100,101,118,0,118,101,114,99,101,108,
+    108,105,46,105,116,0,118,101,114,100,97,108,46,110,111,0,
+    118,101,114,105,115,105,103,110,0,118,101,114,109,195,182,103,
+    101,110,115,98,101,114,97,116,101,114,0,118,101,114,109,195,
+    182,103,101,110,115,98,101,114,97,116,117,110,103,0,118,101,
+    114,111,110,97,46,105,116,0,118,101,114,114,97,110,46,110,
+    111,0,118,101,114,115,97,105,108,108,101,115,46,109,117,115,
+    101,117,109,0,118,101,114,115,101,46,106,112,0,118,101,114,
+    115,105,99,104,101,114,117,110,103,0,118,101,114,115,117,115,
+    46,106,112,0,118,101,115,116,98,121,46,110,111,0,118,101,
+    115,116,110,101,115,46,110,111,0,118,101,115,116,114,101,45,
+    115,108,105,100,114,101,46,110,111,0,118,101,115,116,114,101,
+    45,116,111,116,101,110,46,110,111,0,118,101,115,116,118,97,
+    103,111,121,46,110,111,0,118,101,115,116,118,195,165,103,195,
+    184,121,46,110,111,0,118,101,116,0,118,101,116,46,98,114,
+    0,118,101,116,101,114,105,110,97,105,114,101,46,102,114,0,
+    118,101,116,101,114,105,110,97,105,114,101,46,107,109,0,118,
+    101,118,101,108,115,116,97,100,46,110,111,0,118,102,115,46,
+    99,108,111,117,100,57,46,97,102,45,115,111,117,116,104,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    118,102,115,46,99,108,111,117,100,57,46,97,112,45,101,97,
+    115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,118,102,115,46,99,108,111,117,100,57,46,97,112,
+    45,110,111,114,116,104,101,97,115,116,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,118,102,115,46,99,
+    108,111,117,100,57,46,97,112,45,110,111,114,116,104,101,97,
+    115,116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,118,102,115,46,99,108,111,117,100,57,46,97,112,
+    45,110,111,114,116,104,101,97,115,116,45,51,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,118,102,115,46,99,
+    108,111,117,100,57,46,97,112,45,115,111,117,116,104,45,49,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,118,
+    102,115,46,99,108,111,117,100,57,46,97,112,45,115,111,117,
+    116,104,101,97,115,116,45,49,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,118,102,115,46,99,108,111,117,100,
+    57,46,97,112,45,115,111,117,116,104,101,97,115,116,45,50,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,118,
+    102,115,46,99,108,111,117,100,57,46,99,97,45,99,101,110,
+    116,114,97,108,45,49,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,118,102,115,46,99,108,111,117,100,57,46,
+    101,117,45,99,101,110,116,114,97,108,45,49,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,118,102,115,46,99,
+    108,111,117,100,57,46,101,117,45,110,111,114,116,104,45,49,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,118,
+    102,115,46,99,108,111,117,100,57,46,101,117,45,115,111,117,
+    116,104,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,118,102,115,46,99,108,111,117,100,57,46,101,117,
+    45,119,101,115,116,45,49,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,118,102,115,46,99,108,111,117,100,57,
+    46,101,117,45,119,101,115,116,45,50,46,97,109,97,122,111,
+    110,97,119,115,46,99,111,109,0,118,102,115,46,99,108,111,
+    117,100,57,46,101,117,45,119,101,115,116,45,51,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,0,118,102,115,46,
+    99,108,111,117,100,57,46,109,101,45,115,111,117,116,104,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    118,102,115,46,99,108,111,117,100,57,46,115,97,45,101,97,
+    115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,118,102,115,46,99,108,111,117,100,57,46,117,115,
+    45,101,97,115,116,45,49,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,118,102,115,46,99,108,111,117,100,57,
+    46,117,115,45,101,97,115,116,45,50,46,97,109,97,122,111,
+    110,97,119,115,46,99,111,109,0,118,102,115,46,99,108,111,
+    117,100,57,46,117,115,45,119,101,115,116,45,49,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,0,118,102,115,46,
+    99,108,111,117,100,57,46,117,115,45,119,101,115,116,45,50,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,118,
+    103,115,46,110,111,0,118,105,46,105,116,0,118,105,97,106,
+    101,115,0,118,105,98,111,45,118,97,108,101,110,116,105,97,
+    46,105,116,0,118,105,98,111,118,97,108,101,110,116,105,97,
+    46,105,116,0,118,105,99,46,97,117,0,118,105,99,46,101,
+    100,117,46,97,117,0,118,105,99,46,103,111,118,46,97,117,
+    0,118,105,99,101,110,122,97,46,105,116,0,118,105,100,101,
+    111,0,118,105,100,101,111,46,104,117,0,118,105,103,0,118,
+    105,107,46,110,111,0,118,105,107,105,110,103,0,118,105,107,
+    105,110,103,46,109,117,115,101,117,109,0,118,105,107,110,97,
+    46,110,111,0,118,105,108,108,97,103,101,46,109,117,115,101,
+    117,109,0,118,105,108,108,97,115,0,118,105,110,0,118,105,
+    110,100,97,102,106,111,114,100,46,110,111,0,118,105,110,110,
+    105,99,97,46,117,97,0,118,105,110,110,121,116,115,105,97,
+    46,117,97,0,118,105,112,0,118,105,112,46,106,101,108,97,
+    115,116,105,99,46,99,108,111,117,100,0,118,105,112,115,105,
+    110,97,97,112,112,46,99,111,109,0,118,105,114,103,105,110,
+    0,118,105,114,103,105,110,105,97,46,109,117,115,101,117,109,
+    0,118,105,114,116,117,97,108,45,117,115,101,114,46,100,101,
+    0,118,105,114,116,117,97,108,46,109,117,115,101,117,109,0,
+    118,105,114,116,117,97,108,115,101,114,118,101,114,46,105,111,
+    0,118,105,114,116,117,97,108,117,115,101,114,46,100,101,0,
+    118,105,114,116,117,101,108,46,109,117,115,101,117,109,0,118,
+    105,115,97,0,118,105,115,105,111,110,0,118,105,116,101,114,
+    98,111,46,105,116,0,118,105,118,97,0,118,105,118,105,97,
+    110,46,106,112,0,118,105,118,111,0,118,105,120,46,98,114,
+    0,118,108,97,97,110,100,101,114,101,110,0,118,108,97,97,
+    110,100,101,114,101,110,46,109,117,115,101,117,109,0,118,108,
+    97,100,105,107,97,118,107,97,122,46,114,117,0,118,108,97,
+    100,105,107,97,118,107,97,122,46,115,117,0,118,108,97,100,
+    105,109,105,114,46,114,117,0,118,108,97,100,105,109,105,114,
+    46,115,117,0,118,108,111,103,46,98,114,0,118,109,46,98,
+    121,116,101,109,97,114,107,46,99,111,46,117,107,0,118,110,
+    46,117,97,0,118,111,97,103,97,116,46,110,111,0,118,111,
+    100,107,97,0,118,111,108,100,97,46,110,111,0,118,111,108,
+    107,101,110,107,117,110,100,101,46,109,117,115,101,117,109,0,
+    118,111,108,107,115,119,97,103,101,110,0,118,111,108,111,103,
+    100,97,46,115,117,0,118,111,108,118,111,0,118,111,108,121,
+    110,46,117,97,0,118,111,111,114,108,111,112,101,114,46,99,
+    108,111,117,100,0,118,111,115,115,46,110,111,0,118,111,115,
+    115,101,118,97,110,103,101,110,46,110,111,0,118,111,116,101,
+    0,118,111,116,105,110,103,0,118,111,116,111,0,118,111,121,
+    97,103,101,0,118,112,52,46,109,101,0,118,112,110,100,110,
+    115,46,110,101,116,0,118,112,110,112,108,117,115,46,116,111,
+    0,118,112,115,46,109,99,100,105,114,46,114,117,0,118,112,
+    115,46,109,121,106,105,110,111,46,114,117,0,118,114,46,105,
+    116,0,118,115,46,105,116,0,118,115,46,109,121,116,104,105,
+    99,45,98,101,97,115,116,115,46,99,111,109,0,118,116,46,
+    105,116,0,118,117,101,108,111,115,0,118,117,108,116,114,111,
+    98,106,101,99,116,115,46,99,111,109,0,118,118,46,105,116,
+    0,118,120,108,46,115,104,0,118,195,161,114,103,103,195,161,
+    116,46,110,111,0,118,195,165,103,97,110,46,110,111,0,118,
+    195,165,103,115,195,184,121,46,110,111,0,118,195,165,103,195,
+    165,46,110,111,0,118,195,165,108,101,114,46,104,101,100,109,
+    97,114,107,46,110,111,0,118,195,165,108,101,114,46,195,184,
+    115,116,102,111,108,100,46,110,111,0,118,195,166,114,195,184,
+    121,46,110,111,0,119,46,98,103,0,119,46,115,101,0,119,
+    97,46,97,117,0,119,97,46,101,100,117,46,97,117,0,119,
+    97,46,103,111,118,46,97,117,0,119,97,100,97,46,110,97,
+    103,97,110,111,46,106,112,0,119,97,102,102,108,101,99,101,
+    108,108,46,99,111,109,0,119,97,106,105,107,105,46,116,111,
+    107,117,115,104,105,109,97,46,106,112,0,119,97,106,105,109,
+    97,46,105,115,104,105,107,97,119,97,46,106,112,0,119,97,
+    107,97,115,97,46,102,117,107,117,105,46,106,112,0,119,97,
+    107,97,115,97,46,116,111,116,116,111,114,105,46,106,112,0,
+    119,97,107,97,121,97,109,97,46,119,97,107,97,121,97,109,
+    97,46,106,112,0,119,97,107,101,46,111,107,97,121,97,109,
+    97,46,106,112,0,119,97,107,107,97,110,97,105,46,104,111,
+    107,107,97,105,100,111,46,106,112,0,119,97,107,117,121,97,
+    46,109,105,121,97,103,105,46,106,112,0,119,97,108,98,114,
+    122,121,99,104,46,112,108,0,119,97,108,101,115,0,119,97,
+    108,101,115,46,109,117,115,101,117,109,0,119,97,108,108,111,
+    110,105,101,46,109,117,115,101,117,109,0,119,97,108,109,97,
+    114,116,0,119,97,108,116,101,114,0,119,97,110,103,0,119,
+    97,110,103,103,111,117,0,119,97,110,111,117,99,104,105,46,
+    103,105,102,117,46,106,112,0,119,97,114,46,109,117,115,101,
+    117,109,0,119,97,114,97,98,105,46,115,97,105,116,97,109,
+    97,46,106,112,0,119,97,114,109,105,97,46,112,108,0,119,
+    97,114,115,122,97,119,97,46,112,108,0,119,97,115,104,105,
+    110,103,116,111,110,100,99,46,109,117,115,101,117,109,0,119,
+    97,115,104,116,101,110,97,119,46,109,105,46,117,115,0,119,
+    97,115,115,97,109,117,46,104,111,107,107,97,105,100,111,46,
+    106,112,0,119,97,116,97,114,97,105,46,109,105,101,46,106,
+    112,0,119,97,116,97,114,105,46,109,105,121,97,103,105,46,
+    106,112,0,119,97,116,99,104,0,119,97,116,99,104,45,97,
+    110,100,45,99,108,111,99,107,46,109,117,115,101,117,109,0,
+    119,97,116,99,104,97,110,100,99,108,111,99,107,46,109,117,
+    115,101,117,109,0,119,97,116,99,104,101,115,0,119,97,116,
+    115,111,110,46,106,112,0,119,97,119,46,112,108,0,119,97,
+    122,117,107,97,46,107,121,111,116,111,46,106,112,0,119,101,
+    46,98,115,0,119,101,46,116,99,0,119,101,97,116,104,101,
+    114,0,119,101,97,116,104,101,114,99,104,97,110,110,101,108,
+    0,119,101,98,46,97,112,112,0,119,101,98,46,98,111,0,
+    119,101,98,46,99,111,0,119,101,98,46,100,111,0,119,101,
+    98,46,103,117,0,119,101,98,46,105,100,0,119,101,98,46,
+    105,110,0,119,101,98,46,108,107,0,119,101,98,46,110,102,
+    0,119,101,98,46,110,105,0,119,101,98,46,112,107,0,119,
+    101,98,46,116,106,0,119,101,98,46,116,114,0,119,101,98,
+    46,118,101,0,119,101,98,46,122,97,0,119,101,98,99,97,
+    109,0,119,101,98,101,114,0,119,101,98,104,97,114,101,46,
+    100,101,118,0,119,101,98,104,111,112,46,98,105,122,0,119,
+    101,98,104,111,112,46,105,110,102,111,0,119,101,98,104,111,
+    112,46,109,101,0,119,101,98,104,111,112,46,110,101,116,0,
+    119,101,98,104,111,112,46,111,114,103,0,119,101,98,104,111,
+    115,116,105,110,103,46,98,101,0,119,101,98,108,105,107,101,
+    46,106,112,0,119,101,98,112,97,97,115,46,111,118,104,46,
+    110,101,116,0,119,101,98,114,101,100,105,114,101,99,116,46,
+    111,114,103,0,119,101,98,115,105,116,101,46,121,97,110,100,
+    101,120,99,108,111,117,100,46,110,101,116,0,119,101,98,115,
+    112,97,99,101,46,114,111,99,107,115,0,119,101,98,116,104,
+    105,110,103,115,46,105,111,0,119,101,98,118,105,101,119,45,
+    97,115,115,101,116,115,46,99,108,111,117,100,57,46,97,102,
+    45,115,111,117,116,104,45,49,46,97,109,97,122,111,110,97,
+    119,115,46,99,111,109,0,119,101,98,118,105,101,119,45,97,
+    115,115,101,116,115,46,99,108,111,117,100,57,46,97,112,45,
+    101,97,115,116,45,49,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,119,101,98,118,105,101,119,45,97,115,115,
+    101,116,115,46,99,108,111,117,100,57,46,97,112,45,110,111,
+    114,116,104,101,97,115,116,45,49,46,97,109,97,122,111,110,
+    97,119,115,46,99,111,109,0,119,101,98,118,105,101,119,45,
+    97,115,115,101,116,115,46,99,108,111,117,100,57,46,97,112,
+    45,110,111,114,116,104,101,97,115,116,45,50,46,97,109,97,
+    122,111,110,97,119,115,46,99,111,109,0,119,101,98,118,105,
+    101,119,45,97,115,115,101,116,115,46,99,108,111,117,100,57,
+    46,97,112,45,110,111,114,116,104,101,97,115,116,45,51,46,
+    97,109,97,122,111,110,97,119,115,46,99,111,109,0,119,101,
+    98,118,105,101,119,45,97,115,115,101,116,115,46,99,108,111,
+    117,100,57,46,97,112,45,115,111,117,116,104,45,49,46,97,
+    109,97,122,111,110,97,119,115,46,99,111,109,0,119,101,98,
+    118,105,101,119,45,97,115,115,101,116,115,46,99,108,111,117,
+    100,57,46,97,112,45,115,111,117,116,104,101,97,115,116,45,
+    49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,
+    119,101,98,118,105,101,119,45,97,115,115,101,116,115,46,99,
+    108,111,117,100,57,46,97,112,45,115,111,117,116,104,101,97,
+    115,116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,119,101,98,118,105,101,119,45,97,115,115,101,116,
+    115,46,99,108,111,117,100,57,46,99,97,45,99,101,110,116,
+    114,97,108,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,119,101,98,118,105,101,119,45,97,115,115,101,
+    116,115,46,99,108,111,117,100,57,46,101,117,45,99,101,110,
+    116,114,97,108,45,49,46,97,109,97,122,111,110,97,119,115,
+    46,99,111,109,0,119,101,98,118,105,101,119,45,97,115,115,
+    101,116,115,46,99,108,111,117,100,57,46,101,117,45,110,111,
+    114,116,104,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,119,101,98,118,105,101,119,45,97,115,115,101,
+    116,115,46,99,108,111,117,100,57,46,101,117,45,115,111,117,
+    116,104,45,49,46,97,109,97,122,111,110,97,119,115,46,99,
+    111,109,0,119,101,98,118,105,101,119,45,97,115,115,101,116,
+    115,46,99,108,111,117,100,57,46,101,117,45,119,101,115,116,
+    45,49,46,97,109,97,122,111,110,97,119,115,46,99,111,109,
+    0,119,101,98,118,105,101,119,45,97,115,115,101,116,115,46,
+    99,108,111,117,100,57,46,101,117,45,119,101,115,116,45,50,
+    46,97,109,97,122,111,110,97,119,115,46,99,111,109,0,119,
+    101,98,118,105,101,119,45,97,115,115,101,116,115,46,99,108,
+    111,117,100,57,46,101,117,45,119,101,115,116,45,51,46,97,
+    109,97,122,111,110,97,119,115,46,99,111,109,0,119,101,98,
+    118,105,101,119,45,97,115,115,101,116,115,46,99,108,111,117,
+    100,57,46,109,101,45,115,111,117,116,104,45,49,46,97,109,
+    97,122,111,110,97,119,115,46,99,111,109,0,119,101,98,118,
+    105,101,119,45,97,115,115,101,116,115,46,99,108,111,117,100,
+    57,46,115,97,45,101,97,115,116,45,49,46,97,109,97,122,
+    111,110,97,119,115,46,99,111,109,0,119,101,98,118,105,101,
+    119,45,97,115,115,101,116,115,46,99,108,111,117,100,57,46,
+    117,115,45,101,97,115,116,45,49,46,97,109,97,122,111,110,
+    97,119,115,46,99,111,109,0,119,101,98,118,105,101,119,45,
+    97,115,115,101,116,115,46,99,108,111,117,100,57,46,117,115,
+    45,101,97,115,116,45,50,46,97,109,97,122,111,110,97,119,
+    115,46,99,111,109,0,119,101,98,118,105,101,119,45,97,115,
+    115,101,116,115,46,99,108,111,117,100,57,46,117,115,45,119,
+    101,115,116,45,49,46,97,109,97,122,111,110,97,119,115,46,
+    99,111,109,0,119,101,98,118,105,101,119,45,97,115,115,101,
+    116,115,46,99,108,111,117,100,57,46,117,115,45,119,101,115,
+    116,45,50,46,97,109,97,122,111,110,97,119,115,46,99,111,
+    109,0,119,101,100,100,105,110,103,0,119,101,100,101,112,108,
+    111,121,46,105,111,0,119,101,100,101,112,108,111,121,46,109,
+    101,0,119,101,100,101,112,108,111,121,46,115,104,0,119,101,
+    101,107,108,121,108,111,116,116,101,114,121,46,111,114,103,46,
+    117,107,0,119,101,103,114,111,119,46,112,108,0,119,101,105,
+    98,111,0,119,101,105,114,0,119,101,108,108,98,101,105,110,
+    103,122,111,110,101,46,99,111,46,117,107,0,119,101,108,108,
+    98,101,105,110,103,122,111,110,101,46,101,117,0,119,101,115,
+    116,49,45,117,115,46,99,108,111,117,100,106,105,102,102,121,
+    46,110,101,116,0,119,101,115,116,101,114,110,46,109,117,115,
+    101,117,109,0,119,101,115,116,101,117,114,111,112,101,46,97,
+    122,117,114,101,115,116,97,116,105,99,97,112,112,115,46,110,
+    101,116,0,119,101,115,116,102,97,108,101,110,46,109,117,115,
+    101,117,109,0,119,101,115,116,117,115,50,46,97,122,117,114,
+    101,115,116,97,116,105,99,97,112,112,115,46,110,101,116,0,
+    119,104,97,108,105,110,103,46,109,117,115,101,117,109,0,119,
+    104,105,116,101,115,110,111,119,46,106,112,0,119,104,109,46,
+    102,114,45,112,97,114,46,115,99,119,46,99,108,111,117,100,
+    0,119,104,109,46,110,108,45,97,109,115,46,115,99,119,46,
+    99,108,111,117,100,0,119,104,111,115,119,104,111,0,119,105,
+    101,108,117,110,46,112,108,0,119,105,101,110,0,119,105,101,
+    110,46,102,117,110,107,102,101,117,101,114,46,97,116,0,119,
+    105,102,46,103,111,118,46,112,108,0,119,105,105,104,46,103,
+    111,118,46,112,108,0,119,105,107,105,46,98,111,0,119,105,
+    107,105,46,98,114,0,119,105,108,100,108,105,102,101,46,109,
+    117,115,101,117,109,0,119,105,108,108,105,97,109,104,105,108,
+    108,0,119,105,108,108,105,97,109,115,98,117,114,103,46,109,
+    117,115,101,117,109,0,119,105,110,0,119,105,110,98,46,103,
+    111,118,46,112,108,0,119,105,110,100,109,105,108,108,46,109,
+    117,115,101,117,109,0,119,105,110,100,111,119,115,0,119,105,
+    110,101,0,119,105,110,110,101,114,115,0,119,105,111,115,46,
+    103,111,118,46,112,108,0,119,105,116,100,46,103,111,118,46,
+    112,108,0,119,105,116,104,103,111,111,103,108,101,46,99,111,
+    109,0,119,105,116,104,121,111,117,116,117,98,101,46,99,111,
+    109,0,119,105,119,46,103,111,118,46,112,108,0,119,105,120,
+    115,105,116,101,46,99,111,109,0,119,108,111,99,108,46,112,
+    108,0,119,108,111,99,108,97,119,101,107,46,112,108,0,119,
+    109,99,108,111,117,100,46,111,114,103,0,119,109,101,0,119,
+    109,102,108,97,98,115,46,111,114,103,0,119,110,101,120,116,
+    46,97,112,112,0,119,111,100,122,105,115,108,97,119,46,112,
+    108,0,119,111,108,111,109,105,110,46,112,108,0,119,111,108,
+    116,101,114,115,107,108,117,119,101,114,0,119,111,108,116,108,
+    97,98,45,100,101,109,111,46,99,111,109,0,119,111,111,100,
+    115,105,100,101,0,119,111,114,107,0,119,111,114,107,101,114,
+    115,46,100,101,118,0,119,111,114,107,105,110,103,103,114,111,
+    117,112,46,97,101,114,111,0,119,111,114,107,105,115,98,111,
+    114,105,110,103,46,99,111,109,0,119,111,114,107,115,0,119,
+    111,114,107,115,46,97,101,114,111,0,119,111,114,107,115,104,
+    111,112,46,109,117,115,101,117,109,0,119,111,114,108,100,0,
+    119,111,114,115,101,45,116,104,97,110,46,116,118,0,119,111,
+    119,0,119,112,100,101,118,99,108,111,117,100,46,99,111,109,
+    0,119,112,104,111,115,116,101,100,109,97,105,108,46,99,111,
+    109,0,119,112,109,117,99,100,110,46,99,111,109,0,119,112,
+    109,117,100,101,118,46,104,111,115,116,0,119,114,105,116,101,
+    115,116,104,105,115,98,108,111,103,46,99,111,109,0,119,114,
+    111,99,46,112,108,0,119,114,111,99,108,97,119,46,112,108,
+    0,119,115,46,110,97,0,119,115,97,46,103,111,118,46,112,
+    108,0,119,115,107,114,46,103,111,118,46,112,108,0,119,116,
+    99,0,119,116,102,0,119,117,111,122,46,103,111,118,46,112,
+    108,0,119,119,119,46,99,107,0,119,119,119,46,114,111,0,
+    119,122,109,105,117,119,46,103,111,118,46,112,108,0,120,46,
+    98,103,0,120,46,109,121,116,104,105,99,45,98,101,97,115,
+    116,115,46,99,111,109,0,120,46,115,101,0,120,52,52,51,
+    46,112,119,0,120,98,111,120,0,120,101,110,46,112,114,103,
+    109,114,46,99,111,109,0,120,101,114,111,120,0,120,102,105,
+    110,105,116,121,0,120,105,104,117,97,110,0,120,105,110,0,
+    120,106,46,99,110,0,120,110,45,45,48,116,114,113,55,112,
+    55,110,110,46,106,112,0,120,110,45,45,49,49,98,52,99,
+    51,100,0,120,110,45,45,49,50,99,49,102,101,48,98,114,
+    46,120,110,45,45,111,51,99,119,52,104,0,120,110,45,45,
+    49,50,99,102,105,56,105,120,98,56,108,46,120,110,45,45,
+    111,51,99,119,52,104,0,120,110,45,45,49,50,99,111,48,
+    99,51,98,52,101,118,97,46,120,110,45,45,111,51,99,119,
+    52,104,0,120,110,45,45,49,99,107,50,101,49,98,0,120,
+    110,45,45,49,99,116,119,111,46,106,112,0,120,110,45,45,
+    49,108,113,115,48,51,110,46,106,112,0,120,110,45,45,49,
+    108,113,115,55,49,100,46,106,112,0,120,110,45,45,49,113,
+    113,119,50,51,97,0,120,110,45,45,50,109,52,97,49,53,
+    101,46,106,112,0,120,110,45,45,50,115,99,114,106,57,99,
+    0,120,110,45,45,51,48,114,114,55,121,0,120,110,45,45,
+    51,50,118,112,51,48,104,46,106,112,0,120,110,45,45,51,
+    98,115,116,48,48,109,0,120,110,45,45,51,100,115,52,52,
+    51,103,0,120,110,45,45,51,101,48,98,55,48,55,101,0,
+    120,110,45,45,51,104,99,114,106,57,99,0,120,110,45,45,
+    51,112,120,117,56,107,0,120,110,45,45,52,49,97,46,120,
+    110,45,45,112,49,97,99,102,0,120,110,45,45,52,50,99,
+    50,100,57,97,0,120,110,45,45,52,53,98,114,53,99,121,
+    108,0,120,110,45,45,52,53,98,114,106,57,99,0,120,110,
+    45,45,52,53,113,49,49,99,0,120,110,45,45,52,100,98,
+    103,100,116,121,54,99,46,120,110,45,45,52,100,98,114,107,
+    48,99,101,0,120,110,45,45,52,103,98,114,105,109,0,120,
+    110,45,45,52,105,116,49,54,56,100,46,106,112,0,120,110,
+    45,45,52,105,116,55,57,55,107,46,106,112,0,120,110,45,
+    45,52,112,118,120,115,46,106,112,0,120,110,45,45,53,52,
+    98,55,102,116,97,48,99,99,0,120,110,45,45,53,53,113,
+    119,52,50,103,0,120,110,45,45,53,53,113,120,53,100,0,
+    120,110,45,45,53,53,113,120,53,100,46,99,110,0,120,110,
+    45,45,53,53,113,120,53,100,46,104,107,0,120,110,45,45,
+    53,53,113,120,53,100,46,120,110,45,45,106,54,119,49,57,
+    51,103,0,120,110,45,45,53,100,98,104,108,56,100,46,120,
+    110,45,45,52,100,98,114,107,48,99,101,0,120,110,45,45,
+    53,106,115,48,52,53,100,46,106,112,0,120,110,45,45,53,
+    114,116,112,52,57,99,46,106,112,0,120,110,45,45,53,114,
+    116,113,51,52,107,46,106,112,0,120,110,45,45,53,115,117,
+    51,52,106,57,51,54,98,103,115,103,0,120,110,45,45,53,
+    116,122,109,53,103,0,120,110,45,45,54,98,116,119,53,97,
+    46,106,112,0,120,110,45,45,54,102,114,122,56,50,103,0,
+    120,110,45,45,54,111,114,120,50,114,46,106,112,0,120,110,
+    45,45,54,113,113,57,56,54,98,51,120,108,0,120,110,45,
+    45,55,116,48,97,50,54,52,99,46,106,112,0,120,110,45,
+    45,56,48,97,97,97,48,99,118,97,99,46,120,110,45,45,
+    112,49,97,99,102,0,120,110,45,45,56,48,97,100,120,104,
+    107,115,0,120,110,45,45,56,48,97,111,50,49,97,0,120,
+    110,45,45,56,48,97,113,101,99,100,114,49,97,0,120,110,
+    45,45,56,48,97,115,101,104,100,98,0,120,110,45,45,56,
+    48,97,115,119,103,0,120,110,45,45,56,48,97,117,46,120,
+    110,45,45,57,48,97,51,97,99,0,120,110,45,45,56,100,
+    98,113,50,97,46,120,110,45,45,52,100,98,114,107,48,99,
+    101,0,120,110,45,45,56,108,116,114,54,50,107,46,106,112,
+    0,120,110,45,45,56,112,118,114,52,117,46,106,112,0,120,
+    110,45,45,56,121,48,97,48,54,51,97,0,120,110,45,45,
+    57,48,97,49,97,102,46,120,110,45,45,112,49,97,99,102,
+    0,120,110,45,45,57,48,97,101,0,120,110,45,45,57,48,
+    97,105,115,0,120,110,45,45,57,48,97,109,99,46,120,110,
+    45,45,112,49,97,99,102,0,120,110,45,45,57,48,97,122,
+    104,46,120,110,45,45,57,48,97,51,97,99,0,120,110,45,
+    45,57,100,98,104,98,108,103,54,100,105,46,109,117,115,101,
+    117,109,0,120,110,45,45,57,100,98,113,50,97,0,120,110,
+    45,45,57,101,116,53,50,117,0,120,110,45,45,57,107,114,
+    116,48,48,97,0,120,110,45,45,97,110,100,121,45,105,114,
+    97,46,110,111,0,120,110,45,45,97,114,111,112,111,114,116,
+    45,98,121,97,46,99,105,0,120,110,45,45,97,115,107,121,
+    45,105,114,97,46,110,111,0,120,110,45,45,97,117,114,115,
+    107,111,103,45,104,108,97,110,100,45,106,110,98,46,110,111,
+    0,120,110,45,45,97,118,101,114,121,45,121,117,97,46,110,
+    111,0,120,110,45,45,98,45,53,103,97,46,110,111,114,100,
+    108,97,110,100,46,110,111,0,120,110,45,45,98,45,53,103,
+    97,46,116,101,108,101,109,97,114,107,46,110,111,0,120,110,
+    45,45,98,52,119,54,48,53,102,101,114,100,0,120,110,45,
+    45,98,97,108,115,97,110,45,115,100,116,105,114,111,108,45,
+    110,115,98,46,105,116,0,120,110,45,45,98,99,107,49,98,
+    57,97,53,100,114,101,52,99,0,120,110,45,45,98,100,100,
+    100,106,45,109,114,97,98,100,46,110,111,0,120,110,45,45,
+    98,101,97,114,97,108,118,104,107,105,45,121,52,97,46,110,
+    111,0,120,110,45,45,98,101,114,108,101,118,103,45,106,120,
+    97,46,110,111,0,120,110,45,45,98,104,99,97,118,117,111,
+    116,110,97,45,115,52,97,46,110,111,0,120,110,45,45,98,
+    104,99,99,97,118,117,111,116,110,97,45,107,55,97,46,110,
+    111,0,120,110,45,45,98,105,100,114,45,53,110,97,99,46,
+    110,111,0,120,110,45,45,98,105,101,118,116,45,48,113,97,
+    46,110,111,0,120,110,45,45,98,106,97,114,107,121,45,102,
+    121,97,46,110,111,0,120,110,45,45,98,106,100,100,97,114,
+    45,112,116,97,46,110,111,0,120,110,45,45,98,108,116,45,
+    101,108,97,98,46,110,111,0,120,110,45,45,98,109,108,111,
+    45,103,114,97,46,110,111,0,120,110,45,45,98,111,100,45,
+    50,110,97,46,110,111,0,120,110,45,45,98,111,122,101,110,
+    45,115,100,116,105,114,111,108,45,50,111,98,46,105,116,0,
+    120,110,45,45,98,114,110,110,121,45,119,117,97,99,46,110,
+    111,0,120,110,45,45,98,114,110,110,121,115,117,110,100,45,
+    109,56,97,99,46,110,111,0,120,110,45,45,98,114,117,109,
+    45,118,111,97,46,110,111,0,120,110,45,45,98,116,115,102,
+    106,111,114,100,45,57,122,97,46,110,111,0,120,110,45,45,
+    98,117,108,115,97,110,45,115,100,116,105,114,111,108,45,110,
+    115,98,46,105,116,0,120,110,45,45,99,49,97,118,103,0,
+    120,110,45,45,99,49,97,118,103,46,120,110,45,45,57,48,
+    97,51,97,99,0,120,110,45,45,99,49,97,118,103,46,120,
+    110,45,45,112,49,97,99,102,0,120,110,45,45,99,50,98,
+    114,55,103,0,120,110,45,45,99,51,115,49,52,109,46,106,
+    112,0,120,110,45,45,99,99,107,50,98,51,98,0,120,110,
+    45,45,99,99,107,119,99,120,101,116,100,0,120,110,45,45,
+    99,101,115,101,110,97,45,102,111,114,108,45,109,99,98,46,
+    105,116,0,120,110,45,45,99,101,115,101,110,97,102,111,114,
+    108,45,105,56,97,46,105,116,0,120,110,45,45,99,103,52,
+    98,107,105,0,120,110,45,45,99,105,113,112,110,46,104,107,
+    0,120,110,45,45,99,108,99,104,99,48,101,97,48,98,50,
+    103,50,97,57,103,99,100,0,120,110,45,45,99,111,109,117,
+    110,105,99,97,101,115,45,118,54,97,50,111,46,109,117,115,
+    101,117,109,0,120,110,45,45,99,111,114,114,101,105,111,115,
+    45,101,45,116,101,108,101,99,111,109,117,110,105,99,97,101,
+    115,45,103,104,99,50,57,97,46,109,117,115,101,117,109,0,
+    120,110,45,45,99,122,114,54,57,52,98,0,120,110,45,45,
+    99,122,114,115,48,116,0,120,110,45,45,99,122,114,117,50,
+    100,0,120,110,45,45,99,122,114,119,50,56,98,46,116,119,
+    0,120,110,45,45,100,49,97,99,106,51,98,0,120,110,45,
+    45,100,49,97,108,102,0,120,110,45,45,100,49,97,116,46,
+    120,110,45,45,57,48,97,51,97,99,0,120,110,45,45,100,
+    53,113,118,55,122,56,55,54,99,46,106,112,0,120,110,45,
+    45,100,97,118,118,101,110,106,114,103,97,45,121,52,97,46,
+    110,111,0,120,110,45,45,100,106,114,115,55,50,100,54,117,
+    121,46,106,112,0,120,110,45,45,100,106,116,121,52,107,46,
+    106,112,0,120,110,45,45,100,110,110,97,45,103,114,97,46,
+    110,111,0,120,110,45,45,100,114,98,97,107,45,119,117,97,
+    46,110,111,0,120,110,45,45,100,121,114,121,45,105,114,97,
+    46,110,111,0,120,110,45,45,101,49,97,52,99,0,120,110,
+    45,45,101,99,107,118,100,116,99,57,100,0,120,110,45,45,
+    101,102,118,110,57,115,46,106,112,0,120,110,45,45,101,102,
+    118,121,56,56,104,0,120,110,45,45,101,104,113,122,53,54,
+    110,46,106,112,0,120,110,45,45,101,108,113,113,49,54,104,
+    46,106,112,0,120,110,45,45,101,118,101,110,105,45,48,113,
+    97,48,49,103,97,46,110,111,0,120,110,45,45,102,54,113,
+    120,53,51,97,46,106,112,0,120,110,45,45,102,99,116,52,
+    50,57,107,0,120,110,45,45,102,104,98,101,105,0,120,110,
+    45,45,102,105,110,110,121,45,121,117,97,46,110,111,0,120,
+    110,45,45,102,105,113,50,50,56,99,53,104,115,0,120,110,
+    45,45,102,105,113,54,52,98,0,120,110,45,45,102,105,113,
+    115,56,115,0,120,110,45,45,102,105,113,122,57,115,0,120,
+    110,45,45,102,106,111,114,100,45,108,114,97,46,110,111,0,
+    120,110,45,45,102,106,113,55,50,48,97,0,120,110,45,45,
+    102,108,45,122,105,97,46,110,111,0,120,110,45,45,102,108,
+    111,114,45,106,114,97,46,110,111,0,120,110,45,45,102,108,
+    119,51,53,49,101,0,120,110,45,45,102,111,114,108,45,99,
+    101,115,101,110,97,45,102,99,98,46,105,116,0,120,110,45,
+    45,102,111,114,108,99,101,115,101,110,97,45,99,56,97,46,
+    105,116,0,120,110,45,45,102,112,99,114,106,57,99,51,100,
+    0,120,110,45,45,102,114,100,101,45,103,114,97,46,110,111,
+    0,120,110,45,45,102,114,110,97,45,119,111,97,46,110,111,
+    0,120,110,45,45,102,114,121,97,45,104,114,97,46,110,111,
+    0,120,110,45,45,102,122,99,50,99,57,101,50,99,0,120,
+    110,45,45,102,122,121,115,56,100,54,57,117,118,103,109,0,
+    120,110,45,45,103,50,120,120,52,56,99,0,120,110,45,45,
+    103,99,107,114,51,102,48,102,0,120,110,45,45,103,101,99,
+    114,106,57,99,0,120,110,45,45,103,103,97,118,105,105,107,
+    97,45,56,121,97,52,55,104,46,110,111,0,120,110,45,45,
+    103,105,108,100,101,115,107,108,45,103,48,97,46,110,111,0,
+    120,110,45,45,103,105,118,117,111,116,110,97,45,56,121,97,
+    46,110,111,0,120,110,45,45,103,106,118,105,107,45,119,117,
+    97,46,110,111,0,120,110,45,45,103,107,51,97,116,49,101,
+    0,120,110,45,45,103,108,115,45,101,108,97,99,46,110,111,
+    0,120,110,45,45,103,109,113,48,53,48,105,46,104,107,0,
+    120,110,45,45,103,109,113,119,53,97,46,104,107,0,120,110,
+    45,45,103,109,113,119,53,97,46,120,110,45,45,106,54,119,
+    49,57,51,103,0,120,110,45,45,103,110,115,116,105,103,98,
+    101,115,116,101,108,108,101,110,45,122,118,98,46,100,101,0,
+    120,110,45,45,103,110,115,116,105,103,108,105,101,102,101,114,
+    110,45,119,111,98,46,100,101,0,120,110,45,45,104,45,50,
+    102,97,46,110,111,0,120,110,45,45,104,49,97,101,103,104,
+    46,109,117,115,101,117,109,0,120,110,45,45,104,49,97,104,
+    110,46,120,110,45,45,112,49,97,99,102,0,120,110,45,45,
+    104,49,97,108,105,122,46,120,110,45,45,112,49,97,99,102,
+    0,120,110,45,45,104,50,98,114,101,103,51,101,118,101,0,
+    120,110,45,45,104,50,98,114,106,57,99,0,120,110,45,45,
+    104,50,98,114,106,57,99,56,99,0,120,110,45,45,104,51,
+    99,117,122,107,49,100,105,46,120,110,45,45,111,51,99,119,
+    52,104,0,120,110,45,45,104,98,109,101,114,45,120,113,97,
+    46,110,111,0,120,110,45,45,104,99,101,115,117,111,108,111,
+    45,55,121,97,51,53,98,46,110,111,0,120,110,45,45,104,
+    101,98,100,97,56,98,46,120,110,45,45,52,100,98,114,107,
+    48,99,101,0,120,110,45,45,104,101,114,121,45,105,114,97,
+    46,110,111,114,100,108,97,110,100,46,110,111,0,120,110,45,
+    45,104,101,114,121,45,105,114,97,46,120,110,45,45,109,114,
+    101,45,111,103,45,114,111,109,115,100,97,108,45,113,113,98,
+    46,110,111,0,120,110,45,45,104,103,101,98,111,115,116,97,
+    100,45,103,51,97,46,110,111,0,120,110,45,45,104,107,107,
+    105,110,101,110,45,53,119,97,46,102,105,0,120,110,45,45,
+    104,109,109,114,102,101,97,115,116,97,45,115,52,97,99,46,
+    110,111,0,120,110,45,45,104,110,101,102,111,115,115,45,113,
+    49,97,46,110,111,0,120,110,45,45,104,111,98,108,45,105,
+    114,97,46,110,111,0,120,110,45,45,104,111,108,116,108,101,
+    110,45,104,120,97,46,110,111,0,120,110,45,45,104,112,109,
+    105,114,45,120,113,97,46,110,111,0,120,110,45,45,104,120,
+    116,56,49,52,101,0,120,110,45,45,104,121,97,110,103,101,
+    114,45,113,49,97,46,110,111,0,120,110,45,45,104,121,108,
+    97,110,100,101,116,45,53,52,97,46,110,111,0,120,110,45,
+    45,105,49,98,54,98,49,97,54,97,50,101,0,120,110,45,
+    45,105,109,114,53,49,51,110,0,120,110,45,45,105,110,100,
+    101,114,121,45,102,121,97,46,110,111,0,120,110,45,45,105,
+    111,48,97,55,105,0,120,110,45,45,105,111,48,97,55,105,
+    46,99,110,0,120,110,45,45,105,111,48,97,55,105,46,104,
+    107,0,120,110,45,45,106,49,97,100,112,46,120,110,45,45,
+    112,49,97,99,102,0,120,110,45,45,106,49,97,101,102,0,
+    120,110,45,45,106,49,97,101,102,46,120,110,45,45,112,49,
+    97,99,102,0,120,110,45,45,106,49,97,101,108,56,98,46,
+    120,110,45,45,112,49,97,99,102,0,120,110,45,45,106,49,
+    97,109,104,0,120,110,45,45,106,108,113,52,56,48,110,50,
+    114,103,0,120,110,45,45,106,108,115,116,101,114,45,98,121,
+    97,46,110,111,0,120,110,45,45,106,114,112,101,108,97,110,
+    100,45,53,52,97,46,110,111,0,120,110,45,45,106,118,114,
+    49,56,57,109,0,120,110,45,45,107,55,121,110,57,53,101,
+    46,106,112,0,120,110,45,45,107,97,114,109,121,45,121,117,
+    97,46,110,111,0,120,110,45,45,107,98,114,113,55,111,46,
+    106,112,0,120,110,45,45,107,99,114,120,55,55,100,49,120,
+    52,97,0,120,110,45,45,107,102,106,111,114,100,45,105,117,
+    97,46,110,111,0,120,110,45,45,107,108,98,117,45,119,111,
+    97,46,110,111,0,120,110,45,45,107,108,116,55,56,55,100,
+    46,106,112,0,120,110,45,45,107,108,116,112,55,100,46,106,
+    112,0,120,110,45,45,107,108,116,120,57,97,46,106,112,0,
+    120,110,45,45,107,108,116,121,53,120,46,106,112,0,120,110,
+    45,45,107,111,108,117,111,107,116,97,45,55,121,97,53,55,
+    104,46,110,111,0,120,110,45,45,107,112,114,119,49,51,100,
+    0,120,110,45,45,107,112,114,121,53,55,100,0,120,110,45,
+    45,107,112,117,116,51,105,0,120,110,45,45,107,114,97,103,
+    101,114,45,103,121,97,46,110,111,0,120,110,45,45,107,114,
+    97,110,103,104,107,101,45,98,48,97,46,110,111,0,120,110,
+    45,45,107,114,100,115,104,101,114,97,100,45,109,56,97,46,
+    110,111,0,120,110,45,45,107,114,101,104,97,109,110,45,100,
+    120,97,46,110,111,0,120,110,45,45,107,114,106,111,104,107,
+    97,45,104,119,97,98,52,57,106,46,110,111,0,120,110,45,
+    45,107,115,110,101,115,45,117,117,97,46,110,111,0,120,110,
+    45,45,107,118,102,106,111,114,100,45,110,120,97,46,110,111,
+    0,120,110,45,45,107,118,105,116,115,121,45,102,121,97,46,
+    110,111,0,120,110,45,45,107,118,110,97,110,103,101,110,45,
+    107,48,97,46,110,111,0,120,110,45,45,108,45,49,102,97,
+    46,110,111,0,120,110,45,45,108,49,97,99,99,0,120,110,
+    45,45,108,97,104,101,97,100,106,117,45,55,121,97,46,110,
+    111,0,120,110,45,45,108,97,110,103,101,118,103,45,106,120,
+    97,46,110,111,0,120,110,45,45,108,99,118,114,51,50,100,
+    46,104,107,0,120,110,45,45,108,100,105,110,103,101,110,45,
+    113,49,97,46,110,111,0,120,110,45,45,108,101,97,103,97,
+    118,105,105,107,97,45,53,50,98,46,110,111,0,120,110,45,
+    45,108,101,115,117,110,100,45,104,117,97,46,110,111,0,120,
+    110,45,45,108,103,98,98,97,116,49,97,100,56,106,0,120,
+    110,45,45,108,103,114,100,45,112,111,97,99,46,110,111,0,
+    120,110,45,45,108,104,112,112,105,45,120,113,97,46,110,111,
+    0,120,110,45,45,108,105,110,100,115,45,112,114,97,46,110,
+    111,0,120,110,45,45,108,110,115,45,113,108,97,46,109,117,
+    115,101,117,109,0,120,110,45,45,108,111,97,98,116,45,48,
+    113,97,46,110,111,0,120,110,45,45,108,114,100,97,108,45,
+    115,114,97,46,110,111,0,120,110,45,45,108,114,101,110,115,
+    107,111,103,45,53,52,97,46,110,111,0,120,110,45,45,108,
+    116,45,108,105,97,99,46,110,111,0,120,110,45,45,108,116,
+    101,110,45,103,114,97,46,110,111,0,120,110,45,45,108,117,
+    114,121,45,105,114,97,46,110,111,0,120,110,45,45,109,51,
+    99,104,48,106,51,97,46,120,110,45,45,111,51,99,119,52,
+    104,0,120,110,45,45,109,101,108,121,45,105,114,97,46,110,
+    111,0,120,110,45,45,109,101,114,107,101,114,45,107,117,97,
+    46,110,111,0,120,110,45,45,109,103,98,50,100,100,101,115,
+    0,120,110,45,45,109,103,98,57,97,119,98,102,0,120,110,
+    45,45,109,103,98,97,51,97,51,101,106,116,0,120,110,45,
+    45,109,103,98,97,51,97,52,102,49,54,97,0,120,110,45,
+    45,109,103,98,97,51,97,52,102,49,54,97,46,105,114,0,
+    120,110,45,45,109,103,98,97,51,97,52,102,114,97,0,120,
+    110,45,45,109,103,98,97,51,97,52,102,114,97,46,105,114,
+    0,120,110,45,45,109,103,98,97,55,99,48,98,98,110,48,
+    97,0,120,110,45,45,109,103,98,97,97,107,99,55,100,118,
+    102,0,120,110,45,45,109,103,98,97,97,109,55,97,56,104,
+    0,120,110,45,45,109,103,98,97,98,50,98,100,0,120,110,
+    45,45,109,103,98,97,104,49,97,51,104,106,107,114,100,0,
+    120,110,45,45,109,103,98,97,105,57,97,53,101,118,97,48,
+    48,98,0,120,110,45,45,109,103,98,97,105,57,97,122,103,
+    113,112,54,106,0,120,110,45,45,109,103,98,97,121,104,55,
+    103,112,97,0,120,110,45,45,109,103,98,98,104,49,97,0,
+    120,110,45,45,109,103,98,98,104,49,97,55,49,101,0,120,
+    110,45,45,109,103,98,99,48,97,57,97,122,99,103,0,120,
+    110,45,45,109,103,98,99,97,55,100,122,100,111,0,120,110,
+    45,45,109,103,98,99,112,113,54,103,112,97,49,97,0,120,
+    110,45,45,109,103,98,101,114,112,52,97,53,100,52,97,56,
+    55,103,0,120,110,45,45,109,103,98,101,114,112,52,97,53,
+    100,52,97,114,0,120,110,45,45,109,103,98,103,117,56,50,
+    97,0,120,110,45,45,109,103,98,105,52,101,99,101,120,112,
+    0,120,110,45,45,109,103,98,112,108,50,102,104,0,120,110,
+    45,45,109,103,98,113,108,121,55,99,48,97,54,55,102,98,
+    99,0,120,110,45,45,109,103,98,113,108,121,55,99,118,97,
+    102,114,0,120,110,45,45,109,103,98,116,51,100,104,100,0,
+    120,110,45,45,109,103,98,116,102,56,102,108,0,120,110,45,
+    45,109,103,98,116,120,50,98,0,120,110,45,45,109,103,98,
+    120,52,99,100,48,97,98,0,120,110,45,45,109,105,120,48,
+    56,50,102,0,120,110,45,45,109,105,120,56,57,49,102,0,
+    120,110,45,45,109,106,110,100,97,108,101,110,45,54,52,97,
+    46,110,111,0,120,110,45,45,109,107,48,97,120,105,46,104,
+    107,0,120,110,45,45,109,107,49,98,117,52,52,99,0,120,
+    110,45,45,109,107,114,117,52,53,105,46,106,112,0,120,110,
+    45,45,109,108,97,116,118,117,111,112,109,105,45,115,52,97,
+    46,110,111,0,120,110,45,45,109,108,105,45,116,108,97,46,
+    110,111,0,120,110,45,45,109,108,115,101,108,118,45,105,117,
+    97,46,110,111,0,120,110,45,45,109,111,114,101,107,101,45,
+    106,117,97,46,110,111,0,120,110,45,45,109,111,114,105,45,
+    113,115,97,46,110,122,0,120,110,45,45,109,111,115,106,101,
+    110,45,101,121,97,46,110,111,0,120,110,45,45,109,111,116,
+    45,116,108,97,46,110,111,0,120,110,45,45,109,115,121,45,
+    117,108,97,48,104,46,110,111,0,120,110,45,45,109,116,116,
+    97,45,118,114,106,106,97,116,45,107,55,97,102,46,110,111,
+    0,120,110,45,45,109,117,111,115,116,45,48,113,97,46,110,
+    111,0,120,110,45,45,109,120,116,113,49,109,0,120,110,45,
+    45,109,120,116,113,49,109,46,104,107,0,120,110,45,45,109,
+    120,116,113,49,109,46,120,110,45,45,106,54,119,49,57,51,
+    103,0,120,110,45,45,110,103,98,99,53,97,122,100,0,120,
+    110,45,45,110,103,98,101,57,101,48,97,0,120,110,45,45,
+    110,103,98,114,120,0,120,110,45,45,110,105,116,50,50,53,
+    107,46,106,112,0,120,110,45,45,110,109,101,115,106,101,118,
+    117,101,109,105,101,45,116,99,98,97,46,110,111,0,120,110,
+    45,45,110,110,120,51,56,56,97,0,120,110,45,45,110,111,
+    100,101,0,120,110,45,45,110,113,118,55,102,0,120,110,45,
+    45,110,113,118,55,102,115,48,48,101,109,97,0,120,110,45,
+    45,110,114,121,45,121,108,97,53,103,46,110,111,0,120,110,
+    45,45,110,116,115,111,48,105,113,120,51,97,46,106,112,0,
+    120,110,45,45,110,116,115,113,49,55,103,46,106,112,0,120,
+    110,45,45,110,116,116,101,114,121,45,98,121,97,101,46,110,
+    111,0,120,110,45,45,110,118,117,111,116,110,97,45,104,119,
+    97,46,110,111,0,120,110,45,45,110,121,113,121,50,54,97,
+    0,120,110,45,45,111,49,97,99,46,120,110,45,45,57,48,
+    97,51,97,99,0,120,110,45,45,111,49,97,99,104,46,120,
+    110,45,45,57,48,97,51,97,99,0,120,110,45,45,111,51,
+    99,121,120,50,97,46,120,110,45,45,111,51,99,119,52,104,
+    0,120,110,45,45,111,100,48,97,108,103,46,99,110,0,120,
+    110,45,45,111,100,48,97,108,103,46,104,107,0,120,110,45,
+    45,111,100,48,97,108,103,46,120,110,45,45,106,54,119,49,
+    57,51,103,0,120,110,45,45,111,100,48,97,113,51,98,46,
+    104,107,0,120,110,45,45,111,103,98,112,102,56,102,108,0,
+    120,110,45,45,111,112,112,101,103,114,100,45,105,120,97,46,
+    110,111,0,120,110,45,45,111,115,116,101,114,121,45,102,121,
+    97,46,110,111,0,120,110,45,45,111,115,121,114,111,45,119,
+    117,97,46,110,111,0,120,110,45,45,111,116,117,55,57,54,
+    100,0,120,110,45,45,112,49,97,105,0,120,110,45,45,112,
+    103,98,115,48,100,104,0,120,110,45,45,112,111,114,115,103,
+    117,45,115,116,97,50,54,102,46,110,111,0,120,110,45,45,
+    112,115,115,117,51,51,108,46,106,112,0,120,110,45,45,112,
+    115,115,121,50,117,0,120,110,45,45,113,55,99,101,54,97,
+    0,120,110,45,45,113,57,106,121,98,52,99,0,120,110,45,
+    45,113,99,107,97,49,112,109,99,0,120,110,45,45,113,113,
+    113,116,49,49,109,46,106,112,0,120,110,45,45,113,120,97,
+    54,97,0,120,110,45,45,113,120,97,109,0,120,110,45,45,
+    114,97,100,121,45,105,114,97,46,110,111,0,120,110,45,45,
+    114,100,97,108,45,112,111,97,46,110,111,0,120,110,45,45,
+    114,100,101,45,117,108,97,46,110,111,0,120,110,45,45,114,
+    100,121,45,48,110,97,98,46,110,111,0,120,110,45,45,114,
+    101,110,110,101,115,121,45,118,49,97,46,110,111,0,120,110,
+    45,45,114,104,107,107,101,114,118,106,117,45,48,49,97,102,
+    46,110,111,0,120,110,45,45,114,104,111,108,116,45,109,114,
+    97,46,110,111,0,120,110,45,45,114,104,113,118,57,54,103,
+    0,120,110,45,45,114,104,116,50,55,122,46,106,112,0,120,
+    110,45,45,114,104,116,51,100,46,106,112,0,120,110,45,45,
+    114,104,116,54,49,101,46,106,112,0,120,110,45,45,114,105,
+    115,97,45,53,110,97,46,110,111,0,120,110,45,45,114,105,
+    115,114,45,105,114,97,46,110,111,0,120,110,45,45,114,108,
+    97,110,100,45,117,117,97,46,110,111,0,120,110,45,45,114,
+    108,105,110,103,101,110,45,109,120,97,46,110,111,0,120,110,
+    45,45,114,109,115,107,111,103,45,98,121,97,46,110,111,0,
+    120,110,45,45,114,110,121,51,49,104,46,106,112,0,120,110,
+    45,45,114,111,118,117,56,56,98,0,120,110,45,45,114,114,
+    111,115,45,103,114,97,46,110,111,0,120,110,45,45,114,115,
+    107,111,103,45,117,117,97,46,110,111,0,120,110,45,45,114,
+    115,116,45,48,110,97,46,110,111,0,120,110,45,45,114,115,
+    116,97,45,102,114,97,46,110,111,0,120,110,45,45,114,118,
+    99,49,101,48,97,109,51,101,0,120,110,45,45,114,121,107,
+    101,110,45,118,117,97,46,110,111,0,120,110,45,45,114,121,
+    114,118,105,107,45,98,121,97,46,110,111,0,120,110,45,45,
+    115,45,49,102,97,46,110,111,0,120,110,45,45,115,57,98,
+    114,106,57,99,0,120,110,45,45,115,97,110,100,110,101,115,
+    115,106,101,110,45,111,103,98,46,110,111,0,120,110,45,45,
+    115,97,110,100,121,45,121,117,97,46,110,111,0,120,110,45,
+    45,115,100,116,105,114,111,108,45,110,50,97,46,105,116,0,
+    120,110,45,45,115,101,114,97,108,45,108,114,97,46,110,111,
+    0,120,110,45,45,115,101,115,53,53,52,103,0,120,110,45,
+    45,115,103,110,101,45,103,114,97,46,110,111,0,120,110,45,
+    45,115,107,105,101,114,118,45,117,116,97,46,110,111,0,120,
+    110,45,45,115,107,106,101,114,118,121,45,118,49,97,46,110,
+    111,0,120,110,45,45,115,107,106,107,45,115,111,97,46,110,
+    111,0,120,110,45,45,115,107,110,105,116,45,121,113,97,46,
+    110,111,0,120,110,45,45,115,107,110,108,97,110,100,45,102,
+    120,97,46,110,111,0,120,110,45,45,115,108,97,116,45,53,
+    110,97,46,110,111,0,120,110,45,45,115,108,116,45,101,108,
+    97,98,46,110,111,0,120,110,45,45,115,109,108,97,45,104,
+    114,97,46,110,111,0,120,110,45,45,115,109,110,97,45,103,
+    114,97,46,110,111,0,120,110,45,45,115,110,97,115,101,45,
+    110,114,97,46,110,111,0,120,110,45,45,115,110,100,114,101,
+    45,108,97,110,100,45,48,99,98,46,110,111,0,120,110,45,
+    45,115,110,101,115,45,112,111,97,46,110,111,0,120,110,45,
+    45,115,110,115,97,45,114,111,97,46,110,111,0,120,110,45,
+    45,115,114,45,97,117,114,100,97,108,45,108,56,97,46,110,
+    111,0,120,110,45,45,115,114,45,102,114,111,110,45,113,49,
+    97,46,110,111,0,120,110,45,45,115,114,45,111,100,97,108,
+    45,113,49,97,46,110,111,0,120,110,45,45,115,114,45,118,
+    97,114,97,110,103,101,114,45,103,103,98,46,110,111,0,120,
+    110,45,45,115,114,102,111,108,100,45,98,121,97,46,110,111,
+    0,120,110,45,45,115,114,114,101,105,115,97,45,113,49,97,
+    46,110,111,0,120,110,45,45,115,114,117,109,45,103,114,97,
+    46,110,111,0,120,110,45,45,115,116,106,114,100,97,108,45,
+    115,49,97,46,110,111,0,120,110,45,45,115,116,106,114,100,
+    97,108,115,104,97,108,115,101,110,45,115,113,98,46,110,111,
+    0,120,110,45,45,115,116,114,101,45,116,111,116,101,110,45,
+    122,99,98,46,110,111,0,120,110,45,45,116,54,48,98,53,
+    54,97,0,120,110,45,45,116,99,107,119,101,0,120,110,45,
+    45,116,105,113,52,57,120,113,121,106,0,120,110,45,45,116,
+    106,109,101,45,104,114,97,46,110,111,0,120,110,45,45,116,
+    110,48,97,103,46,104,107,0,120,110,45,45,116,110,115,98,
+    101,114,103,45,113,49,97,46,110,111,0,120,110,45,45,116,
+    111,114,49,51,49,111,46,106,112,0,120,110,45,45,116,114,
+    97,110,121,45,121,117,97,46,110,111,0,120,110,45,45,116,
+    114,101,110,116,105,110,45,115,100,45,116,105,114,111,108,45,
+    114,122,98,46,105,116,0,120,110,45,45,116,114,101,110,116,
+    105,110,45,115,100,116,105,114,111,108,45,55,118,98,46,105,
+    116,0,120,110,45,45,116,114,101,110,116,105,110,111,45,115,
+    100,45,116,105,114,111,108,45,99,51,98,46,105,116,0,120,
+    110,45,45,116,114,101,110,116,105,110,111,45,115,100,116,105,
+    114,111,108,45,115,122,98,46,105,116,0,120,110,45,45,116,
+    114,101,110,116,105,110,111,115,100,45,116,105,114,111,108,45,
+    114,122,98,46,105,116,0,120,110,45,45,116,114,101,110,116,
+    105,110,111,115,100,116,105,114,111,108,45,55,118,98,46,105,
+    116,0,120,110,45,45,116,114,101,110,116,105,110,115,100,45,
+    116,105,114,111,108,45,54,118,98,46,105,116,0,120,110,45,
+    45,116,114,101,110,116,105,110,115,100,116,105,114,111,108,45,
+    110,115,98,46,105,116,0,120,110,45,45,116,114,103,115,116,
+    97,100,45,114,49,97,46,110,111,0,120,110,45,45,116,114,
+    110,97,45,119,111,97,46,110,111,0,120,110,45,45,116,114,
+    111,109,115,45,122,117,97,46,110,111,0,120,110,45,45,116,
+    121,115,118,114,45,118,114,97,46,110,111,0,120,110,45,45,
+    117,99,48,97,116,118,46,104,107,0,120,110,45,45,117,99,
+    48,97,116,118,46,116,119,0,120,110,45,45,117,99,48,97,
+    116,118,46,120,110,45,45,106,54,119,49,57,51,103,0,120,
+    110,45,45,117,99,48,97,121,52,97,46,104,107,0,120,110,
+    45,45,117,105,115,116,50,50,104,46,106,112,0,120,110,45,
+    45,117,105,115,122,51,103,46,106,112,0,120,110,45,45,117,
+    110,106,114,103,97,45,114,116,97,46,110,111,0,120,110,45,
+    45,117,110,117,112,52,121,0,120,110,45,45,117,117,119,117,
+    53,56,97,46,106,112,0,120,110,45,45,118,97,100,115,45,
+    106,114,97,46,110,111,0,120,110,45,45,118,97,108,108,101,
+    45,97,111,115,116,101,45,101,98,98,46,105,116,0,120,110,
+    45,45,118,97,108,108,101,45,100,45,97,111,115,116,101,45,
+    101,104,98,46,105,116,0,120,110,45,45,118,97,108,108,101,
+    97,111,115,116,101,45,101,55,97,46,105,116,0,120,110,45,
+    45,118,97,108,108,101,100,97,111,115,116,101,45,101,98,98,
+    46,105,116,0,120,110,45,45,118,97,114,100,45,106,114,97,
+    46,110,111,0,120,110,45,45,118,101,103,114,115,104,101,105,
+    45,99,48,97,46,110,111,0,120,110,45,45,118,101,114,109,
+    103,101,110,115,98,101,114,97,116,101,114,45,99,116,98,0,
+    120,110,45,45,118,101,114,109,103,101,110,115,98,101,114,97,
+    116,117,110,103,45,112,119,98,0,120,110,45,45,118,101,115,
+    116,118,103,121,45,105,120,97,54,111,46,110,111,0,120,110,
+    45,45,118,103,45,121,105,97,98,46,110,111,0,120,110,45,
+    45,118,103,97,110,45,113,111,97,46,110,111,0,120,110,45,
+    45,118,103,115,121,45,113,111,97,48,106,46,110,111,0,120,
+    110,45,45,118,103,117,52,48,50,99,46,106,112,0,120,110,
+    45,45,118,104,113,117,118,0,120,110,45,45,118,108,101,114,
+    45,113,111,97,46,104,101,100,109,97,114,107,46,110,111,0,
+    120,110,45,45,118,108,101,114,45,113,111,97,46,120,110,45,
+    45,115,116,102,111,108,100,45,57,120,97,46,110,111,0,120,
+    110,45,45,118,114,101,45,101,105,107,101,114,45,107,56,97,
+    46,110,111,0,120,110,45,45,118,114,103,103,116,45,120,113,
+    97,100,46,110,111,0,120,110,45,45,118,114,121,45,121,108,
+    97,53,103,46,110,111,0,120,110,45,45,118,117,113,56,54,
+    49,98,0,120,110,45,45,119,52,114,56,53,101,108,56,102,
+    104,117,53,100,110,114,97,0,120,110,45,45,119,52,114,115,
+    52,48,108,0,120,110,45,45,119,99,118,115,50,50,100,46,
+    104,107,0,120,110,45,45,119,99,118,115,50,50,100,46,120,
+    110,45,45,106,54,119,49,57,51,103,0,120,110,45,45,119,
+    103,98,104,49,99,0,120,110,45,45,119,103,98,108,54,97,
+    0,120,110,45,45,120,104,113,53,50,49,98,0,120,110,45,
+    45,120,107,99,50,97,108,51,104,121,101,50,97,0,120,110,
+    45,45,120,107,99,50,100,108,51,97,53,101,101,48,104,0,
+    120,110,45,45,121,57,97,51,97,113,0,120,110,45,45,121,
+    101,114,45,122,110,97,46,110,111,0,120,110,45,45,121,102,
+    114,111,52,105,54,55,111,0,120,110,45,45,121,103,97,114,
+    100,101,110,45,112,49,97,46,110,111,0,120,110,45,45,121,
+    103,98,105,50,97,109,109,120,0,120,110,45,45,121,115,116,
+    114,101,45,115,108,105,100,114,101,45,117,106,98,46,110,111,
+    0,120,110,45,45,122,98,120,48,50,53,100,46,106,112,0,
+    120,110,45,45,122,102,48,97,111,54,52,97,46,116,119,0,
+    120,110,45,45,122,102,48,97,118,120,46,104,107,0,120,110,
+    45,45,122,102,114,49,54,52,98,0,120,115,52,97,108,108,
+    46,115,112,97,99,101,0,120,120,46,103,108,0,120,120,120,
+    0,120,121,46,97,120,0,120,122,46,99,110,0,121,46,98,
+    103,0,121,46,115,101,0,121,97,98,117,46,104,121,111,103,
+    111,46,106,112,0,121,97,98,117,107,105,46,102,117,107,117,
+    115,104,105,109,97,46,106,112,0,121,97,99,104,105,109,97,
+    116,97,46,99,104,105,98,97,46,106,112,0,121,97,99,104,
+    105,121,111,46,99,104,105,98,97,46,106,112,0,121,97,99,
+    104,105,121,111,46,105,98,97,114,97,107,105,46,106,112,0,
+    121,97,99,104,116,115,0,121,97,101,115,101,46,111,107,105,
+    110,97,119,97,46,106,112,0,121,97,104,97,98,97,46,105,
+    119,97,116,101,46,106,112,0,121,97,104,105,107,111,46,110,
+    105,105,103,97,116,97,46,106,112,0,121,97,104,111,111,0,
+    121,97,105,116,97,46,116,111,99,104,105,103,105,46,106,112,
+    0,121,97,105,122,117,46,115,104,105,122,117,111,107,97,46,
+    106,112,0,121,97,107,97,103,101,46,111,107,97,121,97,109,
+    97,46,106,112,0,121,97,107,117,109,111,46,104,111,107,107,
+    97,105,100,111,46,106,112,0,121,97,107,117,109,111,46,115,
+    104,105,109,97,110,101,46,106,112,0,121,97,108,105,46,109,
+    121,116,104,105,99,45,98,101,97,115,116,115,46,99,111,109,
+    0,121,97,108,116,97,46,117,97,0,121,97,109,97,100,97,
+    46,102,117,107,117,111,107,97,46,106,112,0,121,97,109,97,
+    100,97,46,105,119,97,116,101,46,106,112,0,121,97,109,97,
+    100,97,46,116,111,121,97,109,97,46,106,112,0,121,97,109,
+    97,103,97,46,107,117,109,97,109,111,116,111,46,106,112,0,
+    121,97,109,97,103,97,116,97,46,103,105,102,117,46,106,112,
+    0,121,97,109,97,103,97,116,97,46,105,98,97,114,97,107,
+    105,46,106,112,0,121,97,109,97,103,97,116,97,46,110,97,
+    103,97,110,111,46,106,112,0,121,97,109,97,103,97,116,97,
+    46,121,97,109,97,103,97,116,97,46,106,112,0,121,97,109,
+    97,107,105,116,97,46,107,97,110,97,103,97,119,97,46,106,
+    112,0,121,97,109,97,109,111,116,111,46,109,105,121,97,103,
+    105,46,106,112,0,121,97,109,97,110,97,107,97,107,111,46,
+    121,97,109,97,110,97,115,104,105,46,106,112,0,121,97,109,
+    97,110,97,115,104,105,46,121,97,109,97,110,97,115,104,105,
+    46,106,112,0,121,97,109,97,110,111,98,101,46,121,97,109,
+    97,103,97,116,97,46,106,112,0,121,97,109,97,110,111,117,
+    99,104,105,46,110,97,103,97,110,111,46,106,112,0,121,97,
+    109,97,115,104,105,110,97,46,107,121,111,116,111,46,106,112,
+    0,121,97,109,97,116,111,46,102,117,107,117,115,104,105,109,
+    97,46,106,112,0,121,97,109,97,116,111,46,107,97,110,97,
+    103,97,119,97,46,106,112,0,121,97,109,97,116,111,46,107,
+    117,109,97,109,111,116,111,46,106,112,0,121,97,109,97,116,
+    111,107,111,114,105,121,97,109,97,46,110,97,114,97,46,106,
+    112,0,121,97,109,97,116,111,116,97,107,97,100,97,46,110,
+    97,114,97,46,106,112,0,121,97,109,97,116,115,117,114,105,
+    46,102,117,107,117,115,104,105,109,97,46,106,112,0,121,97,
+    109,97,120,117,110,0,121,97,109,97,122,111,101,46,110,97,
+    114,97,46,106,112,0,121,97,109,101,46,102,117,107,117,111,
+    107,97,46,106,112,0,121,97,110,97,103,97,119,97,46,102,
+    117,107,117,111,107,97,46,106,112,0,121,97,110,97,105,122,
+    117,46,102,117,107,117,115,104,105,109,97,46,106,112,0,121,
+    97,110,100,101,120,0,121,97,111,46,111,115,97,107,97,46,
+    106,112,0,121,97,111,116,115,117,46,103,105,102,117,46,106,
+    112,0,121,97,115,97,107,97,46,110,97,103,97,110,111,46,
+    106,112,0,121,97,115,104,105,111,46,115,97,105,116,97,109,
+    97,46,106,112,0,121,97,115,104,105,114,111,46,104,121,111,
+    103,111,46,106,112,0,121,97,115,117,46,115,104,105,103,97,
+    46,106,112,0,121,97,115,117,100,97,46,107,111,99,104,105,
+    46,106,112,0,121,97,115,117,103,105,46,115,104,105,109,97,
+    110,101,46,106,112,0,121,97,115,117,111,107,97,46,110,97,
+    103,97,110,111,46,106,112,0,121,97,116,111,109,105,46,97,
+    105,99,104,105,46,106,112,0,121,97,116,115,117,107,97,46,
+    115,104,105,109,97,110,101,46,106,112,0,121,97,116,115,117,
+    115,104,105,114,111,46,107,117,109,97,109,111,116,111,46,106,
+    112,0,121,97,119,97,114,97,46,105,98,97,114,97,107,105,
+    46,106,112,0,121,97,119,97,116,97,46,107,121,111,116,111,
+    46,106,112,0,121,97,119,97,116,97,104,97,109,97,46,101,
+    104,105,109,101,46,106,112,0,121,97,122,117,46,116,111,116,
+    116,111,114,105,46,106,112,0,121,98,111,46,102,97,105,116,
+    104,0,121,98,111,46,112,97,114,116,121,0,121,98,111,46,
+    114,101,118,105,101,119,0,121,98,111,46,115,99,105,101,110,
+    99,101,0,121,98,111,46,116,114,97,100,101,0,121,107,46,
+    99,97,0,121,110,46,99,110,0,121,110,104,46,102,114,0,
+    121,111,100,111,98,97,115,104,105,0,121,111,103,97,0,121,
+    111,105,99,104,105,46,104,111,107,107,97,105,100,111,46,106,
+    112,0,121,111,105,116,97,46,110,105,105,103,97,116,97,46,
+    106,112,0,121,111,107,97,46,104,121,111,103,111,46,106,112,
+    0,121,111,107,97,105,99,104,105,98,97,46,99,104,105,98,
+    97,46,106,112,0,121,111,107,97,119,97,46,104,121,111,103,
+    111,46,106,112,0,121,111,107,107,97,105,99,104,105,46,109,
+    105,101,46,106,112,0,121,111,107,111,104,97,109,97,0,121,
+    111,107,111,115,104,105,98,97,104,105,107,97,114,105,46,99,
+    104,105,98,97,46,106,112,0,121,111,107,111,115,117,107,97,
+    46,107,97,110,97,103,97,119,97,46,106,112,0,121,111,107,
+    111,116,101,46,97,107,105,116,97,46,106,112,0,121,111,107,
+    111,122,101,46,115,97,105,116,97,109,97,46,106,112,0,121,
+    111,108,97,115,105,116,101,46,99,111,109,0,121,111,109,98,
+    111,46,109,101,0,121,111,109,105,116,97,110,46,111,107,105,
+    110,97,119,97,46,106,112,0,121,111,110,97,98,97,114,117,
+    46,111,107,105,110,97,119,97,46,106,112,0,121,111,110,97,
+    103,111,46,116,111,116,116,111,114,105,46,106,112,0,121,111,
+    110,97,103,117,110,105,46,111,107,105,110,97,119,97,46,106,
+    112,0,121,111,110,101,122,97,119,97,46,121,97,109,97,103,
+    97,116,97,46,106,112,0,121,111,110,111,46,115,97,105,116,
+    97,109,97,46,106,112,0,121,111,114,105,105,46,115,97,105,
+    116,97,109,97,46,106,112,0,121,111,114,107,46,109,117,115,
+    101,117,109,0,121,111,114,107,115,104,105,114,101,46,109,117,
+    115,101,117,109,0,121,111,114,111,46,103,105,102,117,46,106,
+    112,0,121,111,115,101,109,105,116,101,46,109,117,115,101,117,
+    109,0,121,111,115,104,105,100,97,46,115,97,105,116,97,109,
+    97,46,106,112,0,121,111,115,104,105,100,97,46,115,104,105,
+    122,117,111,107,97,46,106,112,0,121,111,115,104,105,107,97,
+    119,97,46,115,97,105,116,97,109,97,46,106,112,0,121,111,
+    115,104,105,109,105,46,115,97,105,116,97,109,97,46,106,112,
+    0,121,111,115,104,105,110,111,46,110,97,114,97,46,106,112,
+    0,121,111,115,104,105,110,111,103,97,114,105,46,115,97,103,
+    97,46,106,112,0,121,111,115,104,105,111,107,97,46,103,117,
+    110,109,97,46,106,112,0,121,111,116,115,117,107,97,105,100,
+    111,46,99,104,105,98,97,46,106,112,0,121,111,117,0,121,
+    111,117,116,104,46,109,117,115,101,117,109,0,121,111,117,116,
+    117,98,101,0,121,117,97,115,97,46,119,97,107,97,121,97,
+    109,97,46,106,112,0,121,117,102,117,46,111,105,116,97,46,
+    106,112,0,121,117,103,97,119,97,46,102,117,107,117,115,104,
+    105,109,97,46,106,112,0,121,117,103,97,119,97,114,97,46,
+    107,97,110,97,103,97,119,97,46,106,112,0,121,117,107,105,
+    46,105,98,97,114,97,107,105,46,106,112,0,121,117,107,117,
+    104,97,115,104,105,46,102,117,107,117,111,107,97,46,106,112,
+    0,121,117,110,0,121,117,114,97,46,119,97,107,97,121,97,
+    109,97,46,106,112,0,121,117,114,105,104,111,110,106,111,46,
+    97,107,105,116,97,46,106,112,0,121,117,115,117,104,97,114,
+    97,46,107,111,99,104,105,46,106,112,0,121,117,115,117,105,
+    46,107,97,103,111,115,104,105,109,97,46,106,112,0,121,117,
+    117,46,121,97,109,97,103,117,99,104,105,46,106,112,0,121,
+    117,122,97,46,121,97,109,97,103,97,116,97,46,106,112,0,
+    121,117,122,97,119,97,46,110,105,105,103,97,116,97,46,106,
+    112,0,122,46,98,103,0,122,46,115,101,0,122,97,46,98,
+    122,0,122,97,46,99,111,109,0,122,97,46,110,101,116,0,
+    122,97,46,111,114,103,0,122,97,99,104,112,111,109,111,114,
+    46,112,108,0,122,97,103,97,110,46,112,108,0,122,97,107,
+    111,112,97,110,101,46,112,108,0,122,97,109,97,46,107,97,
+    110,97,103,97,119,97,46,106,112,0,122,97,109,97,109,105,
+    46,111,107,105,110,97,119,97,46,106,112,0,122,97,111,46,
+    109,105,121,97,103,105,46,106,112,0,122,97,112,111,114,105,
+    122,104,122,104,101,46,117,97,0,122,97,112,111,114,105,122,
+    104,122,104,105,97,46,117,97,0,122,97,112,112,111,115,0,
+    122,97,112,116,111,46,111,114,103,0,122,97,112,116,111,46,
+    120,121,122,0,122,97,114,97,0,122,97,114,111,119,46,112,
+    108,0,122,101,110,116,115,117,106,105,46,107,97,103,97,119,
+    97,46,106,112,0,122,101,114,111,0,122,103,111,114,97,46,
+    112,108,0,122,103,111,114,122,101,108,101,99,46,112,108,0,
+    122,104,105,116,111,109,105,114,46,117,97,0,122,104,121,116,
+    111,109,121,114,46,117,97,0,122,105,112,0,122,106,46,99,
+    110,0,122,108,103,46,98,114,0,122,111,109,98,105,101,46,
+    106,112,0,122,111,111,108,111,103,105,99,97,108,46,109,117,
+    115,101,117,109,0,122,111,111,108,111,103,121,46,109,117,115,
+    101,117,109,0,122,112,46,103,111,118,46,112,108,0,122,112,
+    46,117,97,0,122,116,46,117,97,0,122,117,101,114,105,99,
+    104,0,122,117,115,104,105,46,107,97,110,97,103,97,119,97,
+    46,106,112,0,195,161,107,197,139,111,108,117,111,107,116,97,
+    46,110,111,0,195,161,108,97,104,101,97,100,106,117,46,110,
+    111,0,195,161,108,116,195,161,46,110,111,0,195,165,102,106,
+    111,114,100,46,110,111,0,195,165,107,114,101,104,97,109,110,
+    46,110,111,0,195,165,108,46,110,111,0,195,165,108,101,115,
+    117,110,100,46,110,111,0,195,165,108,103,195,165,114,100,46,
+    110,111,0,195,165,109,108,105,46,110,111,0,195,165,109,111,
+    116,46,110,111,0,195,165,114,100,97,108,46,110,111,0,195,
+    165,115,46,110,111,0,195,165,115,101,114,97,108,46,110,111,
+    0,195,165,115,110,101,115,46,110,111,0,195,184,107,115,110,
+    101,115,46,110,111,0,195,184,114,108,97,110,100,46,110,111,
+    0,195,184,114,115,107,111,103,46,110,111,0,195,184,114,115,
+    116,97,46,110,111,0,195,184,115,116,114,101,45,116,111,116,
+    101,110,46,110,111,0,195,184,118,114,101,45,101,105,107,101,
+    114,46,110,111,0,195,184,121,101,114,46,110,111,0,195,184,
+    121,103,97,114,100,101,110,46,110,111,0,195,184,121,115,116,
+    114,101,45,115,108,105,100,114,101,46,110,111,0,196,141,195,
+    161,104,99,101,115,117,111,108,111,46,110,111,0,206,181,206,
+    187,0,206,181,207,133,0,208,176,208,186,46,209,129,209,128,
+    208,177,0,208,177,208,179,0,208,177,208,181,208,187,0,208,
+    177,208,184,208,183,46,209,128,209,131,209,129,0,208,180,208,
+    181,209,130,208,184,0,208,181,209,142,0,208,184,208,186,208,
+    190,208,188,46,109,117,115,101,117,109,0,208,186,208,176,209,
+    130,208,190,208,187,208,184,208,186,0,208,186,208,190,208,188,
+    0,208,186,208,190,208,188,46,209,128,209,131,209,129,0,208,
+    186,209,128,209,139,208,188,46,209,128,209,131,209,129,0,208,
+    188,208,184,209,128,46,209,128,209,131,209,129,0,208,188,208,
+    186,208,180,0,208,188,208,190,208,189,0,208,188,208,190,209,
+    129,208,186,208,178,208,176,0,208,188,209,129,208,186,46,209,
+    128,209,131,209,129,0,208,190,208,177,209,128,46,209,129,209,
+    128,208,177,0,208,190,208,180,46,209,129,209,128,208,177,0,
+    208,190,208,189,208,187,208,176,208,185,208,189,0,208,190,209,
+    128,208,179,0,208,190,209,128,208,179,46,209,128,209,131,209,
+    129,0,208,190,209,128,208,179,46,209,129,209,128,208,177,0,
+    208,191,209,128,46,209,129,209,128,208,177,0,209,128,209,132,
+    0,209,129,208,176,208,185,209,130,0,209,129,208,176,208,188,
+    208,176,209,128,208,176,46,209,128,209,131,209,129,0,209,129,
+    208,190,209,135,208,184,46,209,128,209,131,209,129,0,209,129,
+    208,191,208,177,46,209,128,209,131,209,129,0,209,131,208,186,
+    209,128,0,209,131,208,191,209,128,46,209,129,209,128,208,177,
+    0,209,143,46,209,128,209,131,209,129,0,210,155,208,176,208,
+    183,0,213,176,213,161,213,181,0,215,144,215,167,215,147,215,
+    158,215,153,215,148,46,215,153,215,169,215,168,215,144,215,156,
+    0,215,153,215,168,215,149,215,169,215,156,215,153,215,157,46,
+    109,117,115,101,117,109,0,215,153,215,169,215,149,215,145,46,
+    215,153,215,169,215,168,215,144,215,156,0,215,158,215,158,215,
+    169,215,156,46,215,153,215,169,215,168,215,144,215,156,0,215,
+    166,215,148,215,156,46,215,153,215,169,215,168,215,144,215,156,
+    0,215,167,215,149,215,157,0,216,167,216,168,217,136,216,184,
+    216,168,217,138,0,216,167,216,170,216,181,216,167,217,132,216,
+    167,216,170,0,216,167,216,177,216,167,217,133,217,131,217,136,
+    0,216,167,217,132,216,167,216,177,216,175,217,134,0,216,167,
+    217,132,216,168,216,173,216,177,217,138,217,134,0,216,167,217,
+    132,216,172,216,178,216,167,216,166,216,177,0,216,167,217,132,
+    216,179,216,185,217,136,216,175,217,138,216,169,0,216,167,217,
+    132,216,179,216,185,217,136,216,175,217,138,217,135,0,216,167,
+    217,132,216,179,216,185,217,136,216,175,219,140,216,169,0,216,
+    167,217,132,216,179,216,185,217,136,216,175,219,140,219,131,0,
+    216,167,217,132,216,185,217,132,217,138,216,167,217,134,0,216,
+    167,217,132,217,133,216,186,216,177,216,168,0,216,167,217,132,
+    217,138,217,133,217,134,0,216,167,217,133,216,167,216,177,216,
+    167,216,170,0,216,167,217,138,216,177,216,167,217,134,0,216,
+    167,217,138,216,177,216,167,217,134,46,105,114,0,216,167,219,
+    140,216,177,216,167,217,134,0,216,167,219,140,216,177,216,167,
+    217,134,46,105,114,0,216,168,216,167,216,177,216,170,0,216,
+    168,216,167,216,178,216,167,216,177,0,216,168,217,138,216,170,
+    217,131,0,216,168,218,190,216,167,216,177,216,170,0,216,170,
+    217,136,217,134,216,179,0,216,179,217,136,216,175,216,167,217,
+    134,0,216,179,217,136,216,177,217,138,216,167,0,216,179,217,
+    136,216,177,217,138,216,169,0,216,180,216,168,217,131,216,169,
+    0,216,185,216,177,216,167,217,130,0,216,185,216,177,216,168,
+    0,216,185,217,133,216,167,217,134,0,217,129,217,132,216,179,
+    216,183,217,138,217,134,0,217,130,216,183,216,177,0,217,131,
+    216,167,216,171,217,136,217,132,217,138,217,131,0,217,131,217,
+    136,217,133,0,217,133,216,181,216,177,0,217,133,217,132,217,
+    138,216,179,217,138,216,167,0,217,133,217,136,216,177,217,138,
+    216,170,216,167,217,134,217,138,216,167,0,217,133,217,136,217,
+    130,216,185,0,217,135,217,133,216,177,216,167,217,135,0,217,
+    190,216,167,217,131,216,179,216,170,216,167,217,134,0,217,190,
+    216,167,218,169,216,179,216,170,216,167,217,134,0,218,128,216,
+    167,216,177,216,170,0,224,164,149,224,165,137,224,164,174,0,
+    224,164,168,224,165,135,224,164,159,0,224,164,173,224,164,190,
+    224,164,176,224,164,164,0,224,164,173,224,164,190,224,164,176,
+    224,164,164,224,164,174,224,165,141,0,224,164,173,224,164,190,
+    224,164,176,224,165,139,224,164,164,0,224,164,184,224,164,130,
+    224,164,151,224,164,160,224,164,168,0,224,166,172,224,166,190,
+    224,166,130,224,166,178,224,166,190,0,224,166,173,224,166,190,
+    224,166,176,224,166,164,0,224,166,173,224,166,190,224,167,176,
+    224,166,164,0,224,168,173,224,168,190,224,168,176,224,168,164,
+    0,224,170,173,224,170,190,224,170,176,224,170,164,0,224,172,
+    173,224,172,190,224,172,176,224,172,164,0,224,174,135,224,174,
+    168,224,175,141,224,174,164,224,174,191,224,174,175,224,174,190,
+    0,224,174,135,224,174,178,224,174,153,224,175,141,224,174,149,
+    224,175,136,0,224,174,154,224,174,191,224,174,153,224,175,141,
+    224,174,149,224,174,170,224,175,141,224,174,170,224,175,130,224,
+    174,176,224,175,141,0,224,176,173,224,176,190,224,176,176,224,
+    176,164,224,177,141,0,224,178,173,224,178,190,224,178,176,224,
+    178,164,0,224,180,173,224,180,190,224,180,176,224,180,164,224,
+    180,130,0,224,182,189,224,182,130,224,182,154,224,183,143,0,
+    224,184,132,224,184,173,224,184,161,0,224,184,151,224,184,171,
+    224,184,178,224,184,163,46,224,185,132,224,184,151,224,184,162,
+    0,224,184,152,224,184,184,224,184,163,224,184,129,224,184,180,
+    224,184,136,46,224,185,132,224,184,151,224,184,162,0,224,184,
+    163,224,184,177,224,184,144,224,184,154,224,184,178,224,184,165,
+    46,224,185,132,224,184,151,224,184,162,0,224,184,168,224,184,
+    182,224,184,129,224,184,169,224,184,178,46,224,185,132,224,184,
+    151,224,184,162,0,224,184,173,224,184,135,224,184,132,224,185,
+    140,224,184,129,224,184,163,46,224,185,132,224,184,151,224,184,
+    162,0,224,185,128,224,184,153,224,185,135,224,184,149,46,224,
+    185,132,224,184,151,224,184,162,0,224,186,165,224,186,178,224,
+    186,167,0,225,131,146,225,131,148,0,227,129,191,227,130,147,
+    227,129,170,0,227,130,162,227,131,158,227,130,190,227,131,179,
+    0,227,130,175,227,131,169,227,130,166,227,131,137,0,227,130,
+    176,227,131,188,227,130,176,227,131,171,0,227,130,179,227,131,
+    160,0,227,130,185,227,131,136,227,130,162,0,227,130,187,227,
+    131,188,227,131,171,0,227,131,149,227,130,161,227,131,131,227,
+    130,183,227,131,167,227,131,179,0,227,131,157,227,130,164,227,
+    131,179,227,131,136,0,228,184,137,233,135,141,46,106,112,0,
+    228,184,150,231,149,140,0,228,184,170,228,186,186,46,104,107,
+    0,228,184,173,228,191,161,0,228,184,173,229,155,189,0,228,
+    184,173,229,156,139,0,228,184,173,230,150,135,231,189,145,0,
+    228,186,154,233,169,172,233,128,138,0,228,186,172,233,131,189,
+    46,106,112,0,228,188,129,228,184,154,0,228,189,144,232,179,
+    128,46,106,112,0,228,189,155,229,177,177,0,228,191,161,230,
+    129,175,0,229,128,139,228,186,186,46,104,107,0,229,128,139,
+    228,186,186,46,233,166,153,230,184,175,0,229,129,165,229,186,
+    183,0,229,133,171,229,141,166,0,229,133,172,229,143,184,0,
+    229,133,172,229,143,184,46,99,110,0,229,133,172,229,143,184,
+    46,104,107,0,229,133,172,229,143,184,46,233,166,153,230,184,
+    175,0,229,133,172,231,155,138,0,229,133,181,229,186,171,46,
+    106,112,0,229,140,151,230,181,183,233,129,147,46,106,112,0,
+    229,141,131,232,145,137,46,106,112,0,229,143,176,230,185,190,
+    0,229,143,176,231,129,163,0,229,146,140,230,173,140,229,177,
+    177,46,106,112,0,229,149,134,229,159,142,0,229,149,134,229,
+    186,151,0,229,149,134,230,160,135,0,229,149,134,230,165,173,
+    46,116,119,0,229,152,137,233,135,140,0,229,152,137,233,135,
+    140,229,164,167,233,133,146,229,186,151,0,229,156,168,231,186,
+    191,0,229,159,188,231,142,137,46,106,112,0,229,164,167,229,
+    136,134,46,106,112,0,229,164,167,230,139,191,0,229,164,167,
+    233,152,170,46,106,112,0,229,164,169,228,184,187,230,149,153,
+    0,229,165,136,232,137,175,46,106,112,0,229,168,177,228,185,
+    144,0,229,174,174,229,159,142,46,106,112,0,229,174,174,229,
+    180,142,46,106,112,0,229,174,182,233,155,187,0,229,175,140,
+    229,177,177,46,106,112,0,229,177,177,229,143,163,46,106,112,
+    0,229,177,177,229,189,162,46,106,112,0,229,177,177,230,162,
+    168,46,106,112,0,229,178,144,233,152,156,46,106,112,0,229,
+    178,161,229,177,177,46,106,112,0,229,178,169,230,137,139,46,
+    106,112,0,229,179,182,230,160,185,46,106,112,0,229,185,191,
+    228,184,156,0,229,186,131,229,179,182,46,106,112,0,229,190,
+    174,229,141,154,0,229,190,179,229,179,182,46,106,112,0,230,
+    132,155,229,170,155,46,106,112,0,230,132,155,231,159,165,46,
+    106,112,0,230,133,136,229,150,132,0,230,136,145,231,136,177,
+    228,189,160,0,230,137,139,230,156,186,0,230,139,155,232,129,
+    152,0,230,148,191,229,138,161,0,230,148,191,229,186,156,0,
+    230,148,191,229,186,156,46,104,107,0,230,148,191,229,186,156,
+    46,233,166,153,230,184,175,0,230,149,142,232,130,178,46,104,
+    107,0,230,149,153,232,130,178,46,104,107,0,230,149,153,232,
+    130,178,46,233,166,153,230,184,175,0,230,150,176,229,138,160,
+    229,157,161,0,230,150,176,230,189,159,46,106,112,0,230,150,
+    176,233,151,187,0,230,151,182,229,176,154,0,230,155,184,231,
+    177,141,0,230,156,186,230,158,132,0,230,157,177,228,186,172,
+    46,106,112,0,230,160,131,230,156,168,46,106,112,0,230,178,
+    150,231,184,132,46,106,112,0,230,183,161,233,169,172,233,148,
+    161,0,230,184,184,230,136,143,0,230,187,139,232,179,128,46,
+    106,112,0,230,190,179,233,150,128,0,230,190,179,233,151,168,
+    0,231,130,185,231,156,139,0,231,134,138,230,156,172,46,106,
+    112,0,231,159,179,229,183,157,46,106,112,0,231,165,158,229,
+    165,136,229,183,157,46,106,112,0,231,166,143,228,186,149,46,
+    106,112,0,231,166,143,229,178,161,46,106,112,0,231,166,143,
+    229,179,182,46,106,112,0,231,167,139,231,148,176,46,106,112,
+    0,231,167,187,229,138,168,0,231,174,135,228,186,186,46,104,
+    107,0,231,181,132,231,185,148,46,104,107,0,231,181,132,231,
+    185,148,46,116,119,0,231,181,132,231,185,148,46,233,166,153,
+    230,184,175,0,231,181,132,231,187,135,46,104,107,0,231,182,
+    178,231,181,161,46,99,110,0,231,182,178,231,181,161,46,104,
+    107,0,231,182,178,231,181,161,46,233,166,153,230,184,175,0,
+    231,182,178,231,187,156,46,104,107,0,231,182,178,232,183,175,
+    46,116,119,0,231,187,132,231,185,148,46,104,107,0,231,187,
+    132,231,187,135,46,104,107,0,231,187,132,231,187,135,230,156,
+    186,230,158,132,0,231,189,145,229,157,128,0,231,189,145,229,
+    186,151,0,231,189,145,231,171,153,0,231,189,145,231,181,161,
+    46,104,107,0,231,189,145,231,187,156,0,231,189,145,231,187,
+    156,46,99,110,0,231,189,145,231,187,156,46,104,107,0,231,
+    190,164,233,166,172,46,106,112,0,232,129,148,233,128,154,0,
+    232,135,186,231,129,163,0,232,140,168,229,159,142,46,106,112,
+    0,232,176,183,230,173,140,0,232,180,173,231,137,169,0,233,
+    128,154,232,178,169,0,233,149,183,229,180,142,46,106,112,0,
+    233,149,183,233,135,142,46,106,112,0,233,155,134,229,155,162,
+    0,233,155,187,232,168,138,231,155,136,231,167,145,0,233,157,
+    146,230,163,174,46,106,112,0,233,157,153,229,178,161,46,106,
+    112,0,233,163,158,229,136,169,230,181,166,0,233,163,159,229,
+    147,129,0,233,164,144,229,142,133,0,233,166,153,229,183,157,
+    46,106,112,0,233,166,153,230,160,188,233,135,140,230,139,137,
+    0,233,171,152,231,159,165,46,106,112,0,233,179,165,229,143,
+    150,46,106,112,0,233,185,191,229,133,144,229,179,182,46,106,
+    112,0,235,139,183,235,132,183,0,235,139,183,236,187,180,0,
+    236,130,188,236,132,177,0,237,149,156,234,181,173,0,
+};
+
+static const unsigned int urlPslSlots[32768] = {
+    0,0,0,0,0,474611987,319578211,0,
+    0,72015971,333492883,32366803,35692691,277602483,348504355,0,
+    0,368250947,0,0,14786915,0,330150515,0,
+    217190547,0,0,0,0,0,0,3690643,
+    0,0,0,0,0,0,4309027,0,
+    0,273805395,0,0,264818947,0,0,0,
+    266830083,0,75522163,0,0,0,0,0,
+    0,0,7709011,0,0,125538403,0,0,
+    64938275,159682675,91164915,268087379,8208611,0,0,0,
+    0,0,0,10416355,194572467,0,278519955,133562467,
+    0,319549539,0,18997587,173179123,2134051,0,0,
+    0,0,75788419,0,249200771,0,0,0,
+    0,136872035,0,0,0,0,0,0,
+    0,210837699,326037619,0,0,0,235655379,302608579,
+    0,0,0,439709971,0,0,0,0,
+    0,0,0,0,0,0,270168163,0,
+    0,0,0,0,0,2146371,381718867,0,
+    0,0,0,0,0,0,0,114999523,
+    0,0,0,0,0,0,0,156274899,
+    0,486625379,65863937,0,0,0,262914387,0,
+    0,0,0,0,84390229,272203875,412471491,307888339,
+    351567971,0,0,0,0,0,0,0,
+    0,0,0,36139075,0,0,0,0,
+    0,0,0,0,0,0,0,406581299,
+    0,65163459,0,0,160276547,0,0,314982659,
+    0,0,0,0,0,301613283,308044019,0,
+    0,0,368177299,0,0,96665699,0,415957219,
+    0,0,0,214896819,0,464707731,381313379,0,
+    0,0,0,0,0,106512483,0,0,
+    0,0,0,24596611,0,220848275,0,0,
+    0,0,0,0,85815539,136441955,0,0,
+    418095585,39665907,443805923,0,0,0,409858339,0,
+    475799651,0,326561939,0,164839619,98812083,192242003,0,
+    0,138825811,0,0,129925283,358072563,0,0,
+    0,125567011,55521379,70352995,0,0,0,0,
+    216363251,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    138076275,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,354521411,0,0,187998355,0,0,
+    0,0,0,0,0,71127139,0,23126131,
+    0,340644083,0,292016531,0,0,0,403513603,
+    67141715,0,0,0,0,0,0,0,
+    0,0,27472019,53862531,0,0,0,310992995,
+    189112579,0,0,0,22773891,22810867,0,293150947,
+    0,0,0,0,0,0,318103651,0,
+    0,0,0,0,0,292327475,0,0,
+    39047395,280129635,0,50807075,191078643,0,457851139,0,
+    0,0,0,0,0,0,0,313114707,
+    314667107,0,0,0,0,0,0,0,
+    0,0,401654051,0,102056211,0,0,128053427,
+    470827315,0,450027811,0,352555299,164987027,0,237551763,
+    269377635,0,0,159453315,326410403,307171427,420720803,0,
+    0,0,0,0,426021027,0,0,0,
+    0,0,159412371,0,0,299614401,0,0,
+    0,0,0,0,0,0,0,227758227,
+    143524147,358818115,0,0,0,0,325206163,0,
+    0,0,0,0,234549331,17965251,423289075,437412051,
+    439541987,0,0,0,0,472170627,0,0,
+    0,0,33726563,0,0,0,0,0,
+    0,0,0,103235779,249593955,0,0,94896227,
+    41390115,0,227524787,0,0,0,0,482766995,
+    0,0,135196771,217231539,0,350769411,227680403,320327875,
+    28532819,239550563,0,0,0,0,310186229,346943555,
+    0,345571555,0,243036531,0,0,0,0,
+    0,0,270037155,0,0,0,0,0,
+    37109859,0,0,0,462270899,0,0,0,
+    259575875,0,192676115,0,0,0,0,245334259,
+    0,300630211,97792099,360714467,0,109170787,0,203112659,
+    0,0,0,0,0,252289075,387154003,312455411,
+    0,0,0,469524723,269062243,121434419,0,0,
+    0,0,348954707,297017443,472207651,0,0,0,
+    0,0,104841299,235774131,0,0,353067299,0,
+    416264561,0,0,364978403,0,0,0,0,
+    28651651,24068131,0,0,48615507,0,75358323,140918851,
+    488509635,0,0,58773811,0,0,128544963,0,
+    337912035,435302579,0,170393811,0,0,55447683,0,
+    0,0,0,0,106483811,265388275,0,400929059,
+    0,78332243,0,38543539,43208771,0,0,469967107,
+    0,0,476323987,486596707,0,37011491,0,0,
+    0,0,0,186482867,0,0,0,72188003,
+    0,239923299,0,0,168607859,0,0,178397315,
+    21819651,239636579,0,0,0,0,234066179,0,
+    0,0,0,256286915,327164035,0,0,0,
+    474243363,0,0,280633571,140820771,154869987,0,120234163,
+    0,0,0,0,364060771,451023107,0,0,
+    303177971,182779971,0,31432835,67465299,0,35143891,0,
+    0,363335875,0,0,0,0,0,0,
+    0,0,3952723,0,0,0,299667539,429949651,
+    26435717,297877603,387035219,0,0,0,0,0,
+    0,87212211,0,0,0,0,0,0,
+    386834515,0,0,0,0,0,269090915,389132643,
+    0,0,0,0,314781795,91701491,0,0,
+    0,187670675,346280163,0,0,0,0,27345171,
+    0,403411139,214470835,0,0,235221091,0,0,
+    0,0,0,0,0,338043107,0,0,
+    0,0,0,0,0,0,0,151535891,
+    169816227,0,368693603,0,0,0,0,0,
+    0,0,0,0,398868627,239808611,69521507,0,
+    459063491,0,0,0,0,137588899,298651747,0,
+    0,0,0,0,0,0,34050163,0,
+    0,0,0,0,0,0,0,0,
+    67682435,0,184402227,0,0,187424915,217636979,298078307,
+    172630419,314925155,0,0,0,212398387,0,0,
+    0,0,0,0,231739683,0,0,0,
+    0,0,0,179118307,0,156332243,0,271773795,
+    0,0,0,334545265,256504083,0,0,0,
+    0,46964899,374788307,0,0,0,0,197554467,
+    218103891,8134931,182321265,0,0,0,0,0,
+    383512835,0,112390195,0,0,0,0,165498963,
+    0,0,0,0,0,0,59162979,235901203,
+    0,0,0,71200803,0,0,0,0,
+    0,3854419,183935091,293044419,0,0,0,0,
+    0,0,0,0,169230707,349655395,14303427,0,
+    0,0,0,0,0,228098131,0,0,
+    0,0,0,117874867,0,0,0,0,
+    456589603,0,315293811,0,0,96116835,0,0,
+    0,121122947,234930259,284401731,0,461336755,0,70439011,
+    0,0,0,0,0,0,0,0,
+    478724195,300474547,0,0,0,0,482927043,0,
+    310317299,0,0,0,0,0,347373843,0,
+    54366339,0,0,379937027,0,0,0,0,
+    0,0,0,0,0,0,293490803,0,
+    0,174534899,275366067,0,0,477548675,0,0,
+    0,0,0,0,0,0,0,79556691,
+    0,0,186609731,0,0,0,0,0,
+    0,0,0,0,0,13836515,401256771,0,
+    0,3928147,383881267,0,0,62963795,231248019,251437187,
+    207524067,469311811,0,0,0,0,13529251,0,
+    0,203383107,0,0,0,0,0,35061859,
+    169918563,82677859,443269331,0,474472707,0,0,0,
+    0,0,0,186876051,362393763,452804787,0,0,
+    0,0,18927875,0,0,0,0,0,
+    50483251,0,0,0,0,374948003,91287795,464445667,
+    0,0,0,0,0,0,70152291,267849859,
+    0,155787379,0,0,79626371,459477171,88461475,135110755,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,313090131,0,7901347,
+    132149379,417165939,0,0,0,0,0,258617587,
+    449786147,133722147,0,0,0,0,397812051,405196979,
+    223338723,182259891,421249299,0,111345701,0,0,0,
+    0,0,385548515,0,293818595,385745027,0,0,
+    0,5497123,0,0,0,0,0,0,
+    0,180457811,0,0,257519939,0,0,0,
+    279654547,0,461549763,0,0,0,0,0,
+    0,0,0,420479235,0,0,0,484225171,
+    0,488272019,62328949,0,0,459116723,0,0,
+    0,0,0,131104851,100577379,0,182616275,0,
+    0,0,0,0,0,0,63041667,85201155,
+    138575971,272576611,302936307,0,0,0,0,0,
+    0,19370147,267935811,78200995,0,407765123,445010275,0,
+    441421987,0,0,0,0,0,0,0,
+    0,73253123,0,272834659,0,0,0,151670995,
+    0,0,0,0,0,0,0,0,
+    130109539,65548579,213565715,321626211,0,180318467,0,0,
+    0,313405539,0,0,0,0,0,0,
+    0,92323987,0,437907683,0,0,273641539,25481539,
+    0,263274787,0,0,387113107,0,0,0,
+    0,107569443,0,0,0,471072867,331072035,2248819,
+    0,252731491,0,190595219,22454403,469491827,0,0,
+    0,0,0,160104643,0,0,154378371,467771667,
+    0,0,0,0,0,0,0,0,
+    0,0,0,404082787,0,139784259,377503843,0,
+    0,218009699,0,0,0,0,0,0,
+    0,15343827,0,0,0,175427715,54513747,75903555,
+    79163475,371421267,0,0,0,0,62230825,0,
+    0,0,0,0,0,442749267,0,0,
+    0,0,0,0,0,0,216268867,105726163,
+    0,0,0,483746083,0,0,298680419,0,
+    0,0,0,0,0,0,0,0,
+    0,0,137474339,0,0,0,0,0,
+    281129219,0,0,107950323,126554259,188809331,0,423932019,
+    0,0,33341523,0,119595187,0,0,61251795,
+    217804915,168640627,262185235,49401923,0,236531969,136585315,316059795,
+    120971491,128864467,451682547,0,0,0,385421347,0,
+    118415539,0,0,0,0,92405891,0,39170275,
+    312864947,0,0,0,0,47681795,0,0,
+    0,0,0,0,0,0,173842659,269291619,
+    0,0,0,0,0,0,0,0,
+    0,0,0,436162755,0,0,412725507,323449011,
+    0,0,0,0,0,0,0,0,
+    0,62550281,0,0,0,0,188547219,0,
+    0,0,300101875,0,447918243,0,0,0,
+    0,0,85557347,0,0,0,53014659,0,
+    0,335098435,0,0,0,0,0,0,
+    0,268763267,38629411,0,311627875,138764371,452591907,0,
+    0,174883139,318349443,393564259,0,0,0,0,
+    0,0,0,217669811,0,0,0,0,
+    10617027,0,0,169644131,0,0,0,0,
+    0,83771555,367824979,0,437518547,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,27533379,317567091,0,0,0,0,0,
+    0,0,0,0,0,0,194834595,0,
+    0,0,0,255668563,0,0,404410531,0,
+    0,151331091,0,144490659,487248019,0,234573955,0,
+    0,271487075,0,0,0,0,0,55373955,
+    0,13164915,443736323,0,181547267,0,0,0,
+    0,0,0,286470403,0,0,0,0,
+    0,75489395,0,0,468209955,0,0,318042257,
+    466932003,0,0,237826291,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    32731235,83247329,0,35090531,299171955,0,0,0,
+    0,0,0,157634899,68718691,0,0,0,
+    0,0,0,1532003,306974867,0,0,0,
+    0,106651843,0,0,0,0,31617155,17002595,
+    0,0,178434259,263811187,0,0,0,0,
+    0,152625411,0,0,0,0,0,0,
+    0,5058659,4112419,0,0,0,0,0,
+    0,0,0,0,0,270311523,0,36909155,
+    20045923,0,0,74424435,0,366158083,0,142643331,
+    128712995,343015603,0,0,0,0,0,0,
+    479363267,0,0,0,0,0,0,0,
+    0,37183523,0,0,226267347,0,0,0,
+    0,0,0,0,344936595,0,0,339013811,
+    0,0,262111507,216215747,0,0,0,148820387,
+    0,0,0,172269763,0,0,0,0,
+    0,0,0,126836883,0,0,0,0,
+    0,0,0,0,0,0,286978291,363069523,
+    94953571,228630595,0,0,18612483,0,0,0,
+    0,482296339,0,158617715,373313635,138887299,272662627,6402147,
+    308306179,0,0,0,0,0,308805779,314462419,
+    0,0,0,0,0,0,356663587,0,
+    0,0,0,0,0,0,0,221790355,
+    321511507,0,0,318845075,0,0,0,0,
+    0,0,179359987,0,0,200548547,54612099,0,
+    0,4210723,0,0,0,84897939,0,0,
+    403312707,0,0,0,0,0,0,92635219,
+    0,0,0,0,0,0,0,0,
+    437703043,0,106758195,0,0,0,0,369864995,
+    0,0,0,0,0,0,0,10936403,
+    274296931,0,0,436310435,0,0,68182051,0,
+    0,125481171,187957395,468287811,0,0,0,226545811,
+    134938723,406921539,187273315,0,0,0,105382035,317620323,
+    0,294052035,0,0,0,0,183652515,0,
+    0,0,0,0,314753123,0,0,0,
+    0,0,0,0,0,2502691,64000419,0,
+    32686179,364707955,11886691,0,169033843,48005251,288964851,272949347,
+    0,0,0,0,0,49291411,485433491,0,
+    0,0,419901539,0,219095203,0,0,0,
+    0,309104755,0,0,42959075,0,0,138666019,
+    188203155,190636211,321654883,0,413962451,416690803,0,0,
+    0,0,294947,0,222359619,0,247926979,14450819,
+    0,0,0,0,0,0,0,95096931,
+    412524803,0,0,0,0,0,83476611,276214083,
+    107122947,0,0,0,0,439292163,0,0,
+    0,0,262652179,0,0,0,0,0,
+    279621747,0,0,0,0,303018067,309440627,0,
+    0,0,0,0,388153555,0,0,0,
+    31150147,0,0,0,0,0,370544771,0,
+    0,116531411,255426771,279871587,66105491,0,451748115,0,
+    0,0,0,296816739,403779827,168575091,0,369049813,
+    0,0,481493139,0,0,0,0,0,
+    40226915,0,0,0,272375907,366415923,0,221421715,
+    0,78901667,436854995,0,0,0,0,78368961,
+    0,0,235475075,0,0,81318179,0,71729251,
+    364298371,99430563,64876771,0,0,0,0,0,
+    0,0,0,0,110346483,0,246104323,443957411,
+    0,0,287498483,0,0,0,0,158904419,
+    80003251,0,0,0,0,425873571,0,0,
+    0,0,0,0,0,257003779,283546003,473141571,
+    478052563,0,0,0,0,65360051,0,442912979,
+    0,0,115278003,259440819,445513939,0,0,5591123,
+    0,186630291,0,0,3604515,102703267,460022003,0,
+    0,0,0,0,0,0,0,0,
+    0,473784515,69349475,139464835,203608339,0,0,0,
+    0,103784547,0,0,96174179,0,185655427,0,
+    269549667,0,0,0,0,0,120795235,0,
+    0,0,202453203,0,0,0,281886963,0,
+    36557011,67997779,49225971,0,181792835,106541267,216641763,0,
+    0,33755267,0,0,53678211,0,0,0,
+    411205875,0,0,0,218513651,0,0,0,
+    0,0,0,138752131,70869091,144220403,425058387,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,395972899,0,0,
+    0,0,0,0,0,0,0,209424691,
+    125399187,0,0,0,0,0,0,0,
+    0,18591811,0,376148035,0,0,0,0,
+    0,0,0,405495971,4272211,0,0,90513603,
+    0,364151075,0,0,76873939,224989347,96346211,31539267,
+    449499299,0,0,0,57737427,0,0,0,
+    243605747,0,37789779,0,0,0,139694163,0,
+    0,38060147,0,303313187,451240195,0,0,0,
+    0,226852947,0,0,74821939,0,0,468636003,
+    0,0,0,0,83931203,90673411,0,0,
+    0,123056387,0,0,457969875,0,0,386355283,
+    247701811,0,272863331,0,0,343150867,0,0,
+    99143843,0,0,0,311062675,0,357728563,31391891,
+    404705539,0,0,425549923,260415731,0,0,0,
+    83226931,0,0,0,0,0,0,0,
+    0,100606115,0,0,0,0,0,0,
+    0,0,0,107028595,0,0,0,0,
+    0,0,0,0,0,93376803,306659411,0,
+    161341715,0,0,0,0,0,0,74772659,
+    0,462606739,0,0,0,0,0,346853603,
+    0,0,0,0,143065475,0,0,0,
+    0,0,178597971,0,0,0,224338035,0,
+    0,0,0,82223251,96981091,378126595,0,317964467,
+    222208147,0,0,138633331,0,0,0,0,
+    396570979,215646483,251355443,0,0,0,438419779,88043683,
+    259645523,0,0,410968275,0,0,0,91099379,
+    0,79335507,0,0,317477027,0,0,0,
+    0,0,0,358600963,0,0,0,0,
+    0,0,118022323,0,0,0,147464403,0,
+    0,0,2064451,0,0,198303955,0,0,
+    0,0,0,463384851,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,107835523,0,0,242766163,320553059,0,368337075,
+    263962659,0,0,0,0,426295523,0,0,
+    351596611,0,0,0,0,404496563,0,0,
+    0,0,0,0,0,0,0,0,
+    82059603,113983635,281931843,487964771,0,0,0,0,
+    0,0,0,0,148640035,0,410067089,0,
+    126951651,0,0,0,22905123,24182899,161988723,40751139,
+    0,0,0,169701475,54845523,0,0,0,
+    271515747,287043843,291549411,62128243,313831619,7237891,0,1314963,
+    227336323,0,0,0,0,0,0,272490595,
+    0,0,0,293404931,0,228712595,386457699,0,
+    0,0,0,475549763,487841939,0,0,409239779,
+    0,214622515,0,0,0,0,0,186589251,
+    0,0,97239139,126595235,133791843,405717091,456945987,0,
+    0,0,0,0,0,0,0,286699779,
+    0,0,0,0,0,0,0,95182947,
+    292831427,414183555,0,0,0,0,0,0,
+    0,0,0,0,3731539,0,0,0,
+    0,0,0,0,0,0,0,0,
+    487936099,363532355,374374611,0,0,0,220684435,317825251,
+    42029091,0,260256035,144425203,0,0,422879299,0,
+    375693539,0,0,0,297160803,0,0,0,
+    471752835,0,0,0,0,166240627,19972147,0,
+    0,32043139,0,0,480841859,0,0,0,
+    390406323,0,0,0,0,62988371,377430291,0,
+    0,0,81526931,0,0,0,0,0,
+    0,0,0,0,0,140988691,0,0,
+    25768131,181973251,272175203,158650451,0,197042467,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,81985619,
+    134795363,0,0,0,0,0,88723539,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,204836979,0,0,0,593955,0,0,
+    0,0,0,0,113512691,269520995,0,0,
+    0,0,275165251,0,0,157540499,0,0,
+    428622563,345354355,0,255807699,0,0,297504867,198861139,
+    447795379,0,0,294674723,456171875,0,0,0,
+    0,0,0,362168499,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,460153075,358220051,72876131,177746243,155070563,68096083,
+    0,0,0,0,0,0,0,0,
+    0,0,187506835,409137235,0,0,95916131,0,
+    0,0,0,389759203,0,0,298594403,0,
+    447136099,0,0,348074115,0,0,0,0,
+    214945971,0,0,0,0,2084931,109936739,106438819,
+    0,469061923,0,0,0,0,0,0,
+    0,0,111436019,0,2404403,0,258883827,455196819,
+    0,0,316309779,0,0,0,387268787,66076771,
+    0,0,129736867,424993011,0,0,0,81117411,
+    218579107,0,0,0,0,0,0,0,
+    134135907,0,0,101134499,0,0,0,72302691,
+    0,0,0,39469299,0,0,254210195,0,
+    80494675,423665923,0,313962643,0,0,0,0,
+    186794131,464077107,0,0,0,0,219426963,0,
+    92287107,11001939,3678243,47128627,0,0,0,54661203,
+    488837267,0,0,70381667,0,0,0,0,
+    0,0,0,0,0,177246371,248647795,361533523,
+    438841507,0,0,0,0,0,194416803,0,
+    27709587,111267987,34996371,0,377059,0,0,0,
+    0,0,0,0,344580387,0,0,0,
+    0,0,140898371,0,0,0,0,371900611,
+    0,330478195,0,0,0,0,0,458596595,
+    0,0,0,0,0,0,40419507,125907011,
+    382304467,0,0,0,0,243429763,379560227,0,
+    0,312914083,0,0,363028579,0,0,0,
+    0,0,0,0,0,86860051,140279891,7262371,
+    0,0,0,235565187,0,0,401006851,216998115,
+    0,108482723,307740709,40812723,419946707,0,0,0,
+    272060515,0,0,0,242323763,0,0,0,
+    434815027,0,0,0,0,0,0,40714419,
+    0,286249059,0,0,0,0,0,0,
+    0,0,21258483,193524051,315715747,141181059,0,121364739,
+    88871091,0,0,0,0,0,205529395,0,
+    0,0,0,0,0,0,70754403,0,
+    301408499,0,0,191144147,0,0,0,189665571,
+    239579235,0,0,0,0,0,299081827,0,
+    0,17477827,0,323698835,420196579,0,0,0,
+    0,0,0,0,0,0,278004163,0,
+    416088561,0,0,0,133763171,0,194314483,138813571,
+    315080915,0,433041555,0,0,17752291,308375667,0,
+    291610773,0,236802195,0,0,0,0,0,
+    0,0,0,0,0,61812835,0,0,
+    0,0,0,145068307,84480099,86020179,337342739,0,
+    0,141287731,0,0,81674435,0,188477587,0,
+    0,0,0,0,311046195,0,0,0,
+    0,0,0,263434403,0,0,0,0,
+    0,0,0,0,46272835,36434099,123961827,372027667,
+    0,229908707,0,405971075,72245347,0,0,299475075,
+    38338755,0,0,218321091,0,0,0,0,
+    0,0,184811619,0,0,0,0,0,
+    0,450576675,322289795,0,0,0,0,0,
+    7331923,0,0,57524403,0,0,0,0,
+    0,0,0,403333411,230334611,0,0,0,
+    0,471015571,0,0,0,97411171,309776579,0,
+    0,167264483,245960947,313794691,405381331,0,0,0,
+    0,0,0,0,0,0,0,316510403,
+    0,0,0,0,0,0,0,0,
+    0,0,269000931,0,0,283013203,0,0,
+    0,0,0,0,417329747,0,0,0,
+    0,66400339,0,0,0,0,0,2748643,
+    0,37699779,236515651,0,0,77000851,193700035,48697427,
+    0,373072051,0,0,37511427,0,0,0,
+    0,235020387,0,0,425201779,171856131,0,0,
+    480198819,387686643,0,0,280748227,129454163,0,0,
+    0,0,318886115,0,0,0,0,0,
+    105574597,308711523,388018483,0,0,0,0,0,
+    0,0,0,240181347,0,115060899,27201795,347197747,
+    0,0,0,0,0,0,0,0,
+    0,304857379,343801939,0,0,269865059,0,0,
+    0,97267811,446341507,0,474071363,0,0,0,
+    380764403,473624771,0,0,351219987,160215107,0,0,
+    0,0,0,0,0,0,428815059,475660467,
+    0,26202259,0,0,0,0,0,0,
+    0,244125891,121680211,0,74510531,66146387,0,466354387,
+    0,0,0,289976419,0,0,0,171700515,
+    0,0,0,0,0,0,48369731,455401651,
+    0,191529251,0,0,0,0,0,0,
+    100270179,0,176296179,3977299,111980675,298508387,0,0,
+    330641955,447570211,0,0,334004833,0,102208003,0,
+    0,449700163,0,418673121,173904131,266641779,0,0,
+    0,0,0,38191283,262353171,0,38887603,0,
+    0,0,0,0,0,0,0,0,
+    418656803,0,0,0,0,409690371,0,125108483,
+    67043411,0,2175217,0,0,0,0,424013939,
+    240353379,0,0,0,0,36708451,0,0,
+    0,229970083,255537331,208502883,0,0,0,0,
+    0,0,0,0,0,405540995,196341971,60960915,
+    233898275,0,0,142913667,0,0,0,0,
+    0,0,0,239779939,127434979,363737235,0,0,
+    55685393,0,37224547,0,159715427,190128387,436367555,0,
+    0,0,0,485171347,0,473227555,0,0,
+    0,0,0,0,138002515,0,0,0,
+    174383379,0,0,457683235,0,0,410296819,32833713,
+    0,0,0,0,0,0,0,208376051,
+    0,117207315,0,0,0,0,0,0,
+    60403939,0,437293331,0,0,418382321,3567699,0,
+    0,0,0,309997843,0,0,78618947,0,
+    0,0,0,0,0,0,392491283,111210611,
+    0,0,75305027,0,72360035,0,0,35778851,
+    339611843,357892435,481968323,486416531,0,0,0,0,
+    0,0,0,0,283840611,0,334643779,120037555,
+    336519251,0,0,0,0,53641347,246280483,0,
+    0,72933475,0,0,0,444858547,342380595,483528899,
+    172491027,380678467,0,0,0,0,0,0,
+    192008515,0,79843491,0,0,0,0,0,
+    0,0,0,61493363,0,464011507,68145235,0,
+    0,33300627,0,125632563,413221091,0,0,0,
+    0,0,0,0,0,0,704547,0,
+    0,444178675,0,0,391819347,0,0,0,
+    452403427,363057187,0,135368803,0,0,0,0,
+    0,0,0,328233459,0,0,0,0,
+    0,200802547,0,0,235192419,0,0,0,
+    0,62308553,0,0,0,233726275,125796483,0,
+    158175379,0,0,0,351899795,0,0,0,
+    0,0,0,0,232751395,0,0,0,
+    0,0,0,148554051,0,0,0,0,
+    0,0,0,0,89899187,0,0,0,
+    0,117035379,475607235,0,0,0,0,0,
+    0,402153635,97554531,0,0,0,0,207798483,
+    0,0,0,0,280014947,0,0,0,
+    0,293679379,0,0,55091331,0,154845267,0,
+    9322771,390181123,411897923,455737571,297906275,0,0,0,
+    17420387,74629283,301674771,0,0,0,0,338796883,
+    0,0,0,0,0,112672915,0,0,
+    0,94552275,0,0,218624147,0,0,0,
+    39108835,0,0,0,0,0,0,0,
+    0,0,0,0,95010915,0,0,29069619,
+    0,0,0,0,0,0,146436227,0,
+    480878787,170176611,0,0,285561093,0,0,303837251,
+    0,0,0,0,0,0,366960851,0,
+    0,0,0,0,0,357568771,0,0,
+    255082739,0,310251763,0,0,0,0,0,
+    0,0,0,0,0,71155811,0,10776867,
+    0,0,0,0,47104149,76398707,111906931,42078243,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,434786403,0,69607523,0,
+    0,106266801,488878227,362934371,0,165634259,442007987,0,
+    405065955,441860291,234221763,25567491,90878243,0,0,0,
+    0,0,0,0,0,0,380887235,0,
+    297992291,0,0,0,0,0,0,0,
+    274149587,0,0,0,0,175939763,33792131,0,
+    115769571,0,0,0,0,0,0,0,
+    0,136786019,282300563,303698115,137269395,207233315,473526579,0,
+    0,0,0,0,0,210100387,244969731,149344659,
+    364429475,0,234979411,0,0,0,0,0,
+    0,0,0,0,0,0,308740243,0,
+    314073171,0,40190195,378757427,0,440566003,372228323,412098707,
+    422011043,0,0,0,0,0,0,0,
+    0,0,269807715,416072243,0,0,0,146251987,
+    0,0,0,341442867,0,243888339,0,0,
+    0,0,0,169672803,0,0,0,0,
+    365211715,0,0,318132307,0,0,0,0,
+    212627779,0,0,451170563,43745459,97009763,421412995,0,
+    0,0,0,0,0,311726259,0,0,
+    0,416854579,0,0,308519091,0,206565619,0,
+    0,0,0,0,0,0,0,151470323,
+    264573075,0,0,0,0,0,0,411754675,
+    0,0,0,0,0,0,265306419,0,
+    0,2981923,0,0,0,235003955,0,478269539,
+    0,0,486903955,91640035,68010019,0,0,0,
+    0,0,308916323,372617459,0,0,0,3166403,
+    0,0,0,221544595,0,0,0,0,
+    0,0,0,341995571,295612515,0,0,0,
+    431178211,0,0,0,133234947,0,0,0,
+    40468659,472441139,0,18714787,0,280600691,359764035,128598227,
+    0,0,0,0,0,445268227,0,0,
+    175464707,0,0,0,0,0,0,79917187,
+    92737811,133648483,272691299,0,0,0,0,0,
+    0,0,0,0,0,258683139,0,0,
+    0,190451987,0,0,240783459,266440835,0,237150339,
+    0,116773171,0,0,0,348647619,110899315,0,
+    436420771,0,0,422858819,137891923,0,0,0,
+    0,0,0,0,400793827,0,436957363,0,
+    0,0,0,0,0,0,0,177533155,
+    0,0,0,0,0,0,0,0,
+    0,165753027,0,0,0,0,473677939,0,
+    0,0,0,0,334045633,0,186458195,0,
+    0,0,0,0,0,181158179,0,0,
+    0,12656947,136069219,0,0,0,0,0,
+    192426243,88305875,328081475,0,54071427,37195875,0,0,
+    96551011,393253171,421744755,0,0,0,298422371,0,
+    0,346173843,0,362696867,447648051,0,375586963,0,
+    365752451,0,0,0,224907411,0,0,0,
+    0,0,0,0,0,159908035,0,0,
+    0,0,0,14418035,0,230932611,368558275,0,
+    0,0,351080659,0,0,243671283,0,0,
+    0,106377283,34566307,0,0,0,228241763,0,
+    172908771,0,307294339,0,397726019,0,0,138899539,
+    462856451,0,0,0,0,53432403,125247587,0,
+    0,0,0,368386307,0,0,0,0,
+    452518163,43356387,274469171,0,0,0,0,0,
+    0,164012307,0,0,385433731,419381491,0,0,
+    0,0,0,0,0,0,0,40124659,
+    114901139,40947747,0,0,0,248254547,479531203,0,
+    0,334807569,234164435,0,0,0,35971139,0,
+    0,238940467,0,98599123,261026051,337641747,171622691,0,
+    186712211,0,181235939,442839315,477819123,0,182141155,290492739,
+    0,0,0,0,0,112922803,0,0,
+    0,262725955,0,70496355,0,0,0,0,
+    255991987,0,362348707,65151011,0,346341619,240955491,0,
+    0,153350419,0,0,94781539,0,0,0,
+    0,0,162672899,0,0,0,0,0,
+    77435027,0,0,0,42139827,0,0,0,
+    93000115,114323603,0,0,0,232136915,0,0,
+    0,0,0,0,40616115,77561955,159490195,382570675,
+    0,0,426066165,0,0,0,0,0,
+    145199267,0,280158307,0,0,0,0,212164883,
+    0,0,0,0,0,161976483,122278163,475709619,
+    0,0,0,0,0,0,374993267,0,
+    320978995,0,0,382619811,0,0,0,0,
+    0,313376867,24518947,0,0,0,0,0,
+    0,0,373833987,0,0,0,0,0,
+    0,0,104964195,0,0,60334339,0,480346323,
+    223039715,0,0,0,0,0,0,0,
+    0,381857971,0,0,0,324559155,0,0,
+    0,270569571,443912355,0,0,0,0,0,
+    0,0,0,0,0,0,377815267,0,
+    95584355,0,0,308494419,340779155,419520675,0,0,
+    0,0,0,0,74142035,0,0,64434243,
+    441913699,0,0,0,0,0,0,0,
+    0,0,0,0,355180931,0,0,167489699,
+    380477619,0,0,112566355,26058915,0,376127555,0,
+    0,0,0,0,0,0,0,0,
+    0,374100133,0,0,0,0,0,0,
+    0,0,0,0,0,217837731,452055331,0,
+    0,137953459,0,62029939,10801347,0,0,133099779,
+    0,0,0,0,0,0,0,0,
+    0,7622867,0,0,137396387,15655203,231608515,233488643,
+    343670931,0,26103923,0,409186387,132677827,102129955,353857875,
+    39416003,351006995,0,295669859,0,318083139,268406899,0,
+    0,0,0,34873571,0,0,0,205410451,
+    0,0,0,293523731,0,0,0,230318131,
+    0,0,0,0,0,0,0,18038929,
+    289177891,296472675,0,0,0,0,91832483,0,
+    0,0,0,97468515,0,0,0,0,
+    56848723,277545059,486011027,0,0,0,0,0,
+    0,0,0,0,0,213004627,0,0,
+    0,0,0,363552979,0,53542995,433344579,0,
+    0,0,203305251,0,488063075,0,0,404947027,
+    0,0,4284449,0,0,0,0,0,
+    0,0,425349219,0,0,0,0,0,
+    0,0,264040563,0,0,119349427,116052147,372977827,
+    0,0,0,0,0,0,0,377876723,
+    0,0,54907011,0,0,0,0,204734579,
+    42774611,0,0,84308275,0,0,0,379638035,
+    0,220643475,244322563,0,0,374345827,0,0,
+    91427059,475373715,0,359735395,0,0,0,0,
+    26333331,0,331403713,329802211,0,0,41795763,0,
+    250269939,334340673,0,0,76603507,0,1638515,0,
+    374546595,0,0,0,423866611,0,0,0,
+    167792739,227291299,275030275,0,0,0,284066003,0,
+    0,0,0,0,0,0,398569635,231063747,
+    0,249364611,71843939,237518963,303939667,0,0,0,
+    276476227,0,8327363,0,0,0,0,0,
+    0,0,0,80605381,43999315,0,0,0,
+    0,0,0,0,135569507,0,0,0,
+    0,0,0,0,0,88920259,0,0,
+    279024035,0,0,0,69435491,0,0,0,
+    0,29397155,0,0,4935907,0,413778131,68546755,
+    356307219,143450387,472609011,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,134336611,0,0,0,0,0,0,
+    59671075,0,0,0,0,107872339,0,146309267,
+    0,0,3592275,69750883,218898515,165118195,466645203,0,
+    0,0,0,0,0,0,0,0,
+    0,240210019,83951795,0,0,0,0,0,
+    402198611,0,0,269348963,0,0,0,127946979,
+    221257875,0,0,383352883,290361603,15732963,377032979,222638275,
+    421167283,198521091,0,0,0,0,0,113156291,
+    105242787,0,0,0,0,0,0,0,
+    0,0,484589779,399204611,0,0,0,0,
+    53579859,0,441340211,0,0,0,0,0,
+    0,217333939,402854019,403218499,0,55496787,172122323,0,
+    52887651,157724915,375152819,0,263614579,42664227,288637107,358293827,
+    0,0,0,0,0,0,0,0,
+    0,474542339,0,0,0,160714803,0,135770211,
+    0,0,164786371,310431811,0,139329763,0,0,
+    0,393871555,57397523,195530979,230375699,0,0,0,
+    0,0,245186851,0,0,0,0,0,
+    0,234881107,0,0,0,0,0,0,
+    62382229,0,0,0,159609107,0,0,0,
+    0,297074787,0,0,0,0,0,0,
+    354439475,0,0,0,0,0,2420915,0,
+    484196451,0,0,0,178295107,296587363,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,66474067,0,0,0,0,
+    168968307,0,366375059,0,0,0,0,0,
+    0,79360195,348045411,0,452464835,0,241156195,0,
+    191009027,0,0,270970979,0,0,0,0,
+    0,0,430596275,0,0,0,0,0,
+    0,75714835,201257139,279048515,0,0,0,0,
+    0,0,5963891,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    72388707,71815267,0,0,0,0,0,21643571,
+    0,0,0,66170963,0,99860579,0,0,
+    0,0,0,360911059,50069683,0,215896291,0,
+    0,0,0,0,0,0,208707875,489029731,
+    0,0,0,3616851,349175939,0,0,22745187,
+    108163331,250773795,0,0,0,0,0,0,
+    0,0,0,0,23306355,93667459,403165379,0,
+    0,69365795,43810915,109805635,39600371,179527987,255225955,0,
+    0,0,190685363,0,232358179,26796163,437805251,0,
+    0,0,0,0,0,357237011,87158979,8380611,
+    17940563,432431219,0,0,0,0,0,140304579,
+    0,185692307,0,286171219,381239571,0,0,0,
+    0,0,0,155128083,0,262426963,0,0,
+    233558275,0,0,157790531,0,163598579,239521891,185442579,
+    196608307,0,275464435,357310803,0,0,0,50176051,
+    476819619,0,0,0,0,0,0,0,
+    0,0,38178851,0,0,364597491,0,0,
+    0,0,0,0,0,0,69693539,233812291,
+    100114739,0,0,0,0,404631619,238141683,0,
+    0,344850531,298938467,60289187,0,0,0,0,
+    0,0,0,0,104714723,215134419,137633923,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,32305379,434856195,
+    0,0,0,0,0,0,0,0,
+    297418851,134766691,0,0,0,0,0,55816339,
+    294178899,0,383447091,0,449073379,0,0,0,
+    0,1589347,0,0,385609843,0,28315875,42274851,
+    446812771,0,0,158675139,281788595,128995603,0,232919347,
+    0,0,40763571,440119651,0,0,0,0,
+    0,0,223883347,0,318013507,310382771,367558739,0,
+    0,0,0,0,0,61079731,0,0,
+    0,0,0,0,176500995,152154403,0,0,
+    0,49119379,287772915,375337139,40308771,0,0,20357347,
+    0,0,0,0,0,226119907,0,458203379,
+    0,0,0,101236835,426197363,0,0,0,
+    0,0,0,0,0,72847459,0,0,
+    0,0,434180179,411562131,138936515,0,0,248746083,
+    0,0,0,0,101785843,0,0,0,
+    0,0,0,0,0,0,0,291819667,
+    40370355,0,361640115,0,0,0,90349699,261189875,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,273477747,
+    197234963,0,139862179,44658787,61898835,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,168116339,306778259,
+    435794099,0,0,0,0,427418339,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,185757779,28377331,0,0,0,336683251,
+    19783907,11796819,155820275,485142627,327929987,0,391684259,0,
+    0,0,0,61030579,0,65773683,0,0,
+    444731603,0,146038867,270999651,458416403,0,0,0,
+    209957011,0,3768355,0,390692947,108015699,0,0,
+    0,0,0,0,0,0,161837299,260890883,
+    0,0,0,0,0,0,0,0,
+    0,0,310714467,0,0,0,0,0,
+    0,0,0,0,0,0,280846787,0,
+    0,187916435,0,0,0,0,0,0,
+    0,0,0,359784595,0,0,0,0,
+    35733667,0,169082979,12689587,0,0,0,242127267,
+    0,155988147,0,294981731,0,0,25428163,411951187,
+    0,0,229183699,0,0,239865955,0,422326371,
+    454996323,0,0,0,0,0,0,0,
+    0,476778643,279134627,373477555,59814275,177922355,430821459,0,
+    284442979,111308931,0,0,0,0,120713363,0,
+    316649571,0,0,316440835,289501523,0,0,0,
+    0,0,0,0,227479715,0,0,369447075,
+    0,0,0,0,0,0,0,0,
+    0,0,340062595,0,0,0,0,215798035,
+    154832931,0,0,0,0,0,0,290254995,
+    0,0,0,0,352038979,0,0,0,
+    0,0,304148915,199356707,0,0,415736003,0,
+    0,0,0,478851171,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,241717635,0,0,0,138862675,296501347,
+    0,0,0,0,0,0,438665539,0,
+    0,0,0,0,0,0,0,0,
+    340165011,0,0,0,0,0,0,0,
+    0,0,448630963,0,460673315,259534995,327086371,0,
+    30253187,98365539,226963555,0,0,396665171,0,0,
+    0,4571187,0,0,0,0,0,328060995,
+    0,75587699,370188435,0,0,215339203,0,0,
+    0,0,0,0,0,0,0,0,
+    196538627,0,0,0,113557571,0,8433763,74231907,
+    0,0,11673713,0,129650851,193941811,0,0,
+    232472835,0,391405827,125984995,0,1126515,327618707,0,
+    298279011,0,283521107,163250403,419446883,0,0,0,
+    0,330039715,0,0,484868291,0,0,0,
+    0,0,0,366559411,0,289870083,0,0,
+    0,0,0,381980771,0,671907,0,0,
+    0,0,216789075,253034739,398909587,0,282562659,0,
+    248414291,0,0,0,257675475,243134835,366227699,139440211,
+    0,0,0,0,0,457285859,384725235,0,
+    0,0,0,0,0,0,0,463503587,
+    382689603,0,221380755,0,0,0,94838883,0,
+    0,0,477372483,0,0,0,0,0,
+    0,67973203,0,0,0,0,0,165355765,
+    160157907,227897619,270798947,305651891,375980227,182239299,0,0,
+    0,0,0,37412899,0,232034547,362061891,30969987,
+    0,226439315,0,0,0,0,118562995,0,
+    0,0,466579539,128655571,0,0,292761859,472916211,
+    0,0,0,0,0,0,0,0,
+    0,0,0,39293155,72732771,71401507,0,0,
+    0,13897811,251011347,0,98136163,0,0,0,
+    0,0,379711747,0,0,0,479777027,156799171,
+    365396147,0,205476035,15483123,379408659,0,0,90333379,
+    0,0,0,191263091,340820083,0,445186355,295096419,
+    484450403,0,0,0,0,0,0,210407667,
+    0,0,0,440283395,0,295411811,362217667,0,
+    0,0,148476195,0,0,166842723,14487939,0,
+    0,0,0,0,316150131,0,0,79683699,
+    287236355,0,0,0,312647939,433180883,0,0,
+    0,0,11178195,142569747,101736627,165314707,67317843,120893731,
+    0,0,0,0,0,0,0,43507827,
+    0,0,0,122597491,0,0,0,470990931,
+    77861011,0,0,337973507,0,0,0,0,
+    0,0,0,0,0,0,0,155623651,
+    0,0,0,0,0,0,0,0,
+    0,0,46358739,307712099,0,0,0,370364787,
+    303530243,0,0,3555363,0,0,0,0,
+    0,278765731,0,266158259,487719059,10559699,0,0,
+    0,62734643,0,0,0,0,0,0,
+    0,0,458920195,256667795,12579107,0,0,0,
+    0,0,0,160768147,254992531,219656355,0,316874931,
+    213795203,0,337068323,0,2629683,106188963,127594691,408056083,
+    0,0,0,42090675,315224243,0,0,261464307,
+    0,0,0,444788995,0,0,360345763,209117475,
+    0,0,211792179,236601491,0,0,0,0,
+    0,0,336191971,94138451,92238003,4063267,84058211,340476115,
+    0,0,225419683,48300291,256442595,53960835,4681795,51077331,
+    478908787,0,0,0,0,472367379,0,378003699,
+    0,0,303816771,0,0,0,0,0,
+    379859235,0,0,0,177664307,372478099,0,0,
+    0,0,0,0,0,170090595,0,336478355,
+    0,0,0,0,0,0,0,0,
+    0,98656403,417833345,224227539,0,0,234807379,0,
+    0,0,398950563,0,0,0,256254067,0,
+    159789331,0,168804467,399536355,0,349823171,0,0,
+    0,220520595,0,0,0,0,0,0,
+    0,0,0,2703411,35463219,0,210047171,273346819,
+    309293107,0,0,0,0,0,0,0,
+    0,285716805,0,65933859,223907923,339288195,261783843,190050595,
+    0,432169139,0,0,40665267,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,437170403,295899235,0,4898947,
+    0,0,104865891,398315843,0,0,0,463110499,
+    0,461246803,0,0,0,0,0,0,
+    0,239894627,54452307,32759859,384131459,138989699,445571427,0,
+    0,0,0,23158899,0,0,411938851,0,
+    0,0,0,0,0,116465907,0,0,
+    0,87593187,0,0,0,0,0,0,
+    465133827,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,33685651,
+    4014115,0,0,0,0,0,290316451,0,
+    0,0,0,42127395,0,0,0,0,
+    0,0,0,0,0,0,0,358904131,
+    173691155,323895635,0,0,0,0,239837283,0,
+    0,0,0,83329217,0,477999299,0,0,
+    0,0,0,0,0,0,0,0,
+    0,347279427,0,0,417935907,205578355,0,0,
+    0,457183411,254570643,0,0,0,0,89112723,
+    221831315,0,257159347,0,0,376221779,24268995,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,247316803,0,0,0,0,
+    0,0,32776259,0,124109043,0,0,0,
+    17494145,35594387,0,435405027,454656259,147886243,0,0,
+    0,297533539,0,0,0,0,135872595,0,
+    0,0,0,0,371814483,0,0,253444403,
+    0,0,0,0,0,0,184647717,436527331,
+    88248531,477413475,0,117133587,0,0,336797875,0,
+    318386307,389341315,0,0,0,0,13574227,0,
+    0,140357811,0,0,0,0,0,0,
+    49442915,0,0,231661699,0,40095843,0,0,
+    0,289939587,0,0,42635363,15143043,237236403,0,
+    0,0,0,0,43229299,139038803,48148579,292884739,
+    336974179,0,0,460845331,0,195133587,26017939,311525459,
+    344047715,0,0,0,442970355,0,473837875,74563827,
+    0,0,79282371,50221235,294203475,0,0,371740835,
+    315273283,0,0,0,0,0,0,0,
+    12025971,0,0,105124179,254951571,0,0,0,
+    0,0,0,0,0,317272131,0,128790803,
+    296702051,399482963,0,0,0,0,0,80941283,
+    0,0,477212947,0,0,0,0,0,
+    0,88637571,303898771,0,71974947,0,0,0,
+    0,232435843,0,0,0,0,138318003,0,
+    0,218296403,365928787,139804755,25170083,189813043,317395043,53530755,
+    0,0,0,0,0,0,0,289423651,
+    0,0,0,0,0,338886899,0,231534739,
+    0,0,0,234377363,466624579,137195635,32714803,130756771,
+    221585555,0,0,0,0,0,0,0,
+    0,0,457138339,0,98422883,181022979,5652579,218988739,
+    0,0,198103347,0,0,0,0,79048945,
+    386035827,441213075,0,0,0,0,0,77623541,
+    335745331,182800643,0,0,0,0,0,0,
+    0,0,0,0,220274835,0,112316691,84574307,
+    314003603,0,0,0,0,0,0,0,
+    317227171,0,0,0,129163411,0,309309619,0,
+    0,0,0,0,0,0,0,0,
+    274383171,0,0,0,0,369996083,54476931,358535411,
+    0,0,0,0,11542675,271802467,0,0,
+    0,74260595,0,0,130232659,0,0,0,
+    0,0,139567203,0,0,459665699,302411939,0,
+    0,158847123,0,37298211,0,0,368271603,211292355,
+    0,0,0,0,0,221462675,37212195,335151475,
+    311550131,0,0,0,0,246563091,444960947,0,
+    59027699,237957363,0,0,0,0,0,0,
+    0,97038435,247181555,328864211,386760787,0,0,0,
+    406159459,313274515,0,0,0,0,0,0,
+    0,0,0,0,0,31989795,99188915,0,
+    317292659,0,0,348369027,0,0,0,0,
+    0,0,0,0,441467091,0,0,56713267,
+    240640099,0,345293027,101929139,484978787,0,0,399126755,
+    77688915,463565043,56664243,136413283,270225507,0,0,0,
+    0,335909171,0,0,0,0,453435699,189001971,
+    0,166642067,463266019,0,460443891,279159107,433852675,0,
+    0,0,321773619,0,0,0,0,263942259,
+    398483603,0,0,0,0,0,50884883,431808659,
+    205328515,386523187,401490243,0,0,0,319201475,0,
+    0,154792083,0,0,0,0,0,0,
+    57942195,136556643,50118867,120430707,22892579,0,0,96895075,
+    0,161579315,0,272748643,0,251822227,14692707,18366547,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,305074387,0,0,
+    270856291,0,0,13725843,0,0,0,0,
+    0,0,0,0,298250339,431775859,0,139149395,
+    467910915,0,0,0,0,147095747,0,0,
+    61386947,0,0,216969315,0,0,0,0,
+    0,383824083,0,283168867,416543281,471191635,0,109252851,
+    0,485900435,119300275,33779747,0,0,0,0,
+    0,140939347,0,0,0,21397843,237719795,102895763,
+    37839107,0,219304099,0,246173859,386981971,0,0,
+    0,0,0,0,0,0,58855763,0,
+    0,0,0,0,438499,0,0,0,
+    0,0,316383443,0,0,184385587,0,486944867,
+    0,228978851,0,0,0,487993443,0,0,
+    0,0,0,46416083,162603267,0,0,0,
+    0,0,0,0,0,0,376246371,54685827,
+    0,0,0,0,0,335827251,0,0,
+    0,27807811,0,0,0,266248435,0,434597955,
+    0,0,0,318034099,0,0,246358291,0,
+    52809955,156545331,0,0,0,0,0,0,
+    319054051,278560851,0,0,0,0,68677779,136470627,
+    0,352231699,0,0,0,0,287428867,0,
+    0,0,67190867,134680675,399868227,84406547,423514355,0,
+    420610275,0,121286947,361599123,0,0,0,212480259,
+    431943843,0,0,408478179,119939251,34431075,0,400503075,
+    0,0,0,12517603,338411843,253174019,0,54120531,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,3031075,0,0,153772259,
+    0,0,0,0,0,218128501,0,0,
+    0,0,0,140542035,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,71917603,0,
+    0,0,250523845,0,0,0,164933827,396939443,
+    0,46002371,0,0,0,0,0,0,
+    0,0,0,0,0,368046323,0,0,
+    0,129278291,0,139255939,0,0,0,0,
+    0,0,0,0,0,0,67293267,167952499,
+    0,359428211,0,0,0,0,209645891,160456995,
+    0,344879315,0,0,0,0,0,392413475,
+    0,218460355,278667635,0,0,0,0,0,
+    178692579,0,0,0,0,0,0,91492627,
+    0,0,405053715,0,0,0,0,0,
+    0,0,0,0,0,0,313040979,131715235,
+    0,0,0,0,0,59453811,0,0,
+    396484931,0,0,129830995,0,0,0,0,
+    0,0,249270515,144384147,0,0,157876307,282927315,
+    71098467,0,0,0,0,0,283963507,28737827,
+    10342675,21954627,365084739,181891379,415514771,13631603,343761043,0,
+    156389587,248389715,0,0,0,0,0,0,
+    0,52617379,0,0,0,183419027,0,326000771,
+    0,0,317714531,223166659,429003475,298451043,140173395,0,
+    0,0,385073491,11513955,160297075,0,278315187,34611267,
+    0,0,435994787,192577907,183812275,0,20074595,163836035,
+    58204531,271573091,0,203682115,258289907,0,0,0,
+    0,2469955,0,0,0,0,0,0,
+    84222277,0,0,0,0,0,0,334959121,
+    329097635,0,0,302895251,0,0,343224387,0,
+    68268211,467415315,0,26489219,0,0,0,39231715,
+    115105987,0,0,0,0,0,198246611,295641187,
+    125350067,422924435,0,0,0,0,370331763,0,
+    0,10670259,49877235,0,0,422191187,0,0,
+    0,67018835,0,136327267,289792291,0,0,0,
+    258552051,0,0,0,0,0,0,0,
+    0,20418627,0,165269667,113311939,296128611,0,0,
+    0,240324707,0,0,0,0,0,0,
+    0,0,0,396755299,0,178225411,0,95555683,
+    0,309358659,146100355,0,66965699,108040323,166338819,420135137,
+    0,0,133447795,0,0,0,12738851,0,
+    0,0,0,0,0,0,241631555,0,
+    0,0,0,0,0,234680451,84799859,0,
+    0,0,0,0,0,0,0,0,
+    0,0,340918435,0,0,130138467,0,0,
+    0,0,0,0,0,0,0,129204499,
+    0,195391747,167821411,0,0,0,0,0,
+    0,475828371,0,0,0,0,0,0,
+    0,0,0,309059747,0,131055699,0,0,
+    468902179,0,0,0,172323171,0,181821697,96436323,
+    118120627,0,0,0,0,0,0,41734179,
+    376033427,0,0,0,70639715,0,174301491,0,
+    70697059,0,0,5316707,0,36257891,0,0,
+    0,453693619,0,0,0,0,201142451,0,
+    37310563,0,0,0,0,0,0,0,
+    0,0,0,280694979,0,100651091,303624467,0,
+    392139043,86962451,0,18309283,0,0,35254371,167514179,
+    0,0,157900947,0,32968755,0,480485507,140669171,
+    483917923,0,0,0,377376963,0,139513939,0,
+    0,0,0,0,0,0,412414163,0,
+    66371683,0,0,218038371,0,0,0,299385011,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,232194355,0,0,
+    0,32080115,440869203,0,0,0,0,0,
+    248484083,482074819,0,0,0,0,0,0,
+    0,0,0,0,0,0,435577059,0,
+    0,0,0,338657523,0,0,456741123,403697971,
+    347963699,227721347,342946051,0,0,0,0,0,
+    415269011,0,0,0,0,487002211,0,0,
+    0,0,0,462037443,0,113422419,0,0,
+    0,0,0,0,0,0,0,0,
+    220602515,0,0,0,0,0,0,248180773,
+    275734787,0,0,0,0,98451715,0,0,
+    0,0,290054387,0,0,0,25215091,0,
+    45801827,0,0,0,354771219,0,25821459,0,
+    0,0,0,0,0,0,0,133906531,
+    158437507,0,0,256340147,454156627,0,188162195,3780691,
+    0,0,197185715,105005267,0,0,447844627,0,
+    269148259,323276931,0,0,122892579,0,0,0,
+    245694675,0,0,0,0,0,488022163,281563347,
+    0,0,0,0,179257411,0,0,0,
+    0,256917603,0,0,0,317599811,0,220479635,
+    0,0,0,114061619,0,0,383152227,0,
+    0,0,0,0,0,0,49361041,0,
+    176808019,0,260809011,0,0,202117347,316678291,0,
+    0,0,0,292954451,0,0,26656947,17547585,
+    0,0,0,0,0,72491043,0,0,
+    0,0,0,0,0,0,0,0,
+    432742563,0,202027347,0,0,66244707,0,0,
+    0,0,0,54759555,306819155,388280595,367698051,0,
+    0,0,0,0,0,0,272978035,0,
+    0,441524403,0,366608483,0,474705987,0,0,
+    0,467009635,178979075,18018531,200040771,432070771,0,0,
+    99635347,438886563,0,139595891,248438947,0,0,0,
+    0,394727605,0,0,0,0,488562835,0,
+    0,0,0,0,0,326136083,0,0,
+    0,0,0,409989329,473452819,319774883,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,319164547,0,0,135925859,0,208531779,
+    0,0,0,0,0,0,0,432316595,
+    261697859,0,26980563,0,0,0,0,0,
+    0,0,0,370929971,0,87941171,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,374845635,388624707,85774483,0,0,0,
+    58335411,31494211,0,0,0,0,0,0,
+    199119123,0,0,0,53190899,320741475,230183059,0,
+    118268083,0,306270627,0,0,0,0,0,
+    0,0,97734755,479334499,0,0,460378355,0,
+    0,0,0,250405203,0,0,0,0,
+    424235155,0,0,0,0,0,0,0,
+    328741331,53874771,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    275415123,0,0,0,422572211,0,0,0,
+    0,186753171,0,0,270454883,0,0,0,
+    0,0,20439155,0,67792979,0,213295379,0,
+    0,168706163,0,0,0,0,0,66744403,
+    467980579,0,0,0,0,0,0,0,
+    0,0,0,0,0,167682243,0,0,
+    0,0,0,237088819,371392611,0,0,0,
+    0,360317027,168345715,0,0,0,73396483,0,
+    0,0,0,0,0,47960227,0,0,
+    0,0,0,0,0,198590787,0,0,
+    14880883,0,0,0,0,272719971,0,0,
+    0,0,0,77947123,0,0,203227427,0,
+    0,1671395,393961603,0,0,0,0,256778435,
+    0,130891859,0,295325795,0,0,0,0,
+    0,0,0,31256771,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    139231315,0,0,0,0,0,255942835,0,
+    0,278171795,0,139305043,471892291,0,0,0,
+    219701331,0,0,0,0,0,0,0,
+    0,0,0,0,0,220356755,475943139,0,
+    0,0,0,0,0,5709989,0,0,
+    0,53403699,247783683,325865587,184566067,281075907,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,468537715,25636963,0,0,0,
+    0,0,0,0,0,0,0,108744931,
+    350097683,123879731,399048787,0,0,0,0,0,
+    0,0,186957971,0,0,0,0,0,
+    365338835,0,0,68022355,0,0,319914195,200192179,
+    0,300863683,344105059,0,0,0,58945843,0,
+    0,0,0,0,81244371,410235107,7975123,0,
+    0,0,0,0,0,0,0,0,
+    0,348184739,0,409878737,0,18100337,0,0,
+    0,0,36614339,258355443,287711459,352211011,367735123,0,
+    0,0,0,0,287187123,480813155,0,0,
+    97697923,472674563,0,221749395,261255411,489058403,0,0,
+    0,0,0,0,0,369221795,325247059,0,
+    0,159088739,112333009,0,216928403,0,0,0,
+    299778291,0,0,0,403464275,0,0,0,
+    0,0,0,0,0,0,175988915,259297523,
+    304795875,0,241070179,0,0,72118307,0,238805203,
+    0,0,0,0,414949555,0,0,0,
+    202989811,0,136499299,0,205947139,295239779,0,0,
+    270139491,0,0,60264707,0,0,478601459,20808003,
+    0,272318563,0,106070131,146162003,322216035,127680771,5742627,
+    0,0,0,0,0,0,296099939,36372707,
+    0,222089363,386580515,0,0,0,0,206631203,
+    0,0,0,459260163,158011587,0,264007795,0,
+    0,0,296759395,0,356004179,486973539,9760963,23339123,
+    0,0,0,26706163,174739699,0,0,0,
+    0,455954611,0,0,0,400855315,0,0,
+    158064931,0,0,206168339,30622099,344420515,386932819,95715427,
+    160256067,297476195,0,198676819,0,0,0,0,
+    0,0,0,197877987,0,95498339,408351203,39268435,
+    0,0,0,0,0,0,180998227,339738739,
+    0,0,287305923,0,0,0,0,409096339,
+    0,0,0,0,0,0,0,303390835,
+    430547123,0,0,0,0,76697651,257282291,0,
+    0,0,0,0,0,0,49651795,97611875,
+    282873939,0,0,0,446607747,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,67645475,0,0,
+    0,0,84525235,392069379,0,0,0,0,
+    110751923,0,0,195739939,131473507,204018003,0,0,
+    102473955,0,0,0,458137843,0,0,0,
+    0,0,0,0,0,0,20775027,0,
+    0,105423075,0,0,0,0,0,0,
+    0,0,0,53051603,355103011,0,0,117711027,
+    255148323,0,0,0,163795091,0,315568259,0,
+    0,370909251,0,0,0,0,351539299,0,
+    0,0,0,0,0,0,0,0,
+    80052483,0,0,0,0,0,0,0,
+    0,0,0,176726163,476704867,0,0,0,
+    283103315,435687587,40861875,211235027,307847315,31903875,283263219,425689269,
+    474685507,0,0,373903619,0,0,0,0,
+    297648227,0,0,0,0,0,0,0,
+    0,227020899,68599987,292708547,295497827,0,0,0,
+    0,0,248102963,54919251,312717875,87445731,0,343531731,
+    126877779,180388099,208154963,294555875,344162403,0,165937395,240468067,
+    4296787,0,468730179,31514787,101601555,431988915,0,0,
+    259072179,14991571,0,0,0,268566771,0,0,
+    0,83681379,341840099,0,0,0,295440483,0,
+    0,0,419930163,0,0,470909171,0,0,
+    0,0,0,0,0,0,0,0,
+    72503395,188916035,12058851,294617299,19636563,0,0,0,
+    0,356229411,0,444477651,0,0,0,0,
+    41255091,0,0,0,0,0,0,5230723,
+    0,293269859,0,0,0,314179699,54489171,0,
+    21070083,42897635,0,0,0,0,0,0,
+    835811,0,394776757,0,0,64135393,448201011,0,
+    0,187039843,175534275,415150371,0,395456819,0,405655779,
+    161660979,0,0,405127427,0,394473699,0,0,
+    0,0,110456979,208027939,361025603,87359635,0,6541539,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,288104755,0,0,
+    0,0,0,211419379,228122739,471683331,0,0,
+    0,0,0,0,0,418959841,4235299,0,
+    0,0,0,0,0,0,0,0,
+    216510675,54648963,0,0,215494851,387952883,0,0,
+    0,0,0,0,0,0,0,0,
+    0,37023843,0,0,0,416379441,0,0,
+    451928291,0,0,0,250495075,23457827,0,87761075,
+    261861715,415895779,0,0,0,0,0,0,
+    432975923,33112291,141848851,0,0,75047107,0,0,
+    234483795,0,361857187,0,0,0,0,4149331,
+    0,0,60596467,103981219,130388115,245113107,0,295469155,
+    0,42799267,450437411,274657539,0,0,0,0,
+    0,0,0,0,0,94924899,0,0,
+    0,0,0,4489363,70840419,0,222560451,0,
+    0,0,0,139907267,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,114212947,0,0,0,0,0,
+    0,0,386068659,433135779,481415299,97525859,0,294527075,
+    30519683,0,0,0,0,130801811,0,0,
+    0,425435235,0,30896259,306634835,281260339,352633091,375808195,
+    402026627,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,219140307,0,
+    0,0,0,176177347,0,0,0,0,
+    0,0,0,353616131,282796083,0,383488083,0,
+    325398787,254529683,409026659,0,0,260174131,0,344547443,
+    303599699,230449299,0,0,0,0,0,0,
+    0,395034771,199815411,147407059,3756115,0,0,0,
+    0,0,0,0,0,336396435,0,0,
+    467566867,0,384905363,0,0,0,0,0,
+    125178115,0,0,0,0,0,0,200241379,
+    0,0,0,273092803,0,0,413884515,6176947,
+    0,0,0,176939203,294326355,34459859,0,0,
+    0,0,0,0,0,0,0,0,
+    405745811,486219875,0,107896915,0,298909795,485830803,0,
+    0,0,0,0,0,0,25968819,0,
+    197939491,0,40255731,0,0,29769925,352801091,0,
+    0,0,0,0,126902323,0,0,0,
+    209838147,0,115187811,92442771,0,432300083,0,0,
+    0,281534563,0,0,0,0,0,0,
+    481452179,155885795,0,0,0,316125267,272519267,16523763,
+    269664355,0,62816563,0,0,173973763,0,0,
+    0,54329475,0,0,0,54575235,0,0,
+    0,9613539,328364467,0,0,207700195,113365059,409415859,
+    0,0,0,0,0,0,0,307777619,
+    175337811,0,0,0,0,0,126656547,0,
+    0,0,0,51179731,0,254652563,0,0,
+    0,0,324276419,17031251,0,0,0,0,
+    184086787,211484899,0,0,0,0,0,0,
+    0,0,0,271229027,0,275960099,0,395804995,
+    21282963,0,0,131031123,180232515,11088067,203055315,175866131,
+    320684131,412664035,423964771,0,0,15101987,0,409161811,
+    0,0,55591123,0,0,202289443,0,0,
+    481210499,0,128274691,0,425832595,0,244392195,344191075,
+    425738403,477671651,434249907,0,0,0,0,0,
+    0,419635331,0,0,0,0,0,201654595,
+    0,197398835,0,169615459,0,0,0,358138163,
+    150892931,0,0,50499683,139219075,0,0,0,
+    0,0,317743315,0,0,0,0,0,
+    0,0,0,0,269492323,299995251,385782035,419565731,
+    0,0,0,2019411,0,0,0,0,
+    0,52596803,0,0,0,0,372101379,285139187,
+    0,0,0,0,397066515,0,0,0,
+    0,0,216166579,362610915,0,0,311476403,0,
+    0,0,0,0,0,29274307,199659811,367018067,
+    0,0,155410739,295039075,0,286388339,112902211,46473443,
+    225906867,298307683,26472499,220971155,0,0,0,0,
+    0,0,0,320205027,0,32542915,0,0,
+    63078531,0,0,38580259,0,0,0,407425283,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,50364675,118513843,
+    420671555,0,306163955,429761235,0,0,0,0,
+    315052131,0,0,0,294002867,0,200486995,0,
+    0,0,0,0,70008931,0,0,0,
+    132186371,0,239693923,0,0,0,219275363,0,
+    235602115,108593347,0,43794483,0,0,0,247013683,
+    99889427,15401267,41156787,0,0,0,271831139,390717651,
+    272347235,0,0,0,4333603,0,0,46842115,
+    117530979,324641139,0,0,0,0,226181251,0,
+    266314099,200737011,0,0,0,242942307,0,362741955,
+    0,470180051,434495555,0,252624979,0,0,0,
+    0,0,0,0,116355363,218722435,382210179,78524771,
+    0,0,0,0,0,0,68407459,83575043,
+    344391779,420286707,9474211,0,0,0,0,53420163,
+    53506131,155029651,291958995,0,0,0,0,423428419,
+    0,292343907,345633155,0,290742355,81621187,0,97964131,
+    0,265519379,230138019,0,0,0,0,471150739,
+    0,387809507,0,0,213410115,0,311349315,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,219504819,200646819,171540787,244592819,
+    0,76431683,57065571,215449763,0,259158211,87810291,139001939,
+    0,443105523,371953939,0,0,0,0,0,
+    479985891,0,0,0,0,0,0,257798387,
+    0,0,270827619,0,0,0,0,69808227,
+    0,0,0,266928291,0,345928019,0,0,
+    0,45056163,0,5292115,154095971,234856531,171036803,0,
+    0,0,0,0,0,0,0,0,
+    0,0,449544467,0,128237699,443326643,0,217735315,
+    0,4075603,0,67514531,188588179,0,103289139,140087619,
+    0,0,82464931,0,0,0,0,0,
+    0,0,151793907,0,0,0,0,112590947,
+    0,0,0,66670675,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,346783891,
+    0,0,223522899,0,175636755,0,0,0,
+    0,0,0,0,41402547,139268179,0,26865811,
+    0,50692339,0,0,0,0,0,0,
+    0,0,0,0,444535027,56823891,0,47177857,
+    0,0,67305507,0,0,0,0,0,
+    16142659,0,0,0,171073715,0,0,0,
+    380158275,0,82575539,93778019,0,0,1912915,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,124969235,0,0,460996851,0,422531219,0,
+    0,0,0,0,156627235,0,0,0,
+    0,0,0,0,0,0,0,0,
+    94867555,0,0,182673507,298135651,450744595,0,24957091,
+    0,24154211,0,5029923,387535139,0,0,0,
+    237695059,2646115,0,0,0,67366995,69738531,0,
+    0,213368979,0,433307779,354685251,0,29798483,0,
+    0,0,0,129052723,0,0,332612131,0,
+    0,320020563,0,0,0,67215443,364089571,374649059,
+    0,0,252031251,0,0,280965299,0,0,
+    0,0,68317523,0,0,181453155,0,0,
+    278450323,0,0,230572307,0,0,0,62181557,
+    0,0,0,404320595,0,453804211,0,0,
+    136843363,0,0,0,0,0,0,419717219,
+    0,0,0,183599299,171925811,0,0,0,
+    0,0,0,447520947,0,0,0,389820675,
+    0,0,34517171,39022675,0,338198787,0,0,
+    37281891,0,164085843,7643267,225034403,466604099,0,0,
+    0,401793139,143974643,0,130023571,0,0,0,
+    0,0,0,0,0,417804785,1974307,0,
+    0,0,0,432566451,0,0,0,0,
+    0,0,0,0,344133731,0,0,0,
+    0,251691187,256094419,339665027,0,0,0,0,
+    0,0,0,0,212918595,290799827,0,0,
+    0,0,0,0,80376019,15048947,327966883,0,
+    135856275,0,0,446972227,0,0,125743187,0,
+    0,0,0,0,0,0,0,95944803,
+    0,270913635,0,0,0,0,130867283,0,
+    0,0,0,283238483,9207971,0,6557859,0,
+    70123619,0,0,264966435,468459811,0,0,0,
+    0,0,0,100901139,155685043,0,63012963,79790131,
+    0,0,0,0,0,0,10719443,477122691,
+    0,475177187,299557025,0,0,323424339,304070947,470593891,
+    0,0,12464323,0,0,52916387,0,0,
+    0,0,0,0,0,0,0,148136227,
+    322179203,0,0,129855683,0,0,0,0,
+    0,0,0,453320931,0,42385603,156745923,0,
+    0,0,0,0,0,0,208867539,0,
+    0,0,0,141922611,0,0,0,0,
+    0,0,0,0,214798611,0,0,345190499,
+    67768403,220315795,0,0,0,0,0,0,
+    0,0,306933907,0,0,0,0,479179059,
+    244535507,0,0,69779555,0,0,0,0,
+    0,0,0,0,0,0,451875011,351633811,
+    51671443,0,484810851,97153123,0,0,0,0,
+    0,347578643,0,0,0,29233299,23425059,0,
+    0,0,53997699,0,0,380395827,0,0,
+    0,333193699,423579971,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,118808755,0,0,
+    270340195,406343955,0,0,0,314233137,32002195,0,
+    0,0,0,0,306683971,0,230514899,369631349,
+    0,0,65069235,0,0,0,0,0,
+    230080723,362877027,0,0,0,0,0,379089235,
+    0,0,0,0,0,270712931,0,0,
+    0,0,0,0,0,0,0,0,
+    0,66756643,96694371,0,0,0,0,289108227,
+    141443395,411975843,0,0,0,413835443,0,182489411,
+    0,0,0,0,0,55128195,159989987,421965987,
+    0,0,110997619,373788835,0,32424131,0,0,
+    0,358473955,0,183533811,0,0,438583603,0,
+    0,20893891,0,51028147,0,0,0,468058371,
+    0,0,171159731,0,0,0,0,446710147,
+    0,0,0,0,0,14356627,467173651,0,
+    0,0,0,0,0,0,300028179,0,
+    0,0,105689219,0,0,0,303964307,0,
+    0,406298787,0,0,323346595,0,365301891,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,402256083,0,
+    0,0,0,249680003,0,0,0,0,
+    0,60530931,278585651,389546211,0,208244947,0,41697459,
+    0,0,0,0,443211987,0,0,0,
+    0,17559825,0,0,55857235,103698755,294277203,346407187,
+    52682851,172179795,0,0,0,0,0,3453075,
+    327364707,436215987,0,62251221,0,388796611,98222179,0,
+    0,0,0,0,7139443,41894067,0,0,
+    0,0,0,0,0,0,0,106102899,
+    391053523,301023523,0,449134803,0,82034771,270626915,0,
+    129122451,193134915,268648625,0,330314355,239665251,248582259,0,
+    58622243,90566851,0,0,458662147,0,0,0,
+    52363331,457388163,73163091,0,0,0,0,0,
+    159371411,0,380526915,0,82546787,59257011,0,0,
+    0,0,0,0,245768435,105640113,302358723,0,
+    0,0,0,0,0,67416147,0,56537315,
+    279286017,0,0,237043875,0,99549509,0,341405827,
+    0,294752355,170893459,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    467845363,0,0,0,0,95613091,0,0,
+    0,0,0,61984931,0,0,0,0,
+    0,0,0,178819395,0,305406099,0,3076195,
+    0,0,0,188326035,208302355,0,0,417346065,
+    0,0,0,0,0,0,55459923,36737123,
+    458547379,0,458338595,391327907,0,0,363651235,0,
+    0,218435667,0,0,0,0,384573715,0,
+    0,0,436797651,0,0,0,0,349876419,
+    114942035,0,0,185811075,371646723,0,11141251,0,
+    47898851,282464435,0,0,0,167850115,322412787,0,
+    0,0,0,392839443,0,0,0,0,
+    0,0,343392499,0,0,295583843,0,0,
+    0,0,0,0,186212627,0,0,0,
+    137072739,0,0,342552867,0,12960003,47399203,107237491,
+    403845443,0,0,0,246702435,0,0,0,
+    0,0,0,134537315,0,0,0,0,
+    0,0,261951827,0,0,0,0,0,
+    0,69967907,0,0,0,0,281198819,0,
+    0,0,0,387457315,70082595,0,0,366858627,
+    296988771,0,0,206373123,0,0,147312883,0,
+    0,0,0,0,0,0,210354371,0,
+    0,0,0,0,322630067,0,0,0,
+    0,0,0,0,0,0,61309139,0,
+    0,431489251,0,0,84160739,168673395,297619555,402100419,
+    0,0,0,0,282271843,0,0,0,
+    0,0,0,0,132255795,0,0,0,
+    0,0,0,0,126238931,432873667,0,0,
+    0,82509955,0,0,0,0,67240019,0,
+    0,0,0,324509875,0,0,0,0,
+    0,391934131,0,0,95326307,298537059,0,0,
+    325935267,0,0,70066275,364474499,12357779,39637091,0,
+    0,0,101675123,364941443,0,0,0,0,
+    0,0,0,0,20762659,0,0,0,
+    150331779,259014867,0,0,433922227,0,31793395,0,
+    0,0,448078131,0,0,309731491,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,81457267,165073059,487620755,0,0,336543875,
+    0,0,0,0,0,0,0,0,
+    0,0,0,356155667,0,134852707,0,24383587,
+    126697539,436752547,0,0,247853331,0,176992531,0,
+    0,0,118907059,0,15564883,0,0,0,
+    236142659,227139667,0,0,0,0,0,0,
+    0,0,0,0,8712547,61440099,304410883,0,
+    25735283,0,182980995,0,0,0,0,0,
+    0,0,0,326762595,0,0,0,0,
+    0,0,0,0,0,0,79413395,374497459,
+    322326627,321085571,0,110113011,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    81416339,488685667,0,0,135168099,0,167326003,46981219,
+    415600899,0,0,128958595,0,0,0,0,
+    0,147546401,213639459,0,0,81883235,41205939,67948627,
+    103612515,139100291,0,370077843,88125683,0,45433011,0,
+    22016179,0,32198851,0,318292083,481861827,0,0,
+    0,0,0,0,0,135139427,0,11997283,
+    0,0,361320609,125276211,0,0,43540803,0,
+    323174563,0,0,0,463327443,0,367300771,0,
+    0,0,0,0,0,448282963,0,0,
+    0,76636275,417788467,450261187,0,20205875,0,157319427,
+    0,0,326602899,137310291,200155267,0,0,219836563,
+    129409187,0,264073331,0,0,297590883,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,226345123,216740019,
+    0,302661843,0,0,0,0,0,0,
+    0,0,0,0,0,0,265183491,0,
+    0,0,0,420921619,0,0,281952435,0,
+    0,95154275,474005747,0,0,0,0,0,
+    0,0,207585507,0,240496739,264614099,463724931,0,
+    0,399073475,0,0,0,0,0,487288979,
+    0,0,0,0,0,0,180945091,210235555,
+    0,0,257863923,121516323,227434659,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,359329907,0,
+    0,383611027,0,236683411,0,0,0,0,
+    0,0,482128211,0,459526387,0,109318403,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,112885811,
+    0,0,0,0,0,0,0,0,
+    0,140406979,0,0,0,254611603,0,0,
+    0,0,455299459,257433923,0,0,71585891,0,
+    0,0,0,0,0,249770179,0,0,
+    0,0,0,420876451,0,272031843,113209539,0,
+    0,0,35479811,402772131,0,0,0,0,
+    0,0,0,0,0,0,0,72376355,
+    0,42758195,271085667,112406643,339120323,0,0,0,
+    0,295841891,0,0,368525427,305229971,0,0,
+    0,0,0,0,0,0,351940883,0,
+    0,0,0,0,0,391528531,0,0,
+    413708403,0,0,0,0,145141971,0,0,
+    389226835,0,0,43626659,45740259,293212371,0,0,
+    0,0,0,0,88698963,200368291,448741635,182071395,
+    0,0,0,0,0,0,0,0,
+    0,0,0,384819411,0,0,0,0,
+    0,77738243,0,0,0,277815603,0,304935267,
+    453267651,0,0,0,0,0,134967395,237592723,
+    0,0,0,0,0,100032611,371097699,0,
+    0,0,0,0,438751571,0,0,0,
+    0,0,0,0,0,36782115,0,0,
+    0,0,488919235,0,0,0,0,0,
+    0,0,0,0,371183875,0,0,0,
+    130347155,0,0,0,0,0,80851043,125767779,
+    0,157130931,475414595,0,0,0,0,0,
+    0,0,0,0,0,265044227,456536259,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,339218515,239493219,
+    368943505,0,0,0,225132755,63156451,362311811,0,
+    0,0,41599155,273010803,0,469852355,0,0,
+    0,221626515,418988401,0,0,0,0,0,
+    0,0,0,0,0,0,0,402223219,
+    0,0,0,168837235,0,0,0,0,
+    0,0,305975555,0,0,0,0,0,
+    0,0,0,0,0,0,0,481050723,
+    197660883,4956307,0,0,0,0,0,0,
+    72204323,0,0,0,0,0,345219347,0,
+    0,0,0,0,152944883,0,37367907,0,
+    0,0,0,464974147,0,334164595,159862947,407089283,
+    0,38789299,132399331,0,219725907,0,0,0,
+    43892963,0,0,0,457920691,433791203,0,0,
+    305582339,0,0,0,0,0,0,8314915,
+    252305491,0,0,0,350802051,289255699,0,0,
+    0,0,4051027,70254627,343064707,0,0,0,
+    0,0,0,0,194097459,274268259,85680483,0,
+    0,0,0,366780709,173547827,414244947,0,86421843,
+    266899555,0,0,0,0,0,0,352887027,
+    294424659,0,252969203,0,0,38240435,0,0,
+    0,0,0,205103347,0,0,229617923,0,
+    0,0,0,0,67117139,470302995,0,0,
+    38985955,324345955,0,0,0,0,0,0,
+    0,0,0,255897763,449007859,0,268263667,0,
+    0,0,72675427,140222499,0,222277763,0,0,
+    0,0,122970435,0,138170611,0,0,0,
+    0,0,0,0,348324003,151175475,426356931,0,
+    23437427,201830515,383414387,0,0,486555795,0,225718371,
+    0,0,0,0,318460035,283996419,0,0,
+    0,467489059,120086707,0,0,0,0,0,
+    275530051,0,353685827,0,86356211,389669203,0,0,
+    0,56598771,93233203,0,208441571,0,0,0,
+    434204835,0,88088707,486834323,229486707,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,365232387,394244451,0,0,0,188285075,
+    91767027,0,0,258072835,0,0,0,102547539,
+    64364611,0,385306819,0,137359491,312307923,341524739,187875475,
+    128426067,0,67166291,237785235,117973171,290431203,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,136613987,0,0,0,0,
+    0,113578227,192852307,434975107,77520979,21164131,69894243,118759603,
+    52130051,0,0,0,0,0,0,0,
+    0,0,29909123,77070579,238391443,465547427,0,0,
+    0,0,0,0,464359747,0,438309075,317649139,
+    0,24412259,0,0,363298947,0,365158595,0,
+    51429651,0,173461827,0,0,0,0,0,
+    0,0,425918627,0,0,0,0,0,
+    0,0,397394195,0,0,0,166498403,0,
+    350949587,0,0,106942787,241959219,391983427,0,0,
+    0,11399315,59588915,0,0,56860961,0,0,
+    0,0,0,0,131887395,0,0,219197555,
+    440500467,0,0,0,0,0,0,0,
+    0,0,477462627,0,0,162242627,193011923,313540915,
+    64286883,325898371,388354323,0,0,0,417182257,0,
+    381808819,0,0,0,0,278409363,443584739,140197971,
+    473059635,0,359612643,364531955,0,0,129695891,442441955,
+    0,162304323,0,0,0,53936211,421679347,0,
+    0,0,0,0,62898419,435732707,0,0,
+    0,166158643,0,0,0,0,228884739,231047427,
+    410865795,149549411,0,0,27418819,0,0,0,
+    0,0,0,49725699,179609875,0,108933377,0,
+    0,399626373,0,0,89948323,0,295182435,419746003,
+    0,0,231575667,0,296673379,0,0,0,
+    388931715,0,0,0,291356947,0,0,0,
+    0,0,0,444293475,0,0,0,181899537,
+    0,0,0,136814691,0,130523171,168050803,453587139,
+    0,76152995,392216835,314413459,0,0,32821475,0,
+    0,0,0,0,145670211,0,0,0,
+    23617827,0,163664083,230646003,0,142004291,0,0,
+    214704259,166002963,0,0,0,0,0,0,
+    0,0,0,0,0,390250835,393089347,46637315,
+    0,161415475,0,0,0,0,399786291,474751075,
+    0,0,269750371,0,10854547,0,0,66572371,
+    335110673,228057235,346742931,0,434688145,0,0,0,
+    87711811,410091571,156905667,124453187,0,0,0,0,
+    0,0,148931027,0,263352451,0,0,0,
+    0,0,0,0,0,0,70295651,0,
+    328987043,431116515,0,56992019,0,0,20148323,77713491,
+    0,0,0,400109843,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    123351315,369168579,0,0,0,373584115,0,0,
+    430866739,0,0,0,0,0,291074339,0,
+    372859203,0,0,0,0,0,0,0,
+    137441395,0,416363123,0,0,248856787,0,0,
+    314097843,364867859,359231731,0,0,0,0,0,
+    480301219,0,0,250335491,0,0,0,259616867,
+    214389043,0,0,0,0,0,0,0,
+    0,0,131301475,0,0,42872915,0,0,
+    69836899,0,187752595,0,0,0,0,0,
+    0,420692067,0,0,300523747,301162739,462926083,0,
+    0,393674947,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,117358867,409596259,0,0,320381091,0,0,
+    0,0,0,71114787,336900371,0,0,0,
+    0,0,0,0,0,0,0,226586675,
+    0,0,0,0,0,0,0,0,
+    0,300388499,0,0,0,403931427,0,0,
+    0,0,0,0,0,150434195,48787715,0,
+    0,0,309240003,345387235,0,0,0,319869091,
+    0,0,0,0,268959891,0,19890243,170598499,
+    80679187,0,0,0,0,304025761,96202851,0,
+    175108403,0,0,0,0,153526611,273580259,0,
+    354357555,0,0,0,0,432365811,43839555,137101411,
+    255336531,360230995,0,0,0,0,0,0,
+    163721491,81911923,0,0,33173731,0,0,0,
+    224370867,0,216097027,0,45178963,0,0,0,
+    395370819,0,0,0,0,0,0,287359235,
+    0,73752965,0,0,0,0,0,0,
+    0,0,0,0,0,0,478879843,0,
+    0,0,0,0,0,0,0,408129811,
+    0,0,0,245567715,0,141648163,0,452669715,
+    0,73322771,305774787,466784547,37650611,369492163,0,0,
+    0,30093491,0,0,0,0,0,0,
+    360513683,0,0,0,0,0,0,0,
+    264171827,0,201191539,394039683,313622771,70541347,0,126140627,
+    0,0,0,0,225189987,0,0,0,
+    156086451,42041523,226771027,284217651,43860083,98336867,0,26640435,
+    0,0,119840947,0,0,195088547,253243683,0,
+    0,0,0,0,0,0,0,286195795,
+    0,135454819,55300227,75456627,0,317370451,340598947,412594435,
+    0,0,13996211,221872275,0,30216323,0,381407507,
+    0,0,0,0,0,0,0,164434019,
+    0,320655459,0,0,388555011,0,0,0,
+    0,188629139,306843795,0,0,0,0,0,
+    0,224755875,55550099,163037267,0,160534787,0,0,
+    0,66597043,130941011,28926195,262812035,341377123,438247651,361238753,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,477519971,0,0,29598003,
+    241012835,46911571,115736691,0,0,0,0,0,
+    0,0,0,109695203,67092563,405577859,335524259,0,
+    364579,0,57573571,116855075,138788947,265806115,430780563,0,
+    0,0,286589123,0,0,0,214003987,52871219,
+    107647171,0,0,72044643,375546003,458027203,0,331825747,
+    0,0,425492579,0,235249779,450105619,0,0,
+    414097555,431604035,0,0,0,0,0,0,
+    0,0,0,65118371,66424915,263745651,391372915,0,
+    0,332497331,0,0,0,0,0,36286787,
+    0,0,0,0,0,0,0,0,
+    0,0,0,397635923,0,0,0,0,
+    0,0,0,0,0,0,0,7946339,
+    0,0,0,0,0,0,0,0,
+    27177043,0,0,0,0,0,398401843,0,
+    0,13963571,227840131,89153635,19845283,143167603,35311891,0,
+    0,0,250851667,0,0,0,0,0,
+    0,0,0,0,2773123,227373283,135598179,0,
+    15548467,0,0,0,0,251740339,77901987,0,
+    0,115306563,0,0,0,0,0,0,
+    0,89628723,0,0,0,168018035,303857811,488439955,
+    0,0,0,0,0,325636195,0,0,
+    0,0,348479571,324853987,60940515,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,273277187,0,157974659,472862915,264745235,201572659,0,
+    33046675,0,215548019,0,0,0,0,0,
+    0,0,0,323498067,0,0,0,0,
+    98308195,0,0,0,234135651,411025587,155734211,0,
+    0,53616723,113447155,363176307,0,0,0,12120275,
+    76771411,0,0,0,0,0,0,0,
+    0,466071763,0,0,0,0,0,18391187,
+    431690051,14045411,268697843,34816209,0,0,101347507,0,
+    0,137715907,0,271315043,0,0,252387571,0,
+    0,0,0,111358051,0,0,0,202752291,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,432677107,0,0,
+    0,233070867,29823027,0,0,0,314998977,0,
+    0,355623267,161677459,268800179,0,97763427,0,0,
+    1486883,0,0,425107571,0,0,0,318533779,
+    0,0,0,46133411,53256339,252870739,348110947,75161715,
+    386228403,0,0,144347267,0,0,37425251,399708451,
+    0,0,0,223141971,0,0,438067507,0,
+    0,0,0,0,0,24727667,0,0,
+    0,320712803,319390019,334946883,322863395,110932083,406073475,0,
+    0,0,204108099,95297635,0,0,0,64655667,
+    0,0,300167475,194240787,0,0,0,394875043,
+    0,0,162894099,0,45965443,0,0,24232273,
+    0,0,268849395,0,0,0,142680323,112283763,
+    0,0,0,0,66658339,0,0,485474451,
+    0,23695491,0,228794515,0,0,275296515,0,
+    0,0,0,0,0,0,0,325034067,
+    131965027,282415283,372289875,0,0,395538771,0,0,
+    0,478216387,333505121,181616963,0,178192499,0,0,
+    0,0,0,187547795,0,0,162103443,0,
+    0,33099811,0,0,0,0,0,385855683,
+    44319043,370766067,114364515,386007139,0,212799731,401776691,0,
+    0,0,0,0,0,0,0,0,
+    390840595,485322899,0,217534691,333992595,0,0,84000979,
+    0,324915331,0,0,0,11583619,320426195,0,
+    0,0,0,0,0,213221651,0,0,
+    0,0,0,0,0,42287283,0,0,
+    0,48722163,0,0,0,0,0,2388083,
+    0,0,0,384876643,455487635,0,217948275,387059907,
+    0,0,0,0,0,0,237187251,0,
+    37339235,0,0,0,0,301547619,46055523,0,
+    0,0,238473507,263524563,53690451,0,0,0,
+    0,0,0,0,0,182370755,240066659,0,
+    0,0,37081187,0,0,0,0,0,
+    0,35283043,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,349044963,347447523,426131699,0,0,
+    0,0,0,0,0,0,64221425,311128163,
+    0,405311747,0,115327235,0,0,382931235,167919731,
+    16654899,429380323,71356515,0,0,0,471535923,0,
+    0,0,0,0,0,0,0,209506563,
+    0,481247395,0,0,0,0,0,0,
+    0,0,0,248279235,0,0,71012451,0,
+    236343507,248713331,414470355,414568547,0,0,72474723,0,
+    0,0,0,0,0,476364963,0,0,
+    0,0,0,226836627,0,0,0,0,
+    0,0,0,0,0,100298979,0,0,
+    0,378425667,0,0,0,476909731,0,453640387,
+    0,0,0,0,0,0,0,56938691,
+    0,0,20554003,83169489,315936867,373022899,0,0,
+    0,0,0,0,361419027,0,112242835,278925685,
+    0,0,311906499,0,0,169001075,0,0,
+    0,0,0,0,0,51654707,0,0,
+    0,0,315965603,321683587,465203379,486121619,0,0,
+    0,0,0,0,0,0,0,60780883,
+    0,0,335262225,0,0,0,0,422764721,
+    0,0,0,227250323,0,0,0,21192947,
+    454594787,0,19988579,0,0,0,0,0,
+    0,0,0,11821299,87261363,359575683,0,0,
+    0,0,0,0,0,0,0,382480547,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,383582307,
+    309182675,114557331,0,397553971,101208163,198766947,349434051,0,
+    0,240525411,283914419,0,0,222838867,0,0,
+    0,0,0,144830771,0,0,0,70025251,
+    0,0,0,0,0,177447075,253616275,479260947,
+    0,0,178090099,0,0,93171939,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,132972707,0,0,0,0,0,
+    0,0,0,238207219,0,0,0,0,
+    0,0,417485395,0,0,0,0,0,
+    0,0,229716323,236400867,0,0,0,0,
+    0,0,0,0,315326691,134164579,0,399188019,
+    180916323,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,252526627,0,0,213717283,285003939,
+    0,0,39534835,0,0,0,0,233001219,
+    0,0,0,0,0,0,0,220438675,
+    227643523,0,220233875,0,61616227,416018627,0,0,
+    0,108306531,0,0,326860883,0,221134995,343646291,
+    0,0,0,0,455143619,0,0,3104931,
+    6828131,136040547,188711059,262259043,197120243,481022051,0,0,
+    0,0,0,0,0,128188483,353804483,0,
+    207855859,0,265986387,0,152379667,81395779,257208435,7172211,
+    294129747,0,0,0,225992899,0,455799075,0,
+    0,0,0,0,47558963,0,0,31125667,
+    431018355,0,0,0,0,0,0,0,
+    0,65503395,471117939,0,0,0,0,0,
+    0,277766323,0,0,0,0,93327539,0,
+    0,0,0,0,0,0,0,204869859,
+    0,442302643,221053075,123425123,264421667,347021411,316276851,64082017,
+    465338547,0,353231123,0,0,0,0,166408243,
+    0,0,297132131,0,0,447729907,0,0,
+    0,124342419,308781139,320483459,0,49160435,175780163,0,
+    0,0,0,136958051,0,0,0,370692227,
+    131530851,0,0,0,0,18567251,0,0,
+    0,0,0,0,0,167534771,414773379,350294211,
+    0,75554931,0,0,0,0,288903395,70324323,
+    368611475,411701347,0,119054515,0,0,0,0,
+    0,0,0,0,0,0,0,8987043,
+    149643699,0,0,0,0,367145155,0,101433555,
+    0,0,0,0,0,105062627,101265523,0,
+    0,0,0,0,0,0,0,144642275,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,239022323,0,466538547,
+    0,0,56467715,0,0,0,0,83869795,
+    332124707,300838995,432615651,484507795,0,0,0,225849555,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,71327843,0,0,
+    0,0,0,0,127201571,0,0,209875139,
+    0,440426771,31309971,0,0,0,0,0,
+    0,0,0,155590771,0,0,0,77344867,
+    90403091,186429539,129970371,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,403079315,0,0,0,0,0,0,
+    418513443,0,432463939,0,0,0,0,219467907,
+    409055379,0,0,417657329,0,0,0,0,
+    404852835,414359667,0,0,135340131,223973539,0,0,
+    206090323,0,212865219,419283043,0,0,0,0,
+    0,71372835,0,0,60707091,410321297,0,0,
+    11026659,0,0,0,34082931,206508243,104026387,0,
+    0,0,0,0,0,0,0,0,
+    136757347,318574883,0,0,0,0,0,0,
+    0,0,0,210891107,0,99733747,310591683,96260195,
+    0,0,0,96059491,34025683,127135987,148082883,110801011,
+    308408547,112439555,170061923,71442531,308944947,0,414392515,131662019,
+    404598979,449958147,0,139186291,0,0,0,0,
+    0,449450163,0,0,195023091,0,0,0,
+    0,440959219,0,345059523,0,0,0,0,
+    318185667,80122099,465686787,0,0,0,0,37957811,
+    0,0,0,0,3666003,22237459,82342003,0,
+    0,0,199966995,418079267,0,0,0,0,
+    0,0,0,0,304005363,85614833,347832515,360665267,
+    0,0,175034643,0,0,182309027,0,0,
+    0,0,436912483,0,0,0,0,277225715,
+    0,321564739,285970547,341045459,71987299,33829107,275705955,0,
+    0,0,347775185,0,0,0,412860547,0,
+    129781939,194461891,0,0,430846019,0,0,0,
+    0,0,0,483405923,222986307,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,36049075,5845091,0,0,0,0,
+    0,0,0,0,284930323,0,98021475,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    139026563,24055891,141791443,296788067,335249987,369107171,335991011,379334931,
+    72904803,0,0,0,0,0,0,240926819,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,207081875,0,0,0,
+    0,132886675,230711523,0,0,0,0,0,
+    0,423211299,170004579,371839203,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,220082323,0,0,0,0,0,0,
+    345841987,119251123,475472163,0,0,6705315,0,0,
+    0,0,0,0,0,437231843,53727315,0,
+    163188963,0,0,0,98050147,0,0,0,
+    292528179,0,0,0,0,0,0,0,
+    0,0,0,0,115396739,0,0,0,
+    142749971,454938835,0,0,0,0,0,323153987,
+    0,0,0,0,17301651,0,90620099,0,
+    0,100532387,224419939,0,0,0,0,0,
+    0,0,95744099,279785571,254181475,0,72101987,0,
+    0,0,484323475,0,293474355,0,0,0,
+    0,0,385515635,0,0,0,414322819,0,
+    303124563,0,0,179896435,240554083,69537827,112714003,0,
+    24838323,0,0,0,0,96723043,85586275,229241109,
+    440353043,459956467,0,0,0,95354979,134279267,0,
+    0,0,0,0,0,0,0,313000083,
+    0,0,17813699,0,0,0,0,0,
+    0,0,0,0,70856739,0,0,0,
+    0,111501427,39718947,0,0,0,0,57159875,
+    0,0,204767411,0,0,0,0,228380867,
+    402727075,253583475,133382259,264253747,0,0,0,0,
+    228954195,0,353304883,0,17768609,191201507,0,0,
+    0,0,0,0,97820771,273178675,292602003,0,
+    0,454824195,0,66871491,0,100196627,0,120877107,
+    368111859,448020691,4530387,0,75100387,0,0,0,
+    0,68046931,9126195,142950563,0,0,0,0,
+    0,0,345735571,0,0,0,0,0,
+    0,0,377106675,0,0,0,0,0,
+    0,132272259,0,0,0,0,0,0,
+    6226003,0,0,0,0,115433731,401932419,0,
+    0,120185011,0,0,0,0,0,437006723,
+    0,0,0,0,341238035,0,452337907,0,
+    326209683,63864899,168444019,0,0,412295395,320770147,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,2580659,0,74293363,0,0,
+    314953827,0,0,0,0,2310369,0,183459955,
+    229687395,471617779,345448547,0,152535379,359825699,397140307,0,
+    0,0,6971523,0,0,0,0,0,
+    0,0,0,196473075,333320851,0,0,95211619,
+    0,0,0,0,186286179,17195171,263647347,0,
+    0,0,461426899,69853219,217596051,0,0,419258451,
+    182870131,0,0,0,0,0,0,179179811,
+    161001763,0,0,0,0,53837907,196858019,0,
+    0,0,71471203,294228051,0,0,0,320581907,
+    0,0,0,151404787,153010451,0,66768995,355545379,
+    0,200691875,340295857,0,0,0,0,0,
+    0,0,0,0,326164643,156037299,331670099,42225699,
+    440029523,0,0,316842099,288756003,407634163,340852979,0,
+    0,0,0,0,0,0,90743075,0,
+    154415155,0,0,0,385163475,0,442675475,298967139,
+    16990355,0,0,0,228835507,478961827,346824803,307459,
+    425607267,0,362131587,0,0,144703779,0,0,
+    0,0,0,0,1056803,0,20472115,0,
+    0,168378483,0,0,99238083,0,0,421572771,
+    118612147,0,68882547,0,0,0,0,476954771,
+    0,0,0,0,0,0,0,0,
+    0,0,0,185077923,0,0,0,414597267,
+    200470579,0,0,0,0,0,445776259,164548675,
+    0,0,0,185516275,298995811,118956211,315158771,0,
+    0,0,0,0,0,0,0,0,
+    222036035,0,0,0,0,0,120332467,0,
+    0,0,0,0,0,0,309137571,0,
+    0,0,0,0,0,0,286277907,312594499,
+    0,0,0,270110819,0,417501713,0,303243523,
+    160649459,0,0,374059091,0,0,0,0,
+    288571635,354844963,222499043,0,0,0,0,0,
+    100434179,0,486793363,0,0,0,125833491,298020963,
+    0,0,0,121594179,0,0,0,0,
+    0,185901139,458989843,0,0,3391523,0,0,
+    0,0,424046851,113938595,218828947,281342147,217718835,67391571,
+    0,0,367530083,0,487481555,251474019,0,0,
+    366432531,183017713,0,0,0,0,0,128008355,
+    0,127377507,0,0,0,0,0,366072131,
+    0,169947235,0,94724195,361930883,405213297,83124307,123125987,
+    394600707,0,288186595,139718899,273043635,293753075,0,0,
+    0,0,0,380829907,116297939,477585475,0,50958595,
+    109756595,246796563,325816499,222904499,21975187,0,0,0,
+    0,22982979,0,0,0,287957251,53366835,0,
+    0,405848243,0,0,0,0,190198083,0,
+    0,0,0,0,0,0,77135971,0,
+    0,0,283791475,0,0,0,439861587,0,
+    0,0,388710723,0,336162917,4378803,226242643,0,
+    0,109092931,394825909,207921331,0,0,0,342138947,
+    0,0,0,260727091,0,0,0,0,
+    0,0,0,0,0,0,29982867,8835267,
+    0,0,0,437858483,0,205168883,0,109199555,
+    0,0,178708897,168738931,183492755,444387667,0,0,
+    0,0,0,0,0,71041123,0,0,
+    0,442503347,201957635,130916435,0,0,0,0,
+    0,232608019,465936595,0,0,377532659,0,0,
+    0,0,0,0,0,0,823331,0,
+    259252387,0,0,0,0,0,270540899,120283315,
+    0,1560675,106234163,0,0,0,0,0,
+    0,0,0,0,0,0,0,290988355,
+    0,24441123,237105315,0,0,0,0,0,
+    38158451,0,0,55140435,0,0,68976755,81727683,
+    0,0,390635731,0,0,0,0,0,
+    0,0,0,0,0,0,0,298221667,
+    0,0,0,0,0,0,0,185192643,
+    5873715,331215395,0,0,302137587,0,143606067,0,
+    0,0,290005171,0,101490867,0,0,403239187,
+    0,0,0,0,0,349982931,45375699,326742083,
+    357810483,25247939,286040211,0,0,0,0,3842083,
+    0,406835427,0,0,0,37482595,0,0,
+    0,204271923,15945859,107794579,46936163,161755443,450883843,0,
+    312099011,0,0,0,21008611,0,0,0,
+    0,126296227,0,181092595,224145715,0,0,131760243,
+    425263203,153424259,341655763,323572115,0,334492227,0,0,
+    0,0,0,0,0,0,0,0,
+    344076387,0,0,0,0,0,240898147,294400083,
+    0,0,0,0,336343139,0,0,0,
+    167735395,230883507,0,0,0,0,0,0,
+    0,0,0,170316067,0,0,0,0,
+    0,275099891,0,138449059,0,0,0,0,
+    0,122511683,28991779,205885667,0,0,316923987,257241235,
+    0,343629875,234905683,0,0,480522403,0,0,
+    0,0,14258339,133513331,276390211,66310373,0,279728243,
+    0,0,0,0,0,0,0,0,
+    0,0,187834515,0,0,0,0,0,
+    71258147,0,0,441725267,67264611,339771715,0,0,
+    0,0,0,0,0,0,0,0,
+    71528547,0,0,136011875,0,0,0,0,
+    0,318496899,88772771,136241251,398614709,416219683,0,0,
+    0,0,431374771,0,0,0,0,134709347,
+    70799395,0,347299939,0,333677089,6316131,0,0,
+    233628019,217415795,0,0,0,0,261320963,0,
+    0,0,0,0,176431363,0,0,0,
+    0,0,49000675,0,112619667,0,27750611,0,
+    185782371,239390931,401416467,0,0,0,0,0,
+    86577395,406233203,0,464572691,0,0,0,190923075,
+    0,0,0,0,0,0,22876259,0,
+    0,108720211,0,0,0,0,0,0,
+    0,52752595,112128163,272920675,0,0,0,0,
+    0,0,0,0,383651939,0,10133747,28143795,
+    262516995,310501715,0,0,0,0,378683667,6058195,
+    157503619,0,0,0,222863507,386957395,0,0,
+    0,0,398995651,0,0,0,394338659,0,
+    0,326906003,0,0,0,0,0,0,
+    0,0,0,0,0,105627877,162263123,0,
+    0,0,0,241356979,61526179,389042515,0,0,
+    152305939,160829491,81944723,384647459,0,0,0,177291571,
+    227078211,266207379,438980851,0,0,0,0,0,
+    0,23765251,0,0,0,0,0,112971891,
+    0,0,0,53973075,232710291,342712483,0,0,
+    0,0,0,0,256626835,298823779,0,222437603,
+    488603795,0,0,0,0,0,277573731,471031891,
+    0,0,299344019,0,0,0,0,0,
+    321122483,0,395628867,248914019,0,0,0,0,
+    0,0,0,0,0,0,447230243,0,
+    177164595,0,0,317108435,0,199192915,0,0,
+    326791315,0,147698083,0,0,0,0,0,
+    0,0,0,226820147,0,305447155,484266083,0,
+    0,0,0,276300115,0,0,0,0,
+    0,0,101916707,0,119005363,0,338628707,0,
+    0,0,0,0,0,0,0,488243299,
+    443646131,0,0,339243171,0,0,110964851,299024483,
+    0,72446051,0,0,0,0,0,33624131,
+    0,0,0,0,0,0,197783907,0,
+    295956579,0,0,0,0,0,0,0,
+    0,0,0,1826947,3354707,439603603,0,0,
+    0,0,0,0,0,0,0,0,
+    0,49352883,214741203,0,0,0,136900707,0,
+    0,0,0,22065491,0,76087539,307802275,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,187588755,
+    0,0,360255715,226218067,485707923,0,0,106598595,
+    384790627,132800771,0,0,0,0,0,0,
+    0,44740883,0,0,0,0,157389043,0,
+    37396579,0,0,0,0,1519651,0,285085891,
+    69492835,471269523,0,37126179,0,0,0,0,
+    0,0,0,270884963,0,0,56238131,0,
+    82198611,0,391110819,424710499,0,0,0,135053411,
+    0,0,0,304705777,325124243,0,347750707,442396835,
+    0,0,0,255295635,0,187150483,0,0,
+    0,0,0,57127027,0,0,0,0,
+    0,0,0,0,0,0,311808195,0,
+    0,471167059,0,329691555,178725217,0,0,421642371,
+    0,0,0,172064979,0,287838403,0,0,
+    0,0,0,0,167886963,0,0,131858531,
+    432484467,0,210280643,0,82845763,127279203,85709041,0,
+    0,0,421118131,114966883,199434563,0,0,443170963,
+    0,0,0,0,6516819,41648307,126492899,0,
+    0,0,0,0,82866451,402387027,0,0,
+    0,0,344465715,0,82772099,307257475,0,0,
+    0,0,0,0,270368867,0,380244307,0,
+    352305443,0,0,259211411,354197795,18079939,0,8806707,
+    464257411,0,0,297390179,0,0,0,0,
+    0,0,0,0,150630707,0,323739731,0,
+    235311203,104993027,0,147214403,0,0,0,0,
+    66293811,123715875,0,79888627,0,0,0,0,
+    0,272232547,0,0,55103571,98697363,0,0,
+    0,0,0,0,38113315,357495059,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,318238915,0,0,0,142332179,0,
+    0,0,0,103002259,6750499,0,0,0,
+    0,0,2945203,320098387,44462275,0,0,0,
+    488644755,0,446283987,0,0,0,118218931,0,
+    0,0,0,0,193220883,295698531,0,372748579,
+    0,0,204648771,0,0,0,0,22155571,
+    416526963,456265939,19333251,0,0,0,0,314867811,
+    236765315,453042435,0,0,0,0,0,0,
+    0,0,0,0,0,0,206307571,292438099,
+    43020371,0,0,0,482435315,70238307,227610739,103452947,
+    26591411,189428067,41550003,335401427,468128051,297705571,315809955,431550659,
+    0,426603219,0,321839267,0,63615107,0,0,
+    10895507,101179491,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,28688563,
+    211628323,0,361840691,0,0,0,0,0,
+    179728675,0,0,0,0,0,192749955,0,
+    0,0,0,0,0,96231523,461812147,350171347,
+    0,0,420548835,0,0,67584083,0,17662289,
+    0,0,170807379,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,72130659,0,0,
+    0,3866659,0,0,0,0,0,186048595,
+    0,93929603,0,0,422424659,368840979,0,403681331,
+    0,0,0,0,0,111063171,257929459,0,
+    0,401576227,0,289030435,0,169787491,0,11968611,
+    0,0,0,0,0,0,0,0,
+    112660515,0,154538195,0,71413859,0,0,0,
+    0,0,0,0,0,0,39862515,0,
+    0,86712371,363696275,414298195,0,0,0,0,
+    0,0,0,364228867,0,0,45240451,0,
+    158986355,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,276934979,
+    0,181375267,0,0,0,0,0,0,
+    322039907,0,0,0,0,120824003,131080275,483877011,
+    0,0,0,0,106135747,422216003,0,0,
+    0,0,0,0,0,267178339,0,98107491,
+    477491411,0,0,0,308961459,0,435892419,466227427,
+    88584243,0,0,154595411,0,0,167157939,0,
+    0,0,0,0,0,0,0,0,
+    0,119890099,0,0,0,0,0,0,
+    0,0,0,0,0,115888339,0,0,
+    347713667,0,0,294924387,87732323,0,0,231334131,
+    0,0,389890323,0,0,0,0,0,
+    209039651,0,0,0,0,138727507,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,46706851,0,0,0,0,177066243,0,
+    0,342290771,0,0,0,0,0,0,
+    164110595,260481331,395321523,0,0,0,0,0,
+    242041155,0,0,0,0,271372387,145981651,0,
+    434024739,0,285204803,0,41746611,0,166453411,0,
+    0,0,0,128208995,119546035,0,0,209997907,
+    0,0,0,0,129552563,0,0,0,
+    240869475,0,0,336318547,0,0,40030307,3530787,
+    436703411,0,0,0,0,247095619,0,0,
+    0,0,133935203,0,331522611,0,0,0,
+    0,72331363,162173027,0,236642451,0,0,0,
+    0,0,72216675,0,0,0,0,0,
+    157180195,0,0,0,0,58384675,0,0,
+    272547939,0,0,0,0,0,0,340709635,
+    201863219,0,308895811,0,0,0,0,0,
+    350589155,406265971,0,0,0,0,0,65216675,
+    0,0,0,0,0,0,0,54403203,
+    0,0,0,0,67694675,0,0,117432691,
+    0,0,0,0,0,0,0,0,
+    0,0,329433651,480243923,0,0,0,352702835,
+    467271939,328610291,0,76669027,2810083,0,0,0,
+    0,180625683,31969395,0,0,0,0,0,
+    0,0,0,332755203,221175955,0,0,295555171,
+    0,0,0,433692755,346534067,0,212005171,0,
+    475869459,415310099,0,0,0,279552259,299544787,0,
+    0,410046691,0,0,0,388210947,0,0,
+    0,0,0,0,0,0,11661473,0,
+    3518547,0,218968131,0,0,0,0,0,
+    0,0,0,0,0,279842917,124264739,0,
+    0,0,0,0,305881299,0,0,0,
+    199282963,0,0,180154659,0,486248547,168771699,0,
+    138690643,0,0,0,85942403,0,304669059,0,
+    0,0,281759843,0,0,390938899,420049091,0,
+    0,0,0,0,0,0,202367299,367345843,
+    0,0,323080467,0,296444003,0,0,0,
+    373170371,0,249069715,0,0,0,365818067,0,
+    209858611,0,0,0,102408275,222691523,326537299,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,387178579,0,0,0,0,
+    146079811,0,0,0,267886771,319643859,0,0,
+    407986435,118317235,0,0,0,0,0,0,
+    0,342757667,0,221216915,9277603,0,162742579,0,
+    26722483,0,0,0,0,0,0,0,
+    65626387,0,0,0,0,0,0,168935539,
+    0,0,0,0,0,0,0,0,
+    0,108335523,312058003,405246195,0,77258915,0,468980019,
+    356483363,0,0,0,0,0,0,227049571,
+    0,0,0,53801043,0,0,0,0,
+    0,0,0,137552003,53153923,435945651,288686339,267272467,
+    73564533,92364947,220041363,290631891,343851091,474837187,0,0,
+    0,368914947,0,0,349106437,189346099,205234387,39206995,
+    0,188670099,0,0,0,0,0,55881875,
+    0,0,0,456810675,0,0,2871571,247980243,
+    476864675,387375411,89587859,66547795,36868131,126767203,158793923,484950115,
+    0,80433379,115945667,309829715,228434083,269320291,101298355,282693971,
+    0,0,0,0,54194259,0,69406819,0,
+    89805011,166076723,0,66609283,240668771,374182051,36794467,169513107,
+    42844259,46239859,306909267,370581635,375091427,424325427,346607779,0,
+    0,0,167022931,248615027,104046785,0,0,0,
+    0,0,0,25301203,161927251,0,0,0,
+    0,0,0,0,0,0,403488851,465756435,
+    0,235282531,146772099,0,0,11292899,32252099,39391315,
+    71184483,0,0,0,0,0,0,0,
+    206115011,0,140624035,0,0,0,0,0,
+    0,291430659,0,0,0,0,0,296960099,
+    0,0,0,62361833,0,0,30765187,0,
+    54550611,0,0,295927907,300429475,0,0,0,
+    0,0,0,0,0,137130227,0,0,
+    0,163369235,268185683,365605043,421777635,259793107,0,0,
+    0,0,0,0,304349411,0,0,238022803,
+    0,184676403,0,126718035,0,0,0,379003203,
+    0,0,0,0,0,251502803,220205155,0,
+    0,0,241127523,57237571,127082691,0,0,0,
+    0,52457651,0,0,0,0,0,0,
+    0,272146531,298106979,411918403,480567427,0,129601715,346018131,
+    0,299434131,485585043,0,0,0,0,71000099,
+    484073619,212238629,0,487207059,0,0,411848883,358732099,
+    0,0,402436179,125042931,274960643,0,0,0,
+    327549187,0,381640995,0,301748531,108859507,131330147,0,
+    0,0,0,0,423993411,0,0,0,
+    246870227,0,32899331,0,0,0,20033571,0,
+    0,419672115,78295171,0,273997923,161743203,0,198017347,
+    367513651,0,0,54992979,104906961,252154083,378511683,108675235,
+    398762147,137015395,383463507,235975075,12398675,0,0,0,
+    213496067,0,0,404775203,62656803,0,0,320266467,
+    0,0,0,0,380334307,3305555,0,0,
+    0,0,0,0,0,25665715,68808979,0,
+    0,0,83644547,0,0,0,0,186532051,
+    342835619,0,0,7585923,0,0,0,133480563,
+    75194595,0,0,0,305701043,0,0,398663859,
+    0,0,240267363,0,0,0,0,0,
+    0,0,0,250061059,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,92930307,0,45678819,35037267,317522083,250232963,
+    327889043,432787635,0,0,0,0,0,0,
+    290783283,0,0,178491555,99016803,0,4849843,0,
+    0,366350419,243233139,274874691,445386995,0,0,0,
+    0,282071219,293363859,366018755,0,0,0,0,
+    22565027,70611043,0,0,0,0,32477427,139997443,
+    486191203,305938563,367849667,400183571,0,0,0,0,
+    0,0,0,39506019,0,0,424964195,0,
+    0,0,0,0,91906225,0,172851411,0,
+    111738979,276038003,0,0,0,0,485626003,0,
+    0,0,0,0,363802931,0,103911555,340533491,
+    0,0,0,0,0,412139635,0,0,
+    0,0,0,0,146063411,0,0,54231123,
+    465994019,425320547,0,0,0,314347635,0,0,
+    0,236920899,0,0,0,420004003,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,7307347,0,128450755,0,0,
+    0,321884339,0,0,0,0,0,65048643,
+    0,0,0,0,0,0,0,10477875,
+    168181875,0,0,0,0,137769059,0,307130515,
+    0,0,0,402362451,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    382857491,0,0,0,0,34115747,0,0,
+    139427971,0,0,0,0,55972051,0,0,
+    0,0,0,109113475,167407923,0,0,0,
+    411513011,0,0,0,0,219877523,0,0,
+    0,0,0,0,0,0,172564723,354607395,
+    374030435,0,394670291,476410051,0,0,0,0,
+    0,0,0,0,0,0,84123779,0,
+    457031907,0,221503635,48177203,0,0,0,352014419,
+    0,187109523,168312947,295125091,0,212549923,0,0,
+    0,0,154018083,0,0,0,0,0,
+    0,0,0,228200595,0,0,368787651,0,
+    0,0,0,450314387,419131761,0,0,0,
+    0,0,0,0,483664019,0,0,135626851,
+    0,0,0,0,0,0,93114579,0,
+    0,0,0,0,0,0,0,74113123,
+    0,0,285290851,105980243,0,286908675,8069363,0,
+    421527715,0,252502099,0,0,23191667,0,0,
+    0,0,208982227,0,280186979,0,0,0,
+    341770499,64454899,0,422621331,0,0,3878995,132477027,
+    147005587,0,481665267,0,454521107,0,360554675,67067987,
+    0,0,131129443,303042643,313516115,0,0,0,
+    0,0,159555779,0,239087923,0,156221635,0,
+    0,0,0,106774595,0,93454611,0,131244131,
+    214519987,0,70553699,188366947,0,0,0,0,
+    0,0,0,0,0,0,0,279413011,
+    96579683,271544419,0,0,298049635,0,0,130650275,
+    0,132870195,122425667,286769443,294781027,0,0,0,
+    0,67342419,0,0,0,0,93732915,202559699,
+    302301395,482713955,425783475,486051987,473305331,0,200413395,94654723,
+    0,0,0,374292675,0,0,0,0,
+    0,0,0,0,393474131,97849443,0,0,
+    0,5931123,0,373526739,15249651,402313299,0,0,
+    0,0,179712051,0,0,0,0,0,
+    0,0,0,131993667,0,0,0,0,
+    64331971,21766339,488743059,1790083,0,0,38690995,0,
+    0,71499875,297246819,0,0,0,0,0,
+    0,0,95125603,0,30425443,0,0,0,
+    0,162201747,0,119398579,386486403,0,0,0,
+    0,0,0,0,386592867,0,0,4173907,
+    0,0,384393459,0,0,0,0,0,
+    415420611,0,0,0,0,0,83308819,228479171,
+    422166611,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,136298595,201121859,
+    258420979,1114147,326287667,0,0,0,0,0,
+    0,0,0,0,0,0,272289891,325665059,
+    0,470974611,0,0,0,0,0,0,
+    0,0,0,187191443,0,0,6471843,234647667,
+    0,0,0,296243299,45629619,0,102342899,0,
+    479916291,0,0,0,5951523,0,0,478167219,
+    0,0,0,0,216428643,342237379,0,0,
+    0,24760403,0,0,244482243,0,0,0,
+    0,445665699,223850547,0,0,327028787,485941347,0,
+    0,92614723,0,0,274550851,384082101,66936931,481796339,
+    0,0,0,67731491,0,0,0,0,
+    0,0,0,488214627,0,0,0,0,
+    272805987,0,0,0,114528355,0,425578595,0,
+    0,0,0,0,0,0,0,0,
+    0,185581619,125579459,0,30179459,261615923,0,0,
+    0,0,0,120541379,0,0,0,0,
+    83710067,357159203,0,0,19726547,0,0,460087539,
+    0,443867299,266543475,132505795,251646115,336580835,0,0,
+    0,0,0,421937251,0,0,62423289,0,
+    0,0,47145221,0,286220387,425082963,0,0,
+    0,42971313,0,0,0,167985267,186671251,98279523,
+    0,0,0,0,0,0,446005555,142995715,
+    450515171,0,0,71700579,4415523,0,0,0,
+    0,0,0,0,0,0,0,326455443,
+    405438675,105484579,0,0,0,0,0,317079651,
+    320073811,0,484769939,0,281837747,341901491,0,0,
+    0,92110995,197632099,0,277127539,0,143327443,0,
+    0,66326689,0,0,0,0,237355203,0,
+    0,137228323,70926435,89993365,278868179,0,0,173027651,
+    0,0,0,0,0,0,0,0,
+    0,0,0,224018499,32653427,271257699,371011731,0,
+    0,97878115,0,0,0,0,0,0,
+    464507123,310837347,0,37908659,0,0,0,201441459,
+    0,0,0,95527011,409301251,0,0,0,
+    223006835,0,0,0,0,0,0,23273587,
+    0,0,0,0,124739795,0,0,0,
+    0,0,72146979,0,0,0,0,0,
+    435188147,0,0,475119827,88817859,0,0,0,
+    0,477159619,0,0,0,0,0,90165475,
+    0,434409571,0,0,0,21725539,0,0,
+    0,69464163,61776003,403120291,0,0,297447523,134479971,
+    0,324739203,444002563,357400931,0,0,0,0,
+    0,0,0,0,112017587,0,0,126197907,
+    96923747,0,219554083,327045267,0,187711635,0,0,
+    0,0,0,54587475,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,96522339,0,0,225775891,0,0,0,
+    0,0,0,0,263680115,0,0,85979379,
+    334999921,421322835,0,325058707,0,236875937,0,85094451,
+    284164291,0,379253043,0,0,0,0,422899795,
+    54378579,0,71344163,0,0,0,0,0,
+    0,0,0,237670483,0,0,271143011,0,
+    0,135798883,0,98910355,92565603,0,0,0,
+    29151539,0,0,0,3428435,0,0,0,
+    0,87875827,0,0,0,0,0,0,
+    0,0,44052579,0,0,0,0,128405571,
+    22761507,0,27877555,243532051,0,0,0,0,
+    0,0,250130819,0,313757827,0,0,201797747,
+    0,204816451,50671683,0,232276275,0,0,24006739,
+    0,159215923,0,0,0,0,0,0,
+    284741971,0,0,0,0,0,20193315,270397539,
+    0,0,0,0,68120659,105951331,201007315,206442739,
+    302284851,0,0,0,32796755,0,0,52199667,
+    0,0,0,0,46751875,0,0,0,
+    97640547,0,0,0,202678547,347050131,223821923,248877187,
+    0,0,0,0,0,178536675,0,0,
+    0,0,0,282783781,104894723,159187043,0,271888483,
+    0,0,0,0,8650979,0,0,214077699,
+    0,0,0,392343811,0,0,0,0,
+    480604323,360431779,145993889,0,0,0,0,0,
+    0,0,0,0,0,0,0,246026531,
+    0,309399699,0,0,0,0,0,0,
+    0,0,263843955,329929123,0,0,0,20647971,
+    0,0,0,95772771,155099235,71028771,134508643,0,
+    0,256708867,0,0,0,0,0,0,
+    0,0,0,0,0,222744771,0,0,
+    0,0,0,0,0,0,363151443,0,
+    248942659,283127955,255033523,102793507,0,0,0,0,
+    7204979,0,483946643,0,0,0,0,460595491,
+    0,216813715,252952627,394432659,66273411,404033715,291860563,0,
+    0,0,0,69550179,0,0,0,311103571,
+    407273747,0,0,0,0,0,0,0,
+    0,0,0,0,134623331,0,177373459,0,
+    0,0,248193075,180773091,226906211,160329939,259703059,83742819,
+    64061617,378278163,0,0,0,0,0,370884771,
+    400720147,0,0,0,0,0,286564435,325599363,
+    0,323985763,124002627,353460531,0,0,0,0,
+    124219555,307650723,0,72994947,231465107,0,0,0,
+    74674419,487538835,182702371,0,91230419,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,249253939,228671635,0,0,
+    0,0,106795267,280563843,0,368218227,0,299511923,
+    308207987,0,0,415789283,0,0,0,241098851,
+    0,0,416236001,194023699,0,0,0,448868595,
+    20742259,252649555,165572835,0,0,269262947,54267987,370618499,
+    391774371,0,226992227,114741393,0,41943219,89018627,426019,
+    0,139112531,237645907,263581811,0,0,0,0,
+    0,87105731,0,0,0,406761747,0,0,
+    54956115,0,0,0,0,0,393539667,0,
+    0,0,0,410566915,39993587,0,0,0,
+    434315315,0,170565747,0,0,193814771,0,0,
+    0,53108899,382009539,22528131,464847331,338104675,0,477442115,
+    134066211,0,0,0,0,0,0,0,
+    0,0,0,0,0,483365011,0,0,
+    0,0,28872899,0,0,0,0,0,
+    314724451,0,0,0,0,0,24215955,0,
+    0,0,0,0,0,0,266412131,0,
+    0,0,77041763,3829843,0,0,0,0,
+    0,22491267,0,0,241291507,0,0,0,
+    0,47833331,47009875,0,0,0,0,386539667,
+    246218979,406946017,227876931,202830051,0,0,0,0,
+    0,0,310788275,298766435,0,0,0,0,
+    111243347,283197491,0,0,346480835,0,0,245485875,
+    0,0,0,0,0,0,0,462995667,
+    0,0,203170003,0,484421731,0,96952419,270942307,
+    342479123,0,0,0,0,0,0,0,
+    238551253,36200547,94752867,0,0,258224371,186060835,55410819,
+    77303955,240611427,364662947,402817155,465387747,0,0,57880803,
+    354029907,348139683,0,0,499923,342089907,378069203,0,
+    0,0,0,0,314044515,0,0,0,
+    0,0,0,0,339099715,0,469823587,0,
+    187793555,63434851,0,0,0,0,0,0,
+    0,0,0,0,0,365559971,0,0,
+    86106243,0,0,0,0,0,0,0,
+    25804851,147951699,244261091,0,0,313168019,0,0,
+    0,0,0,0,373276803,148214003,306884691,264499475,
+    351522867,386658499,0,0,0,0,0,0,
+    402063491,0,0,0,0,272433251,0,0,
+    0,223400213,0,0,0,0,0,18354211,
+    66646099,200867987,0,394920099,147521923,0,0,409465107,
+    0,0,0,0,0,0,0,310685795,
+    0,0,363778131,310071507,0,0,0,0,
+    0,0,0,48857267,0,139960451,238674163,0,
+    0,306044995,200523859,0,0,0,0,0,
+    324776067,0,44138547,0,0,104100115,0,0,
+    0,0,0,55349331,308568355,319475987,286351619,446443779,
+    0,247636211,422965395,0,0,0,0,0,
+    401907795,295211107,0,0,282898531,0,0,0,
+    0,0,0,0,0,210596083,0,74326131,
+    156135571,0,377663731,0,0,0,0,0,
+    0,0,53469267,90386771,0,0,0,0,
+    27644051,271716451,436588739,0,0,0,16044163,0,
+    0,0,367972627,0,0,0,0,0,
+    461926819,184778867,0,0,318324819,252453043,109449443,37052515,
+    45150307,290857187,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,5640227,0,0,0,219770963,0,0,
+    110833779,0,0,0,0,0,0,0,
+    384037027,0,0,152695107,0,284848435,0,0,
+    0,162287667,0,0,0,0,0,0,
+    0,0,0,0,0,353386771,0,179683427,
+    38973475,0,0,237891827,0,0,0,0,
+    379482403,0,81178867,32985125,0,0,280244323,0,
+    0,0,0,0,1282163,307945699,0,269463651,
+    0,0,0,0,0,0,0,441106835,
+    0,0,0,0,0,0,0,0,
+    0,0,42909873,5681251,421908579,0,272892003,63275091,
+    0,326250627,42438803,0,240095331,124706931,359088419,0,
+    0,0,0,0,311201971,0,0,185245939,
+    0,0,391184595,0,0,77836371,0,0,
+    0,124940387,402686099,0,0,0,0,0,
+    226603203,0,0,0,0,0,0,0,
+    0,0,0,93634819,0,0,0,0,
+    0,0,0,0,0,0,86642947,0,
+    402509907,0,99475733,0,449249491,0,0,32882739,
+    0,71901283,0,110280867,288317619,53383235,163508451,474976515,
+    0,0,0,0,0,0,0,364826771,
+    0,0,0,332267955,0,275255443,0,188842259,
+    477352003,177492115,0,0,0,0,0,253984947,
+    0,0,0,0,470036755,0,434135203,0,
+    0,485363859,0,130560067,194515155,87035955,0,0,
+    0,395292771,0,0,0,0,0,318423171,
+    0,0,0,0,0,0,0,0,
+    0,448811219,220766355,0,0,66486307,0,0,
+    0,0,0,0,173244723,0,98951411,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,471240803,0,
+    0,0,0,0,0,0,0,53825667,
+    0,0,0,0,0,0,375386227,313921683,
+    0,0,0,396394835,0,138109155,398524579,71241827,
+    401969251,0,0,0,0,0,0,109994067,
+    390340851,97669219,484155539,0,48099507,325271635,0,0,
+    132309091,0,0,54145155,0,0,0,0,
+    0,0,0,0,388100291,19460243,399274259,0,
+    0,0,0,0,0,0,95686755,0,
+    0,146968707,251936835,0,0,0,55238739,0,
+    0,224948371,4997171,45482179,53457027,172417299,249401491,487166099,
+    0,0,0,66498643,0,0,0,0,
+    11354275,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,298565731,
+    31088771,132731139,0,0,0,0,0,0,
+    0,0,0,0,0,70410339,0,0,
+    271745123,0,0,0,113041635,0,0,122630531,
+    0,344219747,0,0,0,373727459,0,0,
+    0,80187619,118464691,395174035,361046195,433238275,0,0,
+    0,0,0,0,26136819,234741907,393007411,0,
+    0,0,413618435,0,70783075,0,0,0,
+    61468755,0,0,0,356806979,0,0,229110035,
+    0,0,0,0,0,0,0,0,
+    0,0,0,252674195,407126195,0,0,0,
+    0,0,0,166527075,0,248164403,0,8270035,
+    0,20627571,6250851,0,0,0,393175331,0,
+    0,33591411,279695475,0,122732867,0,279801891,307228771,
+    0,0,474890371,290119907,406188195,0,0,0,
+    0,125681891,0,0,233406771,0,0,135954531,
+    0,37453923,164348003,457617651,97124451,0,0,0,
+    434102387,0,296845411,0,0,0,70525027,0,
+    0,0,104976435,30728323,0,4223059,0,0,
+    193069299,69980259,0,0,382361939,0,296214627,226877539,
+    0,0,184156323,0,0,0,0,0,
+    0,954579,403583139,0,0,0,0,0,
+    0,0,0,166748515,0,0,0,72577059,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,484044899,0,365039779,0,
+    0,0,450953475,0,0,133849187,0,146624771,
+    0,0,166936899,0,52662339,260960499,317886725,386859091,
+    138924275,0,0,445452515,0,0,282828963,154734659,
+    30933123,53899395,5890195,309854355,70971427,307753043,0,0,
+    0,0,252760163,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,321585299,0,0,470688019,0,240382051,
+    430138067,10440835,140734787,73031843,0,155492451,133677155,154620003,
+    0,97992803,195592467,0,0,0,0,354119971,
+    0,0,0,0,0,249008355,265593123,0,
+    0,0,0,301228291,0,0,0,0,
+    0,362672211,0,0,0,488091795,0,0,
+    0,0,0,0,0,0,123519315,0,
+    0,0,0,192332131,0,0,339521875,0,
+    0,0,0,0,414683283,0,314520003,138281091,
+    0,363610259,0,0,0,479007059,0,0,
+    5996771,0,0,190370099,0,0,0,0,
+    126640179,0,0,69284083,0,0,347652323,0,
+    0,0,0,0,0,0,0,0,
+    0,28602547,0,0,0,0,247566595,0,
+    3330131,0,0,0,0,0,220807315,0,
+    0,421450019,0,0,100782211,166424675,0,257732851,
+    89215091,349540563,0,0,0,0,0,0,
+    0,0,61571235,0,0,0,378839363,0,
+    0,0,256041155,0,0,40911027,0,0,
+    0,0,0,139538531,57094259,260649251,402559059,430948611,
+    10219715,54108291,0,162021571,0,0,66523219,89882675,
+    371339459,0,0,0,0,242594179,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,225955971,168083571,230772979,0,315523235,351813955,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,420827203,
+    224186515,0,0,445931795,131358819,217116949,0,0,
+    0,389468451,57360515,35119187,274026595,309920035,317956309,423129395,
+    0,0,67489875,0,0,0,0,0,
+    0,378597699,0,0,0,0,0,367448147,
+    432103667,0,0,189894947,0,0,0,0,
+    0,0,271859811,0,37253219,54083667,38531107,376381699,
+    0,0,0,0,0,0,0,133820515,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    351138099,0,0,0,473608243,0,67866707,137846947,
+    0,0,0,0,38494387,0,0,272003171,
+    0,251236451,362270867,0,431870227,0,0,0,
+    142528659,0,0,0,0,0,0,0,
+    0,0,269176931,0,0,0,0,0,
+    0,96608355,0,0,0,0,0,0,
+    353771635,0,0,0,0,0,0,0,
+    0,0,0,371785827,0,0,0,0,
+    0,302457091,0,0,0,0,106705091,203768067,
+    263975027,374145155,412172419,0,0,0,0,3543123,
+    296071267,0,0,0,343588947,0,92811715,387612947,
+    454041795,0,0,0,487440531,0,326947027,453902643,
+    109826163,0,367583667,0,0,0,0,2617379,
+    0,0,0,157020483,0,0,0,0,
+    231698579,466411699,0,107507939,0,0,0,0,
+    168476787,0,0,0,0,0,245399875,344248419,
+    0,48656629,0,0,394535155,219959443,103813379,402583779,
+    0,455450755,0,0,0,0,0,0,
+    345112867,0,0,0,35549347,42741811,283869347,385220723,
+    0,0,36880483,337715427,373121203,0,0,0,
+    303001749,70582371,284344531,0,0,15810819,0,0,
+    0,0,0,0,168542323,0,0,0,
+    182202499,0,0,0,0,375861507,171122819,0,
+    0,239448115,0,0,0,0,0,0,
+    0,129908787,0,0,0,65589379,0,0,
+    0,279957603,0,0,159744163,282341587,0,0,
+    228589715,0,0,0,0,0,113385603,223866931,
+    50643043,115654883,359395443,0,226480371,0,0,322527619,
+    251085075,0,0,348451011,482808259,0,0,82149443,
+    0,0,0,0,0,0,271458403,0,
+    0,0,0,0,0,0,0,0,
+    337494291,0,0,36966499,0,0,298881123,0,
+    0,0,272461923,0,0,0,0,0,
+    0,0,400580851,0,0,0,0,0,
+    0,224448723,89292979,0,0,0,0,0,
+    0,0,0,0,0,0,272404579,0,
+    0,0,296042595,22716515,0,0,0,0,
+    0,0,0,309579939,0,55337091,0,0,
+    95658083,0,0,0,0,0,0,430514291,
+    0,0,0,0,52052083,0,0,0,
+    0,18538595,44081363,0,0,0,0,0,
+    0,34680931,31469731,96030819,54009939,346701971,0,0,
+    0,0,40112163,348979443,0,0,0,89718883,
+    0,0,0,0,0,0,0,5615747,
+    260030739,178123011,375419027,51540083,97325155,276754771,401731667,0,
+    0,0,313208915,0,0,486375571,307695667,0,
+    0,262041859,393642099,159158371,0,278491235,0,0,
+    0,0,0,0,75255987,1245315,344019043,448934163,
+    128921731,105562357,313065555,364740691,95703075,224563395,0,369717395,
+    0,0,0,0,113770755,0,187232403,0,
+    158142741,264106099,105840915,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,40357923,93966515,
+    0,0,0,0,0,0,0,0,
+    185598163,62619779,0,0,0,108830819,120135859,185024707,
+    143810787,294449235,0,0,0,0,444072115,11620419,
+    0,0,70668387,189587747,425463907,0,0,0,
+    95830115,0,0,0,142098755,4259875,0,0,
+    355717379,454726003,0,0,37580883,422449251,0,170831955,
+    0,0,0,0,260333875,0,0,0,
+    0,0,0,0,456003891,0,0,0,
+    0,42528835,0,479707395,0,477732963,72818787,0,
+    3493971,0,0,0,0,0,0,20287747,
+    0,0,361095283,0,0,0,0,0,
+    0,0,0,24031315,0,0,0,0,
+    133017907,0,0,0,0,0,0,0,
+    0,279269699,86233315,0,0,0,0,0,
+    269951075,0,0,0,0,0,0,0,
+    0,4136995,461742339,482218275,0,84938899,135483491,304169313,
+    58114387,347508995,0,0,147177603,0,0,169861219,
+    289669267,0,0,140963923,0,0,237408419,0,
+    392704243,0,0,0,0,360390803,0,0,
+    122032435,0,0,0,0,0,0,102432915,
+    192172291,226324547,0,240296035,18829411,180003107,111804595,0,
+    0,0,0,0,0,0,0,0,
+    0,0,254353699,452853987,276648339,56254531,0,0,
+    165523539,320913651,0,0,0,0,0,0,
+    29679875,312959123,393797907,432926899,0,0,94810211,269234275,
+    304627859,438505603,0,0,342397235,0,127750243,0,
+    0,464748915,120504451,0,0,0,133734499,0,
+    0,0,0,0,0,422355205,251158819,0,
+    0,0,0,0,0,0,0,0,
+    7356723,0,0,218214643,0,336437395,0,0,
+    0,0,0,0,0,313352275,0,119496883,
+    0,0,0,0,0,0,0,0,
+    0,0,296931427,0,0,321790131,0,0,
+    0,88973475,0,0,242856259,0,0,0,
+    363995235,0,0,290578627,0,369942723,0,0,
+    0,0,34263283,471331107,207970515,0,50008131,461603107,
+    0,0,0,0,0,251957523,310644883,0,
+    0,0,0,0,0,0,0,158933075,
+    158957667,352469315,0,0,0,0,0,0,
+    85020947,230015219,0,0,0,41193507,0,72704099,
+    0,0,0,381165843,0,0,0,0,
+    409370787,0,0,0,0,0,0,269893731,
+    0,0,61923555,44552355,146694355,189182195,21348531,213135683,
+    0,133963875,77476003,0,0,0,0,0,
+    0,0,0,0,36925475,0,0,0,
+    0,0,0,0,0,0,30802083,0,
+    279355603,0,0,123187507,365105347,0,106397843,0,
+    403038355,0,0,0,254873683,0,0,57794883,
+    17150115,442552467,460509507,0,169328931,0,0,0,
+    0,0,0,0,0,0,0,265752771,
+    345018515,48390179,99094707,383369379,0,0,0,0,
+    22192291,0,0,0,66719827,0,0,0,
+    3280979,0,6385715,0,0,0,0,0,
+    0,0,0,0,0,0,313463075,0,
+    0,0,0,0,0,0,196976883,0,
+    0,0,0,127013123,0,0,0,0,
+    347885859,0,0,0,0,0,0,0,
+    0,0,264671507,343875635,57258275,0,0,0,
+    0,0,318947475,0,0,0,366293043,0,
+    0,0,0,0,0,108445827,0,101048643,
+    222380243,0,0,0,0,25358595,208617811,478109907,
+    0,0,103112995,13766915,0,0,0,0,
+    0,0,204931395,194711763,268550195,0,0,0,
+    0,0,0,0,59306163,0,0,0,
+    0,0,134565987,0,0,0,0,0,
+    83009827,463827283,0,0,32870435,414724275,0,0,
+    0,95440995,0,54304851,0,0,0,0,
+    236843299,116101363,358670563,400040195,0,0,0,41009331,
+    0,0,0,0,291270979,407830659,183861331,0,
+    0,0,0,0,0,225247427,0,0,
+    257995043,0,0,0,0,0,0,0,
+    0,23068883,295755875,0,0,309379139,94359731,90245,
+    15839379,0,264888611,0,0,0,0,0,
+    0,391913539,0,0,0,54698067,0,0,
+    77402227,81301555,487358611,0,0,0,0,145551603,
+    0,0,0,0,0,295268451,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,42549427,118710451,184914067,48238819,351617075,
+    195461379,0,0,323764355,0,274600147,0,127406179,
+    248963235,0,0,0,0,0,0,464159091,
+    0,410108115,0,0,0,0,0,240984163,
+    0,117760115,0,0,0,0,0,459329827,
+    0,0,0,0,217882803,0,0,0,
+    0,433365171,87507107,0,0,51572899,0,0,
+    99676371,0,49942771,0,2265139,0,7561443,206966899,
+    0,0,404922451,256831667,413405443,0,0,0,
+    0,404111491,0,0,0,0,410427635,0,
+    0,20176995,0,0,0,75423859,80249123,70725731,
+    89182323,137240675,240238691,327794851,457232579,0,154755203,184840467,
+    0,0,0,0,0,54870147,0,0,
+    307368067,67854371,375754947,0,0,154718339,249622643,424554723,
+    0,0,186134819,0,0,65306819,38092915,1159283,
+    0,83898483,179929363,238063907,55275603,486654051,0,219230371,
+    146391203,268517555,480694435,0,415850547,0,0,268111955,
+    0,0,383258675,0,0,1863779,0,0,
+    0,0,0,44613795,271056995,0,371515635,0,
+    0,0,0,0,123269427,3219587,216600723,277021075,
+    415228051,0,24707139,282194099,43045043,0,0,114237571,
+    471789955,0,0,0,0,0,0,0,
+    0,36667539,0,0,0,0,0,69378147,
+    0,0,0,0,0,0,0,381018451,
+    0,224657539,0,110178531,139628675,162390323,82169955,147148899,
+    375500963,0,0,416735681,223473843,376168643,0,0,
+    436642019,0,0,0,0,0,0,286081123,
+    353542419,469139747,0,0,0,0,0,0,
+    0,0,97067107,0,0,0,0,0,
+    0,0,0,0,0,412954867,351481939,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,36995171,0,
+    88363187,426791715,8753347,0,221708435,0,343371843,0,
+    275185923,0,0,279175425,290766963,0,0,0,
+    17465379,411467939,0,0,0,0,220561555,0,
+    0,0,0,313712803,360837395,0,0,0,
+    436113587,0,0,433082563,0,0,0,0,
+    0,0,127496323,0,0,333070803,0,0,
+    43126915,407175219,418943523,0,0,8552579,404971619,0,
+    311431331,0,0,0,0,0,54624339,31559891,
+    15282291,132927651,225640739,233144627,0,0,0,235823395,
+    399954243,0,62161161,0,439361875,0,0,0,
+    308646131,0,379179283,299602163,40517811,100503651,310903043,393355555,
+    0,0,241557779,0,0,459407619,0,49795203,
+    0,0,0,0,0,0,0,0,
+    0,452915443,0,0,0,0,0,145285427,
+    0,89747555,0,452133091,0,0,0,0,
+    0,0,70266979,433627379,0,221012115,0,0,
+    0,0,0,0,292462835,482021571,0,489001059,
+    96809059,409760115,2674787,0,0,0,0,0,
+    0,0,376619299,488173715,0,0,0,0,
+    0,0,71929955,0,158347315,329580963,33087571,240037987,
+    400425251,4804771,70209635,0,307015827,373342275,453517571,0,
+    0,161951827,37167203,240124003,350425283,437637363,0,0,
+    0,87957699,332657009,0,0,0,0,0,
+    0,0,0,0,19251507,0,0,0,
+    0,0,0,0,0,0,0,129478755,
+    0,0,0,0,136355939,0,269922403,0,
+    0,48496803,0,0,0,0,0,277389603,
+    0,0,0,438542483,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    301830483,0,0,343613491,0,0,0,0,
+    0,411803811,0,0,0,0,0,0,
+    0,54771795,0,216854803,0,54980739,0,109068371,
+    0,0,0,76345539,0,173326579,113643763,0,
+    0,0,0,0,0,55386195,0,300736723,
+    271286371,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,29839475,
+    269836387,0,0,0,0,0,89645139,0,
+    0,0,0,0,0,152863027,0,478519603,
+    0,0,0,0,268210371,0,0,268439843,
+    0,0,0,0,0,103526723,181813539,0,
+    0,0,132075683,134021219,201371907,0,0,0,
+    0,0,0,0,127348835,367079491,55017603,0,
+    10273027,0,0,0,0,0,0,0,
+    0,0,0,309895251,0,0,0,263909491,
+    0,0,0,0,0,316948579,0,376959251,
+    0,0,0,0,0,0,0,174670083,
+    0,0,0,0,32145603,0,123609427,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,277721251,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,68649059,0,223547603,0,0,0,0,
+    0,0,0,352137491,412020883,291221683,283213907,0,
+    0,0,0,0,20947171,0,176644403,0,
+    0,72073315,0,407191859,0,382664787,0,259957011,
+    265670803,281014499,361771267,0,0,84603157,203944211,0,
+    0,0,0,0,0,423067875,434671827,0,
+    0,57626819,381907219,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,93704291,0,343101619,
+    0,0,0,135024739,0,0,0,97181795,
+    273195315,486277267,0,0,280801443,120594579,422813859,0,
+    0,12816483,0,388493539,0,427819811,259776563,89669811,
+    240754787,268714161,325574739,0,0,0,0,0,
+    0,0,202178659,3268643,0,244007091,0,417952225,
+    0,0,0,0,0,0,274354275,0,
+    0,51810627,391155811,0,0,0,134881379,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,44687555,79765587,0,0,0,
+    254431443,0,97906787,343736403,0,0,54722691,476590211,
+    0,0,0,0,0,372379891,0,0,
+    0,0,94163123,0,0,0,0,111628515,
+    0,48042195,0,0,54833283,0,273416419,0,
+    0,0,0,0,437469363,0,134221923,0,
+    414220371,0,0,0,0,0,53715075,0,
+    0,0,133415027,0,271401059,0,0,0,
+    73498739,147235107,0,292122915,297676899,0,0,0,
+    231116899,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,71786595,0,
+    102977619,131559683,0,321720515,0,126918771,0,0,
+    0,0,0,100819251,155558003,225530275,0,333873601,
+    0,0,0,0,0,0,477761747,0,
+    0,141218051,0,146350227,0,132460595,270426211,307405043,
+    66977939,0,0,0,0,0,0,0,
+    98738451,271659107,0,0,0,179851427,0,311775347,
+    360161379,0,0,0,0,279900259,442122931,0,
+    0,0,0,0,0,0,103043331,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,303149155,0,0,0,0,
+    0,350478531,0,0,0,188752083,215392467,0,
+    0,0,0,0,0,466702643,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,202891635,0,449192147,0,75620467,0,
+    0,194621779,0,273829939,114577729,0,0,248037523,
+    0,183967971,189067427,0,0,0,0,0,
+    0,0,0,339374387,0,0,0,0,
+    298164323,375459987,302866531,0,199520483,16228915,241250451,0,
+    0,471310403,0,0,78422403,289591587,0,27828403,
+    0,0,0,0,176885955,0,0,366702723,
+    448475411,202236099,0,0,0,409935989,0,0,
+    0,6905955,0,0,0,86044899,122351891,239313187,
+    269635683,0,0,0,0,0,13095171,185880643,
+    0,0,0,18759939,186396787,0,267616499,0,
+    388849971,0,0,0,0,439189891,73855205,0,
+    483152323,448413923,0,0,0,34222227,0,0,
+    0,0,0,0,449864035,0,0,0,
+    0,191926579,373973203,0,0,71802915,0,0,
+    0,211874003,0,45277555,65699987,298365027,474173699,29749315,
+    301920483,0,146809075,210661491,0,0,0,0,
+    0,0,401076595,293617891,38641843,0,0,0,
+    0,256417875,0,0,0,0,280272995,0,
+    0,0,0,0,306229395,0,457347219,286003331,
+    375287987,0,0,0,127111251,477606131,0,274223267,
+    136126563,219041987,432992435,327659651,0,0,0,0,
+    0,0,0,0,0,0,942115,0,
+    311861411,0,130617395,356561283,0,0,0,0,
+    0,72962163,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,19943523,273662115,0,
+    0,0,185311283,0,0,0,0,421888067,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,475238643,0,
+    0,0,0,0,0,0,0,0,
+    240009315,0,390586547,0,0,0,66846803,0,
+    201879843,0,7008547,0,0,0,253657251,81567939,
+    0,0,54046803,0,9814403,0,0,0,
+    147976339,0,0,0,0,0,0,0,
+    0,0,0,0,85491955,0,0,478355667,
+    0,389316691,0,0,0,55664993,0,0,
+    0,50434227,295985251,347160707,0,0,0,0,
+    481534147,0,0,0,0,0,0,0,
+    0,659491,0,446234803,0,0,0,0,
+    0,0,485212307,0,0,0,0,0,
+    0,0,0,163930419,0,279814243,0,0,
+    0,0,398807267,0,327278915,0,0,0,
+    391631043,0,0,0,0,0,0,327454883,
+    171208851,0,0,0,0,2515043,0,0,
+    0,0,0,0,0,0,0,0,
+    12845251,44023907,2371635,0,0,0,462713123,0,
+    0,184484147,0,134365283,0,0,0,0,
+    243945699,0,0,0,0,300585123,340963635,0,
+    0,0,0,0,65740915,0,0,0,
+    0,0,0,0,0,459591955,0,0,
+    49700947,0,0,0,51503235,76795987,0,55066707,
+    479416547,0,0,0,0,210751715,0,278237331,
+    0,0,447308019,0,0,285888819,485970067,0,
+    0,0,0,0,0,395075731,0,0,
+    194379907,394965091,0,0,201064659,466129267,0,339857763,
+    96464995,0,0,0,0,0,136700003,0,
+    0,0,0,0,0,0,0,456380771,
+    0,0,0,0,263389347,0,0,0,
+    0,0,0,71774243,467247187,0,0,0,
+    0,270254179,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,105783507,0,0,0,
+    0,25919571,50598051,455090371,0,210813011,413020387,0,
+    0,0,0,0,0,0,0,299204787,
+    7799171,0,0,0,0,0,478810259,0,
+    0,0,0,0,280072291,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,209731827,413552883,0,60195075,2195617,0,0,
+    0,0,0,0,239722595,472523075,0,0,
+    102871123,75325555,342630707,0,0,0,0,0,
+    259489955,79433795,0,343990371,0,0,351506483,0,
+    0,0,0,0,0,368455939,267784435,0,
+    158535987,486682723,231207059,0,270655587,0,0,0,
+    0,0,0,0,56115667,230490195,28192995,419803267,
+    424685651,98193507,350531795,0,0,0,0,0,
+    0,0,0,0,0,374083813,362012851,0,
+    0,0,0,17359073,37814355,451092771,0,291762387,
+    0,0,0,0,0,0,23470195,310743203,
+    0,50028691,414269539,0,0,69664867,0,0,
+    0,207188131,0,281690371,13263139,359252129,0,13406435,
+    15794227,327696547,0,220725395,0,0,395890995,0,
+    0,263106867,0,0,0,0,0,0,
+    0,0,0,331714977,0,0,0,76054643,
+    114782659,0,86933603,0,0,0,0,383750419,
+    0,0,0,0,0,0,0,0,
+    0,250732691,0,0,0,0,0,0,
+    0,0,0,209928291,0,0,0,195219619,
+    375931059,0,486752403,479846659,349929667,0,0,0,
+    316760195,17096899,0,0,0,0,0,0,
+    0,0,0,0,391844099,0,0,0,
+    83439747,0,71643235,0,244904179,0,0,0,
+    66195539,0,0,0,0,423735491,0,0,
+    0,0,0,70037603,355926307,0,0,131629171,
+    227213443,320122947,0,0,0,324329523,0,0,
+    372682995,0,0,52711571,0,0,161227187,3506211,
+    0,0,0,0,0,0,252936243,0,
+    0,0,5087475,0,0,0,0,0,
+    175587507,73605329,0,0,0,232681571,307470499,0,
+    0,0,0,0,0,0,0,337416483,
+    0,152232211,0,0,0,99799267,0,67903651,
+    0,0,0,0,200908851,0,1499251,0,
+    112787651,0,64385283,150241619,0,0,0,0,
+    0,0,54034563,0,482500803,0,0,0,
+    0,0,0,143384819,0,11235541,206016787,246636787,
+    0,25076003,92070035,0,0,0,106356803,0,
+    22311155,0,0,0,0,0,403247347,15589619,
+    341311731,487760019,0,0,0,0,0,0,
+    249237555,0,0,0,0,0,384987267,0,
+    0,366739603,0,0,0,0,0,0,
+    101851427,437366947,0,294473923,0,0,0,0,
+    0,0,0,0,0,0,55226499,0,
+    0,0,485404771,211546419,0,5800099,0,0,
+    154992771,172007635,0,111099971,19501283,0,0,0,
+    0,0,0,0,316797091,0,0,0,
+    0,0,0,0,0,78102755,153084195,187383955,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,421347475,337568019,0,15114483,
+    370462851,0,0,105914499,0,0,0,0,
+    0,0,0,202617059,315760819,0,4001875,0,
+    198185187,277897619,0,0,0,0,0,0,
+    0,0,0,95039587,0,9519459,0,0,
+    0,0,251560259,0,465637555,0,0,357638483,
+    0,65904739,0,0,884771,102748323,0,107422019,
+    0,0,0,0,19910771,0,0,0,
+    0,0,0,249458867,0,0,0,0,
+    0,0,774371,0,0,0,0,0,
+    0,0,0,0,321986627,477884627,0,143687907,
+    117281059,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,367927457,396316963,
+    0,0,0,348405923,0,0,0,0,
+    0,205611251,0,0,296013923,92594323,0,0,
+    0,0,474927283,81002723,343973939,184758339,422109397,0,
+    0,0,0,254034227,0,0,0,0,
+    78811475,0,348844291,0,0,0,0,110584115,
+    0,0,0,0,317325475,0,0,0,
+    0,0,0,0,0,116629747,224862371,0,
+    0,0,0,0,0,214147331,453742819,387317971,
+    0,15982819,0,171778339,0,0,0,100008019,
+    0,0,0,0,0,151089267,0,0,
+    0,0,0,0,0,0,61186291,0,
+    0,0,0,0,0,317063219,0,0,
+    0,0,0,278212691,0,282984547,0,0,
+    186998931,0,37605539,0,0,0,0,0,
+    25714755,0,0,0,0,0,0,3256403,
+    142823763,0,0,0,0,0,126046323,0,
+    0,0,68194387,0,96002147,0,161153299,90288289,
+    236085459,240697443,318705841,404545731,410902771,0,0,0,
+    178905363,0,0,96145507,0,458080467,0,0,
+    0,0,0,0,32596179,0,0,0,
+    0,0,0,142405939,0,0,296329315,0,
+    372945011,0,0,0,0,0,0,383009027,
+    0,286847203,0,0,0,0,164180291,0,
+    0,231145699,0,0,0,55177299,0,333832801,
+    0,0,38936755,0,0,457093283,0,0,
+    38592691,373362995,0,0,0,0,0,0,
+    0,0,340271379,0,281456931,384307315,0,382525603,
+    99361027,33464467,274206771,0,0,0,0,0,
+    0,0,0,0,0,0,0,158744755,
+    297046115,0,0,0,24170531,0,0,397230403,
+    0,0,0,0,0,0,0,0,
+    403628229,0,0,0,0,35635411,54734931,387871027,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,173629667,0,
+    0,152010851,0,0,0,0,0,0,
+    480960739,0,0,0,0,0,259363107,294301779,
+    0,0,0,8589539,17211491,484647011,0,0,
+    47280403,0,0,0,270082147,0,227971171,0,
+    0,56799315,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    3891235,297762915,0,0,252895379,0,0,0,
+    445878467,0,103371059,263479459,187465875,33366115,401342739,0,
+    339173539,0,239607907,0,7483683,0,0,0,
+    0,0,0,176124099,183886003,3702883,485666963,7696419,
+    395116755,279928931,275616083,0,0,0,409968933,0,
+    234782803,0,0,0,54182019,65851697,130842707,0,
+    0,0,0,33022035,0,0,259850643,0,
+    0,0,0,310128851,0,0,81064131,149758387,
+    0,447963347,0,0,0,0,0,20709491,
+    108232835,0,5419299,134250595,366309523,0,0,458731747,
+    39571555,69722211,173764899,107061475,297304163,0,0,416707121,
+    0,0,0,0,254898371,0,0,26374371,
+    308469843,0,96374899,217448611,255864947,351293683,0,0,
+    0,0,0,219386003,407916803,474394915,0,0,
+    0,0,0,0,78012755,97439843,453853363,297934947,
+    0,0,326070515,0,0,0,0,0,
+    0,255586451,0,32997459,439451987,0,0,0,
+    0,388968723,0,225816691,0,0,0,0,
+    0,0,0,0,0,0,305131715,0,
+    0,0,0,0,0,86143235,31940707,0,
+    0,0,0,107700419,315605155,0,0,0,
+    43094131,0,0,413147411,258752755,0,415555747,216031475,
+    445104435,0,456474851,0,0,0,0,353013955,
+    0,0,0,0,0,0,158400643,0,
+    0,0,0,296902755,0,0,0,0,
+    0,0,472285491,0,0,0,0,0,
+    215957779,0,0,96751715,0,0,0,0,
+    0,0,170934659,0,0,112357489,135741539,280342643,
+    0,0,114700593,0,0,0,0,0,
+    0,24633491,0,0,0,0,0,0,
+    0,0,0,0,0,5202163,0,341594339,
+    0,0,0,44515459,0,0,392565011,0,
+    0,0,96088163,0,0,0,0,0,
+    417641011,0,134078563,0,0,0,422301779,0,
+    367198419,0,0,0,0,396050787,0,0,
+    298795107,0,0,0,0,0,0,0,
+    0,0,0,462156211,0,0,0,401756227,
+    0,0,0,0,425234531,0,17531267,94113875,
+    0,0,85164163,0,0,316608659,0,0,
+    0,0,108269699,0,0,0,0,0,
+    483704979,196170019,0,0,0,0,0,453194003,
+    0,0,0,0,0,0,0,0,
+    0,0,0,61366547,469737795,11260019,0,0,
+    201306355,0,250683571,0,0,0,420257891,0,
+    0,86212675,0,0,0,0,0,384458979,
+    0,0,0,479645923,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    53764179,0,0,0,414138531,0,266740051,169160755,
+    0,0,0,0,0,0,154648675,0,
+    0,168214643,34795811,406597907,0,0,0,0,
+    0,29945987,97095779,0,0,0,216567923,0,
+    0,210694355,248680563,71958627,324079667,389378387,472117443,0,
+    0,64573747,0,194879747,294105171,54415443,0,0,
+    0,4460643,370729091,0,0,0,0,0,
+    0,0,0,0,0,316563619,0,0,
+    0,0,328011955,0,0,0,0,0,
+    7512243,0,0,0,0,170627331,0,0,
+    272633955,0,0,135983203,141725939,0,164483315,194769139,
+    433488131,0,31006883,0,0,0,0,0,
+    0,0,314380403,0,0,0,63742323,249655379,
+    225349747,0,0,0,0,0,0,363274323,
+    0,0,0,0,0,0,0,0,
+    320143587,0,0,0,6602867,0,0,236462275,
+    0,0,362438803,0,0,0,0,481353955,
+    0,68243539,134049891,349749523,402890899,0,0,242405731,
+    0,110239891,57680083,148717955,0,0,235384995,412061827,
+    0,196784403,0,0,0,22610067,244830483,451518707,
+    0,0,0,0,0,0,0,92020915,
+    336847043,0,0,68489427,195666195,0,0,0,
+    0,0,169369729,0,0,130535507,0,0,
+    0,0,0,0,0,5984291,360644675,0,
+    0,168280179,0,0,0,0,0,0,
+    191455507,0,0,237453555,363942083,304480403,0,0,
+    0,298192995,0,0,0,0,0,0,
+    0,0,0,141607059,100724947,0,0,0,
+    0,0,0,0,0,265711763,0,0,
+    0,0,197480723,317423699,40960179,483045779,487071891,0,
+    0,0,141103395,0,79114419,0,0,0,
+    0,0,0,0,184238483,0,0,0,
+    93601907,17867027,196690275,0,0,0,187302035,0,
+    0,0,138535059,0,0,0,0,0,
+    0,279986275,0,143941747,0,0,0,0,
+    0,0,0,0,224038995,0,0,0,
+    296386659,0,0,182718689,0,0,0,0,
+    0,232099971,0,20660403,0,0,0,0,
+    0,17449059,98078819,0,0,0,0,0,
+    293961875,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,238862627,0,0,0,0,0,
+    0,0,0,0,0,145367347,280478019,0,
+    180547875,12271843,33034275,271171683,200925491,0,0,344322083,
+    0,0,0,0,0,0,0,0,
+    289329379,0,0,0,0,0,0,0,
+    9916675,120635523,132120675,0,0,256577715,0,165806339,
+    168870003,169758819,447451395,0,0,339701891,0,309657875,
+    294809699,0,0,0,69009843,457425139,26288291,0,
+    0,0,0,0,223219875,0,0,0,
+    0,0,322941219,476266707,0,0,0,0,
+    7086275,0,367628545,0,7467059,325980227,261390611,329318835,
+    0,0,0,390455507,0,0,0,109633763,
+    0,52961475,325468387,341102851,0,0,0,370229397,
+    0,0,0,0,0,0,0,0,
+    0,0,0,392769795,0,322068579,0,0,
+    0,404652227,0,0,0,80519235,0,376533315,
+    63062067,469905635,0,355787027,0,70311971,404201699,362479811,
+    0,0,0,0,0,297103459,314810467,323391603,
+    0,0,0,0,0,0,0,0,
+    0,0,66924691,0,61718739,5013603,40566963,303067347,
+    68218963,0,0,0,0,0,0,61001827,
+    0,0,224063795,0,299110499,0,0,136155235,
+    425963731,0,0,0,0,0,367599985,249921811,
+    362795139,0,0,0,0,0,0,133705827,
+    0,0,0,192942339,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,17240291,218759299,0,0,433414419,0,
+    0,0,0,321486931,328479219,396235059,31195203,0,
+    0,0,0,0,0,98861235,0,0,
+    0,4198483,0,0,0,231399667,347328675,183378067,
+    311685267,0,363389075,484364499,140460339,0,0,0,
+    0,1011923,282669139,0,0,0,0,190284099,
+    388428019,207356115,114274483,0,0,0,0,336769123,
+    0,301375605,0,198443299,0,0,0,0,
+    0,0,0,227164339,0,383987891,451584371,226795603,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,326832227,0,0,0,0,0,0,
+    2490451,157581507,0,0,0,0,0,0,
+    93249827,0,24043555,0,221995155,72761443,307200099,440693123,
+    0,0,0,0,0,0,0,97296483,
+    347091091,0,0,0,0,0,0,209260835,
+    0,13512931,0,0,0,0,0,0,
+    0,0,0,0,0,170033251,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,255254675,0,23503011,257073315,0,408605219,
+    0,0,0,0,316100691,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,119201971,0,0,0,
+    0,0,0,0,478298323,0,0,0,
+    0,0,0,0,0,0,0,0,
+    78246067,0,195817715,0,0,0,169730147,273145971,
+    447058211,0,0,0,0,0,0,0,
+    119742643,63692977,37470243,0,182903075,0,0,0,
+    0,0,0,0,418816481,0,88010867,241893619,
+    92197011,45580467,0,402989235,484294755,0,0,0,
+    0,0,0,0,226934883,82808963,314212739,315138115,
+    217776227,324812947,384946323,296357987,0,0,0,153616659,
+    167583939,208785715,4587955,250634419,0,0,0,0,
+    0,0,0,0,0,18497683,0,0,
+    0,0,0,461140371,0,0,0,0,
+    28815571,0,186073315,0,2543939,0,0,0,
+    0,165421139,0,187068563,0,0,0,0,
+    0,3940387,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,374431987,
+    0,0,0,53653587,0,0,0,0,
+    0,157454515,0,0,0,446087491,425406563,118366387,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,220889235,0,160846131,393924739,
+    302108771,0,85033185,4161571,426410723,0,88191187,400257363,
+    0,0,0,0,0,440631523,0,385253491,
+    400347427,0,0,0,0,79454355,0,134422627,
+    0,0,0,0,0,100360467,339456243,0,
+    0,0,0,0,271601763,0,0,0,
+    0,0,0,0,0,0,0,348774659,
+    0,71557219,0,0,0,0,0,0,
+    0,0,0,0,67608659,3379283,266973523,109572323,
+    314695779,0,170856579,179462387,0,0,0,0,
+    0,0,0,103882851,475435139,0,465592483,0,
+    284668179,80658499,367407251,484921443,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,406896723,0,0,0,0,0,0,
+    0,473370931,0,0,373649699,0,129069251,0,
+    407494915,0,0,322126019,370118915,0,0,0,
+    0,0,0,0,97583203,0,427209507,380940355,
+    0,0,0,0,52084899,0,371716179,0,
+    0,0,0,68915427,0,0,0,0,
+    0,0,0,54440067,484479075,0,0,0,
+    0,0,0,136671331,27103507,0,0,156520531,
+    206999859,351739987,0,0,0,0,0,85450899,
+    463053011,0,0,0,0,13598835,0,2719843,
+    13029619,0,0,0,0,405897491,184201347,0,
+    0,0,0,0,177594627,244691219,0,478482563,
+    0,216457411,0,183185619,472981795,0,235339939,0,
+    0,0,55263363,318156899,0,0,0,0,
+    0,397902147,135426147,0,0,0,0,0,
+    175190275,315388083,366506179,0,86741139,0,0,296558691,
+    0,483635299,0,0,0,0,0,0,
+    0,0,0,0,0,0,3342371,344719651,
+    0,459166051,0,0,50757811,183742723,0,22266019,
+    1224915,0,319336643,0,0,368005267,0,0,
+    0,0,270598243,336642195,0,0,470761715,485253219,
+    0,0,0,442351779,0,320839827,153202995,438931635,
+    85291155,355012947,0,0,0,0,36765795,0,
+    0,0,0,302203187,274571363,0,0,0,
+    0,58302771,165474387,0,0,0,0,0,
+    0,0,0,244056323,312520979,0,480440483,0,
+    109027475,185925731,0,0,0,91033843,0,0,
+    0,0,0,3150083,253702307,308109363,60125443,0,
+    67276851,0,0,0,0,0,0,0,
+    29577283,0,0,0,0,0,0,0,
+    284537091,0,0,0,319701267,0,0,0,
+    0,441815203,0,0,0,338268451,0,0,
+    0,296185955,0,0,0,0,0,0,
+    0,0,0,0,0,284299427,420786323,0,
+    0,0,0,300916931,0,0,0,0,
+    0,228335779,0,407007347,390033683,0,180080915,0,
+    0,0,5136435,45535395,40849443,386883667,332026225,0,
+    295297123,70094947,0,25956387,0,0,0,0,
+    316010675,0,39084115,0,0,0,0,0,
+    0,0,0,452268291,44970115,0,0,0,
+    0,0,0,0,221954195,367042691,112205955,297820259,
+    0,0,0,0,0,350699779,66797651,0,
+    0,0,0,0,0,0,0,0,
+    0,176230643,0,150995299,0,199946307,327839923,0,
+    314896483,164266291,299139187,327741635,36098195,46788803,114024579,48640051,
+    0,0,218923171,41451699,0,170696883,111169683,295153763,
+    467640675,0,223604835,0,332956083,0,0,0,
+    0,0,0,0,0,0,0,231895283,
+    0,258142515,351764659,251863315,0,0,0,294867043,
+    135082083,0,377729347,0,0,0,0,0,
+    0,0,0,0,717011,0,0,18682147,
+    362905699,0,0,5042339,0,0,0,0,
+    0,0,0,3805267,486162531,0,299040803,0,
+    457490675,0,0,0,0,343826515,0,0,
+    199041315,9097315,350839011,66695251,0,245895411,0,0,
+    0,0,407040179,0,0,0,0,0,
+    165183635,0,381481187,0,0,130580611,0,40161379,
+    0,0,476463203,0,0,0,202207331,0,
+    0,0,298852451,371446019,0,0,0,0,
+    0,0,0,0,52384019,0,3043443,0,
+    0,317538403,407867571,0,0,0,24674419,0,
+    0,0,120672405,0,30290035,0,0,0,
+    0,113103043,402460755,29872259,0,476491955,0,0,
+    369733715,0,0,0,384340163,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,256151747,461680867,72618083,302526771,
+    138027187,389607651,0,0,0,0,0,19529843,
+    72159331,64737493,0,0,131502179,0,0,0,
+    0,66584611,244641971,247402787,355283251,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    115503363,0,0,344658147,420417763,0,25944147,0,
+    374710355,38740147,295813219,0,0,0,225300659,0,
+    0,0,17342755,236228819,255758515,0,110051555,0,
+    0,485048419,0,234954835,436072595,472793347,129036401,283328803,
+    0,204566835,0,0,323219667,0,0,0,
+    0,118661299,0,0,356979075,315908195,0,0,
+    0,20017251,27926707,0,0,0,0,139342003,
+    0,126742611,233976147,0,0,0,0,185389251,
+    273731859,0,76931331,315699251,0,0,0,0,
+    0,296616035,87400611,0,0,337146083,0,0,
+    0,42336435,0,0,58540339,109965411,419103201,206762211,
+    72646755,297275491,0,0,0,0,0,0,
+    0,0,0,0,130474163,0,0,0,
+    0,0,0,0,0,82624707,0,0,
+    0,0,0,0,0,377172179,0,0,
+    383897699,0,0,34935011,0,39702627,67203107,0,
+    244764915,0,0,0,326643923,474779747,0,0,
+    0,0,0,0,0,148431011,29327619,0,
+    154288467,176361731,0,0,219918483,241213571,0,484016227,
+    0,0,83382483,0,197308755,312254659,350650547,0,
+    0,0,0,0,264335683,386621571,0,0,
+    0,0,0,0,0,386117747,0,103190627,
+    299692355,0,0,0,0,0,0,376697091,
+    33939651,338497763,0,0,0,0,0,0,
+    350347555,0,0,386150691,0,0,254693683,0,
+    0,0,0,0,0,0,96837731,0,
+    0,0,0,0,0,0,0,222130243,
+    0,0,0,0,211079491,0,0,0,
+    0,156852419,139501699,280043619,313139299,0,0,0,
+    0,298737763,0,0,0,0,0,0,
+    398070051,360603795,0,205365411,0,0,0,0,
+    0,0,0,0,0,0,0,459878691,
+    265253059,0,0,0,0,306593939,0,283062419,
+    0,0,0,359903459,0,177832275,0,0,
+    0,0,5755043,0,0,86835283,0,0,
+    0,0,209797267,217931827,483582147,0,0,0,
+    0,0,0,0,336371795,0,0,355860723,
+    72319011,19087651,0,0,0,0,131186787,0,
+    0,23732339,0,79736931,102936723,107356403,285630789,311156899,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,5574707,0,283037779,437969091,0,0,0,
+    0,0,0,477286643,0,0,0,0,
+    243736723,0,0,414904483,0,229810547,0,0,
+    0,0,0,0,51896627,184660019,210022483,220164243,
+    0,0,0,0,0,0,0,0,
+    0,0,270741603,210473203,0,0,0,0,
+    0,0,0,0,0,0,290214035,179425411,
+    193753315,135311459,0,0,0,181702995,0,0,
+    385486947,410345777,0,236286163,380960979,0,0,0,
+    0,0,452743395,0,252829843,0,0,299303059,
+    0,390107411,0,439124211,0,0,41439267,0,
+    0,0,0,204353939,296530019,0,0,0,
+    0,0,0,0,0,0,0,477393075,
+    149975395,276136227,0,0,0,0,210985315,0,
+    0,0,0,0,0,0,78352641,0,
+    0,179806371,196903187,282243171,0,0,0,0,
+    0,0,151122115,0,0,0,0,0,
+    70340643,0,0,0,271917155,0,472043795,0,
+    0,0,0,0,0,0,73662805,0,
+    0,0,0,0,0,0,0,182939793,
+    117694515,431849539,415076627,0,0,0,0,0,
+    465875171,0,71057443,0,0,0,0,0,
+    0,478462019,0,0,0,0,0,0,
+    0,0,154489011,0,0,0,0,195264675,
+    0,0,0,0,420102195,0,0,286539859,
+    372445299,3653667,222056563,215027907,191693075,325165203,343892275,134910051,
+    0,0,117829795,142487699,0,0,0,0,
+    0,271114339,0,0,0,136097891,0,0,
+    63217875,0,0,0,301297955,0,0,0,
+    0,0,0,0,0,0,218665171,115245171,
+    0,0,0,0,0,0,105332915,0,
+    0,0,100974867,0,30847155,38006851,56729651,324178083,
+    0,252539043,359362675,0,0,0,0,383926499,
+    165224611,0,0,0,0,0,0,0,
+    0,0,364335235,0,0,0,269607011,484716739,
+    0,0,0,298709091,0,0,0,323678275,
+    0,0,0,0,268058675,0,0,0,
+    0,0,362082483,135684195,274804995,0,487800979,0,
+    96637027,455663891,0,1986675,253829379,333664851,0,427000611,
+    77164707,0,425635939,0,0,163127523,271945827,392638707,
+    421388371,0,21487875,0,0,0,0,0,
+    64794931,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    322007155,0,0,376815891,366637155,0,0,0,
+    0,0,0,148017395,342159651,0,0,0,
+    34664499,54538371,135827555,0,0,0,0,0,
+    0,5267635,0,162967811,448549171,0,0,0,
+    212316467,0,0,480100515,0,283484291,0,0,
+    0,0,0,0,0,0,63840419,0,
+    195957027,0,0,0,0,477061347,0,0,
+    483475651,0,413913267,81490051,344277091,0,133349491,0,
+    160809027,476004499,0,0,248774963,0,0,0,
+    481292515,0,0,0,0,0,0,0,
+    0,0,65806819,48541827,0,0,34328755,0,
+    0,0,243331443,0,226656531,0,0,0,
+    0,0,290181235,0,0,0,0,0,
+    0,77545523,183243091,399507555,0,0,480649379,0,
+    0,0,0,0,126079059,174969075,239980643,360079667,
+    386379859,0,0,0,419610707,0,0,0,
+    246432003,124858675,0,0,0,357982547,6115555,256204979,
+    0,0,0,0,0,129507491,154431699,0,
+    0,176570643,0,0,0,0,0,374227187,
+    0,269578339,0,335634851,0,0,0,0,
+    0,0,0,323801315,456085827,136728675,121770435,256389315,
+    0,222613587,117792899,88674387,0,0,0,0,
+    231288995,222953587,0,0,127840547,0,0,77750483,
+    0,83087491,0,298623075,0,76259651,0,0,
+    0,0,20643,0,216309955,456896691,0,0,
+    0,184955139,267506083,0,0,0,0,0,
+    0,314839139,0,0,90226851,139477075,0,72417379,
+    422072451,266076467,458858723,0,0,0,0,0,
+    0,79954099,0,0,0,0,282812467,134107235,
+    211165443,469590259,163311827,229023843,0,0,0,124797155,
+    0,0,0,124629283,334795331,0,0,95469667,
+    135512163,0,0,124666003,0,0,0,137797811,
+    0,0,149451123,0,0,113262771,234717267,0,
+    0,0,88600707,334176833,413282547,382136483,0,0,
+    0,312205491,0,0,0,35201219,0,0,
+    0,211706179,0,376889603,0,0,169111731,0,
+    0,414445651,0,290918659,473710867,376451379,145690835,298336355,
+    486318291,0,171393315,0,0,404611217,0,0,
+    0,0,0,85332325,0,209195251,0,365494515,
+    0,0,135655523,0,0,0,0,0,
+    271200355,0,0,60911715,0,0,0,174805283,
+    435351747,348913811,331981347,45007027,0,0,0,0,
+    0,0,0,5345555,281395429,0,397467971,0,
+    0,0,0,0,339951843,414810291,0,2167059,
+    0,0,0,72532067,0,0,274112643,0,
+    220000403,258818291,0,31350931,135254115,0,416117121,0,
+    0,0,0,0,0,239235363,0,0,
+    0,0,0,0,0,0,117924019,0,
+    401997923,0,0,0,207311011,0,0,96780387,
+    0,419086883,0,0,0,0,95068259,453382339,
+    0,0,0,0,0,485515363,0,160731267,
+    203837843,0,415039619,0,0,107753619,455876899,0,
+    98250851,0,75391091,0,0,0,0,0,
+    0,75825443,0,0,0,0,0,148279571,
+    65409203,0,221667475,0,324374723,0,0,0,
+    0,0,214217011,0,319606915,0,0,0,
+    0,0,271974499,0,0,0,0,0,
+    0,0,104460771,248119459,0,282120467,81924163,159117459,
+    0,0,0,68747491,0,0,0,0,
+    0,0,0,297791587,0,0,0,397316387,
+    0,0,0,466460867,0,0,258949363,221298835,
+    294375507,420765763,0,0,158507107,0,35856515,59551875,
+    438104227,0,0,371753073,78705043,361177235,0,0,
+    0,0,0,0,0,0,486875235,0,
+    0,0,3440675,0,0,0,0,62509205,
+    0,0,0,67633235,423788627,0,128503955,0,
+    0,3641427,56275235,78442801,348278947,392941811,463204579,0,
+    0,0,0,0,0,0,0,0,
+    0,0,97714243,377229587,98521379,225747331,474808419,0,
+    483823811,0,0,0,0,0,0,0,
+    0,43688067,179278131,0,137044067,0,344797379,166555747,
+    0,0,0,0,0,0,0,249716931,
+    94089299,0,0,0,323862643,366665859,383078675,324952211,
+    386736211,0,375246995,0,0,449618227,238272675,121889027,
+    385470515,0,0,144912627,0,0,327393507,0,
+    337776883,183120113,134824035,76574819,455594243,0,0,0,
+    444666099,0,0,0,0,0,0,473919811,
+    62062659,0,0,0,0,0,483434643,0,
+    370397427,0,0,0,43163811,0,0,325783667,
+    0,68071507,51704081,375218275,78639345,59420787,0,271429731,
+    445337779,0,429572819,317165699,0,0,112541779,0,
+    0,0,0,165445731,174235891,25153763,334656017,169406707,
+    367255715,0,0,0,76714099,161902675,0,3817507,
+    325369955,0,0,0,0,0,0,3989539,
+    0,0,0,0,322244771,224284771,0,0,
+    0,353145155,361492515,454893731,326885443,283824179,0,164614307,
+    0,0,0,0,0,0,0,0,
+    0,47640723,133619811,0,482554099,0,311656547,215871571,
+    166584419,321347859,130719827,334504465,291651845,0,0,89440435,
+    0,0,0,0,0,0,406417571,0,
+    0,0,0,412209299,331567489,0,0,0,
+    0,0,0,0,0,0,0,0,
+    278364323,0,0,0,274083939,372551923,0,0,
+    0,0,0,0,56402163,0,0,0,
+    0,352059475,0,0,0,0,282640483,0,
+    0,386404547,285487315,0,0,0,0,0,
+    0,0,0,0,0,0,463458467,0,
+    0,250941699,0,0,0,0,0,0,
+    0,0,406008051,0,0,0,0,0,
+    240152675,268345571,0,132014227,116932995,208105651,304521347,0,
+    22651123,0,0,0,225079491,340013235,0,130695251,
+    0,0,0,0,0,44224867,94462291,165548115,
+    484114579,0,0,0,49062099,210145459,0,0,
+    57471171,0,0,0,0,0,322097251,446513507,
+    0,7225379,0,0,0,239169779,338346227,0,
+    0,155201715,0,304558339,0,139137155,0,0,
+    55759059,0,0,139403347,0,0,79806595,0,
+    0,0,0,0,0,488132755,0,0,
+    0,0,81866803,0,0,0,0,0,
+    0,9986387,0,0,236163315,96407651,273510659,72462371,
+    0,444907715,298479715,0,0,0,0,15315043,
+    242237763,481079491,0,0,0,0,0,0,
+    0,0,0,306380947,480776323,0,0,0,
+    0,0,0,0,33394947,454455539,162541795,0,
+    28254435,0,0,0,0,0,0,0,
+    0,0,132337891,302719219,0,0,297361507,0,
+    0,0,0,0,433774643,0,0,0,
+    0,0,0,0,257605891,0,0,0,
+    0,0,0,307056771,0,0,0,0,
+    0,0,0,0,169472147,398713011,46534787,0,
+    90476675,0,0,97353827,0,0,0,0,
+    0,297189475,0,465060115,156704915,0,0,0,
+    167207123,0,0,0,0,0,363884643,0,
+    0,0,0,320995427,0,134996067,136183907,488972387,
+    0,0,94277939,428430051,131793139,0,0,0,
+    0,0,0,0,0,79495235,0,0,
+    413348051,0,0,0,0,0,0,0,
+    0,267956515,392286419,0,16376371,0,0,269205603,
+    461062435,316977251,54796419,0,0,361300211,0,0,
+    134738019,255627411,0,20062243,154693715,0,0,0,
+    0,381108435,0,0,0,113840371,320520307,66220115,
+    430645427,263876723,223633619,127779043,28557475,49860659,0,68452485,
+    210194579,111939731,161849537,420847715,438366403,0,0,0,
+    0,0,268075043,0,31654131,0,0,0,
+    0,0,367394851,0,0,30826563,0,0,
+    0,0,0,0,0,90116275,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,313315459,0,69865571,0,
+    0,0,272261219,188121235,121245843,0,0,0,
+    0,0,0,0,139829363,0,0,50270483,
+    0,362987667,0,241479971,0,0,0,0,
+    10961043,0,0,0,124174499,0,0,44892451,
+    270483555,0,0,0,35991763,452980963,0,0,
+    0,0,0,0,0,0,8528099,0,
+    0,0,326717523,113905779,0,234467379,0,198951251,
+    309473555,0,0,0,0,181981409,336748611,0,
+    0,0,0,0,246927683,0,0,0,
+    245264643,0,0,0,0,0,451391715,0,
+    0,0,0,0,0,0,0,0,
+    71757923,206901491,0,0,0,0,0,0,
+    0,0,0,0,322744771,0,0,0,
+    395714899,0,0,0,282546227,0,0,0,
+    0,0,0,0,0,0,0,0,
+    288448771,0,0,236941443,404009043,420352243,0,485789843,
+    235712739,124383491,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,362963027,0,371253427,0,70897763,0,
+    0,283652499,9675075,217493651,0,0,0,0,
+    291152131,0,0,116244675,0,0,394142083,0,
+    0,0,0,0,0,0,94015571,0,
+    48955555,84676821,277467427,0,0,0,0,0,
+    247480643,0,0,0,0,237827,0,0,
+    0,63561923,154190195,0,0,226390195,294895715,0,
+    0,0,0,74997939,0,0,0,0,
+    1925155,0,190849299,0,0,0,207413507,392912995,
+    0,110325827,169889891,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,218374371,0,45895939,316248163,0,163442931,
+    222249059,0,12898531,0,0,0,0,0,
+    0,0,481132835,227999955,0,149873027,0,0,
+    0,0,91955443,234328243,0,0,0,228155555,
+    418800163,0,0,111767683,0,262586611,0,0,
+    0,0,0,73077059,0,0,0,0,
+    0,365445299,0,370655363,487661779,0,0,0,
+    0,0,0,0,999459,189972771,51368163,0,
+    163872979,177135715,0,0,0,486711443,474726483,74903907,
+    0,196034803,41844915,196100355,0,0,0,0,
+    0,0,86294755,0,0,0,0,0,
+    0,191766851,387006563,6430867,153161875,0,0,0,
+    0,349597907,0,0,0,0,0,0,
+    362549475,351424723,425377891,432038003,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    132604067,419688547,112840867,475758643,0,0,29516003,109908067,
+    476627075,0,0,0,69636195,0,0,0,
+    0,0,11641075,450818291,0,0,0,0,
+    0,127647859,0,0,0,0,0,0,
+    0,0,0,0,0,0,450654547,0,
+    0,0,0,0,0,0,0,6934659,
+    0,456667411,0,0,0,288248067,0,0,
+    36159571,0,0,363429971,0,0,0,0,
+    0,54157395,0,406745139,0,115830995,476201203,0,
+    45203587,0,0,0,0,0,483271011,0,
+    0,384233747,0,0,0,0,0,0,
+    0,0,0,0,0,0,336003249,200601763,
+    0,89489587,461484275,0,0,0,0,156258355,
+    326701205,71614563,342012003,0,0,0,271028323,0,
+    0,0,0,0,0,146137171,0,0,
+    109510883,0,185954659,0,0,7438435,232829267,0,
+    0,235049059,0,377303315,0,0,0,0,
+    215191747,0,0,0,0,0,350040275,0,
+    63652179,0,0,363094227,0,0,0,0,
+    0,476733603,185122963,0,0,33644693,361504867,0,
+    0,0,0,0,0,0,0,0,
+    0,72589411,460919075,0,0,0,338559235,0,
+    0,0,482619587,0,0,0,0,0,
+    422478019,0,0,0,0,0,234610819,0,
+    194179299,0,0,0,0,0,0,38392003,
+    0,0,0,0,0,130965651,257347907,0,
+    288833795,0,0,0,65261731,0,0,0,
+    0,0,0,0,0,168902771,0,488370275,
+    0,297562211,356381059,0,376291667,0,0,0,
+    0,0,0,0,134451299,0,190525699,203469059,
+    166613091,0,0,0,341950627,0,0,0,
+    154677299,75653347,73887843,164716803,0,0,206823715,273891507,
+    0,0,0,53948451,0,0,0,0,
+    0,0,131416163,485281939,0,0,0,0,
+    447373603,0,0,0,211931411,136212579,80539891,101396611,
+    182575251,0,0,0,0,0,0,10199107,
+    0,0,0,0,0,0,0,0,
+    0,0,0,278122579,0,0,0,19587251,
+    159297811,78725441,0,0,0,0,0,0,
+    0,0,0,0,0,306552979,79581347,215244963,
+    275865955,383328339,326369427,0,354275635,0,0,0,
+    0,0,127918179,0,14217363,0,0,0,
+    0,0,0,0,0,0,0,69652515,
+    365875395,0,362832035,53604483,38838451,0,0,0,
+    0,0,0,47079507,0,0,0,0,
+    9351331,0,484675731,484839523,4100179,0,0,0,
+    0,0,0,278147155,0,0,0,0,
+    0,0,184361043,0,0,287113491,0,270282851,
+    0,441024819,0,0,0,0,0,12333139,
+    110666051,229453939,0,0,0,0,0,0,
+    0,0,414056595,84979859,0,0,0,0,
+    41635875,0,0,371581171,0,0,0,0,
+    0,418410881,0,0,235430051,0,371302531,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,189247859,0,0,0,0,
+    0,0,39964771,49737937,0,0,0,0,
+    0,0,91566355,444121299,91877667,0,0,0,
+    298393699,0,0,0,0,0,0,0,
+    0,51134627,0,0,0,479584483,0,0,
+    315498579,0,0,309624947,0,0,0,240840803,
+    0,398233907,0,0,415383683,0,0,0,
+    0,0,118857907,52023395,60870803,359514339,0,270512227,
+    61841619,0,0,19415203,53321779,213934339,0,0,
+    125927635,0,94408899,0,0,0,0,0,
+    0,43262307,0,0,0,0,55029843,0,
+    0,0,0,0,0,145748307,0,0,
+    0,0,0,0,0,0,56029283,0,
+    0,0,0,0,0,79691859,0,0,
+    204460435,0,304283889,0,0,0,411271411,350228723,
+    31416371,0,0,0,267346131,141062291,0,0,
+    0,0,65458339,0,0,0,0,0,
+    0,309547123,0,80752899,440795411,0,471978227,65016003,
+    86511859,0,0,0,0,0,0,108921139,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,168411251,0,0,
+    0,0,0,256880883,0,0,0,344305763,
+    0,0,227098771,33894563,0,0,0,325742739,
+    0,283406627,365703347,0,0,0,0,34983971,
+    0,288366899,0,0,0,0,0,340369809,
+    130322515,47214835,0,0,0,224506067,0,0,
+    0,162144355,70811747,0,0,0,0,0,
+    185847923,0,475046163,425521251,349380803,424890483,0,234508435,
+    0,0,15880435,0,0,53788803,96333859,0,
+    0,0,0,115134547,0,119988403,97497187,269721699,
+    229589091,0,0,0,0,307331203,0,0,
+    63910225,0,0,0,89538739,0,0,0,
+    423354643,0,229052627,0,0,158216437,0,0,
+    0,0,387072147,0,0,20729891,0,250577107,
+    270770275,382451811,0,0,0,0,87654611,0,
+    467734659,0,338952419,62083155,0,0,0,55165059,
+    0,0,0,0,5177427,48193699,0,0,
+    0,0,324223171,0,0,186835091,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,74359027,0,0,421617747,0,0,
+    57991475,200302835,310972483,0,0,0,225382531,0,
+    0,136384611,299053155,0,0,144040195,0,0,
+    0,0,0,46084275,36753443,235106403,0,42598531,
+    428229379,29442195,0,16802355,147726641,391553315,297734243,361902179,
+    0,0,0,374591699,12230803,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,98164835,0,0,0,0,0,0,
+    0,0,0,0,443035907,0,0,0,
+    0,0,0,0,0,0,0,0,
+    24887427,35385427,0,0,0,465830051,0,0,
+    0,0,0,127574083,286642387,0,0,0,
+    0,314638435,0,77807715,0,0,0,253747507,
+    238608627,0,383181091,369266739,0,0,0,0,
+    0,0,112066787,386785363,0,0,0,0,
+    0,195883283,271343715,0,295354467,0,0,0,
+    0,468816195,0,0,0,0,0,0,
+    209338691,369373459,0,0,0,0,188039315,0,
+    0,0,0,0,0,0,304771395,0,
+    0,0,0,0,0,464900369,0,0,
+    0,0,0,147624211,23965843,13488211,48578691,153690419,
+    0,0,0,67031075,339062915,0,30023939,0,
+    0,0,0,0,0,136527971,273846435,0,
+    98394211,0,99963043,0,242499939,0,0,0,
+    0,0,0,0,323018979,0,0,0,
+    0,0,0,0,0,382062867,0,234275011,
+    126443701,0,0,0,0,0,0,0,
+    0,0,93749347,0,131215459,306753619,73916547,0,
+    0,205291651,0,0,0,317800531,136687651,51617923,
+    6344851,0,0,0,0,192094499,108527731,0,
+    0,23224499,0,135540835,0,0,0,0,
+    0,0,0,0,0,391242051,0,0,
+    402411603,0,0,0,387752147,0,0,108892259,
+    0,0,0,169975907,0,0,0,0,
+    0,0,71270499,0,0,0,0,94064723,
+    386330707,0,125489329,172794067,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,253100307,0,0,0,0,0,
+    0,0,0,84832497,0,465252675,39731443,149246323,
+    40292451,300683459,5152851,0,0,0,0,0,
+    0,344334437,0,439783715,0,0,0,480145603,
+    0,0,0,0,0,154931427,0,0,
+    0,0,0,0,0,383680579,0,0,
+    0,0,0,0,0,0,0,0,
+    69394467,432517299,0,0,0,0,0,150798691,
+    0,110866547,0,0,0,0,0,0,
+    0,292643059,0,0,112509043,0,0,0,
+    0,160051395,0,0,206708931,0,0,0,
+    136269923,185163875,288518339,382775603,0,101707875,0,0,
+    0,0,0,275804387,0,66883731,277291379,152781107,
+    425140451,0,0,0,0,0,0,0,
+    0,0,78164099,0,107270387,120754323,261161059,0,
+    267063731,70467683,183083395,321171555,137334867,431304963,0,0,
+    486457555,0,0,0,0,0,0,0,
+    0,0,402485331,0,0,0,295526499,0,
+    0,0,0,0,0,0,480931939,471478483,
+    0,0,0,0,0,0,0,24080659,
+    369545541,0,0,410636515,0,0,23490595,0,
+    147931203,0,217059539,0,0,0,123699251,0,
+    0,0,0,0,0,105136419,0,0,
+    0,72790115,306475205,0,0,0,0,0,
+    13664483,90058963,0,0,0,0,0,0,
+    0,0,0,0,19562771,0,325337203,0,
+    0,0,0,0,466862339,0,308662449,0,
+    93856019,121958675,439046435,0,0,0,0,326496403,
+    0,433557587,112173171,54808659,0,0,0,157941875,
+    0,372170963,0,223932563,0,0,164892819,0,
+    0,606451,0,0,0,135397475,0,0,
+    0,0,422056131,104247571,0,0,0,0,
+    0,0,0,433717459,0,0,168509555,0,
+    0,374734931,435466467,0,0,0,0,0,
+    100675763,342040755,0,0,0,0,0,0,
+    103219251,0,317202515,0,0,0,0,0,
+    0,475332755,0,356892995,424161555,0,0,0,
+    0,0,0,385687763,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,252104883,4321363,0,0,374898867,0,0,
+    0,0,228753555,0,0,217383027,0,0,
+    0,0,0,0,0,0,114438419,0,
+    0,0,385908803,252584083,0,0,111587475,126795923,
+    0,110018675,197718259,486514835,405786851,0,350900403,359014675,
+    21324051,0,285802579,0,0,0,0,0,
+    449306979,0,0,0,0,18858243,0,0,
+    0,0,0,0,0,0,0,0,
+    276844883,0,352952547,0,0,0,0,0,
+    0,0,0,0,0,50344003,0,0,
+    229314739,0,0,0,0,212713795,0,171471107,
+    0,157257955,0,0,422736163,0,90956067,448372883,
+    0,0,0,0,96854051,215720227,0,0,
+    0,0,0,0,355455315,0,0,417685889,
+    412795123,488714339,434651203,0,0,0,0,0,
+    0,310866051,476094579,0,396144979,0,0,0,
+    0,230985955,332825075,249995507,371052707,0,0,0,
+    0,0,0,95973475,0,296157283,0,0,
+    0,0,0,0,0,263004547,114393251,0,
+    182431953,411378003,0,0,51286099,0,256536723,38125683,
+    0,0,382181475,13922451,418529761,50528515,0,378351891,
+    41058483,0,195309875,0,153931971,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,8462579,0,0,0,0,
+    0,0,0,0,0,0,43954339,0,
+    0,235163747,0,0,0,0,0,0,
+    0,332169585,223776931,281620739,0,0,0,0,
+    0,175710467,40407075,356741363,486092899,0,308007043,0,
+    409002067,0,0,0,0,0,0,0,
+    0,0,0,144285923,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,544803,0,0,0,230224227,306458675,0,
+    0,306421891,0,0,0,0,245039379,318988531,
+    373444723,344977555,53338211,0,0,231817507,0,385286211,
+    0,210333763,299253939,0,28442803,0,0,0,
+    0,367472787,0,327004243,6635779,164376787,0,0,
+    0,0,0,0,16949395,0,0,0,
+    408748515,0,362532915,0,0,435843251,0,0,
+    0,0,0,0,0,0,0,59916531,
+    8888691,0,86085699,0,278278275,95268963,424472883,257118355,
+    381575411,0,0,0,0,0,0,52506963,
+    3903571,0,0,0,0,0,0,0,
+    0,0,0,0,57335891,135282787,0,196399379,
+    360775907,0,0,0,0,407801955,0,0,
+    0,0,0,0,0,0,0,0,
+    0,39981091,268914851,0,199581987,0,364765411,0,
+    92545091,0,0,0,0,0,0,0,
+    480739459,0,116695331,423813315,0,0,0,267731139,
+    0,0,483987555,248078419,0,0,0,0,
+    111853683,0,0,402661459,0,0,0,0,
+    187629715,0,0,0,0,0,487459,0,
+    17633731,97382499,59982051,287891699,0,0,0,263188803,
+    0,313434211,0,0,234418259,36184115,0,324993171,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,279760979,419475619,0,
+    253526227,0,0,0,0,303472851,367100067,0,
+    0,102572163,433971395,0,0,0,0,79012227,
+    0,0,111386803,279486707,0,0,0,0,
+    249110739,0,0,0,0,33235187,0,386908243,
+    0,0,0,0,0,0,0,0,
+    23834851,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,153985139,158281971,0,0,0,0,0,
+    0,18211187,0,0,0,0,0,0,
+    0,0,0,0,389964035,0,0,0,
+    0,0,0,96288867,0,0,0,0,
+    241184867,469397859,69951587,0,0,12423315,405614739,467038467,
+    0,221339795,0,0,0,0,38875171,0,
+    391475395,238432403,349286755,300970179,485871715,0,0,0,
+    0,0,0,0,0,302784819,482672787,0,
+    0,0,0,150540627,0,299954323,0,0,
+    0,0,69922915,0,0,462496163,0,115159251,
+    0,319971507,0,0,321024227,0,0,0,
+    0,0,0,0,0,215290035,253899075,462790899,
+    229363971,0,0,0,0,0,0,0,
+    0,172736723,256946387,0,0,0,0,0,
+    0,352084163,0,0,136929379,0,0,0,
+    0,150159667,0,0,0,69881891,408203539,160928019,
+    0,0,43462819,0,0,0,0,0,
+    0,0,477970531,147378275,0,0,0,0,
+    0,0,377942243,371126483,0,0,0,0,
+    0,0,249823475,0,0,0,94040147,0,
+    0,0,283758707,0,0,0,0,311251123,
+    273707091,0,0,0,0,10236035,0,0,
+    0,0,0,0,248332499,159531091,0,0,
+    139063427,0,0,0,0,0,0,0,
+    0,383275075,0,0,0,239951971,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,431890625,313233555,408875491,
+    0,207483027,0,0,0,0,0,0,
+    320880755,381542515,364511299,0,0,0,58073235,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,64110917,0,0,0,0,0,
+    378196275,0,0,334328435,0,0,416870897,0,
+    286109923,0,96493667,55312467,8227,0,0,0,
+    211345683,0,0,79716419,131387491,0,419229795,0,
+    0,0,0,0,0,0,0,0,
+    0,184438945,424616195,0,0,0,0,0,
+    0,91353363,0,0,0,135712867,0,0,
+    24322275,51978323,103641299,115216611,239464547,0,0,155332899,
+    204194083,70369315,252715059,0,0,478412979,0,0,
+    0,151859475,0,142262531,0,0,42479795,0,
+    0,254116083,0,93806771,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,107335747,
+    42860579,0,0,0,380006675,0,0,0,
+    0,57213011,145838403,109858995,0,0,436265123,337285331,
+    0,0,101978403,0,231960851,0,0,0,
+    450355507,155521155,479477955,0,217981027,0,82309235,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,220123283,274325603,280301715,307515651,0,
+    0,333373889,0,140566739,14590339,0,442593587,0,
+    0,4345971,376074435,361128115,0,0,0,0,
+    0,0,0,0,33992819,0,0,0,
+    241041507,158728243,0,0,0,293879971,0,0,
+    0,0,0,0,0,0,0,47751475,
+    0,0,242696451,0,136601635,432836739,254488723,0,
+    0,133836835,0,0,0,0,71299171,0,
+    0,110498115,288026915,292200659,0,0,0,0,
+    0,0,0,0,114143491,0,173392131,0,
+    107921507,0,0,0,0,0,0,0,
+    0,0,175259939,0,0,0,0,0,
+    0,0,0,438022307,0,0,237633571,0,
+    0,0,0,0,0,0,16081459,0,
+    0,310452403,0,0,434753651,0,233312611,0,
+    0,0,2834563,0,390914131,0,0,163062003,
+    0,285385091,0,0,0,0,0,205738323,
+    0,0,433582243,0,0,393433235,0,184029395,
+    0,0,62488809,0,0,0,0,414859427,
+    0,0,0,0,0,0,122818835,0,
+    0,0,0,0,407564547,0,0,0,
+    0,0,183333027,399597667,487579795,0,0,81780883,
+    0,66449491,0,0,17256609,0,0,435527859,
+    0,0,0,0,0,0,272605283,0,
+    0,31858851,0,0,0,0,56058067,411672675,
+    48455827,0,0,0,0,0,0,0,
+    402645043,0,0,363454611,0,0,0,434298931,
+    0,181297443,200126563,47034531,0,0,3014755,20103331,
+    0,0,0,149148019,0,0,0,0,
+    0,0,119152819,0,0,0,0,369815731,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,399429827,0,
+    0,0,0,0,0,243777651,0,0,
+    0,0,0,88412339,0,0,0,0,
+    252788883,0,0,0,0,55423059,0,56746019,
+    0,0,0,0,0,0,125460547,0,
+    0,0,0,27975923,14954627,0,0,0,
+    0,0,0,0,0,4247635,0,437575907,
+    0,0,0,0,0,0,0,0,
+    44155139,191852819,285827299,476069971,249335907,0,0,246501603,
+    422662419,0,0,0,0,0,0,0,
+    31584371,0,0,0,0,22376739,0,0,
+    0,0,0,0,0,249888883,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,418222627,0,14106899,0,0,0,
+    0,139174051,0,3792931,0,0,39833699,52302051,
+    361365699,487112899,218279987,178380851,0,0,466514003,0,
+    0,0,460288339,0,0,0,0,92151971,
+    0,0,282591411,0,0,222150867,0,0,
+    0,0,0,140234915,0,0,0,0,
+    0,0,0,0,0,0,122208515,0,
+    0,30601283,0,218161349,0,0,0,0,
+    0,0,0,0,0,0,0,273981491,
+    53751939,214569155,0,0,104173843,68526147,475775059,0,
+    0,0,0,0,452194579,13340915,0,0,
+    0,108646499,119693491,130744531,0,0,0,0,
+    0,469217635,317448291,0,76820675,0,0,28491923,
+    67440723,144179347,0,0,0,0,0,0,
+    0,0,0,0,97935459,0,0,0,
+    161718355,0,0,0,0,0,48402627,0,
+    458793203,0,0,0,0,0,83149091,127533203,
+    186314931,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,434380905,0,
+    0,107192483,233226563,0,0,0,26243235,38027379,
+    131444835,402931923,414638243,0,11706707,180699411,0,285544773,
+    0,0,0,0,0,0,0,0,
+    49472019,0,0,0,0,260563267,0,0,
+    0,0,294154323,0,0,0,265453811,0,
+    0,0,0,0,0,0,0,18632883,
+    0,0,0,488341603,0,168149107,0,0,
+    0,0,0,0,96317539,0,0,476541107,
+    0,0,60043571,228532435,20795427,0,0,0,
+    0,0,0,151257363,0,430326483,219631699,295727203,
+    439951651,0,0,0,0,0,0,0,
+    0,0,0,0,0,151933219,0,0,
+    0,0,0,0,0,0,0,0,
+    0,307093635,0,0,0,0,0,0,
+    191361379,471408899,0,0,0,37138531,432218419,227799187,
+    0,243810515,0,0,0,0,0,0,
+    0,305348819,404263123,0,0,0,0,0,
+    305750099,0,0,65619,0,83816643,0,53297235,
+    133546035,0,0,0,0,434925747,441573587,0,
+    0,0,0,0,345477475,61128915,0,0,
+    0,0,0,0,0,55201875,0,304881857,
+    0,231506019,128163923,226730131,359461059,206242035,0,0,
+    53911635,9253123,219750467,312398035,0,346964179,488480867,0,
+    0,106336323,146534739,0,0,270196835,0,0,
+    0,0,39145555,0,0,0,0,0,
+    0,162074723,0,24924275,0,80326835,0,0,
+    53493891,0,0,0,0,0,254251395,0,
+    0,133591139,0,0,0,0,0,69451811,
+    0,0,0,404455571,0,4428003,394993811,196247907,
+    0,1753219,0,0,0,268034131,31051907,0,
+    446173411,0,0,0,133992547,0,71671907,138604643,
+    0,0,0,0,0,0,0,284123283,
+    0,0,0,0,0,487329891,49713187,0,
+    0,0,300331219,0,0,0,286421171,0,
+    0,0,0,0,0,145449347,252330195,0,
+    0,0,0,0,0,0,0,0,
+    417002099,305029283,41107635,479097139,0,36937827,0,0,
+    0,0,0,0,0,0,0,0,
+    0,331870625,267403651,0,0,0,0,0,
+    0,0,393334851,0,240439395,406110387,0,0,
+    0,63463555,128344291,108806227,159019075,240812131,0,0,
+    0,0,0,0,0,304263491,0,282398771,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,165028003,0,0,
+    0,0,325529763,0,167112867,0,0,152076579,
+    0,0,0,0,410698083,0,0,0,
+    0,0,51310803,87052483,105214051,0,0,0,
+    0,0,0,0,11915459,0,0,0,
+    0,245751859,267681971,0,0,157106259,0,477941859,
+    1937475,170234163,0,0,200511525,0,0,448680163,
+    0,0,84553795,0,19189987,0,0,0,
+    12177603,280100963,359166195,138715267,148353315,0,0,0,
+    120463507,0,0,0,0,0,0,0,
+    0,300794019,0,0,0,86782147,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,241406227,230969395,0,0,
+    376274995,55054467,0,0,305512707,0,311300275,0,
+    0,0,0,0,0,82264227,161079571,0,
+    0,0,0,0,0,0,0,0,
+    37752963,40059123,0,0,0,0,0,0,
+    0,0,367902979,488784067,0,301576323,43724867,421838915,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,458268931,0,0,
+    0,0,0,0,170119267,0,208924883,0,
+    400646419,0,174145875,0,71213155,188080275,0,0,
+    0,45101235,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,85881059,0,
+    0,0,0,0,280215651,361689219,318652803,487030931,
+    0,359297139,0,0,0,0,0,0,
+    0,0,90271971,0,0,66437155,370270435,0,
+    421859427,0,484548755,251265363,2281539,293924995,35893539,312004803,
+    0,0,0,235512003,314146931,0,0,191607107,
+    0,158249073,0,0,42238131,346108147,0,0,
+    0,0,0,453112115,0,0,0,0,
+    54943875,164462659,229433411,11440275,173113587,253321427,451989747,0,
+    0,41304243,66535459,296271971,200755,90034259,54255747,372826227,
+    0,0,360476803,0,0,0,213094547,266477811,
+    193356099,0,0,0,0,443498819,0,63885747,
+    0,0,0,0,0,0,470237427,0,
+    0,0,0,436465891,0,0,145617091,144978259,
+    0,0,0,93528339,0,0,0,134594659,
+    0,349487299,0,413741187,0,0,0,253378803,
+    0,0,99291395,0,348229811,147808547,0,0,
+    0,293597251,0,0,0,48672949,0,0,
+    0,455528691,0,38445235,74739827,96866403,0,0,
+    0,361558163,0,0,0,0,40701987,378925347,
+    0,0,301101283,0,0,421056739,44597299,2105491,
+    1957987,126357603,0,0,0,0,411336851,48906419,
+    0,0,434831443,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,363958401,401826099,
+    0,0,0,0,0,0,0,0,
+    172970195,35410115,128151587,441631075,0,143749347,95801443,0,
+    49676371,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,142184739,176767123,63369459,8614019,390512915,229519619,
+    409210979,0,192495923,0,303751411,46178531,0,359674083,
+    0,36851811,0,2043971,0,0,217280707,0,
+    0,0,0,0,0,0,0,0,
+    0,0,329208227,385962147,0,0,399663267,0,
+    114663875,0,207646915,0,0,0,0,120381619,
+    224616739,64196947,0,0,269979747,83513571,383295603,79212691,
+    453984467,0,368652435,0,0,0,0,0,
+    0,0,0,102682691,0,14913683,0,0,
+    238739699,0,0,0,144535955,0,0,0,
+    0,444600563,0,0,40321203,134393955,0,0,
+    0,408277267,0,0,411164819,0,0,0,
+    102535205,480047299,0,383946897,0,337842435,0,0,
+    0,0,0,86728739,0,0,0,0,
+    0,170746083,0,0,386809939,470376723,0,63115411,
+    0,0,0,0,0,0,0,214995059,
+    0,0,0,0,138678403,15180035,182100115,0,
+    155947155,263778419,138367283,379781411,481587491,0,0,108077379,
+    106315843,449401011,0,0,0,0,0,0,
+    0,0,0,435077539,0,0,170147939,176832707,
+    0,0,0,0,0,0,0,0,
+    0,29483123,0,0,0,0,105287843,133304483,
+    8032387,460751203,0,0,0,0,0,424407283,
+    0,0,0,0,39796979,0,315650227,0,
+    0,0,0,0,0,0,406671635,0,
+    40177699,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,135225443,315437283,0,0,0,0,0,
+    0,126668899,171249747,301981907,0,0,0,41500851,
+    0,227573891,0,25002259,109002835,3317795,421216371,110411939,
+    193614147,0,359964963,459809027,0,0,0,0,
+    0,478752979,352383299,420118819,0,0,0,121032947,
+    268136531,189743363,0,0,0,303423667,346914915,466288883,
+    304693537,0,0,0,0,158474355,0,0,
+    0,333333089,0,221094035,0,0,475570307,0,
+    0,0,0,0,340345331,0,363495555,0,
+    0,0,0,0,14180483,0,0,0,
+    0,0,0,380612851,0,130064547,0,412618913,
+    0,0,0,0,269693027,0,0,0,
+    0,0,0,0,423006435,0,0,0,
+    0,0,0,0,312365171,36483347,0,0,
+    0,139391107,0,292258051,240410723,383701171,0,0,
+    0,0,0,0,0,70180963,0,0,
+    0,0,0,0,0,0,0,488398995,
+    0,0,0,118071475,0,0,0,0,
+    0,0,0,171274419,0,0,0,152039555,
+    0,0,140066883,0,312615027,0,0,0,
+    0,0,0,27684947,0,116588691,0,0,
+    0,0,0,312152259,0,0,412897491,0,
+    0,0,131158115,358989907,67842131,0,0,89088083,
+    0,0,0,0,38428723,0,71385187,143261939,
+    0,0,0,0,0,0,1732675,0,
+    85110979,0,0,0,0,0,0,201740499,
+    0,0,0,0,0,0,263712883,0,
+    0,0,0,89247907,278810835,0,346652851,49610899,
+    0,557235,0,468373827,31281251,0,0,0,
+    0,0,33505603,0,330785315,0,0,162824451,
+    471101619,0,0,0,0,0,0,0,
+    0,0,487882947,0,156176547,0,0,0,
+    133877859,0,0,0,0,0,0,0,
+    0,443437283,0,72921123,0,0,0,0,
+    0,188395667,0,85426421,0,0,0,0,
+    0,0,0,0,0,146473187,0,0,
+    470516003,0,0,0,146751555,0,0,0,
+    0,51777651,0,0,0,0,0,0,
+    0,0,485748883,0,0,0,0,0,
+    0,0,0,0,70983779,158888099,171323651,0,
+    0,160235587,323313779,125440067,114598129,393728259,471216211,0,
+    134652003,0,0,26771683,324137107,369320131,476995827,0,
+    0,0,0,0,300249395,0,0,0,
+    0,76198115,0,397988147,0,119791795,66822227,391012499,
+    176038211,0,0,0,0,14397635,0,0,
+    0,0,43417763,0,0,293720179,0,0,
+    0,463630691,0,21889267,178651283,0,0,363913315,
+    282513587,361967779,135897187,0,0,0,0,0,
+    0,0,49422403,0,30323075,205676771,0,169177283,
+    434516275,0,0,0,150712643,0,0,0,
+    0,0,0,306528339,0,0,0,0,
+    240726115,92660003,0,0,0,0,0,0,
+    413081843,0,0,0,0,0,0,0,
+    67817555,41144355,0,293097667,164569251,62443685,0,0,
+    94212339,0,0,0,17055891,0,0,47354019,
+    287564051,0,0,343458067,222798067,151609571,0,104587747,
+    0,0,391729315,0,487399571,99045555,0,0,
+    79515795,235135075,406511875,0,0,0,63500515,0,
+    0,0,0,115716163,0,0,0,34377923,
+    243867715,485077235,0,0,0,0,0,0,
+    0,0,0,195174563,0,0,0,0,
+    296300643,429191891,0,254775667,0,0,0,0,
+    39928051,0,0,0,0,0,0,404881555,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,241819923,0,239751267,484393059,
+    0,0,0,70955107,77590643,34709827,118169779,399347859,
+    451453171,0,0,0,0,0,0,0,
+    76746835,306139219,0,0,0,0,0,0,
+    0,0,41353395,72175651,0,0,0,55484547,
+    0,395215139,6856883,0,0,370499747,0,0,
+    0,0,0,169066547,0,0,0,0,
+    385024179,0,0,0,78545169,0,0,0,
+    0,0,462385571,0,0,476045395,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,1892419,122114403,27037939,383721571,295010403,0,0,
+    0,0,149053795,419840227,308126003,34631795,0,0,
+    0,0,216703107,72274019,434331827,0,0,0,
+    0,0,0,322478259,271630435,294252627,370831555,0,
+    0,0,0,0,0,0,9396515,0,
+    0,0,0,0,0,168247411,0,0,
+    0,0,0,0,0,0,0,296415331,
+    0,0,0,77373539,0,0,0,0,
+    0,0,0,0,1466483,0,0,0,
+    185327843,0,361726115,0,415670515,0,40652835,152453427,
+    292372723,448159891,0,0,26833171,0,0,0,
+    306704563,3416099,0,0,0,0,0,0,
+    144109827,0,199737635,0,92483731,0,0,0,
+    214872147,0,0,0,443375843,0,248209571,273940627,
+    144781491,0,156446995,0,0,0,46571763,0,
+    0,0,0,322355411,0,0,79663171,361218355,
+    0,0,0,0,0,0,0,0,
+    111030387,0,319303795,0,0,0,0,235077731,
+    0,0,0,0,0,0,0,84508915,
+    0,0,385360099,0,0,0,331358835,0,
+    0,36229219,0,0,0,0,0,0,
+    124088387,0,255361267,0,0,0,113606785,390775027,
+    0,0,0,0,186364019,0,0,224800995,
+    4026451,430694723,0,270008419,0,27553859,0,424923283,
+    405000387,0,0,321536099,0,0,0,0,
+    0,0,410792211,291721365,0,289710387,0,0,
+    485007507,0,0,434729043,0,0,341172467,356094179,
+    0,0,0,0,0,0,87310515,179048707,
+    302039299,0,0,0,108560499,162472195,249167987,306065539,
+    0,0,259670131,0,0,0,0,0,
+    0,0,84086915,289390707,0,0,0,0,
+    0,268329011,414527635,0,287637779,0,0,0,
+    0,0,0,0,0,0,0,0,
+    94609571,0,0,0,0,0,325296275,218796147,
+    0,123793731,244179251,23548163,454246627,0,0,11481203,
+    0,0,0,1356115,0,0,0,0,
+    376766643,0,188436627,210538707,456859779,0,44814627,218067075,
+    0,0,0,201490739,0,0,0,141529379,
+    325099603,0,341713107,178622563,0,0,0,0,
+    0,0,0,23404659,306102403,0,67743827,0,
+    0,0,0,317006035,0,0,0,132649059,
+    0,424116387,301474067,0,0,0,0,0,
+    0,178749697,0,343711827,0,0,0,0,
+    0,0,0,0,0,0,444244147,0,
+    230838435,0,425291875,0,0,295067747,338723091,0,
+    0,113709283,0,290295875,151728371,52265091,0,0,
+    0,0,0,410165509,0,481915075,74457283,0,
+    0,0,0,0,0,0,205828307,0,
+    0,0,119447731,236978419,0,0,0,0,
+    0,0,0,7680099,0,0,0,0,
+    399388819,0,0,130633779,1445955,19165267,207761539,85270595,
+    348700947,437108963,0,0,0,0,0,0,
+    0,0,0,0,0,0,64520387,102609171,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,465449331,
+    0,125649011,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    4702595,0,0,0,0,297218147,0,138236067,
+    0,761891,0,0,111534275,0,0,0,
+    0,0,280375411,0,0,0,0,0,
+    315855043,4124755,0,138494099,139665507,0,412250275,0,
+    180834611,0,418366003,0,0,0,290689219,0,
+    0,0,0,260104451,0,0,0,0,
+    0,54218883,88748115,0,0,0,0,205451347,
+    264138867,92524611,0,77209779,0,0,0,0,
+    0,0,0,82940163,163569763,0,0,0,
+    182353971,0,0,0,186917011,0,0,0,
+    313884803,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,49203,194949395,0,0,0,0,
+    69124451,137916547,0,237285635,0,0,0,15089747,
+    411074899,67403811,319115443,0,0,160387331,79253603,117625091,
+    228651075,291885331,321933507,0,0,0,170205283,0,
+    0,0,0,0,0,0,478666963,364023939,
+    2302211,145244307,115998915,165875939,297963619,316719251,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,255484099,0,0,0,3915811,476127507,
+    0,0,0,0,0,0,0,167637155,
+    0,170516659,0,0,0,184344627,0,382247123,
+    0,0,188518499,0,0,0,0,0,
+    407347491,0,454381843,386310211,0,82010195,0,56352947,
+    203538691,0,0,54882387,0,0,0,0,
+    320798867,0,434438355,0,0,0,0,0,
+    0,0,0,90820819,0,0,127315,0,
+    0,0,0,0,0,0,0,0,
+    220930195,0,0,0,319254707,393498771,153833843,258486515,
+    100061379,2994243,63299843,265883891,0,0,0,0,
+    0,0,3743779,345145507,0,0,0,0,
+    0,109150275,114511923,358379875,0,0,0,435638451,
+    0,0,0,0,0,0,0,0,
+    0,0,0,88506659,0,457761107,411730003,467341587,
+    0,0,0,0,0,451821763,0,0,
+    314314867,0,0,0,38289587,0,0,0,
+    223691075,443695251,458490067,0,0,0,0,0,
+    0,0,0,21557571,0,0,0,0,
+    0,0,0,419311875,0,0,0,0,
+    0,224694499,0,0,129368211,0,451309875,0,
+    380080419,0,0,0,0,0,124539219,0,
+    111153203,0,0,0,0,0,0,1617987,
+    364372179,136642659,62570677,0,183279809,0,0,0,
+    0,0,0,0,161497395,0,0,0,
+    0,113541249,79188051,297332835,0,0,0,0,
+    276562243,415473811,0,440213763,0,31170723,0,131272803,
+    377598195,375628019,0,0,0,296730723,343330963,0,
+    0,82374995,0,0,0,0,0,0,
+    337207587,0,0,0,365789283,0,0,285048963,
+    73531507,299844003,296874083,128102579,343245123,327201059,59355379,165691619,
+    279245219,0,0,0,0,0,0,0,
+    414998675,0,106864739,0,34697251,219795603,0,135475,
+    0,424804675,0,0,0,17650049,347132003,0,
+    0,0,0,170451187,0,245833955,0,0,
+    0,0,0,0,71872611,0,0,0,
+    415866979,360042627,0,0,0,309010611,305184931,76517587,
+    0,0,0,0,0,0,201224307,0,
+    0,480403587,0,0,27512899,0,0,41992371,
+    89342115,42188979,0,0,0,0,58462499,0,
+    0,374759523,0,0,0,132559011,455237859,0,
+    0,111120499,234442835,0,0,0,0,0,
+    481730803,0,268632307,354922835,427610915,457556195,0,0,
+    0,0,0,272089187,0,43671603,69578851,396988707,
+    0,0,0,59093251,145924307,0,0,274727203,
+    0,0,0,0,0,215081155,0,284831795,
+    0,0,0,216289347,0,0,89387203,121098467,
+    0,0,0,0,0,84734195,0,0,
+    87552147,369283203,282001667,26906899,0,277651715,0,0,
+    0,232542451,0,0,0,295383139,403370131,0,
+    324428083,0,269406307,307585267,375201957,34160867,126386387,0,
+    0,0,0,407699699,95887459,244461635,223265043,297848931,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,476663955,
+    0,139292803,249508163,0,0,271687779,95383651,252215571,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,387203219,133169395,0,0,
+    0,0,328102387,294350931,0,0,0,0,
+    0,0,0,0,0,0,0,0,
+    0,49832035,0,0,0,0,0,0,
+    0,0,0,0,0,0,311021651,0,
+    0,67719251,0,0,0,41340963,0,0,
+    0,413687875,0,0,0,124018945,2240659,284606691,
+    0,0,220397715,0,0,0,469655859,0,
+    0,0,150069587,0,0,0,238317843,0,
+    0,0,413475107,199880947,50192483,470110467,0,0,
+    0,0,111886403,3465315,146874723,77859,438149491,0,
+    475304035,435032227,0,0,0,0,174043523,89862211,
+    53567619,0,0,0,0,0,0,25894995,
+    0,0,52002883,321421555,0,0,0,71069795,
+    0,0,0,275439699,39354595,0,0,0,
+    320045155,0,0,0,72560739,169554147,0,0,
+    0,0,0,0,0,0,0,0,
+    0,0,67,0,261095667,0,0,0,
+    305828035,0,0,0,0,0,160604323,0,
+    134307939,106893491,460218627,0,0,0,0,456323283,
+    0,0,425664595,0,0,474321171,0,0,
+    0,0,0,0,0,81821859,459743475,247247107,
+    68132899,0,0,0,0,332382643,0,339325107,
+    0,0,0,0,18133283,39899235,21139651,126341171,
+    467108083,333820563,291500213,417018417,0,0,0,409538771,
+    0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,474157107,
+    0,0,0,0,0,0,0,897235,
+    0,0,0,0,158363779,0,116166947,0,
+    0,0,0,0,24785091,223101075,0,60465395,
+    0,0,0,0,0,0,0,10866787,
+    0,0,0,0,95240291,0,420995299,0,
+    0,0,138850435,0,0,418238945,0,49332291,
+    0,170946897,0,369758419,0,132055107,0,0,
+    0,0,82706675,0,0,0,0,1192051,
+    0,0,32915649,393998483,0,0,0,61645075,
+    62107715,119103667,265949315,0,193880291,0,384520387,0,
+    0,348582131,0,0,0,0,0,0,
+    249442355,269434979,349212947,0,0,0,0,134193251,
+    0,0,0,0,183697571,472744115,198361395,38146083,
+    0,0,193442099,261529923,0,0,284422211,0,
+    0,185733203,0,0,355365203,0,159039667,0,
+    0,0,0,188244115,0,295784547,0,0,
+    0,0,113004675,0,0,10076371,0,0,
+    0,0,0,0,174600451,54292611,0,0,
+    0,0,0,0,463917411,0,0,0,
+    0,0,0,0,0,0,0,406462643,
+    436039955,0,0,0,393593011,0,0,0,
+    0,0,0,311959715,0,0,0,333205937,
+    0,0,0,31215763,294953059,0,0,0,
+    369664197,0,336052643,193294563,116433011,89776227,115573043,296644707,
+    330928675,0,0,127307923,0,0,385929331,0,
+    454095075,0,0,0,95412323,0,164659411,0,
+    0,0,0,0,0,102813905,56758419,0,
+    398147907,0,0,0,0,67891411,305271075,0,
+    0,0,0,0,167764067,0,0,321200419,
+    0,0,0,0,1069267,189522163,373223619,0,
+    0,327499955,0,404148419,0,0,159961187,280408323,
+    387244115,178004291,0,0,0,0,0,0,
+    0,0,95858787,202510515,236724371,292544723,0,0,
+    0,0,0,0,0,0,153284851,270684259,
+    272117859,0,0,0,0,0,225218659,0,
+    0,0,0,0,0,0,0,0,
+    412356819,0,0,0,0,0,184692979,0,
+    245629171,0,360968403,51237043,0,0,0,0,
+    0,401174835,0,0,0,0,73953523,360190099,
+    0,28041605,344363107,0,0,0,0,0,
+    0,0,0,0,0,217155,346583123,411603203,
+    141369619,0,0,386277491,0,0,0,23896323,
+    0,0,0,0,0,0,214298963,0,
+    0,0,101540067,318755155,0,0,97210467,174457123,
+    259121283,0,0,0,219349123,221913235,209576195,434618483,
+    0,0,0,321278211,4186147,0,351359219,0,
+    0,0,0,55922867,0,0,0,0,
+    0,222314659,0,47477043,0,0,0,234831955,
+    0,0,0,143200483,0,0,0,0,
+    190734483,0,0,0,0,0,0,0,
+    0,64024897,3366947,147046579,0,0,0,0,
+    0,0,0,0,139075667,6459427,0,0,
+    0,0,0,0,74019171,0,103948403,0,
+    0,0,0,450179379,0,0,0,125292755,
+    0,0,470450419,0,0,0,0,0,
+    0,0,0,58700051,0,0,0,424276147,
+    268161107,319819955,68169811,0,402337875,0,0,0,
+    0,0,0,0,0,0,0,0,
+    18432243,60661923,269119587,0,0,0,104321555,0,
+    0,0,0,0,0,0,0,67657811,
+    0,0,295870563,0,0,0,0,0,
+    0,0,0,0,218869859,0,0,0,
+    441254211,0,0,0,0,0,365654195,0,
+    205017411,0,0,0,0,294838371,0,0,
+    0,212087075,156958947,27271445,259596355,0,0,0,
+    251789427,464646371,414019715,0,311369955,0,213897347,0,
+    0,3403859,27574531,454308115,0,0,311599203,0,
+    0,36823139,44404947,274055267,0,248549491,0,0,
+    313688147,386711635,0,0,0,0,0,0,
+    0,0,73465971,0,0,0,0,0,
+    0,0,0,185966899,0,0,0,0,
+    0,0,0,0,0,410493203,0,0,
+    0,0,0,0,269779043,136986723,353947955,0,
+    0,0,30142595,0,0,0,0,0,
+    0,0,0,0,187342995,240582755,111689907,182042723,
+    0,0,67559507,0,0,119644339,0,0,
+    265113859,0,396849491,0,0,0,0,0,
+    0,0,0,0,485544083,466554963,155250995,0,
+    69824547,224313427,357081379,0,0,0,0,0,
+    80822371,461385875,0,434397221,142024979,190775571,0,372519027,
+    137670819,0,131006547,143872259,471056547,0,0,0,
+    323522739,0,0,0,0,0,215580915,0,
+    0,488312931,0,121160003,308846771,0,0,0,
+    55648675,126103683,0,0,0,0,428028675,0,
+    0,80879843,56836131,0,0,402534483,0,272777315,
+    0,0,385642659,0,226046227,130429091,0,31719699,
+    94982243,69218547,0,0,0,0,0,0,
+    0,0,0,0,39768163,0,0,109388003,
+    13467715,0,0,0,0,0,0,23371891,
+    0,0,324096147,0,0,0,0,0,
+};
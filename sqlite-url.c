@@ -9,6 +9,12 @@ SQLITE_EXTENSION_INIT1
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #pragma region meta functions
 
 /** url_version()
@@ -34,748 +40,7634 @@ static void urlVersionFunc(sqlite3_context *context, int argc,
  */
 static void urlDebugFunc(sqlite3_context *context, int argc,
                          sqlite3_value **arg) {
-  const char *debug = sqlite3_mprintf(
+  char *debug = sqlite3_mprintf(
       "Version: %s\nDate: %s\nSource: %s\nlibcurl: %s", SQLITE_URL_VERSION,
       SQLITE_URL_DATE, SQLITE_URL_SOURCE, curl_version());
   if (debug == NULL) {
     sqlite3_result_error_nomem(context);
     return;
   }
-  sqlite3_result_text(context, debug, -1, SQLITE_TRANSIENT);
-  sqlite3_free((void *)debug);
+  sqlite3_result_text(context, debug, -1, sqlite3_free);
 }
 
 #pragma endregion
 
-#pragma region library functions
+#pragma region stats counters
 
-// Used in most extraction functions.
-static void resultPart(sqlite3_context *context, sqlite3_value *urlValue,
-                       CURLUPart upart) {
-  const char *url = (const char *)sqlite3_value_text(urlValue);
-  char *part;
-  CURLU *h;
-  CURLUcode uc;
-  h = curl_url();
-  if (!h) {
-    sqlite3_result_error_nomem(context);
-    return;
-  }
+// Per-function counters, only compiled in with -DSQLITE_URL_ENABLE_STATS
+// and exposed through the url_stats table. Without the flag every
+// urlStats*() hook below expands to nothing.
 
-  uc =
-      curl_url_set(h, CURLUPART_URL, (const char *)sqlite3_value_text(urlValue),
-                   CURLU_NON_SUPPORT_SCHEME);
-  if (uc) {
-    curl_url_cleanup(h);
-    sqlite3_result_null(context);
-    return;
-  }
+// indexes into url_state.aStats, in the order url_stats lists them
+#define URL_STATS_URL 0
+#define URL_STATS_VALID 1
+#define URL_STATS_SCHEME 2
+#define URL_STATS_USER 3
+#define URL_STATS_PASSWORD 4
+#define URL_STATS_OPTIONS 5
+#define URL_STATS_HOST 6
+#define URL_STATS_PORT 7
+#define URL_STATS_PATH 8
+#define URL_STATS_QUERY 9
+#define URL_STATS_FRAGMENT 10
+#define URL_STATS_ZONEID 11
+#define URL_STATS_ESCAPE 12
+#define URL_STATS_UNESCAPE 13
+#define URL_STATS_QUERYSTRING 14
+#define URL_STATS_QUERY_GET 15
+#define URL_STATS_QUERY_EACH 16
+#define URL_STATS_PARSE 17
+#define URL_STATS_QUERYSTRING_AGG 18
+#define URL_STATS_PATH_EACH 19
+#define URL_STATS_PUBLIC_SUFFIX 20
+#define URL_STATS_DOMAIN 21
+#define URL_STATS_HOST_LABELS 22
+#define URL_STATS_SURT 23
+#define URL_STATS_HOST_REVERSED 24
+#define URL_STATS_HOST_RANGE 25
+#define URL_STATS_NORMALIZE 26
+#define URL_STATS_FINGERPRINT 27
+#define URL_STATS_RESOLVE 28
+#define URL_STATS_HOST_MATCHES 29
+#define URL_STATS_PATTERN_MATCH 30
+#define URL_STATS_PATTERN_EACH 31
+#define URL_STATS_HOST_IP 32
+#define URL_STATS_HOST_IN_CIDR 33
+#define URL_STATS_HOST_CIDR 34
+#define URL_STATS_HOST_ASCII 35
+#define URL_STATS_HOST_UNICODE 36
+#define URL_STATS_QUERY_SET 37
+#define URL_STATS_QUERY_REMOVE 38
+#define URL_STATS_QUERY_KEEP 39
+#define URL_STATS_COUNT 40
 
-  uc = curl_url_get(h, upart, &part, CURLU_NON_SUPPORT_SCHEME);
-  if (uc) {
-    curl_url_cleanup(h);
-    sqlite3_result_null(context);
-    return;
-  }
-  sqlite3_result_text(context, part, -1, SQLITE_TRANSIENT);
-  curl_free(part);
-  curl_url_cleanup(h);
-}
+#ifdef SQLITE_URL_ENABLE_STATS
 
-/** url(url [, name1, value1], [...])
- * Generate a URL. The first "url" parameter is a base URL that is parsed, and
- *can be overwritten by the other parameters. If "url" is null or the empty
- *string, Then only the other parameters are used. "nameN" parameters must be
- *one of the following:
- *  - "scheme":
- *  - "host":
- *  - "path":
- *  - "query":
- *  - "fragment":
- **/
-static void urlFunc(sqlite3_context *context, int argc, sqlite3_value **argv) {
-  CURLU *h;
-  CURLUcode uc;
-  h = curl_url();
-  if (!h) {
-    sqlite3_result_error_nomem(context);
-    return;
-  }
-  if (argc % 2 != 1) {
-    sqlite3_result_error(context, "url() requires odd number of arguments", -1);
-    return;
-  }
+#ifdef _WIN32
+#include <windows.h>
+#define URL_THREAD_LOCAL __declspec(thread)
+#else
+#include <time.h>
+#define URL_THREAD_LOCAL __thread
+#endif
 
-  if (sqlite3_value_bytes(argv[0]) > 0 &&
-      sqlite3_value_type(argv[0]) != SQLITE_NULL) {
-    const char *url = (const char *)sqlite3_value_text(argv[0]);
-    uc = curl_url_set(h, CURLUPART_URL, url, CURLU_NON_SUPPORT_SCHEME);
-    if (uc) {
-      curl_url_cleanup(h);
-      sqlite3_result_error(context, "Error initializating URL in the first argument", -1);
-      return;
-    }
-  }
-  for (int i = 1; i < argc; i += 2) {
-    char *partName = (char *)sqlite3_value_text(argv[i]);
-    char *partValue = (char *)sqlite3_value_text(argv[i + 1]);
+static const char *const azUrlStatsName[URL_STATS_COUNT] = {
+    "url",
+    "url_valid",
+    "url_scheme",
+    "url_user",
+    "url_password",
+    "url_options",
+    "url_host",
+    "url_port",
+    "url_path",
+    "url_query",
+    "url_fragment",
+    "url_zoneid",
+    "url_escape",
+    "url_unescape",
+    "url_querystring",
+    "url_query_get",
+    "url_query_each",
+    "url_parse",
+    "url_querystring_agg",
+    "url_path_each",
+    "url_public_suffix",
+    "url_domain",
+    "url_host_labels",
+    "url_surt",
+    "url_host_reversed",
+    "url_host_range",
+    "url_normalize",
+    "url_fingerprint",
+    "url_resolve",
+    "url_host_matches",
+    "url_pattern_match",
+    "url_pattern_each",
+    "url_host_ip",
+    "url_host_in_cidr",
+    "url_host_cidr",
+    "url_host_ascii",
+    "url_host_unicode",
+    "url_query_set",
+    "url_query_remove",
+    "url_query_keep",
+};
 
-    if (sqlite3_stricmp(partName, "host") == 0) {
-      uc = curl_url_set(h, CURLUPART_HOST, partValue, CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'host' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "path") == 0) {
-      uc = curl_url_set(h, CURLUPART_PATH, partValue, CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'path' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "scheme") == 0) {
-      uc = curl_url_set(h, CURLUPART_SCHEME, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, curl_url_strerror(uc), -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "query") == 0) {
-      uc =
-          curl_url_set(h, CURLUPART_QUERY, partValue, CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'query' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "fragment") == 0) {
-      uc = curl_url_set(h, CURLUPART_FRAGMENT, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'fragment' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "user") == 0) {
-      uc = curl_url_set(h, CURLUPART_USER, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'user' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "password") == 0) {
-      uc = curl_url_set(h, CURLUPART_PASSWORD, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'password' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "options") == 0) {
-      uc = curl_url_set(h, CURLUPART_OPTIONS, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'options' value", -1);
-        return;
-      }
-    } else if (sqlite3_stricmp(partName, "zoneid") == 0) {
-      uc = curl_url_set(h, CURLUPART_ZONEID, partValue,
-                        CURLU_NON_SUPPORT_SCHEME);
-      if (uc) {
-        curl_url_cleanup(h);
-        sqlite3_result_error(context, "Invalid 'zoneid' value", -1);
-        return;
-      }
-    } else {
-      sqlite3_result_error(
-          context, sqlite3_mprintf("unknown url part '%s'", partName), -1);
-      return;
-    }
-  }
-  char *out;
-  int rc = curl_url_get(h, CURLUPART_URL, &out, CURLU_NON_SUPPORT_SCHEME);
-  if (rc) {
-    sqlite3_result_error(context, curl_url_strerror(rc), -1);
+// Latency buckets, bucket i counts calls that took [2^i, 2^(i+1)) ns.
+#define URL_STATS_BUCKETS 32
 
-  } else {
-    sqlite3_result_text(context, out, -1, SQLITE_TRANSIENT);
-    curl_free(out);
-  }
+typedef struct url_stats url_stats;
+struct url_stats {
+  sqlite3_int64 nCall;
+  // invalid URLs and failed url() calls
+  sqlite3_int64 nFailure;
+  sqlite3_int64 nBytesIn;
+  sqlite3_int64 nBytesOut;
+  sqlite3_int64 nAlloc;
+  sqlite3_int64 nNanos;
+  sqlite3_int64 aLatency[URL_STATS_BUCKETS];
+};
 
-  curl_url_cleanup(h);
+// Counters of the function currently running on this thread, or NULL.
+static URL_THREAD_LOCAL url_stats *pUrlStatsActive = 0;
+
+static sqlite3_int64 urlStatsNow(void) {
+#ifdef _WIN32
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+  if (!freq.QuadPart)
+    QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return (sqlite3_int64)(now.QuadPart * (1e9 / freq.QuadPart));
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (sqlite3_int64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
 }
 
-/** url_valid(url, [strict])
- ** Returns 1 if url is a well-formed URL according to libcurl.
- ** Returns 0 otherwise.
- ** @arg url - URL to check validness
- ** @example
- ** ```sql
- ** select url_valid('https://google.com'); // -> 1
- ** select url_valid('invalid'); // -> 0
- ** ```
- **/
-static void urlValidFunc(sqlite3_context *context, int argc,
-                         sqlite3_value **argv) {
-  const char *url = (const char *)sqlite3_value_text(argv[0]);
-  CURLU *h;
-  CURLUcode uc;
-  h = curl_url();
-  if (!h) {
-    sqlite3_result_error_nomem(context);
+// Times one function call, or one table function scan across its
+// xFilter/xNext/xColumn calls.
+typedef struct url_stats_timer url_stats_timer;
+struct url_stats_timer {
+  // counters being updated, NULL when stopped
+  url_stats *pStats;
+  // pUrlStatsActive to restore on pause, for nested calls
+  url_stats *pPrev;
+  sqlite3_int64 resumed;
+  // time spent running so far
+  sqlite3_int64 nNanos;
+};
+
+static void urlStatsTimerResume(url_stats_timer *p) {
+  p->pPrev = pUrlStatsActive;
+  pUrlStatsActive = p->pStats;
+  p->resumed = urlStatsNow();
+}
+
+static void urlStatsTimerPause(url_stats_timer *p) {
+  sqlite3_int64 elapsed = urlStatsNow() - p->resumed;
+  p->nNanos += elapsed;
+  p->pStats->nNanos += elapsed;
+  pUrlStatsActive = p->pPrev;
+}
+
+// Records the latency of the call or scan timed so far, if any.
+static void urlStatsTimerStop(url_stats_timer *p) {
+  int i = 0;
+  if (!p->pStats)
     return;
-  }
+  while (i < URL_STATS_BUCKETS - 1 && (p->nNanos >> (i + 1)) > 0)
+    i++;
+  p->pStats->aLatency[i]++;
+  p->pStats = 0;
+}
 
-  uc = curl_url_set(h, CURLUPART_URL, url, CURLU_NON_SUPPORT_SCHEME);
-  if (uc) {
-    sqlite3_result_int(context, 0);
-  } else {
-    sqlite3_result_int(context, 1);
+// Stops any previous call on p, then counts and resumes a new call on
+// pStats with the given arguments.
+static void urlStatsTimerStart(url_stats_timer *p, url_stats *pStats,
+                               int argc, sqlite3_value **argv) {
+  urlStatsTimerStop(p);
+  p->pStats = pStats;
+  p->nNanos = 0;
+  pStats->nCall++;
+  for (int i = 0; i < argc; i++) {
+    int type = sqlite3_value_type(argv[i]);
+    if (type == SQLITE_TEXT || type == SQLITE_BLOB)
+      pStats->nBytesIn += sqlite3_value_bytes(argv[i]);
   }
-
-  curl_url_cleanup(h);
+  urlStatsTimerResume(p);
 }
 
-/** url_host(url)
- * Returns the host portion of the given URL.
- */
-static void urlHostFunc(sqlite3_context *context, int argc,
-                        sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_HOST);
+#define urlStatsAlloc()                                                        \
+  (pUrlStatsActive ? (void)pUrlStatsActive->nAlloc++ : (void)0)
+#define urlStatsFailure()                                                      \
+  (pUrlStatsActive ? (void)pUrlStatsActive->nFailure++ : (void)0)
+#define urlStatsBytesOut(n)                                                    \
+  (pUrlStatsActive ? (void)(pUrlStatsActive->nBytesOut += (n)) : (void)0)
+
+#else
+
+#define urlStatsTimerResume(p) ((void)0)
+#define urlStatsTimerPause(p) ((void)0)
+#define urlStatsTimerStop(p) ((void)0)
+#define urlStatsTimerStart(p, pStats, argc, argv) ((void)0)
+#define urlStatsAlloc() ((void)0)
+#define urlStatsFailure() ((void)0)
+#define urlStatsBytesOut(n) ((void)0)
+
+#endif
+
+#pragma endregion
+
+#pragma region url parser
+
+// Components of a parsed URL, in the same order as libcurl's CURLUPart
+// (minus CURLUPART_URL).
+#define URL_PART_SCHEME 0
+#define URL_PART_USER 1
+#define URL_PART_PASSWORD 2
+#define URL_PART_OPTIONS 3
+#define URL_PART_HOST 4
+#define URL_PART_PORT 5
+#define URL_PART_PATH 6
+#define URL_PART_QUERY 7
+#define URL_PART_FRAGMENT 8
+#define URL_PART_ZONEID 9
+#define URL_PART_COUNT 10
+
+static const CURLUPart urlPartCurl[URL_PART_COUNT] = {
+    CURLUPART_SCHEME, CURLUPART_USER, CURLUPART_PASSWORD, CURLUPART_OPTIONS,
+    CURLUPART_HOST,   CURLUPART_PORT, CURLUPART_PATH,     CURLUPART_QUERY,
+    CURLUPART_FRAGMENT, CURLUPART_ZONEID};
+
+// Which parser fills a url_parts, see url_config('parser').
+#define URL_PARSER_NATIVE 0
+#define URL_PARSER_CURL 1
+
+// Same limits libcurl applies to URLs and schemes.
+#define URL_MAX_INPUT_LENGTH 8000000
+#define URL_MAX_SCHEME_LENGTH 40
+
+typedef struct url_parts url_parts;
+struct url_parts {
+  // boolean, if the URL was parsed successfully
+  int valid;
+  // offset of every component, or -1 if the component is missing. Offsets
+  // below nUrl are slices of the parsed URL itself, the rest point into
+  // zExtra at (offset - nUrl).
+  int aOff[URL_PART_COUNT];
+  // length of every component, in bytes
+  int aLen[URL_PART_COUNT];
+  // length of the parsed URL
+  int nUrl;
+  // components that are not verbatim slices of the URL, like a lowercased
+  // scheme or a path with dot segments removed
+  char *zExtra;
+  int nExtra;
+  int nExtraAlloc;
+  // boolean, if zExtra was grown onto the heap and must be freed
+  int extraOnHeap;
+};
+
+// Prepares p to parse a URL of nUrl bytes. aBuf is caller-provided scratch
+// space for normalized components, which in most URLs is plenty so that
+// parsing does not allocate at all.
+static void urlPartsInit(url_parts *p, int nUrl, char *aBuf, int nBuf) {
+  p->valid = 0;
+  for (int i = 0; i < URL_PART_COUNT; i++) {
+    p->aOff[i] = -1;
+    p->aLen[i] = 0;
+  }
+  p->nUrl = nUrl;
+  p->zExtra = aBuf;
+  p->nExtra = 0;
+  p->nExtraAlloc = nBuf;
+  p->extraOnHeap = 0;
 }
 
-/** url_scheme(url)
- * Returns the scheme portion of the given URL.
- */
-static void urlSchemeFunc(sqlite3_context *context, int argc,
-                          sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_SCHEME);
+static void urlPartsFree(url_parts *p) {
+  if (p->extraOnHeap)
+    sqlite3_free(p->zExtra);
+  p->extraOnHeap = 0;
+  p->zExtra = 0;
 }
 
-/** url_path(url)
- * Returns the path portion of the given URL.
- */
-static void urlPathFunc(sqlite3_context *context, int argc,
-                        sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_PATH);
+// Reserves n bytes at the end of zExtra and returns a pointer to them, or
+// NULL on OOM.
+static char *urlPartsReserve(url_parts *p, int n) {
+  if (p->nExtra + n > p->nExtraAlloc) {
+    int nAlloc = p->nExtraAlloc * 2 + n;
+    char *z = sqlite3_malloc(nAlloc);
+    if (!z)
+      return 0;
+    urlStatsAlloc();
+    if (p->nExtra)
+      memcpy(z, p->zExtra, p->nExtra);
+    urlPartsFree(p);
+    p->zExtra = z;
+    p->nExtraAlloc = nAlloc;
+    p->extraOnHeap = 1;
+  }
+  return p->zExtra + p->nExtra;
 }
 
-/** url_query(url)
- * Returns the query portion of the given URL.
- */
-static void urlQueryFunc(sqlite3_context *context, int argc,
-                         sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_QUERY);
+// Records part as the n bytes most recently written with urlPartsReserve().
+static void urlPartsCommit(url_parts *p, int part, int n) {
+  p->aOff[part] = p->nUrl + p->nExtra;
+  p->aLen[part] = n;
+  p->nExtra += n;
 }
 
-/** url_fragment(url)
- * Returns the fragment portion of the given URL.
- */
-static void urlFragmentFunc(sqlite3_context *context, int argc,
-                            sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_FRAGMENT);
+// Records part as a copy of z, for components that can't be a slice of
+// the URL. Returns SQLITE_NOMEM on OOM.
+static int urlPartsSetCopy(url_parts *p, int part, const char *z, int n) {
+  char *zOut = urlPartsReserve(p, n);
+  if (!zOut)
+    return SQLITE_NOMEM;
+  memcpy(zOut, z, n);
+  urlPartsCommit(p, part, n);
+  return SQLITE_OK;
 }
 
-/** url_user(url)
- * Returns the user portion of the given URL.
- */
-static void urlUserFunc(sqlite3_context *context, int argc,
-                        sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_USER);
+static void urlPartsSetSlice(url_parts *p, int part, int iStart, int iEnd) {
+  p->aOff[part] = iStart;
+  p->aLen[part] = iEnd - iStart;
 }
 
-/** url_password(url)
- * Returns the password portion of the given URL.
- */
-static void urlPasswordFunc(sqlite3_context *context, int argc,
-                            sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_PASSWORD);
+// Returns the text of a component that is not missing. zUrl must be the
+// same text the url_parts was parsed from.
+static const char *urlPartsText(const url_parts *p, const char *zUrl,
+                                int part) {
+  int off = p->aOff[part];
+  return off < p->nUrl ? zUrl + off : p->zExtra + (off - p->nUrl);
 }
 
-/** url_options(url)
- * Returns the options portion of the given URL.
- */
-static void urlOptionsFunc(sqlite3_context *context, int argc,
-                           sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_OPTIONS);
+// Points *pz and *pn to the text of part and returns 1 if the URL has it,
+// returns 0 otherwise.
+static int urlPartsGet(const url_parts *p, const char *zUrl, int part,
+                       const char **pz, int *pn) {
+  if (p->aOff[part] < 0)
+    return 0;
+  *pz = urlPartsText(p, zUrl, part);
+  *pn = p->aLen[part];
+  return 1;
 }
 
-/** url_port(url)
- * Returns the port portion of the given URL.
- */
-static void urlPortFunc(sqlite3_context *context, int argc,
-                        sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_PORT);
+#define urlIsDigit(c) ((c) >= '0' && (c) <= '9')
+#define urlIsAlpha(c) (((c) | 0x20) >= 'a' && ((c) | 0x20) <= 'z')
+#define urlIsUpper(c) ((c) >= 'A' && (c) <= 'Z')
+#define urlToLower(c) ((unsigned char)(urlIsUpper(c) ? (c) | 0x20 : (c)))
+
+static int urlHexValue(char c) {
+  if (urlIsDigit(c))
+    return c - '0';
+  if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+    return (c | 0x20) - 'a' + 10;
+  return -1;
 }
 
-/** url_zoneid(url)
- * Returns the zoneid portion of the given URL.
- */
-static void urlZoneidFunc(sqlite3_context *context, int argc,
-                          sqlite3_value **argv) {
-  resultPart(context, argv[0], CURLUPART_ZONEID);
+// Returns the index of the first occurence of c in z[iStart..iEnd), or iEnd.
+static int urlFind(const char *z, int iStart, int iEnd, char c) {
+  const char *p = memchr(z + iStart, c, iEnd - iStart);
+  return p ? (int)(p - z) : iEnd;
 }
 
-/** url_escape(url)
- * Escape the given text.
- */
-static void urlEscapeFunc(sqlite3_context *context, int argc,
-                          sqlite3_value **argv) {
-  int n = sqlite3_value_bytes(argv[0]);
-  char *s = (char *)sqlite3_value_text(argv[0]);
-  /*if(n > CURL_MAX_INPUT_LENGTH) {
-    sqlite3_result_error(context, sqlite3_mprintf("curl input limit is %d",
-  CURL_MAX_INPUT_LENGTH), -1); return;
-  }*/
-  CURL *curl = curl_easy_init();
-  if (!curl) {
-    sqlite3_result_error_nomem(context);
-  }
+// libcurl file: URLs on non-Windows systems reject DOS drive letters, like
+// "c:/" or "C|".
+static int urlIsDrivePrefix(const char *z, int i, int n) {
+  return i + 1 < n && urlIsAlpha(z[i]) &&
+         (z[i + 1] == ':' || z[i + 1] == '|') &&
+         (i + 2 == n || z[i + 2] == '/' || z[i + 2] == '\\');
+}
 
-  char *output = curl_easy_escape(curl, s, n);
-  if (output) {
-    sqlite3_result_text(context, output, -1, SQLITE_TRANSIENT);
-    curl_free(output);
-  } else {
-    sqlite3_result_error(context, "Error escaping argument", -1);
+// Parses 4 dotted-decimal octets strictly, like inet_pton(AF_INET): no
+// leading zeros and every octet at most 255. Returns 1 on success.
+static int urlParseIPv4Strict(const char *z, int n, unsigned char *aOut) {
+  int octets = 0, sawDigit = 0;
+  unsigned int val = 0;
+  for (int i = 0; i < n; i++) {
+    char c = z[i];
+    if (urlIsDigit(c)) {
+      if (sawDigit && val == 0)
+        return 0;
+      val = val * 10 + (c - '0');
+      if (val > 255)
+        return 0;
+      if (!sawDigit) {
+        if (++octets > 4)
+          return 0;
+        sawDigit = 1;
+      }
+    } else if (c == '.' && sawDigit) {
+      if (octets == 4)
+        return 0;
+      aOut[octets - 1] = val;
+      val = 0;
+      sawDigit = 0;
+    } else {
+      return 0;
+    }
   }
-  curl_easy_cleanup(curl);
+  if (octets < 4 || !sawDigit)
+    return 0;
+  aOut[3] = val;
+  return 1;
 }
 
-/** url_unescape(contents)
- * Unescape the given text.
- */
-static void urlUnescapeFunc(sqlite3_context *context, int argc,
-                            sqlite3_value **argv) {
-  int n = sqlite3_value_bytes(argv[0]);
-  char *s = (char *)sqlite3_value_text(argv[0]);
-  /*if(n > CURL_MAX_INPUT_LENGTH) {
-    sqlite3_result_error(context, sqlite3_mprintf("curl input limit is %d",
-  CURL_MAX_INPUT_LENGTH), -1); return;
-  }*/
-  CURL *curl = curl_easy_init();
-  if (!curl) {
-    sqlite3_result_error_nomem(context);
+// Parses an IPv6 address without brackets into 16 bytes, following the
+// same rules as libcurl's inet_pton(AF_INET6). Returns 1 on success.
+static int urlParseIPv6(const char *z, int n, unsigned char *aOut) {
+  unsigned char tmp[16] = {0};
+  int tp = 0, colonp = -1, sawXdigit = 0, i = 0, curtok;
+  unsigned int val = 0;
+  if (n > 0 && z[0] == ':') {
+    if (n < 2 || z[1] != ':')
+      return 0;
+    i = 1;
   }
-  int len;
-  char *output = curl_easy_unescape(curl, s, n, &len);
-  if (output) {
-    sqlite3_result_text(context, output, len, SQLITE_TRANSIENT);
-    curl_free(output);
-  } else {
-    sqlite3_result_error(context, "Error unescaping argument", -1);
+  curtok = i;
+  while (i < n) {
+    char c = z[i++];
+    int h = urlHexValue(c);
+    if (h >= 0) {
+      val = (val << 4) | h;
+      if (++sawXdigit > 4)
+        return 0;
+      continue;
+    }
+    if (c == ':') {
+      curtok = i;
+      if (!sawXdigit) {
+        if (colonp >= 0)
+          return 0;
+        colonp = tp;
+        continue;
+      }
+      if (i == n)
+        return 0;
+      if (tp + 2 > 16)
+        return 0;
+      tmp[tp++] = (val >> 8) & 0xff;
+      tmp[tp++] = val & 0xff;
+      sawXdigit = 0;
+      val = 0;
+      continue;
+    }
+    if (c == '.' && tp + 4 <= 16 &&
+        urlParseIPv4Strict(z + curtok, n - curtok, tmp + tp)) {
+      tp += 4;
+      sawXdigit = 0;
+      break;
+    }
+    return 0;
+  }
+  if (sawXdigit) {
+    if (tp + 2 > 16)
+      return 0;
+    tmp[tp++] = (val >> 8) & 0xff;
+    tmp[tp++] = val & 0xff;
+  }
+  if (colonp >= 0) {
+    int shift = tp - colonp;
+    if (tp == 16)
+      return 0;
+    for (int j = 1; j <= shift; j++) {
+      tmp[16 - j] = tmp[colonp + shift - j];
+      tmp[colonp + shift - j] = 0;
+    }
+    tp = 16;
   }
-  curl_easy_cleanup(curl);
+  if (tp != 16)
+    return 0;
+  memcpy(aOut, tmp, 16);
+  return 1;
 }
 
-/** url_querystring(name1, value1, [...])
- * Generate a query string with the given names and values.
- * Individual segments are automatically escaped.
- * https://url.spec.whatwg.org/#urlencoded-serializing
- */
-static void urlQuerystringFunc(sqlite3_context *context, int argc,
-                               sqlite3_value **argv) {
-  sqlite3 *db = sqlite3_context_db_handle(context);
-  char * errmsg;
-  if (argc < 2) {
-    sqlite3_result_error(
-        context, "at least 2 arguments are required for url_querystring", -1);
-    return;
+// Formats 16 bytes as the shortest IPv6 text form, the same way as
+// libcurl's inet_ntop(AF_INET6). zOut must hold at least 46 bytes. Returns
+// the length of the written text.
+static int urlFormatIPv6(const unsigned char *a, char *zOut) {
+  unsigned int words[8];
+  int bestBase = -1, bestLen = 0, curBase = -1, curLen = 0;
+  char *z = zOut;
+  for (int i = 0; i < 8; i++)
+    words[i] = (a[i * 2] << 8) | a[i * 2 + 1];
+  for (int i = 0; i < 8; i++) {
+    if (words[i] == 0) {
+      if (curBase == -1) {
+        curBase = i;
+        curLen = 1;
+      } else {
+        curLen++;
+      }
+    } else if (curBase != -1) {
+      if (bestBase == -1 || curLen > bestLen) {
+        bestBase = curBase;
+        bestLen = curLen;
+      }
+      curBase = -1;
+    }
   }
-  sqlite3_str *result = sqlite3_str_new(db);
-  CURL *curl = curl_easy_init();
-  if (!curl) {
-    sqlite3_result_error_nomem(context);
-    return;
+  if (curBase != -1 && (bestBase == -1 || curLen > bestLen)) {
+    bestBase = curBase;
+    bestLen = curLen;
   }
+  if (bestBase != -1 && bestLen < 2)
+    bestBase = -1;
 
-  for (int i = 0; i < argc; i += 2) {
-    char *name = (char *)sqlite3_value_text(argv[i]);
-    int nName = sqlite3_value_bytes(argv[i]);
-    if (i != 0) {
-      sqlite3_str_appendchar(result, 1, '&');
+  for (int i = 0; i < 8; i++) {
+    if (bestBase != -1 && i >= bestBase && i < bestBase + bestLen) {
+      if (i == bestBase)
+        *z++ = ':';
+      continue;
     }
-    char *nameOut = curl_easy_escape(curl, name, nName);
-    if (!nameOut) {
-      if((errmsg = sqlite3_mprintf("Error escaping name in argument %d", i))) {
-        sqlite3_result_error(context, errmsg, -1);
-      } else {
-        sqlite3_result_error_nomem(context);
+    if (i != 0)
+      *z++ = ':';
+    // encapsulated IPv4, like ::ffff:1.2.3.4
+    if (i == 6 && bestBase == 0 &&
+        (bestLen == 6 || (bestLen == 5 && words[5] == 0xffff))) {
+      z += sprintf(z, "%u.%u.%u.%u", a[12], a[13], a[14], a[15]);
+      break;
+    }
+    z += sprintf(z, "%x", words[i]);
+  }
+  if (bestBase != -1 && bestBase + bestLen == 8)
+    *z++ = ':';
+  *z = 0;
+  return z - zOut;
+}
+
+// Parses one number of a numeric IPv4 host the way strtoul(z, &end, 0)
+// would: hex with 0x, octal with a leading 0, decimal otherwise. Returns
+// the index after the number, or -1 if it does not fit in 32 bits.
+static int urlParseIPv4Number(const char *z, int i, int n,
+                              unsigned long long *pVal) {
+  unsigned long long val = 0;
+  int base = 10;
+  if (z[i] == '0' && i + 1 < n && (z[i + 1] | 0x20) == 'x' && i + 2 < n &&
+      urlHexValue(z[i + 2]) >= 0) {
+    base = 16;
+    i += 2;
+  } else if (z[i] == '0') {
+    base = 8;
+  }
+  for (; i < n; i++) {
+    int d = urlHexValue(z[i]);
+    if (d < 0 || d >= base)
+      break;
+    val = val * base + d;
+    if (val > 0xffffffffULL)
+      return -1;
+  }
+  *pVal = val;
+  return i;
+}
+
+// Normalizes a numeric IPv4 host, like "0x7f.1" or "1.2.3", into
+// dotted-decimal form. Returns the length written to zOut (at least 16
+// bytes), or 0 if the host is a regular hostname.
+static int urlNormalizeIPv4(const char *z, int n, char *zOut) {
+  unsigned long long parts[4] = {0, 0, 0, 0};
+  unsigned int ip;
+  int count = 0, i = 0;
+  while (1) {
+    if (i >= n || !urlIsDigit(z[i]))
+      return 0;
+    i = urlParseIPv4Number(z, i, n, &parts[count]);
+    if (i < 0)
+      return 0;
+    if (i == n)
+      break;
+    if (z[i] != '.' || count == 3)
+      return 0;
+    count++;
+    i++;
+  }
+  switch (count) {
+  case 0:
+    ip = parts[0];
+    break;
+  case 1:
+    if (parts[0] > 0xff || parts[1] > 0xffffff)
+      return 0;
+    ip = (parts[0] << 24) | parts[1];
+    break;
+  case 2:
+    if (parts[0] > 0xff || parts[1] > 0xff || parts[2] > 0xffff)
+      return 0;
+    ip = (parts[0] << 24) | (parts[1] << 16) | parts[2];
+    break;
+  default:
+    if (parts[0] > 0xff || parts[1] > 0xff || parts[2] > 0xff ||
+        parts[3] > 0xff)
+      return 0;
+    ip = (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8) | parts[3];
+    break;
+  }
+  return sprintf(zOut, "%u.%u.%u.%u", ip >> 24, (ip >> 16) & 0xff,
+                 (ip >> 8) & 0xff, ip & 0xff);
+}
+
+// Parses the bracketed IPv6 host z[iStart..iEnd), including the brackets,
+// and an optional zone id. Returns SQLITE_OK with p->valid untouched on
+// success, -1 on a malformed address, or SQLITE_NOMEM.
+static int urlParseIPv6Host(url_parts *p, const char *z, int iStart,
+                            int iEnd) {
+  int iAddr = iStart + 1, nAddr, nSpan = iEnd - iStart - 2;
+  unsigned char addr[16];
+  char zNorm[48];
+  int nNorm;
+  if (iEnd - iStart < 4 || z[iEnd - 1] != ']')
+    return -1;
+  for (nAddr = 0; nAddr < nSpan; nAddr++) {
+    char c = z[iAddr + nAddr];
+    if (!(urlHexValue(c) >= 0 || c == ':' || c == '.'))
+      break;
+  }
+  if (nAddr != nSpan) {
+    // a zone id like [fe80::1%25eth0] or [fe80::1%eth0]
+    int iZone = iAddr + nAddr + 1, iZoneEnd = iEnd - 1;
+    if (z[iAddr + nAddr] != '%')
+      return -1;
+    if (iZoneEnd - iZone > 2 && z[iZone] == '2' && z[iZone + 1] == '5')
+      iZone += 2;
+    if (iZoneEnd <= iZone || iZoneEnd - iZone > 15 ||
+        urlFind(z, iZone, iZoneEnd, ']') != iZoneEnd)
+      return -1;
+    urlPartsSetSlice(p, URL_PART_ZONEID, iZone, iZoneEnd);
+  }
+  if (!urlParseIPv6(z + iAddr, nAddr, addr))
+    return -1;
+  nNorm = urlFormatIPv6(addr, zNorm);
+  // like libcurl, the address is only replaced by its normalized form when
+  // that is shorter
+  if (nNorm < nAddr) {
+    char *zOut = urlPartsReserve(p, nNorm + 2);
+    if (!zOut)
+      return SQLITE_NOMEM;
+    zOut[0] = '[';
+    memcpy(zOut + 1, zNorm, nNorm);
+    zOut[nNorm + 1] = ']';
+    urlPartsCommit(p, URL_PART_HOST, nNorm + 2);
+  } else if (nAddr != nSpan) {
+    char *zOut = urlPartsReserve(p, nAddr + 2);
+    if (!zOut)
+      return SQLITE_NOMEM;
+    zOut[0] = '[';
+    memcpy(zOut + 1, z + iAddr, nAddr);
+    zOut[nAddr + 1] = ']';
+    urlPartsCommit(p, URL_PART_HOST, nAddr + 2);
+  } else {
+    urlPartsSetSlice(p, URL_PART_HOST, iStart, iEnd);
+  }
+  return SQLITE_OK;
+}
+
+// Bytes that libcurl rejects in a hostname.
+static int urlIsBadHostChar(unsigned char c) {
+  return c <= 0x20 || strchr("/:#?!@{}[]\\$'\"^`*<>=;,+&()", c);
+}
+
+// Parses the (non-IPv6) hostname z[iStart..iEnd), percent-decoding and
+// normalizing numeric IPv4 addresses. Returns SQLITE_OK, -1 on a
+// malformed hostname, or SQLITE_NOMEM.
+static int urlParseHostname(url_parts *p, const char *z, int iStart,
+                            int iEnd) {
+  int n = iEnd - iStart;
+  char zIPv4[16];
+  int nIPv4 = urlNormalizeIPv4(z + iStart, n, zIPv4);
+  if (nIPv4) {
+    if (nIPv4 == n && memcmp(zIPv4, z + iStart, n) == 0)
+      urlPartsSetSlice(p, URL_PART_HOST, iStart, iEnd);
+    else if (urlPartsSetCopy(p, URL_PART_HOST, zIPv4, nIPv4))
+      return SQLITE_NOMEM;
+    return SQLITE_OK;
+  }
+  if (urlFind(z, iStart, iEnd, '%') == iEnd) {
+    for (int i = iStart; i < iEnd; i++) {
+      if (urlIsBadHostChar(z[i]))
+        return -1;
+    }
+    urlPartsSetSlice(p, URL_PART_HOST, iStart, iEnd);
+    return SQLITE_OK;
+  }
+  char *zOut = urlPartsReserve(p, n);
+  int nOut = 0;
+  if (!zOut)
+    return SQLITE_NOMEM;
+  for (int i = iStart; i < iEnd; i++) {
+    unsigned char c = z[i];
+    int hi, lo;
+    if (c == '%' && i + 2 < iEnd && (hi = urlHexValue(z[i + 1])) >= 0 &&
+        (lo = urlHexValue(z[i + 2])) >= 0) {
+      c = (hi << 4) | lo;
+      if (c < 0x20)
+        return -1;
+      i += 2;
+    }
+    if (urlIsBadHostChar(c))
+      return -1;
+    zOut[nOut++] = c;
+  }
+  urlPartsCommit(p, URL_PART_HOST, nOut);
+  return SQLITE_OK;
+}
+
+// Parses "user:password;options" from z[iStart..iEnd). Options are only
+// recognized for the schemes libcurl supports them with.
+static void urlParseUserinfo(url_parts *p, const char *z, int iStart,
+                             int iEnd, int hasOptions) {
+  int psep = urlFind(z, iStart, iEnd, ':');
+  int osep = hasOptions ? urlFind(z, iStart, iEnd, ';') : iEnd;
+  urlPartsSetSlice(p, URL_PART_USER, iStart, psep < osep ? psep : osep);
+  if (psep < iEnd)
+    urlPartsSetSlice(p, URL_PART_PASSWORD, psep + 1,
+                     osep > psep ? osep : iEnd);
+  int iOptionsEnd = psep > osep ? psep : iEnd;
+  if (osep < iEnd && osep + 1 < iOptionsEnd)
+    urlPartsSetSlice(p, URL_PART_OPTIONS, osep + 1, iOptionsEnd);
+}
+
+// Parses the port in z[iStart..iEnd), after the ':'. Returns -1 if it is
+// not a number between 0 and 65535.
+static int urlParsePort(url_parts *p, const char *z, int iStart, int iEnd) {
+  unsigned int port = 0;
+  int i = iStart;
+  if (iStart == iEnd)
+    return SQLITE_OK;
+  for (; i < iEnd; i++) {
+    if (!urlIsDigit(z[i]))
+      return -1;
+    port = port * 10 + (z[i] - '0');
+    if (port > 0xffff)
+      return -1;
+  }
+  // leading zeros are dropped, like libcurl does
+  while (iStart < iEnd - 1 && z[iStart] == '0')
+    iStart++;
+  urlPartsSetSlice(p, URL_PART_PORT, iStart, iEnd);
+  return SQLITE_OK;
+}
+
+// Returns 1 if z[i..iEnd) starts with zPrefix, or is exactly zPrefix when
+// exact is set.
+static int urlHasPrefix(const char *z, int i, int iEnd, const char *zPrefix,
+                        int exact) {
+  int n = strlen(zPrefix);
+  if (exact ? iEnd - i != n : iEnd - i < n)
+    return 0;
+  return memcmp(z + i, zPrefix, n) == 0;
+}
+
+// Returns 1 if z[i..iEnd) starts with a '.', or its escape "%2e" which
+// libcurl also takes as a dot in dot segments, and sets *piNext past it.
+static int urlIsDot(const char *z, int i, int iEnd, int *piNext) {
+  if (i < iEnd && z[i] == '.') {
+    *piNext = i + 1;
+    return 1;
+  }
+  if (i + 2 < iEnd && z[i] == '%' && z[i + 1] == '2' &&
+      (z[i + 2] | 0x20) == 'e') {
+    *piNext = i + 3;
+    return 1;
+  }
+  return 0;
+}
+
+// Returns 1 or 2 if the segment z[i..) up to the next '/' or iEnd is "." or
+// "..", with dots escaped or not, and sets *piNext to its end. Returns 0
+// for other segments.
+static int urlDotSegment(const char *z, int i, int iEnd, int *piNext) {
+  int nDot = 0;
+  while (nDot < 3 && urlIsDot(z, i, iEnd, &i))
+    nDot++;
+  if (nDot == 0 || nDot > 2 || (i < iEnd && z[i] != '/'))
+    return 0;
+  *piNext = i;
+  return nDot;
+}
+
+// Writes the path z[iStart..iEnd) to zOut without its "." and ".."
+// segments, per RFC 3986 section 5.2.4, with "%2e" as a dot like libcurl.
+// zOut can be z + iStart, since the output never gets ahead of the input.
+// Returns the length written.
+static int urlRemoveDotSegments(const char *z, int iStart, int iEnd,
+                                char *zOut) {
+  int nOut = 0, i = iStart, iNext, nDot;
+  while (i < iEnd) {
+    if (z[i] != '/') {
+      // a leading "./" or "../" of a relative path is dropped, and so is a
+      // lone "." or ".."
+      if (urlDotSegment(z, i, iEnd, &iNext)) {
+        i = iNext < iEnd ? iNext + 1 : iNext;
+        continue;
       }
-      
-      curl_easy_cleanup(curl);
-      return;
-    } else {
-      sqlite3_str_appendall(result, nameOut);
-      curl_free(nameOut);
+    } else if ((nDot = urlDotSegment(z, i + 1, iEnd, &iNext)) != 0) {
+      // "/.." drops the last output segment
+      if (nDot == 2) {
+        while (nOut > 0 && zOut[--nOut] != '/')
+          ;
+      }
+      if (iNext == iEnd) {
+        zOut[nOut++] = '/';
+        break;
+      }
+      i = iNext;
+      continue;
     }
-    sqlite3_str_appendchar(result, 1, '=');
-    char *value = (char *)sqlite3_value_text(argv[i + 1]);
-    int nValue = sqlite3_value_bytes(argv[i + 1]);
+    // move the first segment, including its leading '/', to the output
+    do {
+      zOut[nOut++] = z[i++];
+    } while (i < iEnd && z[i] != '/');
+  }
+  return nOut;
+}
 
-    char *valueOut = curl_easy_escape(curl, value, nValue);
-    if (!valueOut) {
-      if((errmsg = sqlite3_mprintf("Error escaping value in argument %d", i+1))) {
-        sqlite3_result_error(context, errmsg, -1);
-      } else {
-        sqlite3_result_error_nomem(context);
+static int urlParsePath(url_parts *p, const char *z, int iStart, int iEnd) {
+  int hasDots = 0, iNext;
+  for (int i = iStart; i < iEnd; i++) {
+    if ((i == iStart || z[i - 1] == '/') && urlIsDot(z, i, iEnd, &iNext)) {
+      hasDots = 1;
+      break;
+    }
+  }
+  // like libcurl, an empty or single character path is the root
+  if (iEnd - iStart <= 1)
+    return urlPartsSetCopy(p, URL_PART_PATH, "/", 1);
+  if (!hasDots) {
+    urlPartsSetSlice(p, URL_PART_PATH, iStart, iEnd);
+    return SQLITE_OK;
+  }
+
+  char *zOut = urlPartsReserve(p, iEnd - iStart);
+  if (!zOut)
+    return SQLITE_NOMEM;
+  urlPartsCommit(p, URL_PART_PATH,
+                 urlRemoveDotSegments(z, iStart, iEnd, zOut));
+  return SQLITE_OK;
+}
+
+// Parses the path, query and fragment that start at z[i].
+static int urlParsePathQueryFragment(url_parts *p, const char *z, int i,
+                                     int n) {
+  int iFragment = urlFind(z, i, n, '#');
+  int iQuery = urlFind(z, i, iFragment, '?');
+  // an empty query or fragment is no query or fragment, like libcurl 8.8
+  // and later without CURLU_GET_EMPTY
+  if (iFragment + 1 < n)
+    urlPartsSetSlice(p, URL_PART_FRAGMENT, iFragment + 1, n);
+  if (iQuery + 1 < iFragment)
+    urlPartsSetSlice(p, URL_PART_QUERY, iQuery + 1, iFragment);
+  return urlParsePath(p, z, i, iQuery);
+}
+
+// Native, single pass replacement for curl_url_set(CURLUPART_URL) with
+// CURLU_NON_SUPPORT_SCHEME. Components are recorded as slices of z
+// wherever libcurl would return them verbatim, so that parsing most URLs
+// never allocates. Sets p->valid when z is a valid URL, and returns
+// SQLITE_NOMEM on OOM.
+static int urlParseNative(const char *z, int n, url_parts *p) {
+  int i, rc, nJunk = 0, iJunk = -1;
+  if (!z || n > URL_MAX_INPUT_LENGTH)
+    return SQLITE_OK;
+  // control characters and spaces are not allowed anywhere
+  for (i = 0; i < n; i++) {
+    unsigned char c = z[i];
+    if (c <= 0x20 || c == 0x7f) {
+      nJunk++;
+      iJunk = i;
+    }
+  }
+
+  // scheme
+  int hasUpper = 0;
+  for (i = 0; i < n && i < URL_MAX_SCHEME_LENGTH; i++) {
+    char c = z[i];
+    if (!(urlIsAlpha(c) || urlIsDigit(c) || c == '+' || c == '-' || c == '.'))
+      break;
+    hasUpper |= urlIsUpper(c);
+  }
+  if (i == 0 || i >= n || z[i] != ':')
+    return SQLITE_OK;
+  int nScheme = i;
+  if (hasUpper) {
+    char *zOut = urlPartsReserve(p, nScheme);
+    if (!zOut)
+      return SQLITE_NOMEM;
+    for (int j = 0; j < nScheme; j++)
+      zOut[j] = urlIsUpper(z[j]) ? z[j] | 0x20 : z[j];
+    urlPartsCommit(p, URL_PART_SCHEME, nScheme);
+  } else {
+    urlPartsSetSlice(p, URL_PART_SCHEME, 0, nScheme);
+  }
+  const char *zScheme = urlPartsText(p, z, URL_PART_SCHEME);
+
+  if (nScheme == 4 && memcmp(zScheme, "file", 4) == 0) {
+    int iPath = 5;
+    // "file:/" is not enough to be a complete file: URL
+    if (n <= 6)
+      return SQLITE_OK;
+    if (z[5] == '/' && z[6] == '/') {
+      iPath = 7;
+      if ((iPath >= n || z[iPath] != '/') && !urlIsDrivePrefix(z, iPath, n)) {
+        // a host is only allowed if it's the local machine
+        if (n - iPath >= 10 &&
+            (sqlite3_strnicmp(z + iPath, "localhost/", 10) == 0 ||
+             sqlite3_strnicmp(z + iPath, "127.0.0.1/", 10) == 0))
+          iPath += 9;
+        else
+          return SQLITE_OK;
       }
-      curl_easy_cleanup(curl);
-      return;
-    } else {
-      sqlite3_str_appendall(result, valueOut);
-      curl_free(valueOut);
     }
+    if (urlIsDrivePrefix(z, iPath, n) ||
+        (iPath < n && z[iPath] == '/' && urlIsDrivePrefix(z, iPath + 1, n)))
+      return SQLITE_OK;
+    if (nJunk) {
+      // libcurl only checks the path for junk after dropping single
+      // character paths, like in "file:\t?query"
+      int iPathEnd = iPath;
+      while (iPathEnd < n && z[iPathEnd] != '?' && z[iPathEnd] != '#')
+        iPathEnd++;
+      if (nJunk > 1 || iPathEnd - iPath != 1 || iJunk != iPath)
+        return SQLITE_OK;
+    }
+    rc = urlParsePathQueryFragment(p, z, iPath, n);
+    if (rc == SQLITE_OK)
+      p->valid = 1;
+    return rc;
   }
 
-  char *res = sqlite3_str_finish(result);
-  if (res == 0) {
-    sqlite3_result_error_code(context, sqlite3_str_errcode(result));
+  if (nJunk)
+    return SQLITE_OK;
+
+  // between 1 and 3 slashes must follow "scheme:"
+  int nSlash = 0;
+  for (i = nScheme + 1; i < n && z[i] == '/'; i++)
+    nSlash++;
+  if (nSlash < 1 || nSlash > 3)
+    return SQLITE_OK;
+
+  // authority: [userinfo@]host[:port]
+  int iAuth = i, iAuthEnd = i;
+  while (iAuthEnd < n && z[iAuthEnd] != '/' && z[iAuthEnd] != '?' &&
+         z[iAuthEnd] != '#')
+    iAuthEnd++;
+  int iHost = iAuth;
+  int iAt = urlFind(z, iAuth, iAuthEnd, '@');
+  if (iAt < iAuthEnd) {
+    int hasOptions =
+        (nScheme == 4 && (memcmp(zScheme, "imap", 4) == 0 ||
+                          memcmp(zScheme, "pop3", 4) == 0 ||
+                          memcmp(zScheme, "smtp", 4) == 0)) ||
+        (nScheme == 5 && (memcmp(zScheme, "imaps", 5) == 0 ||
+                          memcmp(zScheme, "pop3s", 5) == 0 ||
+                          memcmp(zScheme, "smtps", 5) == 0));
+    urlParseUserinfo(p, z, iAuth, iAt, hasOptions);
+    iHost = iAt + 1;
+  }
+  int iHostEnd, iPort;
+  if (iHost < iAuthEnd && z[iHost] == '[') {
+    iHostEnd = urlFind(z, iHost, iAuthEnd, ']');
+    if (iHostEnd == iAuthEnd)
+      return SQLITE_OK;
+    iHostEnd++;
+    if (iHostEnd < iAuthEnd && z[iHostEnd] != ':')
+      return SQLITE_OK;
+    iPort = iHostEnd;
   } else {
-    sqlite3_result_text(context, res, -1, SQLITE_TRANSIENT);
+    iHostEnd = iPort = urlFind(z, iHost, iAuthEnd, ':');
+  }
+  if (iHost == iHostEnd)
+    return SQLITE_OK;
+  if (iPort < iAuthEnd && urlParsePort(p, z, iPort + 1, iAuthEnd))
+    return SQLITE_OK;
+  if (z[iHost] == '[')
+    rc = urlParseIPv6Host(p, z, iHost, iHostEnd);
+  else
+    rc = urlParseHostname(p, z, iHost, iHostEnd);
+  if (rc == SQLITE_NOMEM)
+    return rc;
+  if (rc)
+    return SQLITE_OK;
+
+  rc = urlParsePathQueryFragment(p, z, iAuthEnd, n);
+  if (rc == SQLITE_OK)
+    p->valid = 1;
+  return rc;
+}
+
+// Max number of idle CURLU handles kept per connection.
+#define URL_CURLU_POOL_SIZE 4
+
+// Idle CURLU handles, re-used instead of allocating one per call.
+typedef struct url_curlu_pool url_curlu_pool;
+struct url_curlu_pool {
+  CURLU *ah[URL_CURLU_POOL_SIZE];
+  int n;
+};
+
+// Returns an empty CURLU handle, from the pool when it has one, or NULL on
+// OOM. Must be given back with urlCurluRelease().
+static CURLU *urlCurluAcquire(url_curlu_pool *pPool) {
+  if (pPool->n > 0)
+    return pPool->ah[--pPool->n];
+  CURLU *h = curl_url();
+  if (h)
+    urlStatsAlloc();
+  return h;
+}
+
+// Puts h back in the pool, or frees it when the pool is full.
+static void urlCurluRelease(url_curlu_pool *pPool, CURLU *h) {
+  // a NULL URL clears every part while keeping the handle
+  if (pPool->n < URL_CURLU_POOL_SIZE &&
+      curl_url_set(h, CURLUPART_URL, NULL, 0) == CURLUE_OK)
+    pPool->ah[pPool->n++] = h;
+  else
+    curl_url_cleanup(h);
+}
+
+static void urlCurluPoolClear(url_curlu_pool *pPool) {
+  while (pPool->n > 0)
+    curl_url_cleanup(pPool->ah[--pPool->n]);
+}
+
+// The libcurl "compat" parser, only used when url_config('parser') is
+// "curl". Every component is copied out of libcurl into zExtra. Dot
+// segments and empty queries and fragments are handled the same way as by
+// the native parser whatever the libcurl version, which changed both, so
+// that switching parsers doesn't change results.
+static int urlParseCurl(url_curlu_pool *pPool, const char *z, url_parts *p) {
+  int rc = SQLITE_OK;
+  CURLU *h = urlCurluAcquire(pPool);
+  if (!h)
+    return SQLITE_NOMEM;
+  if (curl_url_set(h, CURLUPART_URL, z,
+                   CURLU_NON_SUPPORT_SCHEME | CURLU_PATH_AS_IS) ==
+      CURLUE_OK) {
+    p->valid = 1;
+    for (int i = 0; i < URL_PART_COUNT && rc == SQLITE_OK; i++) {
+      char *part;
+      CURLUcode uc =
+          curl_url_get(h, urlPartCurl[i], &part, CURLU_NON_SUPPORT_SCHEME);
+      if (uc == CURLUE_OUT_OF_MEMORY)
+        rc = SQLITE_NOMEM;
+      if (uc)
+        continue;
+      int nPart = strlen(part);
+      if (i == URL_PART_PATH) {
+        char *zOut = urlPartsReserve(p, nPart);
+        if (zOut) {
+          urlPartsCommit(p, i, urlRemoveDotSegments(part, 0, nPart, zOut));
+        } else {
+          rc = SQLITE_NOMEM;
+        }
+      } else if (nPart > 0 ||
+                 (i != URL_PART_QUERY && i != URL_PART_FRAGMENT)) {
+        rc = urlPartsSetCopy(p, i, part, nPart);
+      }
+      curl_free(part);
+    }
   }
+  urlCurluRelease(pPool, h);
+  return rc;
+}
 
-  curl_easy_cleanup(curl);
+// Parses z[0..n) with the given URL_PARSER_*. pPool provides the CURLU
+// handles of the libcurl parser.
+static int urlPartsParse(int parser, url_curlu_pool *pPool, const char *z,
+                         int n, url_parts *p) {
+  if (parser == URL_PARSER_CURL)
+    return urlParseCurl(pPool, z, p);
+  return urlParseNative(z, n, p);
 }
 
 #pragma endregion
 
-#pragma region table functions
+#pragma region compiled tables
 
-#pragma region url_query_each
+// url_host_matches() and url_host_in_cidr() compile the table they are given
+// into a lookup structure once, which the connection keeps until a commit may
+// have changed the table, see urlTableGet().
 
-/** select * from url_query_each(query)
- * Table function that returns each sequence in the given
- * query string. Every sequence in the query string returns
- * its own row, and every name and value are pre-escaped.
- * https://url.spec.whatwg.org/#urlencoded-parsing
- */
+typedef struct url_table url_table;
 
-#define URL_QUERY_EACH_COLUMN_ROWID -1
-#define URL_QUERY_EACH_COLUMN_QUERY 0
-#define URL_QUERY_EACH_COLUMN_RAWSEQUENCE 1
-#define URL_QUERY_EACH_COLUMN_NAME 2
-#define URL_QUERY_EACH_COLUMN_VALUE 3
+// Compiles the table zName for the function zFunc into a new compiled table
+// with one reference. Sets *ppTable, or *pzErr to an error message that the
+// caller must free. Returns an SQLite error code.
+typedef int (*url_table_compiler)(sqlite3 *db, const char *zFunc,
+                                  const char *zName, url_table **ppTable,
+                                  char **pzErr);
 
-typedef struct url_query_each_cursor url_query_each_cursor;
-struct url_query_each_cursor {
+// The header every compiled table starts with.
+struct url_table {
+  // references held by the connection and by sqlite3_set_auxdata()
+  int nRef;
+  // the compiler that made it, tables are cached per compiler and name
+  url_table_compiler xCompile;
+  // the table name given to the function, and the schema it is in
+  char *zName;
+  char *zSchema;
+  // SQLITE_FCNTL_DATA_VERSION of zSchema and of temp, where a new table
+  // can shadow zName, when compiled, see urlTableIsStale()
+  unsigned int dataVersion;
+  unsigned int tempVersion;
+  // sqlite3_total_changes64() when last known to be current
+  sqlite3_int64 nChange;
+  // frees what the compiler allocated besides the header, if anything
+  void (*xFree)(url_table *);
+  // next compiled table of the connection
+  url_table *pNext;
+};
+
+static void urlTableUnref(void *p) {
+  url_table *pTable = (url_table *)p;
+  if (pTable && --pTable->nRef == 0) {
+    if (pTable->xFree)
+      pTable->xFree(pTable);
+    sqlite3_free(pTable->zName);
+    sqlite3_free(pTable->zSchema);
+    sqlite3_free(pTable);
+  }
+}
+
+// Returns the SQLITE_FCNTL_DATA_VERSION of the database zSchema, which
+// changes with every commit to it, unlike PRAGMA data_version also those
+// of this connection. 0 when the database is not open.
+static unsigned int urlDataVersion(sqlite3 *db, const char *zSchema) {
+  unsigned int dataVersion = 0;
+  // the version only sees commits of other connections once a read
+  // transaction starts, which PRAGMA data_version does
+  if (sqlite3_stricmp(zSchema, "temp")) {
+    sqlite3_stmt *pStmt;
+    char *zSql = sqlite3_mprintf("pragma \"%w\".data_version", zSchema);
+    if (zSql && sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0) == SQLITE_OK) {
+      sqlite3_step(pStmt);
+      sqlite3_finalize(pStmt);
+    }
+    sqlite3_free(zSql);
+  }
+  if (sqlite3_file_control(db, zSchema, SQLITE_FCNTL_DATA_VERSION,
+                           &dataVersion) != SQLITE_OK)
+    return 0;
+  return dataVersion;
+}
+
+// Finds the schema of the table zName, which may be qualified with its
+// schema, the way SQLite resolves table names: temp first, then main, then
+// attached databases. Sets *pzSchema and *pzTable to new strings, or to NULL
+// when there is no such table. Returns an SQLite error code.
+static int urlTableResolve(sqlite3 *db, const char *zName, char **pzSchema,
+                           char **pzTable) {
+  sqlite3_stmt *pList, *pFind = 0;
+  const char *zDot = strchr(zName, '.');
+  int rc = sqlite3_prepare_v2(
+      db, "select name from pragma_database_list order by name <> 'temp', seq",
+      -1, &pList, 0);
+  *pzSchema = *pzTable = 0;
+  while (rc == SQLITE_OK && sqlite3_step(pList) == SQLITE_ROW) {
+    const char *zSchema = (const char *)sqlite3_column_text(pList, 0);
+    const char *zTable = zName;
+    if (zDot) {
+      if (sqlite3_strnicmp(zSchema, zName, zDot - zName) ||
+          zSchema[zDot - zName])
+        continue;
+      zTable = zDot + 1;
+    }
+    char *zSql = sqlite3_mprintf("select 1 from \"%w\".sqlite_master "
+                                 "where type in ('table', 'view') and "
+                                 "name = ?1 collate nocase",
+                                 zSchema);
+    if (!zSql) {
+      rc = SQLITE_NOMEM;
+      break;
+    }
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pFind, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK)
+      break;
+    sqlite3_bind_text(pFind, 1, zTable, -1, SQLITE_STATIC);
+    int found = sqlite3_step(pFind) == SQLITE_ROW;
+    rc = sqlite3_finalize(pFind);
+    if (rc == SQLITE_OK && found) {
+      *pzSchema = sqlite3_mprintf("%s", zSchema);
+      *pzTable = sqlite3_mprintf("%s", zTable);
+      if (!*pzSchema || !*pzTable) {
+        sqlite3_free(*pzSchema);
+        sqlite3_free(*pzTable);
+        *pzSchema = *pzTable = 0;
+        rc = SQLITE_NOMEM;
+      }
+      break;
+    }
+  }
+  int rc2 = sqlite3_finalize(pList);
+  return rc == SQLITE_OK ? rc2 : rc;
+}
+
+// Starts compiling the table zName for the function zFunc: fills in the
+// header of p, a zeroed table of the compiler, and sets *ppStmt to a query
+// of the rows of the table. Returns an SQLite error code, with *pzErr set
+// as for url_table_compiler.
+static int urlTableOpen(sqlite3 *db, const char *zFunc, const char *zName,
+                        url_table *p, sqlite3_stmt **ppStmt, char **pzErr) {
+  char *zTable = 0, *zSql;
+  int rc;
+  *ppStmt = 0;
+  p->nRef = 1;
+  p->zName = sqlite3_mprintf("%s", zName);
+  rc = p->zName ? urlTableResolve(db, zName, &p->zSchema, &zTable)
+                : SQLITE_NOMEM;
+  if (rc == SQLITE_OK && !zTable) {
+    *pzErr = sqlite3_mprintf("no such %s() table: %s", zFunc, zName);
+    return SQLITE_ERROR;
+  }
+  if (rc != SQLITE_OK)
+    return rc;
+  // versions are read before the rows, so a change in between is seen as
+  // stale
+  p->dataVersion = urlDataVersion(db, p->zSchema);
+  p->tempVersion = urlDataVersion(db, "temp");
+  p->nChange = sqlite3_total_changes64(db);
+  zSql = sqlite3_mprintf("select * from \"%w\".\"%w\"", p->zSchema, zTable);
+  sqlite3_free(zTable);
+  rc = zSql ? sqlite3_prepare_v2(db, zSql, -1, ppStmt, 0) : SQLITE_NOMEM;
+  sqlite3_free(zSql);
+  if (rc != SQLITE_OK && rc != SQLITE_NOMEM)
+    *pzErr = sqlite3_mprintf("%s", sqlite3_errmsg(db));
+  return rc;
+}
+
+// Finishes the query of urlTableOpen(). Returns rc, or the error of the
+// query if rc is SQLITE_OK, with *pzErr set as for url_table_compiler.
+static int urlTableClose(sqlite3 *db, sqlite3_stmt *pStmt, int rc,
+                         char **pzErr) {
+  int rc2 = sqlite3_finalize(pStmt);
+  if (rc == SQLITE_OK && rc2 != SQLITE_OK) {
+    rc = rc2;
+    if (rc != SQLITE_NOMEM)
+      *pzErr = sqlite3_mprintf("%s", sqlite3_errmsg(db));
+  }
+  return rc;
+}
+
+// Returns 1 if a commit, by this or another connection, may have changed
+// the table since it was compiled.
+static int urlTableIsStale(sqlite3 *db, const url_table *p) {
+  return urlDataVersion(db, p->zSchema) != p->dataVersion ||
+         urlDataVersion(db, "temp") != p->tempVersion;
+}
+
+#pragma endregion
+
+#pragma region host sets
+
+// url_host_matches() compiles its list table into a host set: an open
+// addressing hash table of the lowercased hosts, hashed from their last byte
+// to their first so a host can be matched against all of its parent domains
+// in one walk from the right, without copying it.
+
+#define URL_HOSTSET_FNV_OFFSET 2166136261u
+#define URL_HOSTSET_FNV_PRIME 16777619u
+
+typedef struct url_hostset_slot url_hostset_slot;
+struct url_hostset_slot {
+  unsigned int hash;
+  // offset of the host in zPool plus 1, 0 for empty slots
+  unsigned int offset;
+};
+
+typedef struct url_hostset url_hostset;
+struct url_hostset {
+  // Base class - must be first
+  url_table base;
+  // nSlot is a power of 2, at least twice the number of hosts
+  url_hostset_slot *aSlot;
+  unsigned int nSlot;
+  // NUL-terminated hosts
+  char *zPool;
+  // longest host, longer suffixes can't match
+  int nMaxHost;
+};
+
+static void urlHostsetFree(url_table *pTable) {
+  url_hostset *pSet = (url_hostset *)pTable;
+  sqlite3_free(pSet->aSlot);
+  sqlite3_free(pSet->zPool);
+}
+
+// Returns 1 if the n byte host z, hashed as h, is in the set.
+static int urlHostsetFind(const url_hostset *p, unsigned int h, const char *z,
+                          int n) {
+  unsigned int mask = p->nSlot - 1;
+  for (unsigned int i = h & mask;; i = (i + 1) & mask) {
+    const url_hostset_slot *pSlot = &p->aSlot[i];
+    if (!pSlot->offset)
+      return 0;
+    if (pSlot->hash != h)
+      continue;
+    const unsigned char *zHost =
+        (const unsigned char *)p->zPool + pSlot->offset - 1;
+    int j = 0;
+    while (j < n && zHost[j] == urlToLower(z[j]))
+      j++;
+    if (j == n && !zHost[n])
+      return 1;
+  }
+}
+
+// Returns 1 if the n byte host z or one of its parent domains is in the set.
+// Only z itself is looked up when exact is set, for IP addresses.
+static int urlHostsetMatch(const url_hostset *p, const char *z, int n,
+                           int exact) {
+  unsigned int h = URL_HOSTSET_FNV_OFFSET;
+  int i = n;
+  // suffixes are hashed right to left, one more label each iteration
+  while (i > 0) {
+    if (i < n) {
+      i--;
+      h = (h ^ '.') * URL_HOSTSET_FNV_PRIME;
+    }
+    while (i > 0 && z[i - 1] != '.') {
+      i--;
+      h = (h ^ urlToLower(z[i])) * URL_HOSTSET_FNV_PRIME;
+    }
+    if (n - i > p->nMaxHost)
+      return 0;
+    if ((!exact || i == 0) && urlHostsetFind(p, h, z + i, n - i))
+      return 1;
+  }
+  return 0;
+}
+
+// Adds the host at offset iHost of the pool to the slots, unless it is
+// already there.
+static void urlHostsetInsert(url_hostset *p, unsigned int iHost) {
+  const char *z = p->zPool + iHost;
+  int n = strlen(z);
+  unsigned int h = URL_HOSTSET_FNV_OFFSET;
+  for (int i = n - 1; i >= 0; i--)
+    h = (h ^ (unsigned char)z[i]) * URL_HOSTSET_FNV_PRIME;
+  if (urlHostsetFind(p, h, z, n))
+    return;
+  unsigned int i = h & (p->nSlot - 1);
+  while (p->aSlot[i].offset)
+    i = (i + 1) & (p->nSlot - 1);
+  p->aSlot[i].hash = h;
+  p->aSlot[i].offset = iHost + 1;
+  if (n > p->nMaxHost)
+    p->nMaxHost = n;
+}
+
+// Appends the host z, lowercased and without a leading "*." or "." or a
+// trailing ".", to the pool. Returns its offset, -1 when it is empty, or -2
+// on OOM.
+static sqlite3_int64 urlHostsetAppend(url_hostset *p, sqlite3_int64 *pnPool,
+                                      sqlite3_int64 *pnAlloc, const char *z,
+                                      int n) {
+  if (n > 1 && z[0] == '*' && z[1] == '.') {
+    z += 2;
+    n -= 2;
+  } else if (n > 0 && z[0] == '.') {
+    z++;
+    n--;
+  }
+  if (n > 0 && z[n - 1] == '.')
+    n--;
+  if (n <= 0)
+    return -1;
+  if (*pnPool + n + 1 > *pnAlloc) {
+    sqlite3_int64 nNew = *pnAlloc * 2 + n + 1;
+    if (nNew > 0xffffffff)
+      nNew = 0xffffffff;
+    if (*pnPool + n + 1 > nNew)
+      return -2;
+    char *zNew = sqlite3_realloc64(p->zPool, nNew);
+    if (!zNew)
+      return -2;
+    p->zPool = zNew;
+    *pnAlloc = nNew;
+  }
+  sqlite3_int64 iHost = *pnPool;
+  for (int i = 0; i < n; i++)
+    p->zPool[iHost + i] = urlToLower(z[i]);
+  p->zPool[iHost + n] = 0;
+  *pnPool += n + 1;
+  return iHost;
+}
+
+// Compiles the hosts in the first column of the table zName into a new host
+// set, see url_table_compiler.
+static int urlHostsetCompile(sqlite3 *db, const char *zFunc,
+                             const char *zName, url_table **ppTable,
+                             char **pzErr) {
+  sqlite3_stmt *pStmt = 0;
+  url_hostset *p = sqlite3_malloc(sizeof(*p));
+  sqlite3_int64 nPool = 0, nAlloc = 0, nHost = 0;
+  unsigned int *aHost = 0;
+  sqlite3_int64 nHostAlloc = 0;
+  int rc;
+  *ppTable = 0;
+  *pzErr = 0;
+  if (!p)
+    return SQLITE_NOMEM;
+  memset(p, 0, sizeof(*p));
+  p->base.xFree = urlHostsetFree;
+  rc = urlTableOpen(db, zFunc, zName, &p->base, &pStmt, pzErr);
+  while (rc == SQLITE_OK && sqlite3_step(pStmt) == SQLITE_ROW) {
+    const char *z = (const char *)sqlite3_column_text(pStmt, 0);
+    sqlite3_int64 iHost = urlHostsetAppend(p, &nPool, &nAlloc, z,
+                                           sqlite3_column_bytes(pStmt, 0));
+    if (iHost == -2 || (!z && sqlite3_column_type(pStmt, 0) != SQLITE_NULL))
+      rc = SQLITE_NOMEM;
+    if (rc != SQLITE_OK || iHost < 0)
+      continue;
+    if (nHost == nHostAlloc) {
+      nHostAlloc = nHostAlloc * 2 + 64;
+      unsigned int *aNew =
+          sqlite3_realloc64(aHost, nHostAlloc * sizeof(*aHost));
+      if (!aNew) {
+        rc = SQLITE_NOMEM;
+        continue;
+      }
+      aHost = aNew;
+    }
+    aHost[nHost++] = (unsigned int)iHost;
+  }
+  if (pStmt)
+    rc = urlTableClose(db, pStmt, rc, pzErr);
+  if (rc == SQLITE_OK) {
+    p->nSlot = 16;
+    while (p->nSlot < 2 * nHost && p->nSlot < 0x80000000u)
+      p->nSlot *= 2;
+    if (p->nSlot < 2 * nHost)
+      rc = SQLITE_TOOBIG;
+    else if (!(p->aSlot = sqlite3_malloc64(p->nSlot * sizeof(*p->aSlot))))
+      rc = SQLITE_NOMEM;
+  }
+  if (rc == SQLITE_OK) {
+    memset(p->aSlot, 0, p->nSlot * sizeof(*p->aSlot));
+    for (sqlite3_int64 i = 0; i < nHost; i++)
+      urlHostsetInsert(p, aHost[i]);
+    *ppTable = &p->base;
+  } else {
+    urlTableUnref(&p->base);
+  }
+  sqlite3_free(aHost);
+  return rc;
+}
+
+#pragma endregion
+
+#pragma region cidr sets
+
+// url_host_in_cidr() and url_host_cidr() compile their prefix table into a
+// CIDR set: a path compressed binary trie (Patricia tree) of 128-bit keys,
+// where IPv4 prefixes are IPv4-mapped IPv6 prefixes under ::ffff:0:0/96. A
+// lookup walks at most one node per distinct prefix length on the way to
+// the longest matching prefix.
+
+typedef struct url_cidr_node url_cidr_node;
+struct url_cidr_node {
+  // the first nBit bits of the key are the prefix of the node, the others
+  // are 0
+  unsigned char aKey[16];
+  int nBit;
+  // children by the bit after the prefix, -1 for none
+  int aChild[2];
+  // offset of the prefix text of the table in zPool plus 1, 0 for nodes
+  // that only branch
+  unsigned int iEntry;
+};
+
+typedef struct url_cidrset url_cidrset;
+struct url_cidrset {
   // Base class - must be first
+  url_table base;
+  // aNode[0] is the root, when nNode > 0
+  url_cidr_node *aNode;
+  int nNode;
+  int nNodeAlloc;
+  // NUL-terminated prefixes, as written in the table
+  char *zPool;
+};
+
+static void urlCidrsetFree(url_table *pTable) {
+  url_cidrset *pSet = (url_cidrset *)pTable;
+  sqlite3_free(pSet->aNode);
+  sqlite3_free(pSet->zPool);
+}
+
+static int urlCidrBit(const unsigned char *aKey, int i) {
+  return (aKey[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+// Returns the number of leading bits, at most nMax, that a and b share.
+static int urlCidrCommonBits(const unsigned char *a, const unsigned char *b,
+                             int nMax) {
+  int i = 0;
+  while (i < nMax && a[i >> 3] == b[i >> 3])
+    i += 8;
+  while (i < nMax && urlCidrBit(a, i) == urlCidrBit(b, i))
+    i++;
+  return i < nMax ? i : nMax;
+}
+
+// Clears the bits of aKey after the first nBit.
+static void urlCidrMask(unsigned char *aKey, int nBit) {
+  for (int i = 0; i < 16; i++) {
+    if (nBit <= i * 8)
+      aKey[i] = 0;
+    else if (nBit < i * 8 + 8)
+      aKey[i] &= 0xff << (i * 8 + 8 - nBit);
+  }
+}
+
+// Parses the IP address of a host as url_host() returns it, IPv4 in
+// dotted-decimal form or IPv6 in brackets, into 16 bytes. Returns 4 for
+// IPv4, 6 for IPv6, or 0 for other hosts.
+static int urlHostAddress(const char *z, int n, unsigned char *aOut) {
+  if (n > 2 && z[0] == '[' && z[n - 1] == ']')
+    return urlParseIPv6(z + 1, n - 2, aOut) ? 6 : 0;
+  if (!urlParseIPv4Strict(z, n, aOut + 12))
+    return 0;
+  memset(aOut, 0, 10);
+  aOut[10] = aOut[11] = 0xff;
+  return 4;
+}
+
+// Parses a prefix of the table: an IPv4 or IPv6 address, the latter
+// optionally in brackets, with an optional "/length". Sets aKey and *pnBit
+// and returns 1 on success.
+static int urlCidrParse(const char *z, int n, unsigned char *aKey,
+                        int *pnBit) {
+  int nAddr = n, nLen = -1;
+  for (int i = n - 1; i >= 0; i--) {
+    if (z[i] == '/') {
+      if (i == n - 1 || n - i > 4)
+        return 0;
+      nLen = 0;
+      for (int j = i + 1; j < n; j++) {
+        if (!urlIsDigit(z[j]))
+          return 0;
+        nLen = nLen * 10 + z[j] - '0';
+      }
+      nAddr = i;
+      break;
+    }
+  }
+  int version = urlHostAddress(z, nAddr, aKey);
+  if (!version && urlParseIPv6(z, nAddr, aKey))
+    version = 6;
+  if (!version || nLen > (version == 4 ? 32 : 128))
+    return 0;
+  if (nLen < 0)
+    *pnBit = 128;
+  else
+    *pnBit = version == 4 ? 96 + nLen : nLen;
+  urlCidrMask(aKey, *pnBit);
+  return 1;
+}
+
+// Adds a node for a prefix, or only a branch for iEntry 0, to the free
+// space of aNode. Returns its index.
+static int urlCidrNode(url_cidrset *p, const unsigned char *aKey, int nBit,
+                       unsigned int iEntry) {
+  url_cidr_node *pNode = &p->aNode[p->nNode];
+  memcpy(pNode->aKey, aKey, 16);
+  urlCidrMask(pNode->aKey, nBit);
+  pNode->nBit = nBit;
+  pNode->aChild[0] = pNode->aChild[1] = -1;
+  pNode->iEntry = iEntry;
+  return p->nNode++;
+}
+
+// Adds the prefix aKey/nBit, whose text is at iEntry - 1 in the pool. The
+// first of duplicate prefixes is kept. Returns SQLITE_OK or SQLITE_NOMEM.
+static int urlCidrsetInsert(url_cidrset *p, const unsigned char *aKey,
+                            int nBit, unsigned int iEntry) {
+  // an insert adds at most 2 nodes, reserved up front so the indexes below
+  // stay valid
+  if (p->nNode + 2 > p->nNodeAlloc) {
+    int nNew = p->nNodeAlloc * 2 + 64;
+    url_cidr_node *aNew =
+        sqlite3_realloc64(p->aNode, (sqlite3_int64)nNew * sizeof(*aNew));
+    if (!aNew)
+      return SQLITE_NOMEM;
+    p->aNode = aNew;
+    p->nNodeAlloc = nNew;
+  }
+  if (p->nNode == 0) {
+    // the root is the empty prefix, so every key has a place below it
+    urlCidrNode(p, aKey, 0, 0);
+  }
+  int iParent = 0;
+  while (1) {
+    url_cidr_node *pParent = &p->aNode[iParent];
+    if (pParent->nBit == nBit) {
+      if (!pParent->iEntry)
+        pParent->iEntry = iEntry;
+      return SQLITE_OK;
+    }
+    int b = urlCidrBit(aKey, pParent->nBit);
+    int iChild = pParent->aChild[b];
+    if (iChild < 0) {
+      p->aNode[iParent].aChild[b] = urlCidrNode(p, aKey, nBit, iEntry);
+      return SQLITE_OK;
+    }
+    url_cidr_node *pChild = &p->aNode[iChild];
+    int nCommon = urlCidrCommonBits(pChild->aKey, aKey,
+                                    nBit < pChild->nBit ? nBit : pChild->nBit);
+    if (nCommon == pChild->nBit) {
+      iParent = iChild;
+      continue;
+    }
+    // the new prefix, or a branch to it, splits the edge to the child
+    int cChild = urlCidrBit(pChild->aKey, nCommon);
+    int iSplit = urlCidrNode(p, aKey, nCommon, nCommon == nBit ? iEntry : 0);
+    p->aNode[iSplit].aChild[cChild] = iChild;
+    if (nCommon < nBit)
+      p->aNode[iSplit].aChild[!cChild] = urlCidrNode(p, aKey, nBit, iEntry);
+    p->aNode[iParent].aChild[b] = iSplit;
+    return SQLITE_OK;
+  }
+}
+
+// Returns the pool offset plus 1 of the longest prefix that contains the
+// address aKey, or 0 if none does.
+static unsigned int urlCidrsetMatch(const url_cidrset *p,
+                                    const unsigned char *aKey) {
+  unsigned int iBest = 0;
+  int i = p->nNode > 0 ? 0 : -1;
+  while (i >= 0) {
+    const url_cidr_node *pNode = &p->aNode[i];
+    if (urlCidrCommonBits(pNode->aKey, aKey, pNode->nBit) < pNode->nBit)
+      break;
+    if (pNode->iEntry)
+      iBest = pNode->iEntry;
+    if (pNode->nBit == 128)
+      break;
+    i = pNode->aChild[urlCidrBit(aKey, pNode->nBit)];
+  }
+  return iBest;
+}
+
+// Compiles the prefixes in the first column of the table zName into a new
+// CIDR set, see url_table_compiler. NULL and empty prefixes are skipped,
+// others that don't parse are an error.
+static int urlCidrsetCompile(sqlite3 *db, const char *zFunc,
+                             const char *zName, url_table **ppTable,
+                             char **pzErr) {
+  sqlite3_stmt *pStmt = 0;
+  url_cidrset *p = sqlite3_malloc(sizeof(*p));
+  sqlite3_int64 nPool = 0, nAlloc = 0;
+  int rc;
+  *ppTable = 0;
+  *pzErr = 0;
+  if (!p)
+    return SQLITE_NOMEM;
+  memset(p, 0, sizeof(*p));
+  p->base.xFree = urlCidrsetFree;
+  rc = urlTableOpen(db, zFunc, zName, &p->base, &pStmt, pzErr);
+  while (rc == SQLITE_OK && sqlite3_step(pStmt) == SQLITE_ROW) {
+    const char *z = (const char *)sqlite3_column_text(pStmt, 0);
+    int n = sqlite3_column_bytes(pStmt, 0);
+    unsigned char aKey[16];
+    int nBit;
+    if (!z) {
+      if (sqlite3_column_type(pStmt, 0) != SQLITE_NULL)
+        rc = SQLITE_NOMEM;
+      continue;
+    }
+    if (n == 0)
+      continue;
+    if (!urlCidrParse(z, n, aKey, &nBit)) {
+      *pzErr = sqlite3_mprintf("invalid %s() prefix: %s", zFunc, z);
+      rc = SQLITE_ERROR;
+      continue;
+    }
+    if (nPool + n + 1 > nAlloc) {
+      sqlite3_int64 nNew = nAlloc * 2 + n + 1;
+      if (nNew > 0xffffffff)
+        nNew = 0xffffffff;
+      char *zNew = 0;
+      if (nPool + n + 1 <= nNew)
+        zNew = sqlite3_realloc64(p->zPool, nNew);
+      if (!zNew) {
+        rc = SQLITE_NOMEM;
+        continue;
+      }
+      p->zPool = zNew;
+      nAlloc = nNew;
+    }
+    memcpy(p->zPool + nPool, z, n + 1);
+    rc = urlCidrsetInsert(p, aKey, nBit, (unsigned int)nPool + 1);
+    nPool += n + 1;
+  }
+  if (pStmt)
+    rc = urlTableClose(db, pStmt, rc, pzErr);
+  if (rc == SQLITE_OK)
+    *ppTable = &p->base;
+  else
+    urlTableUnref(&p->base);
+  return rc;
+}
+
+#pragma endregion
+
+#pragma region parsed url cache
+
+// Default number of parsed URLs kept per connection, see url_config().
+#define URL_CACHE_DEFAULT_SIZE 1024
+
+// Stack scratch space for components parsed outside of the cache.
+#define URL_PARTS_STACK_BUFFER 256
+
+typedef struct url_parsed url_parsed;
+struct url_parsed {
+  // references held by the connection cache and by sqlite3_set_auxdata()
+  int nRef;
+  // components, zExtra is stored right after zUrl in this allocation
+  url_parts parts;
+  // original URL text this was parsed from, the cache key
+  const char *zUrl;
+  // bytes available for zUrl and zExtra after this struct
+  int nAlloc;
+  // hash of zUrl, and chaining/LRU links while inside a url_cache
+  unsigned int hash;
+  url_parsed *pHashNext;
+  url_parsed *pLruPrev;
+  url_parsed *pLruNext;
+};
+
+typedef struct url_cache url_cache;
+struct url_cache {
+  // max number of entries, 0 disables the cache
+  int nMax;
+  int nEntry;
+  // hash buckets, nBucket is always a power of 2
+  url_parsed **aBucket;
+  int nBucket;
+  // most recently used entry is pLruHead, next to be evicted is pLruTail
+  url_parsed *pLruHead;
+  url_parsed *pLruTail;
+  // an evicted entry kept around to be reused by the next miss, so a full
+  // cache does not allocate per row
+  url_parsed *pSpare;
+  sqlite3_int64 nHit;
+  sqlite3_int64 nMiss;
+};
+
+// Connection-level state shared by every function registered in
+// sqlite3_url_init(), freed once the last of them is deleted.
+typedef struct url_state url_state;
+struct url_state {
+  int nRef;
+  // URL_PARSER_NATIVE or URL_PARSER_CURL
+  int parser;
+  url_cache cache;
+  // handles for url() and the libcurl parser
+  url_curlu_pool curlu;
+  // call site and cache entry of the previous urlLookup() that missed the
+  // auxdata, only ever compared to, never dereferenced
+  const sqlite3_context *pLastContext;
+  const url_parsed *pLastLookup;
+  // tables compiled by url_host_matches() and url_host_in_cidr()
+  url_table *pTables;
+#ifdef SQLITE_URL_ENABLE_STATS
+  // indexed by URL_STATS_*
+  url_stats aStats[URL_STATS_COUNT];
+#endif
+};
+
+static unsigned int urlHash(const char *z, int n) {
+  // FNV-1a
+  unsigned int h = 2166136261u;
+  for (int i = 0; i < n; i++) {
+    h ^= (unsigned char)z[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static void urlParsedUnref(void *p) {
+  url_parsed *pParsed = (url_parsed *)p;
+  if (pParsed && --pParsed->nRef == 0)
+    sqlite3_free(pParsed);
+}
+
+// Copies zUrl and its parsed components into a single allocation, re-using
+// the cache's spare entry when it is large enough. The returned object has
+// one reference owned by the caller, or is NULL on OOM.
+static url_parsed *urlParsedNew(url_cache *pCache, const char *zUrl, int nUrl,
+                                const url_parts *pParts) {
+  int nData = nUrl + pParts->nExtra;
+  url_parsed *p = pCache->pSpare;
+  pCache->pSpare = 0;
+  if (p && p->nAlloc < nData) {
+    sqlite3_free(p);
+    p = 0;
+  }
+  if (!p) {
+    // rounded up so spare entries fit most of the following URLs
+    int nAlloc = (nData + 127) & ~127;
+    p = sqlite3_malloc(sizeof(*p) + nAlloc);
+    if (!p)
+      return 0;
+    urlStatsAlloc();
+    p->nAlloc = nAlloc;
+  }
+  p->nRef = 1;
+  p->parts = *pParts;
+  p->zUrl = (const char *)&p[1];
+  memcpy((char *)p->zUrl, zUrl, nUrl);
+  p->parts.zExtra = (char *)p->zUrl + nUrl;
+  memcpy(p->parts.zExtra, pParts->zExtra, pParts->nExtra);
+  p->parts.nExtraAlloc = pParts->nExtra;
+  p->parts.extraOnHeap = 0;
+  p->hash = 0;
+  p->pHashNext = p->pLruPrev = p->pLruNext = 0;
+  return p;
+}
+
+static void urlCacheLruUnlink(url_cache *pCache, url_parsed *p) {
+  if (p->pLruPrev)
+    p->pLruPrev->pLruNext = p->pLruNext;
+  else
+    pCache->pLruHead = p->pLruNext;
+  if (p->pLruNext)
+    p->pLruNext->pLruPrev = p->pLruPrev;
+  else
+    pCache->pLruTail = p->pLruPrev;
+  p->pLruPrev = p->pLruNext = 0;
+}
+
+static void urlCacheLruPush(url_cache *pCache, url_parsed *p) {
+  p->pLruPrev = 0;
+  p->pLruNext = pCache->pLruHead;
+  if (pCache->pLruHead)
+    pCache->pLruHead->pLruPrev = p;
+  else
+    pCache->pLruTail = p;
+  pCache->pLruHead = p;
+}
+
+static void urlCacheEvict(url_cache *pCache, url_parsed *p) {
+  url_parsed **pp = &pCache->aBucket[p->hash & (pCache->nBucket - 1)];
+  while (*pp != p)
+    pp = &(*pp)->pHashNext;
+  *pp = p->pHashNext;
+  p->pHashNext = 0;
+  urlCacheLruUnlink(pCache, p);
+  pCache->nEntry--;
+  if (p->nRef == 1 && !pCache->pSpare)
+    pCache->pSpare = p;
+  else
+    urlParsedUnref(p);
+}
+
+static void urlCacheClear(url_cache *pCache) {
+  while (pCache->pLruTail)
+    urlCacheEvict(pCache, pCache->pLruTail);
+  sqlite3_free(pCache->pSpare);
+  pCache->pSpare = 0;
+  sqlite3_free(pCache->aBucket);
+  pCache->aBucket = 0;
+  pCache->nBucket = 0;
+}
+
+// Changes the max number of cached entries, dropping every cached entry.
+static int urlCacheResize(url_cache *pCache, int nMax) {
+  int nBucket = 16;
+  urlCacheClear(pCache);
+  pCache->nMax = nMax;
+  if (nMax <= 0)
+    return SQLITE_OK;
+  while (nBucket < nMax)
+    nBucket <<= 1;
+  pCache->aBucket = sqlite3_malloc(nBucket * sizeof(url_parsed *));
+  if (!pCache->aBucket) {
+    pCache->nMax = 0;
+    return SQLITE_NOMEM;
+  }
+  memset(pCache->aBucket, 0, nBucket * sizeof(url_parsed *));
+  pCache->nBucket = nBucket;
+  return SQLITE_OK;
+}
+
+// Looks up zUrl in the connection's cache, parsing and inserting it on a
+// miss. The cache must be enabled. Returns a new reference the caller must
+// release with urlParsedUnref(), or NULL on OOM.
+static url_parsed *urlCacheGet(url_state *pState, const char *zUrl,
+                               int nUrl) {
+  url_cache *pCache = &pState->cache;
+  url_parsed *p;
+  unsigned int hash = urlHash(zUrl, nUrl);
+  for (p = pCache->aBucket[hash & (pCache->nBucket - 1)]; p;
+       p = p->pHashNext) {
+    if (p->hash == hash && p->parts.nUrl == nUrl &&
+        memcmp(p->zUrl, zUrl, nUrl) == 0)
+      break;
+  }
+  if (p) {
+    pCache->nHit++;
+    if (p != pCache->pLruHead) {
+      urlCacheLruUnlink(pCache, p);
+      urlCacheLruPush(pCache, p);
+    }
+    p->nRef++;
+    return p;
+  }
+
+  pCache->nMiss++;
+  url_parts parts;
+  char aBuf[URL_PARTS_STACK_BUFFER];
+  urlPartsInit(&parts, nUrl, aBuf, sizeof(aBuf));
+  if (urlPartsParse(pState->parser, &pState->curlu, zUrl, nUrl, &parts) !=
+      SQLITE_OK) {
+    urlPartsFree(&parts);
+    return 0;
+  }
+  if (pCache->nEntry >= pCache->nMax)
+    urlCacheEvict(pCache, pCache->pLruTail);
+  p = urlParsedNew(pCache, zUrl, nUrl, &parts);
+  urlPartsFree(&parts);
+  if (!p)
+    return 0;
+  p->hash = hash;
+  p->pHashNext = pCache->aBucket[hash & (pCache->nBucket - 1)];
+  pCache->aBucket[hash & (pCache->nBucket - 1)] = p;
+  urlCacheLruPush(pCache, p);
+  pCache->nEntry++;
+  p->nRef++;
+  return p;
+}
+
+// Parses zUrl through the connection's cache, or into a new uncached entry
+// when the cache is disabled. Returns a new reference the caller must
+// release with urlParsedUnref(), or NULL on OOM.
+static url_parsed *urlParsedGet(url_state *pState, const char *zUrl,
+                                int nUrl) {
+  if (pState->cache.nMax > 0)
+    return urlCacheGet(pState, zUrl, nUrl);
+  url_parts parts;
+  char aBuf[URL_PARTS_STACK_BUFFER];
+  url_parsed *p = 0;
+  urlPartsInit(&parts, nUrl, aBuf, sizeof(aBuf));
+  if (urlPartsParse(pState->parser, &pState->curlu, zUrl, nUrl, &parts) ==
+      SQLITE_OK)
+    p = urlParsedNew(&pState->cache, zUrl, nUrl, &parts);
+  urlPartsFree(&parts);
+  return p;
+}
+
+static url_state *urlStateRef(url_state *pState) {
+  pState->nRef++;
+  return pState;
+}
+
+static void urlStateUnref(void *p) {
+  url_state *pState = (url_state *)p;
+  if (--pState->nRef == 0) {
+    urlCacheClear(&pState->cache);
+    urlCurluPoolClear(&pState->curlu);
+    while (pState->pTables) {
+      url_table *pNext = pState->pTables->pNext;
+      urlTableUnref(pState->pTables);
+      pState->pTables = pNext;
+    }
+    sqlite3_free(pState);
+  }
+}
+
+#ifdef SQLITE_URL_ENABLE_STATS
+// User data of functions registered with urlCreateFunction(), which calls
+// xFunc through urlStatsFunc() to update aStats[iStat].
+typedef struct url_stats_function url_stats_function;
+struct url_stats_function {
+  url_state *pState;
+  int iStat;
+  // the scalar function, or the xStep of an aggregate
+  void (*xFunc)(sqlite3_context *, int, sqlite3_value **);
+  // xFinal and xValue of aggregate and window functions
+  void (*xFinal)(sqlite3_context *);
+  void (*xValue)(sqlite3_context *);
+};
+#endif
+
+// Connection state of a function registered with urlCreateFunction().
+static url_state *urlContextState(sqlite3_context *context) {
+#ifdef SQLITE_URL_ENABLE_STATS
+  return ((url_stats_function *)sqlite3_user_data(context))->pState;
+#else
+  return (url_state *)sqlite3_user_data(context);
+#endif
+}
+
+// A parsed URL argument, see urlLookup().
+typedef struct url_lookup url_lookup;
+struct url_lookup {
+  // the parsed components, and the text they were parsed from
+  const url_parts *pParts;
+  const char *zUrl;
+  // the cache entry pParts belongs to, if any
+  url_parsed *pParsed;
+  // booleans, if pParsed is a reference that urlLookupDone() hands over to
+  // sqlite3_set_auxdata(), or releases
+  int isNew;
+  int isRef;
+  // used to parse on the stack when the cache is disabled
+  url_parts parts;
+  char aBuf[URL_PARTS_STACK_BUFFER];
+};
+
+// Parses the non-NULL URL in argv[iArg], either re-using the result of a
+// previous call in the same statement or looking it up in the connection's
+// cache of parsed URLs. Parsed URLs are also cached on the argument with
+// sqlite3_set_auxdata(), which SQLite keeps alive for as long as the argument
+// stays constant, so literal URLs skip the cache lookup too. SQLite allocates a
+// node for every sqlite3_set_auxdata() call and frees it right away for
+// non-constant arguments, so that only happens once the same call site looked
+// up the same URL twice in a row, like constant arguments do. When the cache is
+// disabled the URL is parsed on the stack instead. Every successful call must
+// be paired with urlLookupDone(). Returns SQLITE_OK or SQLITE_NOMEM.
+static int urlLookup(sqlite3_context *context, sqlite3_value **argv,
+                     int iArg, url_lookup *pLookup) {
+  url_state *pState = urlContextState(context);
+  url_parsed *p = sqlite3_get_auxdata(context, iArg);
+  pLookup->isNew = pLookup->isRef = 0;
+  if (!p) {
+    const char *zUrl = (const char *)sqlite3_value_text(argv[iArg]);
+    int nUrl = sqlite3_value_bytes(argv[iArg]);
+    if (pState->cache.nMax <= 0) {
+      pLookup->pParsed = 0;
+      pLookup->zUrl = zUrl;
+      pLookup->pParts = &pLookup->parts;
+      urlPartsInit(&pLookup->parts, nUrl, pLookup->aBuf,
+                   sizeof(pLookup->aBuf));
+      if (urlPartsParse(pState->parser, &pState->curlu, zUrl, nUrl,
+                        &pLookup->parts)) {
+        urlPartsFree(&pLookup->parts);
+        return SQLITE_NOMEM;
+      }
+      return SQLITE_OK;
+    }
+    p = urlCacheGet(pState, zUrl, nUrl);
+    if (!p)
+      return SQLITE_NOMEM;
+    pLookup->isNew =
+        p == pState->pLastLookup && context == pState->pLastContext;
+    pLookup->isRef = !pLookup->isNew;
+    pState->pLastContext = context;
+    pState->pLastLookup = p;
+  }
+  pLookup->pParsed = p;
+  pLookup->zUrl = p->zUrl;
+  pLookup->pParts = &p->parts;
+  return SQLITE_OK;
+}
+
+// Releases a URL from urlLookup(). This must be the last use of it, since
+// SQLite may free the cache entry immediately.
+static void urlLookupDone(sqlite3_context *context, int iArg,
+                          url_lookup *pLookup) {
+  if (!pLookup->pParsed)
+    urlPartsFree(&pLookup->parts);
+  else if (pLookup->isNew)
+    sqlite3_set_auxdata(context, iArg, pLookup->pParsed, urlParsedUnref);
+  else if (pLookup->isRef)
+    urlParsedUnref(pLookup->pParsed);
+}
+
+#pragma endregion
+
+#pragma region escape kernels
+
+// url_escape() and url_unescape() scan for the few bytes that need work with
+// SSE2 or AVX2 when available, and copy the runs in between with memcpy().
+#if defined(__AVX2__)
+typedef __m256i url_vec;
+#define URL_VEC_WIDTH 32
+#define URL_VEC_FULL 0xffffffffu
+#define urlVecLoad(p) _mm256_loadu_si256((const __m256i *)(p))
+#define urlVecSet(c) _mm256_set1_epi8(c)
+#define urlVecEq(a, b) _mm256_cmpeq_epi8(a, b)
+#define urlVecGt(a, b) _mm256_cmpgt_epi8(a, b)
+#define urlVecOr(a, b) _mm256_or_si256(a, b)
+#define urlVecAnd(a, b) _mm256_and_si256(a, b)
+#define urlVecMask(v) ((unsigned int)_mm256_movemask_epi8(v))
+#elif defined(__SSE2__)
+typedef __m128i url_vec;
+#define URL_VEC_WIDTH 16
+#define URL_VEC_FULL 0xffffu
+#define urlVecLoad(p) _mm_loadu_si128((const __m128i *)(p))
+#define urlVecSet(c) _mm_set1_epi8(c)
+#define urlVecEq(a, b) _mm_cmpeq_epi8(a, b)
+#define urlVecGt(a, b) _mm_cmpgt_epi8(a, b)
+#define urlVecOr(a, b) _mm_or_si128(a, b)
+#define urlVecAnd(a, b) _mm_and_si128(a, b)
+#define urlVecMask(v) ((unsigned int)_mm_movemask_epi8(v))
+#endif
+
+// RFC 3986 unreserved characters, the only ones url_escape() keeps as-is.
+#define urlIsUnreserved(c)                                                     \
+  (urlIsAlpha(c) || urlIsDigit(c) || (c) == '-' || (c) == '.' ||               \
+   (c) == '_' || (c) == '~')
+
+#ifdef URL_VEC_WIDTH
+// Bitmask of the unreserved bytes in z[0..URL_VEC_WIDTH). Bytes >= 0x80 are
+// negative in the signed comparisons, so they never match.
+static unsigned int urlUnreservedMask(const char *z) {
+  url_vec v = urlVecLoad(z);
+  url_vec lower = urlVecOr(v, urlVecSet(0x20));
+  url_vec digit = urlVecAnd(urlVecGt(v, urlVecSet('0' - 1)),
+                            urlVecGt(urlVecSet('9' + 1), v));
+  url_vec alpha = urlVecAnd(urlVecGt(lower, urlVecSet('a' - 1)),
+                            urlVecGt(urlVecSet('z' + 1), lower));
+  url_vec mark = urlVecOr(
+      urlVecOr(urlVecEq(v, urlVecSet('-')), urlVecEq(v, urlVecSet('.'))),
+      urlVecOr(urlVecEq(v, urlVecSet('_')), urlVecEq(v, urlVecSet('~'))));
+  return urlVecMask(urlVecOr(urlVecOr(digit, alpha), mark));
+}
+#endif
+
+// Returns the index of the first byte in z[i..n) that url_escape() has to
+// percent-encode, or n.
+static sqlite3_int64 urlFindReserved(const char *z, sqlite3_int64 i,
+                                     sqlite3_int64 n) {
+  if (i < n && !urlIsUnreserved(z[i]))
+    return i;
+#ifdef URL_VEC_WIDTH
+  for (; i + URL_VEC_WIDTH <= n; i += URL_VEC_WIDTH) {
+    unsigned int m = ~urlUnreservedMask(z + i) & URL_VEC_FULL;
+    if (m)
+      return i + __builtin_ctz(m);
+  }
+#endif
+  while (i < n && urlIsUnreserved(z[i]))
+    i++;
+  return i;
+}
+
+// Returns the length of z[0..n) once escaped by urlEscapeInto().
+static sqlite3_int64 urlEscapedLength(const char *z, sqlite3_int64 n) {
+  sqlite3_int64 nOut = n, i = 0;
+#ifdef URL_VEC_WIDTH
+  for (; i + URL_VEC_WIDTH <= n; i += URL_VEC_WIDTH)
+    nOut += 2 * __builtin_popcount(~urlUnreservedMask(z + i) & URL_VEC_FULL);
+#endif
+  for (; i < n; i++) {
+    if (!urlIsUnreserved(z[i]))
+      nOut += 2;
+  }
+  return nOut;
+}
+
+// Percent-encodes every byte of z[0..n) except the unreserved characters,
+// the same as curl_easy_escape(), into the urlEscapedLength() bytes at
+// zOut. Returns a pointer right after the last byte written.
+static char *urlEscapeInto(const char *z, sqlite3_int64 n, char *zOut) {
+  static const char aHex[] = "0123456789ABCDEF";
+  sqlite3_int64 i = 0;
+  while (i < n) {
+    sqlite3_int64 j = urlFindReserved(z, i, n);
+    memcpy(zOut, z + i, j - i);
+    zOut += j - i;
+    if (j == n)
+      break;
+    unsigned char c = z[j];
+    *zOut++ = '%';
+    *zOut++ = aHex[c >> 4];
+    *zOut++ = aHex[c & 0xf];
+    i = j + 1;
+  }
+  return zOut;
+}
+
+// Escapes z[0..n) with urlEscapeInto(). Returns a NUL-terminated string
+// from sqlite3_malloc() of exactly *pnOut + 1 bytes, or NULL on OOM.
+static char *urlEscape(const char *z, sqlite3_int64 n, sqlite3_int64 *pnOut) {
+  sqlite3_int64 nOut = urlEscapedLength(z, n);
+  char *zOut = sqlite3_malloc64(nOut + 1);
+  if (!zOut)
+    return 0;
+  *urlEscapeInto(z, n, zOut) = 0;
+  *pnOut = nOut;
+  return zOut;
+}
+
+// Returns the index of the next valid "%XX" escape in z[i..n), or n.
+static sqlite3_int64 urlFindEscape(const char *z, sqlite3_int64 i,
+                                   sqlite3_int64 n) {
+  // memchr() is already vectorized by every libc worth using
+  const char *p;
+  while (i < n && (p = memchr(z + i, '%', n - i))) {
+    i = p - z;
+    if (i + 2 < n && urlHexValue(z[i + 1]) >= 0 && urlHexValue(z[i + 2]) >= 0)
+      return i;
+    i++;
+  }
+  return n;
+}
+
+// Decodes every valid "%XX" escape of z[0..n) into zOut, which needs at
+// most n bytes. Returns a pointer right after the last byte written.
+static char *urlUnescapeInto(const char *z, sqlite3_int64 n, char *zOut) {
+  sqlite3_int64 i = 0;
+  while (i < n) {
+    sqlite3_int64 j = urlFindEscape(z, i, n);
+    memcpy(zOut, z + i, j - i);
+    zOut += j - i;
+    if (j == n)
+      break;
+    *zOut++ = (char)(urlHexValue(z[j + 1]) << 4 | urlHexValue(z[j + 2]));
+    i = j + 3;
+  }
+  return zOut;
+}
+
+// Decodes every "%XX" escape in z[0..n), leaving other bytes as-is, the same
+// as curl_easy_unescape(). Returns a NUL-terminated string from
+// sqlite3_malloc() of exactly *pnOut + 1 bytes, or NULL on OOM.
+static char *urlUnescape(const char *z, sqlite3_int64 n,
+                         sqlite3_int64 *pnOut) {
+  sqlite3_int64 nOut = n, i;
+  for (i = urlFindEscape(z, 0, n); i < n; i = urlFindEscape(z, i + 3, n))
+    nOut -= 2;
+
+  char *zOut = sqlite3_malloc64(nOut + 1);
+  if (!zOut)
+    return 0;
+  *urlUnescapeInto(z, n, zOut) = 0;
+  *pnOut = nOut;
+  return zOut;
+}
+
+// Returns 1 if the application/x-www-form-urlencoded z[0..n) decodes to
+// zText[0..nText), without decoding it into a buffer.
+static int urlFormEquals(const char *z, int n, const char *zText, int nText) {
+  int j = 0;
+  for (int i = 0; i < n; i++, j++) {
+    char c = z[i];
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && i + 2 < n && urlHexValue(z[i + 1]) >= 0 &&
+               urlHexValue(z[i + 2]) >= 0) {
+      c = (char)(urlHexValue(z[i + 1]) << 4 | urlHexValue(z[i + 2]));
+      i += 2;
+    }
+    if (j >= nText || zText[j] != c)
+      return 0;
+  }
+  return j == nText;
+}
+
+// Decodes an application/x-www-form-urlencoded name or value z[0..n) into
+// zOut, which must have room for n bytes: "+" becomes a space and "%XX"
+// escapes are decoded. Returns the number of bytes written.
+static int urlFormDecode(const char *z, int n, char *zOut) {
+  int nOut = 0;
+  for (int i = 0; i < n; i++) {
+    if (z[i] == '+') {
+      zOut[nOut++] = ' ';
+    } else if (z[i] == '%' && i + 2 < n && urlHexValue(z[i + 1]) >= 0 &&
+               urlHexValue(z[i + 2]) >= 0) {
+      zOut[nOut++] = (char)(urlHexValue(z[i + 1]) << 4 | urlHexValue(z[i + 2]));
+      i += 2;
+    } else {
+      zOut[nOut++] = z[i];
+    }
+  }
+  return nOut;
+}
+
+// Copies z[0..n) to zOut with its "%XX" escapes normalized: escapes of
+// unreserved characters are decoded and the others get upper case hex
+// digits. With keepDots, "%2E" stays escaped, since decoding it in a path
+// could make new dot segments. Returns the end of the output, which is at
+// most n bytes long.
+static char *urlNormalizeEscapesInto(const char *z, sqlite3_int64 n,
+                                     int keepDots, char *zOut) {
+  static const char zHex[] = "0123456789ABCDEF";
+  sqlite3_int64 i = 0;
+  while (i < n) {
+    sqlite3_int64 j = urlFindEscape(z, i, n);
+    memcpy(zOut, z + i, j - i);
+    zOut += j - i;
+    if (j == n)
+      break;
+    unsigned char c = urlHexValue(z[j + 1]) << 4 | urlHexValue(z[j + 2]);
+    if (urlIsUnreserved(c) && !(keepDots && c == '.')) {
+      *zOut++ = (char)c;
+    } else {
+      *zOut++ = '%';
+      *zOut++ = zHex[c >> 4];
+      *zOut++ = zHex[c & 0xf];
+    }
+    i = j + 3;
+  }
+  return zOut;
+}
+
+#pragma endregion
+
+#pragma region public suffix list
+
+// urlPslPool and urlPslSlots, the Public Suffix List compiled by
+// scripts/generate-psl.py
+#include "sqlite-url-psl.h"
+
+#define URL_PSL_MASK ((1u << URL_PSL_HASH_BITS) - 1)
+
+// Returns the URL_PSL_* flags of the n byte suffix z, hashed as h, or 0 if
+// no rule ends with it.
+static int urlPslFind(unsigned int h, const char *z, int n) {
+  for (unsigned int i = h & URL_PSL_MASK;; i = (i + 1) & URL_PSL_MASK) {
+    unsigned int slot = urlPslSlots[i];
+    if (!slot)
+      return 0;
+    if ((int)((slot >> 4) & ((1u << URL_PSL_LEN_BITS) - 1)) != n)
+      continue;
+    const unsigned char *zRule = urlPslPool + (slot >> (4 + URL_PSL_LEN_BITS));
+    int j = 0;
+    while (j < n && zRule[j] == urlToLower(z[j]))
+      j++;
+    if (j == n)
+      return slot & 0xf;
+  }
+}
+
+// Returns the length of the n byte host z without its trailing dot, which
+// is what the public suffix lookups see, or 0 for IP addresses, which have
+// no public suffix.
+static int urlPslHostLength(const char *z, int n) {
+  if (n > 0 && z[n - 1] == '.')
+    n--;
+  if (n > 0 && z[0] == '[')
+    return 0;
+  int i = n;
+  while (i > 0 && z[i - 1] >= '0' && z[i - 1] <= '9')
+    i--;
+  // an all-digits top level label is an IPv4 address
+  if (i < n && (i == 0 || z[i - 1] == '.'))
+    return 0;
+  return n;
+}
+
+// Returns the offset where the public suffix of the n byte host z starts,
+// per the Public Suffix List algorithm: the longest matching rule wins,
+// exception rules beat the rest, and unlisted top level domains are public
+// suffixes. n must come from urlPslHostLength(), and be positive.
+static int urlPslSuffix(const char *z, int n) {
+  unsigned int h = URL_PSL_FNV_OFFSET;
+  int i = n, iSuffix = -1, parentFlags = 0;
+  // suffixes are hashed right to left, one more label each iteration
+  while (i > 0) {
+    int iPrev = i;
+    if (i < n) {
+      i--;
+      h = (h ^ '.') * URL_PSL_FNV_PRIME;
+    }
+    while (i > 0 && z[i - 1] != '.') {
+      i--;
+      h = (h ^ urlToLower(z[i])) * URL_PSL_FNV_PRIME;
+    }
+    int flags = urlPslFind(h, z + i, n - i);
+    if (flags & URL_PSL_EXCEPTION)
+      return iPrev;
+    if ((flags & URL_PSL_RULE) || (parentFlags & URL_PSL_WILDCARD) ||
+        iSuffix < 0)
+      iSuffix = i;
+    if (!flags)
+      break;
+    parentFlags = flags;
+  }
+  return iSuffix;
+}
+
+// Returns the offset where the registrable domain of the host z starts, its
+// public suffix at iSuffix and the label before it, or -1 when the host is
+// a public suffix itself.
+static int urlPslDomain(const char *z, int iSuffix) {
+  if (iSuffix < 2)
+    return -1;
+  int i = iSuffix - 1;
+  while (i > 0 && z[i - 1] != '.')
+    i--;
+  return i < iSuffix - 1 ? i : -1;
+}
+
+#pragma endregion
+
+#pragma region xxh64
+
+// XXH64 (https://github.com/Cyan4973/xxHash), so url_fingerprint() values
+// stay the same across versions and platforms. Input is read byte by byte
+// as little-endian, whatever the host's byte order.
+
+#define URL_XXH_PRIME_1 0x9E3779B185EBCA87ULL
+#define URL_XXH_PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define URL_XXH_PRIME_3 0x165667B19E3779F9ULL
+#define URL_XXH_PRIME_4 0x85EBCA77C2B2AE63ULL
+#define URL_XXH_PRIME_5 0x27D4EB2F165667C5ULL
+
+#define urlXxhRotl(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static sqlite3_uint64 urlXxhRead64(const unsigned char *p) {
+  sqlite3_uint64 v = 0;
+  for (int i = 7; i >= 0; i--)
+    v = v << 8 | p[i];
+  return v;
+}
+
+static sqlite3_uint64 urlXxhRead32(const unsigned char *p) {
+  return (sqlite3_uint64)p[0] | (sqlite3_uint64)p[1] << 8 |
+         (sqlite3_uint64)p[2] << 16 | (sqlite3_uint64)p[3] << 24;
+}
+
+static sqlite3_uint64 urlXxhRound(sqlite3_uint64 acc, sqlite3_uint64 v) {
+  acc += v * URL_XXH_PRIME_2;
+  acc = urlXxhRotl(acc, 31);
+  return acc * URL_XXH_PRIME_1;
+}
+
+static sqlite3_uint64 urlXxhMerge(sqlite3_uint64 h, sqlite3_uint64 v) {
+  h ^= urlXxhRound(0, v);
+  return h * URL_XXH_PRIME_1 + URL_XXH_PRIME_4;
+}
+
+static sqlite3_uint64 urlXxh64(const char *zIn, sqlite3_int64 n,
+                               sqlite3_uint64 seed) {
+  const unsigned char *p = (const unsigned char *)zIn;
+  const unsigned char *pEnd = p + n;
+  sqlite3_uint64 h;
+  if (n >= 32) {
+    sqlite3_uint64 v1 = seed + URL_XXH_PRIME_1 + URL_XXH_PRIME_2;
+    sqlite3_uint64 v2 = seed + URL_XXH_PRIME_2;
+    sqlite3_uint64 v3 = seed;
+    sqlite3_uint64 v4 = seed - URL_XXH_PRIME_1;
+    do {
+      v1 = urlXxhRound(v1, urlXxhRead64(p));
+      v2 = urlXxhRound(v2, urlXxhRead64(p + 8));
+      v3 = urlXxhRound(v3, urlXxhRead64(p + 16));
+      v4 = urlXxhRound(v4, urlXxhRead64(p + 24));
+      p += 32;
+    } while (pEnd - p >= 32);
+    h = urlXxhRotl(v1, 1) + urlXxhRotl(v2, 7) + urlXxhRotl(v3, 12) +
+        urlXxhRotl(v4, 18);
+    h = urlXxhMerge(h, v1);
+    h = urlXxhMerge(h, v2);
+    h = urlXxhMerge(h, v3);
+    h = urlXxhMerge(h, v4);
+  } else {
+    h = seed + URL_XXH_PRIME_5;
+  }
+  h += (sqlite3_uint64)n;
+  for (; pEnd - p >= 8; p += 8) {
+    h ^= urlXxhRound(0, urlXxhRead64(p));
+    h = urlXxhRotl(h, 27) * URL_XXH_PRIME_1 + URL_XXH_PRIME_4;
+  }
+  if (pEnd - p >= 4) {
+    h ^= urlXxhRead32(p) * URL_XXH_PRIME_1;
+    h = urlXxhRotl(h, 23) * URL_XXH_PRIME_2 + URL_XXH_PRIME_3;
+    p += 4;
+  }
+  for (; p < pEnd; p++) {
+    h ^= *p * URL_XXH_PRIME_5;
+    h = urlXxhRotl(h, 11) * URL_XXH_PRIME_1;
+  }
+  h ^= h >> 33;
+  h *= URL_XXH_PRIME_2;
+  h ^= h >> 29;
+  h *= URL_XXH_PRIME_3;
+  h ^= h >> 32;
+  return h;
+}
+
+#pragma endregion
+
+#pragma region idna
+
+// url_host_ascii() and url_host_unicode() convert hosts with UTS #46
+// processing the way URLs use it: nontransitional and without STD3 rules.
+// Code points are mapped with the IDNA Mapping Table and normalized to NFC,
+// then each label is checked and converted to or from punycode. The CheckBidi
+// and CheckJoiners context rules are not applied.
+
+// urlIdnaRanges, urlIdnaClasses and the other tables compiled by
+// scripts/generate-idna.py
+#include "sqlite-url-idna.h"
+
+#define URL_IDNA_LEN_MASK ((1u << URL_IDNA_LEN_BITS) - 1)
+
+// Hangul syllables, decomposed and composed algorithmically
+#define URL_HANGUL_SBASE 0xAC00
+#define URL_HANGUL_LBASE 0x1100
+#define URL_HANGUL_VBASE 0x1161
+#define URL_HANGUL_TBASE 0x11A7
+#define URL_HANGUL_LCOUNT 19
+#define URL_HANGUL_VCOUNT 21
+#define URL_HANGUL_TCOUNT 28
+#define URL_HANGUL_NCOUNT (URL_HANGUL_VCOUNT * URL_HANGUL_TCOUNT)
+#define URL_HANGUL_SCOUNT (URL_HANGUL_LCOUNT * URL_HANGUL_NCOUNT)
+
+// RFC 3492 parameters
+#define URL_PUNYCODE_BASE 36
+#define URL_PUNYCODE_TMIN 1
+#define URL_PUNYCODE_TMAX 26
+#define URL_PUNYCODE_SKEW 38
+#define URL_PUNYCODE_DAMP 700
+#define URL_PUNYCODE_INITIAL_BIAS 72
+#define URL_PUNYCODE_INITIAL_N 0x80
+
+// A growable array of code points.
+typedef struct url_codepoints url_codepoints;
+struct url_codepoints {
+  unsigned int *a;
+  int n;
+  int nAlloc;
+};
+
+// Makes room for n more code points. Returns SQLITE_OK or SQLITE_NOMEM.
+static int urlCodepointsReserve(url_codepoints *p, int n) {
+  if (p->n + n > p->nAlloc) {
+    sqlite3_int64 nNew = (sqlite3_int64)p->nAlloc * 2 + n + 32;
+    unsigned int *aNew = sqlite3_realloc64(p->a, nNew * sizeof(*aNew));
+    if (!aNew || nNew > 0x7fffffff)
+      return SQLITE_NOMEM;
+    p->a = aNew;
+    p->nAlloc = nNew;
+  }
+  return SQLITE_OK;
+}
+
+static int urlCodepointsAppend(url_codepoints *p, unsigned int c) {
+  if (urlCodepointsReserve(p, 1))
+    return SQLITE_NOMEM;
+  p->a[p->n++] = c;
+  return SQLITE_OK;
+}
+
+// Decodes the UTF-8 character at z[*pi..n) and moves *pi after it. Returns
+// -1 for invalid UTF-8: truncated, overlong or surrogate sequences.
+static int urlUtf8Decode(const unsigned char *z, int n, int *pi) {
+  static const unsigned int aMin[] = {0, 0x80, 0x800, 0x10000};
+  int i = *pi, nExtra;
+  unsigned int c = z[i++];
+  if (c < 0x80) {
+    *pi = i;
+    return c;
+  } else if (c >= 0xc2 && c < 0xe0) {
+    nExtra = 1;
+    c &= 0x1f;
+  } else if (c >= 0xe0 && c < 0xf0) {
+    nExtra = 2;
+    c &= 0x0f;
+  } else if (c >= 0xf0 && c < 0xf5) {
+    nExtra = 3;
+    c &= 0x07;
+  } else {
+    return -1;
+  }
+  if (i + nExtra > n)
+    return -1;
+  for (int j = 0; j < nExtra; j++) {
+    if ((z[i] & 0xc0) != 0x80)
+      return -1;
+    c = (c << 6) | (z[i++] & 0x3f);
+  }
+  if (c < aMin[nExtra] || c > 0x10ffff || (c >= 0xd800 && c < 0xe000))
+    return -1;
+  *pi = i;
+  return c;
+}
+
+static void urlUtf8Append(sqlite3_str *s, unsigned int c) {
+  char z[4];
+  int n;
+  if (c < 0x80) {
+    z[0] = c;
+    n = 1;
+  } else if (c < 0x800) {
+    z[0] = 0xc0 | (c >> 6);
+    z[1] = 0x80 | (c & 0x3f);
+    n = 2;
+  } else if (c < 0x10000) {
+    z[0] = 0xe0 | (c >> 12);
+    z[1] = 0x80 | ((c >> 6) & 0x3f);
+    z[2] = 0x80 | (c & 0x3f);
+    n = 3;
+  } else {
+    z[0] = 0xf0 | (c >> 18);
+    z[1] = 0x80 | ((c >> 12) & 0x3f);
+    z[2] = 0x80 | ((c >> 6) & 0x3f);
+    z[3] = 0x80 | (c & 0x3f);
+    n = 4;
+  }
+  sqlite3_str_append(s, z, n);
+}
+
+// Returns the index of the last of the n sorted entries of a that is at
+// most key, or -1.
+static int urlIdnaSearch(const unsigned int *a, int n, unsigned int key) {
+  int lo = 0, hi = n;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (a[mid] <= key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo - 1;
+}
+
+// Returns the index of c in urlIdnaRanges, whose entry has its status.
+static int urlIdnaRange(unsigned int c) {
+  return urlIdnaSearch(urlIdnaRanges,
+                       sizeof(urlIdnaRanges) / sizeof(urlIdnaRanges[0]),
+                       (c << 3) | 7);
+}
+
+static int urlIdnaClass(unsigned int c) {
+  if (c < 0x300)
+    return 0;
+  int i = urlIdnaSearch(urlIdnaClasses,
+                        sizeof(urlIdnaClasses) / sizeof(urlIdnaClasses[0]),
+                        (c << 8) | 0xff);
+  return urlIdnaClasses[i] & 0xff;
+}
+
+// Appends the UTS #46 mapping of the UTF-8 text z[0..n) to p. Returns
+// SQLITE_OK, SQLITE_NOMEM, or SQLITE_ERROR for invalid UTF-8 and
+// disallowed code points.
+static int urlIdnaMap(const char *z, int n, url_codepoints *p) {
+  const unsigned char *zIn = (const unsigned char *)z;
+  int i = 0;
+  while (i < n) {
+    int c = urlUtf8Decode(zIn, n, &i);
+    if (c < 0)
+      return SQLITE_ERROR;
+    if (c < 0x80) {
+      // without STD3 rules every ASCII character is valid, but for upper
+      // case letters
+      if (urlCodepointsAppend(p, urlToLower((unsigned char)c)))
+        return SQLITE_NOMEM;
+      continue;
+    }
+    int iRange = urlIdnaRange(c);
+    unsigned int mapping = urlIdnaMappings[iRange];
+    switch (urlIdnaRanges[iRange] & 3) {
+    case URL_IDNA_VALID:
+      if (urlCodepointsAppend(p, c))
+        return SQLITE_NOMEM;
+      break;
+    case URL_IDNA_MAPPED:
+      if (urlCodepointsReserve(p, mapping & URL_IDNA_LEN_MASK))
+        return SQLITE_NOMEM;
+      memcpy(p->a + p->n, urlIdnaPool + (mapping >> URL_IDNA_LEN_BITS),
+             (mapping & URL_IDNA_LEN_MASK) * sizeof(*p->a));
+      p->n += mapping & URL_IDNA_LEN_MASK;
+      break;
+    case URL_IDNA_IGNORED:
+      break;
+    default:
+      return SQLITE_ERROR;
+    }
+  }
+  return SQLITE_OK;
+}
+
+// Appends the full canonical decomposition of c to p, keeping combining
+// marks in canonical order. Returns SQLITE_OK or SQLITE_NOMEM.
+static int urlIdnaDecompose(url_codepoints *p, unsigned int c) {
+  unsigned int aHangul[3];
+  const unsigned int *a = &c;
+  int n = 1;
+  if (c >= URL_HANGUL_SBASE && c < URL_HANGUL_SBASE + URL_HANGUL_SCOUNT) {
+    unsigned int s = c - URL_HANGUL_SBASE;
+    aHangul[0] = URL_HANGUL_LBASE + s / URL_HANGUL_NCOUNT;
+    aHangul[1] = URL_HANGUL_VBASE + (s % URL_HANGUL_NCOUNT) / URL_HANGUL_TCOUNT;
+    aHangul[2] = URL_HANGUL_TBASE + s % URL_HANGUL_TCOUNT;
+    a = aHangul;
+    n = aHangul[2] == URL_HANGUL_TBASE ? 2 : 3;
+  } else if (c >= 0xc0) {
+    int lo = 0,
+        hi = sizeof(urlIdnaDecompositions) / sizeof(urlIdnaDecompositions[0]);
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (urlIdnaDecompositions[mid][0] < c) {
+        lo = mid + 1;
+      } else if (urlIdnaDecompositions[mid][0] > c) {
+        hi = mid;
+      } else {
+        unsigned int d = urlIdnaDecompositions[mid][1];
+        a = urlIdnaPool + (d >> URL_IDNA_LEN_BITS);
+        n = d & URL_IDNA_LEN_MASK;
+        break;
+      }
+    }
+  }
+  if (urlCodepointsReserve(p, n))
+    return SQLITE_NOMEM;
+  for (int i = 0; i < n; i++) {
+    int cc = urlIdnaClass(a[i]);
+    int j = p->n++;
+    // a mark moves before the marks of a higher class it follows
+    while (cc && j > 0 && urlIdnaClass(p->a[j - 1]) > cc) {
+      p->a[j] = p->a[j - 1];
+      j--;
+    }
+    p->a[j] = a[i];
+  }
+  return SQLITE_OK;
+}
+
+// Returns the primary composite of the code points a and b, or 0.
+static unsigned int urlIdnaComposePair(unsigned int a, unsigned int b) {
+  if (a >= URL_HANGUL_LBASE && a < URL_HANGUL_LBASE + URL_HANGUL_LCOUNT &&
+      b >= URL_HANGUL_VBASE && b < URL_HANGUL_VBASE + URL_HANGUL_VCOUNT)
+    return URL_HANGUL_SBASE +
+           ((a - URL_HANGUL_LBASE) * URL_HANGUL_VCOUNT +
+            (b - URL_HANGUL_VBASE)) *
+               URL_HANGUL_TCOUNT;
+  if (a >= URL_HANGUL_SBASE && a < URL_HANGUL_SBASE + URL_HANGUL_SCOUNT &&
+      (a - URL_HANGUL_SBASE) % URL_HANGUL_TCOUNT == 0 &&
+      b > URL_HANGUL_TBASE && b < URL_HANGUL_TBASE + URL_HANGUL_TCOUNT)
+    return a + (b - URL_HANGUL_TBASE);
+  int lo = 0,
+      hi = sizeof(urlIdnaCompositions) / sizeof(urlIdnaCompositions[0]);
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    const unsigned int *pEntry = urlIdnaCompositions[mid];
+    if (pEntry[0] < a || (pEntry[0] == a && pEntry[1] < b))
+      lo = mid + 1;
+    else if (pEntry[0] == a && pEntry[1] == b)
+      return pEntry[2];
+    else
+      hi = mid;
+  }
+  return 0;
+}
+
+// Normalizes the code points a[0..n) to NFC into pOut. Returns SQLITE_OK or
+// SQLITE_NOMEM.
+static int urlIdnaNormalize(const unsigned int *a, int n,
+                            url_codepoints *pOut) {
+  pOut->n = 0;
+  for (int i = 0; i < n; i++) {
+    if (a[i] < 0xc0) {
+      if (urlCodepointsAppend(pOut, a[i]))
+        return SQLITE_NOMEM;
+    } else if (urlIdnaDecompose(pOut, a[i])) {
+      return SQLITE_NOMEM;
+    }
+  }
+  if (pOut->n == 0)
+    return SQLITE_OK;
+  // the canonical composition algorithm of UAX #15, in place
+  unsigned int *aOut = pOut->a;
+  int iStarter = 0, nOut = 1;
+  int lastClass = urlIdnaClass(aOut[0]) ? 256 : 0;
+  for (int i = 1; i < pOut->n; i++) {
+    unsigned int c = aOut[i];
+    int cc = urlIdnaClass(c);
+    unsigned int composite = urlIdnaComposePair(aOut[iStarter], c);
+    if (composite && (lastClass < cc || lastClass == 0)) {
+      aOut[iStarter] = composite;
+      continue;
+    }
+    if (cc == 0)
+      iStarter = nOut;
+    lastClass = cc;
+    aOut[nOut++] = c;
+  }
+  pOut->n = nOut;
+  return SQLITE_OK;
+}
+
+static unsigned int urlPunycodeAdapt(unsigned int delta, unsigned int nPoints,
+                                     int isFirst) {
+  unsigned int k = 0;
+  delta = isFirst ? delta / URL_PUNYCODE_DAMP : delta / 2;
+  delta += delta / nPoints;
+  while (delta > ((URL_PUNYCODE_BASE - URL_PUNYCODE_TMIN) *
+                  URL_PUNYCODE_TMAX) /
+                     2) {
+    delta /= URL_PUNYCODE_BASE - URL_PUNYCODE_TMIN;
+    k += URL_PUNYCODE_BASE;
+  }
+  return k + (URL_PUNYCODE_BASE - URL_PUNYCODE_TMIN + 1) * delta /
+                 (delta + URL_PUNYCODE_SKEW);
+}
+
+static unsigned int urlPunycodeThreshold(unsigned int k, unsigned int bias) {
+  if (k <= bias)
+    return URL_PUNYCODE_TMIN;
+  if (k >= bias + URL_PUNYCODE_TMAX)
+    return URL_PUNYCODE_TMAX;
+  return k - bias;
+}
+
+static char urlPunycodeDigit(unsigned int d) {
+  return d < 26 ? 'a' + d : '0' + (d - 26);
+}
+
+// Appends the punycode of the code points a[0..n), without the "xn--"
+// prefix, to s. Returns SQLITE_OK, or SQLITE_ERROR on overflow.
+static int urlPunycodeEncode(const unsigned int *a, int n, sqlite3_str *s) {
+  unsigned int c = URL_PUNYCODE_INITIAL_N, bias = URL_PUNYCODE_INITIAL_BIAS;
+  unsigned int delta = 0, h, b = 0;
+  for (int i = 0; i < n; i++) {
+    if (a[i] < 0x80) {
+      sqlite3_str_appendchar(s, 1, a[i]);
+      b++;
+    }
+  }
+  if (b > 0)
+    sqlite3_str_appendchar(s, 1, '-');
+  h = b;
+  while (h < (unsigned int)n) {
+    unsigned int m = 0xffffffff;
+    for (int i = 0; i < n; i++) {
+      if (a[i] >= c && a[i] < m)
+        m = a[i];
+    }
+    if (m - c > (0xffffffff - delta) / (h + 1))
+      return SQLITE_ERROR;
+    delta += (m - c) * (h + 1);
+    c = m;
+    for (int i = 0; i < n; i++) {
+      if (a[i] < c && ++delta == 0)
+        return SQLITE_ERROR;
+      if (a[i] != c)
+        continue;
+      unsigned int q = delta;
+      for (unsigned int k = URL_PUNYCODE_BASE;; k += URL_PUNYCODE_BASE) {
+        unsigned int t = urlPunycodeThreshold(k, bias);
+        if (q < t)
+          break;
+        sqlite3_str_appendchar(
+            s, 1,
+            urlPunycodeDigit(t + (q - t) % (URL_PUNYCODE_BASE - t)));
+        q = (q - t) / (URL_PUNYCODE_BASE - t);
+      }
+      sqlite3_str_appendchar(s, 1, urlPunycodeDigit(q));
+      bias = urlPunycodeAdapt(delta, h + 1, h == b);
+      delta = 0;
+      h++;
+    }
+    delta++;
+    c++;
+  }
+  return SQLITE_OK;
+}
+
+// Decodes the punycode a[0..n), without the "xn--" prefix, into p. Returns
+// SQLITE_OK, SQLITE_NOMEM, or SQLITE_ERROR for invalid punycode.
+static int urlPunycodeDecode(const unsigned int *a, int n,
+                             url_codepoints *p) {
+  unsigned int c = URL_PUNYCODE_INITIAL_N, bias = URL_PUNYCODE_INITIAL_BIAS;
+  unsigned int i = 0;
+  int b = -1, j;
+  p->n = 0;
+  for (j = 0; j < n; j++) {
+    if (a[j] >= 0x80)
+      return SQLITE_ERROR;
+    if (a[j] == '-')
+      b = j;
+  }
+  if (urlCodepointsReserve(p, n))
+    return SQLITE_NOMEM;
+  for (j = 0; j < b; j++)
+    p->a[p->n++] = a[j];
+  for (j = b + 1; j < n;) {
+    unsigned int iOld = i, w = 1;
+    for (unsigned int k = URL_PUNYCODE_BASE;; k += URL_PUNYCODE_BASE) {
+      unsigned int d;
+      if (j >= n)
+        return SQLITE_ERROR;
+      if (a[j] >= 'a' && a[j] <= 'z')
+        d = a[j] - 'a';
+      else if (a[j] >= '0' && a[j] <= '9')
+        d = a[j] - '0' + 26;
+      else
+        return SQLITE_ERROR;
+      j++;
+      if (d > (0xffffffff - i) / w)
+        return SQLITE_ERROR;
+      i += d * w;
+      unsigned int t = urlPunycodeThreshold(k, bias);
+      if (d < t)
+        break;
+      if (w > 0xffffffff / (URL_PUNYCODE_BASE - t))
+        return SQLITE_ERROR;
+      w *= URL_PUNYCODE_BASE - t;
+    }
+    unsigned int nOut = p->n + 1;
+    bias = urlPunycodeAdapt(i - iOld, nOut, iOld == 0);
+    if (i / nOut > 0x10ffff - c)
+      return SQLITE_ERROR;
+    c += i / nOut;
+    i %= nOut;
+    // basic code points are never encoded as deltas
+    if (c < 0x80 || (c >= 0xd800 && c < 0xe000))
+      return SQLITE_ERROR;
+    if (urlCodepointsReserve(p, 1))
+      return SQLITE_NOMEM;
+    memmove(p->a + i + 1, p->a + i, (p->n - i) * sizeof(*p->a));
+    p->a[i++] = c;
+    p->n++;
+  }
+  return SQLITE_OK;
+}
+
+// Returns 1 if the NFC label a[0..n) is valid: it doesn't begin with a
+// combining mark or "xn--", and only has valid code points, which for ASCII
+// are those the URL parsers accept in hosts, less the forbidden domain code
+// points of the WHATWG URL Standard.
+static int urlIdnaLabelIsValid(const unsigned int *a, int n) {
+  if (n >= 4 && a[0] == 'x' && a[1] == 'n' && a[2] == '-' && a[3] == '-')
+    return 0;
+  for (int i = 0; i < n; i++) {
+    if (a[i] < 0x80) {
+      if ((a[i] >= 'A' && a[i] <= 'Z') || urlIsBadHostChar(a[i]) ||
+          a[i] == '%' || a[i] == '|' || a[i] == 0x7f)
+        return 0;
+      continue;
+    }
+    unsigned int flags = urlIdnaRanges[urlIdnaRange(a[i])];
+    if ((flags & 3) != URL_IDNA_VALID || (i == 0 && (flags & URL_IDNA_MARK)))
+      return 0;
+  }
+  return 1;
+}
+
+// Returns 1 if url_host_ascii() and url_host_unicode() both return the host
+// z[0..n) as it is: it is an IPv6 address, or ASCII without upper case
+// letters or labels that start with "xn--", which are decoded to check them.
+static int urlIdnaIsIdentity(const char *z, int n) {
+  int i = 0;
+  if (n > 0 && z[0] == '[')
+    return 1;
+#ifdef URL_VEC_WIDTH
+  for (; i + URL_VEC_WIDTH <= n; i += URL_VEC_WIDTH) {
+    url_vec v = urlVecLoad(z + i);
+    // bytes >= 0x80 are negative
+    url_vec upper = urlVecAnd(urlVecGt(v, urlVecSet('A' - 1)),
+                              urlVecGt(urlVecSet('Z' + 1), v));
+    if (urlVecMask(urlVecOr(urlVecGt(urlVecSet(0), v), upper)))
+      return 0;
+  }
+#endif
+  for (; i < n; i++) {
+    if ((unsigned char)z[i] >= 0x80 || (z[i] >= 'A' && z[i] <= 'Z'))
+      return 0;
+  }
+  const char *zLabel = z, *zEnd = z + n;
+  while (1) {
+    if (zEnd - zLabel >= 4 && memcmp(zLabel, "xn--", 4) == 0)
+      return 0;
+    zLabel = memchr(zLabel, '.', zEnd - zLabel);
+    if (!zLabel)
+      return 1;
+    zLabel++;
+  }
+}
+
+// Converts the host z[0..n) with UTS #46 processing, to its ASCII form when
+// toAscii is set or to its Unicode form otherwise, and appends it to s.
+// Returns SQLITE_OK, SQLITE_NOMEM, or SQLITE_ERROR if the host isn't a
+// valid domain name.
+static int urlIdnaConvert(const char *z, int n, int toAscii, sqlite3_str *s) {
+  url_codepoints mapped = {0}, host = {0}, label = {0}, check = {0};
+  int rc = urlIdnaMap(z, n, &mapped);
+  if (rc == SQLITE_OK)
+    rc = urlIdnaNormalize(mapped.a, mapped.n, &host);
+  // a host of only ignored code points
+  if (rc == SQLITE_OK && host.n == 0)
+    rc = SQLITE_ERROR;
+  for (int i = 0; rc == SQLITE_OK && i <= host.n; i++) {
+    int j = i, isAscii = 1;
+    while (j < host.n && host.a[j] != '.') {
+      if (host.a[j] >= 0x80)
+        isAscii = 0;
+      j++;
+    }
+    const unsigned int *a = host.a + i;
+    int nLabel = j - i;
+    if (i > 0)
+      sqlite3_str_appendchar(s, 1, '.');
+    if (nLabel >= 4 && a[0] == 'x' && a[1] == 'n' && a[2] == '-' &&
+        a[3] == '-') {
+      // the mapped punycode must decode to a valid label that needs it
+      int k, hasUnicode = 0;
+      rc = urlPunycodeDecode(a + 4, nLabel - 4, &label);
+      for (k = 0; rc == SQLITE_OK && k < label.n; k++)
+        hasUnicode |= label.a[k] >= 0x80;
+      if (rc == SQLITE_OK)
+        rc = urlIdnaNormalize(label.a, label.n, &check);
+      if (rc == SQLITE_OK &&
+          (!hasUnicode || check.n != label.n ||
+           memcmp(check.a, label.a, label.n * sizeof(*label.a)) ||
+           !urlIdnaLabelIsValid(label.a, label.n)))
+        rc = SQLITE_ERROR;
+      for (k = 0; rc == SQLITE_OK && k < (toAscii ? nLabel : label.n); k++)
+        urlUtf8Append(s, toAscii ? a[k] : label.a[k]);
+    } else if (!urlIdnaLabelIsValid(a, nLabel)) {
+      rc = SQLITE_ERROR;
+    } else if (toAscii && !isAscii) {
+      sqlite3_str_appendall(s, "xn--");
+      rc = urlPunycodeEncode(a, nLabel, s);
+    } else {
+      for (int k = 0; k < nLabel; k++)
+        urlUtf8Append(s, a[k]);
+    }
+    i = j;
+  }
+  sqlite3_free(mapped.a);
+  sqlite3_free(host.a);
+  sqlite3_free(label.a);
+  sqlite3_free(check.a);
+  return rc;
+}
+
+#pragma endregion
+
+#pragma region library functions
+
+// Every text result is either built in memory from sqlite3_malloc() and
+// handed over to SQLite without a copy, or is a slice of an argument or of
+// a parsed URL.
+
+// Results the n bytes at z, from sqlite3_malloc(), which SQLite frees.
+static void urlResultOwned(sqlite3_context *context, char *z,
+                           sqlite3_int64 n) {
+  urlStatsBytesOut(n);
+  sqlite3_result_text64(context, z, n, sqlite3_free, SQLITE_UTF8);
+}
+
+// Results n bytes of an argument or of a parsed URL. SQLite copies them into
+// the result's own buffer, which is re-used across rows and so cheaper than
+// an owned allocation per row, while SQLITE_STATIC could outlive the
+// argument, e.g. in max(url_host(url)).
+static void urlResultSlice(sqlite3_context *context, const char *z, int n) {
+  urlStatsBytesOut(n);
+  sqlite3_result_text(context, z, n, SQLITE_TRANSIENT);
+}
+
+// Used in most extraction functions.
+static void resultPart(sqlite3_context *context, sqlite3_value **argv,
+                       int part) {
+  url_lookup lookup;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  if (!lookup.pParts->valid)
+    urlStatsFailure();
+  if (!lookup.pParts->valid || lookup.pParts->aOff[part] < 0) {
+    sqlite3_result_null(context);
+  } else {
+    urlResultSlice(context, urlPartsText(lookup.pParts, lookup.zUrl, part),
+                   lookup.pParts->aLen[part]);
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+/** url(url [, name1, value1], [...])
+ * Generate a URL. The first "url" parameter is a base URL that is parsed, and
+ *can be overwritten by the other parameters. If "url" is null or the empty
+ *string, Then only the other parameters are used. "nameN" parameters must be
+ *one of the following:
+ *  - "scheme":
+ *  - "host":
+ *  - "path":
+ *  - "query":
+ *  - "fragment":
+ **/
+static void urlFunc(sqlite3_context *context, int argc, sqlite3_value **argv) {
+  url_curlu_pool *pPool = &urlContextState(context)->curlu;
+  CURLU *h;
+  CURLUcode uc;
+  if (argc % 2 != 1) {
+    sqlite3_result_error(context, "url() requires odd number of arguments", -1);
+    return;
+  }
+  h = urlCurluAcquire(pPool);
+  if (!h) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+
+  if (sqlite3_value_bytes(argv[0]) > 0 &&
+      sqlite3_value_type(argv[0]) != SQLITE_NULL) {
+    const char *url = (const char *)sqlite3_value_text(argv[0]);
+    uc = curl_url_set(h, CURLUPART_URL, url, CURLU_NON_SUPPORT_SCHEME);
+    if (uc) {
+      urlCurluRelease(pPool, h);
+      urlStatsFailure();
+      sqlite3_result_error(context, "Error initializating URL in the first argument", -1);
+      return;
+    }
+  }
+  for (int i = 1; i < argc; i += 2) {
+    char *partName = (char *)sqlite3_value_text(argv[i]);
+    char *partValue = (char *)sqlite3_value_text(argv[i + 1]);
+
+    if (sqlite3_stricmp(partName, "host") == 0) {
+      uc = curl_url_set(h, CURLUPART_HOST, partValue, CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'host' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "path") == 0) {
+      uc = curl_url_set(h, CURLUPART_PATH, partValue, CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'path' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "scheme") == 0) {
+      uc = curl_url_set(h, CURLUPART_SCHEME, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, curl_url_strerror(uc), -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "query") == 0) {
+      uc =
+          curl_url_set(h, CURLUPART_QUERY, partValue, CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'query' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "fragment") == 0) {
+      uc = curl_url_set(h, CURLUPART_FRAGMENT, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'fragment' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "user") == 0) {
+      uc = curl_url_set(h, CURLUPART_USER, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'user' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "password") == 0) {
+      uc = curl_url_set(h, CURLUPART_PASSWORD, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'password' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "options") == 0) {
+      uc = curl_url_set(h, CURLUPART_OPTIONS, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'options' value", -1);
+        return;
+      }
+    } else if (sqlite3_stricmp(partName, "zoneid") == 0) {
+      uc = curl_url_set(h, CURLUPART_ZONEID, partValue,
+                        CURLU_NON_SUPPORT_SCHEME);
+      if (uc) {
+        urlCurluRelease(pPool, h);
+        sqlite3_result_error(context, "Invalid 'zoneid' value", -1);
+        return;
+      }
+    } else {
+      char *zErr = sqlite3_mprintf("unknown url part '%s'", partName);
+      urlCurluRelease(pPool, h);
+      if (zErr)
+        sqlite3_result_error(context, zErr, -1);
+      else
+        sqlite3_result_error_nomem(context);
+      sqlite3_free(zErr);
+      return;
+    }
+  }
+  char *out;
+  int rc = curl_url_get(h, CURLUPART_URL, &out, CURLU_NON_SUPPORT_SCHEME);
+  if (rc) {
+    urlStatsFailure();
+    sqlite3_result_error(context, curl_url_strerror(rc), -1);
+
+  } else {
+    urlStatsAlloc();
+    urlStatsBytesOut(strlen(out));
+    // handed over as is, libcurl's allocator is not SQLite's
+    sqlite3_result_text(context, out, -1, curl_free);
+  }
+
+  urlCurluRelease(pPool, h);
+}
+
+/** url_valid(url, [strict])
+ ** Returns 1 if url is a well-formed URL according to libcurl.
+ ** Returns 0 otherwise.
+ ** @arg url - URL to check validness
+ ** @example
+ ** ```sql
+ ** select url_valid('https://google.com'); // -> 1
+ ** select url_valid('invalid'); // -> 0
+ ** ```
+ **/
+static void urlValidFunc(sqlite3_context *context, int argc,
+                         sqlite3_value **argv) {
+  url_lookup lookup;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  if (!lookup.pParts->valid)
+    urlStatsFailure();
+  sqlite3_result_int(context, lookup.pParts->valid);
+  urlLookupDone(context, 0, &lookup);
+}
+
+/** url_host(url)
+ * Returns the host portion of the given URL.
+ */
+static void urlHostFunc(sqlite3_context *context, int argc,
+                        sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_HOST);
+}
+
+/** url_scheme(url)
+ * Returns the scheme portion of the given URL.
+ */
+static void urlSchemeFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_SCHEME);
+}
+
+/** url_path(url)
+ * Returns the path portion of the given URL.
+ */
+static void urlPathFunc(sqlite3_context *context, int argc,
+                        sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_PATH);
+}
+
+/** url_query(url)
+ * Returns the query portion of the given URL.
+ */
+static void urlQueryFunc(sqlite3_context *context, int argc,
+                         sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_QUERY);
+}
+
+/** url_fragment(url)
+ * Returns the fragment portion of the given URL.
+ */
+static void urlFragmentFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_FRAGMENT);
+}
+
+/** url_user(url)
+ * Returns the user portion of the given URL.
+ */
+static void urlUserFunc(sqlite3_context *context, int argc,
+                        sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_USER);
+}
+
+/** url_password(url)
+ * Returns the password portion of the given URL.
+ */
+static void urlPasswordFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_PASSWORD);
+}
+
+/** url_options(url)
+ * Returns the options portion of the given URL.
+ */
+static void urlOptionsFunc(sqlite3_context *context, int argc,
+                           sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_OPTIONS);
+}
+
+/** url_port(url)
+ * Returns the port portion of the given URL.
+ */
+static void urlPortFunc(sqlite3_context *context, int argc,
+                        sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_PORT);
+}
+
+/** url_zoneid(url)
+ * Returns the zoneid portion of the given URL.
+ */
+static void urlZoneidFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  resultPart(context, argv, URL_PART_ZONEID);
+}
+
+// Results the public suffix of the host of the URL argv[0], or with isDomain
+// its registrable domain, ASCII lower cased. NULL for invalid URLs, IP
+// addresses and hosts that have neither.
+static void resultPublicSuffix(sqlite3_context *context, sqlite3_value **argv,
+                               int isDomain) {
+  url_lookup lookup;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  const url_parts *pParts = lookup.pParts;
+  const char *zHost = 0;
+  int nHost = 0, iStart = -1;
+  if (!pParts->valid)
+    urlStatsFailure();
+  if (pParts->valid && pParts->aOff[URL_PART_HOST] >= 0) {
+    zHost = urlPartsText(pParts, lookup.zUrl, URL_PART_HOST);
+    nHost = urlPslHostLength(zHost, pParts->aLen[URL_PART_HOST]);
+  }
+  if (nHost > 0)
+    iStart = urlPslSuffix(zHost, nHost);
+  if (isDomain && iStart >= 0)
+    iStart = urlPslDomain(zHost, iStart);
+  if (iStart < 0) {
+    sqlite3_result_null(context);
+  } else {
+    // lower cased like url_host_reversed(), so that results group together,
+    // without a copy for hosts that already are
+    const char *z = zHost + iStart;
+    int n = nHost - iStart, i = 0;
+    while (i < n && !urlIsUpper(z[i]))
+      i++;
+    if (i == n) {
+      urlResultSlice(context, z, n);
+    } else {
+      char *zOut = sqlite3_malloc(n + 1);
+      if (!zOut) {
+        sqlite3_result_error_nomem(context);
+      } else {
+        urlStatsAlloc();
+        memcpy(zOut, z, i);
+        for (; i < n; i++)
+          zOut[i] = urlToLower(z[i]);
+        zOut[n] = 0;
+        urlResultOwned(context, zOut, n);
+      }
+    }
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+/** url_public_suffix(url)
+ * Returns the public suffix of the host of the given URL, like "co.uk" for
+ * "https://www.example.co.uk", per the Public Suffix List compiled into the
+ * extension, lower cased. Top level domains that aren't on the list are
+ * public suffixes, IP addresses have none.
+ */
+static void urlPublicSuffixFunc(sqlite3_context *context, int argc,
+                                sqlite3_value **argv) {
+  resultPublicSuffix(context, argv, 0);
+}
+
+/** url_domain(url)
+ * Returns the registrable domain of the host of the given URL, its public
+ * suffix and the label before it, lower cased, like "example.co.uk" for
+ * "https://www.Example.co.uk". NULL when the host is a public suffix itself.
+ */
+static void urlDomainFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  resultPublicSuffix(context, argv, 1);
+}
+
+// Writes the labels of the n byte host z to zOut in reverse order, ASCII
+// lower cased and each followed by sep, like "com.example.www." for
+// "www.Example.com". A trailing dot is dropped, and IP addresses are copied
+// as they are, followed by sep. Returns the end of the output, which is at
+// most n + 1 bytes long.
+static char *urlHostReverseInto(const char *z, int n, char sep, char *zOut) {
+  if (n > 0 && z[n - 1] == '.')
+    n--;
+  if (n > 0 && urlPslHostLength(z, n) == 0) {
+    memcpy(zOut, z, n);
+    zOut += n;
+    *zOut++ = sep;
+    return zOut;
+  }
+  int iEnd = n;
+  while (iEnd >= 0) {
+    int i = iEnd;
+    while (i > 0 && z[i - 1] != '.')
+      i--;
+    for (int j = i; j < iEnd; j++)
+      *zOut++ = urlToLower(z[j]);
+    *zOut++ = sep;
+    iEnd = i - 1;
+  }
+  return zOut;
+}
+
+/** url_host_reversed(url)
+ * Returns the host of the given URL with its labels in reverse order, lower
+ * cased and each followed by a dot, like "com.example.www." for
+ * "https://www.Example.com/". An index on it turns subdomain lookups into
+ * range scans, see url_host_range().
+ */
+static void urlHostReversedFunc(sqlite3_context *context, int argc,
+                                sqlite3_value **argv) {
+  url_lookup lookup;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  const url_parts *pParts = lookup.pParts;
+  if (!pParts->valid)
+    urlStatsFailure();
+  if (!pParts->valid || pParts->aOff[URL_PART_HOST] < 0) {
+    sqlite3_result_null(context);
+    urlLookupDone(context, 0, &lookup);
+    return;
+  }
+  const char *zHost = urlPartsText(pParts, lookup.zUrl, URL_PART_HOST);
+  int nHost = pParts->aLen[URL_PART_HOST];
+  char *z = sqlite3_malloc(nHost + 1);
+  if (!z) {
+    sqlite3_result_error_nomem(context);
+  } else {
+    urlStatsAlloc();
+    char *zEnd = urlHostReverseInto(zHost, nHost, '.', z);
+    urlResultOwned(context, z, zEnd - z);
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+// Schemes whose default port url_surt() and url_normalize() drop
+static const struct {
+  const char *zScheme;
+  const char *zPort;
+} aUrlDefaultPort[] = {
+    {"http", "80"}, {"https", "443"}, {"ws", "80"}, {"wss", "443"},
+    {"ftp", "21"},
+};
+
+// Returns non-zero if the port of the parsed URL is the default one of its
+// scheme.
+static int urlIsDefaultPort(const url_parts *p, const char *zUrl) {
+  const char *zScheme, *zPort;
+  int nScheme, nPort;
+  if (!urlPartsGet(p, zUrl, URL_PART_SCHEME, &zScheme, &nScheme) ||
+      !urlPartsGet(p, zUrl, URL_PART_PORT, &zPort, &nPort))
+    return 0;
+  for (size_t i = 0; i < sizeof(aUrlDefaultPort) / sizeof(aUrlDefaultPort[0]);
+       i++) {
+    if (sqlite3_strnicmp(zScheme, aUrlDefaultPort[i].zScheme, nScheme) == 0 &&
+        aUrlDefaultPort[i].zScheme[nScheme] == 0)
+      return strlen(aUrlDefaultPort[i].zPort) == (size_t)nPort &&
+             memcmp(zPort, aUrlDefaultPort[i].zPort, nPort) == 0;
+  }
+  return 0;
+}
+
+/** url_surt(url)
+ * Returns the SURT (Sort-friendly URI Reordering Transform) form of the
+ * given URL, as used by web archives: its reversed host, port, path and
+ * query, like "com,example,www)/a?b=1" for "https://www.Example.com/a?b=1".
+ * The scheme, user info, default ports and fragment are dropped. NULL for
+ * URLs without a host.
+ */
+static void urlSurtFunc(sqlite3_context *context, int argc,
+                        sqlite3_value **argv) {
+  url_lookup lookup;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  const url_parts *pParts = lookup.pParts;
+  const char *zUrl = lookup.zUrl;
+  if (!pParts->valid)
+    urlStatsFailure();
+  if (!pParts->valid || pParts->aOff[URL_PART_HOST] < 0) {
+    sqlite3_result_null(context);
+    urlLookupDone(context, 0, &lookup);
+    return;
+  }
+  const char *zPort = 0, *zPath = "/", *zQuery = 0;
+  int nHost = pParts->aLen[URL_PART_HOST], nPort = 0, nPath = 1, nQuery = 0;
+  if (pParts->aOff[URL_PART_PORT] >= 0 && !urlIsDefaultPort(pParts, zUrl)) {
+    zPort = urlPartsText(pParts, zUrl, URL_PART_PORT);
+    nPort = pParts->aLen[URL_PART_PORT];
+  }
+  if (pParts->aOff[URL_PART_PATH] >= 0 && pParts->aLen[URL_PART_PATH] > 0) {
+    zPath = urlPartsText(pParts, zUrl, URL_PART_PATH);
+    nPath = pParts->aLen[URL_PART_PATH];
+  }
+  if (pParts->aOff[URL_PART_QUERY] >= 0 && pParts->aLen[URL_PART_QUERY] > 0) {
+    zQuery = urlPartsText(pParts, zUrl, URL_PART_QUERY);
+    nQuery = pParts->aLen[URL_PART_QUERY];
+  }
+  char *z =
+      sqlite3_malloc64((sqlite3_int64)nHost + nPort + nPath + nQuery + 3);
+  if (!z) {
+    sqlite3_result_error_nomem(context);
+    urlLookupDone(context, 0, &lookup);
+    return;
+  }
+  urlStatsAlloc();
+  const char *zHost = urlPartsText(pParts, zUrl, URL_PART_HOST);
+  // the separator after the last label makes room for the ":" or ")"
+  char *zEnd = urlHostReverseInto(zHost, nHost, ',', z) - 1;
+  if (zPort) {
+    *zEnd++ = ':';
+    memcpy(zEnd, zPort, nPort);
+    zEnd += nPort;
+  }
+  *zEnd++ = ')';
+  memcpy(zEnd, zPath, nPath);
+  zEnd += nPath;
+  if (zQuery) {
+    *zEnd++ = '?';
+    memcpy(zEnd, zQuery, nQuery);
+    zEnd += nQuery;
+  }
+  urlResultOwned(context, z, zEnd - z);
+  urlLookupDone(context, 0, &lookup);
+}
+
+#define URL_NORMALIZE_STRIP_FRAGMENT 1
+#define URL_NORMALIZE_STRIP_TRACKING 2
+#define URL_NORMALIZE_KEEP_QUERY_ORDER 4
+
+static const struct {
+  const char *zName;
+  int flag;
+} aUrlNormalizeFlag[] = {
+    {"strip_fragment", URL_NORMALIZE_STRIP_FRAGMENT},
+    {"strip_tracking", URL_NORMALIZE_STRIP_TRACKING},
+    {"keep_query_order", URL_NORMALIZE_KEEP_QUERY_ORDER},
+};
+
+// Query parameters that only track where a visit came from, dropped by the
+// "strip_tracking" flag of url_normalize(), along with every "utm_*" one.
+static const char *const azUrlTrackingParam[] = {
+    "_ga",    "_gl",    "_hsenc", "_hsmi",  "dclid",   "fbclid",
+    "gclid",  "gclsrc", "igshid", "mc_cid", "mc_eid",  "mkt_tok",
+    "msclkid", "yclid",
+};
+
+// Parses the flags argument of url_normalize(), names separated by commas
+// or spaces, into *pFlags. Returns non-zero after setting an error on the
+// context for unknown flags.
+static int urlNormalizeFlags(sqlite3_context *context, sqlite3_value *pValue,
+                             int *pFlags) {
+  const char *z = (const char *)sqlite3_value_text(pValue);
+  int n = sqlite3_value_bytes(pValue);
+  int i = 0;
+  *pFlags = 0;
+  while (i < n) {
+    while (i < n && (z[i] == ',' || z[i] == ' '))
+      i++;
+    int iStart = i;
+    while (i < n && z[i] != ',' && z[i] != ' ')
+      i++;
+    if (i == iStart)
+      break;
+    size_t k = 0;
+    while (k < sizeof(aUrlNormalizeFlag) / sizeof(aUrlNormalizeFlag[0]) &&
+           !(strlen(aUrlNormalizeFlag[k].zName) == (size_t)(i - iStart) &&
+             memcmp(aUrlNormalizeFlag[k].zName, z + iStart, i - iStart) == 0))
+      k++;
+    if (k == sizeof(aUrlNormalizeFlag) / sizeof(aUrlNormalizeFlag[0])) {
+      char *zErr = sqlite3_mprintf("unknown url_normalize() flag \"%.*s\"",
+                                   i - iStart, z + iStart);
+      sqlite3_result_error(context, zErr ? zErr : "unknown flag", -1);
+      sqlite3_free(zErr);
+      return 1;
+    }
+    *pFlags |= aUrlNormalizeFlag[k].flag;
+  }
+  return 0;
+}
+
+// Returns non-zero if the n byte query parameter name z is a tracking one.
+static int urlIsTrackingParam(const char *z, int n) {
+  if (n > 4 && sqlite3_strnicmp(z, "utm_", 4) == 0)
+    return 1;
+  for (size_t i = 0; i < sizeof(azUrlTrackingParam) / sizeof(char *); i++) {
+    if (strlen(azUrlTrackingParam[i]) == (size_t)n &&
+        sqlite3_strnicmp(z, azUrlTrackingParam[i], n) == 0)
+      return 1;
+  }
+  return 0;
+}
+
+typedef struct url_query_pair url_query_pair;
+struct url_query_pair {
+  // the "name=value" pair and the length of its name
+  const char *z;
+  int n;
+  int nName;
+  // position in the query, so sorting keeps repeated names in order
+  int i;
+};
+
+static int urlQueryPairCompare(const void *pA, const void *pB) {
+  const url_query_pair *a = pA, *b = pB;
+  int c = memcmp(a->z, b->z, a->nName < b->nName ? a->nName : b->nName);
+  if (c == 0)
+    c = a->nName - b->nName;
+  return c ? c : a->i - b->i;
+}
+
+// Writes the n byte query z, with its escapes already normalized, to zOut
+// without empty pairs, sorted by name unless URL_NORMALIZE_KEEP_QUERY_ORDER
+// is in flags, and without tracking parameters with
+// URL_NORMALIZE_STRIP_TRACKING. Returns the end of the output, or NULL on
+// OOM.
+static char *urlNormalizeQueryInto(const char *z, int n, int flags,
+                                   char *zOut) {
+  url_query_pair aStatic[16], *aPair = aStatic;
+  int nPair = 0, nMax = 1;
+  for (int i = 0; i < n; i++)
+    nMax += z[i] == '&';
+  if (nMax > (int)(sizeof(aStatic) / sizeof(aStatic[0]))) {
+    aPair = sqlite3_malloc64(sizeof(*aPair) * (sqlite3_int64)nMax);
+    if (!aPair)
+      return 0;
+    urlStatsAlloc();
+  }
+  for (int i = 0; i < n; i++) {
+    int iEnd = urlFind(z, i, n, '&');
+    url_query_pair *p = &aPair[nPair];
+    p->z = z + i;
+    p->n = iEnd - i;
+    p->nName = urlFind(z, i, iEnd, '=') - i;
+    p->i = nPair;
+    if (p->n > 0 && !((flags & URL_NORMALIZE_STRIP_TRACKING) &&
+                      urlIsTrackingParam(p->z, p->nName)))
+      nPair++;
+    i = iEnd;
+  }
+  if (nPair > 1 && !(flags & URL_NORMALIZE_KEEP_QUERY_ORDER))
+    qsort(aPair, nPair, sizeof(*aPair), urlQueryPairCompare);
+  for (int i = 0; i < nPair; i++) {
+    *zOut++ = i == 0 ? '?' : '&';
+    memcpy(zOut, aPair[i].z, aPair[i].n);
+    zOut += aPair[i].n;
+  }
+  if (aPair != aStatic)
+    sqlite3_free(aPair);
+  return zOut;
+}
+
+// Copies the text of part to zOut, with its escapes normalized when
+// isNormal. Returns the end of the output.
+static char *urlPartInto(const url_parts *p, const char *zUrl, int part,
+                         int isNormal, char *zOut) {
+  const char *z = urlPartsText(p, zUrl, part);
+  int n = p->aLen[part];
+  if (isNormal)
+    return urlNormalizeEscapesInto(z, n, 0, zOut);
+  memcpy(zOut, z, n);
+  return zOut + n;
+}
+
+// Writes the authority of the parsed URL, its user info, host and port, to
+// zOut. When isNormal, escapes are normalized, the host lower cased and a
+// default port dropped, like url_normalize(). Returns the end of the output,
+// which is at most 8 bytes longer than those parts.
+static char *urlAuthorityInto(const url_parts *p, const char *zUrl,
+                              int isNormal, char *zOut) {
+  if (p->aOff[URL_PART_USER] >= 0 || p->aOff[URL_PART_PASSWORD] >= 0) {
+    if (p->aOff[URL_PART_USER] >= 0)
+      zOut = urlPartInto(p, zUrl, URL_PART_USER, isNormal, zOut);
+    if (p->aOff[URL_PART_PASSWORD] >= 0) {
+      *zOut++ = ':';
+      zOut = urlPartInto(p, zUrl, URL_PART_PASSWORD, isNormal, zOut);
+    }
+    if (p->aOff[URL_PART_OPTIONS] >= 0) {
+      *zOut++ = ';';
+      zOut = urlPartInto(p, zUrl, URL_PART_OPTIONS, isNormal, zOut);
+    }
+    *zOut++ = '@';
+  }
+  const char *zPart;
+  int nPart;
+  if (urlPartsGet(p, zUrl, URL_PART_HOST, &zPart, &nPart)) {
+    for (int i = 0; i < nPart; i++)
+      *zOut++ = isNormal ? urlToLower(zPart[i]) : zPart[i];
+    // the zone ID goes back inside the brackets of its IPv6 address
+    if (nPart > 0 && zPart[nPart - 1] == ']' &&
+        urlPartsGet(p, zUrl, URL_PART_ZONEID, &zPart, &nPart)) {
+      zOut[-1] = '%';
+      *zOut++ = '2';
+      *zOut++ = '5';
+      memcpy(zOut, zPart, nPart);
+      zOut += nPart;
+      *zOut++ = ']';
+    }
+  }
+  if (urlPartsGet(p, zUrl, URL_PART_PORT, &zPart, &nPart) &&
+      !(isNormal && urlIsDefaultPort(p, zUrl))) {
+    *zOut++ = ':';
+    memcpy(zOut, zPart, nPart);
+    zOut += nPart;
+  }
+  return zOut;
+}
+
+// Returns the room url_normalize() needs for the parsed URL: every part at
+// most keeps its length, and the query is normalized into scratch space at
+// the end of the buffer before it is sorted.
+static sqlite3_int64 urlNormalizedLength(const url_parts *p) {
+  sqlite3_int64 n = 16;
+  for (int i = 0; i < URL_PART_COUNT; i++)
+    n += p->aOff[i] >= 0 ? p->aLen[i] : 0;
+  if (p->aOff[URL_PART_QUERY] >= 0)
+    n += p->aLen[URL_PART_QUERY];
+  return n;
+}
+
+// Writes the canonical form of the valid parsed URL to z, which has room
+// for the n bytes from urlNormalizedLength(), see url_normalize(). Returns
+// the end of the output, or NULL on OOM.
+static char *urlNormalizeInto(const url_parts *p, const char *zUrl, int flags,
+                              char *z, sqlite3_int64 n) {
+  char *zEnd = z;
+  const char *zPart;
+  int nPart;
+  if (urlPartsGet(p, zUrl, URL_PART_SCHEME, &zPart, &nPart)) {
+    for (int i = 0; i < nPart; i++)
+      *zEnd++ = urlToLower(zPart[i]);
+    *zEnd++ = ':';
+  }
+  *zEnd++ = '/';
+  *zEnd++ = '/';
+  zEnd = urlAuthorityInto(p, zUrl, 1, zEnd);
+  if (urlPartsGet(p, zUrl, URL_PART_PATH, &zPart, &nPart))
+    zEnd = urlNormalizeEscapesInto(zPart, nPart, 1, zEnd);
+  if (urlPartsGet(p, zUrl, URL_PART_QUERY, &zPart, &nPart)) {
+    char *zQuery = z + n - nPart;
+    int nQuery = urlNormalizeEscapesInto(zPart, nPart, 0, zQuery) - zQuery;
+    zEnd = urlNormalizeQueryInto(zQuery, nQuery, flags, zEnd);
+    if (!zEnd)
+      return 0;
+  }
+  if (!(flags & URL_NORMALIZE_STRIP_FRAGMENT) &&
+      urlPartsGet(p, zUrl, URL_PART_FRAGMENT, &zPart, &nPart) && nPart > 0) {
+    *zEnd++ = '#';
+    zEnd = urlNormalizeEscapesInto(zPart, nPart, 0, zEnd);
+  }
+  return zEnd;
+}
+
+// Looks up the URL argv[0] for url_normalize() and url_fingerprint(), after
+// checking their arguments and parsing the flags in argv[1] into *pFlags.
+// Returns non-zero when there is nothing to normalize, with the result set
+// to NULL or an error, otherwise the caller must call urlLookupDone().
+static int urlNormalizeStart(sqlite3_context *context, int argc,
+                             sqlite3_value **argv, const char *zFunc,
+                             int *pFlags, url_lookup *pLookup) {
+  *pFlags = 0;
+  if (argc < 1 || argc > 2) {
+    char *zErr = sqlite3_mprintf("%s() requires 1 or 2 arguments", zFunc);
+    sqlite3_result_error(context, zErr ? zErr : "wrong number of arguments",
+                         -1);
+    sqlite3_free(zErr);
+    return 1;
+  }
+  if (argc > 1 && urlNormalizeFlags(context, argv[1], pFlags))
+    return 1;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return 1;
+  }
+  if (urlLookup(context, argv, 0, pLookup)) {
+    sqlite3_result_error_nomem(context);
+    return 1;
+  }
+  if (!pLookup->pParts->valid) {
+    urlStatsFailure();
+    sqlite3_result_null(context);
+    urlLookupDone(context, 0, pLookup);
+    return 1;
+  }
+  return 0;
+}
+
+/** url_normalize(url [, flags])
+ * Returns the canonical form of the given URL, so different spellings of the
+ * same URL compare equal: the scheme and host are lower cased, default ports
+ * dropped, "%XX" escapes of unreserved characters decoded and the others
+ * upper cased, empty query parameters dropped and the rest sorted by name.
+ * Dot segments are already resolved by the parser. "flags" is a list of
+ * names separated by commas or spaces:
+ *  - "strip_fragment": drops the fragment
+ *  - "strip_tracking": drops "utm_*", "gclid", "fbclid" and other tracking
+ *    query parameters
+ *  - "keep_query_order": doesn't sort the query parameters
+ * NULL for invalid URLs.
+ */
+static void urlNormalizeFunc(sqlite3_context *context, int argc,
+                             sqlite3_value **argv) {
+  url_lookup lookup;
+  int flags;
+  if (urlNormalizeStart(context, argc, argv, "url_normalize", &flags,
+                        &lookup))
+    return;
+  sqlite3_int64 n = urlNormalizedLength(lookup.pParts);
+  char *z = sqlite3_malloc64(n);
+  char *zEnd = 0;
+  if (z) {
+    urlStatsAlloc();
+    zEnd = urlNormalizeInto(lookup.pParts, lookup.zUrl, flags, z, n);
+  }
+  if (zEnd) {
+    urlResultOwned(context, z, zEnd - z);
+  } else {
+    sqlite3_free(z);
+    sqlite3_result_error_nomem(context);
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+// Normalized URLs up to this long are fingerprinted without an allocation
+#define URL_FINGERPRINT_STACK_BUFFER 1024
+
+/** url_fingerprint(url [, flags])
+ * Returns a 64-bit hash of the canonical form of the given URL, the XXH64
+ * with seed 0 of url_normalize(url, flags) as a signed integer, which is
+ * stable across versions and platforms. NULL for invalid URLs.
+ */
+static void urlFingerprintFunc(sqlite3_context *context, int argc,
+                               sqlite3_value **argv) {
+  url_lookup lookup;
+  int flags;
+  char aBuf[URL_FINGERPRINT_STACK_BUFFER];
+  if (urlNormalizeStart(context, argc, argv, "url_fingerprint", &flags,
+                        &lookup))
+    return;
+  sqlite3_int64 n = urlNormalizedLength(lookup.pParts);
+  char *z = aBuf;
+  char *zEnd = 0;
+  if (n > (sqlite3_int64)sizeof(aBuf)) {
+    z = sqlite3_malloc64(n);
+    if (z)
+      urlStatsAlloc();
+  }
+  if (z)
+    zEnd = urlNormalizeInto(lookup.pParts, lookup.zUrl, flags, z, n);
+  if (zEnd)
+    sqlite3_result_int64(context, (sqlite3_int64)urlXxh64(z, zEnd - z, 0));
+  else
+    sqlite3_result_error_nomem(context);
+  if (z != aBuf)
+    sqlite3_free(z);
+  urlLookupDone(context, 0, &lookup);
+}
+
+// The components of a URI reference, see urlReferenceSplit(). Every
+// component but the path is NULL when absent.
+typedef struct url_reference url_reference;
+struct url_reference {
+  const char *zScheme;
+  const char *zAuthority;
+  const char *zPath;
+  const char *zQuery;
+  const char *zFragment;
+  int nScheme;
+  int nAuthority;
+  int nPath;
+  int nQuery;
+  int nFragment;
+};
+
+// Splits the URI reference z into its components with the regular
+// expression of RFC 3986 appendix B, where a scheme is only taken when it
+// is made of valid scheme characters.
+static void urlReferenceSplit(const char *z, int n, url_reference *r) {
+  int i = 0, iStart;
+  memset(r, 0, sizeof(*r));
+  if (n > 0 && urlIsAlpha(z[0])) {
+    while (i < n && (urlIsAlpha(z[i]) || urlIsDigit(z[i]) || z[i] == '+' ||
+                     z[i] == '-' || z[i] == '.'))
+      i++;
+    if (i < n && z[i] == ':') {
+      r->zScheme = z;
+      r->nScheme = i++;
+    } else {
+      i = 0;
+    }
+  }
+  if (n - i >= 2 && z[i] == '/' && z[i + 1] == '/') {
+    iStart = i += 2;
+    while (i < n && z[i] != '/' && z[i] != '?' && z[i] != '#')
+      i++;
+    r->zAuthority = z + iStart;
+    r->nAuthority = i - iStart;
+  }
+  iStart = i;
+  while (i < n && z[i] != '?' && z[i] != '#')
+    i++;
+  r->zPath = z + iStart;
+  r->nPath = i - iStart;
+  if (i < n && z[i] == '?') {
+    iStart = ++i;
+    while (i < n && z[i] != '#')
+      i++;
+    r->zQuery = z + iStart;
+    r->nQuery = i - iStart;
+  }
+  if (i < n) {
+    r->zFragment = z + i + 1;
+    r->nFragment = n - i - 1;
+  }
+}
+
+// Writes the reference r resolved against the valid parsed base URL to
+// zOut, per RFC 3986 section 5.2.2. zOut needs room for
+// urlNormalizedLength() of the base plus the length of the reference.
+// Returns the end of the output.
+static char *urlResolveInto(const url_parts *p, const char *zUrl,
+                            const url_reference *r, char *zOut) {
+  const char *zPart = 0;
+  int nPart = 0;
+  const char *zQuery = r->zQuery;
+  int nQuery = r->nQuery;
+  if (r->zScheme) {
+    memcpy(zOut, r->zScheme, r->nScheme);
+    zOut += r->nScheme;
+  } else if (urlPartsGet(p, zUrl, URL_PART_SCHEME, &zPart, &nPart)) {
+    memcpy(zOut, zPart, nPart);
+    zOut += nPart;
+  }
+  *zOut++ = ':';
+  if (r->zScheme || r->zAuthority) {
+    if (r->zAuthority) {
+      *zOut++ = '/';
+      *zOut++ = '/';
+      memcpy(zOut, r->zAuthority, r->nAuthority);
+      zOut += r->nAuthority;
+    }
+    zOut += urlRemoveDotSegments(r->zPath, 0, r->nPath, zOut);
+  } else {
+    *zOut++ = '/';
+    *zOut++ = '/';
+    zOut = urlAuthorityInto(p, zUrl, 0, zOut);
+    int hasPath = urlPartsGet(p, zUrl, URL_PART_PATH, &zPart, &nPart);
+    if (r->nPath == 0) {
+      // the base path is already free of dot segments
+      if (hasPath) {
+        memcpy(zOut, zPart, nPart);
+        zOut += nPart;
+      }
+      if (!r->zQuery)
+        urlPartsGet(p, zUrl, URL_PART_QUERY, &zQuery, &nQuery);
+    } else {
+      // the merged path is built in place, then its dot segments removed
+      char *zPath = zOut;
+      if (r->zPath[0] != '/') {
+        if (!hasPath || nPart == 0)
+          *zOut++ = '/';
+        while (nPart > 0 && zPart[nPart - 1] != '/')
+          nPart--;
+        memcpy(zOut, zPart, nPart);
+        zOut += nPart;
+      }
+      memcpy(zOut, r->zPath, r->nPath);
+      zOut += r->nPath;
+      zOut = zPath + urlRemoveDotSegments(zPath, 0, zOut - zPath, zPath);
+    }
+  }
+  if (zQuery) {
+    *zOut++ = '?';
+    memcpy(zOut, zQuery, nQuery);
+    zOut += nQuery;
+  }
+  if (r->zFragment) {
+    *zOut++ = '#';
+    memcpy(zOut, r->zFragment, r->nFragment);
+    zOut += r->nFragment;
+  }
+  return zOut;
+}
+
+/** url_resolve(base, ref)
+ * Resolves the URI reference ref against the base URL, the way a browser
+ * follows a link, per RFC 3986 section 5.2: "x", "./x" and "../x" are
+ * merged with the path of base, "?y" and "#f" only replace its query and
+ * fragment, and references with a scheme or starting with "//" replace
+ * everything up to their first component. Leading and trailing spaces and
+ * control characters of ref are ignored. The result is not normalized.
+ * NULL if either argument is NULL or base is not a valid URL.
+ */
+static void urlResolveFunc(sqlite3_context *context, int argc,
+                           sqlite3_value **argv) {
+  url_lookup lookup;
+  url_reference ref;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL ||
+      sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  if (!lookup.pParts->valid) {
+    urlStatsFailure();
+    sqlite3_result_null(context);
+    urlLookupDone(context, 0, &lookup);
+    return;
+  }
+  const char *zRef = (const char *)sqlite3_value_text(argv[1]);
+  int nRef = sqlite3_value_bytes(argv[1]);
+  if (!zRef) {
+    sqlite3_result_error_nomem(context);
+    urlLookupDone(context, 0, &lookup);
+    return;
+  }
+  while (nRef > 0 && (unsigned char)zRef[0] <= ' ') {
+    zRef++;
+    nRef--;
+  }
+  while (nRef > 0 && (unsigned char)zRef[nRef - 1] <= ' ')
+    nRef--;
+  urlReferenceSplit(zRef, nRef, &ref);
+  char *z = sqlite3_malloc64(urlNormalizedLength(lookup.pParts) + nRef);
+  if (z) {
+    urlStatsAlloc();
+    char *zEnd = urlResolveInto(lookup.pParts, lookup.zUrl, &ref, z);
+    urlResultOwned(context, z, zEnd - z);
+  } else {
+    sqlite3_result_error_nomem(context);
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+// Returns a new reference to the table zName compiled by xCompile, from the
+// connection's cache unless it is stale. Inside a transaction that wrote
+// since the cached table was last current, or that may roll back, the table
+// is compiled for the caller only. Returns an SQLite error code, with
+// *pzErr set as for url_table_compiler.
+static int urlTableGet(sqlite3 *db, url_state *pState, const char *zFunc,
+                       const char *zName, url_table_compiler xCompile,
+                       url_table **ppTable, char **pzErr) {
+  int isAutocommit = sqlite3_get_autocommit(db);
+  sqlite3_int64 nChange = sqlite3_total_changes64(db);
+  url_table **pp = &pState->pTables;
+  while (*pp &&
+         ((*pp)->xCompile != xCompile || sqlite3_stricmp((*pp)->zName, zName)))
+    pp = &(*pp)->pNext;
+  url_table *pCached = *pp;
+  if (pCached && urlTableIsStale(db, pCached)) {
+    *pp = pCached->pNext;
+    urlTableUnref(pCached);
+    pCached = 0;
+  }
+  if (pCached && (isAutocommit || pCached->nChange == nChange)) {
+    // outside of transactions every change is committed, and so counted by
+    // the data versions
+    pCached->nChange = nChange;
+    pCached->nRef++;
+    *ppTable = pCached;
+    return SQLITE_OK;
+  }
+  int rc = xCompile(db, zFunc, zName, ppTable, pzErr);
+  if (rc != SQLITE_OK)
+    return rc;
+  (*ppTable)->xCompile = xCompile;
+  if (isAutocommit && !pCached) {
+    (*ppTable)->nRef++;
+    (*ppTable)->pNext = pState->pTables;
+    pState->pTables = *ppTable;
+  }
+  return SQLITE_OK;
+}
+
+// Returns the table named by argv[iArg] compiled by xCompile, kept as the
+// auxdata of the argument, or NULL with an error result.
+static url_table *urlTableArg(sqlite3_context *context, sqlite3_value **argv,
+                              int iArg, const char *zFunc,
+                              url_table_compiler xCompile) {
+  url_table *pTable = sqlite3_get_auxdata(context, iArg);
+  if (pTable)
+    return pTable;
+  const char *zName = (const char *)sqlite3_value_text(argv[iArg]);
+  char *zErr = 0;
+  int rc;
+  if (!zName) {
+    zErr = sqlite3_mprintf("%s() table must be text", zFunc);
+    rc = zErr ? SQLITE_ERROR : SQLITE_NOMEM;
+  } else {
+    rc = urlTableGet(sqlite3_context_db_handle(context),
+                     urlContextState(context), zFunc, zName, xCompile, &pTable,
+                     &zErr);
+  }
+  if (rc != SQLITE_OK) {
+    if (zErr)
+      sqlite3_result_error(context, zErr, -1);
+    else
+      sqlite3_result_error_code(context, rc);
+    sqlite3_free(zErr);
+    return 0;
+  }
+  sqlite3_set_auxdata(context, iArg, pTable, urlTableUnref);
+  // the auxdata may already have been released for a non-constant table
+  pTable = sqlite3_get_auxdata(context, iArg);
+  if (!pTable)
+    sqlite3_result_error_nomem(context);
+  return pTable;
+}
+
+/** url_host_matches(url, list_table)
+ * Returns 1 if the host of the given URL, or one of its parent domains, is
+ * listed in the first column of the table named list_table, 0 otherwise.
+ * The table is compiled into a hash set once per connection and compiled
+ * again after it may have changed. NULL for invalid URLs.
+ */
+static void urlHostMatchesFunc(sqlite3_context *context, int argc,
+                               sqlite3_value **argv) {
+  url_hostset *pSet = (url_hostset *)urlTableArg(
+      context, argv, 1, "url_host_matches", urlHostsetCompile);
+  url_lookup lookup;
+  if (!pSet)
+    return;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    return;
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  const char *zHost;
+  int nHost;
+  if (!lookup.pParts->valid) {
+    urlStatsFailure();
+    sqlite3_result_null(context);
+  } else if (urlPartsGet(lookup.pParts, lookup.zUrl, URL_PART_HOST, &zHost,
+                         &nHost)) {
+    int n = urlPslHostLength(zHost, nHost);
+    // IP addresses have no parent domains
+    int isMatch = n > 0 ? urlHostsetMatch(pSet, zHost, n, 0)
+                        : urlHostsetMatch(pSet, zHost, nHost, 1);
+    sqlite3_result_int(context, isMatch);
+  } else {
+    sqlite3_result_int(context, 0);
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+// Parses the host of the URL argv[0] into the 16 bytes of aAddr for the
+// url_host_ip() family. Returns 4 or 6 for IPv4 or IPv6 hosts, or 0 for
+// NULL, invalid URLs and other hosts, with an error result on OOM.
+static int urlHostIpArg(sqlite3_context *context, sqlite3_value **argv,
+                        unsigned char *aAddr) {
+  url_lookup lookup;
+  const char *zHost;
+  int nHost, version = 0;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    return 0;
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return 0;
+  }
+  if (!lookup.pParts->valid)
+    urlStatsFailure();
+  else if (urlPartsGet(lookup.pParts, lookup.zUrl, URL_PART_HOST, &zHost,
+                       &nHost))
+    version = urlHostAddress(zHost, nHost, aAddr);
+  urlLookupDone(context, 0, &lookup);
+  return version;
+}
+
+/** url_host_ip(url [, format])
+ * Returns the IP address of the host of the given URL as a 16-byte BLOB in
+ * network byte order, with IPv4 addresses mapped into ::ffff:0:0/96 so that
+ * both kinds compare and sort together. With format 'integer', returns an
+ * IPv4 address as a 32-bit unsigned integer instead. NULL for invalid URLs,
+ * hosts that aren't IP addresses, and IPv6 addresses with 'integer'.
+ */
+static void urlHostIpFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  static const unsigned char aMapped[12] = {0, 0, 0, 0, 0,    0,
+                                            0, 0, 0, 0, 0xff, 0xff};
+  unsigned char aAddr[16];
+  int isInteger = 0;
+  if (argc < 1 || argc > 2) {
+    sqlite3_result_error(context, "url_host_ip() requires 1 or 2 arguments",
+                         -1);
+    return;
+  }
+  if (argc > 1) {
+    const char *zFormat = (const char *)sqlite3_value_text(argv[1]);
+    isInteger = zFormat && sqlite3_stricmp(zFormat, "integer") == 0;
+    if (!isInteger && (!zFormat || sqlite3_stricmp(zFormat, "blob"))) {
+      sqlite3_result_error(context,
+                           "url_host_ip() format must be 'blob' or 'integer'",
+                           -1);
+      return;
+    }
+  }
+  if (!urlHostIpArg(context, argv, aAddr))
+    return;
+  if (!isInteger)
+    sqlite3_result_blob(context, aAddr, 16, SQLITE_TRANSIENT);
+  else if (memcmp(aAddr, aMapped, 12) == 0)
+    sqlite3_result_int64(context, ((sqlite3_int64)aAddr[12] << 24) |
+                                      (aAddr[13] << 16) | (aAddr[14] << 8) |
+                                      aAddr[15]);
+}
+
+/** url_host_in_cidr(url, cidr_table)
+ * Returns 1 if the host of the given URL is an IP address inside one of the
+ * CIDR prefixes, like '10.0.0.0/8' or '2001:db8::/32', in the first column
+ * of the table named cidr_table, 0 otherwise. The table is compiled into a
+ * radix tree once per connection and compiled again after it may have
+ * changed. NULL for invalid URLs and hosts that aren't IP addresses.
+ */
+static void urlHostInCidrFunc(sqlite3_context *context, int argc,
+                              sqlite3_value **argv) {
+  url_cidrset *pSet = (url_cidrset *)urlTableArg(
+      context, argv, 1, "url_host_in_cidr", urlCidrsetCompile);
+  unsigned char aAddr[16];
+  if (pSet && urlHostIpArg(context, argv, aAddr))
+    sqlite3_result_int(context, urlCidrsetMatch(pSet, aAddr) != 0);
+}
+
+/** url_host_cidr(url, cidr_table)
+ * Returns the longest CIDR prefix in the first column of the table named
+ * cidr_table that contains the host of the given URL, as written in the
+ * table, so it can be joined back to the table with an equality. NULL if
+ * none does, for invalid URLs and hosts that aren't IP addresses. The table
+ * is compiled as in url_host_in_cidr().
+ */
+static void urlHostCidrFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  url_cidrset *pSet = (url_cidrset *)urlTableArg(
+      context, argv, 1, "url_host_cidr", urlCidrsetCompile);
+  unsigned char aAddr[16];
+  unsigned int iEntry;
+  if (pSet && urlHostIpArg(context, argv, aAddr) &&
+      (iEntry = urlCidrsetMatch(pSet, aAddr)) != 0)
+    sqlite3_result_text(context, pSet->zPool + iEntry - 1, -1,
+                        SQLITE_TRANSIENT);
+}
+
+// Results the host of the URL argv[0] converted by urlIdnaConvert(), or NULL
+// for invalid URLs and hosts.
+static void urlHostIdna(sqlite3_context *context, sqlite3_value **argv,
+                        int toAscii) {
+  url_lookup lookup;
+  const char *zHost;
+  int nHost;
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    return;
+  if (urlLookup(context, argv, 0, &lookup)) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  if (!lookup.pParts->valid) {
+    urlStatsFailure();
+  } else if (urlPartsGet(lookup.pParts, lookup.zUrl, URL_PART_HOST, &zHost,
+                         &nHost)) {
+    if (urlIdnaIsIdentity(zHost, nHost)) {
+      urlResultSlice(context, zHost, nHost);
+    } else {
+      sqlite3_str *s = sqlite3_str_new(sqlite3_context_db_handle(context));
+      int rc = urlIdnaConvert(zHost, nHost, toAscii, s);
+      if (rc == SQLITE_OK)
+        rc = sqlite3_str_errcode(s);
+      int nOut = sqlite3_str_length(s);
+      char *zOut = sqlite3_str_finish(s);
+      char zIPv4[16];
+      int nIPv4;
+      if (rc == SQLITE_OK && (nIPv4 = urlNormalizeIPv4(zOut, nOut, zIPv4))) {
+        // mapped to a numeric host, like fullwidth digits
+        sqlite3_free(zOut);
+        urlResultSlice(context, zIPv4, nIPv4);
+      } else if (rc == SQLITE_OK) {
+        urlStatsAlloc();
+        urlResultOwned(context, zOut, nOut);
+      } else {
+        sqlite3_free(zOut);
+        if (rc == SQLITE_ERROR)
+          urlStatsFailure();
+        else
+          sqlite3_result_error_code(context, rc);
+      }
+    }
+  }
+  urlLookupDone(context, 0, &lookup);
+}
+
+/** url_host_ascii(url)
+ * Returns the host of the given URL in its ASCII form, as used in DNS: it
+ * is mapped and normalized following UTS #46, like browsers do, and labels
+ * with other than ASCII characters are converted to punycode "xn--" labels.
+ * NULL for invalid URLs and hosts that aren't valid domain names.
+ */
+static void urlHostAsciiFunc(sqlite3_context *context, int argc,
+                             sqlite3_value **argv) {
+  urlHostIdna(context, argv, 1);
+}
+
+/** url_host_unicode(url)
+ * Returns the host of the given URL in its Unicode form, for display: it is
+ * mapped and normalized as in url_host_ascii(), and punycode "xn--" labels
+ * are decoded. NULL for invalid URLs and hosts that aren't valid domain
+ * names.
+ */
+static void urlHostUnicodeFunc(sqlite3_context *context, int argc,
+                               sqlite3_value **argv) {
+  urlHostIdna(context, argv, 0);
+}
+
+/** url_escape(url)
+ * Escape the given text.
+ */
+static void urlEscapeFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  const char *z = (const char *)sqlite3_value_text(argv[0]);
+  sqlite3_int64 nOut;
+  if (!z)
+    return;
+  char *zOut = urlEscape(z, sqlite3_value_bytes(argv[0]), &nOut);
+  if (!zOut) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  urlStatsAlloc();
+  urlResultOwned(context, zOut, nOut);
+}
+
+/** url_unescape(contents)
+ * Unescape the given text.
+ */
+static void urlUnescapeFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  const char *z = (const char *)sqlite3_value_text(argv[0]);
+  sqlite3_int64 nOut;
+  if (!z)
+    return;
+  char *zOut = urlUnescape(z, sqlite3_value_bytes(argv[0]), &nOut);
+  if (!zOut) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  urlStatsAlloc();
+  urlResultOwned(context, zOut, nOut);
+}
+
+// Returns 1 if z[0..n) starts with "scheme:", as opposed to a bare path or
+// query string.
+static int urlHasScheme(const char *z, int n) {
+  int i = 0;
+  if (n > 0 && urlIsAlpha(z[0])) {
+    while (i < n && (urlIsAlpha(z[i]) || urlIsDigit(z[i]) || z[i] == '+' ||
+                     z[i] == '-' || z[i] == '.'))
+      i++;
+  }
+  return i > 0 && i < n && z[i] == ':';
+}
+
+// Finds the query string in z[0..n), which is either a full URL or a bare
+// query string, and stores its bounds in *piStart and *piEnd. Returns 0 if
+// z is a URL without a query.
+static int urlFindQuery(const char *z, int n, int *piStart, int *piEnd) {
+  // a '?' in the fragment doesn't start a query
+  int iEnd = urlFind(z, 0, n, '#');
+  int iStart = urlFind(z, 0, iEnd, '?');
+  if (iStart < iEnd) {
+    iStart++;
+  } else {
+    // "scheme:" means a URL without a query, anything else is a query
+    if (urlHasScheme(z, n))
+      return 0;
+    iStart = 0;
+  }
+  *piStart = iStart;
+  *piEnd = iEnd;
+  return 1;
+}
+
+/** url_query_get(url_or_query, name [, occurrence])
+ * Returns the decoded value of the "name" parameter in the query string of
+ * the given URL, or in the given bare query string. "occurrence" picks
+ * which one of repeated parameters to return, starting at 1 for the first
+ * (the default), with -1 for the last one. Returns NULL if there is no such
+ * parameter.
+ */
+static void urlQueryGetFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  int occurrence = 1, iQuery, iQueryEnd;
+  if (argc < 2 || argc > 3) {
+    sqlite3_result_error(context, "url_query_get() requires 2 or 3 arguments",
+                         -1);
+    return;
+  }
+  if (argc == 3) {
+    if (sqlite3_value_type(argv[2]) != SQLITE_INTEGER ||
+        sqlite3_value_int(argv[2]) == 0) {
+      sqlite3_result_error(context, "occurrence must be a non-zero integer",
+                           -1);
+      return;
+    }
+    occurrence = sqlite3_value_int(argv[2]);
+  }
+  const char *z = (const char *)sqlite3_value_text(argv[0]);
+  int n = sqlite3_value_bytes(argv[0]);
+  const char *zName = (const char *)sqlite3_value_text(argv[1]);
+  int nName = sqlite3_value_bytes(argv[1]);
+  if (!z || !zName || !urlFindQuery(z, n, &iQuery, &iQueryEnd))
+    return;
+
+  // counting from the end takes a first pass to count the matches
+  int iTarget = occurrence;
+  for (int pass = occurrence < 0 ? 0 : 1; pass < 2; pass++) {
+    int nMatch = 0;
+    for (int i = iQuery; i < iQueryEnd; i++) {
+      int iEnd = urlFind(z, i, iQueryEnd, '&');
+      int iNameEnd = urlFind(z, i, iEnd, '=');
+      // empty sequences are skipped, and decoding never makes a name longer
+      if (iEnd > i && iNameEnd - i >= nName &&
+          urlFormEquals(z + i, iNameEnd - i, zName, nName) &&
+          ++nMatch == iTarget && pass == 1) {
+        int iValue = iNameEnd < iEnd ? iNameEnd + 1 : iEnd;
+        char *zOut = sqlite3_malloc(iEnd - iValue + 1);
+        if (!zOut) {
+          sqlite3_result_error_nomem(context);
+          return;
+        }
+        urlStatsAlloc();
+        urlResultOwned(context, zOut,
+                       urlFormDecode(z + iValue, iEnd - iValue, zOut));
+        return;
+      }
+      i = iEnd;
+    }
+    if (pass == 0)
+      iTarget = nMatch + occurrence + 1;
+  }
+}
+
+// url_query_set(), url_query_remove() and url_query_keep() share
+// urlQueryRewrite(), and only differ in what they do with each pair.
+#define URL_QUERY_SET 0
+#define URL_QUERY_REMOVE 1
+#define URL_QUERY_KEEP 2
+
+typedef struct url_query_name url_query_name;
+struct url_query_name {
+  // NULL for a NULL argument, which matches no parameter
+  const char *z;
+  int n;
+  // the value of url_query_set(), NULL to remove the parameter
+  const char *zValue;
+  int nValue;
+  // set once the parameter is written, or when a later argument overrides
+  // it
+  int isDone;
+};
+
+// Returns the last of the nName names that the parameter name z[0..n)
+// decodes to, or NULL if there is none.
+static url_query_name *urlQueryNameFind(url_query_name *aName, int nName,
+                                        const char *z, int n) {
+  url_query_name *pFound = 0;
+  for (int k = 0; k < nName; k++) {
+    // decoding never makes a name longer
+    if (aName[k].z && n >= aName[k].n &&
+        urlFormEquals(z, n, aName[k].z, aName[k].n))
+      pFound = &aName[k];
+  }
+  return pFound;
+}
+
+// Output of urlQueryRewrite(), which only starts copying at the first
+// change.
+typedef struct url_query_out url_query_out;
+struct url_query_out {
+  const char *z;
+  // until the first change zOut is NULL and the output is z[0..iKeep)
+  int iKeep;
+  char *zOut;
+  char *p;
+  // pairs written so far, the first one follows a '?' unless isBare
+  int nPair;
+  int isBare;
+};
+
+// Starts the copy of a rewritten query into nAlloc bytes. Returns
+// SQLITE_OK or SQLITE_NOMEM.
+static int urlQueryOutStart(url_query_out *pOut, sqlite3_int64 nAlloc) {
+  pOut->zOut = sqlite3_malloc64(nAlloc);
+  if (!pOut->zOut)
+    return SQLITE_NOMEM;
+  urlStatsAlloc();
+  memcpy(pOut->zOut, pOut->z, pOut->iKeep);
+  pOut->p = pOut->zOut + pOut->iKeep;
+  return SQLITE_OK;
+}
+
+// Writes the separator before a new pair.
+static void urlQueryOutPair(url_query_out *pOut) {
+  if (pOut->nPair++ > 0)
+    *pOut->p++ = '&';
+  else if (!pOut->isBare)
+    *pOut->p++ = '?';
+}
+
+// Rewrites the query of the URL or bare query string argv[0] for op, one of
+// URL_QUERY_*, in a single pass. Pairs that stay are copied as they are,
+// escapes and all, and a query that doesn't change costs no copy.
+static void urlQueryRewrite(sqlite3_context *context, int argc,
+                            sqlite3_value **argv, int op) {
+  url_query_name aStatic[8], *aName = aStatic;
+  int nArg = op == URL_QUERY_SET ? 2 : 1;
+  int nName = (argc - 1) / nArg;
+  url_query_out out;
+  const char *z = (const char *)sqlite3_value_text(argv[0]);
+  int n = sqlite3_value_bytes(argv[0]);
+  if (!z)
+    return;
+  if (nName > (int)(sizeof(aStatic) / sizeof(aStatic[0]))) {
+    aName = sqlite3_malloc64(sizeof(*aName) * (sqlite3_int64)nName);
+    if (!aName) {
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+    urlStatsAlloc();
+  }
+  // room for the URL, a '?' and every new pair
+  sqlite3_int64 nAlloc = (sqlite3_int64)n + 2;
+  for (int k = 0; k < nName; k++) {
+    url_query_name *pName = &aName[k];
+    pName->z = (const char *)sqlite3_value_text(argv[1 + k * nArg]);
+    pName->n = sqlite3_value_bytes(argv[1 + k * nArg]);
+    pName->zValue = 0;
+    pName->isDone = 0;
+    if (op != URL_QUERY_SET || !pName->z)
+      continue;
+    pName->zValue = (const char *)sqlite3_value_text(argv[2 + k * nArg]);
+    pName->nValue = sqlite3_value_bytes(argv[2 + k * nArg]);
+    if (pName->zValue)
+      nAlloc += 2 + urlEscapedLength(pName->z, pName->n) +
+                urlEscapedLength(pName->zValue, pName->nValue);
+    // the last value of a repeated name wins
+    for (int j = 0; j < k; j++) {
+      if (aName[j].z && aName[j].n == pName->n &&
+          memcmp(aName[j].z, pName->z, pName->n) == 0)
+        aName[j].isDone = 1;
+    }
+  }
+
+  // the query is z[iQuery..iQueryEnd), after the '?' of a URL. A URL
+  // without one gets its query right before the fragment
+  int iQuery, iQueryEnd;
+  memset(&out, 0, sizeof(out));
+  out.z = z;
+  int hasQuery = urlFindQuery(z, n, &iQuery, &iQueryEnd);
+  out.isBare = hasQuery && iQuery == 0;
+  if (out.isBare)
+    out.iKeep = 0;
+  else if (hasQuery)
+    out.iKeep = iQuery - 1;
+  else
+    out.iKeep = iQuery = iQueryEnd = urlFind(z, 0, n, '#');
+
+  for (int i = iQuery; i < iQueryEnd; i++) {
+    int iEnd = urlFind(z, i, iQueryEnd, '&');
+    int iNameEnd = urlFind(z, i, iEnd, '=');
+    url_query_name *pName =
+        iEnd > i ? urlQueryNameFind(aName, nName, z + i, iNameEnd - i) : 0;
+    int isCopy = op == URL_QUERY_KEEP ? pName != 0 : pName == 0;
+    if (isCopy && !out.zOut) {
+      out.iKeep = iEnd;
+      out.nPair++;
+    } else if (!out.zOut && urlQueryOutStart(&out, nAlloc)) {
+      goto nomem;
+    } else if (isCopy) {
+      urlQueryOutPair(&out);
+      memcpy(out.p, z + i, iEnd - i);
+      out.p += iEnd - i;
+    } else if (op == URL_QUERY_SET && pName->zValue && !pName->isDone) {
+      // the first occurrence keeps its name as written, later ones go
+      urlQueryOutPair(&out);
+      memcpy(out.p, z + i, iNameEnd - i);
+      out.p += iNameEnd - i;
+      *out.p++ = '=';
+      out.p = urlEscapeInto(pName->zValue, pName->nValue, out.p);
+      pName->isDone = 1;
+    }
+    i = iEnd;
+  }
+  // url_query_set() appends the names that weren't in the query
+  for (int k = 0; k < nName; k++) {
+    url_query_name *pName = &aName[k];
+    if (!pName->zValue || pName->isDone)
+      continue;
+    if (!out.zOut && urlQueryOutStart(&out, nAlloc))
+      goto nomem;
+    urlQueryOutPair(&out);
+    out.p = urlEscapeInto(pName->z, pName->n, out.p);
+    *out.p++ = '=';
+    out.p = urlEscapeInto(pName->zValue, pName->nValue, out.p);
+  }
+
+  if (!out.zOut) {
+    urlResultSlice(context, z, n);
+  } else {
+    memcpy(out.p, z + iQueryEnd, n - iQueryEnd);
+    out.p += n - iQueryEnd;
+    *out.p = 0;
+    urlResultOwned(context, out.zOut, out.p - out.zOut);
+  }
+  if (aName != aStatic)
+    sqlite3_free(aName);
+  return;
+nomem:
+  sqlite3_result_error_nomem(context);
+  if (aName != aStatic)
+    sqlite3_free(aName);
+}
+
+/** url_query_set(url_or_query, name1, value1, [...])
+ * Returns the given URL, or bare query string, with the "name" parameter
+ * set to "value" for each pair of arguments: its first occurrence gets the
+ * new value and repeats are removed, or it is appended when missing. A NULL
+ * value removes the parameter. Every other pair is kept as written.
+ */
+static void urlQuerySetFunc(sqlite3_context *context, int argc,
+                            sqlite3_value **argv) {
+  if (argc < 3 || argc % 2 == 0) {
+    sqlite3_result_error(context,
+                         "url_query_set() requires an odd number of "
+                         "arguments, at least 3",
+                         -1);
+    return;
+  }
+  urlQueryRewrite(context, argc, argv, URL_QUERY_SET);
+}
+
+/** url_query_remove(url_or_query, name1, [...])
+ * Returns the given URL, or bare query string, without the parameters of
+ * the given names. Every other pair is kept as written.
+ */
+static void urlQueryRemoveFunc(sqlite3_context *context, int argc,
+                               sqlite3_value **argv) {
+  if (argc < 2) {
+    sqlite3_result_error(context, "url_query_remove() requires at least 2 "
+                                  "arguments",
+                         -1);
+    return;
+  }
+  urlQueryRewrite(context, argc, argv, URL_QUERY_REMOVE);
+}
+
+/** url_query_keep(url_or_query, name1, [...])
+ * Returns the given URL, or bare query string, with only the parameters of
+ * the given names, kept as written and in their order.
+ */
+static void urlQueryKeepFunc(sqlite3_context *context, int argc,
+                             sqlite3_value **argv) {
+  if (argc < 2) {
+    sqlite3_result_error(context, "url_query_keep() requires at least 2 "
+                                  "arguments",
+                         -1);
+    return;
+  }
+  urlQueryRewrite(context, argc, argv, URL_QUERY_KEEP);
+}
+
+/** url_querystring(name1, value1, [...])
+ * Generate a query string with the given names and values.
+ * Individual segments are automatically escaped.
+ * https://url.spec.whatwg.org/#urlencoded-serializing
+ */
+static void urlQuerystringFunc(sqlite3_context *context, int argc,
+                               sqlite3_value **argv) {
+  if (argc < 2 || argc % 2) {
+    sqlite3_result_error(context,
+                         "url_querystring() requires an even number of "
+                         "arguments, at least 2",
+                         -1);
+    return;
+  }
+  // escaped names and values are written straight into the result, sized
+  // up front. NULL names and values are treated as empty strings.
+  sqlite3_int64 nOut = argc - 1;
+  for (int i = 0; i < argc; i++) {
+    const char *z = (const char *)sqlite3_value_text(argv[i]);
+    nOut += urlEscapedLength(z, sqlite3_value_bytes(argv[i]));
+  }
+  char *zOut = sqlite3_malloc64(nOut + 1);
+  if (!zOut) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  urlStatsAlloc();
+  char *p = zOut;
+  for (int i = 0; i < argc; i++) {
+    if (i > 0)
+      *p++ = i % 2 ? '=' : '&';
+    p = urlEscapeInto((const char *)sqlite3_value_text(argv[i]),
+                      sqlite3_value_bytes(argv[i]), p);
+  }
+  *p = 0;
+  urlResultOwned(context, zOut, nOut);
+}
+
+// Aggregate context of url_querystring_agg().
+typedef struct url_querystring_agg url_querystring_agg;
+struct url_querystring_agg {
+  // escaped pairs joined by '&', from sqlite3_malloc()
+  char *z;
+  sqlite3_int64 nAlloc;
+  // the pairs still in the window are z[iStart..n)
+  sqlite3_int64 iStart;
+  sqlite3_int64 n;
+  sqlite3_int64 nPair;
+};
+
+/** url_querystring_agg(name, value)
+ * Aggregate and window function that generates a query string with the
+ * names and values of every row, in order. Pairs are escaped like in
+ * url_querystring(). Rows with a NULL name are skipped, NULL values are
+ * treated as empty strings. Returns NULL when there are no pairs.
+ */
+static void urlQuerystringAggStep(sqlite3_context *context, int argc,
+                                  sqlite3_value **argv) {
+  const char *zName = (const char *)sqlite3_value_text(argv[0]);
+  if (!zName)
+    return;
+  url_querystring_agg *p = sqlite3_aggregate_context(context, sizeof(*p));
+  if (!p) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  int nName = sqlite3_value_bytes(argv[0]);
+  const char *zValue = (const char *)sqlite3_value_text(argv[1]);
+  int nValue = sqlite3_value_bytes(argv[1]);
+  // '&' + name + '=' + value, and a NUL terminator for xFinal()
+  sqlite3_int64 nNeed = 3 + urlEscapedLength(zName, nName) +
+                        urlEscapedLength(zValue, nValue);
+  // window functions drop pairs from the front, reclaim that space
+  // before growing
+  if (p->iStart > 0 && p->iStart >= p->n / 2) {
+    memmove(p->z, p->z + p->iStart, p->n - p->iStart);
+    p->n -= p->iStart;
+    p->iStart = 0;
+  }
+  if (p->n + nNeed > p->nAlloc) {
+    sqlite3_int64 nAlloc = p->nAlloc * 2 + nNeed;
+    char *z = sqlite3_realloc64(p->z, nAlloc);
+    if (!z) {
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+    urlStatsAlloc();
+    p->z = z;
+    p->nAlloc = nAlloc;
+  }
+  char *zOut = p->z + p->n;
+  if (p->nPair > 0)
+    *zOut++ = '&';
+  zOut = urlEscapeInto(zName, nName, zOut);
+  *zOut++ = '=';
+  zOut = urlEscapeInto(zValue, nValue, zOut);
+  p->n = zOut - p->z;
+  p->nPair++;
+}
+
+// Removes the oldest pair, whose row is the one in argv.
+static void urlQuerystringAggInverse(sqlite3_context *context, int argc,
+                                     sqlite3_value **argv) {
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    return;
+  url_querystring_agg *p = sqlite3_aggregate_context(context, 0);
+  if (!p || p->nPair == 0)
+    return;
+  // escaped names and values never contain '&'
+  const char *zAmp = memchr(p->z + p->iStart, '&', p->n - p->iStart);
+  p->nPair--;
+  if (!zAmp || p->nPair == 0)
+    p->iStart = p->n = 0;
+  else
+    p->iStart = zAmp + 1 - p->z;
+}
+
+static void urlQuerystringAggValue(sqlite3_context *context) {
+  url_querystring_agg *p = sqlite3_aggregate_context(context, 0);
+  if (!p || p->nPair == 0)
+    return;
+  urlResultSlice(context, p->z + p->iStart, p->n - p->iStart);
+}
+
+static void urlQuerystringAggFinal(sqlite3_context *context) {
+  url_querystring_agg *p = sqlite3_aggregate_context(context, 0);
+  if (!p)
+    return;
+  if (p->nPair == 0) {
+    sqlite3_free(p->z);
+    return;
+  }
+  if (p->iStart > 0)
+    memmove(p->z, p->z + p->iStart, p->n - p->iStart);
+  p->z[p->n - p->iStart] = 0;
+  // the buffer is handed over, this is the last call on this context
+  urlResultOwned(context, p->z, p->n - p->iStart);
+  p->z = 0;
+}
+
+/** url_config(name [, value])
+ * Reads, or sets when "value" is given, a connection-level setting of
+ * sqlite-url. Returns the (new) value of the setting.
+ *  - "cache_size": max number of parsed URLs kept in the connection's LRU
+ *    cache, shared by every extraction function. 0 disables the cache.
+ *    Changing it clears the cache.
+ *  - "cache_entries": number of URLs currently cached (read-only)
+ *  - "cache_hits": number of cache lookups that found a parsed URL
+ *    (read-only)
+ *  - "cache_misses": number of cache lookups that had to parse (read-only)
+ *  - "parser": "native" (default) for the built-in parser, or "curl" for
+ *    libcurl's URL API. Changing it clears the cache.
+ */
+static void urlConfigFunc(sqlite3_context *context, int argc,
+                          sqlite3_value **argv) {
+  url_state *pState = sqlite3_user_data(context);
+  url_cache *pCache = &pState->cache;
+  if (argc < 1 || argc > 2) {
+    sqlite3_result_error(context, "url_config() requires 1 or 2 arguments",
+                         -1);
+    return;
+  }
+  const char *name = (const char *)sqlite3_value_text(argv[0]);
+  if (!name) {
+    sqlite3_result_error(context, "url_config() name must be text", -1);
+    return;
+  }
+  if (sqlite3_stricmp(name, "cache_size") == 0) {
+    if (argc > 1) {
+      sqlite3_int64 nMax = sqlite3_value_int64(argv[1]);
+      if (sqlite3_value_type(argv[1]) != SQLITE_INTEGER || nMax < 0 ||
+          nMax > 0x7fffffff) {
+        sqlite3_result_error(
+            context, "cache_size must be a non-negative integer", -1);
+        return;
+      }
+      if (urlCacheResize(pCache, (int)nMax) != SQLITE_OK) {
+        sqlite3_result_error_nomem(context);
+        return;
+      }
+    }
+    sqlite3_result_int(context, pCache->nMax);
+    return;
+  }
+  if (sqlite3_stricmp(name, "parser") == 0) {
+    if (argc > 1) {
+      const char *value = (const char *)sqlite3_value_text(argv[1]);
+      int parser;
+      if (value && sqlite3_stricmp(value, "native") == 0) {
+        parser = URL_PARSER_NATIVE;
+      } else if (value && sqlite3_stricmp(value, "curl") == 0) {
+        parser = URL_PARSER_CURL;
+      } else {
+        sqlite3_result_error(context, "parser must be 'native' or 'curl'",
+                             -1);
+        return;
+      }
+      if (parser != pState->parser &&
+          urlCacheResize(pCache, pCache->nMax) != SQLITE_OK) {
+        sqlite3_result_error_nomem(context);
+        return;
+      }
+      pState->parser = parser;
+    }
+    sqlite3_result_text(context,
+                        pState->parser == URL_PARSER_CURL ? "curl" : "native",
+                        -1, SQLITE_STATIC);
+    return;
+  }
+
+  sqlite3_int64 value;
+  if (sqlite3_stricmp(name, "cache_entries") == 0) {
+    value = pCache->nEntry;
+  } else if (sqlite3_stricmp(name, "cache_hits") == 0) {
+    value = pCache->nHit;
+  } else if (sqlite3_stricmp(name, "cache_misses") == 0) {
+    value = pCache->nMiss;
+  } else {
+    char *zErr = sqlite3_mprintf("unknown url_config setting '%s'", name);
+    if (zErr) {
+      sqlite3_result_error(context, zErr, -1);
+      sqlite3_free(zErr);
+    } else {
+      sqlite3_result_error_nomem(context);
+    }
+    return;
+  }
+  if (argc > 1) {
+    char *zErr = sqlite3_mprintf("url_config setting '%s' is read-only", name);
+    if (zErr) {
+      sqlite3_result_error(context, zErr, -1);
+      sqlite3_free(zErr);
+    } else {
+      sqlite3_result_error_nomem(context);
+    }
+    return;
+  }
+  sqlite3_result_int64(context, value);
+}
+
+#pragma endregion
+
+#pragma region url patterns
+
+// url_pattern_match() and url_pattern_each() compile patterns in a subset of
+// the URLPattern syntax into a list of tokens per URL component, which are
+// matched with memoized backtracking against the components of a single
+// parse of the URL.
+
+// components a pattern can constrain, in the order they are written
+#define URL_PATTERN_SCHEME 0
+#define URL_PATTERN_HOST 1
+#define URL_PATTERN_PORT 2
+#define URL_PATTERN_PATH 3
+#define URL_PATTERN_QUERY 4
+#define URL_PATTERN_FRAGMENT 5
+#define URL_PATTERN_COUNT 6
+
+static const char *const azUrlPatternComponent[URL_PATTERN_COUNT] = {
+    "scheme", "host", "port", "path", "query", "fragment"};
+
+// the URL_PART_* each component is matched against
+static const int aUrlPatternPart[URL_PATTERN_COUNT] = {
+    URL_PART_SCHEME, URL_PART_HOST,  URL_PART_PORT,
+    URL_PART_PATH,   URL_PART_QUERY, URL_PART_FRAGMENT};
+
+// literal text
+#define URL_PATTERN_TOKEN_LITERAL 0
+// ":name", one or more bytes up to the component's delimiter
+#define URL_PATTERN_TOKEN_SEGMENT 1
+// "*", any bytes
+#define URL_PATTERN_TOKEN_WILDCARD 2
+
+typedef struct url_pattern_token url_pattern_token;
+struct url_pattern_token {
+  int type;
+  // literal text, or the name of a group, in zText of the url_pattern
+  const char *z;
+  int n;
+  // booleans, if the group is followed by "?", and if the '/' before it is
+  // optional with it
+  int isOptional;
+  int hasPrefix;
+  // index of the group in the captures, and its URL_PATTERN_* component
+  int iGroup;
+  int iComponent;
+};
+
+typedef struct url_pattern_component url_pattern_component;
+struct url_pattern_component {
+  // boolean, if the pattern leaves the component out, so anything matches
+  int isAny;
+  // the component's tokens are aToken[iToken..iToken+nToken), and its
+  // groups are iGroup..iGroup+nGroup
+  int iToken;
+  int nToken;
+  int iGroup;
+  int nGroup;
+};
+
+typedef struct url_pattern url_pattern;
+struct url_pattern {
+  url_pattern_component aComponent[URL_PATTERN_COUNT];
+  url_pattern_token *aToken;
+  int nToken;
+  // number of groups, captured in token order
+  int nGroup;
+  // the pattern it was compiled from, and its unescaped literals and group
+  // names, all in the same allocation as this struct
+  const char *zPattern;
+  int nPattern;
+  char *zText;
+};
+
+// The text a group matched, z is NULL for optional groups that didn't.
+typedef struct url_pattern_capture url_pattern_capture;
+struct url_pattern_capture {
+  const char *z;
+  int n;
+};
+
+// The byte a segment group of the component stops at, 0 for none.
+static char urlPatternDelimiter(int iComponent) {
+  if (iComponent == URL_PATTERN_HOST)
+    return '.';
+  if (iComponent == URL_PATTERN_PATH)
+    return '/';
+  return 0;
+}
+
+static int urlIsNameStart(char c) { return urlIsAlpha(c) || c == '_'; }
+
+// Parses the pattern z[*pi..n) into tokens of the given component, up to
+// the first byte of zStop outside of an escape, group or IPv6 address.
+// Returns non-zero with *pzErr set for unsupported syntax.
+static int urlPatternParse(url_pattern *p, int iComponent, const char *z,
+                           int n, int *pi, const char *zStop, char **pzErr) {
+  url_pattern_component *pComp = &p->aComponent[iComponent];
+  int isNocase = iComponent == URL_PATTERN_SCHEME ||
+                 iComponent == URL_PATTERN_HOST;
+  int nWildcard = 0, i = *pi;
+  char *zText = p->zText;
+  url_pattern_token *pLast = 0;
+  pComp->isAny = 0;
+  pComp->iToken = p->nToken;
+  pComp->iGroup = p->nGroup;
+  while (i < n) {
+    char c = z[i];
+    if (c == '?' && pLast && pLast->type != URL_PATTERN_TOKEN_LITERAL &&
+        !pLast->isOptional) {
+      // a modifier, the '/' before an optional path group is optional too
+      url_pattern_token *pPrev = pLast - 1;
+      pLast->isOptional = 1;
+      if (iComponent == URL_PATTERN_PATH && pLast > p->aToken + pComp->iToken &&
+          pPrev->type == URL_PATTERN_TOKEN_LITERAL && pPrev->n > 0 &&
+          pPrev->z[pPrev->n - 1] == '/') {
+        pPrev->n--;
+        pLast->hasPrefix = 1;
+      }
+      i++;
+      continue;
+    }
+    if (strchr(zStop, c) ||
+        (iComponent == URL_PATTERN_HOST && c == ':' &&
+         !(i + 1 < n && urlIsNameStart(z[i + 1]))))
+      break;
+    if (c == '(' || c == ')' || c == '{' || c == '}') {
+      *pzErr = sqlite3_mprintf("unsupported '%c' in url pattern, escape it "
+                               "with '\\'",
+                               c);
+      return 1;
+    }
+    if (c == ':' && i + 1 < n && urlIsNameStart(z[i + 1])) {
+      pLast = &p->aToken[p->nToken++];
+      memset(pLast, 0, sizeof(*pLast));
+      pLast->type = URL_PATTERN_TOKEN_SEGMENT;
+      pLast->iGroup = p->nGroup++;
+      pLast->iComponent = iComponent;
+      pLast->z = zText;
+      for (i++; i < n && (urlIsNameStart(z[i]) || urlIsDigit(z[i])); i++)
+        *zText++ = z[i];
+      pLast->n = zText - pLast->z;
+      continue;
+    }
+    if (c == '*') {
+      // unnamed groups are named by their index in the component
+      pLast = &p->aToken[p->nToken++];
+      memset(pLast, 0, sizeof(*pLast));
+      pLast->type = URL_PATTERN_TOKEN_WILDCARD;
+      pLast->iGroup = p->nGroup++;
+      pLast->iComponent = iComponent;
+      pLast->z = zText;
+      sqlite3_snprintf(12, zText, "%d", nWildcard++);
+      pLast->n = strlen(zText);
+      zText += pLast->n;
+      i++;
+      continue;
+    }
+    if (!pLast || pLast->type != URL_PATTERN_TOKEN_LITERAL) {
+      pLast = &p->aToken[p->nToken++];
+      memset(pLast, 0, sizeof(*pLast));
+      pLast->type = URL_PATTERN_TOKEN_LITERAL;
+      pLast->z = zText;
+    }
+    if (c == '\\' && i + 1 < n) {
+      c = z[++i];
+    } else if (c == '[' && iComponent == URL_PATTERN_HOST) {
+      // IPv6 addresses are literals, colons and all
+      for (; i + 1 < n && z[i] != ']'; i++) {
+        *zText++ = urlToLower(z[i]);
+        pLast->n++;
+      }
+      c = z[i];
+    }
+    *zText++ = isNocase ? urlToLower(c) : c;
+    pLast->n++;
+    i++;
+  }
+  pComp->nToken = p->nToken - pComp->iToken;
+  pComp->nGroup = p->nGroup - pComp->iGroup;
+  p->zText = zText;
+  *pi = i;
+  return 0;
+}
+
+// Compiles the pattern z, which starts with "/" to only match the path,
+// query and fragment, or with "scheme://". Returns the pattern, in a single
+// allocation to release with sqlite3_free(), or NULL with *pzErr set to an
+// error message, or to NULL on OOM.
+static url_pattern *urlPatternCompile(const char *z, int n, char **pzErr) {
+  int nWildcard = 0, i = 0;
+  for (int j = 0; j < n; j++)
+    nWildcard += z[j] == '*';
+  // every token takes at least a byte of the pattern, and every byte at
+  // most one of zText, but for the names of wildcards
+  sqlite3_int64 nToken = n;
+  url_pattern *p = sqlite3_malloc64(sizeof(url_pattern) +
+                                    nToken * sizeof(url_pattern_token) +
+                                    2 * nToken + 2 + 12 * nWildcard);
+  *pzErr = 0;
+  if (!p)
+    return 0;
+  memset(p, 0, sizeof(*p));
+  p->aToken = (url_pattern_token *)&p[1];
+  char *zPattern = (char *)&p->aToken[n];
+  memcpy(zPattern, z, n);
+  zPattern[n] = 0;
+  p->zPattern = zPattern;
+  p->nPattern = n;
+  p->zText = zPattern + n + 1;
+  for (int c = 0; c < URL_PATTERN_COUNT; c++)
+    p->aComponent[c].isAny = 1;
+  if (n == 0 || z[0] != '/') {
+    int iScheme = 0;
+    while (iScheme < n && z[iScheme] != ':' && z[iScheme] != '/')
+      iScheme++;
+    if (iScheme + 2 >= n || z[iScheme] != ':' || z[iScheme + 1] != '/' ||
+        z[iScheme + 2] != '/') {
+      *pzErr = sqlite3_mprintf(
+          "url pattern must start with '/' or 'scheme://'");
+      goto failed;
+    }
+    if (urlPatternParse(p, URL_PATTERN_SCHEME, z, iScheme, &i, "", pzErr))
+      goto failed;
+    i = iScheme + 3;
+    if (urlPatternParse(p, URL_PATTERN_HOST, z, n, &i, "/?#", pzErr))
+      goto failed;
+    // without a port in the pattern, only URLs without one match
+    p->aComponent[URL_PATTERN_PORT].isAny = 0;
+    if (i < n && z[i] == ':') {
+      i++;
+      if (urlPatternParse(p, URL_PATTERN_PORT, z, n, &i, "/?#", pzErr))
+        goto failed;
+    }
+  }
+  if (i < n && z[i] == '/' &&
+      urlPatternParse(p, URL_PATTERN_PATH, z, n, &i, "?#", pzErr))
+    goto failed;
+  if (i < n && z[i] == '?') {
+    i++;
+    if (urlPatternParse(p, URL_PATTERN_QUERY, z, n, &i, "#", pzErr))
+      goto failed;
+  }
+  if (i < n && z[i] == '#') {
+    i++;
+    if (urlPatternParse(p, URL_PATTERN_FRAGMENT, z, n, &i, "", pzErr))
+      goto failed;
+  }
+  return p;
+
+failed:
+  sqlite3_free(p);
+  return 0;
+}
+
+// The state of matching the tokens of a component against its text z[0..n).
+typedef struct url_pattern_matcher url_pattern_matcher;
+struct url_pattern_matcher {
+  const url_pattern_token *aToken;
+  int nToken;
+  int iComponent;
+  const char *z;
+  int n;
+  url_pattern_capture *aCapture;
+  // with more than one group, whether the group iGroup + j failed to match
+  // the rest of the text from offset i is bit j * (n + 1) + i. Otherwise
+  // NULL, as a single group can't backtrack into another one
+  unsigned char *aFailed;
+  int iGroup;
+};
+
+// Returns 1 if the tokens from iToken match all of the text from offset i,
+// and sets the captures of their groups when aCapture is not NULL. Groups
+// take as much as they can, like regular expressions do. Whether a group
+// matches the rest of the text doesn't depend on how the text before it
+// was matched, so its failures are remembered, which keeps patterns with
+// many groups from backtracking exponentially.
+static int urlPatternMatchFrom(url_pattern_matcher *m, int iToken, int i) {
+  const url_pattern_token *a = &m->aToken[iToken];
+  const char *z = m->z + i;
+  int n = m->n - i;
+  if (iToken == m->nToken)
+    return n == 0;
+  if (a->type == URL_PATTERN_TOKEN_LITERAL) {
+    if (a->n > n)
+      return 0;
+    if (m->iComponent == URL_PATTERN_SCHEME ||
+        m->iComponent == URL_PATTERN_HOST) {
+      for (int j = 0; j < a->n; j++) {
+        if ((unsigned char)a->z[j] != urlToLower(z[j]))
+          return 0;
+      }
+    } else if (memcmp(a->z, z, a->n)) {
+      return 0;
+    }
+    return urlPatternMatchFrom(m, iToken + 1, i + a->n);
+  }
+  sqlite3_int64 iBit = (sqlite3_int64)(a->iGroup - m->iGroup) * (m->n + 1) + i;
+  if (m->aFailed && (m->aFailed[iBit >> 3] & (1 << (iBit & 7))))
+    return 0;
+  if (!a->hasPrefix || (n > 0 && z[0] == '/')) {
+    int iStart = a->hasPrefix;
+    char delimiter = urlPatternDelimiter(m->iComponent);
+    int nMax = a->type == URL_PATTERN_TOKEN_SEGMENT && delimiter
+                   ? urlFind(z, iStart, n, delimiter) - iStart
+                   : n - iStart;
+    int nMin = a->type == URL_PATTERN_TOKEN_SEGMENT;
+    for (int k = nMax; k >= nMin; k--) {
+      if (m->aCapture) {
+        m->aCapture[a->iGroup].z = z + iStart;
+        m->aCapture[a->iGroup].n = k;
+      }
+      if (urlPatternMatchFrom(m, iToken + 1, i + iStart + k))
+        return 1;
+    }
+  }
+  if (a->isOptional) {
+    if (m->aCapture)
+      m->aCapture[a->iGroup].z = 0;
+    if (urlPatternMatchFrom(m, iToken + 1, i))
+      return 1;
+  }
+  if (m->aFailed)
+    m->aFailed[iBit >> 3] |= 1 << (iBit & 7);
+  return 0;
+}
+
+// Returns 1 if the tokens of the component c match all of z[0..n), 0 if
+// they don't, or -1 on OOM, and sets the captures of their groups when
+// aCapture is not NULL.
+static int urlPatternMatchTokens(const url_pattern *p, int c, const char *z,
+                                 int n, url_pattern_capture *aCapture) {
+  const url_pattern_component *pComp = &p->aComponent[c];
+  unsigned char aStatic[256];
+  url_pattern_matcher m;
+  m.aToken = p->aToken + pComp->iToken;
+  m.nToken = pComp->nToken;
+  m.iComponent = c;
+  m.z = z;
+  m.n = n;
+  m.aCapture = aCapture;
+  m.aFailed = 0;
+  m.iGroup = pComp->iGroup;
+  if (pComp->nGroup > 1) {
+    sqlite3_int64 nFailed = ((sqlite3_int64)pComp->nGroup * (n + 1) + 7) / 8;
+    m.aFailed = aStatic;
+    if (nFailed > (sqlite3_int64)sizeof(aStatic)) {
+      m.aFailed = sqlite3_malloc64(nFailed);
+      if (!m.aFailed)
+        return -1;
+      urlStatsAlloc();
+    }
+    memset(m.aFailed, 0, nFailed);
+  }
+  int isMatch = urlPatternMatchFrom(&m, 0, 0);
+  if (m.aFailed != aStatic)
+    sqlite3_free(m.aFailed);
+  return isMatch;
+}
+
+// Returns 1 if the pattern matches the URL zUrl parsed as pParts, or when
+// pParts is NULL the bare path zUrl with its query and fragment, and sets
+// aCapture as urlPatternMatchTokens() does. Returns -1 on OOM.
+static int urlPatternMatch(const url_pattern *p, const url_parts *pParts,
+                           const char *zUrl, int nUrl,
+                           url_pattern_capture *aCapture) {
+  const char *az[URL_PATTERN_COUNT];
+  int an[URL_PATTERN_COUNT];
+  if (pParts) {
+    for (int c = 0; c < URL_PATTERN_COUNT; c++) {
+      if (!urlPartsGet(pParts, zUrl, aUrlPatternPart[c], &az[c], &an[c])) {
+        az[c] = "";
+        an[c] = 0;
+      }
+    }
+    if (urlIsDefaultPort(pParts, zUrl))
+      an[URL_PATTERN_PORT] = 0;
+  } else {
+    int iFragment = urlFind(zUrl, 0, nUrl, '#');
+    int iQuery = urlFind(zUrl, 0, iFragment, '?');
+    memset(az, 0, sizeof(az));
+    memset(an, 0, sizeof(an));
+    az[URL_PATTERN_PATH] = zUrl;
+    an[URL_PATTERN_PATH] = iQuery;
+    az[URL_PATTERN_QUERY] = zUrl + iQuery + (iQuery < iFragment);
+    an[URL_PATTERN_QUERY] = iFragment - iQuery - (iQuery < iFragment);
+    az[URL_PATTERN_FRAGMENT] = zUrl + iFragment + (iFragment < nUrl);
+    an[URL_PATTERN_FRAGMENT] = nUrl - iFragment - (iFragment < nUrl);
+  }
+  for (int c = 0; c < URL_PATTERN_COUNT; c++) {
+    if (p->aComponent[c].isAny)
+      continue;
+    // bare paths have no scheme, host or port
+    if (!az[c])
+      return 0;
+    int isMatch = urlPatternMatchTokens(p, c, az[c], an[c], aCapture);
+    if (isMatch <= 0)
+      return isMatch;
+  }
+  return 1;
+}
+
+/** url_pattern_match(pattern, url)
+ * Returns 1 if the given URL, or bare path, matches the pattern, 0
+ * otherwise. The pattern is a URLPattern-style pattern, "/" and a path or
+ * "scheme://host[:port]/path", followed by an optional "?query" and
+ * "#fragment": ":name" matches one or more bytes up to the next '/' in the
+ * path or '.' in the host, "*" any bytes, "?" makes the group before it
+ * optional and '\' escapes. The pattern is compiled once per statement.
+ * NULL if either argument is NULL or the URL is invalid.
+ */
+static void urlPatternMatchFunc(sqlite3_context *context, int argc,
+                                sqlite3_value **argv) {
+  url_pattern *p = sqlite3_get_auxdata(context, 0);
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL ||
+      sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  if (!p) {
+    char *zErr;
+    p = urlPatternCompile((const char *)sqlite3_value_text(argv[0]),
+                          sqlite3_value_bytes(argv[0]), &zErr);
+    if (!p) {
+      if (zErr)
+        sqlite3_result_error(context, zErr, -1);
+      else
+        sqlite3_result_error_nomem(context);
+      sqlite3_free(zErr);
+      return;
+    }
+    sqlite3_set_auxdata(context, 0, p, sqlite3_free);
+    // the auxdata may already have been released for a non-constant pattern
+    p = sqlite3_get_auxdata(context, 0);
+    if (!p) {
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+  }
+  const char *zUrl = (const char *)sqlite3_value_text(argv[1]);
+  int nUrl = sqlite3_value_bytes(argv[1]);
+  if (!zUrl) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  int isMatch;
+  if (!urlHasScheme(zUrl, nUrl)) {
+    isMatch = urlPatternMatch(p, 0, zUrl, nUrl, 0);
+  } else {
+    url_lookup lookup;
+    if (urlLookup(context, argv, 1, &lookup)) {
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+    if (!lookup.pParts->valid) {
+      urlStatsFailure();
+      urlLookupDone(context, 1, &lookup);
+      sqlite3_result_null(context);
+      return;
+    }
+    isMatch = urlPatternMatch(p, lookup.pParts, lookup.zUrl, 0, 0);
+    urlLookupDone(context, 1, &lookup);
+  }
+  if (isMatch < 0)
+    sqlite3_result_error_nomem(context);
+  else
+    sqlite3_result_int(context, isMatch);
+}
+
+#pragma endregion
+
+#pragma region table functions
+
+#pragma region url_query_each
+
+/** select * from url_query_each(query)
+ * Table function that returns each sequence in the given
+ * query string. Every sequence in the query string returns
+ * its own row, and every name and value are pre-escaped.
+ * https://url.spec.whatwg.org/#urlencoded-parsing
+ */
+
+#define URL_QUERY_EACH_COLUMN_ROWID -1
+#define URL_QUERY_EACH_COLUMN_QUERY 0
+#define URL_QUERY_EACH_COLUMN_RAWSEQUENCE 1
+#define URL_QUERY_EACH_COLUMN_NAME 2
+#define URL_QUERY_EACH_COLUMN_VALUE 3
+
+// idxNum flags from urlQueryEachBestIndex(), for the constraints passed to
+// urlQueryEachFilter() in this order
+#define URL_QUERY_EACH_INDEX_QUERY 1
+#define URL_QUERY_EACH_INDEX_NAME_EQ 2
+#define URL_QUERY_EACH_INDEX_NAME_IN 4
+#define URL_QUERY_EACH_INDEX_NAME_LIKE 8
+
+// a name from a "name =" or "name IN (...)" constraint
+typedef struct url_query_each_name url_query_each_name;
+struct url_query_each_name {
+  const char *z;
+  int n;
+};
+
+typedef struct url_query_each_vtab url_query_each_vtab;
+struct url_query_each_vtab {
+  sqlite3_vtab base;
+  // connection state from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_query_each_cursor url_query_each_cursor;
+struct url_query_each_cursor {
+  // Base class - must be first
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  sqlite3_int64 iRowid;
+  // raw query string being iterated, owned by SQLite's xFilter argument
+  const char *querystring;
+  // length of querystring
+  int querystringLength;
+  // boolean, if all sequences in querystring have been read
+  int complete;
+  // offset in querystring where the next sequence is searched from
+  int i;
+  // current sequence is querystring[seqStart..seqEnd), its name ends at
+  // nameEnd and its value starts at valueStart (seqEnd when there's no '=')
+  int seqStart;
+  int seqEnd;
+  int nameEnd;
+  int valueStart;
+  // booleans, if the current name/value contain '%' or '+' to decode
+  int nameEncoded;
+  int valueEncoded;
+  // scratch space that encoded names and values are decoded into
+  char *zBuf;
+  int nBuf;
+  // names allowed by "name =" or "name IN (...)", or NULL when there's no
+  // such constraint. Names are stored in the same allocation.
+  url_query_each_name *aName;
+  int nName;
+  // prefix of a "name LIKE 'prefix%'" constraint, or NULL
+  char *zLikePrefix;
+  int nLikePrefix;
+};
+
+/*
+** The urlQueryEachReadConnect() method is invoked to create a new
+** urlQueryEach_vtab that describes the urlQueryEach virtual table.
+**
+** Think of this routine as the constructor for urlQueryEach_vtab objects.
+**
+** All this routine needs to do is:
+**
+**    (1) Allocate the urlQueryEach_vtab object and initialize all fields.
+**
+**    (2) Tell SQLite (via the sqlite3_declare_vtab() interface) what the
+**        result set of queries against urlQueryEach will look like.
+*/
+static int urlQueryEachConnect(sqlite3 *db, void *pAux, int argcUnused,
+                               const char *const *argvUnused,
+                               sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_query_each_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(query hidden, raw_sequence "
+                                "text hidden, name text, value text)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+/*
+** This method is the destructor for url_query_each_cursor objects.
+*/
+static int urlQueryEachDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+/*
+** Constructor for a new url_query_each_cursor object.
+*/
+static int urlQueryEachOpen(sqlite3_vtab *pUnused,
+                            sqlite3_vtab_cursor **ppCursor) {
+  url_query_each_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+/*
+** Destructor for a url_query_each_cursor.
+*/
+static int urlQueryEachClose(sqlite3_vtab_cursor *cur) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  sqlite3_free(pCur->zBuf);
+  sqlite3_free(pCur->aName);
+  sqlite3_free(pCur->zLikePrefix);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+// Decodes querystring[iStart..iEnd) into the cursor's scratch buffer when
+// isEncoded is set. *pz then points to the decoded text, or straight into
+// querystring otherwise.
+static int urlQueryEachDecode(url_query_each_cursor *pCur, int iStart,
+                              int iEnd, int isEncoded, const char **pz,
+                              int *pn) {
+  const char *z = pCur->querystring + iStart;
+  int n = iEnd - iStart;
+  if (!isEncoded) {
+    *pz = z;
+    *pn = n;
+    return SQLITE_OK;
+  }
+  if (n > pCur->nBuf) {
+    char *zNew = sqlite3_realloc(pCur->zBuf, n);
+    if (!zNew)
+      return SQLITE_NOMEM;
+    urlStatsAlloc();
+    pCur->zBuf = zNew;
+    pCur->nBuf = n;
+  }
+  *pz = pCur->zBuf;
+  *pn = urlFormDecode(z, n, pCur->zBuf);
+  return SQLITE_OK;
+}
+
+// Sets *pMatch to 1 if the current sequence passes the name constraints
+// given to urlQueryEachFilter().
+static int urlQueryEachMatch(url_query_each_cursor *pCur, int *pMatch) {
+  int nRaw = pCur->nameEnd - pCur->seqStart;
+  const char *zName;
+  int nName;
+  *pMatch = 0;
+  // decoding never makes a name longer, so the raw length is enough to rule
+  // out most sequences without decoding them
+  if (pCur->zLikePrefix && nRaw < pCur->nLikePrefix)
+    return SQLITE_OK;
+  if (pCur->aName) {
+    int i;
+    for (i = 0; i < pCur->nName; i++) {
+      int n = pCur->aName[i].n;
+      if (pCur->nameEncoded ? n <= nRaw : n == nRaw)
+        break;
+    }
+    if (i == pCur->nName)
+      return SQLITE_OK;
+  }
+
+  int rc = urlQueryEachDecode(pCur, pCur->seqStart, pCur->nameEnd,
+                              pCur->nameEncoded, &zName, &nName);
+  if (rc != SQLITE_OK)
+    return rc;
+  if (pCur->zLikePrefix &&
+      (nName < pCur->nLikePrefix ||
+       sqlite3_strnicmp(zName, pCur->zLikePrefix, pCur->nLikePrefix) != 0))
+    return SQLITE_OK;
+  if (pCur->aName) {
+    int i;
+    for (i = 0; i < pCur->nName; i++) {
+      if (pCur->aName[i].n == nName &&
+          memcmp(pCur->aName[i].z, zName, nName) == 0)
+        break;
+    }
+    if (i == pCur->nName)
+      return SQLITE_OK;
+  }
+  *pMatch = 1;
+  return SQLITE_OK;
+}
+
+// Moves the cursor to the next sequence that passes the name constraints.
+static int urlQueryEachStep(url_query_each_cursor *pCur) {
+  const char *z = pCur->querystring;
+  int n = pCur->querystringLength;
+  int i = pCur->i;
+  int isMatch = 0;
+  while (!isMatch) {
+    pCur->iRowid++;
+    while (i < n && z[i] == '&') {
+      i++;
+    }
+    if (i >= n) {
+      pCur->complete = 1;
+      return SQLITE_OK;
+    }
+
+    // find the boundaries of the current sequence in a single pass, and
+    // whether its name or value need decoding at all
+    pCur->seqStart = i;
+    pCur->nameEnd = -1;
+    pCur->nameEncoded = pCur->valueEncoded = 0;
+    for (; i < n && z[i] != '&'; i++) {
+      if (z[i] == '=' && pCur->nameEnd < 0) {
+        pCur->nameEnd = i;
+      } else if (z[i] == '%' || z[i] == '+') {
+        if (pCur->nameEnd < 0)
+          pCur->nameEncoded = 1;
+        else
+          pCur->valueEncoded = 1;
+      }
+    }
+    pCur->seqEnd = i;
+    if (pCur->nameEnd < 0) {
+      pCur->nameEnd = pCur->valueStart = i;
+    } else {
+      // "+1" to skip the '='
+      pCur->valueStart = pCur->nameEnd + 1;
+    }
+    pCur->i = i;
+
+    if (pCur->aName || pCur->zLikePrefix) {
+      int rc = urlQueryEachMatch(pCur, &isMatch);
+      if (rc != SQLITE_OK)
+        return rc;
+    } else {
+      isMatch = 1;
+    }
+  }
+  return SQLITE_OK;
+}
+
+/*
+** Advance a url_query_each_cursor to its next row of output.
+*/
+static int urlQueryEachNext(sqlite3_vtab_cursor *cur) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  int rc = urlQueryEachStep(pCur);
+  urlStatsTimerPause(&pCur->timer);
+  return rc;
+}
+/*
+** Return TRUE if the cursor has been moved off of the last
+** row of output.
+*/
+static int urlQueryEachEof(sqlite3_vtab_cursor *cur) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+  return pCur->complete;
+}
+
+// Results querystring[iStart..iEnd), decoded when isEncoded is set.
+static void urlQueryEachResult(sqlite3_context *ctx,
+                               url_query_each_cursor *pCur, int iStart,
+                               int iEnd, int isEncoded) {
+  const char *z;
+  int n;
+  if (urlQueryEachDecode(pCur, iStart, iEnd, isEncoded, &z, &n)) {
+    sqlite3_result_error_nomem(ctx);
+    return;
+  }
+  urlResultSlice(ctx, z, n);
+}
+
+/*
+** Return values of columns for the row at which the url_query_each_cursor
+** is currently pointing.
+*/
+static int urlQueryEachColumn(
+    sqlite3_vtab_cursor *cur, /* The cursor */
+    sqlite3_context *ctx,     /* First argument to sqlite3_result_...() */
+    int i                     /* Which column to return */
+) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  switch (i) {
+  case URL_QUERY_EACH_COLUMN_ROWID: {
+    sqlite3_result_int64(ctx, pCur->iRowid);
+    break;
+  }
+  case URL_QUERY_EACH_COLUMN_QUERY: {
+    urlResultSlice(ctx, pCur->querystring, pCur->querystringLength);
+    break;
+  }
+  case URL_QUERY_EACH_COLUMN_RAWSEQUENCE: {
+    urlQueryEachResult(ctx, pCur, pCur->seqStart, pCur->seqEnd, 0);
+    break;
+  }
+  case URL_QUERY_EACH_COLUMN_NAME: {
+    urlQueryEachResult(ctx, pCur, pCur->seqStart, pCur->nameEnd,
+                       pCur->nameEncoded);
+    break;
+  }
+  case URL_QUERY_EACH_COLUMN_VALUE: {
+    urlQueryEachResult(ctx, pCur, pCur->valueStart, pCur->seqEnd,
+                       pCur->valueEncoded);
+    break;
+  }
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+/*
+** Return the rowid for the current row. In this implementation, the
+** first row returned is assigned rowid value 1, and each subsequent
+** row a value 1 more than that of the previous.
+*/
+static int urlQueryEachRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+  *pRowid = pCur->iRowid;
+  return SQLITE_OK;
+}
+
+/*
+** SQLite will invoke this method one or more times while planning a query
+** that uses the urlQueryEach virtual table.  This routine needs to create
+** a query plan for each invocation and compute an estimated cost for that
+** plan.
+*/
+static int urlQueryEachBestIndex(sqlite3_vtab *pVTab,
+                                 sqlite3_index_info *pIdxInfo) {
+  int iQuery = -1, iName = -1, iLike = -1;
+  int hasUnusableQuery = 0;
+
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    switch (pCons->iColumn) {
+    case URL_QUERY_EACH_COLUMN_QUERY: {
+      if (pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+        break;
+      if (!pCons->usable)
+        hasUnusableQuery = 1;
+      else if (iQuery < 0)
+        iQuery = i;
+      break;
+    }
+    case URL_QUERY_EACH_COLUMN_NAME: {
+      if (!pCons->usable)
+        break;
+      // names are compared bytewise, so other collations are left to SQLite
+      if (pCons->op == SQLITE_INDEX_CONSTRAINT_EQ && iName < 0 &&
+          sqlite3_stricmp(sqlite3_vtab_collation(pIdxInfo, i), "BINARY") == 0)
+        iName = i;
+      else if (pCons->op == SQLITE_INDEX_CONSTRAINT_LIKE && iLike < 0)
+        iLike = i;
+      break;
+    }
+    }
+  }
+  if (iQuery < 0) {
+    if (hasUnusableQuery)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("query argument is required");
+    return SQLITE_ERROR;
+  }
+
+  // query strings usually hold a handful of sequences
+  int nArg = 0;
+  pIdxInfo->idxNum = URL_QUERY_EACH_INDEX_QUERY;
+  pIdxInfo->aConstraintUsage[iQuery].argvIndex = ++nArg;
+  pIdxInfo->aConstraintUsage[iQuery].omit = 1;
+  pIdxInfo->estimatedCost = 100.0;
+  pIdxInfo->estimatedRows = 10;
+  if (iName >= 0) {
+    pIdxInfo->aConstraintUsage[iName].argvIndex = ++nArg;
+    pIdxInfo->aConstraintUsage[iName].omit = 1;
+    // sqlite3_vtab_in() was added in SQLite 3.38.0
+    if (sqlite3_libversion_number() >= 3038000 &&
+        sqlite3_vtab_in(pIdxInfo, iName, 1)) {
+      pIdxInfo->idxNum |= URL_QUERY_EACH_INDEX_NAME_IN;
+      pIdxInfo->estimatedCost = 60.0;
+      pIdxInfo->estimatedRows = 3;
+    } else {
+      pIdxInfo->idxNum |= URL_QUERY_EACH_INDEX_NAME_EQ;
+      pIdxInfo->estimatedCost = 50.0;
+      pIdxInfo->estimatedRows = 1;
+    }
+  }
+  if (iLike >= 0) {
+    // only the literal prefix is checked here, SQLite still checks the
+    // whole pattern
+    pIdxInfo->aConstraintUsage[iLike].argvIndex = ++nArg;
+    pIdxInfo->idxNum |= URL_QUERY_EACH_INDEX_NAME_LIKE;
+    pIdxInfo->estimatedCost -= 20.0;
+    if (pIdxInfo->estimatedRows > 3)
+      pIdxInfo->estimatedRows = 3;
+  }
+  return SQLITE_OK;
+}
+
+// Copies the names of a "name =" or "name IN (...)" constraint into
+// pCur->aName. NULLs never match, so they are skipped.
+static int urlQueryEachSetNames(url_query_each_cursor *pCur,
+                                sqlite3_value *pArg, int isIn) {
+  sqlite3_int64 nAlloc = 0;
+  int nName = 0, rc = SQLITE_OK;
+  sqlite3_value *pVal;
+
+  // once to size the allocation, then again to copy the names
+  for (int pass = 0; pass < 2; pass++) {
+    char *zNext = pass ? (char *)&pCur->aName[nName] : 0;
+    nName = 0;
+    if (isIn)
+      rc = sqlite3_vtab_in_first(pArg, &pVal);
+    else
+      pVal = pArg;
+    while (rc == SQLITE_OK && pVal) {
+      const char *z = (const char *)sqlite3_value_text(pVal);
+      int n = sqlite3_value_bytes(pVal);
+      if (z) {
+        if (pass == 0) {
+          nAlloc += sizeof(url_query_each_name) + n;
+        } else {
+          memcpy(zNext, z, n);
+          pCur->aName[nName].z = zNext;
+          pCur->aName[nName].n = n;
+          zNext += n;
+        }
+        nName++;
+      }
+      if (isIn)
+        rc = sqlite3_vtab_in_next(pArg, &pVal);
+      else
+        pVal = 0;
+    }
+    if (rc == SQLITE_DONE)
+      rc = SQLITE_OK;
+    if (rc != SQLITE_OK)
+      return rc;
+    if (pass == 0) {
+      // always allocate something, aName is NULL when there's no constraint
+      pCur->aName = sqlite3_malloc64(nAlloc + 1);
+      if (!pCur->aName)
+        return SQLITE_NOMEM;
+      urlStatsAlloc();
+    }
+  }
+  pCur->nName = nName;
+  return SQLITE_OK;
+}
+
+// Copies the literal prefix of a LIKE pattern, up to its first wildcard.
+static int urlQueryEachSetLikePrefix(url_query_each_cursor *pCur,
+                                     sqlite3_value *pArg) {
+  const char *z = (const char *)sqlite3_value_text(pArg);
+  int n = 0;
+  if (z) {
+    while (z[n] && z[n] != '%' && z[n] != '_')
+      n++;
+  }
+  pCur->zLikePrefix = sqlite3_malloc(n + 1);
+  if (!pCur->zLikePrefix)
+    return SQLITE_NOMEM;
+  urlStatsAlloc();
+  memcpy(pCur->zLikePrefix, z, n);
+  pCur->nLikePrefix = n;
+  return SQLITE_OK;
+}
+
+// Starts iterating argv[0] with the constraints from idxNum, see
+// urlQueryEachFilter().
+static int urlQueryEachStart(url_query_each_cursor *pCur, int idxNum,
+                             sqlite3_value **argv) {
+  int iArg = 1, rc = SQLITE_OK;
+  pCur->querystring = (const char *)sqlite3_value_text(argv[0]);
+  pCur->querystringLength = sqlite3_value_bytes(argv[0]);
+  pCur->i = 0;
+  pCur->complete = 0;
+  pCur->iRowid = -1;
+  sqlite3_free(pCur->aName);
+  pCur->aName = 0;
+  sqlite3_free(pCur->zLikePrefix);
+  pCur->zLikePrefix = 0;
+  if (idxNum & URL_QUERY_EACH_INDEX_NAME_EQ)
+    rc = urlQueryEachSetNames(pCur, argv[iArg++], 0);
+  else if (idxNum & URL_QUERY_EACH_INDEX_NAME_IN)
+    rc = urlQueryEachSetNames(pCur, argv[iArg++], 1);
+  if (rc == SQLITE_OK && (idxNum & URL_QUERY_EACH_INDEX_NAME_LIKE)) {
+    if (sqlite3_value_type(argv[iArg]) == SQLITE_NULL)
+      pCur->complete = 1;
+    else
+      rc = urlQueryEachSetLikePrefix(pCur, argv[iArg]);
+    iArg++;
+  }
+  if (rc != SQLITE_OK)
+    return rc;
+  if (!pCur->querystring || (pCur->aName && pCur->nName == 0)) {
+    pCur->complete = 1;
+    return SQLITE_OK;
+  }
+  if (pCur->complete)
+    return SQLITE_OK;
+  return urlQueryEachStep(pCur);
+}
+
+/*
+** This method is called to "rewind" the url_query_each_cursor object back
+** to the first row of output.  This method is always called at least
+** once prior to any call to xColumn() or xRowid() or xEof().
+**
+** This routine should initialize the cursor and position it so that it
+** is pointing at the first row, or pointing off the end of the table
+** (so that xEof() will return true) if the table is empty.
+*/
+static int urlQueryEachFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                              const char *idxStr, int argc,
+                              sqlite3_value **argv) {
+  url_query_each_cursor *pCur = (url_query_each_cursor *)pVtabCursor;
+  urlStatsTimerStart(
+      &pCur->timer,
+      &((url_query_each_vtab *)pVtabCursor->pVtab)
+           ->pState->aStats[URL_STATS_QUERY_EACH],
+      1, argv);
+  int rc = urlQueryEachStart(pCur, idxNum, argv);
+  urlStatsTimerPause(&pCur->timer);
+  return rc;
+}
+
+static sqlite3_module urlQueryEachModule = {
+    0,                      /* iVersion */
+    0,                      /* xCreate */
+    urlQueryEachConnect,    /* xConnect */
+    urlQueryEachBestIndex,  /* xBestIndex */
+    urlQueryEachDisconnect, /* xDisconnect */
+    0,                      /* xDestroy */
+    urlQueryEachOpen,       /* xOpen - open a cursor */
+    urlQueryEachClose,      /* xClose - close a cursor */
+    urlQueryEachFilter,     /* xFilter - configure scan constraints */
+    urlQueryEachNext,       /* xNext - advance a cursor */
+    urlQueryEachEof,        /* xEof - check for end of scan */
+    urlQueryEachColumn,     /* xColumn - read data */
+    urlQueryEachRowid,      /* xRowid - read data */
+    0,                      /* xUpdate */
+    0,                      /* xBegin */
+    0,                      /* xSync */
+    0,                      /* xCommit */
+    0,                      /* xRollback */
+    0,                      /* xFindMethod */
+    0,                      /* xRename */
+    0,                      /* xSavepoint */
+    0,                      /* xRelease */
+    0,                      /* xRollbackTo */
+    0                       /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region url_parse
+
+/** select * from url_parse(url)
+ * Table function that returns a single row with every component of the
+ * given URL, parsing it only once. "valid" is 0 and every component is
+ * NULL for invalid URLs.
+ */
+
+#define URL_PARSE_COLUMN_VALID URL_PART_COUNT
+#define URL_PARSE_COLUMN_URL (URL_PART_COUNT + 1)
+
+typedef struct url_parse_vtab url_parse_vtab;
+struct url_parse_vtab {
+  sqlite3_vtab base;
+  // connection state with the parsed URL cache, from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_parse_cursor url_parse_cursor;
+struct url_parse_cursor {
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  sqlite3_int64 iRowid;
+  // the parsed URL of the only row, or NULL once it was read
+  url_parsed *pParsed;
+};
+
+static int urlParseConnect(sqlite3 *db, void *pAux, int argcUnused,
+                           const char *const *argvUnused,
+                           sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_parse_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(
+      db, "CREATE TABLE x(scheme text, user text, password text, options "
+          "text, host text, port text, path text, query text, fragment text, "
+          "zoneid text, valid int, url hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlParseDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlParseOpen(sqlite3_vtab *pUnused,
+                        sqlite3_vtab_cursor **ppCursor) {
+  url_parse_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlParseClose(sqlite3_vtab_cursor *cur) {
+  url_parse_cursor *pCur = (url_parse_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  urlParsedUnref(pCur->pParsed);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+static int urlParseNext(sqlite3_vtab_cursor *cur) {
+  url_parse_cursor *pCur = (url_parse_cursor *)cur;
+  urlParsedUnref(pCur->pParsed);
+  pCur->pParsed = 0;
+  pCur->iRowid++;
+  return SQLITE_OK;
+}
+
+static int urlParseEof(sqlite3_vtab_cursor *cur) {
+  url_parse_cursor *pCur = (url_parse_cursor *)cur;
+  return pCur->pParsed == 0;
+}
+
+static int urlParseColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                          int i) {
+  url_parse_cursor *pCur = (url_parse_cursor *)cur;
+  const url_parts *pParts = &pCur->pParsed->parts;
+  urlStatsTimerResume(&pCur->timer);
+  if (i == URL_PARSE_COLUMN_VALID) {
+    sqlite3_result_int(ctx, pParts->valid);
+  } else if (i == URL_PARSE_COLUMN_URL) {
+    urlResultSlice(ctx, pCur->pParsed->zUrl, pParts->nUrl);
+  } else if (pParts->valid && pParts->aOff[i] >= 0) {
+    urlResultSlice(ctx, urlPartsText(pParts, pCur->pParsed->zUrl, i),
+                   pParts->aLen[i]);
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlParseRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  url_parse_cursor *pCur = (url_parse_cursor *)cur;
+  *pRowid = pCur->iRowid;
+  return SQLITE_OK;
+}
+
+static int urlParseBestIndex(sqlite3_vtab *pVTab,
+                             sqlite3_index_info *pIdxInfo) {
+  int iUrl = -1, hasUnusableUrl = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    if (pCons->iColumn != URL_PARSE_COLUMN_URL ||
+        pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+      continue;
+    if (!pCons->usable)
+      hasUnusableUrl = 1;
+    else if (iUrl < 0)
+      iUrl = i;
+  }
+  if (iUrl < 0) {
+    if (hasUnusableUrl)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("url argument is required");
+    return SQLITE_ERROR;
+  }
+  pIdxInfo->aConstraintUsage[iUrl].argvIndex = 1;
+  pIdxInfo->aConstraintUsage[iUrl].omit = 1;
+  pIdxInfo->idxNum = 1;
+  pIdxInfo->estimatedCost = 1.0;
+  pIdxInfo->estimatedRows = 1;
+  pIdxInfo->idxFlags = SQLITE_INDEX_SCAN_UNIQUE;
+  return SQLITE_OK;
+}
+
+static int urlParseFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                          const char *idxStr, int argc,
+                          sqlite3_value **argv) {
+  url_parse_cursor *pCur = (url_parse_cursor *)pVtabCursor;
+  url_parse_vtab *pVtab = (url_parse_vtab *)pVtabCursor->pVtab;
+  urlParsedUnref(pCur->pParsed);
+  pCur->pParsed = 0;
+  pCur->iRowid = 0;
+  const char *zUrl = (const char *)sqlite3_value_text(argv[0]);
+  if (!zUrl)
+    return SQLITE_OK;
+  urlStatsTimerStart(&pCur->timer, &pVtab->pState->aStats[URL_STATS_PARSE], 1,
+                     argv);
+  pCur->pParsed =
+      urlParsedGet(pVtab->pState, zUrl, sqlite3_value_bytes(argv[0]));
+  if (pCur->pParsed && !pCur->pParsed->parts.valid)
+    urlStatsFailure();
+  urlStatsTimerPause(&pCur->timer);
+  if (!pCur->pParsed)
+    return SQLITE_NOMEM;
+  return SQLITE_OK;
+}
+
+static sqlite3_module urlParseModule = {
+    0,                  /* iVersion */
+    0,                  /* xCreate */
+    urlParseConnect,    /* xConnect */
+    urlParseBestIndex,  /* xBestIndex */
+    urlParseDisconnect, /* xDisconnect */
+    0,                  /* xDestroy */
+    urlParseOpen,       /* xOpen - open a cursor */
+    urlParseClose,      /* xClose - close a cursor */
+    urlParseFilter,     /* xFilter - configure scan constraints */
+    urlParseNext,       /* xNext - advance a cursor */
+    urlParseEof,        /* xEof - check for end of scan */
+    urlParseColumn,     /* xColumn - read data */
+    urlParseRowid,      /* xRowid - read data */
+    0,                  /* xUpdate */
+    0,                  /* xBegin */
+    0,                  /* xSync */
+    0,                  /* xCommit */
+    0,                  /* xRollback */
+    0,                  /* xFindMethod */
+    0,                  /* xRename */
+    0,                  /* xSavepoint */
+    0,                  /* xRelease */
+    0,                  /* xRollbackTo */
+    0                   /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region url_path_each
+
+/** select * from url_path_each(url_or_path)
+ * Table function that returns each segment of the path of the given URL,
+ * or of the given bare path when it has no "scheme:". "depth" starts at 1,
+ * "prefix" is the path up to and including the segment, and
+ * "decoded_segment" is the segment with its "%XX" escapes decoded. Empty
+ * segments, like the ones around doubled or trailing slashes, are skipped.
+ * Constraints like "depth <= N" stop the scan early.
+ */
+
+#define URL_PATH_EACH_COLUMN_DEPTH 0
+#define URL_PATH_EACH_COLUMN_SEGMENT 1
+#define URL_PATH_EACH_COLUMN_DECODED_SEGMENT 2
+#define URL_PATH_EACH_COLUMN_PREFIX 3
+#define URL_PATH_EACH_COLUMN_URL 4
+
+// idxNum flags from urlPathEachBestIndex(), for the constraints passed to
+// urlPathEachFilter() in this order
+#define URL_PATH_EACH_INDEX_URL 1
+#define URL_PATH_EACH_INDEX_DEPTH_EQ 2
+#define URL_PATH_EACH_INDEX_DEPTH_LT 4
+#define URL_PATH_EACH_INDEX_DEPTH_LE 8
+#define URL_PATH_EACH_INDEX_DEPTH_GT 16
+#define URL_PATH_EACH_INDEX_DEPTH_GE 32
+
+typedef struct url_path_each_vtab url_path_each_vtab;
+struct url_path_each_vtab {
+  sqlite3_vtab base;
+  // connection state with the parsed URL cache, from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_path_each_cursor url_path_each_cursor;
+struct url_path_each_cursor {
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  // the url argument, owned by SQLite's xFilter argument
+  const char *zInput;
+  int nInput;
+  // parsed URL the path belongs to, or NULL for a bare path
+  url_parsed *pParsed;
+  // path being split, owned by pParsed or zInput
+  const char *zPath;
+  int nPath;
+  // current segment is zPath[iStart..iEnd) at depth, and rows with a depth
+  // outside of [minDepth, maxDepth] are skipped
+  int iStart;
+  int iEnd;
+  int depth;
+  int minDepth;
+  int maxDepth;
+  // boolean, if every segment has been read
+  int isEof;
+  // scratch space that decoded_segment is decoded into
+  char *zBuf;
+  int nBuf;
+};
+
+static int urlPathEachConnect(sqlite3 *db, void *pAux, int argcUnused,
+                              const char *const *argvUnused,
+                              sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_path_each_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(depth int, segment text, "
+                                "decoded_segment text, prefix text, "
+                                "url hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlPathEachDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlPathEachOpen(sqlite3_vtab *pUnused,
+                           sqlite3_vtab_cursor **ppCursor) {
+  url_path_each_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlPathEachClose(sqlite3_vtab_cursor *cur) {
+  url_path_each_cursor *pCur = (url_path_each_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  urlParsedUnref(pCur->pParsed);
+  sqlite3_free(pCur->zBuf);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+// Moves the cursor to the next non-empty segment within the depth bounds.
+static void urlPathEachStep(url_path_each_cursor *pCur) {
+  const char *z = pCur->zPath;
+  int n = pCur->nPath;
+  int i = pCur->iEnd;
+  do {
+    while (i < n && z[i] == '/')
+      i++;
+    if (i >= n || pCur->depth >= pCur->maxDepth) {
+      pCur->isEof = 1;
+      return;
+    }
+    pCur->iStart = i;
+    i = urlFind(z, i, n, '/');
+    pCur->iEnd = i;
+    pCur->depth++;
+  } while (pCur->depth < pCur->minDepth);
+}
+
+static int urlPathEachNext(sqlite3_vtab_cursor *cur) {
+  url_path_each_cursor *pCur = (url_path_each_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  urlPathEachStep(pCur);
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlPathEachEof(sqlite3_vtab_cursor *cur) {
+  return ((url_path_each_cursor *)cur)->isEof;
+}
+
+static int urlPathEachColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                             int i) {
+  url_path_each_cursor *pCur = (url_path_each_cursor *)cur;
+  const char *zSegment = pCur->zPath + pCur->iStart;
+  int nSegment = pCur->iEnd - pCur->iStart;
+  urlStatsTimerResume(&pCur->timer);
+  switch (i) {
+  case URL_PATH_EACH_COLUMN_DEPTH:
+    sqlite3_result_int(ctx, pCur->depth);
+    break;
+  case URL_PATH_EACH_COLUMN_SEGMENT:
+    urlResultSlice(ctx, zSegment, nSegment);
+    break;
+  case URL_PATH_EACH_COLUMN_DECODED_SEGMENT:
+    if (urlFindEscape(zSegment, 0, nSegment) == nSegment) {
+      urlResultSlice(ctx, zSegment, nSegment);
+      break;
+    }
+    if (nSegment > pCur->nBuf) {
+      char *zNew = sqlite3_realloc(pCur->zBuf, nSegment);
+      if (!zNew) {
+        sqlite3_result_error_nomem(ctx);
+        break;
+      }
+      urlStatsAlloc();
+      pCur->zBuf = zNew;
+      pCur->nBuf = nSegment;
+    }
+    urlResultSlice(ctx, pCur->zBuf,
+                   urlUnescapeInto(zSegment, nSegment, pCur->zBuf) -
+                       pCur->zBuf);
+    break;
+  case URL_PATH_EACH_COLUMN_PREFIX:
+    urlResultSlice(ctx, pCur->zPath, pCur->iEnd);
+    break;
+  case URL_PATH_EACH_COLUMN_URL:
+    urlResultSlice(ctx, pCur->zInput, pCur->nInput);
+    break;
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlPathEachRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  *pRowid = ((url_path_each_cursor *)cur)->depth;
+  return SQLITE_OK;
+}
+
+static int urlPathEachBestIndex(sqlite3_vtab *pVTab,
+                                sqlite3_index_info *pIdxInfo) {
+  // the url constraint, and the depth constraint of each idxNum flag
+  int aiCons[6] = {-1, -1, -1, -1, -1, -1};
+  int hasUnusableUrl = 0, nArg = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    int iFlag = -1;
+    if (pCons->iColumn == URL_PATH_EACH_COLUMN_URL &&
+        pCons->op == SQLITE_INDEX_CONSTRAINT_EQ) {
+      if (!pCons->usable)
+        hasUnusableUrl = 1;
+      else
+        iFlag = 0;
+    } else if (pCons->iColumn == URL_PATH_EACH_COLUMN_DEPTH &&
+               pCons->usable) {
+      switch (pCons->op) {
+      case SQLITE_INDEX_CONSTRAINT_EQ:
+        iFlag = 1;
+        break;
+      case SQLITE_INDEX_CONSTRAINT_LT:
+        iFlag = 2;
+        break;
+      case SQLITE_INDEX_CONSTRAINT_LE:
+        iFlag = 3;
+        break;
+      case SQLITE_INDEX_CONSTRAINT_GT:
+        iFlag = 4;
+        break;
+      case SQLITE_INDEX_CONSTRAINT_GE:
+        iFlag = 5;
+        break;
+      }
+    }
+    if (iFlag >= 0 && aiCons[iFlag] < 0)
+      aiCons[iFlag] = i;
+  }
+  if (aiCons[0] < 0) {
+    if (hasUnusableUrl)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("url argument is required");
+    return SQLITE_ERROR;
+  }
+  pIdxInfo->idxNum = 0;
+  for (int iFlag = 0; iFlag < 6; iFlag++) {
+    if (aiCons[iFlag] < 0)
+      continue;
+    pIdxInfo->idxNum |= 1 << iFlag;
+    pIdxInfo->aConstraintUsage[aiCons[iFlag]].argvIndex = ++nArg;
+    // depth bounds only cut the scan short, SQLite still checks them since
+    // non-numeric bounds are ignored
+    pIdxInfo->aConstraintUsage[aiCons[iFlag]].omit = iFlag == 0;
+  }
+  if (pIdxInfo->idxNum & URL_PATH_EACH_INDEX_DEPTH_EQ) {
+    pIdxInfo->estimatedCost = 5;
+    pIdxInfo->estimatedRows = 1;
+  } else if (pIdxInfo->idxNum &
+             (URL_PATH_EACH_INDEX_DEPTH_LT | URL_PATH_EACH_INDEX_DEPTH_LE)) {
+    pIdxInfo->estimatedCost = 7;
+    pIdxInfo->estimatedRows = 3;
+  } else {
+    pIdxInfo->estimatedCost = 10;
+    pIdxInfo->estimatedRows = 5;
+  }
+  return SQLITE_OK;
+}
+
+// Narrows the cursor's depth bounds with "depth op pValue", where op is a
+// URL_PATH_EACH_INDEX_DEPTH_* flag. Only numeric values are used, SQLite
+// re-checks the constraint anyway.
+static void urlPathEachSetBound(url_path_each_cursor *pCur, int op,
+                                sqlite3_value *pValue) {
+  int type = sqlite3_value_type(pValue);
+  if (type == SQLITE_NULL) {
+    // comparisons with NULL are never true
+    pCur->maxDepth = 0;
+    return;
+  }
+  if (type != SQLITE_INTEGER && type != SQLITE_FLOAT)
+    return;
+  double v = sqlite3_value_double(pValue);
+  // clamped so the bounds below fit in an int
+  if (v < -1)
+    v = -1;
+  else if (v > 1e9)
+    v = 1e9;
+  int floorV = (int)v > v ? (int)v - 1 : (int)v;
+  int ceilV = (int)v < v ? (int)v + 1 : (int)v;
+  int min = 0, max = pCur->maxDepth;
+  switch (op) {
+  case URL_PATH_EACH_INDEX_DEPTH_EQ:
+    min = ceilV;
+    max = floorV;
+    break;
+  case URL_PATH_EACH_INDEX_DEPTH_LT:
+    max = ceilV - 1;
+    break;
+  case URL_PATH_EACH_INDEX_DEPTH_LE:
+    max = floorV;
+    break;
+  case URL_PATH_EACH_INDEX_DEPTH_GT:
+    min = floorV + 1;
+    break;
+  case URL_PATH_EACH_INDEX_DEPTH_GE:
+    min = ceilV;
+    break;
+  }
+  if (min > pCur->minDepth)
+    pCur->minDepth = min;
+  if (max < pCur->maxDepth)
+    pCur->maxDepth = max;
+}
+
+// Starts splitting the path of argv[0] within the depth bounds from idxNum,
+// see urlPathEachFilter().
+static int urlPathEachStart(url_path_each_cursor *pCur, url_state *pState,
+                            int idxNum, sqlite3_value **argv) {
+  int iArg = 1;
+  urlParsedUnref(pCur->pParsed);
+  pCur->pParsed = 0;
+  pCur->iStart = pCur->iEnd = 0;
+  pCur->depth = 0;
+  pCur->minDepth = 1;
+  pCur->maxDepth = 0x7fffffff;
+  pCur->isEof = 1;
+  for (int flag = URL_PATH_EACH_INDEX_DEPTH_EQ;
+       flag <= URL_PATH_EACH_INDEX_DEPTH_GE; flag <<= 1) {
+    if (idxNum & flag)
+      urlPathEachSetBound(pCur, flag, argv[iArg++]);
+  }
+  pCur->zInput = (const char *)sqlite3_value_text(argv[0]);
+  pCur->nInput = sqlite3_value_bytes(argv[0]);
+  if (!pCur->zInput || pCur->minDepth > pCur->maxDepth)
+    return SQLITE_OK;
+  if (urlHasScheme(pCur->zInput, pCur->nInput)) {
+    pCur->pParsed = urlParsedGet(pState, pCur->zInput, pCur->nInput);
+    if (!pCur->pParsed)
+      return SQLITE_NOMEM;
+    const url_parts *pParts = &pCur->pParsed->parts;
+    if (!pParts->valid) {
+      urlStatsFailure();
+      return SQLITE_OK;
+    }
+    if (pParts->aOff[URL_PART_PATH] < 0)
+      return SQLITE_OK;
+    pCur->zPath = urlPartsText(pParts, pCur->pParsed->zUrl, URL_PART_PATH);
+    pCur->nPath = pParts->aLen[URL_PART_PATH];
+  } else {
+    // a bare path ends at its query or fragment
+    int n = urlFind(pCur->zInput, 0, pCur->nInput, '?');
+    pCur->zPath = pCur->zInput;
+    pCur->nPath = urlFind(pCur->zInput, 0, n, '#');
+  }
+  pCur->isEof = 0;
+  urlPathEachStep(pCur);
+  return SQLITE_OK;
+}
+
+static int urlPathEachFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                             const char *idxStr, int argc,
+                             sqlite3_value **argv) {
+  url_path_each_cursor *pCur = (url_path_each_cursor *)pVtabCursor;
+  url_state *pState = ((url_path_each_vtab *)pVtabCursor->pVtab)->pState;
+  urlStatsTimerStart(&pCur->timer, &pState->aStats[URL_STATS_PATH_EACH], 1,
+                     argv);
+  int rc = urlPathEachStart(pCur, pState, idxNum, argv);
+  urlStatsTimerPause(&pCur->timer);
+  return rc;
+}
+
+static sqlite3_module urlPathEachModule = {
+    0,                     /* iVersion */
+    0,                     /* xCreate */
+    urlPathEachConnect,    /* xConnect */
+    urlPathEachBestIndex,  /* xBestIndex */
+    urlPathEachDisconnect, /* xDisconnect */
+    0,                     /* xDestroy */
+    urlPathEachOpen,       /* xOpen - open a cursor */
+    urlPathEachClose,      /* xClose - close a cursor */
+    urlPathEachFilter,     /* xFilter - configure scan constraints */
+    urlPathEachNext,       /* xNext - advance a cursor */
+    urlPathEachEof,        /* xEof - check for end of scan */
+    urlPathEachColumn,     /* xColumn - read data */
+    urlPathEachRowid,      /* xRowid - read data */
+    0,                     /* xUpdate */
+    0,                     /* xBegin */
+    0,                     /* xSync */
+    0,                     /* xCommit */
+    0,                     /* xRollback */
+    0,                     /* xFindMethod */
+    0,                     /* xRename */
+    0,                     /* xSavepoint */
+    0,                     /* xRelease */
+    0,                     /* xRollbackTo */
+    0                      /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region url_host_labels
+
+/** select * from url_host_labels(host)
+ * Table function that returns each label of the given host from right to
+ * left, so "depth" 1 is the top level domain. "suffix" is the host from the
+ * label on, "is_public_suffix" is 1 for the labels of the host's public
+ * suffix and "is_domain" is 1 for the label that makes it the registrable
+ * domain, see url_public_suffix() and url_domain(). A trailing dot is
+ * ignored.
+ */
+
+#define URL_HOST_LABELS_COLUMN_DEPTH 0
+#define URL_HOST_LABELS_COLUMN_LABEL 1
+#define URL_HOST_LABELS_COLUMN_SUFFIX 2
+#define URL_HOST_LABELS_COLUMN_IS_PUBLIC_SUFFIX 3
+#define URL_HOST_LABELS_COLUMN_IS_DOMAIN 4
+#define URL_HOST_LABELS_COLUMN_HOST 5
+
+typedef struct url_host_labels_vtab url_host_labels_vtab;
+struct url_host_labels_vtab {
+  sqlite3_vtab base;
+  // connection state, from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_host_labels_cursor url_host_labels_cursor;
+struct url_host_labels_cursor {
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  // the host argument, owned by SQLite's xFilter argument
+  const char *zHost;
+  int nInput;
+  // length of zHost without its trailing dot
+  int nHost;
+  // where the public suffix and the registrable domain start in zHost, or
+  // nHost and -1 when the host has none
+  int iSuffix;
+  int iDomain;
+  // current label is zHost[iStart..iEnd) at depth
+  int iStart;
+  int iEnd;
+  int depth;
+  // boolean, if every label has been read
+  int isEof;
+};
+
+static int urlHostLabelsConnect(sqlite3 *db, void *pAux, int argcUnused,
+                                const char *const *argvUnused,
+                                sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_host_labels_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(depth int, label text, "
+                                "suffix text, is_public_suffix int, "
+                                "is_domain int, host hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlHostLabelsDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsOpen(sqlite3_vtab *pUnused,
+                             sqlite3_vtab_cursor **ppCursor) {
+  url_host_labels_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsClose(sqlite3_vtab_cursor *cur) {
+  url_host_labels_cursor *pCur = (url_host_labels_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+// Moves the cursor to the label before the current one, or to the last
+// label at the start of a scan.
+static void urlHostLabelsStep(url_host_labels_cursor *pCur) {
+  if (pCur->depth > 0 && pCur->iStart == 0) {
+    pCur->isEof = 1;
+    return;
+  }
+  pCur->iEnd = pCur->depth > 0 ? pCur->iStart - 1 : pCur->nHost;
+  pCur->iStart = pCur->iEnd;
+  while (pCur->iStart > 0 && pCur->zHost[pCur->iStart - 1] != '.')
+    pCur->iStart--;
+  pCur->depth++;
+}
+
+static int urlHostLabelsNext(sqlite3_vtab_cursor *cur) {
+  url_host_labels_cursor *pCur = (url_host_labels_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  urlHostLabelsStep(pCur);
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsEof(sqlite3_vtab_cursor *cur) {
+  return ((url_host_labels_cursor *)cur)->isEof;
+}
+
+static int urlHostLabelsColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                               int i) {
+  url_host_labels_cursor *pCur = (url_host_labels_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  switch (i) {
+  case URL_HOST_LABELS_COLUMN_DEPTH:
+    sqlite3_result_int(ctx, pCur->depth);
+    break;
+  case URL_HOST_LABELS_COLUMN_LABEL:
+    urlResultSlice(ctx, pCur->zHost + pCur->iStart,
+                   pCur->iEnd - pCur->iStart);
+    break;
+  case URL_HOST_LABELS_COLUMN_SUFFIX:
+    urlResultSlice(ctx, pCur->zHost + pCur->iStart,
+                   pCur->nHost - pCur->iStart);
+    break;
+  case URL_HOST_LABELS_COLUMN_IS_PUBLIC_SUFFIX:
+    sqlite3_result_int(ctx, pCur->iStart >= pCur->iSuffix);
+    break;
+  case URL_HOST_LABELS_COLUMN_IS_DOMAIN:
+    sqlite3_result_int(ctx, pCur->iStart == pCur->iDomain);
+    break;
+  case URL_HOST_LABELS_COLUMN_HOST:
+    urlResultSlice(ctx, pCur->zHost, pCur->nInput);
+    break;
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsRowid(sqlite3_vtab_cursor *cur,
+                              sqlite_int64 *pRowid) {
+  *pRowid = ((url_host_labels_cursor *)cur)->depth;
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsBestIndex(sqlite3_vtab *pVTab,
+                                  sqlite3_index_info *pIdxInfo) {
+  int iHost = -1, hasUnusableHost = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    if (pCons->iColumn != URL_HOST_LABELS_COLUMN_HOST ||
+        pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+      continue;
+    if (!pCons->usable)
+      hasUnusableHost = 1;
+    else if (iHost < 0)
+      iHost = i;
+  }
+  if (iHost < 0) {
+    if (hasUnusableHost)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("host argument is required");
+    return SQLITE_ERROR;
+  }
+  pIdxInfo->aConstraintUsage[iHost].argvIndex = 1;
+  pIdxInfo->aConstraintUsage[iHost].omit = 1;
+  pIdxInfo->estimatedCost = 10;
+  pIdxInfo->estimatedRows = 3;
+  return SQLITE_OK;
+}
+
+static int urlHostLabelsFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                               const char *idxStr, int argc,
+                               sqlite3_value **argv) {
+  url_host_labels_cursor *pCur = (url_host_labels_cursor *)pVtabCursor;
+  urlStatsTimerStart(&pCur->timer,
+                     &((url_host_labels_vtab *)pVtabCursor->pVtab)
+                          ->pState->aStats[URL_STATS_HOST_LABELS],
+                     1, argv);
+  pCur->zHost = (const char *)sqlite3_value_text(argv[0]);
+  pCur->nInput = sqlite3_value_bytes(argv[0]);
+  pCur->nHost = pCur->nInput;
+  if (pCur->nHost > 0 && pCur->zHost[pCur->nHost - 1] == '.')
+    pCur->nHost--;
+  pCur->iSuffix = pCur->nHost;
+  pCur->iDomain = -1;
+  pCur->depth = 0;
+  pCur->isEof = pCur->nHost == 0;
+  if (!pCur->isEof) {
+    int nPsl = urlPslHostLength(pCur->zHost, pCur->nInput);
+    if (nPsl > 0) {
+      pCur->iSuffix = urlPslSuffix(pCur->zHost, nPsl);
+      pCur->iDomain = urlPslDomain(pCur->zHost, pCur->iSuffix);
+    }
+    urlHostLabelsStep(pCur);
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static sqlite3_module urlHostLabelsModule = {
+    0,                       /* iVersion */
+    0,                       /* xCreate */
+    urlHostLabelsConnect,    /* xConnect */
+    urlHostLabelsBestIndex,  /* xBestIndex */
+    urlHostLabelsDisconnect, /* xDisconnect */
+    0,                       /* xDestroy */
+    urlHostLabelsOpen,       /* xOpen - open a cursor */
+    urlHostLabelsClose,      /* xClose - close a cursor */
+    urlHostLabelsFilter,     /* xFilter - configure scan constraints */
+    urlHostLabelsNext,       /* xNext - advance a cursor */
+    urlHostLabelsEof,        /* xEof - check for end of scan */
+    urlHostLabelsColumn,     /* xColumn - read data */
+    urlHostLabelsRowid,      /* xRowid - read data */
+    0,                       /* xUpdate */
+    0,                       /* xBegin */
+    0,                       /* xSync */
+    0,                       /* xCommit */
+    0,                       /* xRollback */
+    0,                       /* xFindMethod */
+    0,                       /* xRename */
+    0,                       /* xSavepoint */
+    0,                       /* xRelease */
+    0,                       /* xRollbackTo */
+    0                        /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region url_host_range
+
+/** select * from url_host_range(domain)
+ * Table function that returns the bounds of the url_host_reversed() values
+ * of the given domain and its subdomains, so
+ * "url_host_reversed(url) between lower and upper" is a range scan of an
+ * index on url_host_reversed(url). A leading "*." or "." is ignored.
+ */
+
+#define URL_HOST_RANGE_COLUMN_LOWER 0
+#define URL_HOST_RANGE_COLUMN_UPPER 1
+#define URL_HOST_RANGE_COLUMN_DOMAIN 2
+
+typedef struct url_host_range_vtab url_host_range_vtab;
+struct url_host_range_vtab {
+  sqlite3_vtab base;
+  // connection state, from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_host_range_cursor url_host_range_cursor;
+struct url_host_range_cursor {
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  // the domain argument, owned by SQLite's xFilter argument
+  const char *zDomain;
+  int nDomain;
+  // the lower bound, the reversed domain ending with a dot, followed by the
+  // upper bound, the same ending with a "/", the byte after the dot. Both
+  // are nBound bytes.
+  char *zBuf;
+  int nBound;
+  // boolean, if the row has been read
+  int isEof;
+};
+
+static int urlHostRangeConnect(sqlite3 *db, void *pAux, int argcUnused,
+                               const char *const *argvUnused,
+                               sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_host_range_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  // untyped so comparisons with them don't apply text affinity, which would
+  // keep SQLite from using an index on url_host_reversed(), whose values
+  // have no affinity
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(lower, upper, domain hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlHostRangeDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlHostRangeOpen(sqlite3_vtab *pUnused,
+                            sqlite3_vtab_cursor **ppCursor) {
+  url_host_range_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlHostRangeClose(sqlite3_vtab_cursor *cur) {
+  url_host_range_cursor *pCur = (url_host_range_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  sqlite3_free(pCur->zBuf);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+static int urlHostRangeNext(sqlite3_vtab_cursor *cur) {
+  ((url_host_range_cursor *)cur)->isEof = 1;
+  return SQLITE_OK;
+}
+
+static int urlHostRangeEof(sqlite3_vtab_cursor *cur) {
+  return ((url_host_range_cursor *)cur)->isEof;
+}
+
+static int urlHostRangeColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                              int i) {
+  url_host_range_cursor *pCur = (url_host_range_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  switch (i) {
+  case URL_HOST_RANGE_COLUMN_LOWER:
+    urlResultSlice(ctx, pCur->zBuf, pCur->nBound);
+    break;
+  case URL_HOST_RANGE_COLUMN_UPPER:
+    urlResultSlice(ctx, pCur->zBuf + pCur->nBound, pCur->nBound);
+    break;
+  case URL_HOST_RANGE_COLUMN_DOMAIN:
+    urlResultSlice(ctx, pCur->zDomain, pCur->nDomain);
+    break;
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlHostRangeRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  *pRowid = 0;
+  return SQLITE_OK;
+}
+
+static int urlHostRangeBestIndex(sqlite3_vtab *pVTab,
+                                 sqlite3_index_info *pIdxInfo) {
+  int iDomain = -1, hasUnusableDomain = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    if (pCons->iColumn != URL_HOST_RANGE_COLUMN_DOMAIN ||
+        pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+      continue;
+    if (!pCons->usable)
+      hasUnusableDomain = 1;
+    else if (iDomain < 0)
+      iDomain = i;
+  }
+  if (iDomain < 0) {
+    if (hasUnusableDomain)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf("domain argument is required");
+    return SQLITE_ERROR;
+  }
+  pIdxInfo->aConstraintUsage[iDomain].argvIndex = 1;
+  pIdxInfo->aConstraintUsage[iDomain].omit = 1;
+  pIdxInfo->estimatedCost = 1;
+  pIdxInfo->estimatedRows = 1;
+  pIdxInfo->idxFlags = SQLITE_INDEX_SCAN_UNIQUE;
+  return SQLITE_OK;
+}
+
+static int urlHostRangeFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                              const char *idxStr, int argc,
+                              sqlite3_value **argv) {
+  url_host_range_cursor *pCur = (url_host_range_cursor *)pVtabCursor;
+  urlStatsTimerStart(&pCur->timer,
+                     &((url_host_range_vtab *)pVtabCursor->pVtab)
+                          ->pState->aStats[URL_STATS_HOST_RANGE],
+                     1, argv);
+  const char *z = (const char *)sqlite3_value_text(argv[0]);
+  int n = sqlite3_value_bytes(argv[0]);
+  pCur->zDomain = z;
+  pCur->nDomain = n;
+  pCur->isEof = 1;
+  if (n >= 2 && z[0] == '*' && z[1] == '.') {
+    z += 2;
+    n -= 2;
+  } else if (n >= 1 && z[0] == '.') {
+    z++;
+    n--;
+  }
+  if (n == 0 || (n == 1 && z[0] == '.')) {
+    urlStatsTimerPause(&pCur->timer);
+    return SQLITE_OK;
+  }
+  char *zBuf = sqlite3_realloc(pCur->zBuf, 2 * (n + 1));
+  if (!zBuf) {
+    urlStatsTimerPause(&pCur->timer);
+    return SQLITE_NOMEM;
+  }
+  urlStatsAlloc();
+  pCur->zBuf = zBuf;
+  pCur->nBound = urlHostReverseInto(z, n, '.', zBuf) - zBuf;
+  memcpy(zBuf + pCur->nBound, zBuf, pCur->nBound - 1);
+  zBuf[2 * pCur->nBound - 1] = '/';
+  pCur->isEof = 0;
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static sqlite3_module urlHostRangeModule = {
+    0,                      /* iVersion */
+    0,                      /* xCreate */
+    urlHostRangeConnect,    /* xConnect */
+    urlHostRangeBestIndex,  /* xBestIndex */
+    urlHostRangeDisconnect, /* xDisconnect */
+    0,                      /* xDestroy */
+    urlHostRangeOpen,       /* xOpen - open a cursor */
+    urlHostRangeClose,      /* xClose - close a cursor */
+    urlHostRangeFilter,     /* xFilter - configure scan constraints */
+    urlHostRangeNext,       /* xNext - advance a cursor */
+    urlHostRangeEof,        /* xEof - check for end of scan */
+    urlHostRangeColumn,     /* xColumn - read data */
+    urlHostRangeRowid,      /* xRowid - read data */
+    0,                      /* xUpdate */
+    0,                      /* xBegin */
+    0,                      /* xSync */
+    0,                      /* xCommit */
+    0,                      /* xRollback */
+    0,                      /* xFindMethod */
+    0,                      /* xRename */
+    0,                      /* xSavepoint */
+    0,                      /* xRelease */
+    0,                      /* xRollbackTo */
+    0                       /* xShadowName */
+};
+
+#pragma endregion
+
+#pragma region url_pattern_each
+
+/** select * from url_pattern_each(pattern, url)
+ * Table function that returns the groups of the pattern, see
+ * url_pattern_match(), with the text they captured from the given URL or
+ * bare path, in the order they are written. "name" is the name of a
+ * ":name" group or the index of a "*" in its component, "component" the
+ * URL component it is in. "value" is NULL for optional groups that didn't
+ * match. No rows if the URL doesn't match.
+ */
+
+#define URL_PATTERN_EACH_COLUMN_NAME 0
+#define URL_PATTERN_EACH_COLUMN_VALUE 1
+#define URL_PATTERN_EACH_COLUMN_COMPONENT 2
+#define URL_PATTERN_EACH_COLUMN_PATTERN 3
+#define URL_PATTERN_EACH_COLUMN_URL 4
+
+typedef struct url_pattern_each_vtab url_pattern_each_vtab;
+struct url_pattern_each_vtab {
+  sqlite3_vtab base;
+  // connection state with the parsed URL cache, from sqlite3_url_init()
+  url_state *pState;
+};
+
+typedef struct url_pattern_each_cursor url_pattern_each_cursor;
+struct url_pattern_each_cursor {
+  sqlite3_vtab_cursor base;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_timer timer;
+#endif
+  // the url argument, owned by SQLite's xFilter argument
+  const char *zUrl;
+  int nUrl;
+  // the compiled pattern argument, kept while the pattern doesn't change
+  url_pattern *pPattern;
+  // parsed URL the captures point into, NULL for a bare path
+  url_parsed *pParsed;
+  // pPattern->nGroup captures
+  url_pattern_capture *aCapture;
+  // the current group is pPattern->aToken[iToken]
+  int iToken;
+  int isEof;
+};
+
+static int urlPatternEachConnect(sqlite3 *db, void *pAux, int argcUnused,
+                                 const char *const *argvUnused,
+                                 sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_pattern_each_vtab *pNew;
+  int rc;
+  (void)argcUnused;
+  (void)argvUnused;
+  (void)pzErrUnused;
+  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(name text, value text, "
+                                "component text, pattern hidden, url hidden)");
+  if (rc == SQLITE_OK) {
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
+    if (pNew == 0)
+      return SQLITE_NOMEM;
+    memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  }
+  return rc;
+}
+
+static int urlPatternEachDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+static int urlPatternEachOpen(sqlite3_vtab *pUnused,
+                              sqlite3_vtab_cursor **ppCursor) {
+  url_pattern_each_cursor *pCur;
+  (void)pUnused;
+  pCur = sqlite3_malloc(sizeof(*pCur));
+  if (pCur == 0)
+    return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+static int urlPatternEachClose(sqlite3_vtab_cursor *cur) {
+  url_pattern_each_cursor *pCur = (url_pattern_each_cursor *)cur;
+  urlStatsTimerStop(&pCur->timer);
+  urlParsedUnref(pCur->pParsed);
+  sqlite3_free(pCur->pPattern);
+  sqlite3_free(pCur->aCapture);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+// Moves the cursor to the next group of the pattern, from iToken on.
+static void urlPatternEachStep(url_pattern_each_cursor *pCur) {
+  const url_pattern *p = pCur->pPattern;
+  while (pCur->iToken < p->nToken &&
+         p->aToken[pCur->iToken].type == URL_PATTERN_TOKEN_LITERAL)
+    pCur->iToken++;
+  pCur->isEof = pCur->iToken >= p->nToken;
+}
+
+static int urlPatternEachNext(sqlite3_vtab_cursor *cur) {
+  url_pattern_each_cursor *pCur = (url_pattern_each_cursor *)cur;
+  urlStatsTimerResume(&pCur->timer);
+  pCur->iToken++;
+  urlPatternEachStep(pCur);
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlPatternEachEof(sqlite3_vtab_cursor *cur) {
+  return ((url_pattern_each_cursor *)cur)->isEof;
+}
+
+static int urlPatternEachColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                                int i) {
+  url_pattern_each_cursor *pCur = (url_pattern_each_cursor *)cur;
+  const url_pattern_token *pToken = &pCur->pPattern->aToken[pCur->iToken];
+  const url_pattern_capture *pCapture = &pCur->aCapture[pToken->iGroup];
+  urlStatsTimerResume(&pCur->timer);
+  switch (i) {
+  case URL_PATTERN_EACH_COLUMN_NAME:
+    urlResultSlice(ctx, pToken->z, pToken->n);
+    break;
+  case URL_PATTERN_EACH_COLUMN_VALUE:
+    if (pCapture->z)
+      urlResultSlice(ctx, pCapture->z, pCapture->n);
+    break;
+  case URL_PATTERN_EACH_COLUMN_COMPONENT:
+    sqlite3_result_text(ctx, azUrlPatternComponent[pToken->iComponent], -1,
+                        SQLITE_STATIC);
+    break;
+  case URL_PATTERN_EACH_COLUMN_PATTERN:
+    urlResultSlice(ctx, pCur->pPattern->zPattern, pCur->pPattern->nPattern);
+    break;
+  case URL_PATTERN_EACH_COLUMN_URL:
+    urlResultSlice(ctx, pCur->zUrl, pCur->nUrl);
+    break;
+  }
+  urlStatsTimerPause(&pCur->timer);
+  return SQLITE_OK;
+}
+
+static int urlPatternEachRowid(sqlite3_vtab_cursor *cur,
+                               sqlite_int64 *pRowid) {
+  url_pattern_each_cursor *pCur = (url_pattern_each_cursor *)cur;
+  *pRowid = pCur->pPattern->aToken[pCur->iToken].iGroup + 1;
+  return SQLITE_OK;
+}
+
+static int urlPatternEachBestIndex(sqlite3_vtab *pVTab,
+                                   sqlite3_index_info *pIdxInfo) {
+  // the pattern and url constraints
+  int aiCons[2] = {-1, -1};
+  int hasUnusable = 0;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
+    int iArg = pCons->iColumn - URL_PATTERN_EACH_COLUMN_PATTERN;
+    if (iArg < 0 || pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
+      continue;
+    if (!pCons->usable)
+      hasUnusable = 1;
+    else if (aiCons[iArg] < 0)
+      aiCons[iArg] = i;
+  }
+  if (aiCons[0] < 0 || aiCons[1] < 0) {
+    if (hasUnusable)
+      return SQLITE_CONSTRAINT;
+    pVTab->zErrMsg = sqlite3_mprintf(
+        "%s argument is required", aiCons[0] < 0 ? "pattern" : "url");
+    return SQLITE_ERROR;
+  }
+  for (int iArg = 0; iArg < 2; iArg++) {
+    pIdxInfo->aConstraintUsage[aiCons[iArg]].argvIndex = iArg + 1;
+    pIdxInfo->aConstraintUsage[aiCons[iArg]].omit = 1;
+  }
+  pIdxInfo->estimatedCost = 10;
+  pIdxInfo->estimatedRows = 3;
+  return SQLITE_OK;
+}
+
+// Matches the URL argv[1] against the pattern argv[0], compiling the
+// pattern unless it is the one of the previous call, see
+// urlPatternEachFilter().
+static int urlPatternEachStart(url_pattern_each_cursor *pCur,
+                               url_state *pState, sqlite3_value **argv) {
+  const char *zPattern = (const char *)sqlite3_value_text(argv[0]);
+  int nPattern = sqlite3_value_bytes(argv[0]);
+  urlParsedUnref(pCur->pParsed);
+  pCur->pParsed = 0;
+  pCur->iToken = 0;
+  pCur->isEof = 1;
+  pCur->zUrl = (const char *)sqlite3_value_text(argv[1]);
+  pCur->nUrl = sqlite3_value_bytes(argv[1]);
+  if (!zPattern || !pCur->zUrl)
+    return SQLITE_OK;
+  if (!pCur->pPattern || pCur->pPattern->nPattern != nPattern ||
+      memcmp(pCur->pPattern->zPattern, zPattern, nPattern)) {
+    char *zErr;
+    sqlite3_free(pCur->pPattern);
+    pCur->pPattern = urlPatternCompile(zPattern, nPattern, &zErr);
+    if (!pCur->pPattern) {
+      if (!zErr)
+        return SQLITE_NOMEM;
+      sqlite3_free(pCur->base.pVtab->zErrMsg);
+      pCur->base.pVtab->zErrMsg = zErr;
+      return SQLITE_ERROR;
+    }
+    sqlite3_free(pCur->aCapture);
+    pCur->aCapture = sqlite3_malloc64(
+        (pCur->pPattern->nGroup + 1) * sizeof(url_pattern_capture));
+    if (!pCur->aCapture)
+      return SQLITE_NOMEM;
+    urlStatsAlloc();
+  }
+  const url_parts *pParts = 0;
+  const char *zUrl = pCur->zUrl;
+  if (urlHasScheme(pCur->zUrl, pCur->nUrl)) {
+    pCur->pParsed = urlParsedGet(pState, pCur->zUrl, pCur->nUrl);
+    if (!pCur->pParsed)
+      return SQLITE_NOMEM;
+    pParts = &pCur->pParsed->parts;
+    zUrl = pCur->pParsed->zUrl;
+    if (!pParts->valid) {
+      urlStatsFailure();
+      return SQLITE_OK;
+    }
+  }
+  int isMatch = urlPatternMatch(pCur->pPattern, pParts, zUrl, pCur->nUrl,
+                                pCur->aCapture);
+  if (isMatch < 0)
+    return SQLITE_NOMEM;
+  if (isMatch)
+    urlPatternEachStep(pCur);
+  return SQLITE_OK;
+}
+
+static int urlPatternEachFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                                const char *idxStr, int argc,
+                                sqlite3_value **argv) {
+  url_pattern_each_cursor *pCur = (url_pattern_each_cursor *)pVtabCursor;
+  url_state *pState = ((url_pattern_each_vtab *)pVtabCursor->pVtab)->pState;
+  urlStatsTimerStart(&pCur->timer, &pState->aStats[URL_STATS_PATTERN_EACH], 2,
+                     argv);
+  int rc = urlPatternEachStart(pCur, pState, argv);
+  urlStatsTimerPause(&pCur->timer);
+  return rc;
+}
+
+static sqlite3_module urlPatternEachModule = {
+    0,                        /* iVersion */
+    0,                        /* xCreate */
+    urlPatternEachConnect,    /* xConnect */
+    urlPatternEachBestIndex,  /* xBestIndex */
+    urlPatternEachDisconnect, /* xDisconnect */
+    0,                        /* xDestroy */
+    urlPatternEachOpen,       /* xOpen - open a cursor */
+    urlPatternEachClose,      /* xClose - close a cursor */
+    urlPatternEachFilter,     /* xFilter - configure scan constraints */
+    urlPatternEachNext,       /* xNext - advance a cursor */
+    urlPatternEachEof,        /* xEof - check for end of scan */
+    urlPatternEachColumn,     /* xColumn - read data */
+    urlPatternEachRowid,      /* xRowid - read data */
+    0,                        /* xUpdate */
+    0,                        /* xBegin */
+    0,                        /* xSync */
+    0,                        /* xCommit */
+    0,                        /* xRollback */
+    0,                        /* xFindMethod */
+    0,                        /* xRename */
+    0,                        /* xSavepoint */
+    0,                        /* xRelease */
+    0,                        /* xRollbackTo */
+    0                         /* xShadowName */
+};
+
+#pragma endregion
+
+#ifdef SQLITE_URL_ENABLE_STATS
+
+#pragma region url_stats
+
+// Calls the function registered with urlCreateFunction(), updating its
+// counters.
+static void urlStatsFunc(sqlite3_context *context, int argc,
+                         sqlite3_value **argv) {
+  url_stats_function *p = (url_stats_function *)sqlite3_user_data(context);
+  url_stats_timer timer;
+  timer.pStats = 0;
+  urlStatsTimerStart(&timer, &p->pState->aStats[p->iStat], argc, argv);
+  p->xFunc(context, argc, argv);
+  urlStatsTimerPause(&timer);
+  urlStatsTimerStop(&timer);
+}
+
+// Times the xFinal() or xValue() of an aggregate registered with
+// urlCreateWindowFunction(), without counting it as a call.
+static void urlStatsAggResult(sqlite3_context *context,
+                              void (*xResult)(sqlite3_context *)) {
+  url_stats_function *p = (url_stats_function *)sqlite3_user_data(context);
+  url_stats_timer timer;
+  timer.pStats = &p->pState->aStats[p->iStat];
+  urlStatsTimerResume(&timer);
+  xResult(context);
+  urlStatsTimerPause(&timer);
+}
+
+static void urlStatsFinal(sqlite3_context *context) {
+  urlStatsAggResult(
+      context, ((url_stats_function *)sqlite3_user_data(context))->xFinal);
+}
+
+static void urlStatsValue(sqlite3_context *context) {
+  urlStatsAggResult(
+      context, ((url_stats_function *)sqlite3_user_data(context))->xValue);
+}
+
+static void urlStatsFunctionFree(void *p) {
+  urlStateUnref(((url_stats_function *)p)->pState);
+  sqlite3_free(p);
+}
+
+/** url_stats_reset()
+ * Zeroes every counter in url_stats for the current connection. Only
+ * available when built with -DSQLITE_URL_ENABLE_STATS.
+ */
+static void urlStatsResetFunc(sqlite3_context *context, int argc,
+                              sqlite3_value **argv) {
+  url_state *pState = (url_state *)sqlite3_user_data(context);
+  memset(pState->aStats, 0, sizeof(pState->aStats));
+}
+
+/** select * from url_stats
+ * Eponymous table with one row of counters per sqlite-url function, for
+ * the current connection. "latency_histogram" is a JSON array where
+ * element i counts the calls that took [2^i, 2^(i+1)) nanoseconds. Table
+ * functions count one call per scan. Only available when built with
+ * -DSQLITE_URL_ENABLE_STATS.
+ */
+
+#define URL_STATS_COLUMN_NAME 0
+#define URL_STATS_COLUMN_CALLS 1
+#define URL_STATS_COLUMN_FAILURES 2
+#define URL_STATS_COLUMN_BYTES_IN 3
+#define URL_STATS_COLUMN_BYTES_OUT 4
+#define URL_STATS_COLUMN_ALLOCS 5
+#define URL_STATS_COLUMN_TOTAL_NS 6
+#define URL_STATS_COLUMN_LATENCY_HISTOGRAM 7
+
+typedef struct url_stats_vtab url_stats_vtab;
+struct url_stats_vtab {
+  sqlite3_vtab base;
+  url_state *pState;
+};
+
+typedef struct url_stats_cursor url_stats_cursor;
+struct url_stats_cursor {
   sqlite3_vtab_cursor base;
-  sqlite3_int64 iRowid;
-  // curl client to use, to escape names/values
-  CURL *curl;
-  // raw string of the query string to parse
-  // note: might replace '+' with ' '
-  char *querystring;
-  // length of querystring
-  int querystringLength;
-  // boolean, if all sequences in querystring have been read
-  int complete;
-  // pointer?
-  int i;
-  // pointer?
-  int seqStart;
+  // index into url_state.aStats of the current row
+  int iStat;
 };
 
-/*
-** The urlQueryEachReadConnect() method is invoked to create a new
-** urlQueryEach_vtab that describes the urlQueryEach virtual table.
-**
-** Think of this routine as the constructor for urlQueryEach_vtab objects.
-**
-** All this routine needs to do is:
-**
-**    (1) Allocate the urlQueryEach_vtab object and initialize all fields.
-**
-**    (2) Tell SQLite (via the sqlite3_declare_vtab() interface) what the
-**        result set of queries against urlQueryEach will look like.
-*/
-static int urlQueryEachConnect(sqlite3 *db, void *pUnused, int argcUnused,
-                               const char *const *argvUnused,
-                               sqlite3_vtab **ppVtab, char **pzErrUnused) {
-  sqlite3_vtab *pNew;
+static int urlStatsConnect(sqlite3 *db, void *pAux, int argcUnused,
+                           const char *const *argvUnused,
+                           sqlite3_vtab **ppVtab, char **pzErrUnused) {
+  url_stats_vtab *pNew;
   int rc;
-  (void)pUnused;
   (void)argcUnused;
   (void)argvUnused;
   (void)pzErrUnused;
-  rc = sqlite3_declare_vtab(db, "CREATE TABLE x(query hidden, raw_sequence "
-                                "text hidden, name text, value text)");
+  rc = sqlite3_declare_vtab(
+      db, "CREATE TABLE x(name text, calls int, failures int, bytes_in int, "
+          "bytes_out int, allocs int, total_ns int, latency_histogram text)");
   if (rc == SQLITE_OK) {
-    pNew = *ppVtab = sqlite3_malloc(sizeof(*pNew));
+    pNew = sqlite3_malloc(sizeof(*pNew));
+    *ppVtab = (sqlite3_vtab *)pNew;
     if (pNew == 0)
       return SQLITE_NOMEM;
     memset(pNew, 0, sizeof(*pNew));
+    pNew->pState = (url_state *)pAux;
     sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
   }
   return rc;
 }
 
-/*
-** This method is the destructor for url_query_each_cursor objects.
-*/
-static int urlQueryEachDisconnect(sqlite3_vtab *pVtab) {
+static int urlStatsDisconnect(sqlite3_vtab *pVtab) {
   sqlite3_free(pVtab);
   return SQLITE_OK;
 }
 
-/*
-** Constructor for a new url_query_each_cursor object.
-*/
-static int urlQueryEachOpen(sqlite3_vtab *pUnused,
-                            sqlite3_vtab_cursor **ppCursor) {
-  url_query_each_cursor *pCur;
+static int urlStatsOpen(sqlite3_vtab *pUnused,
+                        sqlite3_vtab_cursor **ppCursor) {
+  url_stats_cursor *pCur;
   (void)pUnused;
   pCur = sqlite3_malloc(sizeof(*pCur));
   if (pCur == 0)
     return SQLITE_NOMEM;
   memset(pCur, 0, sizeof(*pCur));
   *ppCursor = &pCur->base;
-  pCur->curl = curl_easy_init();
-  if (!pCur->curl) {
-    return SQLITE_NOMEM;
-  }
-  
   return SQLITE_OK;
 }
 
-/*
-** Destructor for a url_query_each_cursor.
-*/
-static int urlQueryEachClose(sqlite3_vtab_cursor *cur) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
+static int urlStatsClose(sqlite3_vtab_cursor *cur) {
   sqlite3_free(cur);
-  curl_easy_cleanup(pCur->curl);
   return SQLITE_OK;
 }
 
-/*
-** Advance a url_query_each_cursor to its next row of output.
-*/
-static int urlQueryEachNext(sqlite3_vtab_cursor *cur) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
-  pCur->iRowid++;
-  while(pCur->querystring[pCur->i] == '&' && pCur->i < pCur->querystringLength) {
-    pCur->i++;
-  }
-  if (pCur->i >= pCur->querystringLength) {
-    pCur->complete = 1;
-    return SQLITE_OK;
-  }
-  pCur->seqStart = pCur->i;
-
-  // find the end of the current sequence, either end-of-querystring
-  // or '&'
-  while (pCur->i < pCur->querystringLength) {
-    // "Replace any 0x2B (+) in name and value with 0x20 (SP)."
-    if (pCur->querystring[pCur->i] == '+') {
-      pCur->querystring[pCur->i] = 0x20;
-    }
-    if (pCur->querystring[pCur->i] == '&') {
-      pCur->i++;
-      break;
-    }
-    pCur->i++;
-  }
+static int urlStatsNext(sqlite3_vtab_cursor *cur) {
+  ((url_stats_cursor *)cur)->iStat++;
   return SQLITE_OK;
 }
-/*
-** Return TRUE if the cursor has been moved off of the last
-** row of output.
-*/
-static int urlQueryEachEof(sqlite3_vtab_cursor *cur) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
-  return pCur->complete;
+
+static int urlStatsEof(sqlite3_vtab_cursor *cur) {
+  return ((url_stats_cursor *)cur)->iStat >= URL_STATS_COUNT;
 }
 
-/*
-** Return values of columns for the row at which the url_query_each_cursor
-** is currently pointing.
-*/
-static int urlQueryEachColumn(
-    sqlite3_vtab_cursor *cur, /* The cursor */
-    sqlite3_context *ctx,     /* First argument to sqlite3_result_...() */
-    int i                     /* Which column to return */
-) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
-  sqlite3_int64 x = 0;
+// Results the latency histogram of pStats as a JSON array, without its
+// trailing empty buckets.
+static void urlStatsResultHistogram(sqlite3_context *ctx,
+                                    const url_stats *pStats) {
+  int n = URL_STATS_BUCKETS;
+  while (n > 0 && pStats->aLatency[n - 1] == 0)
+    n--;
+  sqlite3_str *s = sqlite3_str_new(sqlite3_context_db_handle(ctx));
+  sqlite3_str_appendchar(s, 1, '[');
+  for (int i = 0; i < n; i++)
+    sqlite3_str_appendf(s, i ? ",%lld" : "%lld", pStats->aLatency[i]);
+  sqlite3_str_appendchar(s, 1, ']');
+  int rc = sqlite3_str_errcode(s);
+  int nOut = sqlite3_str_length(s);
+  char *zOut = sqlite3_str_finish(s);
+  if (rc != SQLITE_OK || !zOut) {
+    sqlite3_free(zOut);
+    sqlite3_result_error_nomem(ctx);
+    return;
+  }
+  sqlite3_result_text(ctx, zOut, nOut, sqlite3_free);
+}
+
+static int urlStatsColumn(sqlite3_vtab_cursor *cur, sqlite3_context *ctx,
+                          int i) {
+  url_stats_cursor *pCur = (url_stats_cursor *)cur;
+  url_state *pState = ((url_stats_vtab *)cur->pVtab)->pState;
+  const url_stats *pStats = &pState->aStats[pCur->iStat];
   switch (i) {
-  case URL_QUERY_EACH_COLUMN_ROWID: {
-    sqlite3_result_int(ctx, pCur->iRowid);
+  case URL_STATS_COLUMN_NAME:
+    sqlite3_result_text(ctx, azUrlStatsName[pCur->iStat], -1, SQLITE_STATIC);
     break;
-  }
-  case URL_QUERY_EACH_COLUMN_QUERY: {
-    sqlite3_result_text(ctx, pCur->querystring, pCur->querystringLength,
-                        SQLITE_TRANSIENT);
+  case URL_STATS_COLUMN_CALLS:
+    sqlite3_result_int64(ctx, pStats->nCall);
     break;
-  }
-  case URL_QUERY_EACH_COLUMN_RAWSEQUENCE: {
-    sqlite3_result_text(ctx, pCur->querystring + pCur->seqStart,
-                        pCur->i - pCur->seqStart, SQLITE_TRANSIENT);
+  case URL_STATS_COLUMN_FAILURES:
+    sqlite3_result_int64(ctx, pStats->nFailure);
+    break;
+  case URL_STATS_COLUMN_BYTES_IN:
+    sqlite3_result_int64(ctx, pStats->nBytesIn);
+    break;
+  case URL_STATS_COLUMN_BYTES_OUT:
+    sqlite3_result_int64(ctx, pStats->nBytesOut);
+    break;
+  case URL_STATS_COLUMN_ALLOCS:
+    sqlite3_result_int64(ctx, pStats->nAlloc);
+    break;
+  case URL_STATS_COLUMN_TOTAL_NS:
+    sqlite3_result_int64(ctx, pStats->nNanos);
+    break;
+  case URL_STATS_COLUMN_LATENCY_HISTOGRAM:
+    urlStatsResultHistogram(ctx, pStats);
     break;
-  }
-  case URL_QUERY_EACH_COLUMN_NAME: {
-    int nameEnd = pCur->i;
-    for (int c = pCur->seqStart; c < pCur->i; c++) {
-      if (pCur->querystring[c] == '=') {
-        nameEnd = c;
-        break;
-      }
-    }
-    char *start = pCur->querystring + pCur->seqStart;
-    int len = nameEnd - pCur->seqStart;
-    int outLen;
-    if (len == 0) {
-      sqlite3_result_text(ctx, start, 0, SQLITE_TRANSIENT);
-      return SQLITE_OK;
-    }
-    char *output = curl_easy_unescape(pCur->curl, start, len, &outLen);
-    if (output) {
-      sqlite3_result_text(ctx, output, outLen, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_result_error_nomem(ctx);
-    }
-    return SQLITE_OK;
-  }
-  case URL_QUERY_EACH_COLUMN_VALUE: {
-    int valueStart = pCur->i;
-    for (int c = pCur->seqStart; c < pCur->i; c++) {
-      if (pCur->querystring[c] == '=') {
-        // "+1" to skip the '='
-        valueStart = c + 1;
-        break;
-      }
-    }
-    char *start;
-    int len;
-    int outLen;
-    if (pCur->querystring[pCur->i - 1] == '&') {
-      // skip starting '=' and the ending '&'
-      len = pCur->i - valueStart - 1;
-    } else {
-      len = pCur->i - valueStart;
-    }
-    char *output = curl_easy_unescape(pCur->curl, pCur->querystring + valueStart, len, &outLen);
-    if (output) {
-      sqlite3_result_text(ctx, output, outLen, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_result_error_nomem(ctx);
-    }
-    return SQLITE_OK;
-  }
   }
   return SQLITE_OK;
 }
 
-/*
-** Return the rowid for the current row. In this implementation, the
-** first row returned is assigned rowid value 1, and each subsequent
-** row a value 1 more than that of the previous.
-*/
-static int urlQueryEachRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)cur;
-  *pRowid = pCur->iRowid;
+static int urlStatsRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  *pRowid = ((url_stats_cursor *)cur)->iStat + 1;
   return SQLITE_OK;
 }
 
-/*
-** SQLite will invoke this method one or more times while planning a query
-** that uses the urlQueryEach virtual table.  This routine needs to create
-** a query plan for each invocation and compute an estimated cost for that
-** plan.
-*/
-static int urlQueryEachBestIndex(sqlite3_vtab *pVTab,
-                                 sqlite3_index_info *pIdxInfo) {
-  int hasQuery = 0;
-
-  for (int i = 0; i < pIdxInfo->nConstraint; i++) {
-    const struct sqlite3_index_constraint *pCons = &pIdxInfo->aConstraint[i];
-    switch (pCons->iColumn) {
-    case URL_QUERY_EACH_COLUMN_QUERY: {
-      if (!hasQuery && !pCons->usable ||
-          pCons->op != SQLITE_INDEX_CONSTRAINT_EQ)
-        return SQLITE_CONSTRAINT;
-      hasQuery = 1;
-      pIdxInfo->aConstraintUsage[i].argvIndex = 1;
-      pIdxInfo->aConstraintUsage[i].omit = 1;
-      break;
-    }
-    }
-  }
-  if (!hasQuery) {
-    pVTab->zErrMsg = sqlite3_mprintf("query argument is required");
-    return SQLITE_ERROR;
-  }
-  pIdxInfo->idxNum = 1;
-  pIdxInfo->estimatedCost = (double)100000;
-  pIdxInfo->estimatedRows = 100000;
-
+static int urlStatsBestIndex(sqlite3_vtab *pVTab,
+                             sqlite3_index_info *pIdxInfo) {
+  (void)pVTab;
+  pIdxInfo->estimatedCost = URL_STATS_COUNT;
+  pIdxInfo->estimatedRows = URL_STATS_COUNT;
   return SQLITE_OK;
 }
 
-/*
-** This method is called to "rewind" the url_query_each_cursor object back
-** to the first row of output.  This method is always called at least
-** once prior to any call to xColumn() or xRowid() or xEof().
-**
-** This routine should initialize the cursor and position it so that it
-** is pointing at the first row, or pointing off the end of the table
-** (so that xEof() will return true) if the table is empty.
-*/
-static int urlQueryEachFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
-                              const char *idxStr, int argc,
-                              sqlite3_value **argv) {
-  url_query_each_cursor *pCur = (url_query_each_cursor *)pVtabCursor;
-  if(sqlite3_value_type(argv[0]) == SQLITE_NULL) {
-    pCur->complete = 1;
-    return SQLITE_OK;  
-  }
-  pCur->querystring = (char *)sqlite3_value_text(argv[0]);
-  pCur->querystringLength = sqlite3_value_bytes(argv[0]);
-  pCur->i = 0;
-  pCur->complete = 0;
-  pCur->iRowid = -1;
-  pCur->seqStart = 0;
-  urlQueryEachNext(pVtabCursor);
+static int urlStatsFilter(sqlite3_vtab_cursor *pVtabCursor, int idxNum,
+                          const char *idxStr, int argc,
+                          sqlite3_value **argv) {
+  ((url_stats_cursor *)pVtabCursor)->iStat = 0;
   return SQLITE_OK;
 }
 
-static sqlite3_module urlQueryEachModule = {
-    0,                      /* iVersion */
-    0,                      /* xCreate */
-    urlQueryEachConnect,    /* xConnect */
-    urlQueryEachBestIndex,  /* xBestIndex */
-    urlQueryEachDisconnect, /* xDisconnect */
-    0,                      /* xDestroy */
-    urlQueryEachOpen,       /* xOpen - open a cursor */
-    urlQueryEachClose,      /* xClose - close a cursor */
-    urlQueryEachFilter,     /* xFilter - configure scan constraints */
-    urlQueryEachNext,       /* xNext - advance a cursor */
-    urlQueryEachEof,        /* xEof - check for end of scan */
-    urlQueryEachColumn,     /* xColumn - read data */
-    urlQueryEachRowid,      /* xRowid - read data */
-    0,                      /* xUpdate */
-    0,                      /* xBegin */
-    0,                      /* xSync */
-    0,                      /* xCommit */
-    0,                      /* xRollback */
-    0,                      /* xFindMethod */
-    0,                      /* xRename */
-    0,                      /* xSavepoint */
-    0,                      /* xRelease */
-    0,                      /* xRollbackTo */
-    0                       /* xShadowName */
+static sqlite3_module urlStatsModule = {
+    0,                  /* iVersion */
+    0,                  /* xCreate */
+    urlStatsConnect,    /* xConnect */
+    urlStatsBestIndex,  /* xBestIndex */
+    urlStatsDisconnect, /* xDisconnect */
+    0,                  /* xDestroy */
+    urlStatsOpen,       /* xOpen - open a cursor */
+    urlStatsClose,      /* xClose - close a cursor */
+    urlStatsFilter,     /* xFilter - configure scan constraints */
+    urlStatsNext,       /* xNext - advance a cursor */
+    urlStatsEof,        /* xEof - check for end of scan */
+    urlStatsColumn,     /* xColumn - read data */
+    urlStatsRowid,      /* xRowid - read data */
+    0,                  /* xUpdate */
+    0,                  /* xBegin */
+    0,                  /* xSync */
+    0,                  /* xCommit */
+    0,                  /* xRollback */
+    0,                  /* xFindMethod */
+    0,                  /* xRename */
+    0,                  /* xSavepoint */
+    0,                  /* xRelease */
+    0,                  /* xRollbackTo */
+    0                   /* xShadowName */
 };
 
 #pragma endregion
 
+#endif
+
 #pragma endregion
 
 #pragma region entrypoints
+
+// Flags of functions whose result only depends on their arguments.
+#define URL_FUNC_PURE (SQLITE_UTF8 | SQLITE_INNOCUOUS | SQLITE_DETERMINISTIC)
+// Flags of functions that read a table named by an argument. Their result
+// changes with the table, so they can't be used in indexes, and schemas
+// can't call them to read tables on behalf of a view or trigger.
+#define URL_FUNC_DIRECT (SQLITE_UTF8 | SQLITE_DIRECTONLY)
+
+// Registers a function with flags, URL_FUNC_PURE or URL_FUNC_DIRECT, that
+// gets the connection state as its user data, see urlContextState(). With
+// SQLITE_URL_ENABLE_STATS, calls are counted in the state's aStats[iStat].
+static int urlCreateFunction(sqlite3 *db, const char *zName, int nArg,
+                             int flags, url_state *pState, int iStat,
+                             void (*xFunc)(sqlite3_context *, int,
+                                           sqlite3_value **)) {
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_function *p = sqlite3_malloc(sizeof(*p));
+  if (!p)
+    return SQLITE_NOMEM;
+  memset(p, 0, sizeof(*p));
+  p->pState = urlStateRef(pState);
+  p->iStat = iStat;
+  p->xFunc = xFunc;
+  return sqlite3_create_function_v2(db, zName, nArg, flags, p, urlStatsFunc,
+                                    0, 0, urlStatsFunctionFree);
+#else
+  (void)iStat;
+  return sqlite3_create_function_v2(db, zName, nArg, flags,
+                                    urlStateRef(pState), xFunc, 0, 0,
+                                    urlStateUnref);
+#endif
+}
+
+// Same as urlCreateFunction(), for aggregate window functions. With
+// SQLITE_URL_ENABLE_STATS, every xStep() counts as a call.
+static int urlCreateWindowFunction(
+    sqlite3 *db, const char *zName, int nArg, url_state *pState, int iStat,
+    void (*xStep)(sqlite3_context *, int, sqlite3_value **),
+    void (*xFinal)(sqlite3_context *), void (*xValue)(sqlite3_context *),
+    void (*xInverse)(sqlite3_context *, int, sqlite3_value **)) {
+  int flags = SQLITE_UTF8 | SQLITE_INNOCUOUS | SQLITE_DETERMINISTIC;
+#ifdef SQLITE_URL_ENABLE_STATS
+  url_stats_function *p = sqlite3_malloc(sizeof(*p));
+  if (!p)
+    return SQLITE_NOMEM;
+  p->pState = urlStateRef(pState);
+  p->iStat = iStat;
+  p->xFunc = xStep;
+  p->xFinal = xFinal;
+  p->xValue = xValue;
+  return sqlite3_create_window_function(db, zName, nArg, flags, p,
+                                        urlStatsFunc, urlStatsFinal,
+                                        urlStatsValue, xInverse,
+                                        urlStatsFunctionFree);
+#else
+  (void)iStat;
+  return sqlite3_create_window_function(db, zName, nArg, flags,
+                                        urlStateRef(pState), xStep, xFinal,
+                                        xValue, xInverse, urlStateUnref);
+#endif
+}
+
 #ifdef _WIN32
 __declspec(dllexport)
 #endif
@@ -785,6 +7677,14 @@ __declspec(dllexport)
   SQLITE_EXTENSION_INIT2(pApi);
 
   (void)pzErrMsg; /* Unused parameter */
+  url_state *state = sqlite3_malloc(sizeof(*state));
+  if (!state)
+    return SQLITE_NOMEM;
+  memset(state, 0, sizeof(*state));
+  // released at the end of this function, each registered function holds
+  // its own reference
+  state->nRef = 1;
+  rc = urlCacheResize(&state->cache, URL_CACHE_DEFAULT_SIZE);
   if (rc == SQLITE_OK)
     rc = sqlite3_create_function(db, "url_version", 0,
                                  SQLITE_UTF8 | SQLITE_INNOCUOUS |
@@ -796,81 +7696,146 @@ __declspec(dllexport)
                                      SQLITE_DETERMINISTIC,
                                  0, urlDebugFunc, 0, 0);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(
-        db, "url", -1, SQLITE_UTF8 | SQLITE_INNOCUOUS | SQLITE_DETERMINISTIC, 0,
-        urlFunc, 0, 0);
+    rc = urlCreateFunction(db, "url", -1, URL_FUNC_PURE, state, URL_STATS_URL,
+                           urlFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_host", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlHostFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_host", 1, URL_FUNC_PURE, state,
+                           URL_STATS_HOST, urlHostFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_valid", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlValidFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_valid", 1, URL_FUNC_PURE, state,
+                           URL_STATS_VALID, urlValidFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_scheme", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlSchemeFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_scheme", 1, URL_FUNC_PURE, state,
+                           URL_STATS_SCHEME, urlSchemeFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_path", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlPathFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_path", 1, URL_FUNC_PURE, state,
+                           URL_STATS_PATH, urlPathFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_query", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlQueryFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_query", 1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERY, urlQueryFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_fragment", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlFragmentFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_fragment", 1, URL_FUNC_PURE, state,
+                           URL_STATS_FRAGMENT, urlFragmentFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_user", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlUserFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_user", 1, URL_FUNC_PURE, state,
+                           URL_STATS_USER, urlUserFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_password", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlPasswordFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_password", 1, URL_FUNC_PURE, state,
+                           URL_STATS_PASSWORD, urlPasswordFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_options", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlOptionsFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_options", 1, URL_FUNC_PURE, state,
+                           URL_STATS_OPTIONS, urlOptionsFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_port", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlPortFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_port", 1, URL_FUNC_PURE, state,
+                           URL_STATS_PORT, urlPortFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_zoneid", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlZoneidFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_zoneid", 1, URL_FUNC_PURE, state,
+                           URL_STATS_ZONEID, urlZoneidFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_escape", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlEscapeFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_escape", 1, URL_FUNC_PURE, state,
+                           URL_STATS_ESCAPE, urlEscapeFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_unescape", 1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlUnescapeFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_unescape", 1, URL_FUNC_PURE, state,
+                           URL_STATS_UNESCAPE, urlUnescapeFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_function(db, "url_querystring", -1,
-                                 SQLITE_UTF8 | SQLITE_INNOCUOUS |
-                                     SQLITE_DETERMINISTIC,
-                                 0, urlQuerystringFunc, 0, 0);
+    rc = urlCreateFunction(db, "url_querystring", -1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERYSTRING, urlQuerystringFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_query_get", -1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERY_GET, urlQueryGetFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_query_set", -1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERY_SET, urlQuerySetFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_query_remove", -1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERY_REMOVE, urlQueryRemoveFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_query_keep", -1, URL_FUNC_PURE, state,
+                           URL_STATS_QUERY_KEEP, urlQueryKeepFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateWindowFunction(db, "url_querystring_agg", 2, state,
+                                 URL_STATS_QUERYSTRING_AGG,
+                                 urlQuerystringAggStep, urlQuerystringAggFinal,
+                                 urlQuerystringAggValue,
+                                 urlQuerystringAggInverse);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_public_suffix", 1, URL_FUNC_PURE, state,
+                           URL_STATS_PUBLIC_SUFFIX, urlPublicSuffixFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_domain", 1, URL_FUNC_PURE, state,
+                           URL_STATS_DOMAIN, urlDomainFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_surt", 1, URL_FUNC_PURE, state,
+                           URL_STATS_SURT, urlSurtFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_reversed", 1, URL_FUNC_PURE, state,
+                           URL_STATS_HOST_REVERSED, urlHostReversedFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_normalize", -1, URL_FUNC_PURE, state,
+                           URL_STATS_NORMALIZE, urlNormalizeFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_fingerprint", -1, URL_FUNC_PURE, state,
+                           URL_STATS_FINGERPRINT, urlFingerprintFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_resolve", 2, URL_FUNC_PURE, state,
+                           URL_STATS_RESOLVE, urlResolveFunc);
   if (rc == SQLITE_OK)
-    rc = sqlite3_create_module(db, "url_query_each", &urlQueryEachModule, 0);
+    rc = urlCreateFunction(db, "url_host_matches", 2, URL_FUNC_DIRECT, state,
+                           URL_STATS_HOST_MATCHES, urlHostMatchesFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_ip", -1, URL_FUNC_PURE, state,
+                           URL_STATS_HOST_IP, urlHostIpFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_in_cidr", 2, URL_FUNC_DIRECT, state,
+                           URL_STATS_HOST_IN_CIDR, urlHostInCidrFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_cidr", 2, URL_FUNC_DIRECT, state,
+                           URL_STATS_HOST_CIDR, urlHostCidrFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_ascii", 1, URL_FUNC_PURE, state,
+                           URL_STATS_HOST_ASCII, urlHostAsciiFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_host_unicode", 1, URL_FUNC_PURE, state,
+                           URL_STATS_HOST_UNICODE, urlHostUnicodeFunc);
+  if (rc == SQLITE_OK)
+    rc = urlCreateFunction(db, "url_pattern_match", 2, URL_FUNC_PURE, state,
+                           URL_STATS_PATTERN_MATCH, urlPatternMatchFunc);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_function_v2(db, "url_config", -1,
+                                    SQLITE_UTF8 | SQLITE_DIRECTONLY,
+                                    urlStateRef(state), urlConfigFunc, 0, 0,
+                                    urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_query_each", &urlQueryEachModule,
+                                  urlStateRef(state), urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_parse", &urlParseModule,
+                                  urlStateRef(state), urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_path_each", &urlPathEachModule,
+                                  urlStateRef(state), urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_host_labels",
+                                  &urlHostLabelsModule, urlStateRef(state),
+                                  urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_host_range", &urlHostRangeModule,
+                                  urlStateRef(state), urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_pattern_each",
+                                  &urlPatternEachModule, urlStateRef(state),
+                                  urlStateUnref);
+#ifdef SQLITE_URL_ENABLE_STATS
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_function_v2(db, "url_stats_reset", 0,
+                                    SQLITE_UTF8 | SQLITE_DIRECTONLY,
+                                    urlStateRef(state), urlStatsResetFunc, 0,
+                                    0, urlStateUnref);
+  if (rc == SQLITE_OK)
+    rc = sqlite3_create_module_v2(db, "url_stats", &urlStatsModule,
+                                  urlStateRef(state), urlStateUnref);
+#endif
+  urlStateUnref(state);
   return rc;
 }
 #pragma endregion
\ No newline at end of file